@@ -39,6 +39,8 @@
 
 
 #include "3dface.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -124,6 +126,7 @@ dxf_3dface_init
         face->flag = 0;
         face->dictionary_owner_soft = strdup ("");
         face->dictionary_owner_hard = strdup ("");
+        face->intern = NULL;
         face->next = NULL;
 #ifdef DEBUG
         DXF_DEBUG_END
@@ -163,7 +166,7 @@ dxf_3dface_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (face == NULL)
@@ -174,9 +177,13 @@ dxf_3dface_read
                 face = dxf_3dface_new ();
                 face = dxf_3dface_init (face);
         }
+        /* The symbol names are interned in the intern table of the
+         * file. */
+        face->intern = fp->intern;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -184,7 +191,7 @@ dxf_3dface_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -200,13 +207,13 @@ dxf_3dface_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", face->linetype);
+                        face->linetype = dxf_intern_read_string (fp, face->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", face->layer);
+                        face->layer = dxf_intern_read_string (fp, face->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -364,14 +371,14 @@ dxf_3dface_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", face->dictionary_owner_soft);
+                        face->dictionary_owner_soft = dxf_read_string (fp, face->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", face->dictionary_owner_hard);
+                        face->dictionary_owner_hard = dxf_read_string (fp, face->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -385,19 +392,37 @@ dxf_3dface_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
-        }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
+        }
+        /* Symbol names not found in the file are still the copies
+         * made by the init function. */
+        face->linetype = dxf_intern_adopt_string ((DxfIntern *) face->intern, face->linetype);
+        face->layer = dxf_intern_adopt_string ((DxfIntern *) face->intern, face->layer);
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (face->linetype, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) face->intern, face->linetype, DXF_INTERN_ID_EMPTY))
+        {
+                dxf_intern_free_string ((DxfIntern *) face->intern, face->linetype);
+                face->linetype = dxf_intern_string ((DxfIntern *) face->intern, DXF_DEFAULT_LINETYPE);
+        }
+        if (dxf_intern_is_symbol ((DxfIntern *) face->intern, face->layer, DXF_INTERN_ID_EMPTY))
         {
-                face->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_intern_free_string ((DxfIntern *) face->intern, face->layer);
+                face->layer = dxf_intern_string ((DxfIntern *) face->intern, DXF_DEFAULT_LAYER);
         }
-        if (strcmp (face->layer, "") == 0)
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (face->id_code > 0))
         {
-                face->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) face->id_code, DFACE, face);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -424,6 +449,8 @@ dxf_3dface_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("3DFACE");
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -444,7 +471,8 @@ dxf_3dface_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (face->linetype, "") == 0)
+        linetype = face->linetype;
+        if (dxf_intern_is_symbol ((DxfIntern *) face->intern, linetype, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -452,9 +480,10 @@ dxf_3dface_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                face->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = dxf_intern_get_symbol ((DxfIntern *) face->intern, DXF_INTERN_ID_DEFAULT_LINETYPE);
         }
-        if (strcmp (face->layer, "") == 0)
+        layer = face->layer;
+        if (dxf_intern_is_symbol ((DxfIntern *) face->intern, layer, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -462,7 +491,7 @@ dxf_3dface_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                face->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = dxf_intern_get_symbol ((DxfIntern *) face->intern, DXF_INTERN_ID_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -502,10 +531,10 @@ dxf_3dface_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", face->layer);
-        if (strcmp (face->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (!dxf_intern_is_symbol ((DxfIntern *) face->intern, linetype, DXF_INTERN_ID_DEFAULT_LINETYPE))
         {
-                fprintf (fp->fp, "  6\n%s\n", face->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if (face->color != DXF_COLOR_BYLAYER)
         {
@@ -581,8 +610,8 @@ dxf_3dface_free
                 __FUNCTION__);
               return (face);
         }
-        free (face->linetype);
-        free (face->layer);
+        dxf_intern_free_string ((DxfIntern *) face->intern, face->linetype);
+        dxf_intern_free_string ((DxfIntern *) face->intern, face->layer);
         free (face->dictionary_owner_soft);
         free (face->dictionary_owner_hard);
         dxf_point_free (face->p0);
@@ -772,7 +801,10 @@ dxf_3dface_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        face->linetype = strdup (linetype);
+        /* Intern first, the new name may be the old one. */
+        linetype = dxf_intern_string ((DxfIntern *) face->intern, linetype);
+        dxf_intern_free_string ((DxfIntern *) face->intern, face->linetype);
+        face->linetype = linetype;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -847,7 +879,10 @@ dxf_3dface_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        face->layer = strdup (layer);
+        /* Intern first, the new name may be the old one. */
+        layer = dxf_intern_string ((DxfIntern *) face->intern, layer);
+        dxf_intern_free_string ((DxfIntern *) face->intern, face->layer);
+        face->layer = layer;
 #if DEBUG
         DXF_DEBUG_END
 #endif
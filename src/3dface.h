@@ -43,6 +43,8 @@
 
 
 #include "global.h"
+#include "intern.h"
+#include "handle_table.h"
 #include "point.h"
 #include "binary_graphics_data.h"
 
@@ -183,6 +185,11 @@ dxf_3dface_struct
                  * <li value = "8"> Fourth edge is invisible.</li>
                  * </ol>
                  * Group code = 70. */
+        struct DxfIntern *intern;
+                /*!< Intern table holding the interned symbol names of
+                 * this entity, \c NULL when none are interned.\n
+                 * Symbol names not found in this table are private
+                 * copies. */
         struct Dxf3dface *next;
                 /*!< Pointer to the next Dxf3dface.\n
                  * \c NULL in the last Dxf3dface. */
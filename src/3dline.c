@@ -36,6 +36,8 @@
 
 
 #include "3dline.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -186,7 +188,7 @@ dxf_3dline_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (line == NULL)
@@ -197,9 +199,10 @@ dxf_3dline_read
                 line = dxf_3dline_new ();
                 line = dxf_3dline_init (line);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -208,7 +211,7 @@ dxf_3dline_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -223,13 +226,13 @@ dxf_3dline_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->linetype);
+                        line->linetype = dxf_read_string (fp, line->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->layer);
+                        line->layer = dxf_read_string (fp, line->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -358,14 +361,14 @@ dxf_3dline_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->dictionary_owner_soft);
+                        line->dictionary_owner_soft = dxf_read_string (fp, line->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->dictionary_owner_hard);
+                        line->dictionary_owner_hard = dxf_read_string (fp, line->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -379,7 +382,13 @@ dxf_3dline_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (line->linetype, "") == 0)
@@ -391,7 +400,7 @@ dxf_3dline_read
                 line->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -428,6 +437,7 @@ dxf_3dline_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("3DLINE");
+        char *layer = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -460,7 +470,8 @@ dxf_3dline_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (line->layer, "") == 0)
+        layer = line->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -468,7 +479,7 @@ dxf_3dline_write
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                line->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = DXF_DEFAULT_LAYER;
         }
         if (fp->acad_version_number > AutoCAD_11)
         {
@@ -513,7 +524,7 @@ dxf_3dline_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", line->layer);
+        fprintf (fp->fp, "  8\n%s\n", layer);
         if (strcmp (line->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
                 fprintf (fp->fp, "  6\n%s\n", line->linetype);
@@ -42,6 +42,8 @@
 
 
 #include "3dsolid.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -192,7 +194,7 @@ dxf_3dsolid_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
@@ -211,9 +213,10 @@ dxf_3dsolid_read
         }
         i = 0;
         j = 0;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -221,7 +224,7 @@ dxf_3dsolid_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -241,7 +244,7 @@ dxf_3dsolid_read
                         fscanf (fp->fp, "%s\n", solid->additional_proprietary_data[j]);
                         j++;
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -253,13 +256,13 @@ dxf_3dsolid_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->linetype);
+                        solid->linetype = dxf_read_string (fp, solid->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->layer);
+                        solid->layer = dxf_read_string (fp, solid->layer);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                   && DXF_FLATLAND
@@ -346,7 +349,7 @@ dxf_3dsolid_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->dictionary_owner_soft);
+                        solid->dictionary_owner_soft = dxf_read_string (fp, solid->dictionary_owner_soft);
                 }
                 else if ((fp->acad_version_number >= AutoCAD_2008)
                         && (strcmp (temp_string, "350") == 0))
@@ -354,14 +357,14 @@ dxf_3dsolid_read
                         /* Now follows a string containing a handle to a
                          * history object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->history);
+                        solid->history = dxf_read_string (fp, solid->history);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->dictionary_owner_hard);
+                        solid->dictionary_owner_hard = dxf_read_string (fp, solid->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -375,7 +378,13 @@ dxf_3dsolid_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (solid->linetype, "") == 0)
@@ -387,7 +396,7 @@ dxf_3dsolid_read
                 solid->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -421,6 +430,8 @@ dxf_3dsolid_write
 #endif
         char *dxf_entity_name = strdup ("3DSOLID");
         int i;
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -447,7 +458,8 @@ dxf_3dsolid_write
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, solid->id_code);
         }
-        if (strcmp (solid->linetype, "") == 0)
+        linetype = solid->linetype;
+        if (strcmp (linetype, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -455,9 +467,10 @@ dxf_3dsolid_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = DXF_DEFAULT_LINETYPE;
         }
-        if (strcmp (solid->layer, "") == 0)
+        layer = solid->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -465,7 +478,7 @@ dxf_3dsolid_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                solid->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -505,10 +518,10 @@ dxf_3dsolid_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", solid->layer);
-        if (strcmp (solid->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (strcmp (linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", solid->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if (solid->color != DXF_COLOR_BYLAYER)
         {
@@ -45,6 +45,8 @@
 
 
 #include "acad_proxy_entity.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -201,7 +203,7 @@ dxf_acad_proxy_entity_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
@@ -220,9 +222,10 @@ dxf_acad_proxy_entity_read
         }
         i = 0;
         j = 0;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -230,7 +233,7 @@ dxf_acad_proxy_entity_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -246,14 +249,14 @@ dxf_acad_proxy_entity_read
                         /* Now follows a string containing the linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", acad_proxy_entity->linetype);
+                        acad_proxy_entity->linetype = dxf_read_string (fp, acad_proxy_entity->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing the layer
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", acad_proxy_entity->layer);
+                        acad_proxy_entity->layer = dxf_read_string (fp, acad_proxy_entity->layer);
                 }
                 else if (strcmp (temp_string, "48") == 0)
                 {
@@ -384,10 +387,16 @@ dxf_acad_proxy_entity_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -48,6 +48,8 @@
 
 
 #include "appid.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -181,7 +183,7 @@ dxf_appid_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (appid == NULL)
@@ -192,9 +194,10 @@ dxf_appid_read
                 appid = dxf_appid_new ();
                 appid = dxf_appid_init (appid);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -203,7 +206,7 @@ dxf_appid_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -218,7 +221,7 @@ dxf_appid_read
                         /* Now follows a string containing an application
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", appid->application_name);
+                        appid->application_name = dxf_read_string (fp, appid->application_name);
                 }
                 else if (strcmp (temp_string, "70") == 0)
                 {
@@ -232,14 +235,14 @@ dxf_appid_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", appid->dictionary_owner_soft);
+                        appid->dictionary_owner_soft = dxf_read_string (fp, appid->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", appid->dictionary_owner_hard);
+                        appid->dictionary_owner_hard = dxf_read_string (fp, appid->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -253,10 +256,16 @@ dxf_appid_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
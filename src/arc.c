@@ -39,6 +39,8 @@
 
 
 #include "arc.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -131,6 +133,7 @@ dxf_arc_init
         arc->paperspace = DXF_MODELSPACE;
         arc->dictionary_owner_soft = strdup ("");
         arc->dictionary_owner_hard = strdup ("");
+        arc->intern = NULL;
         arc->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -171,7 +174,7 @@ dxf_arc_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (arc == NULL)
@@ -182,9 +185,13 @@ dxf_arc_read
                 arc = dxf_arc_new ();
                 arc = dxf_arc_init (arc);
         }
+        /* The symbol names are interned in the intern table of the
+         * file. */
+        arc->intern = fp->intern;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -193,7 +200,7 @@ dxf_arc_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -208,13 +215,13 @@ dxf_arc_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", arc->linetype);
+                        arc->linetype = dxf_intern_read_string (fp, arc->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", arc->layer);
+                        arc->layer = dxf_intern_read_string (fp, arc->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -309,7 +316,8 @@ dxf_arc_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%s\n", temp_string);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbCircle") != 0)))
+                        && (strcmp (temp_string, "AcDbCircle") != 0)
+                        && (strcmp (temp_string, "AcDbArc") != 0))
                         {
                                 fprintf (stderr,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
@@ -342,14 +350,14 @@ dxf_arc_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", arc->dictionary_owner_soft);
+                        arc->dictionary_owner_soft = dxf_read_string (fp, arc->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", arc->dictionary_owner_hard);
+                        arc->dictionary_owner_hard = dxf_read_string (fp, arc->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -363,19 +371,37 @@ dxf_arc_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
-        }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
+        }
+        /* Symbol names not found in the file are still the copies
+         * made by the init function. */
+        arc->linetype = dxf_intern_adopt_string ((DxfIntern *) arc->intern, arc->linetype);
+        arc->layer = dxf_intern_adopt_string ((DxfIntern *) arc->intern, arc->layer);
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (arc->linetype, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) arc->intern, arc->linetype, DXF_INTERN_ID_EMPTY))
         {
-                arc->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_intern_free_string ((DxfIntern *) arc->intern, arc->linetype);
+                arc->linetype = dxf_intern_string ((DxfIntern *) arc->intern, DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (arc->layer, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) arc->intern, arc->layer, DXF_INTERN_ID_EMPTY))
         {
-                arc->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_intern_free_string ((DxfIntern *) arc->intern, arc->layer);
+                arc->layer = dxf_intern_string ((DxfIntern *) arc->intern, DXF_DEFAULT_LAYER);
+        }
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (arc->id_code > 0))
+        {
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) arc->id_code, ARC, arc);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -402,6 +428,8 @@ dxf_arc_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("ARC");
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -483,7 +511,8 @@ dxf_arc_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (arc->linetype, "") == 0)
+        linetype = arc->linetype;
+        if (dxf_intern_is_symbol ((DxfIntern *) arc->intern, linetype, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -491,9 +520,10 @@ dxf_arc_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                arc->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = dxf_intern_get_symbol ((DxfIntern *) arc->intern, DXF_INTERN_ID_DEFAULT_LINETYPE);
         }
-        if (strcmp (arc->layer, "") == 0)
+        layer = arc->layer;
+        if (dxf_intern_is_symbol ((DxfIntern *) arc->intern, layer, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -501,7 +531,7 @@ dxf_arc_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                arc->layer = DXF_DEFAULT_LAYER;
+                layer = dxf_intern_get_symbol ((DxfIntern *) arc->intern, DXF_INTERN_ID_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -541,10 +571,10 @@ dxf_arc_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", arc->layer);
-        if (strcmp (arc->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (!dxf_intern_is_symbol ((DxfIntern *) arc->intern, linetype, DXF_INTERN_ID_DEFAULT_LINETYPE))
         {
-                fprintf (fp->fp, "  6\n%s\n", arc->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
@@ -625,8 +655,8 @@ dxf_arc_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (arc->linetype);
-        free (arc->layer);
+        dxf_intern_free_string ((DxfIntern *) arc->intern, arc->linetype);
+        dxf_intern_free_string ((DxfIntern *) arc->intern, arc->layer);
         free (arc->dictionary_owner_soft);
         free (arc->dictionary_owner_hard);
         free (arc);
@@ -820,7 +850,10 @@ dxf_arc_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->linetype = strdup (linetype);
+        /* Intern first, the new name may be the old one. */
+        linetype = dxf_intern_string ((DxfIntern *) arc->intern, linetype);
+        dxf_intern_free_string ((DxfIntern *) arc->intern, arc->linetype);
+        arc->linetype = linetype;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -898,7 +931,10 @@ dxf_arc_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->layer = strdup (layer);
+        /* Intern first, the new name may be the old one. */
+        layer = dxf_intern_string ((DxfIntern *) arc->intern, layer);
+        dxf_intern_free_string ((DxfIntern *) arc->intern, arc->layer);
+        arc->layer = layer;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2077,4 +2113,69 @@ dxf_arc_set_next
 }
 
 
+/*!
+ * \brief Calculate the nearest point on a DXF \c ARC to a point.
+ *
+ * The point may be outside the plane of the \c arc, the distance is
+ * measured in 3D.
+ *
+ * \return the distance between the point and the \c arc in drawing
+ * units, or -1.0 when an error occurred.
+ *
+ * \version According to DXF R10.
+ * \version According to DXF R11.
+ * \version According to DXF R12.
+ * \version According to DXF R13.
+ * \version According to DXF R14.
+ */
+double
+dxf_arc_calculate_nearest_point
+(
+        DxfArc *arc,
+                /*!< a pointer to a DXF \c ARC entity. */
+        DxfVec3 point,
+                /*!< the point in WCS. */
+        DxfVec3 *nearest,
+                /*!< the nearest point on the \c arc in WCS (output),
+                 * may be \c NULL. */
+        double *parameter
+                /*!< the angle of the nearest point in degrees,
+                 * between the start angle and the end angle (output),
+                 * may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfOcs ocs;
+        DxfVec3 center;
+        double angle;
+        double distance;
+
+        /* Do some basic checks. */
+        if (arc == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1.0);
+        }
+        dxf_ocs_init (&ocs, arc->extr_x0, arc->extr_y0, arc->extr_z0);
+        center.x = arc->x0;
+        center.y = arc->y0;
+        center.z = arc->z0;
+        distance = dxf_vec3_nearest_point_on_arc (&ocs, center, arc->radius,
+          arc->start_angle * M_PI / 180.0, arc->end_angle * M_PI / 180.0,
+          point, nearest, &angle);
+        if (parameter != NULL)
+        {
+                *parameter = angle * 180.0 / M_PI;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (distance);
+}
+
+
 /* EOF*/
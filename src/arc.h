@@ -37,7 +37,10 @@
 
 
 #include "global.h"
+#include "intern.h"
+#include "handle_table.h"
 #include "point.h"
+#include "vec.h"
 
 
 /*!
@@ -134,6 +137,11 @@ dxf_arc
                 /*!< Z-value of the extrusion vector.\n
                  * Defaults to 1.0 if omitted in the DXF file.\n
                  * Group code = 230. */
+        struct DxfIntern *intern;
+                /*!< Intern table holding the interned symbol names of
+                 * this entity, \c NULL when none are interned.\n
+                 * Symbol names not found in this table are private
+                 * copies. */
         struct DxfArc *next;
                 /*!< Pointer to the next DxfArc.\n
                  * \c NULL in the last DxfArc. */
@@ -359,6 +367,14 @@ dxf_arc_set_next
         DxfArc *next
 );
 
+double
+dxf_arc_calculate_nearest_point
+(
+        DxfArc *arc,
+        DxfVec3 point,
+        DxfVec3 *nearest,
+        double *parameter
+);
 
 #endif /* LIBDXF_SRC_ARC_H */
 
@@ -0,0 +1,1262 @@
+/*!
+ * \file area.c
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Functions for the calculation of areas, perimeters and centroids of DXF entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <pthread.h>
+#include "area.h"
+
+
+#define DXF_AREA_GAUSS_POINTS 8
+        /*!< \brief The number of Gauss-Legendre points per interval of
+         * an elliptical arc or a spline. */
+
+
+/*!
+ * \brief Gauss-Legendre abscissae on [-1, 1].
+ */
+static const double dxf_area_gauss_abscissae[DXF_AREA_GAUSS_POINTS] =
+{
+        -0.9602898564975363, -0.7966664774136267,
+        -0.5255324099163290, -0.1834346424956498,
+        0.1834346424956498, 0.5255324099163290,
+        0.7966664774136267, 0.9602898564975363
+};
+
+
+/*!
+ * \brief Gauss-Legendre weights on [-1, 1].
+ */
+static const double dxf_area_gauss_weights[DXF_AREA_GAUSS_POINTS] =
+{
+        0.1012285362903763, 0.2223810344533745,
+        0.3137066458778873, 0.3626837833783620,
+        0.3626837833783620, 0.3137066458778873,
+        0.2223810344533745, 0.1012285362903763
+};
+
+
+/*!
+ * \brief Reset the sums of an area.
+ */
+static void
+dxf_area_clear
+(
+        DxfArea *area
+                /*!< the area. */
+)
+{
+        memset (area, 0, sizeof (DxfArea));
+}
+
+
+/*!
+ * \brief Add a straight segment of a boundary to an area.
+ *
+ * The area and the first moments follow from Green's theorem as
+ * \f$ \frac{1}{2} \oint (x\,dy - y\,dx) \f$,
+ * \f$ \frac{1}{2} \oint x^2\,dy \f$ and
+ * \f$ -\frac{1}{2} \oint y^2\,dx \f$.
+ */
+static void
+dxf_area_add_segment
+(
+        DxfArea *area,
+                /*!< the area. */
+        double x0,
+                /*!< X-value of the start point. */
+        double y0,
+                /*!< Y-value of the start point. */
+        double x1,
+                /*!< X-value of the end point. */
+        double y1
+                /*!< Y-value of the end point. */
+)
+{
+        area->area += 0.5 * (x0 * y1 - x1 * y0);
+        area->moment_x += (y1 - y0) * (x0 * x0 + x0 * x1 + x1 * x1) / 6.0;
+        area->moment_y -= (x1 - x0) * (y0 * y0 + y0 * y1 + y1 * y1) / 6.0;
+        area->perimeter += hypot (x1 - x0, y1 - y0);
+}
+
+
+/*!
+ * \brief Add a circular arc of a boundary to an area.
+ *
+ * The arc runs from \c start over \c sweep radians, counterclockwise
+ * for a positive \c sweep.
+ */
+static void
+dxf_area_add_arc
+(
+        DxfArea *area,
+                /*!< the area. */
+        double xc,
+                /*!< X-value of the center point. */
+        double yc,
+                /*!< Y-value of the center point. */
+        double radius,
+                /*!< radius of the arc. */
+        double start,
+                /*!< start angle in radians. */
+        double sweep
+                /*!< included angle in radians. */
+)
+{
+        double s0 = sin (start);
+        double c0 = cos (start);
+        double s1 = sin (start + sweep);
+        double c1 = cos (start + sweep);
+        double s2 = sin (2.0 * (start + sweep)) - sin (2.0 * start);
+        double r = radius;
+
+        area->area += 0.5 * (r * r * sweep + r * xc * (s1 - s0) - r * yc * (c1 - c0));
+        area->moment_x += 0.5 * r * (xc * xc * (s1 - s0)
+          + 2.0 * xc * r * (0.5 * sweep + 0.25 * s2)
+          + r * r * ((s1 - s1 * s1 * s1 / 3.0) - (s0 - s0 * s0 * s0 / 3.0)));
+        area->moment_y += 0.5 * r * (-yc * yc * (c1 - c0)
+          + 2.0 * yc * r * (0.5 * sweep - 0.25 * s2)
+          + r * r * ((c1 * c1 * c1 / 3.0 - c1) - (c0 * c0 * c0 / 3.0 - c0)));
+        area->perimeter += r * fabs (sweep);
+}
+
+
+/*!
+ * \brief Add a polyline segment with a bulge to an area.
+ */
+static void
+dxf_area_add_bulge_segment
+(
+        DxfArea *area,
+                /*!< the area. */
+        double x0,
+                /*!< X-value of the start point. */
+        double y0,
+                /*!< Y-value of the start point. */
+        double x1,
+                /*!< X-value of the end point. */
+        double y1,
+                /*!< Y-value of the end point. */
+        double bulge
+                /*!< bulge of the segment. */
+)
+{
+        double dx = x1 - x0;
+        double dy = y1 - y0;
+        double h;
+        double xc;
+        double yc;
+
+        if ((bulge == 0.0) || ((dx == 0.0) && (dy == 0.0)))
+        {
+                dxf_area_add_segment (area, x0, y0, x1, y1);
+                return;
+        }
+        /* The center lies left of the chord for a positive bulge (a
+         * counterclockwise arc). */
+        h = (1.0 - bulge * bulge) / (4.0 * bulge);
+        xc = 0.5 * (x0 + x1) - h * dy;
+        yc = 0.5 * (y0 + y1) + h * dx;
+        dxf_area_add_arc (area, xc, yc, hypot (x0 - xc, y0 - yc),
+          atan2 (y0 - yc, x0 - xc), 4.0 * atan (bulge));
+}
+
+
+/*!
+ * \brief Add an elliptical arc of a boundary to an area.
+ *
+ * The points of the arc are \f$ c + u \cos t + v \sin t \f$ for \c t
+ * from \c start over \c sweep radians.\n
+ * The area is integrated in closed form, the first moments and the
+ * length with Gauss-Legendre quadrature over intervals of at most
+ * 1/16 of a turn (exact to rounding for the moments, which are
+ * trigonometric polynomials).
+ */
+static void
+dxf_area_add_elliptical_arc
+(
+        DxfArea *area,
+                /*!< the area. */
+        double xc,
+                /*!< X-value of the center point. */
+        double yc,
+                /*!< Y-value of the center point. */
+        double ux,
+                /*!< X-value of the major axis. */
+        double uy,
+                /*!< Y-value of the major axis. */
+        double vx,
+                /*!< X-value of the minor axis. */
+        double vy,
+                /*!< Y-value of the minor axis. */
+        double start,
+                /*!< start parameter in radians. */
+        double sweep
+                /*!< included parameter range in radians. */
+)
+{
+        double end = start + sweep;
+        double step;
+        double t;
+        double c;
+        double s;
+        double x;
+        double y;
+        double dx;
+        double dy;
+        double w;
+        int intervals;
+        int i;
+        int j;
+
+        area->area += 0.5 * ((ux * vy - uy * vx) * sweep
+          + xc * (uy * (cos (end) - cos (start)) + vy * (sin (end) - sin (start)))
+          - yc * (ux * (cos (end) - cos (start)) + vx * (sin (end) - sin (start))));
+        intervals = (int) ceil (fabs (sweep) / (M_PI / 8.0));
+        if (intervals < 1)
+        {
+                intervals = 1;
+        }
+        step = sweep / intervals;
+        for (i = 0; i < intervals; i++)
+        {
+                for (j = 0; j < DXF_AREA_GAUSS_POINTS; j++)
+                {
+                        t = start + step * (i + 0.5 + 0.5 * dxf_area_gauss_abscissae[j]);
+                        w = 0.5 * step * dxf_area_gauss_weights[j];
+                        c = cos (t);
+                        s = sin (t);
+                        x = xc + ux * c + vx * s;
+                        y = yc + uy * c + vy * s;
+                        dx = -ux * s + vx * c;
+                        dy = -uy * s + vy * c;
+                        area->moment_x += 0.5 * w * x * x * dy;
+                        area->moment_y -= 0.5 * w * y * y * dx;
+                        area->perimeter += fabs (w) * hypot (dx, dy);
+                }
+        }
+}
+
+
+/*!
+ * \brief Add a spline edge of a boundary to an area.
+ *
+ * The area, the first moments and the length are integrated with
+ * Gauss-Legendre quadrature over every knot span (exact to rounding
+ * for the area of a non rational spline up to degree 8), rational and
+ * high degree splines take four intervals per knot span.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the edge
+ * has no valid set of control points and knots.
+ */
+static int
+dxf_area_add_spline
+(
+        DxfArea *area,
+                /*!< the area. */
+        DxfHatchBoundaryPathEdgeSpline *spline
+                /*!< the spline edge. */
+)
+{
+        DxfNurbs *nurbs = NULL;
+        DxfVec3 d[2];
+        const double *knots = NULL;
+        double step;
+        double w;
+        int intervals;
+        int i;
+        int j;
+        int k;
+
+        nurbs = dxf_nurbs_init (dxf_nurbs_new ());
+        if (nurbs == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (dxf_nurbs_set_hatch_spline (nurbs, spline) != EXIT_SUCCESS)
+        {
+                dxf_nurbs_free (nurbs);
+                return (EXIT_FAILURE);
+        }
+        knots = nurbs->knots;
+        intervals = (nurbs->rational || (nurbs->degree > 5)) ? 4 : 1;
+        for (k = nurbs->degree; k < nurbs->number_of_control_points; k++)
+        {
+                if (knots[k] >= knots[k + 1])
+                {
+                        continue;
+                }
+                step = (knots[k + 1] - knots[k]) / intervals;
+                for (i = 0; i < intervals; i++)
+                {
+                        for (j = 0; j < DXF_AREA_GAUSS_POINTS; j++)
+                        {
+                                w = 0.5 * step * dxf_area_gauss_weights[j];
+                                dxf_nurbs_calculate_point (nurbs,
+                                  knots[k] + step * (i + 0.5 + 0.5 * dxf_area_gauss_abscissae[j]),
+                                  1, d);
+                                area->area += 0.5 * w * (d[0].x * d[1].y - d[0].y * d[1].x);
+                                area->moment_x += 0.5 * w * d[0].x * d[0].x * d[1].y;
+                                area->moment_y -= 0.5 * w * d[0].y * d[0].y * d[1].x;
+                                area->perimeter += w * hypot (d[1].x, d[1].y);
+                        }
+                }
+        }
+        dxf_nurbs_free (nurbs);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the start and the signed included angle of an arc or
+ * elliptical arc edge of a hatch boundary path.
+ *
+ * Clockwise edges have mirrored angles.
+ */
+static void
+dxf_area_get_edge_sweep
+(
+        double start_angle,
+                /*!< start angle in degrees. */
+        double end_angle,
+                /*!< end angle in degrees. */
+        int is_ccw,
+                /*!< counterclockwise flag. */
+        double *start,
+                /*!< start angle in radians (output). */
+        double *sweep
+                /*!< included angle in radians, negative for a
+                 * clockwise edge (output). */
+)
+{
+        double included = end_angle - start_angle;
+
+        while (included > 360.0)
+        {
+                included -= 360.0;
+        }
+        while (included <= 0.0)
+        {
+                included += 360.0;
+        }
+        if (is_ccw)
+        {
+                *start = start_angle * M_PI / 180.0;
+                *sweep = included * M_PI / 180.0;
+        }
+        else
+        {
+                *start = -start_angle * M_PI / 180.0;
+                *sweep = -included * M_PI / 180.0;
+        }
+}
+
+
+/*!
+ * \brief Skip the spline frame control points of a polyline.
+ *
+ * \return the first vertex from \c vertex on which is not a spline
+ * frame control point, or \c NULL.
+ */
+static DxfVertex *
+dxf_area_skip_frame_vertices
+(
+        DxfVertex *vertex
+                /*!< a vertex of a polyline, may be \c NULL. */
+)
+{
+        while ((vertex != NULL) && (vertex->flag & 16))
+        {
+                vertex = (DxfVertex *) vertex->next;
+        }
+        return (vertex);
+}
+
+
+/*!
+ * \brief Set the orientation and the centroid of an area from its
+ * sums.
+ */
+static void
+dxf_area_finish
+(
+        DxfArea *area,
+                /*!< the area. */
+        DxfOcs *ocs,
+                /*!< the OCS of the entity, \c NULL for the centroid in
+                 * the plane of the boundary. */
+        double z
+                /*!< elevation of the entity. */
+)
+{
+        double x = 0.0;
+        double y = 0.0;
+
+        if (area->area != 0.0)
+        {
+                x = area->moment_x / area->area;
+                y = area->moment_y / area->area;
+        }
+        if (ocs != NULL)
+        {
+                area->centroid = dxf_ocs_to_wcs (ocs, x, y, z);
+        }
+        else
+        {
+                area->centroid.x = x;
+                area->centroid.y = y;
+                area->centroid.z = z;
+        }
+        area->valid = TRUE;
+}
+
+
+/*!
+ * \brief Add an area to another area with a sign.
+ *
+ * The sums of \c other are oriented counterclockwise before they are
+ * added (\c sign = 1) or subtracted (\c sign = -1).
+ */
+static void
+dxf_area_add_oriented
+(
+        DxfArea *area,
+                /*!< the area. */
+        DxfArea *other,
+                /*!< the area to add. */
+        double sign
+                /*!< 1.0 to add, -1.0 to subtract. */
+)
+{
+        if (other->area < 0.0)
+        {
+                sign = -sign;
+        }
+        area->area += sign * other->area;
+        area->moment_x += sign * other->moment_x;
+        area->moment_y += sign * other->moment_y;
+        area->perimeter += other->perimeter;
+}
+
+
+/*!
+ * \brief Initialize an area.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_area_init
+(
+        DxfArea *area
+                /*!< a pointer to the area. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (area == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_area_clear (area);
+        area->valid = FALSE;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Calculate the area of a DXF hatch boundary path polyline.
+ *
+ * The polyline is a closed polygon (the edge from the last vertex back
+ * to the first vertex is implied), segments with a bulge are exact
+ * arcs.\n
+ * For straight segments the area is
+ *
+ * \image html dxf_hatch_boundary_path_polyline_area2.png
+ *
+ * for a polygon of \c N vertices such as
+ *
+ * \image html dxf_hatch_boundary_path_polyline_area1.png
+ *
+ * The centroid is in the plane of the hatch (Z = 0).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_area_calculate_hatch_boundary_path_polyline
+(
+        DxfHatchBoundaryPathPolyline *polyline,
+                /*!< DXF hatch boundary path polyline entity. */
+        DxfArea *area
+                /*!< the area (output). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathPolylineVertex *vertex = NULL;
+        DxfHatchBoundaryPathPolylineVertex *next = NULL;
+
+        /* Do some basic checks. */
+        if ((polyline == NULL) || (area == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_area_init (area);
+        if (polyline->vertices == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices; vertex != NULL; vertex = (DxfHatchBoundaryPathPolylineVertex *) vertex->next)
+        {
+                next = (DxfHatchBoundaryPathPolylineVertex *) vertex->next;
+                if (next == NULL)
+                {
+                        next = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                }
+                dxf_area_add_bulge_segment (area, vertex->x0, vertex->y0,
+                  next->x0, next->y0, vertex->has_bulge ? vertex->bulge : 0.0);
+        }
+        area->clockwise = (area->area < 0.0);
+        dxf_area_finish (area, NULL, 0.0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Calculate the area of a DXF hatch boundary path (loop).
+ *
+ * The path is made of polylines or of line, arc, elliptical arc and
+ * spline edges.\n
+ * Edges are integrated one by one, so the order in which they are
+ * kept does not matter, as long as they form a closed loop.\n
+ * The centroid is in the plane of the hatch (Z = 0).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the path is
+ * empty, has an invalid spline edge or an error occurred.
+ */
+int
+dxf_area_calculate_hatch_boundary_path
+(
+        DxfHatchBoundaryPath *path,
+                /*!< DXF hatch boundary path entity. */
+        DxfArea *area
+                /*!< the area (output). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathEdge *edge = NULL;
+        DxfHatchBoundaryPathEdgeArc *arc = NULL;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse = NULL;
+        DxfHatchBoundaryPathEdgeLine *line = NULL;
+        DxfHatchBoundaryPathEdgeSpline *spline = NULL;
+        DxfHatchBoundaryPathPolyline *polyline = NULL;
+        DxfArea polyline_area;
+        double start;
+        double sweep;
+        int empty = TRUE;
+
+        /* Do some basic checks. */
+        if ((path == NULL) || (area == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_area_init (area);
+        for (edge = (DxfHatchBoundaryPathEdge *) path->edges; edge != NULL; edge = (DxfHatchBoundaryPathEdge *) edge->next)
+        {
+                for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines; spline != NULL; spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+                {
+                        if (dxf_area_add_spline (area, spline) != EXIT_SUCCESS)
+                        {
+                                dxf_area_init (area);
+                                return (EXIT_FAILURE);
+                        }
+                        empty = FALSE;
+                }
+                for (line = (DxfHatchBoundaryPathEdgeLine *) edge->lines; line != NULL; line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+                {
+                        dxf_area_add_segment (area, line->x0, line->y0, line->x1, line->y1);
+                        empty = FALSE;
+                }
+                for (arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs; arc != NULL; arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+                {
+                        dxf_area_get_edge_sweep (arc->start_angle, arc->end_angle,
+                          arc->is_ccw, &start, &sweep);
+                        dxf_area_add_arc (area, arc->x0, arc->y0, arc->radius, start, sweep);
+                        empty = FALSE;
+                }
+                for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses; ellipse != NULL; ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+                {
+                        dxf_area_get_edge_sweep (ellipse->start_angle, ellipse->end_angle,
+                          ellipse->is_ccw, &start, &sweep);
+                        /* The minor axis is the major axis rotated a
+                         * quarter turn. */
+                        dxf_area_add_elliptical_arc (area, ellipse->x0, ellipse->y0,
+                          ellipse->x1, ellipse->y1,
+                          -ellipse->ratio * ellipse->y1, ellipse->ratio * ellipse->x1,
+                          start, sweep);
+                        empty = FALSE;
+                }
+        }
+        for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines; polyline != NULL; polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+        {
+                if (dxf_area_calculate_hatch_boundary_path_polyline (polyline, &polyline_area) == EXIT_SUCCESS)
+                {
+                        area->area += polyline_area.area;
+                        area->moment_x += polyline_area.moment_x;
+                        area->moment_y += polyline_area.moment_y;
+                        area->perimeter += polyline_area.perimeter;
+                        empty = FALSE;
+                }
+        }
+        if (empty)
+        {
+                return (EXIT_FAILURE);
+        }
+        area->clockwise = (area->area < 0.0);
+        dxf_area_finish (area, NULL, 0.0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test if a boundary path of a hatch is measured with the style
+ * of the hatch.
+ *
+ * Follows the boundary paths that \c dxf_hatch_fill() fills: the Ignore
+ * style takes the external boundary paths only, the Outer style the
+ * external and outermost boundary paths, and the Normal style all
+ * boundary paths.\n
+ * When no boundary path has a type flag the style has no effect.
+ *
+ * \return \c TRUE when the path takes part in the area.
+ */
+static int
+dxf_area_use_hatch_boundary_path
+(
+        DxfHatch *hatch,
+                /*!< the hatch. */
+        DxfHatchBoundaryPath *path,
+                /*!< a boundary path of the hatch. */
+        int flagged
+                /*!< \c TRUE when a path of the hatch has the external
+                 * flag. */
+)
+{
+        if (!flagged)
+        {
+                return (TRUE);
+        }
+        switch (hatch->hatch_style)
+        {
+                case 1:
+                        return ((path->boundary_path_type_flag
+                          & (DXF_HATCH_BOUNDARY_PATH_EXTERNAL | DXF_HATCH_BOUNDARY_PATH_OUTERMOST)) != 0);
+                case 2:
+                        return ((path->boundary_path_type_flag & DXF_HATCH_BOUNDARY_PATH_EXTERNAL) != 0);
+                default:
+                        return (TRUE);
+        }
+}
+
+
+/*!
+ * \brief Get a point on a boundary path of a hatch.
+ *
+ * The point is the first polyline vertex, or a point of the first
+ * edge: the start point of a line edge, the point at a third of an arc
+ * or elliptical arc edge and the first control point of a spline edge.\n
+ * Arc edges often start on a line through the center of another arc,
+ * where containment tests are ill conditioned, so their start point is
+ * not used.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the path
+ * is empty.
+ */
+static int
+dxf_area_get_hatch_boundary_path_point
+(
+        DxfHatchBoundaryPath *path,
+                /*!< a boundary path of a hatch. */
+        DxfVec2 *point
+                /*!< the point (output). */
+)
+{
+        DxfHatchBoundaryPathEdge *edge = NULL;
+        DxfHatchBoundaryPathEdgeArc *arc = NULL;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse = NULL;
+        DxfHatchBoundaryPathEdgeLine *line = NULL;
+        DxfHatchBoundaryPathEdgeSplineCp *control_point = NULL;
+        DxfHatchBoundaryPathPolylineVertex *vertex = NULL;
+        double start;
+        double sweep;
+
+        if ((path->polylines != NULL)
+          && (((DxfHatchBoundaryPathPolyline *) path->polylines)->vertices != NULL))
+        {
+                vertex = (DxfHatchBoundaryPathPolylineVertex *) ((DxfHatchBoundaryPathPolyline *) path->polylines)->vertices;
+                point->x = vertex->x0;
+                point->y = vertex->y0;
+                return (EXIT_SUCCESS);
+        }
+        for (edge = (DxfHatchBoundaryPathEdge *) path->edges; edge != NULL; edge = (DxfHatchBoundaryPathEdge *) edge->next)
+        {
+                if ((line = (DxfHatchBoundaryPathEdgeLine *) edge->lines) != NULL)
+                {
+                        point->x = line->x0;
+                        point->y = line->y0;
+                        return (EXIT_SUCCESS);
+                }
+                if ((arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs) != NULL)
+                {
+                        dxf_area_get_edge_sweep (arc->start_angle, arc->end_angle,
+                          arc->is_ccw, &start, &sweep);
+                        start += sweep / 3.0;
+                        point->x = arc->x0 + arc->radius * cos (start);
+                        point->y = arc->y0 + arc->radius * sin (start);
+                        return (EXIT_SUCCESS);
+                }
+                if ((ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses) != NULL)
+                {
+                        dxf_area_get_edge_sweep (ellipse->start_angle, ellipse->end_angle,
+                          ellipse->is_ccw, &start, &sweep);
+                        start += sweep / 3.0;
+                        point->x = ellipse->x0 + ellipse->x1 * cos (start)
+                          - ellipse->ratio * ellipse->y1 * sin (start);
+                        point->y = ellipse->y0 + ellipse->y1 * cos (start)
+                          + ellipse->ratio * ellipse->x1 * sin (start);
+                        return (EXIT_SUCCESS);
+                }
+                if ((edge->splines != NULL)
+                  && ((control_point = (DxfHatchBoundaryPathEdgeSplineCp *) ((DxfHatchBoundaryPathEdgeSpline *) edge->splines)->control_points) != NULL))
+                {
+                        point->x = control_point->x0;
+                        point->y = control_point->y0;
+                        return (EXIT_SUCCESS);
+                }
+        }
+        return (EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Calculate the net area of a DXF \c HATCH entity.
+ *
+ * The boundary paths are selected with the hatch style as
+ * \c dxf_hatch_fill() does:
+ * <ul>
+ * <li>Normal style: all boundary paths.</li>
+ * <li>Outer style: the external and outermost boundary paths.</li>
+ * <li>Ignore style: the external boundary paths.</li>
+ * </ul>
+ * When no path has the external flag, all paths are selected.\n
+ * The depth of a selected path is the number of other selected paths
+ * around it, tested with \c dxf_hatch_boundary_path_point_inside_path()
+ * on a point of the path.\n
+ * Paths at an even depth are added and paths at an odd depth (islands)
+ * are subtracted, so an island within an island is filled again, as
+ * the Normal style draws it.\n
+ * The perimeter is the total length of the selected paths, the
+ * clockwise flag is the orientation of the first outermost path.
+ *
+ * \note Boundary paths are expected not to cross each other.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the hatch
+ * has no measurable boundary paths or an error occurred.
+ */
+int
+dxf_area_calculate_hatch
+(
+        DxfHatch *hatch,
+                /*!< a pointer to a DXF \c HATCH entity. */
+        DxfArea *area
+                /*!< the area (output). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPath *path = NULL;
+        DxfHatchBoundaryPath **paths = NULL;
+        DxfVec2 *points = NULL;
+        DxfArea path_area;
+        DxfOcs ocs;
+        int number_of_paths = 0;
+        int flagged = FALSE;
+        int first = TRUE;
+        int result = EXIT_SUCCESS;
+        int depth;
+        int inside;
+        int i;
+        int j;
+
+        /* Do some basic checks. */
+        if ((hatch == NULL) || (area == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_area_init (area);
+        for (path = (DxfHatchBoundaryPath *) hatch->paths; path != NULL; path = (DxfHatchBoundaryPath *) path->next)
+        {
+                if (path->boundary_path_type_flag & DXF_HATCH_BOUNDARY_PATH_EXTERNAL)
+                {
+                        flagged = TRUE;
+                }
+                number_of_paths++;
+        }
+        if (number_of_paths == 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        paths = malloc (number_of_paths * sizeof (DxfHatchBoundaryPath *));
+        points = malloc (number_of_paths * sizeof (DxfVec2));
+        if ((paths == NULL) || (points == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (paths);
+                free (points);
+                return (EXIT_FAILURE);
+        }
+        number_of_paths = 0;
+        for (path = (DxfHatchBoundaryPath *) hatch->paths; path != NULL; path = (DxfHatchBoundaryPath *) path->next)
+        {
+                if (!dxf_area_use_hatch_boundary_path (hatch, path, flagged))
+                {
+                        continue;
+                }
+                if (dxf_area_get_hatch_boundary_path_point (path, &points[number_of_paths]) != EXIT_SUCCESS)
+                {
+                        result = EXIT_FAILURE;
+                        break;
+                }
+                paths[number_of_paths] = path;
+                number_of_paths++;
+        }
+        for (i = 0; (i < number_of_paths) && (result == EXIT_SUCCESS); i++)
+        {
+                if (dxf_area_calculate_hatch_boundary_path (paths[i], &path_area) != EXIT_SUCCESS)
+                {
+                        result = EXIT_FAILURE;
+                        break;
+                }
+                depth = 0;
+                for (j = 0; j < number_of_paths; j++)
+                {
+                        if (j == i)
+                        {
+                                continue;
+                        }
+                        inside = dxf_hatch_boundary_path_point_inside_path (paths[j], points[i]);
+                        if (inside == INSIDE)
+                        {
+                                depth++;
+                        }
+                        else if (inside != OUTSIDE)
+                        {
+                                result = EXIT_FAILURE;
+                                break;
+                        }
+                }
+                if (depth % 2)
+                {
+                        dxf_area_add_oriented (area, &path_area, -1.0);
+                }
+                else
+                {
+                        dxf_area_add_oriented (area, &path_area, 1.0);
+                        if ((depth == 0) && first)
+                        {
+                                area->clockwise = path_area.clockwise;
+                                first = FALSE;
+                        }
+                }
+        }
+        free (paths);
+        free (points);
+        if ((result != EXIT_SUCCESS) || (number_of_paths == 0))
+        {
+                dxf_area_init (area);
+                return (EXIT_FAILURE);
+        }
+        dxf_ocs_init (&ocs, hatch->extr_x0, hatch->extr_y0, hatch->extr_z0);
+        dxf_area_finish (area, &ocs, hatch->z0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Calculate the area of a closed DXF \c LWPOLYLINE entity.
+ *
+ * Segments with a bulge are exact arcs.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * polyline is not closed, has less than two vertices or an error
+ * occurred.
+ */
+int
+dxf_area_calculate_lwpolyline
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        DxfArea *area
+                /*!< the area (output). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLWPolylineVertex *vertices = NULL;
+        DxfOcs ocs;
+        int n;
+        int i;
+
+        /* Do some basic checks. */
+        if ((lwpolyline == NULL) || (area == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_area_init (area);
+        vertices = lwpolyline->vertices;
+        n = lwpolyline->number_vertices;
+        if (!(lwpolyline->flag & 1) || (vertices == NULL) || (n < 2))
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < n; i++)
+        {
+                dxf_area_add_bulge_segment (area, vertices[i].x0, vertices[i].y0,
+                  vertices[(i + 1) % n].x0, vertices[(i + 1) % n].y0,
+                  vertices[i].bulge);
+        }
+        area->clockwise = (area->area < 0.0);
+        dxf_ocs_init (&ocs, lwpolyline->extr_x0, lwpolyline->extr_y0, lwpolyline->extr_z0);
+        dxf_area_finish (area, &ocs, lwpolyline->elevation);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Calculate the area of a closed 2D DXF \c POLYLINE entity.
+ *
+ * Segments with a bulge are exact arcs, the spline frame control
+ * points of a spline fit polyline are skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * polyline is not closed, is a 3D polyline or a mesh, has less than two
+ * vertices or an error occurred.
+ */
+int
+dxf_area_calculate_polyline
+(
+        DxfPolyline *polyline,
+                /*!< a pointer to a DXF \c POLYLINE entity. */
+        DxfArea *area
+                /*!< the area (output). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVertex *first = NULL;
+        DxfVertex *vertex = NULL;
+        DxfVertex *next = NULL;
+        DxfOcs ocs;
+        int n = 0;
+
+        /* Do some basic checks. */
+        if ((polyline == NULL) || (area == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_area_init (area);
+        if (!(polyline->flag & 1) || (polyline->flag & (8 | 16 | 64)))
+        {
+                return (EXIT_FAILURE);
+        }
+        first = dxf_area_skip_frame_vertices ((DxfVertex *) polyline->vertices);
+        for (vertex = first; vertex != NULL; vertex = next)
+        {
+                next = dxf_area_skip_frame_vertices ((DxfVertex *) vertex->next);
+                dxf_area_add_bulge_segment (area, vertex->x0, vertex->y0,
+                  (next == NULL) ? first->x0 : next->x0,
+                  (next == NULL) ? first->y0 : next->y0,
+                  vertex->bulge);
+                n++;
+        }
+        if (n < 2)
+        {
+                dxf_area_init (area);
+                return (EXIT_FAILURE);
+        }
+        area->clockwise = (area->area < 0.0);
+        dxf_ocs_init (&ocs, polyline->extr_x0, polyline->extr_y0, polyline->extr_z0);
+        dxf_area_finish (area, &ocs, polyline->z0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Calculate the area of an entity.
+ *
+ * Supported are \c HATCH, closed \c LWPOLYLINE and closed 2D
+ * \c POLYLINE entities.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the type is
+ * not supported, the entity has no area or an error occurred.
+ */
+int
+dxf_area_calculate_entity
+(
+        int type,
+                /*!< type of the entity, a \c DxfEntityType value. */
+        void *entity,
+                /*!< a pointer to the entity. */
+        DxfArea *area
+                /*!< the area (output). */
+)
+{
+        /* Do some basic checks. */
+        if ((entity == NULL) || (area == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        switch (type)
+        {
+                case HATCH:
+                        return (dxf_area_calculate_hatch ((DxfHatch *) entity, area));
+                case LWPOLYLINE:
+                        return (dxf_area_calculate_lwpolyline ((DxfLWPolyline *) entity, area));
+                case POLYLINE:
+                        return (dxf_area_calculate_polyline ((DxfPolyline *) entity, area));
+                default:
+                        dxf_area_init (area);
+                        return (EXIT_FAILURE);
+        }
+}
+
+
+/*!
+ * \brief The entities shared by the threads of
+ * \c dxf_area_calculate_entities().
+ */
+typedef struct
+dxf_area_job
+{
+        DxfDrawingEntity *entities;
+                /*!< Array of entities. */
+        DxfArea *areas;
+                /*!< Array of areas (output). */
+        int number_of_entities;
+                /*!< Number of entities. */
+        int next_entity;
+                /*!< Index of the first unclaimed entity. */
+} DxfAreaJob;
+
+
+/*!
+ * \brief Run a worker thread of \c dxf_area_calculate_entities().
+ *
+ * Claims \c DXF_AREA_ENTITIES_PER_TASK entities at a time until all
+ * entities are claimed.
+ *
+ * \return \c NULL.
+ */
+static void *
+dxf_area_worker
+(
+        void *data
+                /*!< a pointer to the \c DxfAreaJob. */
+)
+{
+        DxfAreaJob *job = (DxfAreaJob *) data;
+        int first;
+        int last;
+        int i;
+
+        while ((first = __atomic_fetch_add (&job->next_entity, DXF_AREA_ENTITIES_PER_TASK, __ATOMIC_RELAXED)) < job->number_of_entities)
+        {
+                last = first + DXF_AREA_ENTITIES_PER_TASK;
+                last = (last < job->number_of_entities) ? last : job->number_of_entities;
+                for (i = first; i < last; i++)
+                {
+                        if (job->entities[i].entity == NULL)
+                        {
+                                dxf_area_init (&job->areas[i]);
+                                continue;
+                        }
+                        dxf_area_calculate_entity (job->entities[i].type,
+                          job->entities[i].entity, &job->areas[i]);
+                }
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Calculate the areas of a number of entities on multiple
+ * threads.
+ *
+ * Entities without an area (see \c dxf_area_calculate_entity()) get an
+ * area with \c valid set to \c FALSE.\n
+ * The entities must not be modified while they are measured.
+ *
+ * \return the number of entities with an area, or -1 when an error
+ * occurred.
+ */
+int
+dxf_area_calculate_entities
+(
+        DxfDrawingEntity *entities,
+                /*!< an array of entities. */
+        int number_of_entities,
+                /*!< number of entities in \c entities. */
+        DxfArea *areas,
+                /*!< an array of \c number_of_entities areas (output). */
+        int number_of_threads
+                /*!< number of threads, 0 for the number of online
+                 * processors. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfAreaJob job;
+        pthread_t *threads = NULL;
+        int started = 0;
+        int result = 0;
+        int i;
+
+        /* Do some basic checks. */
+        if ((number_of_entities > 0) && ((entities == NULL) || (areas == NULL)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (number_of_entities <= 0)
+        {
+                return (0);
+        }
+        if (number_of_threads <= 0)
+        {
+                number_of_threads = (int) sysconf (_SC_NPROCESSORS_ONLN);
+        }
+        /* No more threads than tasks. */
+        i = (number_of_entities + DXF_AREA_ENTITIES_PER_TASK - 1) / DXF_AREA_ENTITIES_PER_TASK;
+        number_of_threads = (number_of_threads < i) ? number_of_threads : i;
+        job.entities = entities;
+        job.areas = areas;
+        job.number_of_entities = number_of_entities;
+        job.next_entity = 0;
+        if (number_of_threads > 1)
+        {
+                threads = malloc (number_of_threads * sizeof (pthread_t));
+        }
+        if (threads != NULL)
+        {
+                for (i = 1; i < number_of_threads; i++)
+                {
+                        if (pthread_create (&threads[started], NULL, dxf_area_worker, &job) == 0)
+                        {
+                                started++;
+                        }
+                }
+        }
+        /* The calling thread measures entities too. */
+        dxf_area_worker (&job);
+        for (i = 0; i < started; i++)
+        {
+                pthread_join (threads[i], NULL);
+        }
+        free (threads);
+        for (i = 0; i < number_of_entities; i++)
+        {
+                if (areas[i].valid)
+                {
+                        result++;
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/* EOF */
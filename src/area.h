@@ -0,0 +1,147 @@
+/*!
+ * \file area.h
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Header file for the calculation of areas, perimeters and centroids of DXF entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_AREA_H
+#define LIBDXF_SRC_AREA_H
+
+
+#include "global.h"
+#include "vec.h"
+#include "drawing.h"
+#include "entity.h"
+#include "hatch.h"
+#include "lwpolyline.h"
+#include "nurbs.h"
+#include "polyline.h"
+#include "vertex.h"
+
+
+#define DXF_AREA_ENTITIES_PER_TASK 256
+        /*!< \brief The number of entities measured by a thread of
+         * \c dxf_area_calculate_entities() before claiming the next
+         * entities. */
+
+
+/*!
+ * \brief Definition of the area, perimeter and centroid of a closed
+ * boundary.
+ *
+ * Boundaries are integrated exactly (Green's theorem) in the plane of
+ * the entity (the OCS), including arcs, bulges and elliptical arcs,
+ * spline edges are integrated with Gauss-Legendre quadrature.\n
+ * Areas of boundaries and of their islands are combined by adding
+ * their areas and first moments of area.
+ */
+typedef struct
+dxf_area_struct
+{
+        int valid;
+                /*!< \c TRUE when the other members are set. */
+        double area;
+                /*!< Area, positive for a counterclockwise boundary and
+                 * negative for a clockwise boundary.\n
+                 * The net area of a hatch (the boundary minus the
+                 * islands) is always positive. */
+        double perimeter;
+                /*!< Length of the boundary (including the boundaries
+                 * of the islands). */
+        double moment_x;
+                /*!< First moment of \c area about the OCS Y axis
+                 * (the integral of x over the area). */
+        double moment_y;
+                /*!< First moment of \c area about the OCS X axis
+                 * (the integral of y over the area). */
+        int clockwise;
+                /*!< \c TRUE when the boundary (the outer boundary of a
+                 * hatch) is clockwise. */
+        DxfVec3 centroid;
+                /*!< Centroid of the area in WCS. */
+} DxfArea;
+
+
+int
+dxf_area_init
+(
+        DxfArea *area
+);
+int
+dxf_area_calculate_hatch_boundary_path_polyline
+(
+        DxfHatchBoundaryPathPolyline *polyline,
+        DxfArea *area
+);
+int
+dxf_area_calculate_hatch_boundary_path
+(
+        DxfHatchBoundaryPath *path,
+        DxfArea *area
+);
+int
+dxf_area_calculate_hatch
+(
+        DxfHatch *hatch,
+        DxfArea *area
+);
+int
+dxf_area_calculate_lwpolyline
+(
+        DxfLWPolyline *lwpolyline,
+        DxfArea *area
+);
+int
+dxf_area_calculate_polyline
+(
+        DxfPolyline *polyline,
+        DxfArea *area
+);
+int
+dxf_area_calculate_entity
+(
+        int type,
+        void *entity,
+        DxfArea *area
+);
+int
+dxf_area_calculate_entities
+(
+        DxfDrawingEntity *entities,
+        int number_of_entities,
+        DxfArea *areas,
+        int number_of_threads
+);
+
+#endif /* LIBDXF_SRC_AREA_H */
+
+
+/* EOF */
@@ -33,6 +33,8 @@
 
 
 #include "attdef.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -191,7 +193,7 @@ dxf_attdef_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (attdef == NULL)
@@ -202,9 +204,10 @@ dxf_attdef_read
                 attdef = dxf_attdef_new ();
                 attdef = dxf_attdef_init (attdef);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -213,7 +216,7 @@ dxf_attdef_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
@@ -221,20 +224,20 @@ dxf_attdef_read
                         /* Now follows a string containing the attribute
                          * default value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attdef->default_value);
+                        attdef->default_value = dxf_read_string (fp, attdef->default_value);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a tag value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attdef->tag_value);
+                        attdef->tag_value = dxf_read_string (fp, attdef->tag_value);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a prompt
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attdef->prompt_value);
+                        attdef->prompt_value = dxf_read_string (fp, attdef->prompt_value);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -248,19 +251,19 @@ dxf_attdef_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attdef->linetype);
+                        attdef->linetype = dxf_read_string (fp, attdef->linetype);
                 }
                 else if (strcmp (temp_string, "7") == 0)
                 {
                         /* Now follows a string containing a text style. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attdef->text_style);
+                        attdef->text_style = dxf_read_string (fp, attdef->text_style);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attdef->layer);
+                        attdef->layer = dxf_read_string (fp, attdef->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -459,14 +462,14 @@ dxf_attdef_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attdef->dictionary_owner_soft);
+                        attdef->dictionary_owner_soft = dxf_read_string (fp, attdef->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attdef->dictionary_owner_hard);
+                        attdef->dictionary_owner_hard = dxf_read_string (fp, attdef->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -480,7 +483,13 @@ dxf_attdef_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (attdef->linetype, "") == 0)
@@ -492,7 +501,7 @@ dxf_attdef_read
                 attdef->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -522,6 +531,11 @@ dxf_attdef_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("ATTDEF");
+        char *layer = NULL;
+        char *linetype = NULL;
+        char *text_style = NULL;
+        double height;
+        double rel_x_scale;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -551,7 +565,8 @@ dxf_attdef_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (attdef->text_style, "") == 0)
+        text_style = attdef->text_style;
+        if (strcmp (text_style, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () text style string is empty for the %s entity with id-code: %x.\n")),
@@ -559,9 +574,10 @@ dxf_attdef_write
                 fprintf (stderr,
                   (_("\tdefault text style STANDARD applied to %s entity.\n")),
                   dxf_entity_name);
-                attdef->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);
+                text_style = DXF_DEFAULT_TEXTSTYLE;
         }
-        if (strcmp (attdef->linetype, "") == 0)
+        linetype = attdef->linetype;
+        if (strcmp (linetype, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -569,9 +585,10 @@ dxf_attdef_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                attdef->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = DXF_DEFAULT_LINETYPE;
         }
-        if (strcmp (attdef->layer, "") == 0)
+        layer = attdef->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -579,9 +596,10 @@ dxf_attdef_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                attdef->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = DXF_DEFAULT_LAYER;
         }
-        if (attdef->height == 0.0)
+        height = attdef->height;
+        if (height == 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %x.\n")),
@@ -589,9 +607,10 @@ dxf_attdef_write
                 fprintf (stderr,
                   (_("\tdefault height of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
-                attdef->height = 1.0;
+                height = 1.0;
         }
-        if (attdef->rel_x_scale == 0.0)
+        rel_x_scale = attdef->rel_x_scale;
+        if (rel_x_scale == 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x.\n")),
@@ -599,7 +618,7 @@ dxf_attdef_write
                 fprintf (stderr,
                   (_("\tdefault relative X-scale of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
-                attdef->rel_x_scale = 1.0;
+                rel_x_scale = 1.0;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -639,10 +658,10 @@ dxf_attdef_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", attdef->layer);
-        if (strcmp (attdef->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (strcmp (linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", attdef->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if (attdef->color != DXF_COLOR_BYLAYER)
         {
@@ -667,7 +686,7 @@ dxf_attdef_write
         fprintf (fp->fp, " 10\n%f\n", attdef->x0);
         fprintf (fp->fp, " 20\n%f\n", attdef->y0);
         fprintf (fp->fp, " 30\n%f\n", attdef->z0);
-        fprintf (fp->fp, " 40\n%f\n", attdef->height);
+        fprintf (fp->fp, " 40\n%f\n", height);
         fprintf (fp->fp, "  1\n%s\n", attdef->default_value);
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -684,17 +703,17 @@ dxf_attdef_write
         {
                 fprintf (fp->fp, " 50\n%f\n", attdef->rot_angle);
         }
-        if (attdef->rel_x_scale != 1.0)
+        if (rel_x_scale != 1.0)
         {
-                fprintf (fp->fp, " 41\n%f\n", attdef->rel_x_scale);
+                fprintf (fp->fp, " 41\n%f\n", rel_x_scale);
         }
         if (attdef->obl_angle != 0.0)
         {
                 fprintf (fp->fp, " 51\n%f\n", attdef->obl_angle);
         }
-        if (strcmp (attdef->text_style, "STANDARD") != 0)
+        if (strcmp (text_style, "STANDARD") != 0)
         {
-                fprintf (fp->fp, "  7\n%s\n", attdef->text_style);
+                fprintf (fp->fp, "  7\n%s\n", text_style);
         }
         if (attdef->text_flags != 0)
         {
@@ -720,8 +739,6 @@ dxf_attdef_write
                         fprintf (stderr,
                           (_("\tdefault justification applied to %s entity.\n")),
                           dxf_entity_name);
-                        attdef->hor_align = 0;
-                        attdef->vert_align = 0;
                 }
                 else
                 {
@@ -33,6 +33,8 @@
 
 
 #include "attrib.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -193,7 +195,7 @@ dxf_attrib_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (attrib == NULL)
@@ -204,9 +206,10 @@ dxf_attrib_read
                 attrib = dxf_attrib_new ();
                 attrib = dxf_attrib_init (attrib);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -215,7 +218,7 @@ dxf_attrib_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
@@ -223,13 +226,13 @@ dxf_attrib_read
                         /* Now follows a string containing the attribute
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attrib->default_value);
+                        attrib->default_value = dxf_read_string (fp, attrib->default_value);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a tag value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attrib->tag_value);
+                        attrib->tag_value = dxf_read_string (fp, attrib->tag_value);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -243,19 +246,19 @@ dxf_attrib_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attrib->linetype);
+                        attrib->linetype = dxf_read_string (fp, attrib->linetype);
                 }
                 else if (strcmp (temp_string, "7") == 0)
                 {
                         /* Now follows a string containing a text style. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attrib->text_style);
+                        attrib->text_style = dxf_read_string (fp, attrib->text_style);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attrib->layer);
+                        attrib->layer = dxf_read_string (fp, attrib->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -454,14 +457,14 @@ dxf_attrib_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attrib->dictionary_owner_soft);
+                        attrib->dictionary_owner_soft = dxf_read_string (fp, attrib->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attrib->dictionary_owner_hard);
+                        attrib->dictionary_owner_hard = dxf_read_string (fp, attrib->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -475,7 +478,13 @@ dxf_attrib_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (attrib->linetype, "") == 0)
@@ -487,11 +496,11 @@ dxf_attrib_read
                 attrib->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (attrib);
 }
 
 
@@ -517,6 +526,11 @@ dxf_attrib_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("ATTRIB");
+        char *layer = NULL;
+        char *linetype = NULL;
+        char *text_style = NULL;
+        double height;
+        double rel_x_scale;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -555,7 +569,8 @@ dxf_attrib_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (attrib->text_style, "") == 0)
+        text_style = attrib->text_style;
+        if (strcmp (text_style, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () text style string is empty for the %s entity with id-code: %x.\n")),
@@ -563,9 +578,10 @@ dxf_attrib_write
                 fprintf (stderr,
                   (_("\tdefault text style STANDARD applied to %s entity.\n")),
                   dxf_entity_name);
-                attrib->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);
+                text_style = DXF_DEFAULT_TEXTSTYLE;
         }
-        if (strcmp (attrib->linetype, "") == 0)
+        linetype = attrib->linetype;
+        if (strcmp (linetype, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -573,9 +589,10 @@ dxf_attrib_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                attrib->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = DXF_DEFAULT_LINETYPE;
         }
-        if (strcmp (attrib->layer, "") == 0)
+        layer = attrib->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
@@ -583,9 +600,10 @@ dxf_attrib_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to the default layer.\n")),
                   dxf_entity_name);
-                attrib->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = DXF_DEFAULT_LAYER;
         }
-        if (attrib->height == 0.0)
+        height = attrib->height;
+        if (height == 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %x.\n")),
@@ -593,9 +611,10 @@ dxf_attrib_write
                 fprintf (stderr,
                   (_("\tdefault height of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
-                attrib->height = 1.0;
+                height = 1.0;
         }
-        if (attrib->rel_x_scale == 0.0)
+        rel_x_scale = attrib->rel_x_scale;
+        if (rel_x_scale == 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x.\n")),
@@ -603,7 +622,7 @@ dxf_attrib_write
                 fprintf (stderr,
                   (_("\tdefault relative X-scale of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
-                attrib->rel_x_scale = 1.0;
+                rel_x_scale = 1.0;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -643,10 +662,10 @@ dxf_attrib_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", attrib->layer);
-        if (strcmp (attrib->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (strcmp (linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", attrib->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if (attrib->color != DXF_COLOR_BYLAYER)
         {
@@ -677,7 +696,7 @@ dxf_attrib_write
         fprintf (fp->fp, " 10\n%f\n", attrib->x0);
         fprintf (fp->fp, " 20\n%f\n", attrib->y0);
         fprintf (fp->fp, " 30\n%f\n", attrib->z0);
-        fprintf (fp->fp, " 40\n%f\n", attrib->height);
+        fprintf (fp->fp, " 40\n%f\n", height);
         fprintf (fp->fp, "  1\n%s\n", attrib->default_value);
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -693,17 +712,17 @@ dxf_attrib_write
         {
                 fprintf (fp->fp, " 50\n%f\n", attrib->rot_angle);
         }
-        if (attrib->rel_x_scale != 1.0)
+        if (rel_x_scale != 1.0)
         {
-                fprintf (fp->fp, " 41\n%f\n", attrib->rel_x_scale);
+                fprintf (fp->fp, " 41\n%f\n", rel_x_scale);
         }
         if (attrib->obl_angle != 0.0)
         {
                 fprintf (fp->fp, " 51\n%f\n", attrib->obl_angle);
         }
-        if (strcmp (attrib->text_style, "STANDARD") != 0)
+        if (strcmp (text_style, "STANDARD") != 0)
         {
-                fprintf (fp->fp, "  7\n%s\n", attrib->text_style);
+                fprintf (fp->fp, "  7\n%s\n", text_style);
         }
         if (attrib->text_flags != 0)
         {
@@ -729,8 +748,6 @@ dxf_attrib_write
                         fprintf (stderr,
                           (_("    default justification applied to %s entity\n")),
                           dxf_entity_name);
-                        attrib->hor_align = 0;
-                        attrib->vert_align = 0;
                 }
                 else
                 {
@@ -0,0 +1,944 @@
+/*!
+ * \file batch.c
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Functions for processing a batch of DXF files on a pool of worker threads.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "batch.h"
+#include "entity.h"
+#include "memory_stats.h"
+
+
+/*!
+ * \brief Queue of files of a worker thread.
+ *
+ * The owner takes files from the \c head, other workers steal files
+ * from the \c tail.
+ */
+typedef struct
+dxf_batch_queue
+{
+        pthread_mutex_t mutex;
+                /*!< Lock for \c head and \c tail. */
+        DxfBatchResult **jobs;
+                /*!< Array of results of the queued files. */
+        int head;
+                /*!< Index of the next file for the owner. */
+        int tail;
+                /*!< Index past the last queued file. */
+} DxfBatchQueue;
+
+
+/*!
+ * \brief Worker thread of a batch.
+ */
+typedef struct
+dxf_batch_worker
+{
+        DxfBatch *batch;
+                /*!< The batch. */
+        DxfBatchQueue *queues;
+                /*!< The queues of all workers. */
+        int number_of_workers;
+                /*!< Number of workers (and queues). */
+        int index;
+                /*!< Index of this worker. */
+        pthread_t thread;
+                /*!< The thread running this worker. */
+} DxfBatchWorker;
+
+
+/*!
+ * \brief Get a monotonic wall clock time.
+ *
+ * \return the time in seconds.
+ */
+static double
+dxf_batch_get_time ()
+{
+        struct timespec ts;
+
+        clock_gettime (CLOCK_MONOTONIC, &ts);
+        return ((double) ts.tv_sec + (double) ts.tv_nsec * 1.0e-9);
+}
+
+
+/*!
+ * \brief Compare two results for sorting largest file first.
+ *
+ * Files of equal size keep the order in which they were added.
+ *
+ * \return a negative value when \c a goes first, a positive value when
+ * \c b goes first.
+ */
+static int
+dxf_batch_compare_file_size
+(
+        const void *a,
+                /*!< a pointer to a pointer to a result. */
+        const void *b
+                /*!< a pointer to a pointer to a result. */
+)
+{
+        const DxfBatchResult *result_a = *(DxfBatchResult * const *) a;
+        const DxfBatchResult *result_b = *(DxfBatchResult * const *) b;
+
+        if (result_a->file_size != result_b->file_size)
+        {
+                return ((result_a->file_size > result_b->file_size) ? -1 : 1);
+        }
+        return ((result_a < result_b) ? -1 : (result_a > result_b));
+}
+
+
+/*!
+ * \brief Take the next file from a queue.
+ *
+ * \return a pointer to the result of the file, or \c NULL when the
+ * queue is empty.
+ */
+static DxfBatchResult *
+dxf_batch_queue_take
+(
+        DxfBatchQueue *queue,
+                /*!< a pointer to a queue. */
+        int steal
+                /*!< take from the tail in stead of the head. */
+)
+{
+        DxfBatchResult *result = NULL;
+
+        pthread_mutex_lock (&queue->mutex);
+        if (queue->head < queue->tail)
+        {
+                if (steal)
+                {
+                        queue->tail--;
+                        result = queue->jobs[queue->tail];
+                }
+                else
+                {
+                        result = queue->jobs[queue->head];
+                        queue->head++;
+                }
+        }
+        pthread_mutex_unlock (&queue->mutex);
+        return (result);
+}
+
+
+/*!
+ * \brief Compose the name of the output file for an input file.
+ *
+ * \return a pointer to the allocated file name, or \c NULL when no
+ * memory could be allocated.
+ */
+static char *
+dxf_batch_get_output_filename
+(
+        DxfBatch *batch,
+                /*!< a pointer to the batch. */
+        const char *filename
+                /*!< name of the input file. */
+)
+{
+        const char *base = NULL;
+        char *output_filename = NULL;
+        size_t size;
+
+        if (batch->output_directory == NULL)
+        {
+                size = strlen (filename) + strlen (".out.dxf") + 1;
+                if ((output_filename = malloc (size)) != NULL)
+                {
+                        snprintf (output_filename, size, "%s.out.dxf", filename);
+                }
+                return (output_filename);
+        }
+        base = strrchr (filename, '/');
+        base = (base == NULL) ? filename : base + 1;
+        size = strlen (batch->output_directory) + strlen (base) + 2;
+        if ((output_filename = malloc (size)) != NULL)
+        {
+                snprintf (output_filename, size, "%s/%s",
+                  batch->output_directory, base);
+        }
+        return (output_filename);
+}
+
+
+/*!
+ * \brief Write a drawing to a file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_batch_write_drawing
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to the drawing. */
+        const char *filename,
+                /*!< name of the output file. */
+        int acad_version_number
+                /*!< AutoCAD version number of the output file. */
+)
+{
+        DxfFile fp;
+        int result;
+
+        memset (&fp, 0, sizeof (DxfFile));
+        if ((fp.fp = fopen (filename, "w")) == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        fp.filename = (char *) filename;
+        fp.acad_version_number = acad_version_number;
+        result = dxf_file_write (&fp, drawing);
+        if (fclose (fp.fp) != 0)
+        {
+                result = EXIT_FAILURE;
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Compare the entities of a drawing with the entities read back
+ * from the file written for it.
+ *
+ * The entities have to appear in the same order, with the same types
+ * and handles.
+ *
+ * \return \c TRUE when the entities match, \c FALSE otherwise.
+ */
+static int
+dxf_batch_compare_entities
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to the drawing written. */
+        DxfDrawing *check
+                /*!< a pointer to the drawing read back. */
+)
+{
+        DxfChunkListIter iter;
+        DxfChunkListIter check_iter;
+        DxfDrawingEntity *entry = NULL;
+        DxfDrawingEntity *check_entry = NULL;
+
+        if (dxf_drawing_get_number_of_entities (check) != dxf_drawing_get_number_of_entities (drawing))
+        {
+                return (FALSE);
+        }
+        dxf_chunk_list_iter_init ((DxfChunkList *) drawing->entities, &iter);
+        dxf_chunk_list_iter_init ((DxfChunkList *) check->entities, &check_iter);
+        while ((entry = dxf_chunk_list_iter_next (&iter)) != NULL)
+        {
+                check_entry = dxf_chunk_list_iter_next (&check_iter);
+                if ((check_entry == NULL)
+                  || (check_entry->type != entry->type)
+                  || (dxf_entity_get_id_code (check_entry->type, check_entry->entity)
+                  != dxf_entity_get_id_code (entry->type, entry->entity)))
+                {
+                        return (FALSE);
+                }
+        }
+        return (TRUE);
+}
+
+
+/*!
+ * \brief Process one file of a batch.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_batch_process_file
+(
+        DxfBatch *batch,
+                /*!< a pointer to the batch. */
+        DxfBatchResult *result
+                /*!< a pointer to the result of the file. */
+)
+{
+        DxfDrawing *drawing = NULL;
+        DxfDrawing *check = NULL;
+        DxfHeader *header = NULL;
+        DxfMemoryStats stats;
+        int acad_version_number;
+
+        if (result->file_size < 0)
+        {
+                result->error = "file not found";
+                return (EXIT_FAILURE);
+        }
+        drawing = dxf_file_read (result->filename);
+        if (drawing == NULL)
+        {
+                result->error = "read failed";
+                return (EXIT_FAILURE);
+        }
+        result->number_of_entities = dxf_drawing_get_number_of_entities (drawing);
+        result->number_of_skipped_entities = drawing->number_of_skipped_entities;
+        if ((result->number_of_entities == 0)
+          && (result->number_of_skipped_entities > 0))
+        {
+                /* Writing the drawing would silently drop all
+                 * entities. */
+                result->error = "no entities read from a non-empty ENTITIES section";
+                dxf_drawing_free (drawing);
+                return (EXIT_FAILURE);
+        }
+        header = (DxfHeader *) drawing->header;
+        acad_version_number = ((header != NULL) && (header->_AcadVer != 0))
+          ? header->_AcadVer
+          : AutoCAD_2000;
+        switch (batch->operation)
+        {
+                case DXF_BATCH_PARSE:
+                        break;
+                case DXF_BATCH_STATISTICS:
+                        if (dxf_drawing_memory_stats (drawing, &stats) != EXIT_SUCCESS)
+                        {
+                                result->error = "memory accounting failed";
+                                break;
+                        }
+                        result->memory_bytes = dxf_memory_stats_get_bytes (&stats.total);
+                        break;
+                case DXF_BATCH_CONVERT:
+                        acad_version_number = batch->acad_version_number;
+                        if (header != NULL)
+                        {
+                                free (header->AcadVer);
+                                header->AcadVer = strdup (dxf_header_acad_version_to_string (acad_version_number));
+                                header->_AcadVer = acad_version_number;
+                        }
+                        /* Fall through. */
+                case DXF_BATCH_ROUND_TRIP:
+                        result->output_filename = dxf_batch_get_output_filename (batch, result->filename);
+                        if (result->output_filename == NULL)
+                        {
+                                result->error = "could not allocate memory";
+                                break;
+                        }
+                        if (dxf_batch_write_drawing (drawing, result->output_filename, acad_version_number) != EXIT_SUCCESS)
+                        {
+                                result->error = "write failed";
+                                break;
+                        }
+                        if (batch->operation != DXF_BATCH_ROUND_TRIP)
+                        {
+                                break;
+                        }
+                        check = dxf_file_read (result->output_filename);
+                        if (check == NULL)
+                        {
+                                result->error = "read back failed";
+                                break;
+                        }
+                        if (!dxf_batch_compare_entities (drawing, check))
+                        {
+                                result->error = "entity types or handles differ after read back";
+                        }
+                        dxf_drawing_free (check);
+                        break;
+        }
+        dxf_drawing_free (drawing);
+        return ((result->error == NULL) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Run a worker thread of a batch.
+ *
+ * \return \c NULL.
+ */
+static void *
+dxf_batch_worker_run
+(
+        void *data
+                /*!< a pointer to the \c DxfBatchWorker. */
+)
+{
+        DxfBatchWorker *worker = (DxfBatchWorker *) data;
+        DxfBatchResult *result = NULL;
+        double start;
+        int i;
+
+        for (;;)
+        {
+                result = dxf_batch_queue_take (&worker->queues[worker->index], FALSE);
+                /* Steal from the other workers, nearest neighbour first. */
+                for (i = 1; (result == NULL) && (i < worker->number_of_workers); i++)
+                {
+                        result = dxf_batch_queue_take (&worker->queues[(worker->index + i) % worker->number_of_workers], TRUE);
+                }
+                if (result == NULL)
+                {
+                        /* Files are only queued before the workers
+                         * start, so all work is taken. */
+                        break;
+                }
+                start = dxf_batch_get_time ();
+                result->worker = worker->index;
+                result->status = dxf_batch_process_file (worker->batch, result);
+                result->seconds = dxf_batch_get_time () - start;
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Allocate memory for a DXF batch.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfBatch *
+dxf_batch_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBatch *batch = NULL;
+        size_t size;
+
+        size = sizeof (DxfBatch);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((batch = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfBatch struct.\n")),
+                  __FUNCTION__);
+                batch = NULL;
+        }
+        else
+        {
+                memset (batch, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (batch);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a DXF batch.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfBatch *
+dxf_batch_init
+(
+        DxfBatch *batch,
+                /*!< a pointer to a DXF batch. */
+        DxfBatchOperation operation
+                /*!< operation performed on every file. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (batch == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                batch = dxf_batch_new ();
+        }
+        if (batch == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfBatch struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        batch->operation = operation;
+        batch->acad_version_number = AutoCAD_2000;
+        batch->output_directory = NULL;
+        batch->number_of_threads = 0;
+        batch->results = NULL;
+        batch->number_of_results = 0;
+        batch->results_size = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (batch);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a DXF batch and all results.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_batch_free
+(
+        DxfBatch *batch
+                /*!< a pointer to the memory occupied by the DXF batch. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (batch == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < batch->number_of_results; i++)
+        {
+                free (batch->results[i].filename);
+                free (batch->results[i].output_filename);
+        }
+        free (batch->results);
+        free (batch->output_directory);
+        free (batch);
+        batch = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a file to a DXF batch.
+ *
+ * The size of the file is determined here, a file which can not be
+ * found is reported as a failure by \c dxf_batch_run().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_batch_add_file
+(
+        DxfBatch *batch,
+                /*!< a pointer to a DXF batch. */
+        const char *filename
+                /*!< name of the file. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBatchResult *results = NULL;
+        DxfBatchResult *result = NULL;
+        struct stat st;
+        int size;
+
+        /* Do some basic checks. */
+        if ((batch == NULL) || (filename == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (batch->number_of_results == batch->results_size)
+        {
+                size = (batch->results_size == 0)
+                  ? DXF_BATCH_INITIAL_NUMBER_OF_RESULTS
+                  : 2 * batch->results_size;
+                results = realloc (batch->results, size * sizeof (DxfBatchResult));
+                if (results == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for batch results.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                batch->results = results;
+                batch->results_size = size;
+        }
+        result = &batch->results[batch->number_of_results];
+        memset (result, 0, sizeof (DxfBatchResult));
+        if ((result->filename = strdup (filename)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a file name.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result->file_size = (stat (filename, &st) == 0) ? (long) st.st_size : -1;
+        result->status = EXIT_FAILURE;
+        result->worker = -1;
+        batch->number_of_results++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Process all files of a DXF batch.
+ *
+ * Blocks until all files are processed, the outcome of every file is
+ * stored in its result.
+ *
+ * \return \c EXIT_SUCCESS when all files were processed succesfully,
+ * or \c EXIT_FAILURE when an error occurred.
+ */
+int
+dxf_batch_run
+(
+        DxfBatch *batch
+                /*!< a pointer to a DXF batch. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBatchResult **jobs = NULL;
+        DxfBatchQueue *queues = NULL;
+        DxfBatchWorker *workers = NULL;
+        int number_of_workers;
+        int i;
+        int j;
+
+        /* Do some basic checks. */
+        if (batch == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (batch->number_of_results == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        number_of_workers = batch->number_of_threads;
+        if (number_of_workers <= 0)
+        {
+                number_of_workers = (int) sysconf (_SC_NPROCESSORS_ONLN);
+        }
+        if (number_of_workers > batch->number_of_results)
+        {
+                number_of_workers = batch->number_of_results;
+        }
+        if (number_of_workers < 1)
+        {
+                number_of_workers = 1;
+        }
+        jobs = malloc (batch->number_of_results * sizeof (DxfBatchResult *));
+        queues = malloc (number_of_workers * sizeof (DxfBatchQueue));
+        workers = malloc (number_of_workers * sizeof (DxfBatchWorker));
+        if ((jobs == NULL) || (queues == NULL) || (workers == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for worker queues.\n")),
+                  __FUNCTION__);
+                free (jobs);
+                free (queues);
+                free (workers);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < batch->number_of_results; i++)
+        {
+                jobs[i] = &batch->results[i];
+        }
+        qsort (jobs, batch->number_of_results, sizeof (DxfBatchResult *),
+          dxf_batch_compare_file_size);
+        /* Deal the files largest first over the queues, the queue of
+         * worker w holds the files w, w + n, w + 2n, ... of the sorted
+         * list, stored in a slice of jobs. */
+        for (i = 0; i < number_of_workers; i++)
+        {
+                pthread_mutex_init (&queues[i].mutex, NULL);
+                queues[i].jobs = malloc (((batch->number_of_results / number_of_workers) + 1) * sizeof (DxfBatchResult *));
+                queues[i].head = 0;
+                queues[i].tail = 0;
+        }
+        for (i = 0; i < batch->number_of_results; i++)
+        {
+                j = i % number_of_workers;
+                if (queues[j].jobs != NULL)
+                {
+                        queues[j].jobs[queues[j].tail++] = jobs[i];
+                }
+                else
+                {
+                        jobs[i]->error = "could not allocate memory";
+                }
+        }
+        for (i = 0; i < number_of_workers; i++)
+        {
+                workers[i].batch = batch;
+                workers[i].queues = queues;
+                workers[i].number_of_workers = number_of_workers;
+                workers[i].index = i;
+        }
+        for (i = 1; i < number_of_workers; i++)
+        {
+                if (pthread_create (&workers[i].thread, NULL, dxf_batch_worker_run, &workers[i]) != 0)
+                {
+                        /* The other workers steal the queued files. */
+                        workers[i].index = -1;
+                }
+        }
+        /* The calling thread is worker 0. */
+        dxf_batch_worker_run (&workers[0]);
+        for (i = 1; i < number_of_workers; i++)
+        {
+                if (workers[i].index >= 0)
+                {
+                        pthread_join (workers[i].thread, NULL);
+                }
+        }
+        for (i = 0; i < number_of_workers; i++)
+        {
+                pthread_mutex_destroy (&queues[i].mutex);
+                free (queues[i].jobs);
+        }
+        free (workers);
+        free (queues);
+        free (jobs);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((dxf_batch_get_number_of_failures (batch) == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Get the number of failed files of a DXF batch.
+ *
+ * \return the number of failed files, or -1 when an error occurred.
+ */
+int
+dxf_batch_get_number_of_failures
+(
+        DxfBatch *batch
+                /*!< a pointer to a DXF batch. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int number_of_failures = 0;
+        int i;
+
+        /* Do some basic checks. */
+        if (batch == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        for (i = 0; i < batch->number_of_results; i++)
+        {
+                if (batch->results[i].status != EXIT_SUCCESS)
+                {
+                        number_of_failures++;
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (number_of_failures);
+}
+
+
+/*!
+ * \brief Write a string as a JSON string.
+ */
+static void
+dxf_batch_write_json_string
+(
+        FILE *fp,
+                /*!< a file pointer to an output file (or device). */
+        const char *string
+                /*!< the string, \c NULL is written as \c null. */
+)
+{
+        if (string == NULL)
+        {
+                fputs ("null", fp);
+                return;
+        }
+        fputc ('"', fp);
+        for (; *string != '\0'; string++)
+        {
+                if ((*string == '"') || (*string == '\\'))
+                {
+                        fprintf (fp, "\\%c", *string);
+                }
+                else if ((unsigned char) *string < 0x20)
+                {
+                        fprintf (fp, "\\u%04x", (unsigned char) *string);
+                }
+                else
+                {
+                        fputc (*string, fp);
+                }
+        }
+        fputc ('"', fp);
+}
+
+
+/*!
+ * \brief Write the results of a DXF batch.
+ *
+ * One JSON object per line for every file, in the order in which the
+ * files were added, e.g.:\n
+ * <tt>{"file": "a.dxf", "size": 1024, "operation": "parse",
+ * "status": "ok", "error": null, "seconds": 0.000512, "worker": 0,
+ * "entities": 12, "memory_bytes": 0, "output": null}</tt>
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_batch_write_results
+(
+        FILE *fp,
+                /*!< a file pointer to an output file (or device). */
+        DxfBatch *batch
+                /*!< a pointer to a DXF batch. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBatchResult *result = NULL;
+        int i;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (batch == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < batch->number_of_results; i++)
+        {
+                result = &batch->results[i];
+                fputs ("{\"file\": ", fp);
+                dxf_batch_write_json_string (fp, result->filename);
+                fprintf (fp, ", \"size\": %ld, \"operation\": \"%s\", \"status\": \"%s\", \"error\": ",
+                  result->file_size,
+                  dxf_batch_operation_to_string (batch->operation),
+                  (result->status == EXIT_SUCCESS) ? "ok" : "error");
+                dxf_batch_write_json_string (fp, result->error);
+                fprintf (fp, ", \"seconds\": %.6f, \"worker\": %d, \"entities\": %d, \"skipped_entities\": %d, \"memory_bytes\": %lu, \"output\": ",
+                  result->seconds,
+                  result->worker,
+                  result->number_of_entities,
+                  result->number_of_skipped_entities,
+                  (unsigned long) result->memory_bytes);
+                dxf_batch_write_json_string (fp, result->output_filename);
+                fputs ("}\n", fp);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((ferror (fp) == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Get the name of a batch operation.
+ *
+ * \return the name of the operation, or \c NULL for an unknown
+ * operation.
+ */
+const char *
+dxf_batch_operation_to_string
+(
+        DxfBatchOperation operation
+                /*!< a batch operation. */
+)
+{
+        switch (operation)
+        {
+                case DXF_BATCH_PARSE:
+                        return ("parse");
+                case DXF_BATCH_STATISTICS:
+                        return ("statistics");
+                case DXF_BATCH_ROUND_TRIP:
+                        return ("round-trip");
+                case DXF_BATCH_CONVERT:
+                        return ("convert");
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Get the batch operation for a name.
+ *
+ * \return the \c DxfBatchOperation value, or -1 for an unknown name.
+ */
+int
+dxf_batch_operation_from_string
+(
+        const char *name
+                /*!< name of the operation. */
+)
+{
+        int operation;
+
+        if (name == NULL)
+        {
+                return (-1);
+        }
+        for (operation = DXF_BATCH_PARSE; operation <= DXF_BATCH_CONVERT; operation++)
+        {
+                if (strcmp (name, dxf_batch_operation_to_string (operation)) == 0)
+                {
+                        return (operation);
+                }
+        }
+        return (-1);
+}
+
+
+/* EOF */
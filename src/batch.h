@@ -0,0 +1,188 @@
+/*!
+ * \file batch.h
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Header file for processing a batch of DXF files on a pool of worker threads.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_BATCH_H
+#define LIBDXF_SRC_BATCH_H
+
+
+#include "global.h"
+#include "drawing.h"
+#include "file.h"
+
+
+#define DXF_BATCH_INITIAL_NUMBER_OF_RESULTS 64
+        /*!< \brief The initial number of allocated entries in the
+         * \c results of a \c DxfBatch. */
+
+
+/*!
+ * \brief Operations performed on every file of a batch.
+ */
+typedef enum
+dxf_batch_operation
+{
+        DXF_BATCH_PARSE,
+                /*!< Read the file. */
+        DXF_BATCH_STATISTICS,
+                /*!< Read the file and account the memory of the
+                 * drawing. */
+        DXF_BATCH_ROUND_TRIP,
+                /*!< Read the file, write the drawing and read the
+                 * written file back, the entities read back have to
+                 * have the same types and handles in the same order. */
+        DXF_BATCH_CONVERT
+                /*!< Read the file and write the drawing for another
+                 * AutoCAD version. */
+} DxfBatchOperation;
+
+
+/*!
+ * \brief Result of the processing of one file of a batch.
+ */
+typedef struct
+dxf_batch_result
+{
+        char *filename;
+                /*!< Name of the input file. */
+        long file_size;
+                /*!< Size of the input file in bytes, -1 when the file
+                 * could not be found. */
+        char *output_filename;
+                /*!< Name of the written file, \c NULL when no file was
+                 * written. */
+        int status;
+                /*!< \c EXIT_SUCCESS or \c EXIT_FAILURE. */
+        const char *error;
+                /*!< Description of the failure, \c NULL when
+                 * succesful. */
+        double seconds;
+                /*!< Wall clock time spent on the file. */
+        int worker;
+                /*!< Index of the worker thread which processed the
+                 * file. */
+        int number_of_entities;
+                /*!< Number of entities in the drawing. */
+        int number_of_skipped_entities;
+                /*!< Number of entities in the file which could not be
+                 * read. */
+        size_t memory_bytes;
+                /*!< Number of bytes allocated for the drawing
+                 * (\c DXF_BATCH_STATISTICS only). */
+} DxfBatchResult;
+
+
+/*!
+ * \brief Definition of a batch of DXF files.
+ *
+ * The files are processed on \c number_of_threads worker threads.\n
+ * Files are dealt largest first over the queues of the workers, a
+ * worker takes the next file from the head of its own queue and, when
+ * that queue runs empty, steals files from the tail of the queues of
+ * the other workers.\n
+ * The results keep the order in which the files were added.
+ */
+typedef struct
+dxf_batch_struct
+{
+        DxfBatchOperation operation;
+                /*!< Operation performed on every file. */
+        int acad_version_number;
+                /*!< AutoCAD version number of written files
+                 * (\c DXF_BATCH_CONVERT only). */
+        char *output_directory;
+                /*!< Directory for written files, \c NULL to write
+                 * next to the input file. */
+        int number_of_threads;
+                /*!< Number of worker threads, 0 for the number of
+                 * online processors. */
+        DxfBatchResult *results;
+                /*!< Array of results, one for every added file. */
+        int number_of_results;
+                /*!< Number of files added to the batch. */
+        int results_size;
+                /*!< Number of allocated entries in \c results. */
+} DxfBatch;
+
+
+DxfBatch *
+dxf_batch_new ();
+DxfBatch *
+dxf_batch_init
+(
+        DxfBatch *batch,
+        DxfBatchOperation operation
+);
+int
+dxf_batch_free
+(
+        DxfBatch *batch
+);
+int
+dxf_batch_add_file
+(
+        DxfBatch *batch,
+        const char *filename
+);
+int
+dxf_batch_run
+(
+        DxfBatch *batch
+);
+int
+dxf_batch_get_number_of_failures
+(
+        DxfBatch *batch
+);
+int
+dxf_batch_write_results
+(
+        FILE *fp,
+        DxfBatch *batch
+);
+const char *
+dxf_batch_operation_to_string
+(
+        DxfBatchOperation operation
+);
+int
+dxf_batch_operation_from_string
+(
+        const char *name
+);
+
+
+#endif /* LIBDXF_SRC_BATCH_H */
+
+
+/* EOF */
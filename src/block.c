@@ -33,6 +33,7 @@
 
 
 #include "block.h"
+#include "pool.h"
 
 
 /*!
@@ -179,7 +180,7 @@ dxf_block_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (block == NULL)
@@ -190,8 +191,10 @@ dxf_block_read
                 block = dxf_block_new ();
                 block = dxf_block_init (block);
         }
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        temp_string = dxf_pool_string_alloc ();
+        (fp->line_number)++;
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -200,29 +203,29 @@ dxf_block_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing a external
                          * reference name. */
-                        fscanf (fp->fp, "%s\n", block->xref_name);
+                        block->xref_name = dxf_read_string (fp, block->xref_name);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a block name. */
-                        fscanf (fp->fp, "%s\n", block->block_name);
+                        block->block_name = dxf_read_string (fp, block->block_name);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a block name. */
-                        fscanf (fp->fp, "%s\n", block->block_name_additional);
+                        block->block_name_additional = dxf_read_string (fp, block->block_name_additional);
                 }
                 else if (strcmp (temp_string, "4") == 0)
                 {
                         /* Now follows a string containing a description. */
-                        fscanf (fp->fp, "%s\n", block->description);
+                        block->description = dxf_read_string (fp, block->description);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -233,7 +236,7 @@ dxf_block_read
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        fscanf (fp->fp, "%s\n", block->layer);
+                        block->layer = dxf_read_string (fp, block->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -306,7 +309,7 @@ dxf_block_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner object. */
-                        fscanf (fp->fp, "%s\n", block->dictionary_owner_soft);
+                        block->dictionary_owner_soft = dxf_read_string (fp, block->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -319,7 +322,13 @@ dxf_block_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         /*!
@@ -344,7 +353,7 @@ dxf_block_read
                 block->block_type = 1;
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -378,6 +387,9 @@ dxf_block_write
 #endif
         char *dxf_entity_name = strdup ("BLOCK");
         DxfEndblk *endblk = NULL;
+        char *layer = NULL;
+        char *description = NULL;
+        char *dictionary_owner_soft = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -437,14 +449,16 @@ dxf_block_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (block->description == NULL)
+        description = block->description;
+        if (description == NULL)
         {
                 fprintf (stderr,
                   (_("Warning in %s () NULL pointer to description string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, block->id_code);
-                block->description = strdup ("");
+                description = "";
         }
-        if (strcmp (block->layer, "") == 0)
+        layer = block->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -452,14 +466,15 @@ dxf_block_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0.\n")),
                   dxf_entity_name);
-                block->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = DXF_DEFAULT_LAYER;
         }
-        if (block->dictionary_owner_soft == NULL)
+        dictionary_owner_soft = block->dictionary_owner_soft;
+        if (dictionary_owner_soft == NULL)
         {
                 fprintf (stderr,
                   (_("Warning in %s () NULL pointer to soft owner object string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, block->id_code);
-                block->dictionary_owner_soft = strdup ("");
+                dictionary_owner_soft = "";
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -478,16 +493,16 @@ dxf_block_write
          * 102 groups are application defined (optional).\n\n
          * End of group, "}" (optional), with Group code 102.
          */
-        if ((strcmp (block->dictionary_owner_soft, "") != 0)
+        if ((strcmp (dictionary_owner_soft, "") != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
-                fprintf (fp->fp, "330\n%s\n", block->dictionary_owner_soft);
+                fprintf (fp->fp, "330\n%s\n", dictionary_owner_soft);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        fprintf (fp->fp, "  8\n%s\n", block->layer);
+        fprintf (fp->fp, "  8\n%s\n", layer);
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbBlockBegin\n");
@@ -508,9 +523,9 @@ dxf_block_write
                 fprintf (fp->fp, "  1\n%s\n", block->xref_name);
         }
         if ((fp->acad_version_number >= AutoCAD_2000)
-        && (strcmp (block->description, "") != 0))
+        && (strcmp (description, "") != 0))
         {
-                fprintf (fp->fp, "  4\n%s\n", block->description);
+                fprintf (fp->fp, "  4\n%s\n", description);
         }
         endblk = (DxfEndblk *) block->endblk;
         dxf_endblk_write (fp, endblk);
@@ -35,6 +35,8 @@
 
 
 #include "body.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -184,7 +186,7 @@ dxf_body_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (body == NULL)
@@ -203,9 +205,10 @@ dxf_body_read
         }
         i = 0;
         j = 0;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -214,7 +217,7 @@ dxf_body_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 else if (strcmp (temp_string, "  1") == 0)
@@ -233,7 +236,7 @@ dxf_body_read
                         fscanf (fp->fp, "%s\n", body->additional_proprietary_data[j]);
                         j++;
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -245,13 +248,13 @@ dxf_body_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", body->linetype);
+                        body->linetype = dxf_read_string (fp, body->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", body->layer);
+                        body->layer = dxf_read_string (fp, body->layer);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                   && DXF_FLATLAND
@@ -309,14 +312,14 @@ dxf_body_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", body->dictionary_owner_soft);
+                        body->dictionary_owner_soft = dxf_read_string (fp, body->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", body->dictionary_owner_hard);
+                        body->dictionary_owner_hard = dxf_read_string (fp, body->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -330,7 +333,13 @@ dxf_body_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (body->linetype, "") == 0)
@@ -351,7 +360,7 @@ dxf_body_read
                 body->modeler_format_version_number = 1;
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -385,6 +394,8 @@ dxf_body_write
 #endif
         char *dxf_entity_name = strdup ("BODY");
         int i;
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -411,7 +422,8 @@ dxf_body_write
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, body->id_code);
         }
-        if (strcmp (body->linetype, "") == 0)
+        linetype = body->linetype;
+        if (strcmp (linetype, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -419,9 +431,10 @@ dxf_body_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                body->layer = strdup (DXF_DEFAULT_LAYER);
+                linetype = DXF_DEFAULT_LINETYPE;
         }
-        if (strcmp (body->layer, "") == 0)
+        layer = body->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -429,7 +442,7 @@ dxf_body_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                body->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -469,10 +482,10 @@ dxf_body_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", body->layer);
-        if (strcmp (body->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (strcmp (linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", body->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
@@ -0,0 +1,1257 @@
+/*!
+ * \file bounds.c
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Functions for the calculation of the extents of DXF entities and drawings.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "bounds.h"
+
+
+/*!
+ * \brief Add a point in an OCS to the bounds.
+ */
+static void
+dxf_bounds_add_ocs_point
+(
+        DxfBounds *bounds,
+                /*!< the bounds. */
+        DxfOcs *ocs,
+                /*!< the axes of the OCS. */
+        double x,
+                /*!< X value in the OCS. */
+        double y,
+                /*!< Y value in the OCS. */
+        double z
+                /*!< Z value in the OCS. */
+)
+{
+        DxfVec3 p;
+
+        p = dxf_ocs_to_wcs (ocs, x, y, z);
+        dxf_bounds_add_point (bounds, p.x, p.y, p.z);
+}
+
+
+/*!
+ * \brief Add an elliptical arc to the bounds.
+ *
+ * The arc is the set of points <tt>center + cos (t) * u + sin (t) * v</tt>
+ * for \c t from \c start to \c end (counter clockwise), which covers
+ * circular arcs (\c u and \c v perpendicular and of equal length) in
+ * any plane.\n
+ * Every coordinate is extreme where its derivative is zero, at
+ * <tt>t = atan2 (v_i, u_i)</tt> and half a turn further, so the bounds
+ * are exact.
+ */
+static void
+dxf_bounds_add_elliptical_arc
+(
+        DxfBounds *bounds,
+                /*!< the bounds. */
+        DxfVec3 center,
+                /*!< center point in WCS. */
+        DxfVec3 u,
+                /*!< vector to the point at \c t = 0. */
+        DxfVec3 v,
+                /*!< vector to the point at \c t = pi / 2. */
+        double start,
+                /*!< start parameter in radians. */
+        double end
+                /*!< end parameter in radians. */
+)
+{
+        const double u_i[3] = {u.x, u.y, u.z};
+        const double v_i[3] = {v.x, v.y, v.z};
+        double t[8];
+        int number_of_t = 0;
+        double t0;
+        int i;
+        int k;
+
+        while (end <= start)
+        {
+                end += 2.0 * M_PI;
+        }
+        if (end - start > 2.0 * M_PI)
+        {
+                end = start + 2.0 * M_PI;
+        }
+        t[number_of_t++] = start;
+        t[number_of_t++] = end;
+        for (i = 0; i < 3; i++)
+        {
+                if ((u_i[i] == 0.0) && (v_i[i] == 0.0))
+                {
+                        continue;
+                }
+                t0 = atan2 (v_i[i], u_i[i]);
+                for (k = 0; k < 2; k++, t0 += M_PI)
+                {
+                        /* Move the parameter into [start, start + 2 pi). */
+                        t0 = start + fmod (t0 - start, 2.0 * M_PI);
+                        if (t0 < start)
+                        {
+                                t0 += 2.0 * M_PI;
+                        }
+                        if (t0 <= end)
+                        {
+                                t[number_of_t++] = t0;
+                        }
+                }
+        }
+        for (k = 0; k < number_of_t; k++)
+        {
+                dxf_bounds_add_point (bounds,
+                  center.x + cos (t[k]) * u.x + sin (t[k]) * v.x,
+                  center.y + cos (t[k]) * u.y + sin (t[k]) * v.y,
+                  center.z + cos (t[k]) * u.z + sin (t[k]) * v.z);
+        }
+}
+
+
+/*!
+ * \brief Add a circular arc in an OCS to the bounds.
+ */
+static void
+dxf_bounds_add_ocs_arc
+(
+        DxfBounds *bounds,
+                /*!< the bounds. */
+        DxfOcs *ocs,
+                /*!< the axes of the OCS. */
+        double x,
+                /*!< X value of the center point in the OCS. */
+        double y,
+                /*!< Y value of the center point in the OCS. */
+        double z,
+                /*!< Z value of the center point in the OCS. */
+        double radius,
+                /*!< radius. */
+        double start,
+                /*!< start angle in radians. */
+        double end
+                /*!< end angle in radians. */
+)
+{
+        DxfVec3 u;
+        DxfVec3 v;
+
+        u.x = radius * ocs->ax.x;
+        u.y = radius * ocs->ax.y;
+        u.z = radius * ocs->ax.z;
+        v.x = radius * ocs->ay.x;
+        v.y = radius * ocs->ay.y;
+        v.z = radius * ocs->ay.z;
+        dxf_bounds_add_elliptical_arc (bounds,
+          dxf_ocs_to_wcs (ocs, x, y, z), u, v, start, end);
+}
+
+
+/*!
+ * \brief Add a polyline segment with a bulge in an OCS to the bounds.
+ *
+ * The start point is added, the end point is added by the next
+ * segment (or explicitly for the last vertex of an open polyline).
+ */
+static void
+dxf_bounds_add_bulge_segment
+(
+        DxfBounds *bounds,
+                /*!< the bounds. */
+        DxfOcs *ocs,
+                /*!< the axes of the OCS. */
+        double x1,
+                /*!< X value of the start point. */
+        double y1,
+                /*!< Y value of the start point. */
+        double x2,
+                /*!< X value of the end point. */
+        double y2,
+                /*!< Y value of the end point. */
+        double bulge,
+                /*!< bulge of the segment. */
+        double elevation
+                /*!< Z value of the segment in the OCS. */
+)
+{
+        DxfVec2 p1;
+        DxfVec2 p2;
+        DxfVec2 center;
+        double radius;
+        double start;
+        double end;
+
+        dxf_bounds_add_ocs_point (bounds, ocs, x1, y1, elevation);
+        p1.x = x1;
+        p1.y = y1;
+        p2.x = x2;
+        p2.y = y2;
+        if (!dxf_vec2_bulge_to_arc (p1, p2, bulge, &center, &radius, &start, &end))
+        {
+                return;
+        }
+        if (bulge > 0.0)
+        {
+                dxf_bounds_add_ocs_arc (bounds, ocs, center.x, center.y,
+                  elevation, radius, start, end);
+        }
+        else
+        {
+                /* Clockwise, the same arc counter clockwise from the
+                 * end point. */
+                dxf_bounds_add_ocs_arc (bounds, ocs, center.x, center.y,
+                  elevation, radius, end, start);
+        }
+}
+
+
+/*!
+ * \brief Add a hatch to the bounds.
+ */
+static void
+dxf_bounds_add_hatch
+(
+        DxfBounds *bounds,
+                /*!< the bounds. */
+        DxfHatch *hatch
+                /*!< the hatch. */
+)
+{
+        DxfOcs ocs;
+        DxfHatchBoundaryPath *path = NULL;
+        DxfHatchBoundaryPathEdge *edge = NULL;
+        DxfHatchBoundaryPathEdgeArc *arc = NULL;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse = NULL;
+        DxfHatchBoundaryPathEdgeLine *line = NULL;
+        DxfHatchBoundaryPathEdgeSpline *spline = NULL;
+        DxfHatchBoundaryPathEdgeSplineCp *cp = NULL;
+        DxfHatchBoundaryPathPolyline *polyline = NULL;
+        DxfHatchBoundaryPathPolylineVertex *vertex = NULL;
+        DxfHatchBoundaryPathPolylineVertex *next = NULL;
+        DxfVec3 u;
+        DxfVec3 v;
+        double start;
+        double end;
+        double z = hatch->z0;
+
+        dxf_ocs_init (&ocs, hatch->extr_x0, hatch->extr_y0, hatch->extr_z0);
+        for (path = (DxfHatchBoundaryPath *) hatch->paths; path != NULL; path = (DxfHatchBoundaryPath *) path->next)
+        {
+                for (edge = (DxfHatchBoundaryPathEdge *) path->edges; edge != NULL; edge = (DxfHatchBoundaryPathEdge *) edge->next)
+                {
+                        for (line = (DxfHatchBoundaryPathEdgeLine *) edge->lines; line != NULL; line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+                        {
+                                dxf_bounds_add_ocs_point (bounds, &ocs, line->x0, line->y0, z);
+                                dxf_bounds_add_ocs_point (bounds, &ocs, line->x1, line->y1, z);
+                        }
+                        for (arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs; arc != NULL; arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+                        {
+                                start = arc->start_angle * M_PI / 180.0;
+                                end = arc->end_angle * M_PI / 180.0;
+                                if (!arc->is_ccw)
+                                {
+                                        /* Clockwise edges have mirrored
+                                         * angles. */
+                                        start = -arc->end_angle * M_PI / 180.0;
+                                        end = -arc->start_angle * M_PI / 180.0;
+                                }
+                                dxf_bounds_add_ocs_arc (bounds, &ocs, arc->x0,
+                                  arc->y0, z, arc->radius, start, end);
+                        }
+                        for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses; ellipse != NULL; ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+                        {
+                                start = ellipse->start_angle * M_PI / 180.0;
+                                end = ellipse->end_angle * M_PI / 180.0;
+                                if (!ellipse->is_ccw)
+                                {
+                                        start = -ellipse->end_angle * M_PI / 180.0;
+                                        end = -ellipse->start_angle * M_PI / 180.0;
+                                }
+                                /* The major axis and the minor axis
+                                 * (rotated a quarter turn) in WCS. */
+                                u = dxf_ocs_to_wcs (&ocs, ellipse->x1, ellipse->y1, 0.0);
+                                v = dxf_ocs_to_wcs (&ocs,
+                                  -ellipse->ratio * ellipse->y1,
+                                  ellipse->ratio * ellipse->x1, 0.0);
+                                dxf_bounds_add_elliptical_arc (bounds,
+                                  dxf_ocs_to_wcs (&ocs, ellipse->x0, ellipse->y0, z),
+                                  u, v, start, end);
+                        }
+                        for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines; spline != NULL; spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+                        {
+                                /* A spline lies within the convex hull
+                                 * of its control points. */
+                                for (cp = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points; cp != NULL; cp = (DxfHatchBoundaryPathEdgeSplineCp *) cp->next)
+                                {
+                                        dxf_bounds_add_ocs_point (bounds, &ocs, cp->x0, cp->y0, z);
+                                }
+                        }
+                }
+                for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines; polyline != NULL; polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+                {
+                        for (vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices; vertex != NULL; vertex = next)
+                        {
+                                next = (DxfHatchBoundaryPathPolylineVertex *) vertex->next;
+                                if ((next == NULL) && polyline->is_closed)
+                                {
+                                        next = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                                }
+                                if (next == NULL)
+                                {
+                                        dxf_bounds_add_ocs_point (bounds, &ocs, vertex->x0, vertex->y0, z);
+                                        break;
+                                }
+                                dxf_bounds_add_bulge_segment (bounds, &ocs,
+                                  vertex->x0, vertex->y0, next->x0, next->y0,
+                                  vertex->has_bulge ? vertex->bulge : 0.0, z);
+                                if (next == (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices)
+                                {
+                                        break;
+                                }
+                        }
+                }
+        }
+}
+
+
+/*!
+ * \brief Add a light weight polyline to the bounds.
+ */
+static void
+dxf_bounds_add_lwpolyline
+(
+        DxfBounds *bounds,
+                /*!< the bounds. */
+        DxfLWPolyline *lwpolyline
+                /*!< the light weight polyline. */
+)
+{
+        DxfOcs ocs;
+        DxfLWPolylineVertex *vertices = lwpolyline->vertices;
+        int n = lwpolyline->number_vertices;
+        int closed = lwpolyline->flag & 1;
+        int i;
+
+        if ((vertices == NULL) || (n < 1))
+        {
+                return;
+        }
+        dxf_ocs_init (&ocs, lwpolyline->extr_x0, lwpolyline->extr_y0, lwpolyline->extr_z0);
+        for (i = 0; i < n; i++)
+        {
+                if ((i == n - 1) && !closed)
+                {
+                        dxf_bounds_add_ocs_point (bounds, &ocs,
+                          vertices[i].x0, vertices[i].y0, lwpolyline->elevation);
+                        break;
+                }
+                dxf_bounds_add_bulge_segment (bounds, &ocs,
+                  vertices[i].x0, vertices[i].y0,
+                  vertices[(i + 1) % n].x0, vertices[(i + 1) % n].y0,
+                  vertices[i].bulge, lwpolyline->elevation);
+        }
+}
+
+
+/*!
+ * \brief Add an estimate of the extents of a text to the bounds.
+ *
+ * Characters are estimated to be \c DXF_BOUNDS_TEXT_WIDTH_FACTOR times
+ * the text height wide, the oblique angle is ignored.
+ */
+static void
+dxf_bounds_add_text
+(
+        DxfBounds *bounds,
+                /*!< the bounds. */
+        DxfText *text
+                /*!< the text. */
+)
+{
+        DxfOcs ocs;
+        double width;
+        double height = text->height;
+        double x_scale = (text->rel_x_scale == 0.0) ? 1.0 : text->rel_x_scale;
+        double dx = 0.0;
+        double dy = 0.0;
+        double x = text->x0;
+        double y = text->y0;
+        double c = cos (text->rot_angle * M_PI / 180.0);
+        double s = sin (text->rot_angle * M_PI / 180.0);
+        double corner_x[4];
+        double corner_y[4];
+        int i;
+
+        width = (text->text_value == NULL) ? 0.0
+          : (double) strlen (text->text_value) * height * x_scale * DXF_BOUNDS_TEXT_WIDTH_FACTOR;
+        if ((text->hor_align != 0) || (text->vert_align != 0))
+        {
+                /* Justified text is positioned on the alignment
+                 * point. */
+                x = text->x1;
+                y = text->y1;
+                switch (text->hor_align)
+                {
+                        case 1: /* Center. */
+                        case 4: /* Middle. */
+                                dx = -0.5 * width;
+                                break;
+                        case 2: /* Right. */
+                                dx = -width;
+                                break;
+                        case 3: /* Aligned. */
+                        case 5: /* Fit. */
+                                /* The text runs from the first
+                                 * alignment point to the second. */
+                                x = text->x0;
+                                y = text->y0;
+                                width = hypot (text->x1 - text->x0, text->y1 - text->y0);
+                                break;
+                }
+                switch (text->vert_align)
+                {
+                        case 2: /* Middle. */
+                                dy = -0.5 * height;
+                                break;
+                        case 3: /* Top. */
+                                dy = -height;
+                                break;
+                }
+                if (text->hor_align == 4)
+                {
+                        dy = -0.5 * height;
+                }
+        }
+        corner_x[0] = dx;
+        corner_y[0] = dy;
+        corner_x[1] = dx + width;
+        corner_y[1] = dy;
+        corner_x[2] = dx + width;
+        corner_y[2] = dy + height;
+        corner_x[3] = dx;
+        corner_y[3] = dy + height;
+        dxf_ocs_init (&ocs, text->extr_x0, text->extr_y0, text->extr_z0);
+        for (i = 0; i < 4; i++)
+        {
+                dxf_bounds_add_ocs_point (bounds, &ocs,
+                  x + c * corner_x[i] - s * corner_y[i],
+                  y + s * corner_x[i] + c * corner_y[i],
+                  text->z0);
+        }
+}
+
+
+/*!
+ * \brief Add an insert to the bounds by transforming the cached bounds
+ * of its block.
+ *
+ * The corners of the block bounds are transformed for the first and
+ * last row and column, which bounds the whole array of block
+ * references.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * bounds of the block are not cached.
+ */
+static int
+dxf_bounds_add_insert
+(
+        DxfBounds *bounds,
+                /*!< the bounds. */
+        DxfInsert *insert,
+                /*!< the insert. */
+        DxfBoundsCache *cache
+                /*!< the cache with the bounds of the block. */
+)
+{
+        DxfBoundsCacheEntry *entry = NULL;
+        DxfOcs ocs;
+        double c = cos (insert->rot_angle * M_PI / 180.0);
+        double s = sin (insert->rot_angle * M_PI / 180.0);
+        double x_scale = (insert->rel_x_scale == 0.0) ? 1.0 : insert->rel_x_scale;
+        double y_scale = (insert->rel_y_scale == 0.0) ? 1.0 : insert->rel_y_scale;
+        double z_scale = (insert->rel_z_scale == 0.0) ? 1.0 : insert->rel_z_scale;
+        int columns = (insert->columns > 1) ? insert->columns : 1;
+        int rows = (insert->rows > 1) ? insert->rows : 1;
+        double x;
+        double y;
+        double z;
+        int corner;
+        int grid;
+
+        entry = dxf_bounds_cache_get_block (cache, insert->block_name);
+        if ((entry == NULL) || dxf_bounds_is_empty (&entry->bounds))
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_ocs_init (&ocs, insert->extr_x0, insert->extr_y0, insert->extr_z0);
+        for (grid = 0; grid < 4; grid++)
+        {
+                for (corner = 0; corner < 8; corner++)
+                {
+                        x = ((corner & 1) ? entry->bounds.max.x : entry->bounds.min.x) - entry->base_point.x;
+                        y = ((corner & 2) ? entry->bounds.max.y : entry->bounds.min.y) - entry->base_point.y;
+                        z = ((corner & 4) ? entry->bounds.max.z : entry->bounds.min.z) - entry->base_point.z;
+                        x = x * x_scale + ((grid & 1) ? (columns - 1) * insert->column_spacing : 0.0);
+                        y = y * y_scale + ((grid & 2) ? (rows - 1) * insert->row_spacing : 0.0);
+                        z = z * z_scale;
+                        dxf_bounds_add_ocs_point (bounds, &ocs,
+                          insert->x0 + c * x - s * y,
+                          insert->y0 + s * x + c * y,
+                          insert->z0 + z);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Initialize empty bounds.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_bounds_init
+(
+        DxfBounds *bounds
+                /*!< a pointer to the bounds. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (bounds == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        bounds->min.x = HUGE_VAL;
+        bounds->min.y = HUGE_VAL;
+        bounds->min.z = HUGE_VAL;
+        bounds->max.x = -HUGE_VAL;
+        bounds->max.y = -HUGE_VAL;
+        bounds->max.z = -HUGE_VAL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test if bounds are empty.
+ *
+ * \return \c TRUE when the bounds are empty (or \c NULL), \c FALSE
+ * otherwise.
+ */
+int
+dxf_bounds_is_empty
+(
+        DxfBounds *bounds
+                /*!< a pointer to the bounds. */
+)
+{
+        if (bounds == NULL)
+        {
+                return (TRUE);
+        }
+        return ((bounds->min.x > bounds->max.x)
+          || (bounds->min.y > bounds->max.y)
+          || (bounds->min.z > bounds->max.z));
+}
+
+
+/*!
+ * \brief Extend bounds with a point.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_bounds_add_point
+(
+        DxfBounds *bounds,
+                /*!< a pointer to the bounds. */
+        double x,
+                /*!< X value of the point. */
+        double y,
+                /*!< Y value of the point. */
+        double z
+                /*!< Z value of the point. */
+)
+{
+        if (bounds == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        bounds->min.x = (x < bounds->min.x) ? x : bounds->min.x;
+        bounds->min.y = (y < bounds->min.y) ? y : bounds->min.y;
+        bounds->min.z = (z < bounds->min.z) ? z : bounds->min.z;
+        bounds->max.x = (x > bounds->max.x) ? x : bounds->max.x;
+        bounds->max.y = (y > bounds->max.y) ? y : bounds->max.y;
+        bounds->max.z = (z > bounds->max.z) ? z : bounds->max.z;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend bounds with other bounds.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_bounds_add_bounds
+(
+        DxfBounds *bounds,
+                /*!< a pointer to the bounds. */
+        DxfBounds *other
+                /*!< a pointer to the bounds to add. */
+)
+{
+        if ((bounds == NULL) || (other == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_bounds_is_empty (other))
+        {
+                return (EXIT_SUCCESS);
+        }
+        dxf_bounds_add_point (bounds, other->min.x, other->min.y, other->min.z);
+        dxf_bounds_add_point (bounds, other->max.x, other->max.y, other->max.z);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend bounds with an array of 3D points.
+ *
+ * The batch kernel for point arrays (spline control and fit points):
+ * the minimum and maximum are kept in locals in a loop without
+ * branches, which compilers vectorize into packed min / max
+ * instructions.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_bounds_add_vec3_array
+(
+        DxfBounds *bounds,
+                /*!< a pointer to the bounds. */
+        const DxfVec3 *points,
+                /*!< array of points. */
+        int number_of_points
+                /*!< number of points in the array. */
+)
+{
+        double min_x;
+        double min_y;
+        double min_z;
+        double max_x;
+        double max_y;
+        double max_z;
+        int i;
+
+        if ((bounds == NULL) || ((points == NULL) && (number_of_points > 0)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        min_x = bounds->min.x;
+        min_y = bounds->min.y;
+        min_z = bounds->min.z;
+        max_x = bounds->max.x;
+        max_y = bounds->max.y;
+        max_z = bounds->max.z;
+        for (i = 0; i < number_of_points; i++)
+        {
+                min_x = (points[i].x < min_x) ? points[i].x : min_x;
+                min_y = (points[i].y < min_y) ? points[i].y : min_y;
+                min_z = (points[i].z < min_z) ? points[i].z : min_z;
+                max_x = (points[i].x > max_x) ? points[i].x : max_x;
+                max_y = (points[i].y > max_y) ? points[i].y : max_y;
+                max_z = (points[i].z > max_z) ? points[i].z : max_z;
+        }
+        bounds->min.x = min_x;
+        bounds->min.y = min_y;
+        bounds->min.z = min_z;
+        bounds->max.x = max_x;
+        bounds->max.y = max_y;
+        bounds->max.z = max_z;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend bounds with an array of 2D points at a Z value.
+ *
+ * The 2D counterpart of \c dxf_bounds_add_vec3_array().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_bounds_add_vec2_array
+(
+        DxfBounds *bounds,
+                /*!< a pointer to the bounds. */
+        const DxfVec2 *points,
+                /*!< array of points. */
+        int number_of_points,
+                /*!< number of points in the array. */
+        double z
+                /*!< Z value of the points. */
+)
+{
+        double min_x;
+        double min_y;
+        double max_x;
+        double max_y;
+        int i;
+
+        if ((bounds == NULL) || ((points == NULL) && (number_of_points > 0)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (number_of_points < 1)
+        {
+                return (EXIT_SUCCESS);
+        }
+        min_x = bounds->min.x;
+        min_y = bounds->min.y;
+        max_x = bounds->max.x;
+        max_y = bounds->max.y;
+        for (i = 0; i < number_of_points; i++)
+        {
+                min_x = (points[i].x < min_x) ? points[i].x : min_x;
+                min_y = (points[i].y < min_y) ? points[i].y : min_y;
+                max_x = (points[i].x > max_x) ? points[i].x : max_x;
+                max_y = (points[i].y > max_y) ? points[i].y : max_y;
+        }
+        bounds->min.x = min_x;
+        bounds->min.y = min_y;
+        bounds->max.x = max_x;
+        bounds->max.y = max_y;
+        bounds->min.z = (z < bounds->min.z) ? z : bounds->min.z;
+        bounds->max.z = (z > bounds->max.z) ? z : bounds->max.z;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Extend bounds with the extents of an entity.
+ *
+ * Supported are \c LINE, \c POINT, \c ARC, \c CIRCLE and \c ELLIPSE
+ * (exact, in any plane), \c LWPOLYLINE (exact, including bulges),
+ * \c SPLINE (the control hull, or the fit points when there are no
+ * control points), \c HATCH (the boundary paths), \c 3DFACE,
+ * \c INSERT (the transformed bounds of the block, see
+ * \c DxfBoundsCache) and \c TEXT (estimated).\n
+ * The thickness of entities is not taken into account.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the type is
+ * not supported, the extents of the entity are unknown or an error
+ * occurred.
+ */
+int
+dxf_bounds_add_entity
+(
+        DxfBounds *bounds,
+                /*!< a pointer to the bounds. */
+        int type,
+                /*!< type of the entity, a \c DxfEntityType value. */
+        void *entity,
+                /*!< a pointer to the entity. */
+        DxfBoundsCache *cache
+                /*!< a cache with the bounds of blocks for \c INSERT
+                 * entities, may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfOcs ocs;
+        DxfLine *line = NULL;
+        DxfPoint *point = NULL;
+        DxfArc *arc = NULL;
+        DxfCircle *circle = NULL;
+        DxfEllipse *ellipse = NULL;
+        DxfSpline *spline = NULL;
+        Dxf3dface *face = NULL;
+        DxfVec3 u;
+        DxfVec3 v;
+        DxfVec3 center;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if ((bounds == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        switch (type)
+        {
+                case LINE:
+                        line = (DxfLine *) entity;
+                        dxf_bounds_add_point (bounds, line->x0, line->y0, line->z0);
+                        dxf_bounds_add_point (bounds, line->x1, line->y1, line->z1);
+                        break;
+                case POINT:
+                        point = (DxfPoint *) entity;
+                        dxf_bounds_add_point (bounds, point->x0, point->y0, point->z0);
+                        break;
+                case ARC:
+                        arc = (DxfArc *) entity;
+                        dxf_ocs_init (&ocs, arc->extr_x0, arc->extr_y0, arc->extr_z0);
+                        dxf_bounds_add_ocs_arc (bounds, &ocs, arc->x0, arc->y0,
+                          arc->z0, arc->radius, arc->start_angle * M_PI / 180.0,
+                          arc->end_angle * M_PI / 180.0);
+                        break;
+                case CIRCLE:
+                        circle = (DxfCircle *) entity;
+                        dxf_ocs_init (&ocs, circle->extr_x0, circle->extr_y0, circle->extr_z0);
+                        dxf_bounds_add_ocs_arc (bounds, &ocs, circle->x0,
+                          circle->y0, circle->z0, circle->radius, 0.0,
+                          2.0 * M_PI);
+                        break;
+                case ELLIPSE:
+                        ellipse = (DxfEllipse *) entity;
+                        /* The center point and the major axis are in
+                         * WCS, the minor axis is the major axis turned a
+                         * quarter around the extrusion direction. */
+                        dxf_ocs_init (&ocs, ellipse->extr_x0, ellipse->extr_y0, ellipse->extr_z0);
+                        center.x = ellipse->x0;
+                        center.y = ellipse->y0;
+                        center.z = ellipse->z0;
+                        u.x = ellipse->x1;
+                        u.y = ellipse->y1;
+                        u.z = ellipse->z1;
+                        v.x = ellipse->ratio * (ocs.az.y * u.z - ocs.az.z * u.y);
+                        v.y = ellipse->ratio * (ocs.az.z * u.x - ocs.az.x * u.z);
+                        v.z = ellipse->ratio * (ocs.az.x * u.y - ocs.az.y * u.x);
+                        if ((ellipse->start_angle == ellipse->end_angle)
+                          || (fabs (ellipse->end_angle - ellipse->start_angle) >= 2.0 * M_PI))
+                        {
+                                dxf_bounds_add_elliptical_arc (bounds, center, u, v, 0.0, 2.0 * M_PI);
+                        }
+                        else
+                        {
+                                dxf_bounds_add_elliptical_arc (bounds, center, u, v,
+                                  ellipse->start_angle, ellipse->end_angle);
+                        }
+                        break;
+                case SPLINE:
+                        spline = (DxfSpline *) entity;
+                        if ((spline->p0 != NULL) && (spline->number_of_control_points > 0))
+                        {
+                                dxf_bounds_add_vec3_array (bounds, spline->p0, spline->number_of_control_points);
+                        }
+                        else if ((spline->p1 != NULL) && (spline->number_of_fit_points > 0))
+                        {
+                                dxf_bounds_add_vec3_array (bounds, spline->p1, spline->number_of_fit_points);
+                        }
+                        else
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                        break;
+                case LWPOLYLINE:
+                        dxf_bounds_add_lwpolyline (bounds, (DxfLWPolyline *) entity);
+                        break;
+                case HATCH:
+                        dxf_bounds_add_hatch (bounds, (DxfHatch *) entity);
+                        break;
+                case DFACE:
+                        face = (Dxf3dface *) entity;
+                        if ((face->p0 == NULL) || (face->p1 == NULL)
+                          || (face->p2 == NULL) || (face->p3 == NULL))
+                        {
+                                result = EXIT_FAILURE;
+                                break;
+                        }
+                        dxf_bounds_add_point (bounds, face->p0->x0, face->p0->y0, face->p0->z0);
+                        dxf_bounds_add_point (bounds, face->p1->x0, face->p1->y0, face->p1->z0);
+                        dxf_bounds_add_point (bounds, face->p2->x0, face->p2->y0, face->p2->z0);
+                        dxf_bounds_add_point (bounds, face->p3->x0, face->p3->y0, face->p3->z0);
+                        break;
+                case INSERT:
+                        result = dxf_bounds_add_insert (bounds, (DxfInsert *) entity, cache);
+                        break;
+                case TEXT:
+                        dxf_bounds_add_text (bounds, (DxfText *) entity);
+                        break;
+                default:
+                        result = EXIT_FAILURE;
+                        break;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Get the extents of all entities of a drawing.
+ *
+ * Entities without known extents (see \c dxf_bounds_add_entity()) are
+ * skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_get_bounds
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        DxfBoundsCache *cache,
+                /*!< a cache with the bounds of blocks for \c INSERT
+                 * entities, may be \c NULL. */
+        DxfBounds *bounds
+                /*!< the bounds (output). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfChunkListIter iter;
+        DxfDrawingEntity *entry = NULL;
+
+        /* Do some basic checks. */
+        if ((drawing == NULL) || (bounds == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_bounds_init (bounds);
+        if (drawing->entities == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        dxf_chunk_list_iter_init ((DxfChunkList *) drawing->entities, &iter);
+        while ((entry = (DxfDrawingEntity *) dxf_chunk_list_iter_next (&iter)) != NULL)
+        {
+                dxf_bounds_add_entity (bounds, entry->type, entry->entity, cache);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set the \c $EXTMIN and \c $EXTMAX values of a header.
+ *
+ * Empty bounds leave the header untouched.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_bounds_set_header_extents
+(
+        DxfHeader *header,
+                /*!< a pointer to a DXF header. */
+        DxfBounds *bounds
+                /*!< a pointer to the bounds. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((header == NULL) || (bounds == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_bounds_is_empty (bounds))
+        {
+                return (EXIT_SUCCESS);
+        }
+        header->ExtMin.x0 = bounds->min.x;
+        header->ExtMin.y0 = bounds->min.y;
+        header->ExtMin.z0 = bounds->min.z;
+        header->ExtMax.x0 = bounds->max.x;
+        header->ExtMax.y0 = bounds->max.y;
+        header->ExtMax.z0 = bounds->max.z;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a cache of block bounds.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfBoundsCache *
+dxf_bounds_cache_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBoundsCache *cache = NULL;
+        size_t size;
+
+        size = sizeof (DxfBoundsCache);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((cache = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfBoundsCache struct.\n")),
+                  __FUNCTION__);
+                cache = NULL;
+        }
+        else
+        {
+                memset (cache, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (cache);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a cache of
+ * block bounds.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfBoundsCache *
+dxf_bounds_cache_init
+(
+        DxfBoundsCache *cache
+                /*!< a pointer to a cache of block bounds. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (cache == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                cache = dxf_bounds_cache_new ();
+        }
+        if (cache == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfBoundsCache struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        cache->intern = (struct DxfIntern *) dxf_intern_init (dxf_intern_new ());
+        if (cache->intern == NULL)
+        {
+                free (cache);
+                return (NULL);
+        }
+        cache->entries = NULL;
+        cache->entries_size = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (cache);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a cache of block bounds.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_bounds_cache_free
+(
+        DxfBoundsCache *cache
+                /*!< a pointer to the memory occupied by the cache. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (cache == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (cache->intern != NULL)
+        {
+                dxf_intern_free ((DxfIntern *) cache->intern);
+        }
+        free (cache->entries);
+        free (cache);
+        cache = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Store the bounds of the contents of a block in a cache.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_bounds_cache_set_block
+(
+        DxfBoundsCache *cache,
+                /*!< a pointer to a cache of block bounds. */
+        DxfBlock *block,
+                /*!< the block (for its name and base point). */
+        DxfBounds *bounds
+                /*!< bounds of the entities of the block in the block
+                 * coordinate system. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBoundsCacheEntry *entries = NULL;
+        int id;
+        int size;
+
+        /* Do some basic checks. */
+        if ((cache == NULL) || (block == NULL) || (bounds == NULL)
+          || (block->block_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_intern_string ((DxfIntern *) cache->intern, block->block_name) == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        id = dxf_intern_get_id ((DxfIntern *) cache->intern, block->block_name);
+        if (id >= cache->entries_size)
+        {
+                size = (cache->entries_size == 0) ? 16 : cache->entries_size;
+                while (size <= id)
+                {
+                        size *= 2;
+                }
+                entries = realloc (cache->entries, size * sizeof (DxfBoundsCacheEntry));
+                if (entries == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for cache entries.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                memset (entries + cache->entries_size, 0,
+                  (size - cache->entries_size) * sizeof (DxfBoundsCacheEntry));
+                cache->entries = entries;
+                cache->entries_size = size;
+        }
+        cache->entries[id].valid = TRUE;
+        cache->entries[id].base_point.x = block->x0;
+        cache->entries[id].base_point.y = block->y0;
+        cache->entries[id].base_point.z = block->z0;
+        cache->entries[id].bounds = *bounds;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the cached bounds of a block.
+ *
+ * \return a pointer to the cache entry, or \c NULL when the bounds of
+ * the block are not cached.
+ */
+DxfBoundsCacheEntry *
+dxf_bounds_cache_get_block
+(
+        DxfBoundsCache *cache,
+                /*!< a pointer to a cache of block bounds. */
+        const char *block_name
+                /*!< name of the block. */
+)
+{
+        int id;
+
+        if ((cache == NULL) || (block_name == NULL))
+        {
+                return (NULL);
+        }
+        id = dxf_intern_get_id ((DxfIntern *) cache->intern, block_name);
+        if ((id < 0) || (id >= cache->entries_size) || !cache->entries[id].valid)
+        {
+                return (NULL);
+        }
+        return (&cache->entries[id]);
+}
+
+
+/* EOF */
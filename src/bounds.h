@@ -0,0 +1,211 @@
+/*!
+ * \file bounds.h
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Header file for the calculation of the extents of DXF entities and drawings.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_BOUNDS_H
+#define LIBDXF_SRC_BOUNDS_H
+
+
+#include "global.h"
+#include "vec.h"
+#include "intern.h"
+#include "drawing.h"
+#include "entity.h"
+#include "3dface.h"
+#include "arc.h"
+#include "block.h"
+#include "circle.h"
+#include "ellipse.h"
+#include "hatch.h"
+#include "insert.h"
+#include "line.h"
+#include "lwpolyline.h"
+#include "point.h"
+#include "spline.h"
+#include "text.h"
+
+
+#define DXF_BOUNDS_TEXT_WIDTH_FACTOR 1.0
+        /*!< \brief The estimated width of a character of a \c TEXT
+         * entity relative to the text height (before the relative X
+         * scale factor of the entity is applied). */
+
+
+/*!
+ * \brief Definition of an axis aligned bounding box in WCS.
+ *
+ * An empty box has \c min larger than \c max, as set by
+ * \c dxf_bounds_init().
+ */
+typedef struct
+dxf_bounds_struct
+{
+        DxfVec3 min;
+                /*!< Minimum X, Y and Z values. */
+        DxfVec3 max;
+                /*!< Maximum X, Y and Z values. */
+} DxfBounds;
+
+
+/*!
+ * \brief Definition of an entry in a \c DxfBoundsCache.
+ */
+typedef struct
+dxf_bounds_cache_entry_struct
+{
+        int valid;
+                /*!< \c TRUE when \c bounds are set. */
+        DxfVec3 base_point;
+                /*!< Base point of the block. */
+        DxfBounds bounds;
+                /*!< Bounds of the block contents in the block
+                 * coordinate system. */
+} DxfBoundsCacheEntry;
+
+
+/*!
+ * \brief Definition of a cache of block bounds.
+ *
+ * Blocks do not hold their entities in libDXF, so the bounds of the
+ * contents of a block are computed once by the application (with
+ * \c dxf_bounds_add_entity() for every entity of the block) and stored
+ * here with \c dxf_bounds_cache_set_block().\n
+ * \c INSERT entities are bounded by transforming the cached bounds of
+ * their block.\n
+ * Block names are kept in a private intern table, the id of an interned
+ * name indexes the \c entries.
+ */
+typedef struct
+dxf_bounds_cache_struct
+{
+        struct DxfIntern *intern;
+                /*!< Intern table for the block names. */
+        DxfBoundsCacheEntry *entries;
+                /*!< Array of entries, indexed by the id of the block
+                 * name in \c intern. */
+        int entries_size;
+                /*!< Number of allocated entries. */
+} DxfBoundsCache;
+
+
+int
+dxf_bounds_init
+(
+        DxfBounds *bounds
+);
+int
+dxf_bounds_is_empty
+(
+        DxfBounds *bounds
+);
+int
+dxf_bounds_add_point
+(
+        DxfBounds *bounds,
+        double x,
+        double y,
+        double z
+);
+int
+dxf_bounds_add_bounds
+(
+        DxfBounds *bounds,
+        DxfBounds *other
+);
+int
+dxf_bounds_add_vec3_array
+(
+        DxfBounds *bounds,
+        const DxfVec3 *points,
+        int number_of_points
+);
+int
+dxf_bounds_add_vec2_array
+(
+        DxfBounds *bounds,
+        const DxfVec2 *points,
+        int number_of_points,
+        double z
+);
+int
+dxf_bounds_add_entity
+(
+        DxfBounds *bounds,
+        int type,
+        void *entity,
+        DxfBoundsCache *cache
+);
+int
+dxf_drawing_get_bounds
+(
+        DxfDrawing *drawing,
+        DxfBoundsCache *cache,
+        DxfBounds *bounds
+);
+int
+dxf_bounds_set_header_extents
+(
+        DxfHeader *header,
+        DxfBounds *bounds
+);
+DxfBoundsCache *
+dxf_bounds_cache_new ();
+DxfBoundsCache *
+dxf_bounds_cache_init
+(
+        DxfBoundsCache *cache
+);
+int
+dxf_bounds_cache_free
+(
+        DxfBoundsCache *cache
+);
+int
+dxf_bounds_cache_set_block
+(
+        DxfBoundsCache *cache,
+        DxfBlock *block,
+        DxfBounds *bounds
+);
+DxfBoundsCacheEntry *
+dxf_bounds_cache_get_block
+(
+        DxfBoundsCache *cache,
+        const char *block_name
+);
+
+
+#endif /* LIBDXF_SRC_BOUNDS_H */
+
+
+/* EOF */
@@ -0,0 +1,473 @@
+/*!
+ * \file chunk_list.c
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Functions for libDXF chunked containers.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "chunk_list.h"
+
+
+/*!
+ * \brief Allocate memory for a libDXF chunked container.
+ *
+ * Fill the memory contents with zeros.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfChunkList *
+dxf_chunk_list_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfChunkList *list = NULL;
+        size_t size;
+
+        size = sizeof (DxfChunkList);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((list = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfChunkList struct.\n")),
+                  __FUNCTION__);
+                list = NULL;
+        }
+        else
+        {
+                memset (list, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (list);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a libDXF
+ * chunked container.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfChunkList *
+dxf_chunk_list_init
+(
+        DxfChunkList *list,
+                /*!< a pointer to a libDXF chunked container. */
+        int element_size,
+                /*!< size of an entry in bytes. */
+        int block_size
+                /*!< number of entries per block, or 0 for
+                 * \c DXF_CHUNK_LIST_BLOCK_SIZE. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (element_size <= 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid element size was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (list == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                list = dxf_chunk_list_new ();
+        }
+        if (list == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfChunkList struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        list->element_size = element_size;
+        list->block_size = (block_size > 0) ? block_size : DXF_CHUNK_LIST_BLOCK_SIZE;
+        list->number_of_entries = 0;
+        list->first = NULL;
+        list->last = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (list);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a libDXF chunked container and
+ * all it's blocks.
+ *
+ * Objects pointed to by the entries are not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_chunk_list_free
+(
+        DxfChunkList *list
+                /*!< a pointer to the memory occupied by the libDXF
+                 * chunked container. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfChunkListBlock *block = NULL;
+        DxfChunkListBlock *next = NULL;
+
+        /* Do some basic checks. */
+        if (list == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (block = (DxfChunkListBlock *) list->first; block != NULL; block = next)
+        {
+                next = (DxfChunkListBlock *) block->next;
+                free (block);
+        }
+        free (list);
+        list = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append an entry to a libDXF chunked container.
+ *
+ * The entry is copied from \c element, or filled with zeros when
+ * \c element is \c NULL.
+ *
+ * \return a pointer to the entry in the container, or \c NULL when an
+ * error occurred.
+ */
+void *
+dxf_chunk_list_append
+(
+        DxfChunkList *list,
+                /*!< a pointer to a libDXF chunked container. */
+        const void *element
+                /*!< a pointer to the element to copy, or \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfChunkListBlock *block = NULL;
+        void *entry = NULL;
+
+        /* Do some basic checks. */
+        if (list == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        block = (DxfChunkListBlock *) list->last;
+        if ((block == NULL) || (block->number_of_entries == list->block_size))
+        {
+                block = malloc (sizeof (DxfChunkListBlock)
+                  + (size_t) list->block_size * (size_t) list->element_size);
+                if (block == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for a DxfChunkListBlock struct.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                block->entries = (char *) (block + 1);
+                block->number_of_entries = 0;
+                block->next = NULL;
+                if (list->last == NULL)
+                {
+                        list->first = (struct DxfChunkListBlock *) block;
+                }
+                else
+                {
+                        ((DxfChunkListBlock *) list->last)->next = (struct DxfChunkListBlock *) block;
+                }
+                list->last = (struct DxfChunkListBlock *) block;
+        }
+        entry = block->entries + (size_t) block->number_of_entries * (size_t) list->element_size;
+        if (element != NULL)
+        {
+                memcpy (entry, element, (size_t) list->element_size);
+        }
+        else
+        {
+                memset (entry, 0, (size_t) list->element_size);
+        }
+        block->number_of_entries++;
+        list->number_of_entries++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (entry);
+}
+
+
+/*!
+ * \brief Get the number of entries in a libDXF chunked container.
+ *
+ * \return the number of entries, or -1 when an error occurred.
+ */
+int
+dxf_chunk_list_get_number_of_entries
+(
+        DxfChunkList *list
+                /*!< a pointer to a libDXF chunked container. */
+)
+{
+        /* Do some basic checks. */
+        if (list == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        return (list->number_of_entries);
+}
+
+
+/*!
+ * \brief Get an entry from a libDXF chunked container.
+ *
+ * Walks the blocks, one step per \c block_size entries.
+ *
+ * \return a pointer to the entry, or \c NULL when an error occurred.
+ */
+void *
+dxf_chunk_list_get
+(
+        DxfChunkList *list,
+                /*!< a pointer to a libDXF chunked container. */
+        int index
+                /*!< index of the entry [0 .. number_of_entries - 1]. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfChunkListBlock *block = NULL;
+
+        /* Do some basic checks. */
+        if (list == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((index < 0) || (index >= list->number_of_entries))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () received an invalid value in index.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        block = (DxfChunkListBlock *) list->first;
+        while (index >= block->number_of_entries)
+        {
+                index -= block->number_of_entries;
+                block = (DxfChunkListBlock *) block->next;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (block->entries + (size_t) index * (size_t) list->element_size);
+}
+
+
+/*!
+ * \brief Get the last entry from a libDXF chunked container.
+ *
+ * \return a pointer to the last entry, or \c NULL when the container
+ * is empty or an error occurred.
+ */
+void *
+dxf_chunk_list_get_last
+(
+        DxfChunkList *list
+                /*!< a pointer to a libDXF chunked container. */
+)
+{
+        DxfChunkListBlock *block = NULL;
+
+        /* Do some basic checks. */
+        if (list == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        block = (DxfChunkListBlock *) list->last;
+        if ((block == NULL) || (block->number_of_entries == 0))
+        {
+                return (NULL);
+        }
+        return (block->entries + (size_t) (block->number_of_entries - 1) * (size_t) list->element_size);
+}
+
+
+/*!
+ * \brief Initialize an iterator at the first entry of a libDXF chunked
+ * container.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_chunk_list_iter_init
+(
+        DxfChunkList *list,
+                /*!< a pointer to a libDXF chunked container. */
+        DxfChunkListIter *iter
+                /*!< a pointer to the iterator to initialize. */
+)
+{
+        /* Do some basic checks. */
+        if ((list == NULL) || (iter == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        iter->list = list;
+        iter->block = list->first;
+        iter->index = 0;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the next entry from an iterator over a libDXF chunked
+ * container.
+ *
+ * \return a pointer to the entry, or \c NULL after the last entry.
+ */
+void *
+dxf_chunk_list_iter_next
+(
+        DxfChunkListIter *iter
+                /*!< a pointer to an initialized iterator. */
+)
+{
+        DxfChunkListBlock *block = NULL;
+
+        if (iter == NULL)
+        {
+                return (NULL);
+        }
+        block = (DxfChunkListBlock *) iter->block;
+        while ((block != NULL) && (iter->index >= block->number_of_entries))
+        {
+                block = (DxfChunkListBlock *) block->next;
+                iter->block = (struct DxfChunkListBlock *) block;
+                iter->index = 0;
+        }
+        if (block == NULL)
+        {
+                return (NULL);
+        }
+        return (block->entries + (size_t) (iter->index++) * (size_t) iter->list->element_size);
+}
+
+
+/*!
+ * \brief Copy a libDXF chunked container.
+ *
+ * The entries are copied by value, in order.
+ *
+ * \return a pointer to the copy, or \c NULL when an error occurred.
+ */
+DxfChunkList *
+dxf_chunk_list_copy
+(
+        DxfChunkList *list
+                /*!< a pointer to a libDXF chunked container. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfChunkList *copy = NULL;
+        DxfChunkListIter iter;
+        void *entry = NULL;
+
+        /* Do some basic checks. */
+        if (list == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_chunk_list_init (dxf_chunk_list_new (),
+          list->element_size, list->block_size);
+        if (copy == NULL)
+        {
+                return (NULL);
+        }
+        dxf_chunk_list_iter_init (list, &iter);
+        while ((entry = dxf_chunk_list_iter_next (&iter)) != NULL)
+        {
+                if (dxf_chunk_list_append (copy, entry) == NULL)
+                {
+                        dxf_chunk_list_free (copy);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
+/* EOF */
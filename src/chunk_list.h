@@ -0,0 +1,165 @@
+/*!
+ * \file chunk_list.h
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Header file for libDXF chunked containers.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_CHUNK_LIST_H
+#define LIBDXF_SRC_CHUNK_LIST_H
+
+
+#include "global.h"
+
+
+#define DXF_CHUNK_LIST_BLOCK_SIZE 64
+        /*!< \brief The default number of entries in a block of a
+         * \c DxfChunkList. */
+
+
+/*!
+ * \brief Definition of a block of entries of a libDXF chunked
+ * container.
+ */
+typedef struct
+dxf_chunk_list_block
+{
+        char *entries;
+                /*!< The entries, allocated together with the block. */
+        int number_of_entries;
+                /*!< Number of entries in use. */
+        struct DxfChunkListBlock *next;
+                /*!< Pointer to the next block.\n
+                 * \c NULL in the last block. */
+} DxfChunkListBlock;
+
+
+/*!
+ * \brief Definition of a libDXF chunked container.
+ *
+ * An ordered container of fixed size entries, stored by value in
+ * blocks of \c block_size entries.\n
+ * Appending is O(1) (the last block is kept), the number of entries is
+ * kept, and forward iteration walks a contiguous array per block.\n
+ * Entries never move once appended, so pointers to entries stay valid
+ * until the container is freed.
+ */
+typedef struct
+dxf_chunk_list
+{
+        int element_size;
+                /*!< Size of an entry in bytes. */
+        int block_size;
+                /*!< Number of entries per block. */
+        int number_of_entries;
+                /*!< Number of entries in the container. */
+        struct DxfChunkListBlock *first;
+                /*!< Pointer to the first block.\n
+                 * \c NULL when the container is empty. */
+        struct DxfChunkListBlock *last;
+                /*!< Pointer to the last block.\n
+                 * \c NULL when the container is empty. */
+} DxfChunkList;
+
+
+/*!
+ * \brief Definition of a forward iterator over a libDXF chunked
+ * container.
+ */
+typedef struct
+dxf_chunk_list_iter
+{
+        DxfChunkList *list;
+                /*!< The container. */
+        struct DxfChunkListBlock *block;
+                /*!< The current block. */
+        int index;
+                /*!< Index of the next entry in the current block. */
+} DxfChunkListIter;
+
+
+DxfChunkList *
+dxf_chunk_list_new ();
+DxfChunkList *
+dxf_chunk_list_init
+(
+        DxfChunkList *list,
+        int element_size,
+        int block_size
+);
+int
+dxf_chunk_list_free
+(
+        DxfChunkList *list
+);
+void *
+dxf_chunk_list_append
+(
+        DxfChunkList *list,
+        const void *element
+);
+int
+dxf_chunk_list_get_number_of_entries
+(
+        DxfChunkList *list
+);
+void *
+dxf_chunk_list_get
+(
+        DxfChunkList *list,
+        int index
+);
+void *
+dxf_chunk_list_get_last
+(
+        DxfChunkList *list
+);
+int
+dxf_chunk_list_iter_init
+(
+        DxfChunkList *list,
+        DxfChunkListIter *iter
+);
+void *
+dxf_chunk_list_iter_next
+(
+        DxfChunkListIter *iter
+);
+DxfChunkList *
+dxf_chunk_list_copy
+(
+        DxfChunkList *list
+);
+
+
+#endif /* LIBDXF_SRC_CHUNK_LIST_H */
+
+
+/* EOF */
@@ -33,6 +33,8 @@
 
 
 #include "circle.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -132,6 +134,7 @@ dxf_circle_init
         circle->paperspace = DXF_MODELSPACE;
         circle->dictionary_owner_soft = strdup ("");
         circle->dictionary_owner_hard = strdup ("");
+        circle->intern = NULL;
         circle->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -178,7 +181,7 @@ dxf_circle_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (circle == NULL)
@@ -189,9 +192,13 @@ dxf_circle_read
                 circle = dxf_circle_new ();
                 circle = dxf_circle_init (circle);
         }
+        /* The symbol names are interned in the intern table of the
+         * file. */
+        circle->intern = fp->intern;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -200,7 +207,7 @@ dxf_circle_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -215,13 +222,13 @@ dxf_circle_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", circle->linetype);
+                        circle->linetype = dxf_intern_read_string (fp, circle->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", circle->layer);
+                        circle->layer = dxf_intern_read_string (fp, circle->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -336,14 +343,14 @@ dxf_circle_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", circle->dictionary_owner_soft);
+                        circle->dictionary_owner_soft = dxf_read_string (fp, circle->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", circle->dictionary_owner_hard);
+                        circle->dictionary_owner_hard = dxf_read_string (fp, circle->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -357,19 +364,37 @@ dxf_circle_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
-        }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
+        }
+        /* Symbol names not found in the file are still the copies
+         * made by the init function. */
+        circle->linetype = dxf_intern_adopt_string ((DxfIntern *) circle->intern, circle->linetype);
+        circle->layer = dxf_intern_adopt_string ((DxfIntern *) circle->intern, circle->layer);
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (circle->linetype, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) circle->intern, circle->linetype, DXF_INTERN_ID_EMPTY))
         {
-                circle->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_intern_free_string ((DxfIntern *) circle->intern, circle->linetype);
+                circle->linetype = dxf_intern_string ((DxfIntern *) circle->intern, DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (circle->layer, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) circle->intern, circle->layer, DXF_INTERN_ID_EMPTY))
         {
-                circle->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_intern_free_string ((DxfIntern *) circle->intern, circle->layer);
+                circle->layer = dxf_intern_string ((DxfIntern *) circle->intern, DXF_DEFAULT_LAYER);
+        }
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (circle->id_code > 0))
+        {
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) circle->id_code, CIRCLE, circle);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -399,6 +424,8 @@ dxf_circle_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("CIRCLE");
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -428,7 +455,8 @@ dxf_circle_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (circle->linetype, "") == 0)
+        linetype = circle->linetype;
+        if (dxf_intern_is_symbol ((DxfIntern *) circle->intern, linetype, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -436,9 +464,10 @@ dxf_circle_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                circle->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = dxf_intern_get_symbol ((DxfIntern *) circle->intern, DXF_INTERN_ID_DEFAULT_LINETYPE);
         }
-        if (strcmp (circle->layer, "") == 0)
+        layer = circle->layer;
+        if (dxf_intern_is_symbol ((DxfIntern *) circle->intern, layer, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -446,7 +475,7 @@ dxf_circle_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name );
-                circle->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = dxf_intern_get_symbol ((DxfIntern *) circle->intern, DXF_INTERN_ID_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -486,10 +515,10 @@ dxf_circle_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", circle->layer);
-        if (strcmp (circle->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (!dxf_intern_is_symbol ((DxfIntern *) circle->intern, linetype, DXF_INTERN_ID_DEFAULT_LINETYPE))
         {
-                fprintf (fp->fp, "  6\n%s\n", circle->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if (circle->color != DXF_COLOR_BYLAYER)
         {
@@ -570,8 +599,8 @@ dxf_circle_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (circle->linetype);
-        free (circle->layer);
+        dxf_intern_free_string ((DxfIntern *) circle->intern, circle->linetype);
+        dxf_intern_free_string ((DxfIntern *) circle->intern, circle->layer);
         free (circle->dictionary_owner_soft);
         free (circle->dictionary_owner_hard);
         free (circle);
@@ -795,7 +824,10 @@ dxf_circle_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->linetype = strdup (linetype);
+        /* Intern first, the new name may be the old one. */
+        linetype = dxf_intern_string ((DxfIntern *) circle->intern, linetype);
+        dxf_intern_free_string ((DxfIntern *) circle->intern, circle->linetype);
+        circle->linetype = linetype;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -885,7 +917,10 @@ dxf_circle_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->layer = strdup (layer);
+        /* Intern first, the new name may be the old one. */
+        layer = dxf_intern_string ((DxfIntern *) circle->intern, layer);
+        dxf_intern_free_string ((DxfIntern *) circle->intern, circle->layer);
+        circle->layer = layer;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2080,4 +2115,67 @@ dxf_circle_set_next
 }
 
 
+/*!
+ * \brief Calculate the nearest point on a DXF \c CIRCLE to a point.
+ *
+ * The point may be outside the plane of the \c circle, the distance
+ * is measured in 3D.
+ *
+ * \return the distance between the point and the \c circle in
+ * drawing units, or -1.0 when an error occurred.
+ *
+ * \version According to DXF R10.
+ * \version According to DXF R11.
+ * \version According to DXF R12.
+ * \version According to DXF R13.
+ * \version According to DXF R14.
+ */
+double
+dxf_circle_calculate_nearest_point
+(
+        DxfCircle *circle,
+                /*!< a pointer to a DXF \c CIRCLE entity. */
+        DxfVec3 point,
+                /*!< the point in WCS. */
+        DxfVec3 *nearest,
+                /*!< the nearest point on the \c circle in WCS
+                 * (output), may be \c NULL. */
+        double *parameter
+                /*!< the angle of the nearest point in degrees, in
+                 * <tt>[0, 360]</tt> (output), may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfOcs ocs;
+        DxfVec3 center;
+        double angle;
+        double distance;
+
+        /* Do some basic checks. */
+        if (circle == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1.0);
+        }
+        dxf_ocs_init (&ocs, circle->extr_x0, circle->extr_y0, circle->extr_z0);
+        center.x = circle->x0;
+        center.y = circle->y0;
+        center.z = circle->z0;
+        distance = dxf_vec3_nearest_point_on_arc (&ocs, center,
+          circle->radius, 0.0, 2.0 * M_PI, point, nearest, &angle);
+        if (parameter != NULL)
+        {
+                *parameter = angle * 180.0 / M_PI;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (distance);
+}
+
+
 /* EOF */
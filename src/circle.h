@@ -37,7 +37,10 @@
 
 
 #include "global.h"
+#include "intern.h"
+#include "handle_table.h"
 #include "point.h"
+#include "vec.h"
 
 
 /*!
@@ -123,6 +126,11 @@ dxf_circle
                 /*!< Z-value of the extrusion vector.\n
                  * Defaults to 1.0 if ommitted in the DXF file.\n
                  * Group code = 230. */
+        struct DxfIntern *intern;
+                /*!< Intern table holding the interned symbol names of
+                 * this entity, \c NULL when none are interned.\n
+                 * Symbol names not found in this table are private
+                 * copies. */
         struct DxfCircle *next;
                 /*!< pointer to the next DxfCircle.\n
                  * \c NULL in the last DxfCircle. */
@@ -324,6 +332,14 @@ dxf_circle_set_next
         DxfCircle *next
 );
 
+double
+dxf_circle_calculate_nearest_point
+(
+        DxfCircle *circle,
+        DxfVec3 point,
+        DxfVec3 *nearest,
+        double *parameter
+);
 
 #endif /* LIBDXF_SRC_CIRCLE_H */
 
@@ -35,6 +35,8 @@
 
 
 #include "class.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -151,7 +153,7 @@ dxf_class_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (class == NULL)
@@ -162,9 +164,10 @@ dxf_class_read
                 class = dxf_class_new ();
                 class = dxf_class_init (class);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -173,7 +176,7 @@ dxf_class_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "0") == 0)
@@ -186,28 +189,28 @@ dxf_class_read
                          * read. See the while condition above.
                          */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", class->record_type);
+                        class->record_type = dxf_read_string (fp, class->record_type);
                 }
                 else if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing a record
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", class->record_name);
+                        class->record_name = dxf_read_string (fp, class->record_name);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a class name.
                          */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", class->class_name);
+                        class->class_name = dxf_read_string (fp, class->class_name);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing the
                          * application name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", class->app_name);
+                        class->app_name = dxf_read_string (fp, class->app_name);
                 }
                 else if (strcmp (temp_string, "90") == 0)
                 {
@@ -242,7 +245,13 @@ dxf_class_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (class->record_type, "") == 0)
@@ -268,7 +277,7 @@ dxf_class_read
                 return (NULL);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -295,6 +304,8 @@ dxf_class_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("CLASS");
+        char *record_name = NULL;
+        char *app_name = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -325,7 +336,8 @@ dxf_class_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (!class->record_name)
+        record_name = class->record_name;
+        if (!record_name)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty record name string for the %s entity\n")),
@@ -333,7 +345,7 @@ dxf_class_write
                 fprintf (stderr,
                   (_("\trecord_name of %s entity is reset to \"\"")),
                   dxf_entity_name );
-                class->record_name = strdup ("");
+                record_name = "";
         }
         if (!class->class_name
                 || (strcmp (class->class_name, "") == 0))
@@ -345,7 +357,8 @@ dxf_class_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (!class->app_name)
+        app_name = class->app_name;
+        if (!app_name)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty app name string for the %s entity\n")),
@@ -353,15 +366,15 @@ dxf_class_write
                 fprintf (stderr,
                   (_("\tapp_name of %s entity is reset to \"\"")),
                   dxf_entity_name );
-                class->app_name = strdup ("");
+                app_name = "";
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        fprintf (fp->fp, "  1\n%s\n", class->record_name);
+        fprintf (fp->fp, "  1\n%s\n", record_name);
         fprintf (fp->fp, "  2\n%s\n", class->class_name);
         if (fp->acad_version_number >= AutoCAD_14)
         {
-                fprintf (fp->fp, "  3\n%s\n", class->app_name);
+                fprintf (fp->fp, "  3\n%s\n", app_name);
         }
         fprintf (fp->fp, " 90\n%d\n", class->proxy_cap_flag);
         fprintf (fp->fp, "280\n%d\n", class->was_a_proxy_flag);
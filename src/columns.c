@@ -0,0 +1,1667 @@
+/*!
+ * \file columns.c
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Functions for libDXF columnar (structure of arrays) entity stores.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "columns.h"
+#include "util.h"
+
+
+/*!
+ * \brief Resize the member arrays of a columnar store.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred (the arrays reallocated so far keep their new size).
+ */
+static int
+dxf_columns_resize
+(
+        void ***members,
+                /*!< \c NULL terminated array of pointers to the member
+                 * arrays. */
+        const size_t *sizes,
+                /*!< the element size of each member array. */
+        int capacity
+                /*!< the new number of rows. */
+)
+{
+        void *array = NULL;
+        int i;
+
+        for (i = 0; members[i] != NULL; i++)
+        {
+                array = realloc (*members[i], (size_t) capacity * sizes[i]);
+                if (array == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for a column.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                *members[i] = array;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the intern id of a symbol name, interning it when needed.
+ *
+ * \return the id, or -1 when an error occurred.
+ */
+static int
+dxf_columns_intern_id
+(
+        DxfIntern *intern,
+                /*!< a pointer to a DXF intern table. */
+        const char *string
+                /*!< a symbol name. */
+)
+{
+        if ((string == NULL) || (dxf_intern_string (intern, string) == NULL))
+        {
+                return (-1);
+        }
+        return (dxf_intern_get_id (intern, string));
+}
+
+
+/*!
+ * \brief Read a symbol name from a DXF file into an intern table.
+ *
+ * \return the intern id of the symbol name, or -1 when an error
+ * occurred.
+ */
+static int
+dxf_columns_read_symbol
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfIntern *intern
+                /*!< a pointer to a DXF intern table. */
+)
+{
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        size_t length;
+
+        if (fgets (temp_string, DXF_MAX_STRING_LENGTH, fp->fp) == NULL)
+        {
+                return (-1);
+        }
+        length = strlen (temp_string);
+        while ((length > 0)
+          && ((temp_string[length - 1] == '\n') || (temp_string[length - 1] == '\r')))
+        {
+                temp_string[--length] = '\0';
+        }
+        return (dxf_columns_intern_id (intern, temp_string));
+}
+
+
+/*!
+ * \brief Calculate the range of a column of values.
+ *
+ * Branch free, so the compiler can vectorize the loop.
+ */
+static void
+dxf_columns_calculate_range
+(
+        const double *values,
+                /*!< the values. */
+        int n,
+                /*!< number of values, at least 1. */
+        double *min,
+                /*!< the minimum value is stored here. */
+        double *max
+                /*!< the maximum value is stored here. */
+)
+{
+        double lo = values[0];
+        double hi = values[0];
+        int i;
+
+        for (i = 1; i < n; i++)
+        {
+                lo = (values[i] < lo) ? values[i] : lo;
+                hi = (values[i] > hi) ? values[i] : hi;
+        }
+        *min = lo;
+        *max = hi;
+}
+
+
+/*!
+ * \brief Make room for one more row in a \c LINE columnar store.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_line_columns_reserve_row
+(
+        DxfLineColumns *columns
+                /*!< a pointer to a DXF \c LINE columnar store. */
+)
+{
+        void **members[] =
+        {
+                (void **) &columns->id_code,
+                (void **) &columns->layer_id,
+                (void **) &columns->linetype_id,
+                (void **) &columns->color,
+                (void **) &columns->paperspace,
+                (void **) &columns->thickness,
+                (void **) &columns->x0,
+                (void **) &columns->y0,
+                (void **) &columns->z0,
+                (void **) &columns->x1,
+                (void **) &columns->y1,
+                (void **) &columns->z1,
+                (void **) &columns->extr_x0,
+                (void **) &columns->extr_y0,
+                (void **) &columns->extr_z0,
+                NULL
+        };
+        const size_t sizes[] =
+        {
+                sizeof (int), sizeof (int), sizeof (int), sizeof (int),
+                sizeof (int), sizeof (double), sizeof (double),
+                sizeof (double), sizeof (double), sizeof (double),
+                sizeof (double), sizeof (double), sizeof (double),
+                sizeof (double), sizeof (double)
+        };
+        int capacity;
+
+        if (columns->number_of_rows < columns->capacity)
+        {
+                return (EXIT_SUCCESS);
+        }
+        capacity = (columns->capacity == 0)
+          ? DXF_COLUMNS_INITIAL_CAPACITY
+          : 2 * columns->capacity;
+        if (dxf_columns_resize (members, sizes, capacity) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        columns->capacity = capacity;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a DXF \c LINE columnar store.
+ *
+ * Fill the memory contents with zeros.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfLineColumns *
+dxf_line_columns_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLineColumns *columns = NULL;
+        size_t size;
+
+        size = sizeof (DxfLineColumns);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((columns = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfLineColumns struct.\n")),
+                  __FUNCTION__);
+                columns = NULL;
+        }
+        else
+        {
+                memset (columns, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (columns);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a DXF \c LINE
+ * columnar store.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfLineColumns *
+dxf_line_columns_init
+(
+        DxfLineColumns *columns,
+                /*!< a pointer to a DXF \c LINE columnar store. */
+        DxfIntern *intern
+                /*!< a pointer to the intern table for the layer and
+                 * linetype names, usually the one of the drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (intern == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (columns == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                columns = dxf_line_columns_new ();
+        }
+        if (columns == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfLineColumns struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        columns->number_of_rows = 0;
+        columns->intern = intern;
+        if (dxf_line_columns_reserve_row (columns) == EXIT_FAILURE)
+        {
+                dxf_line_columns_free (columns);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (columns);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a DXF \c LINE columnar store.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_line_columns_free
+(
+        DxfLineColumns *columns
+                /*!< a pointer to the memory occupied by the DXF \c LINE
+                 * columnar store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (columns == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (columns->id_code);
+        free (columns->layer_id);
+        free (columns->linetype_id);
+        free (columns->color);
+        free (columns->paperspace);
+        free (columns->thickness);
+        free (columns->x0);
+        free (columns->y0);
+        free (columns->z0);
+        free (columns->x1);
+        free (columns->y1);
+        free (columns->z1);
+        free (columns->extr_x0);
+        free (columns->extr_y0);
+        free (columns->extr_z0);
+        free (columns);
+        columns = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a DXF \c LINE entity as a row to a DXF \c LINE
+ * columnar store.
+ *
+ * \return the row number when done, or -1 when an error occurred.
+ */
+int
+dxf_line_columns_append
+(
+        DxfLineColumns *columns,
+                /*!< a pointer to a DXF \c LINE columnar store. */
+        DxfLine *line
+                /*!< a pointer to a DXF \c LINE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int row;
+
+        /* Do some basic checks. */
+        if ((columns == NULL) || (line == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (dxf_line_columns_reserve_row (columns) == EXIT_FAILURE)
+        {
+                return (-1);
+        }
+        row = columns->number_of_rows;
+        columns->id_code[row] = line->id_code;
+        columns->layer_id[row] = dxf_columns_intern_id (columns->intern,
+          (line->layer != NULL) ? line->layer : DXF_DEFAULT_LAYER);
+        columns->linetype_id[row] = dxf_columns_intern_id (columns->intern,
+          (line->linetype != NULL) ? line->linetype : DXF_DEFAULT_LINETYPE);
+        columns->color[row] = line->color;
+        columns->paperspace[row] = line->paperspace;
+        columns->thickness[row] = line->thickness;
+        columns->x0[row] = line->x0;
+        columns->y0[row] = line->y0;
+        columns->z0[row] = line->z0;
+        columns->x1[row] = line->x1;
+        columns->y1[row] = line->y1;
+        columns->z1[row] = line->z1;
+        columns->extr_x0[row] = line->extr_x0;
+        columns->extr_y0[row] = line->extr_y0;
+        columns->extr_z0[row] = line->extr_z0;
+        columns->number_of_rows++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (row);
+}
+
+
+/*!
+ * \brief Append a chain of DXF \c LINE entities to a DXF \c LINE
+ * columnar store.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_line_columns_append_chain
+(
+        DxfLineColumns *columns,
+                /*!< a pointer to a DXF \c LINE columnar store. */
+        DxfLine *lines
+                /*!< a pointer to a chain of DXF \c LINE entities. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLine *iter = NULL;
+
+        for (iter = lines; iter != NULL; iter = (DxfLine *) iter->next)
+        {
+                if (dxf_line_columns_append (columns, iter) == -1)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Create a DXF \c LINE entity from a row of a DXF \c LINE
+ * columnar store.
+ *
+ * The layer and linetype names of the new entity are shared with the
+ * intern table of the store.
+ *
+ * \return a pointer to a new DXF \c LINE entity, or \c NULL when an
+ * error occurred.
+ */
+DxfLine *
+dxf_line_columns_get_line
+(
+        DxfLineColumns *columns,
+                /*!< a pointer to a DXF \c LINE columnar store. */
+        int row
+                /*!< the row number. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLine *line = NULL;
+
+        /* Do some basic checks. */
+        if (columns == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((row < 0) || (row >= columns->number_of_rows))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range row was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        line = dxf_line_init (dxf_line_new ());
+        if (line == NULL)
+        {
+                return (NULL);
+        }
+        line->id_code = columns->id_code[row];
+        if (columns->layer_id[row] != -1)
+        {
+                dxf_intern_free_string ((DxfIntern *) line->intern, line->layer);
+                line->layer = dxf_intern_get_string (columns->intern, columns->layer_id[row]);
+        }
+        if (columns->linetype_id[row] != -1)
+        {
+                dxf_intern_free_string ((DxfIntern *) line->intern, line->linetype);
+                line->linetype = dxf_intern_get_string (columns->intern, columns->linetype_id[row]);
+        }
+        /* The symbol names are shared with the intern table of the
+         * columns. */
+        line->intern = (struct DxfIntern *) columns->intern;
+        line->color = columns->color[row];
+        line->paperspace = columns->paperspace[row];
+        line->thickness = columns->thickness[row];
+        line->x0 = columns->x0[row];
+        line->y0 = columns->y0[row];
+        line->z0 = columns->z0[row];
+        line->x1 = columns->x1[row];
+        line->y1 = columns->y1[row];
+        line->z1 = columns->z1[row];
+        line->extr_x0 = columns->extr_x0[row];
+        line->extr_y0 = columns->extr_y0[row];
+        line->extr_z0 = columns->extr_z0[row];
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (line);
+}
+
+
+/*!
+ * \brief Export all rows of a DXF \c LINE columnar store into a chain
+ * of DXF \c LINE entities.
+ *
+ * \return a pointer to the first DXF \c LINE entity of the chain, or
+ * \c NULL when the store is empty or an error occurred.
+ */
+DxfLine *
+dxf_line_columns_export_chain
+(
+        DxfLineColumns *columns
+                /*!< a pointer to a DXF \c LINE columnar store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLine *first = NULL;
+        DxfLine *last = NULL;
+        DxfLine *line = NULL;
+        int row;
+
+        /* Do some basic checks. */
+        if (columns == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (row = 0; row < columns->number_of_rows; row++)
+        {
+                line = dxf_line_columns_get_line (columns, row);
+                if (line == NULL)
+                {
+                        dxf_line_free_chain (first);
+                        return (NULL);
+                }
+                if (last == NULL)
+                {
+                        first = line;
+                }
+                else
+                {
+                        last->next = (struct DxfLine *) line;
+                }
+                last = line;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (first);
+}
+
+
+/*!
+ * \brief Read data from a DXF file directly into a new row of a DXF
+ * \c LINE columnar store.
+ *
+ * The last line read from file contained the string "LINE".\n
+ * Now follows some data for the \c LINE, to be terminated with a
+ * "  0" string announcing the following entity, or the end of the
+ * \c ENTITY section marker \c ENDSEC.\n
+ * No \c DxfLine struct is allocated.
+ *
+ * \return the row number when done, or -1 when an error occurred.
+ */
+int
+dxf_line_columns_read
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfLineColumns *columns
+                /*!< a pointer to a DXF \c LINE columnar store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
+        int row;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (columns == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (dxf_line_columns_reserve_row (columns) == EXIT_FAILURE)
+        {
+                return (-1);
+        }
+        /* Fill the row with default values. */
+        row = columns->number_of_rows;
+        columns->id_code[row] = 0;
+        columns->layer_id[row] = dxf_columns_intern_id (columns->intern, DXF_DEFAULT_LAYER);
+        columns->linetype_id[row] = dxf_columns_intern_id (columns->intern, DXF_DEFAULT_LINETYPE);
+        columns->color[row] = DXF_COLOR_BYLAYER;
+        columns->paperspace[row] = DXF_MODELSPACE;
+        columns->thickness[row] = 0.0;
+        columns->x0[row] = 0.0;
+        columns->y0[row] = 0.0;
+        columns->z0[row] = 0.0;
+        columns->x1[row] = 0.0;
+        columns->y1[row] = 0.0;
+        columns->z1[row] = 0.0;
+        columns->extr_x0[row] = 0.0;
+        columns->extr_y0[row] = 0.0;
+        columns->extr_z0[row] = 1.0;
+        (fp->line_number)++;
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
+        {
+                if ((ferror (fp->fp))
+                  || (sscanf (temp_string, "%d", &group_code) != 1))
+                {
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 5:
+                                fscanf (fp->fp, "%x\n", &columns->id_code[row]);
+                                break;
+                        case 6:
+                                columns->linetype_id[row] = dxf_columns_read_symbol (fp, columns->intern);
+                                break;
+                        case 8:
+                                columns->layer_id[row] = dxf_columns_read_symbol (fp, columns->intern);
+                                break;
+                        case 10:
+                                fscanf (fp->fp, "%lf\n", &columns->x0[row]);
+                                break;
+                        case 20:
+                                fscanf (fp->fp, "%lf\n", &columns->y0[row]);
+                                break;
+                        case 30:
+                                fscanf (fp->fp, "%lf\n", &columns->z0[row]);
+                                break;
+                        case 11:
+                                fscanf (fp->fp, "%lf\n", &columns->x1[row]);
+                                break;
+                        case 21:
+                                fscanf (fp->fp, "%lf\n", &columns->y1[row]);
+                                break;
+                        case 31:
+                                fscanf (fp->fp, "%lf\n", &columns->z1[row]);
+                                break;
+                        case 39:
+                                fscanf (fp->fp, "%lf\n", &columns->thickness[row]);
+                                break;
+                        case 62:
+                                fscanf (fp->fp, "%d\n", &columns->color[row]);
+                                break;
+                        case 67:
+                                fscanf (fp->fp, "%d\n", &columns->paperspace[row]);
+                                break;
+                        case 210:
+                                fscanf (fp->fp, "%lf\n", &columns->extr_x0[row]);
+                                break;
+                        case 220:
+                                fscanf (fp->fp, "%lf\n", &columns->extr_y0[row]);
+                                break;
+                        case 230:
+                                fscanf (fp->fp, "%lf\n", &columns->extr_z0[row]);
+                                break;
+                        default:
+                                /* Members not kept in the store
+                                 * (subclass markers, handles, comments,
+                                 * ...) are skipped. */
+                                dxf_read_group_code (fp, temp_string);
+                                break;
+                }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
+        }
+        if (strcmp (temp_string, "0") != 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () while reading from: %s in line: %d.\n")),
+                  __FUNCTION__, fp->filename, fp->line_number);
+                return (-1);
+        }
+        /* The next line contains the name of the following entity
+         * (or ENDSEC). */
+        columns->number_of_rows++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (row);
+}
+
+
+/*!
+ * \brief Calculate the bounding box of all rows of a DXF \c LINE
+ * columnar store.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the store
+ * is empty or an error occurred.
+ */
+int
+dxf_line_columns_calculate_bounds
+(
+        DxfLineColumns *columns,
+                /*!< a pointer to a DXF \c LINE columnar store. */
+        double *min_x,
+                /*!< the minimum X value is stored here. */
+        double *min_y,
+                /*!< the minimum Y value is stored here. */
+        double *min_z,
+                /*!< the minimum Z value is stored here. */
+        double *max_x,
+                /*!< the maximum X value is stored here. */
+        double *max_y,
+                /*!< the maximum Y value is stored here. */
+        double *max_z
+                /*!< the maximum Z value is stored here. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double lo, hi;
+
+        /* Do some basic checks. */
+        if ((columns == NULL) || (min_x == NULL) || (min_y == NULL)
+          || (min_z == NULL) || (max_x == NULL) || (max_y == NULL)
+          || (max_z == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (columns->number_of_rows == 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_columns_calculate_range (columns->x0, columns->number_of_rows, min_x, max_x);
+        dxf_columns_calculate_range (columns->x1, columns->number_of_rows, &lo, &hi);
+        *min_x = (lo < *min_x) ? lo : *min_x;
+        *max_x = (hi > *max_x) ? hi : *max_x;
+        dxf_columns_calculate_range (columns->y0, columns->number_of_rows, min_y, max_y);
+        dxf_columns_calculate_range (columns->y1, columns->number_of_rows, &lo, &hi);
+        *min_y = (lo < *min_y) ? lo : *min_y;
+        *max_y = (hi > *max_y) ? hi : *max_y;
+        dxf_columns_calculate_range (columns->z0, columns->number_of_rows, min_z, max_z);
+        dxf_columns_calculate_range (columns->z1, columns->number_of_rows, &lo, &hi);
+        *min_z = (lo < *min_z) ? lo : *min_z;
+        *max_z = (hi > *max_z) ? hi : *max_z;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Calculate the length of every row of a DXF \c LINE columnar
+ * store.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_line_columns_calculate_lengths
+(
+        DxfLineColumns *columns,
+                /*!< a pointer to a DXF \c LINE columnar store. */
+        double *lengths
+                /*!< an array of at least \c number_of_rows elements,
+                 * the lengths are stored here. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const double *x0, *y0, *z0, *x1, *y1, *z1;
+        double dx, dy, dz;
+        int n;
+        int i;
+
+        /* Do some basic checks. */
+        if ((columns == NULL) || (lengths == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        n = columns->number_of_rows;
+        x0 = columns->x0; y0 = columns->y0; z0 = columns->z0;
+        x1 = columns->x1; y1 = columns->y1; z1 = columns->z1;
+        for (i = 0; i < n; i++)
+        {
+                dx = x1[i] - x0[i];
+                dy = y1[i] - y0[i];
+                dz = z1[i] - z0[i];
+                lengths[i] = sqrt ((dx * dx) + (dy * dy) + (dz * dz));
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Calculate the sum of the lengths of all rows of a DXF \c LINE
+ * columnar store.
+ *
+ * \return the total length in drawing units.
+ */
+double
+dxf_line_columns_calculate_total_length
+(
+        DxfLineColumns *columns
+                /*!< a pointer to a DXF \c LINE columnar store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const double *x0, *y0, *z0, *x1, *y1, *z1;
+        double dx, dy, dz;
+        double total = 0.0;
+        int n;
+        int i;
+
+        /* Do some basic checks. */
+        if (columns == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0.0);
+        }
+        n = columns->number_of_rows;
+        x0 = columns->x0; y0 = columns->y0; z0 = columns->z0;
+        x1 = columns->x1; y1 = columns->y1; z1 = columns->z1;
+        for (i = 0; i < n; i++)
+        {
+                dx = x1[i] - x0[i];
+                dy = y1[i] - y0[i];
+                dz = z1[i] - z0[i];
+                total += sqrt ((dx * dx) + (dy * dy) + (dz * dz));
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (total);
+}
+
+
+/*!
+ * \brief Apply an affine transform to a set of point columns.
+ */
+static void
+dxf_columns_transform_points
+(
+        double *x,
+                /*!< X values. */
+        double *y,
+                /*!< Y values. */
+        double *z,
+                /*!< Z values. */
+        int n,
+                /*!< number of values. */
+        double matrix[3][4],
+                /*!< the affine transform (row major). */
+        int translate
+                /*!< \c TRUE for points, \c FALSE for direction
+                 * vectors. */
+)
+{
+        double m00 = matrix[0][0], m01 = matrix[0][1], m02 = matrix[0][2];
+        double m10 = matrix[1][0], m11 = matrix[1][1], m12 = matrix[1][2];
+        double m20 = matrix[2][0], m21 = matrix[2][1], m22 = matrix[2][2];
+        double t0 = 0.0, t1 = 0.0, t2 = 0.0;
+        double px, py, pz;
+        int i;
+
+        if (translate)
+        {
+                t0 = matrix[0][3];
+                t1 = matrix[1][3];
+                t2 = matrix[2][3];
+        }
+        for (i = 0; i < n; i++)
+        {
+                px = x[i];
+                py = y[i];
+                pz = z[i];
+                x[i] = (m00 * px) + (m01 * py) + (m02 * pz) + t0;
+                y[i] = (m10 * px) + (m11 * py) + (m12 * pz) + t1;
+                z[i] = (m20 * px) + (m21 * py) + (m22 * pz) + t2;
+        }
+}
+
+
+/*!
+ * \brief Normalize a set of direction vector columns.
+ */
+static void
+dxf_columns_normalize
+(
+        double *x,
+                /*!< X values. */
+        double *y,
+                /*!< Y values. */
+        double *z,
+                /*!< Z values. */
+        int n
+                /*!< number of values. */
+)
+{
+        double length;
+        int i;
+
+        for (i = 0; i < n; i++)
+        {
+                length = sqrt ((x[i] * x[i]) + (y[i] * y[i]) + (z[i] * z[i]));
+                if (length > 0.0)
+                {
+                        x[i] /= length;
+                        y[i] /= length;
+                        z[i] /= length;
+                }
+        }
+}
+
+
+/*!
+ * \brief Transform all rows of a DXF \c LINE columnar store.
+ *
+ * Start and end points are transformed by the affine transform,
+ * extrusion vectors by its linear part (and normalized again).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_line_columns_transform
+(
+        DxfLineColumns *columns,
+                /*!< a pointer to a DXF \c LINE columnar store. */
+        double matrix[3][4]
+                /*!< the affine transform (row major, the last column
+                 * holds the translation). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((columns == NULL) || (matrix == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_columns_transform_points (columns->x0, columns->y0, columns->z0,
+          columns->number_of_rows, matrix, TRUE);
+        dxf_columns_transform_points (columns->x1, columns->y1, columns->z1,
+          columns->number_of_rows, matrix, TRUE);
+        dxf_columns_transform_points (columns->extr_x0, columns->extr_y0,
+          columns->extr_z0, columns->number_of_rows, matrix, FALSE);
+        dxf_columns_normalize (columns->extr_x0, columns->extr_y0,
+          columns->extr_z0, columns->number_of_rows);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Make room for one more row in a \c POINT columnar store.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_point_columns_reserve_row
+(
+        DxfPointColumns *columns
+                /*!< a pointer to a DXF \c POINT columnar store. */
+)
+{
+        void **members[] =
+        {
+                (void **) &columns->id_code,
+                (void **) &columns->layer_id,
+                (void **) &columns->linetype_id,
+                (void **) &columns->color,
+                (void **) &columns->paperspace,
+                (void **) &columns->thickness,
+                (void **) &columns->x0,
+                (void **) &columns->y0,
+                (void **) &columns->z0,
+                (void **) &columns->extr_x0,
+                (void **) &columns->extr_y0,
+                (void **) &columns->extr_z0,
+                NULL
+        };
+        const size_t sizes[] =
+        {
+                sizeof (int), sizeof (int), sizeof (int), sizeof (int),
+                sizeof (int), sizeof (double), sizeof (double),
+                sizeof (double), sizeof (double), sizeof (double),
+                sizeof (double), sizeof (double)
+        };
+        int capacity;
+
+        if (columns->number_of_rows < columns->capacity)
+        {
+                return (EXIT_SUCCESS);
+        }
+        capacity = (columns->capacity == 0)
+          ? DXF_COLUMNS_INITIAL_CAPACITY
+          : 2 * columns->capacity;
+        if (dxf_columns_resize (members, sizes, capacity) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        columns->capacity = capacity;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a DXF \c POINT columnar store.
+ *
+ * Fill the memory contents with zeros.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfPointColumns *
+dxf_point_columns_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPointColumns *columns = NULL;
+        size_t size;
+
+        size = sizeof (DxfPointColumns);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((columns = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfPointColumns struct.\n")),
+                  __FUNCTION__);
+                columns = NULL;
+        }
+        else
+        {
+                memset (columns, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (columns);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a DXF \c POINT
+ * columnar store.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfPointColumns *
+dxf_point_columns_init
+(
+        DxfPointColumns *columns,
+                /*!< a pointer to a DXF \c POINT columnar store. */
+        DxfIntern *intern
+                /*!< a pointer to the intern table for the layer and
+                 * linetype names, usually the one of the drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (intern == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (columns == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                columns = dxf_point_columns_new ();
+        }
+        if (columns == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfPointColumns struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        columns->number_of_rows = 0;
+        columns->intern = intern;
+        if (dxf_point_columns_reserve_row (columns) == EXIT_FAILURE)
+        {
+                dxf_point_columns_free (columns);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (columns);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a DXF \c POINT columnar store.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_point_columns_free
+(
+        DxfPointColumns *columns
+                /*!< a pointer to the memory occupied by the DXF \c POINT
+                 * columnar store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (columns == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (columns->id_code);
+        free (columns->layer_id);
+        free (columns->linetype_id);
+        free (columns->color);
+        free (columns->paperspace);
+        free (columns->thickness);
+        free (columns->x0);
+        free (columns->y0);
+        free (columns->z0);
+        free (columns->extr_x0);
+        free (columns->extr_y0);
+        free (columns->extr_z0);
+        free (columns);
+        columns = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a DXF \c POINT entity as a row to a DXF \c POINT
+ * columnar store.
+ *
+ * \return the row number when done, or -1 when an error occurred.
+ */
+int
+dxf_point_columns_append
+(
+        DxfPointColumns *columns,
+                /*!< a pointer to a DXF \c POINT columnar store. */
+        DxfPoint *point
+                /*!< a pointer to a DXF \c POINT entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int row;
+
+        /* Do some basic checks. */
+        if ((columns == NULL) || (point == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (dxf_point_columns_reserve_row (columns) == EXIT_FAILURE)
+        {
+                return (-1);
+        }
+        row = columns->number_of_rows;
+        columns->id_code[row] = point->id_code;
+        columns->layer_id[row] = dxf_columns_intern_id (columns->intern,
+          (point->layer != NULL) ? point->layer : DXF_DEFAULT_LAYER);
+        columns->linetype_id[row] = dxf_columns_intern_id (columns->intern,
+          (point->linetype != NULL) ? point->linetype : DXF_DEFAULT_LINETYPE);
+        columns->color[row] = point->color;
+        columns->paperspace[row] = point->paperspace;
+        columns->thickness[row] = point->thickness;
+        columns->x0[row] = point->x0;
+        columns->y0[row] = point->y0;
+        columns->z0[row] = point->z0;
+        columns->extr_x0[row] = point->extr_x0;
+        columns->extr_y0[row] = point->extr_y0;
+        columns->extr_z0[row] = point->extr_z0;
+        columns->number_of_rows++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (row);
+}
+
+
+/*!
+ * \brief Append a chain of DXF \c POINT entities to a DXF \c POINT
+ * columnar store.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_point_columns_append_chain
+(
+        DxfPointColumns *columns,
+                /*!< a pointer to a DXF \c POINT columnar store. */
+        DxfPoint *points
+                /*!< a pointer to a chain of DXF \c POINT entities. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *iter = NULL;
+
+        for (iter = points; iter != NULL; iter = (DxfPoint *) iter->next)
+        {
+                if (dxf_point_columns_append (columns, iter) == -1)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Create a DXF \c POINT entity from a row of a DXF \c POINT
+ * columnar store.
+ *
+ * The layer and linetype names of the new entity are shared with the
+ * intern table of the store.
+ *
+ * \return a pointer to a new DXF \c POINT entity, or \c NULL when an
+ * error occurred.
+ */
+DxfPoint *
+dxf_point_columns_get_point
+(
+        DxfPointColumns *columns,
+                /*!< a pointer to a DXF \c POINT columnar store. */
+        int row
+                /*!< the row number. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *point = NULL;
+
+        /* Do some basic checks. */
+        if (columns == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((row < 0) || (row >= columns->number_of_rows))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range row was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        point = dxf_point_init (dxf_point_new ());
+        if (point == NULL)
+        {
+                return (NULL);
+        }
+        point->id_code = columns->id_code[row];
+        if (columns->layer_id[row] != -1)
+        {
+                dxf_intern_free_string ((DxfIntern *) point->intern, point->layer);
+                point->layer = dxf_intern_get_string (columns->intern, columns->layer_id[row]);
+        }
+        if (columns->linetype_id[row] != -1)
+        {
+                dxf_intern_free_string ((DxfIntern *) point->intern, point->linetype);
+                point->linetype = dxf_intern_get_string (columns->intern, columns->linetype_id[row]);
+        }
+        /* The symbol names are shared with the intern table of the
+         * columns. */
+        point->intern = (struct DxfIntern *) columns->intern;
+        point->color = columns->color[row];
+        point->paperspace = columns->paperspace[row];
+        point->thickness = columns->thickness[row];
+        point->x0 = columns->x0[row];
+        point->y0 = columns->y0[row];
+        point->z0 = columns->z0[row];
+        point->extr_x0 = columns->extr_x0[row];
+        point->extr_y0 = columns->extr_y0[row];
+        point->extr_z0 = columns->extr_z0[row];
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (point);
+}
+
+
+/*!
+ * \brief Export all rows of a DXF \c POINT columnar store into a chain
+ * of DXF \c POINT entities.
+ *
+ * \return a pointer to the first DXF \c POINT entity of the chain, or
+ * \c NULL when the store is empty or an error occurred.
+ */
+DxfPoint *
+dxf_point_columns_export_chain
+(
+        DxfPointColumns *columns
+                /*!< a pointer to a DXF \c POINT columnar store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint *first = NULL;
+        DxfPoint *last = NULL;
+        DxfPoint *point = NULL;
+        int row;
+
+        /* Do some basic checks. */
+        if (columns == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (row = 0; row < columns->number_of_rows; row++)
+        {
+                point = dxf_point_columns_get_point (columns, row);
+                if (point == NULL)
+                {
+                        dxf_point_free_chain (first);
+                        return (NULL);
+                }
+                if (last == NULL)
+                {
+                        first = point;
+                }
+                else
+                {
+                        last->next = (struct DxfPoint *) point;
+                }
+                last = point;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (first);
+}
+
+
+/*!
+ * \brief Read data from a DXF file directly into a new row of a DXF
+ * \c POINT columnar store.
+ *
+ * The last line read from file contained the string "POINT".\n
+ * Now follows some data for the \c POINT, to be terminated with a
+ * "  0" string announcing the following entity, or the end of the
+ * \c ENTITY section marker \c ENDSEC.\n
+ * No \c DxfPoint struct is allocated.
+ *
+ * \return the row number when done, or -1 when an error occurred.
+ */
+int
+dxf_point_columns_read
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfPointColumns *columns
+                /*!< a pointer to a DXF \c POINT columnar store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
+        int row;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (columns == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (dxf_point_columns_reserve_row (columns) == EXIT_FAILURE)
+        {
+                return (-1);
+        }
+        /* Fill the row with default values. */
+        row = columns->number_of_rows;
+        columns->id_code[row] = 0;
+        columns->layer_id[row] = dxf_columns_intern_id (columns->intern, DXF_DEFAULT_LAYER);
+        columns->linetype_id[row] = dxf_columns_intern_id (columns->intern, DXF_DEFAULT_LINETYPE);
+        columns->color[row] = DXF_COLOR_BYLAYER;
+        columns->paperspace[row] = DXF_MODELSPACE;
+        columns->thickness[row] = 0.0;
+        columns->x0[row] = 0.0;
+        columns->y0[row] = 0.0;
+        columns->z0[row] = 0.0;
+        columns->extr_x0[row] = 0.0;
+        columns->extr_y0[row] = 0.0;
+        columns->extr_z0[row] = 1.0;
+        (fp->line_number)++;
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
+        {
+                if ((ferror (fp->fp))
+                  || (sscanf (temp_string, "%d", &group_code) != 1))
+                {
+                        break;
+                }
+                (fp->line_number)++;
+                switch (group_code)
+                {
+                        case 5:
+                                fscanf (fp->fp, "%x\n", &columns->id_code[row]);
+                                break;
+                        case 6:
+                                columns->linetype_id[row] = dxf_columns_read_symbol (fp, columns->intern);
+                                break;
+                        case 8:
+                                columns->layer_id[row] = dxf_columns_read_symbol (fp, columns->intern);
+                                break;
+                        case 10:
+                                fscanf (fp->fp, "%lf\n", &columns->x0[row]);
+                                break;
+                        case 20:
+                                fscanf (fp->fp, "%lf\n", &columns->y0[row]);
+                                break;
+                        case 30:
+                                fscanf (fp->fp, "%lf\n", &columns->z0[row]);
+                                break;
+                        case 39:
+                                fscanf (fp->fp, "%lf\n", &columns->thickness[row]);
+                                break;
+                        case 62:
+                                fscanf (fp->fp, "%d\n", &columns->color[row]);
+                                break;
+                        case 67:
+                                fscanf (fp->fp, "%d\n", &columns->paperspace[row]);
+                                break;
+                        case 210:
+                                fscanf (fp->fp, "%lf\n", &columns->extr_x0[row]);
+                                break;
+                        case 220:
+                                fscanf (fp->fp, "%lf\n", &columns->extr_y0[row]);
+                                break;
+                        case 230:
+                                fscanf (fp->fp, "%lf\n", &columns->extr_z0[row]);
+                                break;
+                        default:
+                                /* Members not kept in the store
+                                 * (subclass markers, handles, comments,
+                                 * ...) are skipped. */
+                                dxf_read_group_code (fp, temp_string);
+                                break;
+                }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
+        }
+        if (strcmp (temp_string, "0") != 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () while reading from: %s in line: %d.\n")),
+                  __FUNCTION__, fp->filename, fp->line_number);
+                return (-1);
+        }
+        /* The next line contains the name of the following entity
+         * (or ENDSEC). */
+        columns->number_of_rows++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (row);
+}
+
+
+/*!
+ * \brief Calculate the bounding box of all rows of a DXF \c POINT
+ * columnar store.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the store
+ * is empty or an error occurred.
+ */
+int
+dxf_point_columns_calculate_bounds
+(
+        DxfPointColumns *columns,
+                /*!< a pointer to a DXF \c POINT columnar store. */
+        double *min_x,
+                /*!< the minimum X value is stored here. */
+        double *min_y,
+                /*!< the minimum Y value is stored here. */
+        double *min_z,
+                /*!< the minimum Z value is stored here. */
+        double *max_x,
+                /*!< the maximum X value is stored here. */
+        double *max_y,
+                /*!< the maximum Y value is stored here. */
+        double *max_z
+                /*!< the maximum Z value is stored here. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((columns == NULL) || (min_x == NULL) || (min_y == NULL)
+          || (min_z == NULL) || (max_x == NULL) || (max_y == NULL)
+          || (max_z == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (columns->number_of_rows == 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_columns_calculate_range (columns->x0, columns->number_of_rows, min_x, max_x);
+        dxf_columns_calculate_range (columns->y0, columns->number_of_rows, min_y, max_y);
+        dxf_columns_calculate_range (columns->z0, columns->number_of_rows, min_z, max_z);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Transform all rows of a DXF \c POINT columnar store.
+ *
+ * Points are transformed by the affine transform, extrusion vectors by
+ * its linear part (and normalized again).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_point_columns_transform
+(
+        DxfPointColumns *columns,
+                /*!< a pointer to a DXF \c POINT columnar store. */
+        double matrix[3][4]
+                /*!< the affine transform (row major, the last column
+                 * holds the translation). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((columns == NULL) || (matrix == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_columns_transform_points (columns->x0, columns->y0, columns->z0,
+          columns->number_of_rows, matrix, TRUE);
+        dxf_columns_transform_points (columns->extr_x0, columns->extr_y0,
+          columns->extr_z0, columns->number_of_rows, matrix, FALSE);
+        dxf_columns_normalize (columns->extr_x0, columns->extr_y0,
+          columns->extr_z0, columns->number_of_rows);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
@@ -0,0 +1,279 @@
+/*!
+ * \file columns.h
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Header file for libDXF columnar (structure of arrays) entity stores.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_COLUMNS_H
+#define LIBDXF_SRC_COLUMNS_H
+
+
+#include "global.h"
+#include "intern.h"
+#include "line.h"
+#include "point.h"
+
+
+#define DXF_COLUMNS_INITIAL_CAPACITY 1024
+        /*!< \brief The initial number of rows allocated in a columnar
+         * entity store. */
+
+
+/*!
+ * \brief Definition of a columnar store for DXF \c LINE entities.
+ *
+ * Every member of a \c LINE relevant for bulk geometry processing is
+ * stored in a separate contiguous array (one row per \c LINE), so that
+ * batch kernels (bounds, length, transform) walk through memory
+ * sequentially and can be vectorized by the compiler.\n
+ * Layer and linetype names are stored as ids of the intern table the
+ * store was initialized with.
+ */
+typedef struct
+dxf_line_columns_struct
+{
+        int number_of_rows;
+                /*!< Number of \c LINE entities in the store. */
+        int capacity;
+                /*!< Number of allocated rows. */
+        DxfIntern *intern;
+                /*!< Intern table resolving the layer and linetype ids
+                 * (not owned by the store). */
+        int *id_code;
+                /*!< Identification numbers (group code 5). */
+        int *layer_id;
+                /*!< Intern ids of the layer names (group code 8). */
+        int *linetype_id;
+                /*!< Intern ids of the linetype names (group code 6). */
+        int *color;
+                /*!< Colors (group code 62). */
+        int *paperspace;
+                /*!< Paperspace flags (group code 67). */
+        double *thickness;
+                /*!< Thicknesses (group code 39). */
+        double *x0;
+                /*!< X values of the start points (group code 10). */
+        double *y0;
+                /*!< Y values of the start points (group code 20). */
+        double *z0;
+                /*!< Z values of the start points (group code 30). */
+        double *x1;
+                /*!< X values of the end points (group code 11). */
+        double *y1;
+                /*!< Y values of the end points (group code 21). */
+        double *z1;
+                /*!< Z values of the end points (group code 31). */
+        double *extr_x0;
+                /*!< X values of the extrusion vectors (group code 210). */
+        double *extr_y0;
+                /*!< Y values of the extrusion vectors (group code 220). */
+        double *extr_z0;
+                /*!< Z values of the extrusion vectors (group code 230). */
+} DxfLineColumns;
+
+
+/*!
+ * \brief Definition of a columnar store for DXF \c POINT entities.
+ *
+ * See \c DxfLineColumns.
+ */
+typedef struct
+dxf_point_columns_struct
+{
+        int number_of_rows;
+                /*!< Number of \c POINT entities in the store. */
+        int capacity;
+                /*!< Number of allocated rows. */
+        DxfIntern *intern;
+                /*!< Intern table resolving the layer and linetype ids
+                 * (not owned by the store). */
+        int *id_code;
+                /*!< Identification numbers (group code 5). */
+        int *layer_id;
+                /*!< Intern ids of the layer names (group code 8). */
+        int *linetype_id;
+                /*!< Intern ids of the linetype names (group code 6). */
+        int *color;
+                /*!< Colors (group code 62). */
+        int *paperspace;
+                /*!< Paperspace flags (group code 67). */
+        double *thickness;
+                /*!< Thicknesses (group code 39). */
+        double *x0;
+                /*!< X values (group code 10). */
+        double *y0;
+                /*!< Y values (group code 20). */
+        double *z0;
+                /*!< Z values (group code 30). */
+        double *extr_x0;
+                /*!< X values of the extrusion vectors (group code 210). */
+        double *extr_y0;
+                /*!< Y values of the extrusion vectors (group code 220). */
+        double *extr_z0;
+                /*!< Z values of the extrusion vectors (group code 230). */
+} DxfPointColumns;
+
+
+DxfLineColumns *
+dxf_line_columns_new ();
+DxfLineColumns *
+dxf_line_columns_init
+(
+        DxfLineColumns *columns,
+        DxfIntern *intern
+);
+int
+dxf_line_columns_free
+(
+        DxfLineColumns *columns
+);
+int
+dxf_line_columns_append
+(
+        DxfLineColumns *columns,
+        DxfLine *line
+);
+int
+dxf_line_columns_append_chain
+(
+        DxfLineColumns *columns,
+        DxfLine *lines
+);
+DxfLine *
+dxf_line_columns_get_line
+(
+        DxfLineColumns *columns,
+        int row
+);
+DxfLine *
+dxf_line_columns_export_chain
+(
+        DxfLineColumns *columns
+);
+int
+dxf_line_columns_read
+(
+        DxfFile *fp,
+        DxfLineColumns *columns
+);
+int
+dxf_line_columns_calculate_bounds
+(
+        DxfLineColumns *columns,
+        double *min_x,
+        double *min_y,
+        double *min_z,
+        double *max_x,
+        double *max_y,
+        double *max_z
+);
+int
+dxf_line_columns_calculate_lengths
+(
+        DxfLineColumns *columns,
+        double *lengths
+);
+double
+dxf_line_columns_calculate_total_length
+(
+        DxfLineColumns *columns
+);
+int
+dxf_line_columns_transform
+(
+        DxfLineColumns *columns,
+        double matrix[3][4]
+);
+DxfPointColumns *
+dxf_point_columns_new ();
+DxfPointColumns *
+dxf_point_columns_init
+(
+        DxfPointColumns *columns,
+        DxfIntern *intern
+);
+int
+dxf_point_columns_free
+(
+        DxfPointColumns *columns
+);
+int
+dxf_point_columns_append
+(
+        DxfPointColumns *columns,
+        DxfPoint *point
+);
+int
+dxf_point_columns_append_chain
+(
+        DxfPointColumns *columns,
+        DxfPoint *points
+);
+DxfPoint *
+dxf_point_columns_get_point
+(
+        DxfPointColumns *columns,
+        int row
+);
+DxfPoint *
+dxf_point_columns_export_chain
+(
+        DxfPointColumns *columns
+);
+int
+dxf_point_columns_read
+(
+        DxfFile *fp,
+        DxfPointColumns *columns
+);
+int
+dxf_point_columns_calculate_bounds
+(
+        DxfPointColumns *columns,
+        double *min_x,
+        double *min_y,
+        double *min_z,
+        double *max_x,
+        double *max_y,
+        double *max_z
+);
+int
+dxf_point_columns_transform
+(
+        DxfPointColumns *columns,
+        double matrix[3][4]
+);
+
+
+#endif /* LIBDXF_SRC_COLUMNS_H */
+
+
+/* EOF */
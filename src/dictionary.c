@@ -35,6 +35,8 @@
 
 
 #include "dictionary.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -166,7 +168,7 @@ dxf_dictionary_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
@@ -183,9 +185,10 @@ dxf_dictionary_read
                 dictionary = dxf_dictionary_new ();
                 dictionary = dxf_dictionary_init (dictionary);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -193,7 +196,7 @@ dxf_dictionary_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -202,9 +205,9 @@ dxf_dictionary_read
                         /* Now follows a string containing additional
                          * proprietary data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dictionary->entry_name);
+                        dictionary->entry_name = dxf_read_string (fp, dictionary->entry_name);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -230,21 +233,21 @@ dxf_dictionary_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dictionary->dictionary_owner_soft);
+                        dictionary->dictionary_owner_soft = dxf_read_string (fp, dictionary->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "350") == 0)
                 {
                         /* Now follows a string containing a handle to ae
                          * entry object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dictionary->entry_object_handle);
+                        dictionary->entry_object_handle = dxf_read_string (fp, dictionary->entry_object_handle);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dictionary->dictionary_owner_hard);
+                        dictionary->dictionary_owner_hard = dxf_read_string (fp, dictionary->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -258,10 +261,22 @@ dxf_dictionary_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
+        }
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (dictionary->id_code > 0))
+        {
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) dictionary->id_code, DICTIONARY, dictionary);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -35,6 +35,8 @@
 
 
 #include "dictionaryvar.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -166,7 +168,7 @@ dxf_dictionaryvar_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -183,9 +185,10 @@ dxf_dictionaryvar_read
                 dictionaryvar = dxf_dictionaryvar_new ();
                 dictionaryvar = dxf_dictionaryvar_init (dictionaryvar);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -193,7 +196,7 @@ dxf_dictionaryvar_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -202,9 +205,9 @@ dxf_dictionaryvar_read
                         /* Now follows a string containing additional
                          * proprietary data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dictionaryvar->value);
+                        dictionaryvar->value = dxf_read_string (fp, dictionaryvar->value);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -230,21 +233,21 @@ dxf_dictionaryvar_read
                         /* Now follows a string containing a handle to ae
                          * entry object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dictionaryvar->object_schema_number);
+                        dictionaryvar->object_schema_number = dxf_read_string (fp, dictionaryvar->object_schema_number);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dictionaryvar->dictionary_owner_soft);
+                        dictionaryvar->dictionary_owner_soft = dxf_read_string (fp, dictionaryvar->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dictionaryvar->dictionary_owner_hard);
+                        dictionaryvar->dictionary_owner_hard = dxf_read_string (fp, dictionaryvar->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -258,10 +261,16 @@ dxf_dictionaryvar_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
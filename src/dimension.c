@@ -33,6 +33,8 @@
 
 
 #include "dimension.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -214,7 +216,7 @@ dxf_dimension_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (dimension == NULL)
@@ -225,9 +227,10 @@ dxf_dimension_read
                 dimension = dxf_dimension_new ();
                 dimension = dxf_dimension_init (dimension);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -236,7 +239,7 @@ dxf_dimension_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
@@ -244,23 +247,23 @@ dxf_dimension_read
                         /* Now follows a string containing a dimension
                          * text string. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimension->dim_text);
+                        dimension->dim_text = dxf_read_string (fp, dimension->dim_text);
                 }
-                if (strcmp (temp_string, "2") == 0)
+                else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a dimension
                          * block name string. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimension->dimblock_name);
+                        dimension->dimblock_name = dxf_read_string (fp, dimension->dimblock_name);
                 }
-                if (strcmp (temp_string, "3") == 0)
+                else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a dimension
                          * style name string. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimension->dimstyle_name);
+                        dimension->dimstyle_name = dxf_read_string (fp, dimension->dimstyle_name);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -272,13 +275,13 @@ dxf_dimension_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimension->linetype);
+                        dimension->linetype = dxf_read_string (fp, dimension->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimension->layer);
+                        dimension->layer = dxf_read_string (fp, dimension->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -607,14 +610,14 @@ dxf_dimension_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimension->dictionary_owner_soft);
+                        dimension->dictionary_owner_soft = dxf_read_string (fp, dimension->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimension->dictionary_owner_hard);
+                        dimension->dictionary_owner_hard = dxf_read_string (fp, dimension->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -628,7 +631,13 @@ dxf_dimension_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dimension->linetype, "") == 0)
@@ -640,7 +649,7 @@ dxf_dimension_read
                 dimension->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -675,6 +684,7 @@ dxf_dimension_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("DIMENSION");
+        char *layer = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -696,7 +706,8 @@ dxf_dimension_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (dimension->layer, "") == 0)
+        layer = dimension->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -704,7 +715,7 @@ dxf_dimension_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                dimension->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -744,7 +755,7 @@ dxf_dimension_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", dimension->layer);
+        fprintf (fp->fp, "  8\n%s\n", layer);
         if (strcmp (dimension->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
                 fprintf (fp->fp, "  6\n%s\n", dimension->linetype);
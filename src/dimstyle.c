@@ -33,6 +33,8 @@
 
 
 #include "dimstyle.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -193,6 +195,11 @@ dxf_dimstyle_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("DIMSTYLE");
+        char *dimpost = NULL;
+        char *dimapost = NULL;
+        char *dimblk = NULL;
+        char *dimblk1 = NULL;
+        char *dimblk2 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -243,25 +250,30 @@ dxf_dimstyle_write
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dimstyle->id_code);
         }
-        if (!dimstyle->dimpost)
+        dimpost = dimstyle->dimpost;
+        if (!dimpost)
         {
-                dimstyle->dimpost = strdup ("");
+                dimpost = "";
         }
-        if (!dimstyle->dimapost)
+        dimapost = dimstyle->dimapost;
+        if (!dimapost)
         {
-                dimstyle->dimapost = strdup ("");
+                dimapost = "";
         }
-        if (!dimstyle->dimblk)
+        dimblk = dimstyle->dimblk;
+        if (!dimblk)
         {
-                dimstyle->dimblk = strdup ("");
+                dimblk = "";
         }
-        if (!dimstyle->dimblk1)
+        dimblk1 = dimstyle->dimblk1;
+        if (!dimblk1)
         {
-                dimstyle->dimblk1 = strdup ("");
+                dimblk1 = "";
         }
-        if (!dimstyle->dimblk2)
+        dimblk2 = dimstyle->dimblk2;
+        if (!dimblk2)
         {
-                dimstyle->dimblk2 = strdup ("");
+                dimblk2 = "";
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -279,19 +291,19 @@ dxf_dimstyle_write
         }
         fprintf (fp->fp, "  2\n%s\n", dimstyle->dimstyle_name);
         fprintf (fp->fp, " 70\n%d\n", dimstyle->flag);
-        fprintf (fp->fp, "  3\n%s\n", dimstyle->dimpost);
-        fprintf (fp->fp, "  4\n%s\n", dimstyle->dimapost);
+        fprintf (fp->fp, "  3\n%s\n", dimpost);
+        fprintf (fp->fp, "  4\n%s\n", dimapost);
         if (fp->acad_version_number < AutoCAD_2000)
         {
-                fprintf (fp->fp, "  5\n%s\n", dimstyle->dimblk);
+                fprintf (fp->fp, "  5\n%s\n", dimblk);
         }
         if (fp->acad_version_number < AutoCAD_2000)
         {
-                fprintf (fp->fp, "  6\n%s\n", dimstyle->dimblk1);
+                fprintf (fp->fp, "  6\n%s\n", dimblk1);
         }
         if (fp->acad_version_number < AutoCAD_2000)
         {
-                fprintf (fp->fp, "  7\n%s\n", dimstyle->dimblk2);
+                fprintf (fp->fp, "  7\n%s\n", dimblk2);
         }
         fprintf (fp->fp, " 40\n%f\n", dimstyle->dimscale);
         fprintf (fp->fp, " 41\n%f\n", dimstyle->dimasz);
@@ -395,7 +407,7 @@ dxf_dimstyle_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (dimstyle == NULL)
@@ -406,9 +418,10 @@ dxf_dimstyle_read
                 dimstyle = dxf_dimstyle_new ();
                 dimstyle = dxf_dimstyle_init (dimstyle);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -416,7 +429,7 @@ dxf_dimstyle_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -425,21 +438,21 @@ dxf_dimstyle_read
                         /* Now follows a string containing a dimension
                          * style name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimstyle->dimstyle_name);
+                        dimstyle->dimstyle_name = dxf_read_string (fp, dimstyle->dimstyle_name);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a general
                          * dimensioning suffix. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimstyle->dimpost);
+                        dimstyle->dimpost = dxf_read_string (fp, dimstyle->dimpost);
                 }
                 else if (strcmp (temp_string, "4") == 0)
                 {
                         /* Now follows a string containing an alternate
                          * dimensioning suffix. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimstyle->dimapost);
+                        dimstyle->dimapost = dxf_read_string (fp, dimstyle->dimapost);
                 }
                 else if ((fp->acad_version_number < AutoCAD_2000)
                         && (strcmp (temp_string, "5") == 0))
@@ -447,7 +460,7 @@ dxf_dimstyle_read
                         /* Now follows a string containing an arrow
                          * block name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimstyle->dimblk);
+                        dimstyle->dimblk = dxf_read_string (fp, dimstyle->dimblk);
                 }
                 else if ((fp->acad_version_number < AutoCAD_2000)
                         && (strcmp (temp_string, "6") == 0))
@@ -455,7 +468,7 @@ dxf_dimstyle_read
                         /* Now follows a string containing a first arrow
                          * block name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimstyle->dimblk1);
+                        dimstyle->dimblk1 = dxf_read_string (fp, dimstyle->dimblk1);
                 }
 #if 0
 /*!
@@ -477,7 +490,7 @@ dxf_dimstyle_read
                         /* Now follows a string containing a first arrow
                          * block name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimstyle->dimblk2);
+                        dimstyle->dimblk2 = dxf_read_string (fp, dimstyle->dimblk2);
                 }
 #if 0
 /*!
@@ -877,8 +890,11 @@ dxf_dimstyle_read
                         /* Now follows a string containing dimension
                          * text style. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimstyle->dimtxsty);
+                        dimstyle->dimtxsty = dxf_read_string (fp, dimstyle->dimtxsty);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dimstyle->dimstyle_name, "") == 0)
@@ -887,11 +903,11 @@ dxf_dimstyle_read
                   (_("Error in %s () dimstyle_name value is empty.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -166,6 +166,8 @@ dxf_donut_write
         double start_width;
         double end_width;
         int id_code = -1;
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -197,7 +199,8 @@ dxf_donut_write
         }
         start_width = 0.5 * (donut->outside_diameter - donut->inside_diameter);
         end_width = 0.5 * (donut->outside_diameter - donut->inside_diameter);
-        if (strcmp (donut->linetype, "") == 0)
+        linetype = donut->linetype;
+        if (strcmp (linetype, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -205,9 +208,10 @@ dxf_donut_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                donut->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = DXF_DEFAULT_LINETYPE;
         }
-        if (strcmp (donut->layer, "") == 0)
+        layer = donut->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -215,7 +219,7 @@ dxf_donut_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                donut->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = DXF_DEFAULT_LAYER;
         }
         /* Create and write a polyline primitive. */
         dxf_polyline_new (polyline);
@@ -223,8 +227,8 @@ dxf_donut_write
         id_code = fp->last_id_code;
         id_code++;
         polyline->id_code = id_code;
-        polyline->linetype = donut->linetype;
-        polyline->layer = donut->layer;
+        polyline->linetype = linetype;
+        polyline->layer = layer;
         polyline->x0 = donut->x0;
         polyline->y0 = donut->y0;
         polyline->z0 = donut->z0;
@@ -248,8 +252,8 @@ dxf_donut_write
         id_code = fp->last_id_code;
         id_code++;
         vertex_1->id_code = id_code;
-        vertex_1->layer = donut->layer;
-        vertex_1->linetype = donut->linetype;
+        vertex_1->layer = layer;
+        vertex_1->linetype = linetype;
         vertex_1->x0 = donut->x0 - (0.25 * (donut->outside_diameter + donut->inside_diameter));
         vertex_1->y0 = donut->y0;
         vertex_1->z0 = donut->z0;
@@ -269,8 +273,8 @@ dxf_donut_write
         id_code = fp->last_id_code;
         id_code++;
         vertex_2->id_code = id_code;
-        vertex_2->layer = donut->layer;
-        vertex_2->linetype = donut->linetype;
+        vertex_2->layer = layer;
+        vertex_2->linetype = linetype;
         vertex_2->x0 = donut->x0 + (0.25 * (donut->outside_diameter + donut->inside_diameter));
         vertex_2->y0 = donut->y0;
         vertex_2->z0 = donut->z0;
@@ -290,8 +294,8 @@ dxf_donut_write
         id_code = fp->last_id_code;
         id_code++;
         seqend->id_code = id_code;
-        seqend->layer = donut->layer;
-        seqend->linetype = donut->linetype;
+        seqend->layer = layer;
+        seqend->linetype = linetype;
         dxf_seqend_write (fp, seqend);
         /*! \todo Hook up this seqend to the list of seqends. */
         /* Clean up. */
@@ -33,6 +33,7 @@
 
 
 #include "drawing.h"
+#include "layer_index.h"
 
 
 /*!
@@ -106,12 +107,18 @@ dxf_drawing_init
                   __FUNCTION__);
                 return (NULL);
         }
-        dxf_header_init ((DxfHeader *) drawing->header, acad_version_number);
-        dxf_class_init ((DxfClass *) drawing->class_list);
-        dxf_block_init ((DxfBlock *) drawing->block_list);
-        //dxf_entities_init ((DxfEntities *) drawing->entities_list);
-        dxf_object_init ((DxfObject *) drawing->object_list);
-        dxf_thumbnail_init ((DxfThumbnail *) drawing->thumbnail);
+        drawing->header = (struct DxfHeader *) dxf_header_init (dxf_header_new (), acad_version_number);
+        if (drawing->header == NULL)
+        {
+                free (drawing);
+                return (NULL);
+        }
+        /* The other sections are created when they are read or set. */
+        drawing->intern = (struct DxfIntern *) dxf_intern_init (dxf_intern_new ());
+        drawing->handle_table = (struct DxfHandleTable *) dxf_handle_table_init (dxf_handle_table_new ());
+        drawing->entities = (struct DxfChunkList *) dxf_chunk_list_init (dxf_chunk_list_new (),
+          sizeof (DxfDrawingEntity), 0);
+        dxf_drawing_sync_handle_seed (drawing);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -123,6 +130,11 @@ dxf_drawing_init
  * \brief Free the allocated memory for a libDXF drawing and all it's
  * data fields.
  *
+ * Sections shared with a frozen base drawing are left alone.\n
+ * The entities read from a file are freed with the drawing, entities
+ * appended by the caller are not.\n
+ * A frozen drawing is released with \c dxf_drawing_unref() instead.
+ *
  * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
  * occurred.
  */
@@ -137,12 +149,92 @@ dxf_drawing_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        dxf_header_free ((DxfHeader *) drawing->header);
-        dxf_class_free_chain ((DxfClass *) drawing->class_list);
-        dxf_block_free_chain ((DxfBlock *) drawing->block_list);
+        DxfDrawingEntity *entry = NULL;
+        int i;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen, use dxf_drawing_unref ().\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* Shared sections belong to the base drawing. */
+        if ((drawing->header != NULL)
+          && (!(drawing->shared_sections & DXF_DRAWING_SECTION_HEADER)))
+        {
+                dxf_header_free ((DxfHeader *) drawing->header);
+        }
+        if ((drawing->class_list != NULL)
+          && (!(drawing->shared_sections & DXF_DRAWING_SECTION_CLASSES)))
+        {
+                dxf_class_free_chain ((DxfClass *) drawing->class_list);
+        }
+        if ((drawing->block_list != NULL)
+          && (!(drawing->shared_sections & DXF_DRAWING_SECTION_BLOCKS)))
+        {
+                dxf_block_free_chain ((DxfBlock *) drawing->block_list);
+        }
         //dxf_entities_free_chain ((DxfEntities *) drawing->entities_list);
-        dxf_object_free_chain ((DxfObject *) drawing->object_list);
-        dxf_thumbnail_free ((DxfThumbnail *) drawing->thumbnail);
+        if ((drawing->object_list != NULL)
+          && (!(drawing->shared_sections & DXF_DRAWING_SECTION_OBJECTS)))
+        {
+                dxf_object_free_chain ((DxfObject *) drawing->object_list);
+        }
+        if ((drawing->thumbnail != NULL)
+          && (!(drawing->shared_sections & DXF_DRAWING_SECTION_THUMBNAIL)))
+        {
+                dxf_thumbnail_free ((DxfThumbnail *) drawing->thumbnail);
+        }
+        if ((drawing->handle_table != NULL)
+          && (!(drawing->shared_sections & DXF_DRAWING_SECTION_HANDLE_TABLE)))
+        {
+                dxf_handle_table_free ((DxfHandleTable *) drawing->handle_table);
+        }
+        if ((drawing->entities != NULL)
+          && (!(drawing->shared_sections & DXF_DRAWING_SECTION_ENTITIES)))
+        {
+                for (i = 0; i < drawing->number_of_owned_entities; i++)
+                {
+                        entry = (DxfDrawingEntity *) dxf_chunk_list_get ((DxfChunkList *) drawing->entities, i);
+                        dxf_entity_free (entry->type, entry->entity);
+                }
+                dxf_chunk_list_free ((DxfChunkList *) drawing->entities);
+        }
+        if (drawing->layer_map != NULL)
+        {
+                dxf_layer_index_map_free ((DxfLayerIndexMap *) drawing->layer_map);
+        }
+        if (!(drawing->shared_sections & DXF_DRAWING_SECTION_COLUMNS))
+        {
+                if (drawing->line_columns != NULL)
+                {
+                        dxf_line_columns_free (drawing->line_columns);
+                }
+                if (drawing->point_columns != NULL)
+                {
+                        dxf_point_columns_free (drawing->point_columns);
+                }
+        }
+        /* Interned strings are shared by the entities, free them
+         * last. */
+        if ((drawing->intern != NULL)
+          && (!(drawing->shared_sections & DXF_DRAWING_SECTION_INTERN)))
+        {
+                dxf_intern_free ((DxfIntern *) drawing->intern);
+        }
+        if (drawing->base != NULL)
+        {
+                dxf_drawing_unref ((DxfDrawing *) drawing->base);
+        }
         free (drawing);
         drawing = NULL;
 #if DEBUG
@@ -152,9 +244,38 @@ dxf_drawing_free
 }
 
 
+/*!
+ * \brief Test if a section of a libDXF drawing is shared with the base
+ * drawing of a copy-on-write drawing, and can not be modified.
+ *
+ * Shared sections of a frozen drawing are read only as the whole
+ * drawing is.
+ *
+ * \return \c TRUE when the section is shared and the drawing is not
+ * frozen, \c FALSE otherwise.
+ */
+static int
+dxf_drawing_is_shared
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        int section
+                /*!< a \c DXF_DRAWING_SECTION_* value. */
+)
+{
+        return ((!drawing->frozen) && (drawing->shared_sections & section));
+}
+
+
 /*!
  * \brief Get the header from a libDXF drawing.
  *
+ * A header shared with the base drawing of a copy-on-write drawing is
+ * copied first, so it can be modified.
+ *
+ * Refused for a frozen drawing, read its header with
+ * \c dxf_drawing_get_const_header().
+ *
  * \return \c header when successful, \c NULL when an error occurred.
  */
 DxfHeader *
@@ -177,6 +298,13 @@ dxf_drawing_get_header
                   __FUNCTION__);
                 return (NULL);
         }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         if (drawing->header ==  NULL)
         {
                 fprintf (stderr,
@@ -184,6 +312,11 @@ dxf_drawing_get_header
                   __FUNCTION__);
                 return (NULL);
         }
+        if ((dxf_drawing_is_shared (drawing, DXF_DRAWING_SECTION_HEADER))
+          && (dxf_drawing_unshare (drawing, DXF_DRAWING_SECTION_HEADER) == EXIT_FAILURE))
+        {
+                return (NULL);
+        }
         result = (DxfHeader *) drawing->header;
 #if DEBUG
         DXF_DEBUG_END
@@ -226,7 +359,16 @@ dxf_drawing_set_header
                   __FUNCTION__);
                 return (NULL);
         }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        drawing->shared_sections &= ~DXF_DRAWING_SECTION_HEADER;
         drawing->header = (struct DxfHeader *) header;
+        dxf_drawing_sync_handle_seed (drawing);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -237,6 +379,12 @@ dxf_drawing_set_header
 /*!
  * \brief Get the first entry to the Classes list from a libDXF drawing.
  *
+ * A list shared with the base drawing of a copy-on-write drawing is
+ * read only and is not returned, get it from the base drawing or
+ * replace it with \c dxf_drawing_set_class_list().
+ *
+ * Refused for a frozen drawing.
+ *
  * \return \c class_list when sucessful, \c NULL when an error occurred.
  */
 DxfClass *
@@ -259,6 +407,13 @@ dxf_drawing_get_class_list
                   __FUNCTION__);
                 return (NULL);
         }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         if (drawing->class_list ==  NULL)
         {
                 fprintf (stderr,
@@ -266,6 +421,13 @@ dxf_drawing_get_class_list
                   __FUNCTION__);
                 return (NULL);
         }
+        if (dxf_drawing_is_shared (drawing, DXF_DRAWING_SECTION_CLASSES))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the class_list member is shared with the base drawing and read only.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         result = (DxfClass *) drawing->class_list;
 #if DEBUG
         DXF_DEBUG_END
@@ -308,6 +470,14 @@ dxf_drawing_set_class_list
                   __FUNCTION__);
                 return (NULL);
         }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        drawing->shared_sections &= ~DXF_DRAWING_SECTION_CLASSES;
         drawing->class_list = (struct DxfClass *) class_list;
 #if DEBUG
         DXF_DEBUG_END
@@ -319,6 +489,12 @@ dxf_drawing_set_class_list
 /*!
  * \brief Get the first entry to the Tables list from a libDXF drawing.
  *
+ * A list shared with the base drawing of a copy-on-write drawing is
+ * read only and is not returned, get it from the base drawing or
+ * replace it with \c dxf_drawing_set_tables_list().
+ *
+ * Refused for a frozen drawing.
+ *
  * \return \c tables_list when sucessful, \c NULL when an error occurred.
  */
 DxfTables *
@@ -341,6 +517,13 @@ dxf_drawing_get_tables_list
                   __FUNCTION__);
                 return (NULL);
         }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         if (drawing->tables_list ==  NULL)
         {
                 fprintf (stderr,
@@ -348,6 +531,13 @@ dxf_drawing_get_tables_list
                   __FUNCTION__);
                 return (NULL);
         }
+        if (dxf_drawing_is_shared (drawing, DXF_DRAWING_SECTION_TABLES))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the tables_list member is shared with the base drawing and read only.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         result = (DxfTables *) drawing->tables_list;
 #if DEBUG
         DXF_DEBUG_END
@@ -390,7 +580,21 @@ dxf_drawing_set_tables_list
                   __FUNCTION__);
                 return (NULL);
         }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        drawing->shared_sections &= ~DXF_DRAWING_SECTION_TABLES;
         drawing->tables_list = (struct DxfTables *) tables_list;
+        if ((drawing->layer_map != NULL)
+          && (dxf_layer_index_map_set_layers ((DxfLayerIndexMap *) drawing->layer_map,
+          (DxfLayer *) tables_list->layers) == EXIT_FAILURE))
+        {
+                return (NULL);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -401,6 +605,12 @@ dxf_drawing_set_tables_list
 /*!
  * \brief Get the first entry to the Block list from a libDXF drawing.
  *
+ * A list shared with the base drawing of a copy-on-write drawing is
+ * read only and is not returned, get it from the base drawing or
+ * replace it with \c dxf_drawing_set_block_list().
+ *
+ * Refused for a frozen drawing.
+ *
  * \return \c block_list when sucessful, \c NULL when an error occurred.
  */
 DxfBlock *
@@ -423,6 +633,13 @@ dxf_drawing_get_block_list
                   __FUNCTION__);
                 return (NULL);
         }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         if (drawing->block_list ==  NULL)
         {
                 fprintf (stderr,
@@ -430,6 +647,13 @@ dxf_drawing_get_block_list
                   __FUNCTION__);
                 return (NULL);
         }
+        if (dxf_drawing_is_shared (drawing, DXF_DRAWING_SECTION_BLOCKS))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the block_list member is shared with the base drawing and read only.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         result = (DxfBlock *) drawing->block_list;
 #if DEBUG
         DXF_DEBUG_END
@@ -472,6 +696,14 @@ dxf_drawing_set_block_list
                   __FUNCTION__);
                 return (NULL);
         }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        drawing->shared_sections &= ~DXF_DRAWING_SECTION_BLOCKS;
         drawing->block_list = (struct DxfBlock *) block_list;
 #if DEBUG
         DXF_DEBUG_END
@@ -483,6 +715,12 @@ dxf_drawing_set_block_list
 /*!
  * \brief Get the first entry to the Entities list from a libDXF drawing.
  *
+ * A list shared with the base drawing of a copy-on-write drawing is
+ * read only and is not returned, get it from the base drawing or
+ * replace it with \c dxf_drawing_set_entities_list().
+ *
+ * Refused for a frozen drawing.
+ *
  * \return \c entities_list when sucessful, \c NULL when an error
  * occurred.
  */
@@ -506,6 +744,13 @@ dxf_drawing_get_entities_list
                   __FUNCTION__);
                 return (NULL);
         }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         if (drawing->entities_list ==  NULL)
         {
                 fprintf (stderr,
@@ -513,6 +758,13 @@ dxf_drawing_get_entities_list
                   __FUNCTION__);
                 return (NULL);
         }
+        if (dxf_drawing_is_shared (drawing, DXF_DRAWING_SECTION_ENTITIES_LIST))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the entities_list member is shared with the base drawing and read only.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         result = (DxfEntities *) drawing->entities_list;
 #if DEBUG
         DXF_DEBUG_END
@@ -555,6 +807,14 @@ dxf_drawing_set_entities_list
                   __FUNCTION__);
                 return (NULL);
         }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        drawing->shared_sections &= ~DXF_DRAWING_SECTION_ENTITIES_LIST;
         drawing->entities_list = (struct DxfEntities *) entities_list;
 #if DEBUG
         DXF_DEBUG_END
@@ -566,6 +826,12 @@ dxf_drawing_set_entities_list
 /*!
  * \brief Get the first entry to the Object list from a libDXF drawing.
  *
+ * A list shared with the base drawing of a copy-on-write drawing is
+ * read only and is not returned, get it from the base drawing or
+ * replace it with \c dxf_drawing_set_object_list().
+ *
+ * Refused for a frozen drawing.
+ *
  * \return \c object_list when sucessful, \c NULL when an error
  * occurred.
  */
@@ -589,6 +855,13 @@ dxf_drawing_get_object_list
                   __FUNCTION__);
                 return (NULL);
         }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         if (drawing->object_list ==  NULL)
         {
                 fprintf (stderr,
@@ -596,6 +869,13 @@ dxf_drawing_get_object_list
                   __FUNCTION__);
                 return (NULL);
         }
+        if (dxf_drawing_is_shared (drawing, DXF_DRAWING_SECTION_OBJECTS))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the object_list member is shared with the base drawing and read only.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         result = (DxfObject *) drawing->object_list;
 #if DEBUG
         DXF_DEBUG_END
@@ -638,6 +918,14 @@ dxf_drawing_set_object_list
                   __FUNCTION__);
                 return (NULL);
         }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        drawing->shared_sections &= ~DXF_DRAWING_SECTION_OBJECTS;
         drawing->object_list = (struct DxfObject *) object_list;
 #if DEBUG
         DXF_DEBUG_END
@@ -649,6 +937,12 @@ dxf_drawing_set_object_list
 /*!
  * \brief Get the thumbnail from a libDXF drawing.
  *
+ * A thumbnail shared with the base drawing of a copy-on-write drawing is
+ * read only and is not returned, get it from the base drawing or
+ * replace it with \c dxf_drawing_set_thumbnail().
+ *
+ * Refused for a frozen drawing.
+ *
  * \return \c thumbnail when sucessful, \c NULL when an error occurred.
  */
 DxfThumbnail *
@@ -671,6 +965,13 @@ dxf_drawing_get_thumbnail
                   __FUNCTION__);
                 return (NULL);
         }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         if (drawing->thumbnail ==  NULL)
         {
                 fprintf (stderr,
@@ -678,6 +979,13 @@ dxf_drawing_get_thumbnail
                   __FUNCTION__);
                 return (NULL);
         }
+        if (dxf_drawing_is_shared (drawing, DXF_DRAWING_SECTION_THUMBNAIL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the thumbnail member is shared with the base drawing and read only.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
         result = (DxfThumbnail *) drawing->thumbnail;
 #if DEBUG
         DXF_DEBUG_END
@@ -720,6 +1028,14 @@ dxf_drawing_set_thumbnail
                   __FUNCTION__);
                 return (NULL);
         }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        drawing->shared_sections &= ~DXF_DRAWING_SECTION_THUMBNAIL;
         drawing->thumbnail = (struct DxfThumbnail *) thumbnail;
 #if DEBUG
         DXF_DEBUG_END
@@ -728,4 +1044,1273 @@ dxf_drawing_set_thumbnail
 }
 
 
+/*!
+ * \brief Get the intern table from a libDXF drawing.
+ *
+ * Refused for a frozen drawing.
+ *
+ * \return \c intern when sucessful, \c NULL when an error occurred.
+ */
+DxfIntern *
+dxf_drawing_get_intern
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfIntern *result = NULL;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->intern ==  NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found in the intern member.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        result = (DxfIntern *) drawing->intern;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Set the intern table for a libDXF drawing.
+ *
+ * \warning The previous intern table is not freed, entities may still
+ * refer to strings owned by it.
+ *
+ * \return a pointer to the libDXF drawing when OK, \c NULL when an
+ * error occurred.
+ */
+DxfDrawing *
+dxf_drawing_set_intern
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        DxfIntern *intern
+                /*!< a pointer to the intern table for the libDXF
+                 * drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (intern == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        drawing->shared_sections &= ~DXF_DRAWING_SECTION_INTERN;
+        drawing->intern = (struct DxfIntern *) intern;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (drawing);
+}
+
+
+/*!
+ * \brief Get the handle table from a libDXF drawing.
+ *
+ * A handle table shared with the base drawing of a copy-on-write
+ * drawing is copied first, so it can be modified.
+ *
+ * Refused for a frozen drawing.
+ *
+ * \return \c handle_table when sucessful, \c NULL when an error
+ * occurred.
+ */
+DxfHandleTable *
+dxf_drawing_get_handle_table
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHandleTable *result = NULL;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->handle_table ==  NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found in the handle_table member.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((dxf_drawing_is_shared (drawing, DXF_DRAWING_SECTION_HANDLE_TABLE))
+          && (dxf_drawing_unshare (drawing, DXF_DRAWING_SECTION_HANDLE_TABLE) == EXIT_FAILURE))
+        {
+                return (NULL);
+        }
+        result = (DxfHandleTable *) drawing->handle_table;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Set the handle table for a libDXF drawing.
+ *
+ * \return a pointer to the libDXF drawing when OK, \c NULL when an
+ * error occurred.
+ */
+DxfDrawing *
+dxf_drawing_set_handle_table
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        DxfHandleTable *handle_table
+                /*!< a pointer to the handle table for the libDXF
+                 * drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (handle_table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        drawing->shared_sections &= ~DXF_DRAWING_SECTION_HANDLE_TABLE;
+        drawing->handle_table = (struct DxfHandleTable *) handle_table;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (drawing);
+}
+
+
+
+/*!
+ * \brief Append an entity to the entities container of a libDXF
+ * drawing.
+ *
+ * The container keeps the entities in the order they were appended
+ * (file order for a drawing being read), appending is O(1).\n
+ * The entity itself is not copied.\n
+ * The layer index map of the drawing (when built, see
+ * \c dxf_drawing_get_layer_map()) is updated as well.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_append_entity
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        int type,
+                /*!< type of the entity, a \c DxfEntityType value. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDrawingEntity entry;
+
+        /* Do some basic checks. */
+        if ((drawing == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((drawing->shared_sections & DXF_DRAWING_SECTION_ENTITIES)
+          && (dxf_drawing_unshare (drawing, DXF_DRAWING_SECTION_ENTITIES) == EXIT_FAILURE))
+        {
+                return (EXIT_FAILURE);
+        }
+        if (drawing->entities == NULL)
+        {
+                drawing->entities = (struct DxfChunkList *) dxf_chunk_list_init (dxf_chunk_list_new (),
+                  sizeof (DxfDrawingEntity), 0);
+                if (drawing->entities == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        entry.type = type;
+        entry.entity = entity;
+        if (dxf_chunk_list_append ((DxfChunkList *) drawing->entities, &entry) == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((drawing->layer_map != NULL)
+          && (dxf_layer_index_map_add_entity ((DxfLayerIndexMap *) drawing->layer_map,
+          type, entity) == EXIT_FAILURE))
+        {
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of entities in the entities container of a
+ * libDXF drawing.
+ *
+ * \return the number of entities, or -1 when an error occurred.
+ */
+int
+dxf_drawing_get_number_of_entities
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (drawing->entities == NULL)
+        {
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_chunk_list_get_number_of_entries ((DxfChunkList *) drawing->entities));
+}
+
+
+/*!
+ * \brief Get the entities container from a libDXF drawing.
+ *
+ * Iterate the \c DxfDrawingEntity entries with
+ * \c dxf_chunk_list_iter_init() and \c dxf_chunk_list_iter_next().\n
+ * A container shared with the base drawing of a copy-on-write drawing
+ * is copied first, so it can be modified.
+ *
+ * Refused for a frozen drawing, iterate its entities with
+ * \c dxf_drawing_entities_iter_init().
+ *
+ * \return \c entities when sucessful, \c NULL when an error occurred.
+ */
+DxfChunkList *
+dxf_drawing_get_entities
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((dxf_drawing_is_shared (drawing, DXF_DRAWING_SECTION_ENTITIES))
+          && (dxf_drawing_unshare (drawing, DXF_DRAWING_SECTION_ENTITIES) == EXIT_FAILURE))
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((DxfChunkList *) drawing->entities);
+}
+
+
+/*!
+ * \brief Get the header from a libDXF drawing for reading only.
+ *
+ * Unlike \c dxf_drawing_get_header() this works on a frozen drawing,
+ * and a header shared with a base drawing is not copied.
+ *
+ * \return \c header when successful, \c NULL when an error occurred.
+ */
+const DxfHeader *
+dxf_drawing_get_const_header
+(
+        const DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->header ==  NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found in the header member.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((const DxfHeader *) drawing->header);
+}
+
+
+/*!
+ * \brief Initialize an iterator over the entities of a libDXF drawing
+ * for reading only.
+ *
+ * Unlike \c dxf_drawing_get_entities() this works on a frozen
+ * drawing, get the \c DxfDrawingEntity entries with
+ * \c dxf_chunk_list_iter_next().\n
+ * The entities must not be modified through the iterator.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_entities_iter_init
+(
+        const DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        DxfChunkListIter *iter
+                /*!< a pointer to the iterator to initialize. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((drawing == NULL) || (iter == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        iter->list = (DxfChunkList *) drawing->entities;
+        iter->block = (drawing->entities == NULL) ? NULL : ((DxfChunkList *) drawing->entities)->first;
+        iter->index = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the layer index map of a libDXF drawing.
+ *
+ * The map is built on the first call, and kept up to date by
+ * \c dxf_drawing_append_entity() and \c dxf_drawing_set_tables_list()
+ * from then on.\n
+ * Get the map before freezing a drawing, a frozen drawing is not
+ * modified.
+ *
+ * \return a pointer to the map (owned by the drawing), or \c NULL when
+ * an error occurred.
+ */
+DxfLayerIndexMap *
+dxf_drawing_get_layer_map
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLayerIndexMap *map = NULL;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->layer_map != NULL)
+        {
+                return ((DxfLayerIndexMap *) drawing->layer_map);
+        }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        map = dxf_layer_index_map_init (dxf_layer_index_map_new (),
+          (DxfIntern *) drawing->intern);
+        if (map == NULL)
+        {
+                return (NULL);
+        }
+        if (dxf_layer_index_map_build (map, drawing) != EXIT_SUCCESS)
+        {
+                dxf_layer_index_map_free (map);
+                return (NULL);
+        }
+        drawing->layer_map = (struct DxfLayerIndexMap *) map;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (map);
+}
+
+
+/*!
+ * \brief Let a libDXF drawing read the \c LINE and \c POINT entities
+ * into columnar stores.
+ *
+ * Once enabled, \c dxf_entities_read_table() reads the \c LINE and
+ * \c POINT entities of the \c ENTITIES section straight into
+ * \c line_columns and \c point_columns instead of the \c entities
+ * container, no \c DxfLine or \c DxfPoint structs are allocated.\n
+ * The stores resolve their layer and linetype ids in the intern table
+ * of the drawing.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_enable_columns
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (drawing->frozen
+          || (drawing->shared_sections & DXF_DRAWING_SECTION_COLUMNS))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen or shares its stores.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (drawing->line_columns == NULL)
+        {
+                drawing->line_columns = dxf_line_columns_init (dxf_line_columns_new (),
+                  (DxfIntern *) drawing->intern);
+        }
+        if (drawing->point_columns == NULL)
+        {
+                drawing->point_columns = dxf_point_columns_init (dxf_point_columns_new (),
+                  (DxfIntern *) drawing->intern);
+        }
+        if ((drawing->line_columns == NULL)
+          || (drawing->point_columns == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the columnar store of the \c LINE entities from a libDXF
+ * drawing.
+ *
+ * Refused for a frozen drawing.
+ *
+ * \return \c line_columns, \c NULL when the stores are not enabled or
+ * an error occurred.
+ */
+DxfLineColumns *
+dxf_drawing_get_line_columns
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (drawing->line_columns);
+}
+
+
+/*!
+ * \brief Get the columnar store of the \c POINT entities from a
+ * libDXF drawing.
+ *
+ * Refused for a frozen drawing.
+ *
+ * \return \c point_columns, \c NULL when the stores are not enabled or
+ * an error occurred.
+ */
+DxfPointColumns *
+dxf_drawing_get_point_columns
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (drawing->point_columns);
+}
+
+
+/*!
+ * \brief Freeze a libDXF drawing into an immutable snapshot.
+ *
+ * A frozen drawing is never modified again, so any number of threads
+ * can read it without locks.\n
+ * The caller owns the first reference, each thread or request that
+ * keeps the drawing takes its own reference with \c dxf_drawing_ref()
+ * and releases it with \c dxf_drawing_unref(), the last release frees
+ * the drawing.\n
+ * The getters of the modifiable sections (\c dxf_drawing_get_header(),
+ * \c dxf_drawing_get_entities(), ...) refuse a frozen drawing, read it
+ * with \c dxf_drawing_get_const_header() and
+ * \c dxf_drawing_entities_iter_init(), or write it with
+ * \c dxf_file_write() or \c dxf_file_write_parallel(), the writers do
+ * not modify the entities.\n
+ * Use \c dxf_drawing_copy_on_write() to make a modified version.
+ *
+ * \return a pointer to the frozen drawing, or \c NULL when an error
+ * occurred.
+ */
+DxfDrawing *
+dxf_drawing_freeze
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () the drawing is already frozen.\n")),
+                  __FUNCTION__);
+                return (drawing);
+        }
+        drawing->reference_count = 1;
+        /* Publish the contents of the drawing to the threads that
+         * see it frozen. */
+        __atomic_store_n (&drawing->frozen, TRUE, __ATOMIC_RELEASE);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (drawing);
+}
+
+
+/*!
+ * \brief Test if a libDXF drawing is frozen.
+ *
+ * \return \c TRUE when the drawing is frozen, \c FALSE when it is not
+ * or when an error occurred.
+ */
+int
+dxf_drawing_is_frozen
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (FALSE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (__atomic_load_n (&drawing->frozen, __ATOMIC_ACQUIRE));
+}
+
+
+/*!
+ * \brief Take a reference to a frozen libDXF drawing.
+ *
+ * Safe to call from any thread holding a reference.
+ *
+ * \return a pointer to the drawing, or \c NULL when an error occurred.
+ */
+DxfDrawing *
+dxf_drawing_ref
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a frozen libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (!dxf_drawing_is_frozen (drawing))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is not frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        __atomic_add_fetch (&drawing->reference_count, 1, __ATOMIC_RELAXED);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (drawing);
+}
+
+
+/*!
+ * \brief Release a reference to a frozen libDXF drawing.
+ *
+ * The drawing is freed when the last reference is released.\n
+ * Safe to call from any thread holding a reference.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_unref
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a frozen libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (!dxf_drawing_is_frozen (drawing))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is not frozen.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (__atomic_sub_fetch (&drawing->reference_count, 1, __ATOMIC_ACQ_REL) > 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        /* Last reference, nobody else can see the drawing. */
+        drawing->frozen = FALSE;
+        dxf_drawing_free (drawing);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Make a modifiable copy-on-write version of a frozen libDXF
+ * drawing.
+ *
+ * The new drawing shares all sections with \c drawing, except for the
+ * intern table which is new and empty, and holds a reference to
+ * \c drawing until it is freed.\n
+ * The header, the handle table and the entities container are copied
+ * when they are modified: \c dxf_drawing_get_header(),
+ * \c dxf_drawing_get_handle_table() and \c dxf_drawing_get_entities()
+ * copy them on the first call, and \c dxf_drawing_append_entity() on
+ * the first append (or copy them with \c dxf_drawing_unshare()).\n
+ * The other shared sections (classes, tables, blocks, entities list,
+ * objects and thumbnail) are read only, their getters refuse them:
+ * read them from \c drawing and replace them with the
+ * \c dxf_drawing_set_*() functions.\n
+ * The new drawing can be frozen in turn.
+ *
+ * \return a pointer to the new drawing, or \c NULL when an error
+ * occurred.
+ */
+DxfDrawing *
+dxf_drawing_copy_on_write
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a frozen libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDrawing *copy = NULL;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (!dxf_drawing_is_frozen (drawing))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is not frozen.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_drawing_new ();
+        if (copy == NULL)
+        {
+                return (NULL);
+        }
+        copy->intern = (struct DxfIntern *) dxf_intern_init (dxf_intern_new ());
+        if (copy->intern == NULL)
+        {
+                free (copy);
+                return (NULL);
+        }
+        copy->header = drawing->header;
+        copy->class_list = drawing->class_list;
+        copy->tables_list = drawing->tables_list;
+        copy->block_list = drawing->block_list;
+        copy->entities_list = drawing->entities_list;
+        copy->object_list = drawing->object_list;
+        copy->thumbnail = drawing->thumbnail;
+        copy->handle_table = drawing->handle_table;
+        copy->entities = drawing->entities;
+        /* The stores keep resolving their ids in the intern table of
+         * the base drawing. */
+        copy->line_columns = drawing->line_columns;
+        copy->point_columns = drawing->point_columns;
+        copy->shared_sections = DXF_DRAWING_SECTION_HEADER
+          | DXF_DRAWING_SECTION_CLASSES
+          | DXF_DRAWING_SECTION_TABLES
+          | DXF_DRAWING_SECTION_BLOCKS
+          | DXF_DRAWING_SECTION_ENTITIES_LIST
+          | DXF_DRAWING_SECTION_OBJECTS
+          | DXF_DRAWING_SECTION_THUMBNAIL
+          | DXF_DRAWING_SECTION_HANDLE_TABLE
+          | DXF_DRAWING_SECTION_ENTITIES
+          | DXF_DRAWING_SECTION_COLUMNS;
+        copy->base = (struct DxfDrawing *) dxf_drawing_ref (drawing);
+        copy->handle_seed = drawing->handle_seed;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
+/*!
+ * \brief Copy a section shared with the base drawing into a
+ * copy-on-write libDXF drawing.
+ *
+ * Only the header, the handle table and the entities container can be
+ * copied, the entities themselves stay shared (replace them in the
+ * container instead of modifying them).\n
+ * Other shared sections are read only, they are replaced with the
+ * \c dxf_drawing_set_*() functions.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_unshare
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        int section
+                /*!< a \c DXF_DRAWING_SECTION_* value. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (drawing->frozen)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (!(drawing->shared_sections & section))
+        {
+                /* Nothing to do. */
+                return (EXIT_SUCCESS);
+        }
+        switch (section)
+        {
+                case DXF_DRAWING_SECTION_HEADER:
+                        if (drawing->header != NULL)
+                        {
+                                drawing->header = (struct DxfHeader *) dxf_header_copy ((DxfHeader *) drawing->header);
+                                if (drawing->header == NULL)
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                        }
+                        break;
+                case DXF_DRAWING_SECTION_HANDLE_TABLE:
+                        if (drawing->handle_table != NULL)
+                        {
+                                drawing->handle_table = (struct DxfHandleTable *) dxf_handle_table_copy ((DxfHandleTable *) drawing->handle_table);
+                                if (drawing->handle_table == NULL)
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                        }
+                        break;
+                case DXF_DRAWING_SECTION_ENTITIES:
+                        if (drawing->entities != NULL)
+                        {
+                                drawing->entities = (struct DxfChunkList *) dxf_chunk_list_copy ((DxfChunkList *) drawing->entities);
+                                if (drawing->entities == NULL)
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                        }
+                        break;
+                case DXF_DRAWING_SECTION_CLASSES:
+                case DXF_DRAWING_SECTION_TABLES:
+                case DXF_DRAWING_SECTION_BLOCKS:
+                case DXF_DRAWING_SECTION_ENTITIES_LIST:
+                case DXF_DRAWING_SECTION_OBJECTS:
+                case DXF_DRAWING_SECTION_THUMBNAIL:
+                case DXF_DRAWING_SECTION_COLUMNS:
+                        fprintf (stderr,
+                          (_("Error in %s () the section is read only, replace it instead.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                default:
+                        fprintf (stderr,
+                          (_("Error in %s () received an invalid value in section.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+        }
+        drawing->shared_sections &= ~section;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the next unused handle of a libDXF drawing.
+ *
+ * \return the next unused handle, or 0 when an error occurred.
+ */
+uint64_t
+dxf_drawing_get_handle_seed
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (__atomic_load_n (&drawing->handle_seed, __ATOMIC_RELAXED));
+}
+
+
+/*!
+ * \brief Advance the next unused handle of a libDXF drawing past the
+ * handles in use.
+ *
+ * The next unused handle is at least the \c $HANDSEED value of the
+ * header and one past the largest handle in the handle table or in the
+ * columnar stores, as \c $HANDSEED may be missing or too low in a file.\n
+ * Called when a file was read or the header was replaced, handles
+ * already reserved stay reserved.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_sync_handle_seed
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHeader *header = NULL;
+        uint64_t handle_seed = 1;
+        uint64_t max_handle = 0;
+        uint64_t current;
+        int i;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_drawing_is_frozen (drawing))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        header = (DxfHeader *) drawing->header;
+        if ((header != NULL) && (header->HandSeed != NULL))
+        {
+                handle_seed = dxf_handle_table_parse_handle (header->HandSeed);
+        }
+        if (drawing->handle_table != NULL)
+        {
+                max_handle = dxf_handle_table_get_max_handle ((DxfHandleTable *) drawing->handle_table);
+        }
+        for (i = 0; (drawing->line_columns != NULL) && (i < drawing->line_columns->number_of_rows); i++)
+        {
+                if ((uint64_t) (unsigned int) drawing->line_columns->id_code[i] > max_handle)
+                {
+                        max_handle = (unsigned int) drawing->line_columns->id_code[i];
+                }
+        }
+        for (i = 0; (drawing->point_columns != NULL) && (i < drawing->point_columns->number_of_rows); i++)
+        {
+                if ((uint64_t) (unsigned int) drawing->point_columns->id_code[i] > max_handle)
+                {
+                        max_handle = (unsigned int) drawing->point_columns->id_code[i];
+                }
+        }
+        if ((max_handle != UINT64_MAX) && (max_handle + 1 > handle_seed))
+        {
+                handle_seed = max_handle + 1;
+        }
+        /* Handle 0 is not a valid handle. */
+        if (handle_seed < 1)
+        {
+                handle_seed = 1;
+        }
+        /* Only ever advance, other threads may be reserving handles. */
+        current = __atomic_load_n (&drawing->handle_seed, __ATOMIC_RELAXED);
+        while ((handle_seed > current)
+          && (!__atomic_compare_exchange_n (&drawing->handle_seed, &current,
+          handle_seed, FALSE, __ATOMIC_RELAXED, __ATOMIC_RELAXED)))
+        {
+                /* current was reloaded, try again. */
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Reserve a block of consecutive handles in a libDXF drawing.
+ *
+ * Lock free, safe to call from any number of threads.\n
+ * The \c $HANDSEED of the drawing is written as the next unused handle
+ * by \c dxf_file_write().
+ *
+ * \return the first handle of the block, or 0 when the handles are
+ * exhausted or an error occurred.
+ */
+uint64_t
+dxf_drawing_reserve_handles
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        int number_of_handles
+                /*!< number of handles to reserve. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        uint64_t first;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        if (number_of_handles < 1)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () received an invalid value in number_of_handles.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        if (dxf_drawing_is_frozen (drawing))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the drawing is frozen.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        first = __atomic_load_n (&drawing->handle_seed, __ATOMIC_RELAXED);
+        do
+        {
+                /* The seed itself has to stay representable. */
+                if (first > UINT64_MAX - (uint64_t) number_of_handles)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () the handles of the drawing are exhausted.\n")),
+                          __FUNCTION__);
+                        return (0);
+                }
+        }
+        while (!__atomic_compare_exchange_n (&drawing->handle_seed, &first,
+          first + (uint64_t) number_of_handles, FALSE, __ATOMIC_RELAXED,
+          __ATOMIC_RELAXED));
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (first);
+}
+
+
+/*!
+ * \brief Allocate a handle in a libDXF drawing from a range of handles
+ * owned by the calling thread.
+ *
+ * A new block of \c DXF_DRAWING_HANDLE_BLOCK_SIZE handles is reserved
+ * when the range is empty, so threads only touch the drawing once per
+ * block.\n
+ * Handles left in a range are never handed out by other threads.
+ *
+ * \return the allocated handle, or 0 when the handles are exhausted or
+ * an error occurred.
+ */
+uint64_t
+dxf_drawing_allocate_handle
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        DxfHandleRange *range
+                /*!< a range of handles owned by the calling thread. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        uint64_t first;
+
+        /* Do some basic checks. */
+        if ((drawing == NULL) || (range == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        if (range->next >= range->end)
+        {
+                first = dxf_drawing_reserve_handles (drawing, DXF_DRAWING_HANDLE_BLOCK_SIZE);
+                if (first == 0)
+                {
+                        return (0);
+                }
+                range->next = first;
+                range->end = first + DXF_DRAWING_HANDLE_BLOCK_SIZE;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (range->next++);
+}
+
+
 /* EOF*/
@@ -45,6 +45,54 @@
 #include "entities.h"
 #include "object.h"
 #include "thumbnail.h"
+#include "intern.h"
+#include "handle_table.h"
+#include "chunk_list.h"
+#include "columns.h"
+
+
+#define DXF_DRAWING_HANDLE_BLOCK_SIZE 256
+        /*!< \brief The number of handles a \c DxfHandleRange reserves
+         * at once. */
+
+
+#define DXF_DRAWING_SECTION_HEADER 0x0001
+        /*!< \brief The \c header of a drawing. */
+#define DXF_DRAWING_SECTION_CLASSES 0x0002
+        /*!< \brief The \c class_list of a drawing. */
+#define DXF_DRAWING_SECTION_TABLES 0x0004
+        /*!< \brief The \c tables_list of a drawing. */
+#define DXF_DRAWING_SECTION_BLOCKS 0x0008
+        /*!< \brief The \c block_list of a drawing. */
+#define DXF_DRAWING_SECTION_ENTITIES_LIST 0x0010
+        /*!< \brief The \c entities_list of a drawing. */
+#define DXF_DRAWING_SECTION_OBJECTS 0x0020
+        /*!< \brief The \c object_list of a drawing. */
+#define DXF_DRAWING_SECTION_THUMBNAIL 0x0040
+        /*!< \brief The \c thumbnail of a drawing. */
+#define DXF_DRAWING_SECTION_INTERN 0x0080
+        /*!< \brief The \c intern table of a drawing. */
+#define DXF_DRAWING_SECTION_HANDLE_TABLE 0x0100
+        /*!< \brief The \c handle_table of a drawing. */
+#define DXF_DRAWING_SECTION_ENTITIES 0x0200
+        /*!< \brief The \c entities container of a drawing. */
+#define DXF_DRAWING_SECTION_COLUMNS 0x0400
+        /*!< \brief The \c line_columns and \c point_columns stores of
+         * a drawing. */
+
+
+/*!
+ * \brief Definition of an entry in the entities container of a DXF
+ * drawing.
+ */
+typedef struct
+dxf_drawing_entity
+{
+        int type;
+                /*!< Type of the entity, a \c DxfEntityType value. */
+        void *entity;
+                /*!< Pointer to the entity. */
+} DxfDrawingEntity;
 
 
 /*!
@@ -67,9 +115,72 @@ dxf_drawing_struct
         /*!< Objects section data (single linked list).*/
     struct DxfThumbnail *thumbnail;
         /*!< Thumbnail data.*/
+    struct DxfIntern *intern;
+        /*!< Intern table for the symbol names (layer, linetype,
+         * style and block names) shared by the entities.*/
+    struct DxfHandleTable *handle_table;
+        /*!< Handle table for the resolution of handle references.*/
+    struct DxfChunkList *entities;
+        /*!< All entities in file order (\c DxfDrawingEntity
+         * entries), the entities are not owned by the container.*/
+    int number_of_owned_entities;
+        /*!< Number of entities at the start of \c entities that were
+         * read from a file, these are owned by the drawing and freed
+         * with it.*/
+    int number_of_skipped_entities;
+        /*!< Number of entities in the \c ENTITIES section of the
+         * file read which were skipped (no reader for the type) or
+         * could not be read.*/
+    struct DxfLayerIndexMap *layer_map;
+        /*!< Layer index map of the entities, \c NULL until it is
+         * built by \c dxf_drawing_get_layer_map().*/
+    int frozen;
+        /*!< \c TRUE once the drawing is frozen with
+         * \c dxf_drawing_freeze(), a frozen drawing is never modified
+         * and can be read from any number of threads without locks.*/
+    int reference_count;
+        /*!< Number of references to a frozen drawing, updated
+         * atomically.*/
+    int shared_sections;
+        /*!< Bit mask of \c DXF_DRAWING_SECTION_* values, the sections
+         * shared with the frozen \c base drawing (read only, not
+         * freed with this drawing).*/
+    struct DxfDrawing *base;
+        /*!< Frozen drawing this copy-on-write drawing shares sections
+         * with, a reference is held until the drawing is freed.\n
+         * \c NULL when no sections are shared.*/
+    uint64_t handle_seed;
+        /*!< The next unused handle (\c $HANDSEED), advanced
+         * atomically by \c dxf_drawing_reserve_handles().*/
+    DxfLineColumns *line_columns;
+        /*!< Columnar store receiving the \c LINE entities of the
+         * \c ENTITIES section, \c NULL unless enabled with
+         * \c dxf_drawing_enable_columns().*/
+    DxfPointColumns *point_columns;
+        /*!< Columnar store receiving the \c POINT entities of the
+         * \c ENTITIES section, see \c line_columns.*/
 } DxfDrawing;
 
 
+/*!
+ * \brief Definition of a range of handles reserved by one thread.
+ *
+ * A thread creating entities keeps its own range (initialized with
+ * zeros) and takes handles from it with
+ * \c dxf_drawing_allocate_handle(), which reserves a new block of
+ * \c DXF_DRAWING_HANDLE_BLOCK_SIZE handles from the drawing when the
+ * range runs empty.
+ */
+typedef struct
+dxf_handle_range
+{
+        uint64_t next;
+                /*!< The next handle to hand out. */
+        uint64_t end;
+                /*!< The handle past the last handle of the range. */
+} DxfHandleRange;
+
+
 DxfDrawing *
 dxf_drawing_new ();
 DxfDrawing *
@@ -160,6 +271,129 @@ dxf_drawing_set_thumbnail
         DxfDrawing *drawing,
         DxfThumbnail *thumbnail
 );
+DxfIntern *
+dxf_drawing_get_intern
+(
+        DxfDrawing *drawing
+);
+DxfDrawing *
+dxf_drawing_set_intern
+(
+        DxfDrawing *drawing,
+        DxfIntern *intern
+);
+DxfHandleTable *
+dxf_drawing_get_handle_table
+(
+        DxfDrawing *drawing
+);
+DxfDrawing *
+dxf_drawing_set_handle_table
+(
+        DxfDrawing *drawing,
+        DxfHandleTable *handle_table
+);
+int
+dxf_drawing_append_entity
+(
+        DxfDrawing *drawing,
+        int type,
+        void *entity
+);
+int
+dxf_drawing_get_number_of_entities
+(
+        DxfDrawing *drawing
+);
+DxfChunkList *
+dxf_drawing_get_entities
+(
+        DxfDrawing *drawing
+);
+const DxfHeader *
+dxf_drawing_get_const_header
+(
+        const DxfDrawing *drawing
+);
+int
+dxf_drawing_entities_iter_init
+(
+        const DxfDrawing *drawing,
+        DxfChunkListIter *iter
+);
+struct dxf_layer_index_map *
+dxf_drawing_get_layer_map
+(
+        DxfDrawing *drawing
+);
+int
+dxf_drawing_enable_columns
+(
+        DxfDrawing *drawing
+);
+DxfLineColumns *
+dxf_drawing_get_line_columns
+(
+        DxfDrawing *drawing
+);
+DxfPointColumns *
+dxf_drawing_get_point_columns
+(
+        DxfDrawing *drawing
+);
+DxfDrawing *
+dxf_drawing_freeze
+(
+        DxfDrawing *drawing
+);
+int
+dxf_drawing_is_frozen
+(
+        DxfDrawing *drawing
+);
+DxfDrawing *
+dxf_drawing_ref
+(
+        DxfDrawing *drawing
+);
+int
+dxf_drawing_unref
+(
+        DxfDrawing *drawing
+);
+DxfDrawing *
+dxf_drawing_copy_on_write
+(
+        DxfDrawing *drawing
+);
+int
+dxf_drawing_unshare
+(
+        DxfDrawing *drawing,
+        int section
+);
+uint64_t
+dxf_drawing_get_handle_seed
+(
+        DxfDrawing *drawing
+);
+int
+dxf_drawing_sync_handle_seed
+(
+        DxfDrawing *drawing
+);
+uint64_t
+dxf_drawing_reserve_handles
+(
+        DxfDrawing *drawing,
+        int number_of_handles
+);
+uint64_t
+dxf_drawing_allocate_handle
+(
+        DxfDrawing *drawing,
+        DxfHandleRange *range
+);
 
 
 #endif /* LIBDXF_SRC_DRAWING_H */
@@ -42,14 +42,19 @@
 #include "acad_proxy_entity.h"
 #include "appid.h"
 #include "arc.h"
+#include "area.h"
 #include "attdef.h"
 #include "attrib.h"
+#include "batch.h"
 #include "block.h"
 #include "block_record.h"
 #include "body.h"
+#include "bounds.h"
+#include "chunk_list.h"
 #include "circle.h"
 #include "class.h"
 #include "color.h"
+#include "columns.h"
 #include "comment.h"
 #include "dictionary.h"
 #include "dictionaryvar.h"
@@ -62,26 +67,34 @@
 #include "endtab.h"
 #include "entities.h"
 #include "entity.h"
+#include "expand.h"
 #include "file.h"
 #include "global.h"
 #include "group.h"
+#include "handle_table.h"
 #include "hatch.h"
+#include "hatch_fill.h"
+#include "hatch_store.h"
 #include "header.h"
 #include "helix.h"
 #include "idbuffer.h"
 #include "image.h"
 #include "imagedef.h"
 #include "imagedef_reactor.h"
+#include "indexed_mesh.h"
 #include "insert.h"
+#include "intern.h"
 #include "layer.h"
 #include "layer_index.h"
 #include "leader.h"
 #include "line.h"
 #include "ltype.h"
 #include "lwpolyline.h"
+#include "memory_stats.h"
 #include "mline.h"
 #include "mlinestyle.h"
 #include "mtext.h"
+#include "nurbs.h"
 #include "object.h"
 #include "object_ptr.h"
 #include "oleframe.h"
@@ -89,6 +102,7 @@
 #include "param.h"
 #include "point.h"
 #include "polyline.h"
+#include "pool.h"
 #include "rastervariables.h"
 #include "ray.h"
 #include "region.h"
@@ -102,12 +116,14 @@
 #include "style.h"
 #include "table.h"
 #include "tables.h"
+#include "tessellation.h"
 #include "text.h"
 #include "thumbnail.h"
 #include "tolerance.h"
 #include "trace.h"
 #include "ucs.h"
 #include "util.h"
+#include "vec.h"
 #include "vertex.h"
 #include "view.h"
 #include "viewport.h"
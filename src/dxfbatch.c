@@ -0,0 +1,206 @@
+/*!
+ * \file dxfbatch.c
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Command line tool for processing a batch of DXF files.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <unistd.h>
+#include "batch.h"
+#include "header.h"
+
+
+/*!
+ * \brief Print the usage of \c dxfbatch.
+ */
+static void
+dxfbatch_usage
+(
+        FILE *fp
+                /*!< a file pointer to an output file (or device). */
+)
+{
+        fprintf (fp,
+          (_("Usage: dxfbatch [-o operation] [-j threads] [-v version] [-d directory] [-r results] [file ...]\n"
+          "  -o operation  parse (default), statistics, round-trip or convert.\n"
+          "  -j threads    number of worker threads (default: online processors).\n"
+          "  -v version    AutoCAD version of written files, e.g. AC1015 (convert).\n"
+          "  -d directory  directory for written files (default: next to the input).\n"
+          "  -r results    file for the results (default: standard output).\n"
+          "Without file arguments, or for a file named -, file names are read\n"
+          "from standard input, one per line.\n"
+          "The results are written as one JSON object per line and per file.\n")));
+}
+
+
+/*!
+ * \brief Add file names read from standard input to a batch.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxfbatch_add_files_from_stdin
+(
+        DxfBatch *batch
+                /*!< a pointer to a DXF batch. */
+)
+{
+        char line[DXF_MAX_STRING_LENGTH];
+        size_t length;
+
+        while (fgets (line, DXF_MAX_STRING_LENGTH, stdin) != NULL)
+        {
+                length = strlen (line);
+                while ((length > 0)
+                  && ((line[length - 1] == '\n') || (line[length - 1] == '\r')))
+                {
+                        line[--length] = '\0';
+                }
+                if (length == 0)
+                {
+                        continue;
+                }
+                if (dxf_batch_add_file (batch, line) != EXIT_SUCCESS)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+int
+main
+(
+        int argc,
+        char *argv[]
+)
+{
+        DxfBatch *batch = NULL;
+        FILE *results = stdout;
+        char *results_filename = NULL;
+        int operation = DXF_BATCH_PARSE;
+        int acad_version_number = AutoCAD_2000;
+        int number_of_threads = 0;
+        char *output_directory = NULL;
+        int status;
+        int c;
+        int i;
+
+        while ((c = getopt (argc, argv, "o:j:v:d:r:h")) != -1)
+        {
+                switch (c)
+                {
+                        case 'o':
+                                operation = dxf_batch_operation_from_string (optarg);
+                                if (operation < 0)
+                                {
+                                        fprintf (stderr,
+                                          (_("dxfbatch: unknown operation %s.\n")),
+                                          optarg);
+                                        return (2);
+                                }
+                                break;
+                        case 'j':
+                                number_of_threads = atoi (optarg);
+                                break;
+                        case 'v':
+                                acad_version_number = dxf_header_acad_version_from_string (optarg);
+                                if (acad_version_number == 0)
+                                {
+                                        fprintf (stderr,
+                                          (_("dxfbatch: unknown AutoCAD version %s.\n")),
+                                          optarg);
+                                        return (2);
+                                }
+                                break;
+                        case 'd':
+                                output_directory = optarg;
+                                break;
+                        case 'r':
+                                results_filename = optarg;
+                                break;
+                        case 'h':
+                                dxfbatch_usage (stdout);
+                                return (EXIT_SUCCESS);
+                        default:
+                                dxfbatch_usage (stderr);
+                                return (2);
+                }
+        }
+        batch = dxf_batch_init (dxf_batch_new (), operation);
+        if (batch == NULL)
+        {
+                return (2);
+        }
+        batch->acad_version_number = acad_version_number;
+        batch->number_of_threads = number_of_threads;
+        if (output_directory != NULL)
+        {
+                batch->output_directory = strdup (output_directory);
+        }
+        status = EXIT_SUCCESS;
+        if (optind == argc)
+        {
+                status = dxfbatch_add_files_from_stdin (batch);
+        }
+        for (i = optind; (status == EXIT_SUCCESS) && (i < argc); i++)
+        {
+                status = (strcmp (argv[i], "-") == 0)
+                  ? dxfbatch_add_files_from_stdin (batch)
+                  : dxf_batch_add_file (batch, argv[i]);
+        }
+        if (status != EXIT_SUCCESS)
+        {
+                dxf_batch_free (batch);
+                return (2);
+        }
+        if ((results_filename != NULL)
+          && ((results = fopen (results_filename, "w")) == NULL))
+        {
+                fprintf (stderr,
+                  (_("dxfbatch: could not open %s for writing.\n")),
+                  results_filename);
+                dxf_batch_free (batch);
+                return (2);
+        }
+        status = dxf_batch_run (batch);
+        dxf_batch_write_results (results, batch);
+        if (results != stdout)
+        {
+                fclose (results);
+        }
+        dxf_batch_free (batch);
+        return ((status == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/* EOF */
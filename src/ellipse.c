@@ -33,6 +33,8 @@
 
 
 #include "ellipse.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -128,6 +130,7 @@ dxf_ellipse_init
         ellipse->paperspace = DXF_MODELSPACE;
         ellipse->dictionary_owner_soft = strdup ("");
         ellipse->dictionary_owner_hard = strdup ("");
+        ellipse->intern = NULL;
         ellipse->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -168,7 +171,7 @@ dxf_ellipse_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (ellipse == NULL)
@@ -179,9 +182,13 @@ dxf_ellipse_read
                 ellipse = dxf_ellipse_new ();
                 ellipse = dxf_ellipse_init (ellipse);
         }
+        /* The symbol names are interned in the intern table of the
+         * file. */
+        ellipse->intern = fp->intern;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -190,7 +197,7 @@ dxf_ellipse_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -205,13 +212,13 @@ dxf_ellipse_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ellipse->linetype);
+                        ellipse->linetype = dxf_intern_read_string (fp, ellipse->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ellipse->layer);
+                        ellipse->layer = dxf_intern_read_string (fp, ellipse->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -367,14 +374,14 @@ dxf_ellipse_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ellipse->dictionary_owner_soft);
+                        ellipse->dictionary_owner_soft = dxf_read_string (fp, ellipse->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ellipse->dictionary_owner_hard);
+                        ellipse->dictionary_owner_hard = dxf_read_string (fp, ellipse->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -388,19 +395,37 @@ dxf_ellipse_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
-        }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
+        }
+        /* Symbol names not found in the file are still the copies
+         * made by the init function. */
+        ellipse->linetype = dxf_intern_adopt_string ((DxfIntern *) ellipse->intern, ellipse->linetype);
+        ellipse->layer = dxf_intern_adopt_string ((DxfIntern *) ellipse->intern, ellipse->layer);
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (ellipse->linetype, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) ellipse->intern, ellipse->linetype, DXF_INTERN_ID_EMPTY))
         {
-                ellipse->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_intern_free_string ((DxfIntern *) ellipse->intern, ellipse->linetype);
+                ellipse->linetype = dxf_intern_string ((DxfIntern *) ellipse->intern, DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (ellipse->layer, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) ellipse->intern, ellipse->layer, DXF_INTERN_ID_EMPTY))
         {
-                ellipse->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_intern_free_string ((DxfIntern *) ellipse->intern, ellipse->layer);
+                ellipse->layer = dxf_intern_string ((DxfIntern *) ellipse->intern, DXF_DEFAULT_LAYER);
+        }
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (ellipse->id_code > 0))
+        {
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) ellipse->id_code, ELLIPSE, ellipse);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -430,6 +455,8 @@ dxf_ellipse_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("ELLIPSE");
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -468,7 +495,8 @@ dxf_ellipse_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (ellipse->linetype, "") == 0)
+        linetype = ellipse->linetype;
+        if (dxf_intern_is_symbol ((DxfIntern *) ellipse->intern, linetype, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -476,9 +504,10 @@ dxf_ellipse_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                ellipse->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = dxf_intern_get_symbol ((DxfIntern *) ellipse->intern, DXF_INTERN_ID_DEFAULT_LINETYPE);
         }
-        if (strcmp (ellipse->layer, "") == 0)
+        layer = ellipse->layer;
+        if (dxf_intern_is_symbol ((DxfIntern *) ellipse->intern, layer, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -486,7 +515,7 @@ dxf_ellipse_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                ellipse->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = dxf_intern_get_symbol ((DxfIntern *) ellipse->intern, DXF_INTERN_ID_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -526,10 +555,10 @@ dxf_ellipse_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", ellipse->layer);
-        if (strcmp (ellipse->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (!dxf_intern_is_symbol ((DxfIntern *) ellipse->intern, linetype, DXF_INTERN_ID_DEFAULT_LINETYPE))
         {
-                fprintf (fp->fp, "  6\n%s\n", ellipse->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
@@ -604,8 +633,8 @@ dxf_ellipse_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (ellipse->linetype);
-        free (ellipse->layer);
+        dxf_intern_free_string ((DxfIntern *) ellipse->intern, ellipse->linetype);
+        dxf_intern_free_string ((DxfIntern *) ellipse->intern, ellipse->layer);
         free (ellipse->dictionary_owner_soft);
         free (ellipse->dictionary_owner_hard);
         free (ellipse);
@@ -829,7 +858,10 @@ dxf_ellipse_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->linetype = strdup (linetype);
+        /* Intern first, the new name may be the old one. */
+        linetype = dxf_intern_string ((DxfIntern *) ellipse->intern, linetype);
+        dxf_intern_free_string ((DxfIntern *) ellipse->intern, ellipse->linetype);
+        ellipse->linetype = linetype;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -919,7 +951,10 @@ dxf_ellipse_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->layer = strdup (layer);
+        /* Intern first, the new name may be the old one. */
+        layer = dxf_intern_string ((DxfIntern *) ellipse->intern, layer);
+        dxf_intern_free_string ((DxfIntern *) ellipse->intern, ellipse->layer);
+        ellipse->layer = layer;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2422,4 +2457,79 @@ dxf_ellipse_set_next
 }
 
 
+/*!
+ * \brief Calculate the nearest point on a DXF \c ELLIPSE to a point.
+ *
+ * The point may be outside the plane of the \c ellipse, the distance
+ * is measured in 3D.
+ *
+ * \return the distance between the point and the \c ellipse in
+ * drawing units, or -1.0 when an error occurred.
+ *
+ * \version According to DXF R13.
+ * \version According to DXF R14.
+ */
+double
+dxf_ellipse_calculate_nearest_point
+(
+        DxfEllipse *ellipse,
+                /*!< a pointer to a DXF \c ELLIPSE entity. */
+        DxfVec3 point,
+                /*!< the point in WCS. */
+        DxfVec3 *nearest,
+                /*!< the nearest point on the \c ellipse in WCS
+                 * (output), may be \c NULL. */
+        double *parameter
+                /*!< the parameter of the nearest point in radians,
+                 * between the start parameter and the end parameter
+                 * (output), may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfOcs ocs;
+        DxfVec3 center;
+        DxfVec3 u;
+        DxfVec3 v;
+        double start = 0.0;
+        double end = 2.0 * M_PI;
+        double distance;
+
+        /* Do some basic checks. */
+        if (ellipse == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1.0);
+        }
+        /* The center point and the major axis are in WCS, the minor
+         * axis is the major axis turned a quarter around the extrusion
+         * direction. */
+        dxf_ocs_init (&ocs, ellipse->extr_x0, ellipse->extr_y0, ellipse->extr_z0);
+        center.x = ellipse->x0;
+        center.y = ellipse->y0;
+        center.z = ellipse->z0;
+        u.x = ellipse->x1;
+        u.y = ellipse->y1;
+        u.z = ellipse->z1;
+        v.x = ellipse->ratio * (ocs.az.y * u.z - ocs.az.z * u.y);
+        v.y = ellipse->ratio * (ocs.az.z * u.x - ocs.az.x * u.z);
+        v.z = ellipse->ratio * (ocs.az.x * u.y - ocs.az.y * u.x);
+        if ((ellipse->start_angle != ellipse->end_angle)
+          && (fabs (ellipse->end_angle - ellipse->start_angle) < 2.0 * M_PI))
+        {
+                start = ellipse->start_angle;
+                end = ellipse->end_angle;
+        }
+        distance = dxf_vec3_nearest_point_on_elliptical_arc (center, u, v,
+          start, end, point, nearest, parameter);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (distance);
+}
+
+
 /* EOF */
@@ -37,7 +37,10 @@
 
 
 #include "global.h"
+#include "intern.h"
+#include "handle_table.h"
 #include "point.h"
+#include "vec.h"
 
 
 /*!
@@ -140,6 +143,11 @@ dxf_ellipse
                 /*!< Z value of the extrusion direction.\n
                  * Optional, if ommited defaults to 1.0.\n
                  * Group code = 230. */
+        struct DxfIntern *intern;
+                /*!< Intern table holding the interned symbol names of
+                 * this entity, \c NULL when none are interned.\n
+                 * Symbol names not found in this table are private
+                 * copies. */
         struct DxfEllipse *next;
                 /*!< pointer to the next DxfEllipse.\n
                  * \c NULL in the last DxfEllipse. */
@@ -380,6 +388,14 @@ dxf_ellipse_set_next
         DxfEllipse *next
 );
 
+double
+dxf_ellipse_calculate_nearest_point
+(
+        DxfEllipse *ellipse,
+        DxfVec3 point,
+        DxfVec3 *nearest,
+        double *parameter
+);
 
 #endif /* LIBDXF_SRC_ELLIPSE_H */
 
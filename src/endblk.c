@@ -33,6 +33,7 @@
 
 
 #include "endblk.h"
+#include "pool.h"
 
 
 /*!
@@ -169,7 +170,7 @@ dxf_endblk_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (endblk == NULL)
@@ -180,8 +181,10 @@ dxf_endblk_read
                 endblk = dxf_endblk_new ();
                 endblk = dxf_endblk_init (endblk);
         }
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        temp_string = dxf_pool_string_alloc ();
+        (fp->line_number)++;
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -190,7 +193,7 @@ dxf_endblk_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 else if (strcmp (temp_string, "5") == 0)
@@ -202,13 +205,13 @@ dxf_endblk_read
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        fscanf (fp->fp, "%s\n", endblk->layer);
+                        endblk->layer = dxf_read_string (fp, endblk->layer);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner object. */
-                        fscanf (fp->fp, "%s\n", endblk->dictionary_owner_soft);
+                        endblk->dictionary_owner_soft = dxf_read_string (fp, endblk->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -221,7 +224,13 @@ dxf_endblk_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle ommitted members and/or illegal values. */
         if (strcmp (endblk->layer, "") == 0)
@@ -229,7 +238,7 @@ dxf_endblk_read
                 endblk->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
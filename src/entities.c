@@ -52,33 +52,435 @@
 
 
 #include "entities.h"
+#include "3dface.h"
+#include "3dsolid.h"
+#include "acad_proxy_entity.h"
+#include "arc.h"
+#include "attdef.h"
+#include "attrib.h"
+#include "body.h"
+#include "circle.h"
+#include "columns.h"
+#include "dimension.h"
+#include "drawing.h"
+#include "ellipse.h"
+#include "helix.h"
+#include "image.h"
+#include "insert.h"
+#include "leader.h"
+#include "line.h"
+#include "lwpolyline.h"
+#include "mtext.h"
+#include "ole2frame.h"
+#include "oleframe.h"
+#include "point.h"
+#include "polyline.h"
+#include "pool.h"
+#include "ray.h"
+#include "region.h"
+#include "seqend.h"
+#include "shape.h"
+#include "solid.h"
+#include "spline.h"
+#include "table.h"
+#include "text.h"
+#include "tolerance.h"
+#include "trace.h"
+#include "util.h"
+#include "viewport.h"
+#include "xline.h"
+
+
+/*!
+ * \brief Names of the entities read from the \c ENTITIES section.
+ */
+static const struct
+{
+        const char *name;
+                /*!< Entity name as found in a DXF file. */
+        int type;
+                /*!< Type of the entity, a \c DxfEntityType value. */
+} dxf_entities_types[] =
+{
+        {"3DFACE", DFACE},
+        {"3DSOLID", DSOLID},
+        {"ACAD_PROXY_ENTITY", ACADPROXYENTITY},
+        {"ACAD_TABLE", TABLE},
+        {"ARC", ARC},
+        {"ATTDEF", ATTDEF},
+        {"ATTRIB", ATTRIB},
+        {"BODY", BODY},
+        {"CIRCLE", CIRCLE},
+        {"DIMENSION", DIMENSION},
+        {"ELLIPSE", ELLIPSE},
+        {"HELIX", HELIX},
+        {"IMAGE", IMAGE},
+        {"INSERT", INSERT},
+        {"LEADER", LEADER},
+        {"LINE", LINE},
+        {"LWPOLYLINE", LWPOLYLINE},
+        {"MTEXT", MTEXT},
+        {"OLE2FRAME", OLE2FRAME},
+        {"OLEFRAME", OLEFRAME},
+        {"POINT", POINT},
+        {"POLYLINE", POLYLINE},
+        {"RAY", RAY},
+        {"REGION", REGION},
+        {"SHAPE", SHAPE},
+        {"SOLID", SOLID},
+        {"SPLINE", SPLINE},
+        {"TEXT", TEXT},
+        {"TOLERANCE", TOLERANCE},
+        {"TRACE", TRACE},
+        {"VIEWPORT", VIEWPORT},
+        {"XLINE", XLINE},
+};
+
+
+/*!
+ * \brief Get the type of an entity from the name found in a DXF file.
+ *
+ * \return the \c DxfEntityType value, or \c UNKNOWN_ENTITY when the
+ * entity can not be read.
+ */
+static int
+dxf_entities_get_type
+(
+        const char *name
+                /*!< entity name. */
+)
+{
+        size_t i;
+
+        for (i = 0; i < sizeof (dxf_entities_types) / sizeof (dxf_entities_types[0]); i++)
+        {
+                if (strcmp (dxf_entities_types[i].name, name) == 0)
+                {
+                        return (dxf_entities_types[i].type);
+                }
+        }
+        return (UNKNOWN_ENTITY);
+}
+
+
+/*!
+ * \brief Read an entity with the reader of its type.
+ *
+ * The last line read from file contained the name of the entity.\n
+ * A \c POLYLINE entity is read with the following \c VERTEX entities
+ * and the \c SEQEND marker.
+ *
+ * \return a pointer to the entity, or \c NULL when an error occurred.
+ */
+static void *
+dxf_entities_read_entity
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        int type
+                /*!< type of the entity, a \c DxfEntityType value. */
+)
+{
+        void *entity = NULL;
+
+        switch (type)
+        {
+                case ACADPROXYENTITY:
+                        entity = dxf_acad_proxy_entity_read (fp, dxf_acad_proxy_entity_init (dxf_acad_proxy_entity_new ()));
+                        break;
+                case ARC:
+                        entity = dxf_arc_read (fp, dxf_arc_init (dxf_arc_new ()));
+                        break;
+                case ATTDEF:
+                        entity = dxf_attdef_read (fp, dxf_attdef_init (dxf_attdef_new ()));
+                        break;
+                case ATTRIB:
+                        entity = dxf_attrib_read (fp, dxf_attrib_init (dxf_attrib_new ()));
+                        break;
+                case BODY:
+                        entity = dxf_body_read (fp, dxf_body_init (dxf_body_new ()));
+                        break;
+                case CIRCLE:
+                        entity = dxf_circle_read (fp, dxf_circle_init (dxf_circle_new ()));
+                        break;
+                case DFACE:
+                        entity = dxf_3dface_read (fp, dxf_3dface_init (dxf_3dface_new ()));
+                        break;
+                case DIMENSION:
+                        entity = dxf_dimension_read (fp, dxf_dimension_init (dxf_dimension_new ()));
+                        break;
+                case DSOLID:
+                        entity = dxf_3dsolid_read (fp, dxf_3dsolid_init (dxf_3dsolid_new ()));
+                        break;
+                case ELLIPSE:
+                        entity = dxf_ellipse_read (fp, dxf_ellipse_init (dxf_ellipse_new ()));
+                        break;
+                case HELIX:
+                        entity = dxf_helix_read (fp, dxf_helix_init (dxf_helix_new ()));
+                        break;
+                case IMAGE:
+                        entity = dxf_image_read (fp, dxf_image_init (dxf_image_new ()));
+                        break;
+                case INSERT:
+                        entity = dxf_insert_read (fp, dxf_insert_init (dxf_insert_new ()));
+                        break;
+                case LEADER:
+                        entity = dxf_leader_read (fp, dxf_leader_init (dxf_leader_new ()));
+                        break;
+                case LINE:
+                        entity = dxf_line_read (fp, dxf_line_init (dxf_line_new ()));
+                        break;
+                case LWPOLYLINE:
+                        entity = dxf_lwpolyline_read (fp, dxf_lwpolyline_init (dxf_lwpolyline_new ()));
+                        break;
+                case MTEXT:
+                        entity = dxf_mtext_read (fp, dxf_mtext_init (dxf_mtext_new ()));
+                        break;
+                case OLE2FRAME:
+                        entity = dxf_ole2frame_read (fp, dxf_ole2frame_init (dxf_ole2frame_new ()));
+                        break;
+                case OLEFRAME:
+                        entity = dxf_oleframe_read (fp, dxf_oleframe_init (dxf_oleframe_new ()));
+                        break;
+                case POINT:
+                        entity = dxf_point_read (fp, dxf_point_init (dxf_point_new ()));
+                        break;
+                case POLYLINE:
+                        entity = dxf_polyline_read (fp, dxf_polyline_init (dxf_polyline_new ()));
+                        break;
+                case RAY:
+                        entity = dxf_ray_read (fp, dxf_ray_init (dxf_ray_new ()));
+                        break;
+                case REGION:
+                        entity = dxf_region_read (fp, dxf_region_init (dxf_region_new ()));
+                        break;
+                case SHAPE:
+                        entity = dxf_shape_read (fp, dxf_shape_init (dxf_shape_new ()));
+                        break;
+                case SOLID:
+                        entity = dxf_solid_read (fp, dxf_solid_init (dxf_solid_new ()));
+                        break;
+                case SPLINE:
+                        entity = dxf_spline_read (fp, dxf_spline_init (dxf_spline_new ()));
+                        break;
+                case TABLE:
+                        entity = dxf_table_read (fp, dxf_table_init (dxf_table_new ()));
+                        break;
+                case TEXT:
+                        entity = dxf_text_read (fp, dxf_text_init (dxf_text_new ()));
+                        break;
+                case TOLERANCE:
+                        entity = dxf_tolerance_read (fp, dxf_tolerance_init (dxf_tolerance_new ()));
+                        break;
+                case TRACE:
+                        entity = dxf_trace_read (fp, dxf_trace_init (dxf_trace_new ()));
+                        break;
+                case VIEWPORT:
+                        entity = dxf_viewport_read (fp, dxf_viewport_init (dxf_viewport_new ()));
+                        break;
+                case XLINE:
+                        entity = dxf_xline_read (fp, dxf_xline_init (dxf_xline_new ()));
+                        break;
+                default:
+                        break;
+        }
+        if ((type == POLYLINE)
+          && (entity != NULL)
+          && (dxf_polyline_read_vertices (fp, (DxfPolyline *) entity) == EXIT_FAILURE))
+        {
+                dxf_entity_free (type, entity);
+                entity = NULL;
+        }
+        return (entity);
+}
+
+
+/*!
+ * \brief Skip the group codes and values of an entity which can not be
+ * read.
+ *
+ * \return \c EXIT_SUCCESS when the "  0" group code of the following
+ * entity was read, \c EXIT_FAILURE at the end of the file.
+ */
+static int
+dxf_entities_skip_entity
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        char *temp_string
+                /*!< a string buffer of \c DXF_MAX_STRING_LENGTH
+                 * characters. */
+)
+{
+        for (;;)
+        {
+                (fp->line_number)++;
+                if (dxf_read_group_code (fp, temp_string) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+                if (strcmp (temp_string, "0") == 0)
+                {
+                        return (EXIT_SUCCESS);
+                }
+                (fp->line_number)++;
+                if (dxf_read_group_code (fp, temp_string) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+}
 
 
 /*!
  * \brief Read and parse the \c ENTITIES table from a DXF file.
+ *
+ * The last line read from file contained the string "ENTITIES".\n
+ * Each entity is read with the reader of its type and appended to the
+ * entities container of \c drawing, which owns it from then on.\n
+ * \c SEQEND markers following the \c ATTRIB entities of an \c INSERT
+ * entity are dropped, entities without a reader are skipped and
+ * counted in \c number_of_skipped_entities of \c drawing.\n
+ * When the columnar stores of \c drawing are enabled with
+ * \c dxf_drawing_enable_columns(), \c LINE and \c POINT entities are
+ * read into the stores instead.\n
+ * Reading stops after the \c ENDSEC marker.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  */
 int
 dxf_entities_read_table
 (
-        char *filename,
-                /*!< filename of input file (or device). */
-        FILE *fp,
-                /*!< filepointer to the input file (or device). */
-        int line_number,
-                /*!< current line number in the input file (or device). */
-        char *dxf_entities_list, 
-                /*!< pointer to a list of entities. */
-        int acad_version_number
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfDrawing *drawing
+                /*!< a pointer to the drawing receiving the entities. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        /*! \todo Add code here. */
+        char *temp_string = NULL;
+        void *entity = NULL;
+        DxfSeqend *seqend = NULL;
+        int type;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        temp_string = dxf_pool_string_alloc ();
+        if (temp_string == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        /* Now follows the "  0" group code of the first entity. */
+        (fp->line_number)++;
+        dxf_read_group_code (fp, temp_string);
+        if (strcmp (temp_string, "0") != 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () unexpected string encountered while reading line %d from: %s.\n")),
+                  __FUNCTION__, fp->line_number, fp->filename);
+                dxf_pool_string_free (temp_string);
+                return (EXIT_FAILURE);
+        }
+        while (result == EXIT_SUCCESS)
+        {
+                /* Now follows the name of an entity, each reader
+                 * reads up to and including the "  0" group code of
+                 * the following entity. */
+                (fp->line_number)++;
+                if (dxf_read_group_code (fp, temp_string) == EXIT_FAILURE)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () unexpected end of file while reading from: %s.\n")),
+                          __FUNCTION__, fp->filename);
+                        result = EXIT_FAILURE;
+                        break;
+                }
+                if (strcmp (temp_string, "ENDSEC") == 0)
+                {
+                        break;
+                }
+                if (strcmp (temp_string, "SEQEND") == 0)
+                {
+                        seqend = dxf_seqend_read (fp, dxf_seqend_init (dxf_seqend_new ()));
+                        if (seqend == NULL)
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                        else
+                        {
+                                dxf_seqend_free (seqend);
+                        }
+                        continue;
+                }
+                type = dxf_entities_get_type (temp_string);
+                if (type == UNKNOWN_ENTITY)
+                {
+                        fprintf (stderr,
+                          (_("Warning in %s () skipping unsupported %s entity in line %d of: %s.\n")),
+                          __FUNCTION__, temp_string, fp->line_number, fp->filename);
+                        drawing->number_of_skipped_entities++;
+                        result = dxf_entities_skip_entity (fp, temp_string);
+                        continue;
+                }
+                /* LINE and POINT entities go straight into the
+                 * columnar stores when the drawing has them. */
+                if ((type == LINE) && (drawing->line_columns != NULL))
+                {
+                        if (dxf_line_columns_read (fp, drawing->line_columns) == -1)
+                        {
+                                drawing->number_of_skipped_entities++;
+                                result = EXIT_FAILURE;
+                        }
+                        continue;
+                }
+                if ((type == POINT) && (drawing->point_columns != NULL))
+                {
+                        if (dxf_point_columns_read (fp, drawing->point_columns) == -1)
+                        {
+                                drawing->number_of_skipped_entities++;
+                                result = EXIT_FAILURE;
+                        }
+                        continue;
+                }
+                entity = dxf_entities_read_entity (fp, type);
+                if (entity == NULL)
+                {
+                        drawing->number_of_skipped_entities++;
+                        result = EXIT_FAILURE;
+                }
+                else if (dxf_drawing_append_entity (drawing, type, entity) == EXIT_FAILURE)
+                {
+                        dxf_entity_free (type, entity);
+                        result = EXIT_FAILURE;
+                }
+                else
+                {
+                        drawing->number_of_owned_entities++;
+                }
+        }
+        /* Clean up. */
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (result);
 }
 
 
@@ -110,14 +110,16 @@ typedef struct dxf_entities_struct
 } DxfEntities;
 
 
+/* Defined in drawing.h, which can not be included here as it
+ * includes this file. */
+struct dxf_drawing_struct;
+
+
 int
 dxf_entities_read_table
 (
-       char *filename,
-       FILE *fp,
-       int line_number,
-       char *dxf_entities_list,
-       int acad_version_number
+        DxfFile *fp,
+        struct dxf_drawing_struct *drawing
 );
 int
 dxf_entities_write_table
@@ -33,6 +33,40 @@
 
 
 #include "global.h"
+#include "3dface.h"
+#include "3dsolid.h"
+#include "acad_proxy_entity.h"
+#include "arc.h"
+#include "attdef.h"
+#include "attrib.h"
+#include "body.h"
+#include "circle.h"
+#include "dimension.h"
+#include "ellipse.h"
+#include "hatch.h"
+#include "helix.h"
+#include "image.h"
+#include "insert.h"
+#include "leader.h"
+#include "line.h"
+#include "lwpolyline.h"
+#include "mtext.h"
+#include "ole2frame.h"
+#include "oleframe.h"
+#include "point.h"
+#include "polyline.h"
+#include "ray.h"
+#include "region.h"
+#include "shape.h"
+#include "solid.h"
+#include "spline.h"
+#include "table.h"
+#include "text.h"
+#include "tolerance.h"
+#include "trace.h"
+#include "vertex.h"
+#include "viewport.h"
+#include "xline.h"
 
 
 /*!
@@ -74,4 +108,454 @@ dxf_entity_skip
 }
 
 
+/*!
+ * \brief Get the layer of an entity of any type.
+ *
+ * \return a pointer to the layer name of the entity (not a copy), or
+ * \c NULL when the type is not known or an error occurred.
+ */
+char *
+dxf_entity_get_layer
+(
+        int type,
+                /*!< type of the entity, a \c DxfEntityType value. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char *layer = NULL;
+
+        /* Do some basic checks. */
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        switch (type)
+        {
+                case DFACE:
+                        layer = ((Dxf3dface *) entity)->layer;
+                        break;
+                case DSOLID:
+                        layer = ((Dxf3dsolid *) entity)->layer;
+                        break;
+                case ACADPROXYENTITY:
+                        layer = ((DxfAcadProxyEntity *) entity)->layer;
+                        break;
+                case ARC:
+                        layer = ((DxfArc *) entity)->layer;
+                        break;
+                case ATTDEF:
+                        layer = ((DxfAttdef *) entity)->layer;
+                        break;
+                case ATTRIB:
+                        layer = ((DxfAttrib *) entity)->layer;
+                        break;
+                case BODY:
+                        layer = ((DxfBody *) entity)->layer;
+                        break;
+                case CIRCLE:
+                        layer = ((DxfCircle *) entity)->layer;
+                        break;
+                case DIMENSION:
+                        layer = ((DxfDimension *) entity)->layer;
+                        break;
+                case ELLIPSE:
+                        layer = ((DxfEllipse *) entity)->layer;
+                        break;
+                case HATCH:
+                        layer = ((DxfHatch *) entity)->layer;
+                        break;
+                case HELIX:
+                        layer = ((DxfHelix *) entity)->layer;
+                        break;
+                case IMAGE:
+                        layer = ((DxfImage *) entity)->layer;
+                        break;
+                case INSERT:
+                        layer = ((DxfInsert *) entity)->layer;
+                        break;
+                case LEADER:
+                        layer = ((DxfLeader *) entity)->layer;
+                        break;
+                case LINE:
+                        layer = ((DxfLine *) entity)->layer;
+                        break;
+                case LWPOLYLINE:
+                        layer = ((DxfLWPolyline *) entity)->layer;
+                        break;
+                case MTEXT:
+                        layer = ((DxfMtext *) entity)->layer;
+                        break;
+                case OLEFRAME:
+                        layer = ((DxfOleFrame *) entity)->layer;
+                        break;
+                case OLE2FRAME:
+                        layer = ((DxfOle2Frame *) entity)->layer;
+                        break;
+                case POINT:
+                        layer = ((DxfPoint *) entity)->layer;
+                        break;
+                case POLYLINE:
+                        layer = ((DxfPolyline *) entity)->layer;
+                        break;
+                case RAY:
+                        layer = ((DxfRay *) entity)->layer;
+                        break;
+                case REGION:
+                        layer = ((DxfRegion *) entity)->layer;
+                        break;
+                case SHAPE:
+                        layer = ((DxfShape *) entity)->layer;
+                        break;
+                case SOLID:
+                        layer = ((DxfSolid *) entity)->layer;
+                        break;
+                case SPLINE:
+                        layer = ((DxfSpline *) entity)->layer;
+                        break;
+                case TABLE:
+                        layer = ((DxfTable *) entity)->layer;
+                        break;
+                case TEXT:
+                        layer = ((DxfText *) entity)->layer;
+                        break;
+                case TOLERANCE:
+                        layer = ((DxfTolerance *) entity)->layer;
+                        break;
+                case TRACE:
+                        layer = ((DxfTrace *) entity)->layer;
+                        break;
+                case VERTEX:
+                        layer = ((DxfVertex *) entity)->layer;
+                        break;
+                case VIEWPORT:
+                        layer = ((DxfViewport *) entity)->layer;
+                        break;
+                case XLINE:
+                        layer = ((DxfXLine *) entity)->layer;
+                        break;
+                default:
+                        break;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (layer);
+}
+
+
+/*!
+ * \brief Get the identification number (handle) of an entity of any
+ * type.
+ *
+ * \return the identification number of the entity, or -1 when the type
+ * is not known or an error occurred.
+ */
+int
+dxf_entity_get_id_code
+(
+        int type,
+                /*!< type of the entity, a \c DxfEntityType value. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int id_code = -1;
+
+        /* Do some basic checks. */
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        switch (type)
+        {
+                case DFACE:
+                        id_code = ((Dxf3dface *) entity)->id_code;
+                        break;
+                case DSOLID:
+                        id_code = ((Dxf3dsolid *) entity)->id_code;
+                        break;
+                case ACADPROXYENTITY:
+                        id_code = ((DxfAcadProxyEntity *) entity)->id_code;
+                        break;
+                case ARC:
+                        id_code = ((DxfArc *) entity)->id_code;
+                        break;
+                case ATTDEF:
+                        id_code = ((DxfAttdef *) entity)->id_code;
+                        break;
+                case ATTRIB:
+                        id_code = ((DxfAttrib *) entity)->id_code;
+                        break;
+                case BODY:
+                        id_code = ((DxfBody *) entity)->id_code;
+                        break;
+                case CIRCLE:
+                        id_code = ((DxfCircle *) entity)->id_code;
+                        break;
+                case DIMENSION:
+                        id_code = ((DxfDimension *) entity)->id_code;
+                        break;
+                case ELLIPSE:
+                        id_code = ((DxfEllipse *) entity)->id_code;
+                        break;
+                case HATCH:
+                        id_code = ((DxfHatch *) entity)->id_code;
+                        break;
+                case HELIX:
+                        id_code = ((DxfHelix *) entity)->id_code;
+                        break;
+                case IMAGE:
+                        id_code = ((DxfImage *) entity)->id_code;
+                        break;
+                case INSERT:
+                        id_code = ((DxfInsert *) entity)->id_code;
+                        break;
+                case LEADER:
+                        id_code = ((DxfLeader *) entity)->id_code;
+                        break;
+                case LINE:
+                        id_code = ((DxfLine *) entity)->id_code;
+                        break;
+                case LWPOLYLINE:
+                        id_code = ((DxfLWPolyline *) entity)->id_code;
+                        break;
+                case MTEXT:
+                        id_code = ((DxfMtext *) entity)->id_code;
+                        break;
+                case OLEFRAME:
+                        id_code = ((DxfOleFrame *) entity)->id_code;
+                        break;
+                case OLE2FRAME:
+                        id_code = ((DxfOle2Frame *) entity)->id_code;
+                        break;
+                case POINT:
+                        id_code = ((DxfPoint *) entity)->id_code;
+                        break;
+                case POLYLINE:
+                        id_code = ((DxfPolyline *) entity)->id_code;
+                        break;
+                case RAY:
+                        id_code = ((DxfRay *) entity)->id_code;
+                        break;
+                case REGION:
+                        id_code = ((DxfRegion *) entity)->id_code;
+                        break;
+                case SHAPE:
+                        id_code = ((DxfShape *) entity)->id_code;
+                        break;
+                case SOLID:
+                        id_code = ((DxfSolid *) entity)->id_code;
+                        break;
+                case SPLINE:
+                        id_code = ((DxfSpline *) entity)->id_code;
+                        break;
+                case TABLE:
+                        id_code = ((DxfTable *) entity)->id_code;
+                        break;
+                case TEXT:
+                        id_code = ((DxfText *) entity)->id_code;
+                        break;
+                case TOLERANCE:
+                        id_code = ((DxfTolerance *) entity)->id_code;
+                        break;
+                case TRACE:
+                        id_code = ((DxfTrace *) entity)->id_code;
+                        break;
+                case VERTEX:
+                        id_code = ((DxfVertex *) entity)->id_code;
+                        break;
+                case VIEWPORT:
+                        id_code = ((DxfViewport *) entity)->id_code;
+                        break;
+                case XLINE:
+                        id_code = ((DxfXLine *) entity)->id_code;
+                        break;
+                default:
+                        break;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (id_code);
+}
+
+
+/*!
+ * \brief Free the allocated memory for an entity of any type.
+ *
+ * The vertices of a \c POLYLINE entity are freed with the polyline.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the type
+ * is not known or an error occurred.
+ */
+int
+dxf_entity_free
+(
+        int type,
+                /*!< type of the entity, a \c DxfEntityType value. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPolyline *polyline = NULL;
+        DxfVertex *vertex = NULL;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        switch (type)
+        {
+                case DFACE:
+                        /* dxf_3dface_free () returns the face when it
+                         * could not be freed. */
+                        if (dxf_3dface_free ((Dxf3dface *) entity) != NULL)
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                        break;
+                case DSOLID:
+                        result = dxf_3dsolid_free ((Dxf3dsolid *) entity);
+                        break;
+                case ACADPROXYENTITY:
+                        result = dxf_acad_proxy_entity_free ((DxfAcadProxyEntity *) entity);
+                        break;
+                case ARC:
+                        result = dxf_arc_free ((DxfArc *) entity);
+                        break;
+                case ATTDEF:
+                        result = dxf_attdef_free ((DxfAttdef *) entity);
+                        break;
+                case ATTRIB:
+                        result = dxf_attrib_free ((DxfAttrib *) entity);
+                        break;
+                case BODY:
+                        result = dxf_body_free ((DxfBody *) entity);
+                        break;
+                case CIRCLE:
+                        result = dxf_circle_free ((DxfCircle *) entity);
+                        break;
+                case DIMENSION:
+                        result = dxf_dimension_free ((DxfDimension *) entity);
+                        break;
+                case ELLIPSE:
+                        result = dxf_ellipse_free ((DxfEllipse *) entity);
+                        break;
+                case HATCH:
+                        result = dxf_hatch_free ((DxfHatch *) entity);
+                        break;
+                case HELIX:
+                        result = dxf_helix_free ((DxfHelix *) entity);
+                        break;
+                case IMAGE:
+                        result = dxf_image_free ((DxfImage *) entity);
+                        break;
+                case INSERT:
+                        result = dxf_insert_free ((DxfInsert *) entity);
+                        break;
+                case LEADER:
+                        result = dxf_leader_free ((DxfLeader *) entity);
+                        break;
+                case LINE:
+                        result = dxf_line_free ((DxfLine *) entity);
+                        break;
+                case LWPOLYLINE:
+                        result = dxf_lwpolyline_free ((DxfLWPolyline *) entity);
+                        break;
+                case MTEXT:
+                        result = dxf_mtext_free ((DxfMtext *) entity);
+                        break;
+                case OLEFRAME:
+                        result = dxf_oleframe_free ((DxfOleFrame *) entity);
+                        break;
+                case OLE2FRAME:
+                        result = dxf_ole2frame_free ((DxfOle2Frame *) entity);
+                        break;
+                case POINT:
+                        result = dxf_point_free ((DxfPoint *) entity);
+                        break;
+                case POLYLINE:
+                        /* The vertices are not freed with the
+                         * polyline. */
+                        polyline = (DxfPolyline *) entity;
+                        while (polyline->vertices != NULL)
+                        {
+                                vertex = (DxfVertex *) polyline->vertices;
+                                polyline->vertices = vertex->next;
+                                vertex->next = NULL;
+                                dxf_vertex_free (vertex);
+                        }
+                        result = dxf_polyline_free (polyline);
+                        break;
+                case RAY:
+                        result = dxf_ray_free ((DxfRay *) entity);
+                        break;
+                case REGION:
+                        result = dxf_region_free ((DxfRegion *) entity);
+                        break;
+                case SHAPE:
+                        result = dxf_shape_free ((DxfShape *) entity);
+                        break;
+                case SOLID:
+                        result = dxf_solid_free ((DxfSolid *) entity);
+                        break;
+                case SPLINE:
+                        result = dxf_spline_free ((DxfSpline *) entity);
+                        break;
+                case TABLE:
+                        result = dxf_table_free ((DxfTable *) entity);
+                        break;
+                case TEXT:
+                        result = dxf_text_free ((DxfText *) entity);
+                        break;
+                case TOLERANCE:
+                        result = dxf_tolerance_free ((DxfTolerance *) entity);
+                        break;
+                case TRACE:
+                        result = dxf_trace_free ((DxfTrace *) entity);
+                        break;
+                case VERTEX:
+                        result = dxf_vertex_free ((DxfVertex *) entity);
+                        break;
+                case VIEWPORT:
+                        result = dxf_viewport_free ((DxfViewport *) entity);
+                        break;
+                case XLINE:
+                        result = dxf_xline_free ((DxfXLine *) entity);
+                        break;
+                default:
+                        fprintf (stderr,
+                          (_("Error in %s () received an unknown entity type.\n")),
+                          __FUNCTION__);
+                        result = EXIT_FAILURE;
+                        break;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
 /* EOF */
@@ -94,6 +94,24 @@ dxf_entity_skip
 (
         char *dxf_entity_name
 );
+char *
+dxf_entity_get_layer
+(
+        int type,
+        void *entity
+);
+int
+dxf_entity_get_id_code
+(
+        int type,
+        void *entity
+);
+int
+dxf_entity_free
+(
+        int type,
+        void *entity
+);
 
 
 #endif /* LIBDXF_SRC_ENTITY_H */
@@ -0,0 +1,876 @@
+/*!
+ * \file expand.c
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Functions for the expansion of block references (\c INSERT entities).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <pthread.h>
+#include "expand.h"
+
+
+/*!
+ * \brief A number of entities expanded by one thread of
+ * \c dxf_expand_entities().
+ */
+typedef struct
+dxf_expand_task
+{
+        int first;
+                /*!< Index of the first entity. */
+        int last;
+                /*!< Index after the last entity. */
+        DxfTessellationBuffer buffer;
+                /*!< The polylines of the entities. */
+        int number_of_entities;
+                /*!< Number of entities expanded. */
+        int result;
+                /*!< \c EXIT_SUCCESS or \c EXIT_FAILURE. */
+} DxfExpandTask;
+
+
+/*!
+ * \brief The entities and tasks shared by the threads of
+ * \c dxf_expand_entities().
+ */
+typedef struct
+dxf_expand_job
+{
+        DxfExpandCache *cache;
+                /*!< The cache with the flattened blocks. */
+        DxfDrawingEntity *entities;
+                /*!< Array of entities. */
+        DxfExpandTask *tasks;
+                /*!< Array of tasks, in entity order. */
+        int number_of_tasks;
+                /*!< Number of tasks. */
+        int next_task;
+                /*!< Index of the next unclaimed task. */
+} DxfExpandJob;
+
+
+/*!
+ * \brief Append the flattened geometry of a block for every block
+ * reference of an insert to a buffer.
+ *
+ * The transformation of the insert is composed once, the block
+ * references of a \c MINSERT array only differ in the translation of
+ * the transformation.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated (\c buffer is not changed).
+ */
+static int
+dxf_expand_add_insert
+(
+        DxfTessellationBuffer *buffer,
+                /*!< the buffer. */
+        DxfExpandBlock *block,
+                /*!< the flattened block. */
+        DxfInsert *insert,
+                /*!< the insert. */
+        int index
+                /*!< index of the insert, stored with its polylines. */
+)
+{
+        DxfExpandTransform transform;
+        DxfExpandTransform cell;
+        DxfOcs ocs;
+        DxfVec3 offset;
+        double c = cos (insert->rot_angle * M_PI / 180.0);
+        double s = sin (insert->rot_angle * M_PI / 180.0);
+        int columns = (insert->columns > 1) ? insert->columns : 1;
+        int rows = (insert->rows > 1) ? insert->rows : 1;
+        int number_of_points = buffer->number_of_points;
+        int number_of_runs = buffer->number_of_runs;
+        double x;
+        double y;
+        int column;
+        int row;
+        int j;
+
+        if (block->geometry.number_of_runs == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        transform = dxf_expand_get_insert_transform (insert, block->base_point);
+        dxf_ocs_init (&ocs, insert->extr_x0, insert->extr_y0, insert->extr_z0);
+        for (row = 0; row < rows; row++)
+        {
+                for (column = 0; column < columns; column++)
+                {
+                        /* The spacing is along the rotated X and Y
+                         * axes of the OCS of the insert. */
+                        x = column * insert->column_spacing;
+                        y = row * insert->row_spacing;
+                        offset = dxf_ocs_to_wcs (&ocs, c * x - s * y, s * x + c * y, 0.0);
+                        cell = transform;
+                        cell.m[0][3] += offset.x;
+                        cell.m[1][3] += offset.y;
+                        cell.m[2][3] += offset.z;
+                        j = buffer->number_of_points;
+                        if (dxf_tessellation_buffer_append (buffer, &block->geometry, index) != EXIT_SUCCESS)
+                        {
+                                buffer->number_of_points = number_of_points;
+                                buffer->number_of_runs = number_of_runs;
+                                return (EXIT_FAILURE);
+                        }
+                        for (; j < buffer->number_of_points; j++)
+                        {
+                                buffer->points[j] = dxf_expand_transform_apply (&cell, buffer->points[j]);
+                        }
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Flatten a block and the blocks it references, depth first.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_expand_flatten_block
+(
+        DxfExpandCache *cache,
+                /*!< the cache. */
+        DxfExpandBlock *block,
+                /*!< the block. */
+        int depth
+                /*!< nesting depth of the block. */
+)
+{
+        DxfExpandBlock *child = NULL;
+        DxfInsert *insert = NULL;
+        int result = EXIT_SUCCESS;
+        int i;
+
+        if (block->state == 2)
+        {
+                return (block->result);
+        }
+        block->state = 1;
+        for (i = 0; (i < block->number_of_entities) && (result == EXIT_SUCCESS); i++)
+        {
+                if (block->entities[i].entity == NULL)
+                {
+                        continue;
+                }
+                if (block->entities[i].type != INSERT)
+                {
+                        /* Entities without a tessellation are
+                         * skipped. */
+                        dxf_tessellation_add_entity (&cache->tolerance,
+                          block->entities[i].type, block->entities[i].entity,
+                          i, &block->geometry);
+                        continue;
+                }
+                insert = (DxfInsert *) block->entities[i].entity;
+                child = dxf_expand_cache_get_block (cache, insert->block_name);
+                if ((child == NULL) || (child->state == 1)
+                  || (depth + 1 >= DXF_EXPAND_MAX_DEPTH))
+                {
+                        /* Skip unknown blocks and cyclic references. */
+                        continue;
+                }
+                if (dxf_expand_flatten_block (cache, child, depth + 1) == EXIT_SUCCESS)
+                {
+                        result = dxf_expand_add_insert (&block->geometry, child, insert, i);
+                }
+        }
+        block->state = 2;
+        block->result = result;
+        return (result);
+}
+
+
+/*!
+ * \brief Multiply two transformations.
+ *
+ * \return the transformation \c a * \c b, which applies \c b first.
+ */
+DxfExpandTransform
+dxf_expand_transform_multiply
+(
+        const DxfExpandTransform *a,
+                /*!< the second transformation. */
+        const DxfExpandTransform *b
+                /*!< the first transformation. */
+)
+{
+        DxfExpandTransform result;
+        int i;
+        int j;
+
+        for (i = 0; i < 4; i++)
+        {
+                for (j = 0; j < 4; j++)
+                {
+                        result.m[i][j] = a->m[i][0] * b->m[0][j]
+                          + a->m[i][1] * b->m[1][j]
+                          + a->m[i][2] * b->m[2][j]
+                          + a->m[i][3] * b->m[3][j];
+                }
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Transform a point.
+ *
+ * \return the transformed point.
+ */
+DxfVec3
+dxf_expand_transform_apply
+(
+        const DxfExpandTransform *transform,
+                /*!< the transformation (affine). */
+        DxfVec3 point
+                /*!< the point. */
+)
+{
+        const double (*m)[4] = transform->m;
+        DxfVec3 p;
+
+        p.x = m[0][0] * point.x + m[0][1] * point.y + m[0][2] * point.z + m[0][3];
+        p.y = m[1][0] * point.x + m[1][1] * point.y + m[1][2] * point.z + m[1][3];
+        p.z = m[2][0] * point.x + m[2][1] * point.y + m[2][2] * point.z + m[2][3];
+        return (p);
+}
+
+
+/*!
+ * \brief Get the transformation of the (first) block reference of an
+ * insert.
+ *
+ * A point of the block is moved from the base point of the block to
+ * the origin, scaled, rotated about the Z-axis, moved to the insertion
+ * point and transformed from the OCS of the insert to WCS.\n
+ * A scale factor of 0.0 is taken as 1.0.
+ *
+ * \return the transformation from the block coordinate system to WCS.
+ */
+DxfExpandTransform
+dxf_expand_get_insert_transform
+(
+        DxfInsert *insert,
+                /*!< the insert. */
+        DxfVec3 base_point
+                /*!< base point of the block. */
+)
+{
+        DxfExpandTransform transform;
+        DxfOcs ocs;
+        DxfVec3 x_axis;
+        DxfVec3 y_axis;
+        DxfVec3 z_axis;
+        DxfVec3 origin;
+        double c = cos (insert->rot_angle * M_PI / 180.0);
+        double s = sin (insert->rot_angle * M_PI / 180.0);
+        double x_scale = (insert->rel_x_scale == 0.0) ? 1.0 : insert->rel_x_scale;
+        double y_scale = (insert->rel_y_scale == 0.0) ? 1.0 : insert->rel_y_scale;
+        double z_scale = (insert->rel_z_scale == 0.0) ? 1.0 : insert->rel_z_scale;
+
+        dxf_ocs_init (&ocs, insert->extr_x0, insert->extr_y0, insert->extr_z0);
+        x_axis = dxf_ocs_to_wcs (&ocs, c * x_scale, s * x_scale, 0.0);
+        y_axis = dxf_ocs_to_wcs (&ocs, -s * y_scale, c * y_scale, 0.0);
+        z_axis = dxf_ocs_to_wcs (&ocs, 0.0, 0.0, z_scale);
+        origin = dxf_ocs_to_wcs (&ocs, insert->x0, insert->y0, insert->z0);
+        transform.m[0][0] = x_axis.x;
+        transform.m[1][0] = x_axis.y;
+        transform.m[2][0] = x_axis.z;
+        transform.m[0][1] = y_axis.x;
+        transform.m[1][1] = y_axis.y;
+        transform.m[2][1] = y_axis.z;
+        transform.m[0][2] = z_axis.x;
+        transform.m[1][2] = z_axis.y;
+        transform.m[2][2] = z_axis.z;
+        transform.m[0][3] = origin.x - x_axis.x * base_point.x - y_axis.x * base_point.y - z_axis.x * base_point.z;
+        transform.m[1][3] = origin.y - x_axis.y * base_point.x - y_axis.y * base_point.y - z_axis.y * base_point.z;
+        transform.m[2][3] = origin.z - x_axis.z * base_point.x - y_axis.z * base_point.y - z_axis.z * base_point.z;
+        transform.m[3][0] = 0.0;
+        transform.m[3][1] = 0.0;
+        transform.m[3][2] = 0.0;
+        transform.m[3][3] = 1.0;
+        return (transform);
+}
+
+
+/*!
+ * \brief Allocate memory for a cache of flattened blocks.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfExpandCache *
+dxf_expand_cache_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfExpandCache *cache = NULL;
+        size_t size;
+
+        size = sizeof (DxfExpandCache);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((cache = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfExpandCache struct.\n")),
+                  __FUNCTION__);
+                cache = NULL;
+        }
+        else
+        {
+                memset (cache, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (cache);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a cache of
+ * flattened blocks.
+ *
+ * The tolerance is initialized to the default angle of
+ * \c dxf_tessellation_get_number_of_segments().
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfExpandCache *
+dxf_expand_cache_init
+(
+        DxfExpandCache *cache
+                /*!< a pointer to a cache of flattened blocks. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (cache == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                cache = dxf_expand_cache_new ();
+        }
+        if (cache == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfExpandCache struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        cache->intern = (struct DxfIntern *) dxf_intern_init (dxf_intern_new ());
+        if (cache->intern == NULL)
+        {
+                free (cache);
+                return (NULL);
+        }
+        cache->entries = NULL;
+        cache->entries_size = 0;
+        cache->tolerance.chord_height = 0.0;
+        cache->tolerance.angle = 0.0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (cache);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a cache of flattened blocks and
+ * the flattened geometry of its blocks.
+ *
+ * The entities of the blocks are not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_expand_cache_free
+(
+        DxfExpandCache *cache
+                /*!< a pointer to the memory occupied by the cache. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (cache == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (cache->intern != NULL)
+        {
+                dxf_intern_free ((DxfIntern *) cache->intern);
+        }
+        for (i = 0; i < cache->entries_size; i++)
+        {
+                free (cache->entries[i].geometry.points);
+                free (cache->entries[i].geometry.runs);
+        }
+        free (cache->entries);
+        free (cache);
+        cache = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set the entities of a block in a cache.
+ *
+ * The entities are not copied, they must stay valid as long as the
+ * cache is used.\n
+ * The contents of all blocks are set before the first block is
+ * flattened, setting the contents of a block again discards its
+ * flattened geometry but not the geometry of the blocks referencing
+ * it.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_expand_cache_set_block
+(
+        DxfExpandCache *cache,
+                /*!< a pointer to a cache of flattened blocks. */
+        DxfBlock *block,
+                /*!< the block (for its name and base point). */
+        DxfDrawingEntity *entities,
+                /*!< an array of the entities of the block, in the block
+                 * coordinate system. */
+        int number_of_entities
+                /*!< number of entities in \c entities. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfExpandBlock *entries = NULL;
+        DxfExpandBlock *entry = NULL;
+        int id;
+        int size;
+
+        /* Do some basic checks. */
+        if ((cache == NULL) || (block == NULL) || (block->block_name == NULL)
+          || ((number_of_entities > 0) && (entities == NULL)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_intern_string ((DxfIntern *) cache->intern, block->block_name) == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        id = dxf_intern_get_id ((DxfIntern *) cache->intern, block->block_name);
+        if (id >= cache->entries_size)
+        {
+                size = (cache->entries_size == 0) ? 16 : cache->entries_size;
+                while (size <= id)
+                {
+                        size *= 2;
+                }
+                entries = realloc (cache->entries, size * sizeof (DxfExpandBlock));
+                if (entries == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for cache entries.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                memset (entries + cache->entries_size, 0,
+                  (size - cache->entries_size) * sizeof (DxfExpandBlock));
+                cache->entries = entries;
+                cache->entries_size = size;
+        }
+        entry = &cache->entries[id];
+        entry->valid = TRUE;
+        entry->base_point.x = block->x0;
+        entry->base_point.y = block->y0;
+        entry->base_point.z = block->z0;
+        entry->entities = entities;
+        entry->number_of_entities = number_of_entities;
+        entry->state = 0;
+        entry->result = EXIT_SUCCESS;
+        dxf_tessellation_buffer_clear (&entry->geometry);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get a block from a cache.
+ *
+ * \return a pointer to the cache entry, or \c NULL when the entities of
+ * the block are not set.
+ */
+DxfExpandBlock *
+dxf_expand_cache_get_block
+(
+        DxfExpandCache *cache,
+                /*!< a pointer to a cache of flattened blocks. */
+        const char *block_name
+                /*!< name of the block. */
+)
+{
+        int id;
+
+        if ((cache == NULL) || (block_name == NULL))
+        {
+                return (NULL);
+        }
+        id = dxf_intern_get_id ((DxfIntern *) cache->intern, block_name);
+        if ((id < 0) || (id >= cache->entries_size) || !cache->entries[id].valid)
+        {
+                return (NULL);
+        }
+        return (&cache->entries[id]);
+}
+
+
+/*!
+ * \brief Flatten all blocks of a cache.
+ *
+ * After this the cache is not modified by \c dxf_expand_insert() and
+ * \c dxf_expand_entities(), so any number of threads can expand
+ * inserts with it.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated or an error occurred.
+ */
+int
+dxf_expand_cache_flatten
+(
+        DxfExpandCache *cache
+                /*!< a pointer to a cache of flattened blocks. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result = EXIT_SUCCESS;
+        int i;
+
+        /* Do some basic checks. */
+        if (cache == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < cache->entries_size; i++)
+        {
+                if (cache->entries[i].valid)
+                {
+                        result |= dxf_expand_flatten_block (cache, &cache->entries[i], 0);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Expand an insert into a buffer.
+ *
+ * The flattened geometry of the block is transformed to WCS for every
+ * block reference of the insert (one for an \c INSERT, \c rows times
+ * \c columns for a \c MINSERT) and appended to the buffer.\n
+ * The block is flattened first when it is not flattened yet.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * entities of the block are not set, no memory could be allocated or an
+ * error occurred.
+ */
+int
+dxf_expand_insert
+(
+        DxfExpandCache *cache,
+                /*!< a pointer to a cache of flattened blocks. */
+        DxfInsert *insert,
+                /*!< a pointer to the DXF \c INSERT entity. */
+        int index,
+                /*!< index of the insert, stored with its polylines. */
+        DxfTessellationBuffer *buffer
+                /*!< the buffer receiving the polylines. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfExpandBlock *block = NULL;
+        int result;
+
+        /* Do some basic checks. */
+        if ((cache == NULL) || (insert == NULL) || (buffer == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        block = dxf_expand_cache_get_block (cache, insert->block_name);
+        if (block == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        result = dxf_expand_flatten_block (cache, block, 0);
+        if (result == EXIT_SUCCESS)
+        {
+                result = dxf_expand_add_insert (buffer, block, insert, index);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Run a worker thread of \c dxf_expand_entities().
+ *
+ * \return \c NULL.
+ */
+static void *
+dxf_expand_worker
+(
+        void *data
+                /*!< a pointer to the \c DxfExpandJob. */
+)
+{
+        DxfExpandJob *job = (DxfExpandJob *) data;
+        DxfExpandTask *task = NULL;
+        DxfExpandBlock *block = NULL;
+        DxfDrawingEntity *entity = NULL;
+        int i;
+        int j;
+
+        while ((i = __atomic_fetch_add (&job->next_task, 1, __ATOMIC_RELAXED)) < job->number_of_tasks)
+        {
+                task = &job->tasks[i];
+                for (j = task->first; (j < task->last) && (task->result == EXIT_SUCCESS); j++)
+                {
+                        entity = &job->entities[j];
+                        if (entity->entity == NULL)
+                        {
+                                continue;
+                        }
+                        if (entity->type != INSERT)
+                        {
+                                if (dxf_tessellation_add_entity (&job->cache->tolerance,
+                                  entity->type, entity->entity, j, &task->buffer) == EXIT_SUCCESS)
+                                {
+                                        task->number_of_entities++;
+                                }
+                                continue;
+                        }
+                        block = dxf_expand_cache_get_block (job->cache,
+                          ((DxfInsert *) entity->entity)->block_name);
+                        if ((block == NULL) || (block->state != 2) || (block->result != EXIT_SUCCESS))
+                        {
+                                continue;
+                        }
+                        task->result = dxf_expand_add_insert (&task->buffer, block,
+                          (DxfInsert *) entity->entity, j);
+                        if (task->result == EXIT_SUCCESS)
+                        {
+                                task->number_of_entities++;
+                        }
+                }
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Expand a number of DXF entities into a buffer on multiple
+ * threads.
+ *
+ * All blocks of the cache are flattened first (see
+ * \c dxf_expand_cache_flatten()), then every thread expands
+ * \c DXF_EXPAND_ENTITIES_PER_TASK entities at a time into a private
+ * buffer: inserts with \c dxf_expand_insert(), other entities with
+ * \c dxf_tessellation_add_entity().\n
+ * The private buffers are appended to \c buffer in entity order, so the
+ * output does not depend on the number of threads.\n
+ * Inserts of unknown blocks and entities without a tessellation are
+ * skipped.\n
+ * The entities and the blocks must not be modified while they are
+ * expanded.
+ *
+ * \return the number of entities expanded, or -1 when an error
+ * occurred.
+ */
+int
+dxf_expand_entities
+(
+        DxfExpandCache *cache,
+                /*!< a pointer to a cache of flattened blocks. */
+        DxfDrawingEntity *entities,
+                /*!< an array of entities, for example the
+                 * \c entities container of a drawing. */
+        int number_of_entities,
+                /*!< number of entities in \c entities. */
+        DxfTessellationBuffer *buffer,
+                /*!< the buffer receiving the polylines. */
+        int number_of_threads
+                /*!< number of threads, 0 for the number of online
+                 * processors. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfExpandJob job;
+        DxfExpandTask *task = NULL;
+        pthread_t *threads = NULL;
+        int number_of_expanded = 0;
+        int number_of_points;
+        int number_of_runs;
+        int started = 0;
+        int i;
+
+        /* Do some basic checks. */
+        if ((cache == NULL) || (buffer == NULL)
+          || ((number_of_entities > 0) && (entities == NULL)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (dxf_expand_cache_flatten (cache) != EXIT_SUCCESS)
+        {
+                return (-1);
+        }
+        if (number_of_threads <= 0)
+        {
+                number_of_threads = (int) sysconf (_SC_NPROCESSORS_ONLN);
+        }
+        memset (&job, 0, sizeof (DxfExpandJob));
+        job.cache = cache;
+        job.entities = entities;
+        job.number_of_tasks = (number_of_entities + DXF_EXPAND_ENTITIES_PER_TASK - 1)
+          / DXF_EXPAND_ENTITIES_PER_TASK;
+        if (number_of_threads > job.number_of_tasks)
+        {
+                number_of_threads = job.number_of_tasks;
+        }
+        job.tasks = calloc (job.number_of_tasks + 1, sizeof (DxfExpandTask));
+        threads = malloc ((number_of_threads + 1) * sizeof (pthread_t));
+        if ((job.tasks == NULL) || (threads == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for expansion tasks.\n")),
+                  __FUNCTION__);
+                free (job.tasks);
+                free (threads);
+                return (-1);
+        }
+        for (i = 0; i < job.number_of_tasks; i++)
+        {
+                job.tasks[i].first = i * DXF_EXPAND_ENTITIES_PER_TASK;
+                job.tasks[i].last = job.tasks[i].first + DXF_EXPAND_ENTITIES_PER_TASK;
+                if (job.tasks[i].last > number_of_entities)
+                {
+                        job.tasks[i].last = number_of_entities;
+                }
+        }
+        for (i = 1; i < number_of_threads; i++)
+        {
+                if (pthread_create (&threads[started], NULL, dxf_expand_worker, &job) == 0)
+                {
+                        started++;
+                }
+        }
+        /* The calling thread takes work too. */
+        dxf_expand_worker (&job);
+        for (i = 0; i < started; i++)
+        {
+                pthread_join (threads[i], NULL);
+        }
+        /* Append the polylines of the tasks in order. */
+        number_of_points = buffer->number_of_points;
+        number_of_runs = buffer->number_of_runs;
+        for (i = 0; i < job.number_of_tasks; i++)
+        {
+                task = &job.tasks[i];
+                if ((number_of_expanded >= 0) && (task->result == EXIT_SUCCESS)
+                  && (dxf_tessellation_buffer_append (buffer, &task->buffer, -1) == EXIT_SUCCESS))
+                {
+                        number_of_expanded += task->number_of_entities;
+                }
+                else
+                {
+                        number_of_expanded = -1;
+                }
+                free (task->buffer.points);
+                free (task->buffer.runs);
+        }
+        if (number_of_expanded < 0)
+        {
+                buffer->number_of_points = number_of_points;
+                buffer->number_of_runs = number_of_runs;
+        }
+        free (job.tasks);
+        free (threads);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (number_of_expanded);
+}
+
+
+/* EOF */
@@ -0,0 +1,206 @@
+/*!
+ * \file expand.h
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Header file for the expansion of block references (\c INSERT entities).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_EXPAND_H
+#define LIBDXF_SRC_EXPAND_H
+
+
+#include "global.h"
+#include "vec.h"
+#include "intern.h"
+#include "drawing.h"
+#include "entity.h"
+#include "block.h"
+#include "insert.h"
+#include "tessellation.h"
+
+
+#define DXF_EXPAND_MAX_DEPTH 64
+        /*!< \brief The maximum nesting depth of blocks. */
+
+
+#define DXF_EXPAND_ENTITIES_PER_TASK 256
+        /*!< \brief The number of entities expanded by a thread of
+         * \c dxf_expand_entities() before claiming the next
+         * entities. */
+
+
+/*!
+ * \brief Definition of a 4x4 matrix of an affine transformation of
+ * homogeneous points (a column vector is multiplied from the left).
+ */
+typedef struct
+dxf_expand_transform
+{
+        double m[4][4];
+                /*!< The elements, row by row. */
+} DxfExpandTransform;
+
+
+/*!
+ * \brief Definition of an entry in a \c DxfExpandCache.
+ */
+typedef struct
+dxf_expand_block
+{
+        int valid;
+                /*!< \c TRUE when the contents of the block are set. */
+        DxfVec3 base_point;
+                /*!< Base point of the block. */
+        DxfDrawingEntity *entities;
+                /*!< Array of the entities of the block (not owned by
+                 * the cache). */
+        int number_of_entities;
+                /*!< Number of entities in \c entities. */
+        int state;
+                /*!< 0 when not flattened, 1 while being flattened, 2
+                 * when flattened. */
+        int result;
+                /*!< \c EXIT_SUCCESS, or \c EXIT_FAILURE when no memory
+                 * could be allocated, once flattened. */
+        DxfTessellationBuffer geometry;
+                /*!< The flattened entities of the block in the block
+                 * coordinate system, with nested inserts expanded (the
+                 * entity index of a polyline is the index in
+                 * \c entities). */
+} DxfExpandBlock;
+
+
+/*!
+ * \brief Definition of a cache of flattened blocks.
+ *
+ * Blocks do not hold their entities in libDXF, so the entities of every
+ * block are passed once by the application with
+ * \c dxf_expand_cache_set_block().\n
+ * A block is flattened once, when it is first referenced: its entities
+ * are tessellated (see \c dxf_tessellation_add_entity()) in the block
+ * coordinate system and its nested inserts are expanded depth first.
+ * Every \c INSERT of the block then only transforms the flattened
+ * geometry.\n
+ * Inserts of unknown blocks, cyclic references and entities without a
+ * tessellation are skipped.\n
+ * The tolerance applies in the block coordinate system, so the chord
+ * height in the drawing grows with the scale of the inserts.\n
+ * Block names are kept in a private intern table, the id of an interned
+ * name indexes the \c entries.\n
+ * Once all blocks are flattened with \c dxf_expand_cache_flatten() the
+ * cache is no longer modified and can be used by any number of threads.
+ */
+typedef struct
+dxf_expand_cache
+{
+        struct DxfIntern *intern;
+                /*!< Intern table for the block names. */
+        DxfExpandBlock *entries;
+                /*!< Array of entries, indexed by the id of the block
+                 * name in \c intern. */
+        int entries_size;
+                /*!< Number of allocated entries. */
+        DxfTessellation tolerance;
+                /*!< The tolerance of the tessellation of the blocks,
+                 * set before the first block is flattened. */
+} DxfExpandCache;
+
+
+DxfExpandTransform
+dxf_expand_transform_multiply
+(
+        const DxfExpandTransform *a,
+        const DxfExpandTransform *b
+);
+DxfVec3
+dxf_expand_transform_apply
+(
+        const DxfExpandTransform *transform,
+        DxfVec3 point
+);
+DxfExpandTransform
+dxf_expand_get_insert_transform
+(
+        DxfInsert *insert,
+        DxfVec3 base_point
+);
+DxfExpandCache *
+dxf_expand_cache_new ();
+DxfExpandCache *
+dxf_expand_cache_init
+(
+        DxfExpandCache *cache
+);
+int
+dxf_expand_cache_free
+(
+        DxfExpandCache *cache
+);
+int
+dxf_expand_cache_set_block
+(
+        DxfExpandCache *cache,
+        DxfBlock *block,
+        DxfDrawingEntity *entities,
+        int number_of_entities
+);
+DxfExpandBlock *
+dxf_expand_cache_get_block
+(
+        DxfExpandCache *cache,
+        const char *block_name
+);
+int
+dxf_expand_cache_flatten
+(
+        DxfExpandCache *cache
+);
+int
+dxf_expand_insert
+(
+        DxfExpandCache *cache,
+        DxfInsert *insert,
+        int index,
+        DxfTessellationBuffer *buffer
+);
+int
+dxf_expand_entities
+(
+        DxfExpandCache *cache,
+        DxfDrawingEntity *entities,
+        int number_of_entities,
+        DxfTessellationBuffer *buffer,
+        int number_of_threads
+);
+
+#endif /* LIBDXF_SRC_EXPAND_H */
+
+
+/* EOF */
@@ -32,32 +32,107 @@
  */
 
 
+#include <pthread.h>
+#include <unistd.h>
 #include "file.h"
+#include "drawing.h"
+#include "bounds.h"
+#include "3dface.h"
+#include "3dsolid.h"
+#include "acad_proxy_entity.h"
+#include "arc.h"
+#include "attdef.h"
+#include "attrib.h"
+#include "body.h"
+#include "circle.h"
+#include "dimension.h"
+#include "ellipse.h"
+#include "hatch.h"
+#include "helix.h"
+#include "image.h"
+#include "insert.h"
+#include "leader.h"
+#include "line.h"
+#include "lwpolyline.h"
+#include "mtext.h"
+#include "ole2frame.h"
+#include "oleframe.h"
+#include "point.h"
+#include "polyline.h"
+#include "ray.h"
+#include "region.h"
+#include "shape.h"
+#include "solid.h"
+#include "spline.h"
+#include "table.h"
+#include "text.h"
+#include "tolerance.h"
+#include "trace.h"
+#include "vertex.h"
+#include "viewport.h"
+#include "xline.h"
 
 
-char *dxf_entities_list;
-char *dxf_objects_list;
-char *dxf_blocks_list;
-DxfThumbnail *dxf_thumbnail;
+/*!
+ * \brief A part of the output of \c dxf_file_write_parallel().
+ */
+typedef struct
+dxf_file_write_task
+{
+        int section;
+                /*!< The section, a \c DXF_DRAWING_SECTION_* value. */
+        DxfChunkListIter iter;
+                /*!< Iterator positioned at the first entity
+                 * (\c DXF_DRAWING_SECTION_ENTITIES only). */
+        int number_of_entities;
+                /*!< Number of entities to write
+                 * (\c DXF_DRAWING_SECTION_ENTITIES only). */
+        char *buffer;
+                /*!< The serialized output. */
+        size_t buffer_size;
+                /*!< Number of bytes in \c buffer. */
+        int result;
+                /*!< \c EXIT_SUCCESS or \c EXIT_FAILURE. */
+} DxfFileWriteTask;
 
 
 /*!
- * \brief Function opens and reads a DXF file.
- * 
- * After opening the DXF file with the name \c filename the file is read
- * line by line until a line containing the \c SECTION keyword is
- * encountered.\n
- * At this point a function which reads the \c SECTION until the
- * \c ENDSEC keyword is encountered and the invoked fuction returns here.
+ * \brief The tasks shared by the threads of
+ * \c dxf_file_write_parallel().
  */
-int
-dxf_file_read
+typedef struct
+dxf_file_write_job
+{
+        DxfFile *fp;
+                /*!< The output file, the settings of which are used
+                 * for every task. */
+        DxfDrawing *drawing;
+                /*!< The drawing to write. */
+        DxfFileWriteTask *tasks;
+                /*!< Array of tasks in output order. */
+        int number_of_tasks;
+                /*!< Number of tasks. */
+        int next_task;
+                /*!< Index of the next unclaimed task. */
+} DxfFileWriteJob;
+
+
+/*!
+ * \brief Read a DXF file into a new drawing.
+ *
+ * \c drawing is freed when an error occurred.
+ */
+static DxfDrawing *
+dxf_file_read_drawing
 (
-        char *filename
+        char *filename,
                 /*!< filename of input file (or device). */
+        DxfDrawing *drawing
+                /*!< a new drawing. */
 )
 {
         char temp_string[DXF_MAX_STRING_LENGTH];
+        char *group_code = NULL;
         DxfFile *fp;
 #if DEBUG
         DXF_DEBUG_BEGIN
@@ -69,12 +144,24 @@ dxf_file_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                return (EXIT_FAILURE);
+                dxf_drawing_free (drawing);
+                return (NULL);
         }
-        while (fp)
+        /* The readers intern the symbol names in the intern table of
+         * the drawing, and register the handles of the entities in its
+         * handle table. */
+        fp->intern = drawing->intern;
+        fp->handle_table = drawing->handle_table;
+        while (!feof (fp->fp))
         {
-                dxf_read_line (temp_string, fp);
-                if (strcmp (temp_string, "999") == 0)
+                if (dxf_read_line (temp_string, fp) == EOF)
+                {
+                        break;
+                }
+                /* Group codes may be right aligned (as written by
+                 * libDXF). */
+                group_code = temp_string + strspn (temp_string, " ");
+                if (strcmp (group_code, "999") == 0)
                 {
                         /* Flush dxf comments to stdout as some apps put meta
                          * data regarding the correct loading of libraries in
@@ -83,7 +170,7 @@ dxf_file_read
                         dxf_read_line (temp_string, fp);
                         fprintf (stdout, "DXF comment: %s\n", temp_string);
                 }
-                else if (strcmp (temp_string, "0") == 0)
+                else if (strcmp (group_code, "0") == 0)
                 {
                 /* Now follows some meaningfull dxf data. */
                         while (!feof (fp->fp))
@@ -93,7 +180,14 @@ dxf_file_read
                                 {
                                          /* We have found the beginning of a
                                           * SECTION. */
-                                        dxf_section_read (fp);
+                                        dxf_section_read (fp, drawing);
+                                }
+                                else if ((strcmp (temp_string + strspn (temp_string, " "), "0") == 0)
+                                  || (strcmp (temp_string, "EOF") == 0))
+                                {
+                                        /* The group code of the next
+                                         * SECTION, or the end of file. */
+                                        continue;
                                 }
                                 else
                                 {
@@ -110,40 +204,368 @@ dxf_file_read
                         fprintf (stderr,
                           (_("Warning: unexpected string encountered while reading line %d from: %s.\n")),
                           fp->line_number , fp->filename);
-                        return (EXIT_FAILURE);
+                        dxf_read_close (fp);
+                        dxf_drawing_free (drawing);
+                        return (NULL);
                 }
         }
         dxf_read_close (fp);
+        dxf_drawing_sync_handle_seed (drawing);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (drawing);
+}
+
+
+/*!
+ * \brief Function opens and reads a DXF file.
+ * 
+ * After opening the DXF file with the name \c filename the file is read
+ * line by line until a line containing the \c SECTION keyword is
+ * encountered.\n
+ * At this point a function which reads the \c SECTION until the
+ * \c ENDSEC keyword is encountered and the invoked fuction returns here.\n
+ * All parse state is kept in the returned drawing and on the stack, so
+ * different files can be read concurrently from different threads.
+ *
+ * \warning Only the \c HEADER and \c ENTITIES sections are parsed.
+ * The \c CLASSES, \c TABLES, \c BLOCKS, \c OBJECTS and \c THUMBNAIL
+ * sections are skipped, so the layers, blocks and objects of the file
+ * are not part of the returned drawing.
+ *
+ * \return a pointer to the drawing read from the file, to be freed with
+ * \c dxf_drawing_free(), or \c NULL when an error occurred.
+ */
+DxfDrawing *
+dxf_file_read
+(
+        char *filename
+                /*!< filename of input file (or device). */
+)
+{
+        DxfDrawing *drawing = NULL;
+
+        /* The header defaults are replaced when the HEADER section is
+         * read. */
+        drawing = dxf_drawing_init (dxf_drawing_new (), AutoCAD_2000);
+        if (drawing == NULL)
+        {
+                return (NULL);
+        }
+        return (dxf_file_read_drawing (filename, drawing));
+}
+
+
+/*!
+ * \brief Function opens and reads a DXF file, keeping the \c LINE and
+ * \c POINT entities in columnar stores.
+ *
+ * Like \c dxf_file_read(), but the \c LINE and \c POINT entities of the
+ * \c ENTITIES section are read into the stores returned by
+ * \c dxf_drawing_get_line_columns() and
+ * \c dxf_drawing_get_point_columns() instead of the entities
+ * container.\n
+ * The handles of these entities are not registered in the handle table
+ * of the drawing.
+ *
+ * \return a pointer to the drawing read from the file, to be freed with
+ * \c dxf_drawing_free(), or \c NULL when an error occurred.
+ */
+DxfDrawing *
+dxf_file_read_columnar
+(
+        char *filename
+                /*!< filename of input file (or device). */
+)
+{
+        DxfDrawing *drawing = NULL;
+
+        drawing = dxf_drawing_init (dxf_drawing_new (), AutoCAD_2000);
+        if (drawing == NULL)
+        {
+                return (NULL);
+        }
+        if (dxf_drawing_enable_columns (drawing) == EXIT_FAILURE)
+        {
+                dxf_drawing_free (drawing);
+                return (NULL);
+        }
+        return (dxf_file_read_drawing (filename, drawing));
+}
+
+
+/*!
+ * \brief Write DXF output to a file for an entity of any type.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred or the type has no writer.
+ */
+int
+dxf_file_write_entity
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        int type,
+                /*!< type of the entity, a \c DxfEntityType value. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((fp == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        switch (type)
+        {
+                case DFACE:
+                        return (dxf_3dface_write (fp, (Dxf3dface *) entity));
+                case DSOLID:
+                        return (dxf_3dsolid_write (fp, (Dxf3dsolid *) entity));
+                case ACADPROXYENTITY:
+                        return (dxf_acad_proxy_entity_write (fp, (DxfAcadProxyEntity *) entity));
+                case ARC:
+                        return (dxf_arc_write (fp, (DxfArc *) entity));
+                case ATTDEF:
+                        return (dxf_attdef_write (fp, (DxfAttdef *) entity));
+                case ATTRIB:
+                        return (dxf_attrib_write (fp, (DxfAttrib *) entity));
+                case BODY:
+                        return (dxf_body_write (fp, (DxfBody *) entity));
+                case CIRCLE:
+                        return (dxf_circle_write (fp, (DxfCircle *) entity));
+                case DIMENSION:
+                        return (dxf_dimension_write (fp, (DxfDimension *) entity));
+                case ELLIPSE:
+                        return (dxf_ellipse_write (fp, (DxfEllipse *) entity));
+                case HATCH:
+                        return (dxf_hatch_write (fp, (DxfHatch *) entity));
+                case HELIX:
+                        return (dxf_helix_write (fp, (DxfHelix *) entity));
+                case IMAGE:
+                        return (dxf_image_write (fp, (DxfImage *) entity));
+                case INSERT:
+                        return (dxf_insert_write (fp, (DxfInsert *) entity));
+                case LEADER:
+                        return (dxf_leader_write (fp, (DxfLeader *) entity));
+                case LINE:
+                        return (dxf_line_write (fp, (DxfLine *) entity));
+                case LWPOLYLINE:
+                        return (dxf_lwpolyline_write (fp, (DxfLWPolyline *) entity));
+                case MTEXT:
+                        return (dxf_mtext_write (fp, (DxfMtext *) entity));
+                case OLEFRAME:
+                        return (dxf_oleframe_write (fp, (DxfOleFrame *) entity));
+                case OLE2FRAME:
+                        return (dxf_ole2frame_write (fp, (DxfOle2Frame *) entity));
+                case POINT:
+                        return (dxf_point_write (fp, (DxfPoint *) entity));
+                case POLYLINE:
+                        return (dxf_polyline_write (fp, (DxfPolyline *) entity));
+                case RAY:
+                        return (dxf_ray_write (fp, (DxfRay *) entity));
+                case REGION:
+                        return (dxf_region_write (fp, (DxfRegion *) entity));
+                case SHAPE:
+                        return (dxf_shape_write (fp, (DxfShape *) entity));
+                case SOLID:
+                        return (dxf_solid_write (fp, (DxfSolid *) entity));
+                case SPLINE:
+                        return (dxf_spline_write (fp, (DxfSpline *) entity));
+                case TABLE:
+                        return (dxf_table_write (fp, (DxfTable *) entity));
+                case TEXT:
+                        return (dxf_text_write (fp, (DxfText *) entity));
+                case TOLERANCE:
+                        return (dxf_tolerance_write (fp, (DxfTolerance *) entity));
+                case TRACE:
+                        return (dxf_trace_write (fp, (DxfTrace *) entity));
+                case VERTEX:
+                        return (dxf_vertex_write (fp, (DxfVertex *) entity));
+                case VIEWPORT:
+                        return (dxf_viewport_write (fp, (DxfViewport *) entity));
+                case XLINE:
+                        return (dxf_xline_write (fp, (DxfXLine *) entity));
+                default:
+                        fprintf (stderr,
+                          (_("Error in %s () received an entity type without a writer: %d.\n")),
+                          __FUNCTION__, type);
+                        break;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Write DXF output to a file for one section of a drawing.
+ *
+ * The entities are written by \c dxf_file_write_entities().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_file_write_section
+(
+        DxfFile *fp,
+                /*!< file pointer to output file (or device). */
+        DxfDrawing *drawing,
+                /*!< the drawing to write. */
+        int section
+                /*!< the section, a \c DXF_DRAWING_SECTION_* value. */
+)
+{
+        DxfHeader header;
+        DxfBounds bounds;
+        DxfClass *class = NULL;
+        DxfBlock *block = NULL;
+        char handle_seed_string[17];
+        uint64_t handle_seed;
+        int result = EXIT_SUCCESS;
+
+        switch (section)
+        {
+                case DXF_DRAWING_SECTION_HEADER:
+                        if (drawing->header == NULL)
+                        {
+                                break;
+                        }
+                        header = *((DxfHeader *) drawing->header);
+                        handle_seed = dxf_drawing_get_handle_seed (drawing);
+                        if ((header.HandSeed == NULL)
+                          || (dxf_handle_table_parse_handle (header.HandSeed) < handle_seed))
+                        {
+                                /* Write the handles reserved in the
+                                 * drawing, the drawing itself is left
+                                 * untouched (it may be frozen). */
+                                snprintf (handle_seed_string, sizeof (handle_seed_string), "%" PRIX64, handle_seed);
+                                header.HandSeed = handle_seed_string;
+                        }
+                        if (fp->update_extents
+                          && (dxf_drawing_get_bounds (drawing, NULL, &bounds) == EXIT_SUCCESS))
+                        {
+                                dxf_bounds_set_header_extents (&header, &bounds);
+                        }
+                        result |= dxf_header_write (fp, &header);
+                        break;
+                case DXF_DRAWING_SECTION_CLASSES:
+                        if (drawing->class_list != NULL)
+                        {
+                                dxf_section_write (fp, "CLASSES");
+                                for (class = (DxfClass *) drawing->class_list; class != NULL; class = (DxfClass *) class->next)
+                                {
+                                        result |= dxf_class_write (fp, class);
+                                }
+                                dxf_endsec_write (fp);
+                        }
+                        break;
+                case DXF_DRAWING_SECTION_TABLES:
+                        if (drawing->tables_list != NULL)
+                        {
+                                result |= dxf_tables_write (fp, (DxfTables *) drawing->tables_list);
+                        }
+                        break;
+                case DXF_DRAWING_SECTION_BLOCKS:
+                        if (drawing->block_list != NULL)
+                        {
+                                dxf_section_write (fp, "BLOCKS");
+                                for (block = (DxfBlock *) drawing->block_list; block != NULL; block = (DxfBlock *) block->next)
+                                {
+                                        result |= dxf_block_write (fp, block);
+                                }
+                                dxf_endsec_write (fp);
+                        }
+                        break;
+                case DXF_DRAWING_SECTION_OBJECTS:
+                        if (drawing->object_list != NULL)
+                        {
+                                dxf_section_write (fp, "OBJECTS");
+                                result |= dxf_object_write_objects (fp, (DxfObject *) drawing->object_list);
+                                dxf_endsec_write (fp);
+                        }
+                        break;
+                case DXF_DRAWING_SECTION_THUMBNAIL:
+                        if (drawing->thumbnail != NULL)
+                        {
+                                dxf_section_write (fp, "THUMBNAILIMAGE");
+                                result |= dxf_thumbnail_write (fp, (DxfThumbnail *) drawing->thumbnail);
+                                dxf_endsec_write (fp);
+                        }
+                        break;
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Write DXF output to a file for a range of entries of the
+ * entities container of a drawing.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_file_write_entities
+(
+        DxfFile *fp,
+                /*!< file pointer to output file (or device). */
+        DxfChunkListIter *iter,
+                /*!< iterator positioned at the first entry. */
+        int number_of_entities
+                /*!< number of entries to write, -1 for all remaining
+                 * entries. */
+)
+{
+        DxfDrawingEntity *entry = NULL;
+        int result = EXIT_SUCCESS;
+
+        while ((number_of_entities != 0)
+          && ((entry = (DxfDrawingEntity *) dxf_chunk_list_iter_next (iter)) != NULL))
+        {
+                result |= dxf_file_write_entity (fp, entry->type, entry->entity);
+                if (number_of_entities > 0)
+                {
+                        number_of_entities--;
+                }
+        }
+        return (result);
 }
 
 
 /*!
  * \brief Function generates dxf output to a file for a complete DXF file.
+ *
+ * The sections present in \c drawing are written in DXF order, the
+ * entities in the order of the entities container of the drawing.\n
+ * The output depends only on \c drawing and \c fp->acad_version_number.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  */
 int
 dxf_file_write
 (
         DxfFile *fp,
                 /*!< file pointer to output file (or device). */
-        DxfHeader dxf_header,
-                /*!< a dxf header. */
-        DxfClass dxf_classes_list,
-                /*!< pointer to a list of CLASSES. */
-        DxfTable dxf_tables_list
-                /*!< pointer to a list of TABLES. */
+        DxfDrawing *drawing
+                /*!< the drawing to write. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        extern char *dxf_entities_list;
-        extern char *dxf_objects_list;
-//        DxfBlock *dxf_blocks_list;
-        extern DxfThumbnail *dxf_thumbnail;
+        DxfChunkListIter iter;
+        int result = EXIT_SUCCESS;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -153,19 +575,266 @@ dxf_file_write
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-//        dxf_header_init (dxf_header);
-//        dxf_header_write (fp, dxf_header);
-//        dxf_write_classes (fp, dxf_classes_list);
-//        dxf_write_tables (fp, dxf_tables_list);
-//        dxf_block_write_table (fp, dxf_blocks_list);
-//        dxf_entities_write_table (fp, dxf_entities_list);
-//        dxf_object_write_objects (fp, dxf_objects_list);
-//        dxf_thumbnail_write (fp, dxf_thumbnail);
-//        dxf_file_write_eof (fp);
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result |= dxf_file_write_section (fp, drawing, DXF_DRAWING_SECTION_HEADER);
+        result |= dxf_file_write_section (fp, drawing, DXF_DRAWING_SECTION_CLASSES);
+        result |= dxf_file_write_section (fp, drawing, DXF_DRAWING_SECTION_TABLES);
+        result |= dxf_file_write_section (fp, drawing, DXF_DRAWING_SECTION_BLOCKS);
+        dxf_section_write (fp, "ENTITIES");
+        if (drawing->entities != NULL)
+        {
+                dxf_chunk_list_iter_init ((DxfChunkList *) drawing->entities, &iter);
+                result |= dxf_file_write_entities (fp, &iter, -1);
+        }
+        dxf_endsec_write (fp);
+        result |= dxf_file_write_section (fp, drawing, DXF_DRAWING_SECTION_OBJECTS);
+        result |= dxf_file_write_section (fp, drawing, DXF_DRAWING_SECTION_THUMBNAIL);
+        result |= dxf_file_write_eof (fp);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return ((result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Run a worker thread of \c dxf_file_write_parallel().
+ *
+ * Takes the next unclaimed task until all tasks are claimed, every
+ * task is serialized into a private memory buffer.
+ *
+ * \return \c NULL.
+ */
+static void *
+dxf_file_write_worker
+(
+        void *data
+                /*!< a pointer to the \c DxfFileWriteJob. */
+)
+{
+        DxfFileWriteJob *job = (DxfFileWriteJob *) data;
+        DxfFileWriteTask *task = NULL;
+        DxfFile buffer_fp;
+        int i;
+
+        while ((i = __atomic_fetch_add (&job->next_task, 1, __ATOMIC_RELAXED)) < job->number_of_tasks)
+        {
+                task = &job->tasks[i];
+                buffer_fp = *job->fp;
+                buffer_fp.fp = open_memstream (&task->buffer, &task->buffer_size);
+                if (buffer_fp.fp == NULL)
+                {
+                        task->result = EXIT_FAILURE;
+                        continue;
+                }
+                if (task->section == DXF_DRAWING_SECTION_ENTITIES)
+                {
+                        task->result = dxf_file_write_entities (&buffer_fp, &task->iter, task->number_of_entities);
+                }
+                else
+                {
+                        task->result = dxf_file_write_section (&buffer_fp, job->drawing, task->section);
+                }
+                if (fclose (buffer_fp.fp) != 0)
+                {
+                        task->result = EXIT_FAILURE;
+                }
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Write the buffers of a range of tasks of
+ * \c dxf_file_write_parallel() to a file and free the buffers.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred in one of the tasks or while writing.
+ */
+static int
+dxf_file_write_buffers
+(
+        DxfFile *fp,
+                /*!< file pointer to output file (or device). */
+        DxfFileWriteTask *tasks,
+                /*!< array of tasks. */
+        int first,
+                /*!< index of the first task. */
+        int last
+                /*!< index past the last task. */
+)
+{
+        int result = EXIT_SUCCESS;
+        int i;
+
+        for (i = first; i < last; i++)
+        {
+                result |= tasks[i].result;
+                if ((tasks[i].buffer_size > 0)
+                  && (fwrite (tasks[i].buffer, 1, tasks[i].buffer_size, fp->fp) != tasks[i].buffer_size))
+                {
+                        result = EXIT_FAILURE;
+                }
+                free (tasks[i].buffer);
+                tasks[i].buffer = NULL;
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Function generates dxf output to a file for a complete DXF
+ * file on multiple threads.
+ *
+ * The sections of the drawing and ranges of at least
+ * \c DXF_FILE_WRITE_ENTITIES_PER_TASK entities are serialized
+ * concurrently into private memory buffers, which are then written to
+ * \c fp in order.\n
+ * The output is identical to the output of \c dxf_file_write().\n
+ * The writers substitute defaults (e.g. layer 0 for an empty layer)
+ * in the output only, neither the entities nor the intern table of
+ * the drawing are modified by the worker threads.\n
+ * The drawing must not be modified while it is written, frozen
+ * drawings (see \c dxf_drawing_freeze()) are safe.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_file_write_parallel
+(
+        DxfFile *fp,
+                /*!< file pointer to output file (or device). */
+        DxfDrawing *drawing,
+                /*!< the drawing to write. */
+        int number_of_threads
+                /*!< number of threads, 0 for the number of online
+                 * processors. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const int sections[] =
+        {
+                DXF_DRAWING_SECTION_HEADER,
+                DXF_DRAWING_SECTION_CLASSES,
+                DXF_DRAWING_SECTION_TABLES,
+                DXF_DRAWING_SECTION_BLOCKS,
+                DXF_DRAWING_SECTION_OBJECTS,
+                DXF_DRAWING_SECTION_THUMBNAIL
+        };
+        const int number_of_sections = sizeof (sections) / sizeof (sections[0]);
+        DxfFileWriteJob job;
+        DxfFileWriteTask *task = NULL;
+        DxfChunkList *entities = NULL;
+        DxfChunkListBlock *block = NULL;
+        pthread_t *threads = NULL;
+        int number_of_tasks;
+        int number_of_entities;
+        int started;
+        int result = EXIT_SUCCESS;
+        int i;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (number_of_threads <= 0)
+        {
+                number_of_threads = (int) sysconf (_SC_NPROCESSORS_ONLN);
+        }
+        if (number_of_threads <= 1)
+        {
+                return (dxf_file_write (fp, drawing));
+        }
+        entities = (DxfChunkList *) drawing->entities;
+        number_of_entities = (entities == NULL) ? 0 : entities->number_of_entries;
+        number_of_tasks = number_of_sections
+          + (number_of_entities / DXF_FILE_WRITE_ENTITIES_PER_TASK) + 1;
+        job.tasks = malloc (number_of_tasks * sizeof (DxfFileWriteTask));
+        threads = malloc (number_of_threads * sizeof (pthread_t));
+        if ((job.tasks == NULL) || (threads == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for write tasks.\n")),
+                  __FUNCTION__);
+                free (job.tasks);
+                free (threads);
+                return (EXIT_FAILURE);
+        }
+        memset (job.tasks, 0, number_of_tasks * sizeof (DxfFileWriteTask));
+        /* The sections other than ENTITIES, in DXF order. */
+        for (i = 0; i < number_of_sections; i++)
+        {
+                job.tasks[i].section = sections[i];
+        }
+        /* Ranges of whole blocks of the entities container. */
+        number_of_tasks = number_of_sections;
+        block = (entities == NULL) ? NULL : (DxfChunkListBlock *) entities->first;
+        while (block != NULL)
+        {
+                task = &job.tasks[number_of_tasks++];
+                task->section = DXF_DRAWING_SECTION_ENTITIES;
+                task->iter.list = entities;
+                task->iter.block = (struct DxfChunkListBlock *) block;
+                task->iter.index = 0;
+                while ((block != NULL)
+                  && (task->number_of_entities < DXF_FILE_WRITE_ENTITIES_PER_TASK))
+                {
+                        task->number_of_entities += block->number_of_entries;
+                        block = (DxfChunkListBlock *) block->next;
+                }
+        }
+        job.fp = fp;
+        job.drawing = drawing;
+        job.number_of_tasks = number_of_tasks;
+        job.next_task = 0;
+        started = 0;
+        for (i = 1; i < number_of_threads; i++)
+        {
+                if (pthread_create (&threads[started], NULL, dxf_file_write_worker, &job) == 0)
+                {
+                        started++;
+                }
+        }
+        /* The calling thread takes tasks too. */
+        dxf_file_write_worker (&job);
+        for (i = 0; i < started; i++)
+        {
+                pthread_join (threads[i], NULL);
+        }
+        /* Concatenate the buffers in order, the ENTITIES section goes
+         * between the BLOCKS and OBJECTS sections. */
+        result |= dxf_file_write_buffers (fp, job.tasks, 0, number_of_sections - 2);
+        dxf_section_write (fp, "ENTITIES");
+        result |= dxf_file_write_buffers (fp, job.tasks, number_of_sections, number_of_tasks);
+        dxf_endsec_write (fp);
+        result |= dxf_file_write_buffers (fp, job.tasks, number_of_sections - 2, number_of_sections);
+        result |= dxf_file_write_eof (fp);
+        free (threads);
+        free (job.tasks);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
 }
 
 
@@ -49,10 +49,26 @@
 #include "util.h"
 
 
-int
+#define DXF_FILE_WRITE_ENTITIES_PER_TASK 4096
+        /*!< \brief The minimum number of entities serialized by one
+         * task of \c dxf_file_write_parallel(). */
+
+
+/* Defined in drawing.h, which can not be included here as it
+ * includes this file indirectly. */
+struct dxf_drawing_struct;
+
+
+struct dxf_drawing_struct *
 dxf_file_read (char *filename);
+struct dxf_drawing_struct *
+dxf_file_read_columnar (char *filename);
+int
+dxf_file_write_entity (DxfFile *fp, int type, void *entity);
+int
+dxf_file_write (DxfFile *fp, struct dxf_drawing_struct *drawing);
 int
-dxf_file_write (DxfFile *fp, DxfHeader dxf_header, DxfClass dxf_classes_list, DxfTable dxf_tables_list);
+dxf_file_write_parallel (DxfFile *fp, struct dxf_drawing_struct *drawing, int number_of_threads);
 int
 dxf_file_write_eof (DxfFile *fp);
 
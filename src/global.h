@@ -171,6 +171,20 @@ dxf_file
         /*!< AutoCAD version number. */
     int follow_strict_version_rules;
         /*!< follow strict rules when writing to file. */
+    struct DxfIntern *intern;
+        /*!< Intern table for symbol names (layer, linetype, style and
+         * block names), \c NULL when entities hold private copies. */
+    struct DxfHandleTable *handle_table;
+        /*!< Handle table filled while reading, \c NULL when handles
+         * are not to be registered. */
+    int build_meshes;
+        /*!< Read the vertices of polyface and polygon mesh polylines
+         * into an indexed mesh (\c DxfIndexedMesh) in stead of a list
+         * of \c DxfVertex entities. */
+    int update_extents;
+        /*!< Write \c $EXTMIN and \c $EXTMAX calculated from the
+         * entities of the drawing (see \c dxf_drawing_get_bounds())
+         * in stead of the values of the header. */
 } DxfFile;
 
 
@@ -35,6 +35,8 @@
 
 
 #include "group.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -168,7 +170,7 @@ dxf_group_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
@@ -185,9 +187,10 @@ dxf_group_read
                 group = dxf_group_new ();
                 group = dxf_group_init (group);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -195,7 +198,7 @@ dxf_group_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -238,28 +241,28 @@ dxf_group_read
                 {
                         /* Now follows a string containing a description. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", group->description);
+                        group->description = dxf_read_string (fp, group->description);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", group->dictionary_owner_soft);
+                        group->dictionary_owner_soft = dxf_read_string (fp, group->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "340") == 0)
                 {
                         /* Now follows a string containing a handle to an
                          * entry in group object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", group->handle_entity_in_group);
+                        group->handle_entity_in_group = dxf_read_string (fp, group->handle_entity_in_group);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", group->dictionary_owner_hard);
+                        group->dictionary_owner_hard = dxf_read_string (fp, group->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -273,10 +276,22 @@ dxf_group_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
+        }
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (group->id_code > 0))
+        {
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) group->id_code, GROUP, group);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1235,4 +1250,45 @@ dxf_group_set_next
 }
 
 
+/*!
+ * \brief Resolve the \c handle_entity_in_group of a DXF \c GROUP
+ * object into the entity.
+ *
+ * \return a pointer to the entity, or \c NULL when the handle could not
+ * be resolved.
+ */
+void *
+dxf_group_resolve_handle_entity_in_group
+(
+        DxfGroup *group,
+                /*!< a pointer to a DXF \c GROUP object. */
+        DxfHandleTable *handle_table,
+                /*!< a pointer to the DXF handle table of the drawing. */
+        int *type
+                /*!< the \c DxfEntityType of the entity is stored here
+                 * (may be \c NULL). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        void *result = NULL;
+
+        /* Do some basic checks. */
+        if ((group == NULL) || (handle_table == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        result = dxf_handle_table_resolve_string (handle_table,
+          group->handle_entity_in_group, type);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
 /* EOF*/
@@ -39,6 +39,7 @@
 
 
 #include "global.h"
+#include "handle_table.h"
 
 
 /*!
@@ -210,6 +211,13 @@ dxf_group_set_next
         DxfGroup *group,
         DxfGroup *next
 );
+void *
+dxf_group_resolve_handle_entity_in_group
+(
+        DxfGroup *group,
+        DxfHandleTable *handle_table,
+        int *type
+);
 
 
 #endif /* LIBDXF_SRC_GROUP_H */
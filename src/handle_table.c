@@ -0,0 +1,655 @@
+/*!
+ * \file handle_table.c
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Functions for a libDXF handle table (handle to object resolution).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "handle_table.h"
+
+
+/*!
+ * \brief Calculate the home slot for a handle.
+ *
+ * Handles are mostly sequential numbers, so the bits are mixed before
+ * masking (the finalizer of the SplitMix64 generator).
+ *
+ * \return the index of the home slot.
+ */
+static int
+dxf_handle_table_home_slot
+(
+        DxfHandleTable *handle_table,
+                /*!< a pointer to a DXF handle table. */
+        uint64_t handle
+                /*!< a handle. */
+)
+{
+        handle ^= handle >> 30;
+        handle *= UINT64_C(0xbf58476d1ce4e5b9);
+        handle ^= handle >> 27;
+        handle *= UINT64_C(0x94d049bb133111eb);
+        handle ^= handle >> 31;
+        return ((int) (handle & (uint64_t) (handle_table->number_of_slots - 1)));
+}
+
+
+/*!
+ * \brief Find the slot for a handle in a DXF handle table.
+ *
+ * \return the index of the slot containing \c handle, or the index of
+ * the empty slot where \c handle is to be inserted.
+ */
+static int
+dxf_handle_table_find_slot
+(
+        DxfHandleTable *handle_table,
+                /*!< a pointer to a DXF handle table. */
+        uint64_t handle
+                /*!< a handle. */
+)
+{
+        int mask;
+        int i;
+
+        mask = handle_table->number_of_slots - 1;
+        i = dxf_handle_table_home_slot (handle_table, handle);
+        while ((handle_table->slots[i].object != NULL)
+          && (handle_table->slots[i].handle != handle))
+        {
+                i = (i + 1) & mask;
+        }
+        return (i);
+}
+
+
+/*!
+ * \brief Double the number of slots in a DXF handle table.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_handle_table_grow
+(
+        DxfHandleTable *handle_table
+                /*!< a pointer to a DXF handle table. */
+)
+{
+        DxfHandleTableEntry *old_slots = NULL;
+        int old_number_of_slots;
+        int i;
+        int j;
+
+        old_slots = handle_table->slots;
+        old_number_of_slots = handle_table->number_of_slots;
+        handle_table->slots = calloc (2 * old_number_of_slots, sizeof (DxfHandleTableEntry));
+        if (handle_table->slots == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for handle table slots.\n")),
+                  __FUNCTION__);
+                handle_table->slots = old_slots;
+                return (EXIT_FAILURE);
+        }
+        handle_table->number_of_slots = 2 * old_number_of_slots;
+        for (i = 0; i < old_number_of_slots; i++)
+        {
+                if (old_slots[i].object != NULL)
+                {
+                        j = dxf_handle_table_find_slot (handle_table, old_slots[i].handle);
+                        handle_table->slots[j] = old_slots[i];
+                }
+        }
+        free (old_slots);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a DXF handle table.
+ *
+ * Fill the memory contents with zeros.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfHandleTable *
+dxf_handle_table_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHandleTable *handle_table = NULL;
+        size_t size;
+
+        size = sizeof (DxfHandleTable);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((handle_table = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfHandleTable struct.\n")),
+                  __FUNCTION__);
+                handle_table = NULL;
+        }
+        else
+        {
+                memset (handle_table, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (handle_table);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a DXF handle
+ * table.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfHandleTable *
+dxf_handle_table_init
+(
+        DxfHandleTable *handle_table
+                /*!< a pointer to a DXF handle table. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (handle_table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                handle_table = dxf_handle_table_new ();
+        }
+        if (handle_table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfHandleTable struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        handle_table->number_of_slots = DXF_HANDLE_TABLE_INITIAL_NUMBER_OF_SLOTS;
+        handle_table->number_of_entries = 0;
+        handle_table->slots = calloc (handle_table->number_of_slots, sizeof (DxfHandleTableEntry));
+        if (handle_table->slots == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for handle table slots.\n")),
+                  __FUNCTION__);
+                free (handle_table);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (handle_table);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a DXF handle table.
+ *
+ * The entities and objects refered to by the table are not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_handle_table_free
+(
+        DxfHandleTable *handle_table
+                /*!< a pointer to the memory occupied by the DXF handle
+                 * table. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (handle_table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (handle_table->slots);
+        free (handle_table);
+        handle_table = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Convert a hexadecimal handle string (as found in group codes
+ * 5, 105, 330 ... 369 and 390) into a handle.
+ *
+ * \return the handle, or 0 (never a valid handle) when the string is
+ * empty or does not contain a hexadecimal number.
+ */
+uint64_t
+dxf_handle_table_parse_handle
+(
+        const char *handle_string
+                /*!< a string containing a hexadecimal handle. */
+)
+{
+        uint64_t handle = 0;
+        int digit;
+
+        if (handle_string == NULL)
+        {
+                return (0);
+        }
+        while (isspace ((unsigned char) *handle_string))
+        {
+                handle_string++;
+        }
+        for (; *handle_string != '\0'; handle_string++)
+        {
+                if ((*handle_string >= '0') && (*handle_string <= '9'))
+                {
+                        digit = *handle_string - '0';
+                }
+                else if ((*handle_string >= 'A') && (*handle_string <= 'F'))
+                {
+                        digit = *handle_string - 'A' + 10;
+                }
+                else if ((*handle_string >= 'a') && (*handle_string <= 'f'))
+                {
+                        digit = *handle_string - 'a' + 10;
+                }
+                else
+                {
+                        break;
+                }
+                handle = (handle << 4) | (uint64_t) digit;
+        }
+        return (handle);
+}
+
+
+/*!
+ * \brief Insert (or replace) the entity or object owning a handle in a
+ * DXF handle table.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_handle_table_insert
+(
+        DxfHandleTable *handle_table,
+                /*!< a pointer to a DXF handle table. */
+        uint64_t handle,
+                /*!< the handle of the entity or object. */
+        int type,
+                /*!< the type of the entity or object, either a
+                 * \c DxfEntityType or a \c DxfObjectType value. */
+        void *object
+                /*!< a pointer to the entity or object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if ((handle_table == NULL) || (object == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (handle == 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid handle (0) was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* Keep the load factor below 0.7. */
+        if (10 * (handle_table->number_of_entries + 1) > 7 * handle_table->number_of_slots)
+        {
+                if (dxf_handle_table_grow (handle_table) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        i = dxf_handle_table_find_slot (handle_table, handle);
+        if (handle_table->slots[i].object == NULL)
+        {
+                handle_table->number_of_entries++;
+        }
+        handle_table->slots[i].handle = handle;
+        handle_table->slots[i].type = type;
+        handle_table->slots[i].object = object;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove a handle from a DXF handle table.
+ *
+ * The following entries of the probe sequence are shifted back, so no
+ * tombstones are left behind.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * handle was not found or an error occurred.
+ */
+int
+dxf_handle_table_remove
+(
+        DxfHandleTable *handle_table,
+                /*!< a pointer to a DXF handle table. */
+        uint64_t handle
+                /*!< the handle to remove. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int mask;
+        int i;
+        int j;
+        int k;
+
+        /* Do some basic checks. */
+        if (handle_table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        mask = handle_table->number_of_slots - 1;
+        i = dxf_handle_table_find_slot (handle_table, handle);
+        if (handle_table->slots[i].object == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        j = i;
+        while (TRUE)
+        {
+                handle_table->slots[i].object = NULL;
+                do
+                {
+                        j = (j + 1) & mask;
+                        if (handle_table->slots[j].object == NULL)
+                        {
+                                handle_table->number_of_entries--;
+#if DEBUG
+                                DXF_DEBUG_END
+#endif
+                                return (EXIT_SUCCESS);
+                        }
+                        k = dxf_handle_table_home_slot (handle_table, handle_table->slots[j].handle);
+                }
+                /* Skip entries whose home slot lies cyclically in
+                 * (i, j], they are still reachable. */
+                while ((i <= j) ? ((i < k) && (k <= j)) : ((i < k) || (k <= j)));
+                handle_table->slots[i] = handle_table->slots[j];
+                i = j;
+        }
+}
+
+
+/*!
+ * \brief Resolve a handle into the entity or object owning it.
+ *
+ * \return a pointer to the entity or object, or \c NULL when the handle
+ * is not in the table.
+ */
+void *
+dxf_handle_table_resolve
+(
+        DxfHandleTable *handle_table,
+                /*!< a pointer to a DXF handle table. */
+        uint64_t handle,
+                /*!< the handle to resolve. */
+        int *type
+                /*!< the type of the entity or object is stored here
+                 * (may be \c NULL). */
+)
+{
+        int i;
+
+        /* Do some basic checks. */
+        if (handle_table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (handle == 0)
+        {
+                return (NULL);
+        }
+        i = dxf_handle_table_find_slot (handle_table, handle);
+        if ((type != NULL) && (handle_table->slots[i].object != NULL))
+        {
+                *type = handle_table->slots[i].type;
+        }
+        return (handle_table->slots[i].object);
+}
+
+
+/*!
+ * \brief Resolve a handle string (for example an owner dictionary
+ * member such as \c dictionary_owner_soft) into the entity or object
+ * owning it.
+ *
+ * \return a pointer to the entity or object, or \c NULL when the handle
+ * is not in the table.
+ */
+void *
+dxf_handle_table_resolve_string
+(
+        DxfHandleTable *handle_table,
+                /*!< a pointer to a DXF handle table. */
+        const char *handle_string,
+                /*!< a string containing a hexadecimal handle. */
+        int *type
+                /*!< the type of the entity or object is stored here
+                 * (may be \c NULL). */
+)
+{
+        return (dxf_handle_table_resolve (handle_table,
+          dxf_handle_table_parse_handle (handle_string), type));
+}
+
+
+/*!
+ * \brief Resolve a handle string into an entity or object of a given
+ * type.
+ *
+ * \return a pointer to the entity or object, or \c NULL when the handle
+ * is not in the table or refers to an entity or object of another type.
+ */
+void *
+dxf_handle_table_resolve_typed
+(
+        DxfHandleTable *handle_table,
+                /*!< a pointer to a DXF handle table. */
+        const char *handle_string,
+                /*!< a string containing a hexadecimal handle. */
+        int type
+                /*!< the expected type, either a \c DxfEntityType or a
+                 * \c DxfObjectType value. */
+)
+{
+        void *result = NULL;
+        int found_type;
+
+        result = dxf_handle_table_resolve_string (handle_table, handle_string, &found_type);
+        if ((result != NULL) && (found_type != type))
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () handle %s refers to an object of an unexpected type.\n")),
+                  __FUNCTION__, handle_string);
+                result = NULL;
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Get the number of entries from a DXF handle table.
+ *
+ * \return the number of entries, or -1 when an error occurred.
+ */
+int
+dxf_handle_table_get_number_of_entries
+(
+        DxfHandleTable *handle_table
+                /*!< a pointer to a DXF handle table. */
+)
+{
+        /* Do some basic checks. */
+        if (handle_table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        return (handle_table->number_of_entries);
+}
+
+
+/*!
+ * \brief Get the largest handle in a DXF handle table.
+ *
+ * \return the largest handle, or 0 when the table is empty or an error
+ * occurred.
+ */
+uint64_t
+dxf_handle_table_get_max_handle
+(
+        DxfHandleTable *handle_table
+                /*!< a pointer to a DXF handle table. */
+)
+{
+        uint64_t max_handle = 0;
+        int i;
+
+        /* Do some basic checks. */
+        if (handle_table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        for (i = 0; i < handle_table->number_of_slots; i++)
+        {
+                if ((handle_table->slots[i].object != NULL)
+                  && (handle_table->slots[i].handle > max_handle))
+                {
+                        max_handle = handle_table->slots[i].handle;
+                }
+        }
+        return (max_handle);
+}
+
+
+/*!
+ * \brief Copy a DXF handle table.
+ *
+ * The objects referenced by the entries are not copied.
+ *
+ * \return a pointer to the copy, or \c NULL when an error occurred.
+ */
+DxfHandleTable *
+dxf_handle_table_copy
+(
+        DxfHandleTable *handle_table
+                /*!< a pointer to a DXF handle table. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHandleTable *copy = NULL;
+
+        /* Do some basic checks. */
+        if (handle_table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_handle_table_new ();
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfHandleTable struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy->slots = malloc (handle_table->number_of_slots * sizeof (DxfHandleTableEntry));
+        if (copy->slots == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for handle table slots.\n")),
+                  __FUNCTION__);
+                free (copy);
+                return (NULL);
+        }
+        memcpy (copy->slots, handle_table->slots,
+          handle_table->number_of_slots * sizeof (DxfHandleTableEntry));
+        copy->number_of_slots = handle_table->number_of_slots;
+        copy->number_of_entries = handle_table->number_of_entries;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
+/* EOF */
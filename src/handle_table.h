@@ -0,0 +1,160 @@
+/*!
+ * \file handle_table.h
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Header file for a libDXF handle table (handle to object resolution).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_HANDLE_TABLE_H
+#define LIBDXF_SRC_HANDLE_TABLE_H
+
+
+#include "global.h"
+#include "object.h"
+
+
+#define DXF_HANDLE_TABLE_INITIAL_NUMBER_OF_SLOTS 1024
+        /*!< \brief The initial number of slots in a \c DxfHandleTable
+         * (has to be a power of two). */
+
+
+/*!
+ * \brief Definition of an entry in a libDXF handle table.
+ */
+typedef struct
+dxf_handle_table_entry_struct
+{
+        uint64_t handle;
+                /*!< Handle of the entity or object. */
+        int type;
+                /*!< Type of the entity or object, either a
+                 * \c DxfEntityType or a \c DxfObjectType value. */
+        void *object;
+                /*!< Pointer to the entity or object, \c NULL for an
+                 * empty slot. */
+} DxfHandleTableEntry;
+
+
+/*!
+ * \brief Definition of a libDXF handle table.
+ *
+ * Open addressing hash table (linear probing) mapping a 64-bit handle
+ * to the type and the address of the entity or object owning the
+ * handle.\n
+ * The table is filled by the readers while parsing a DXF file (when a
+ * table is attached to the \c DxfFile), so that soft and hard pointer
+ * references (owner dictionaries, \c IDBUFFER entries, \c GROUP
+ * members, image definitions, ...) resolve in constant time.
+ */
+typedef struct
+dxf_handle_table_struct
+{
+        DxfHandleTableEntry *slots;
+                /*!< Array of slots. */
+        int number_of_slots;
+                /*!< Number of slots (a power of two). */
+        int number_of_entries;
+                /*!< Number of used slots. */
+} DxfHandleTable;
+
+
+DxfHandleTable *
+dxf_handle_table_new ();
+DxfHandleTable *
+dxf_handle_table_init
+(
+        DxfHandleTable *handle_table
+);
+int
+dxf_handle_table_free
+(
+        DxfHandleTable *handle_table
+);
+uint64_t
+dxf_handle_table_parse_handle
+(
+        const char *handle_string
+);
+int
+dxf_handle_table_insert
+(
+        DxfHandleTable *handle_table,
+        uint64_t handle,
+        int type,
+        void *object
+);
+int
+dxf_handle_table_remove
+(
+        DxfHandleTable *handle_table,
+        uint64_t handle
+);
+void *
+dxf_handle_table_resolve
+(
+        DxfHandleTable *handle_table,
+        uint64_t handle,
+        int *type
+);
+void *
+dxf_handle_table_resolve_string
+(
+        DxfHandleTable *handle_table,
+        const char *handle_string,
+        int *type
+);
+void *
+dxf_handle_table_resolve_typed
+(
+        DxfHandleTable *handle_table,
+        const char *handle_string,
+        int type
+);
+int
+dxf_handle_table_get_number_of_entries
+(
+        DxfHandleTable *handle_table
+);
+uint64_t
+dxf_handle_table_get_max_handle
+(
+        DxfHandleTable *handle_table
+);
+DxfHandleTable *
+dxf_handle_table_copy
+(
+        DxfHandleTable *handle_table
+);
+
+
+#endif /* LIBDXF_SRC_HANDLE_TABLE_H */
+
+
+/* EOF */
@@ -37,6 +37,252 @@
 
 
 #include "hatch.h"
+#include "nurbs.h"
+
+
+#define DXF_HATCH_POINT_INSIDE_GRID_MIN_EDGES 32
+        /*!< \brief Minimum number of edges of a boundary path polyline
+         * for which \c dxf_hatch_boundary_path_polyline_points_inside_polyline()
+         * buckets the edges in horizontal bands. */
+#define DXF_HATCH_POINT_INSIDE_ELLIPSE_CHORDS 64
+        /*!< \brief Number of chords of an elliptical arc edge in
+         * \c dxf_hatch_boundary_path_point_inside_path(). */
+
+
+/*!
+ * \brief Edge of a boundary path polyline prepared for point in
+ * polygon tests.
+ */
+typedef struct
+dxf_hatch_polyline_edge
+{
+        double x0;
+                /*!< X-value of the start point. */
+        double y0;
+                /*!< Y-value of the start point. */
+        double x1;
+                /*!< X-value of the end point. */
+        double y1;
+                /*!< Y-value of the end point. */
+        double bulge;
+                /*!< Bulge of the edge, 0.0 for a straight edge. */
+        double xc;
+                /*!< X-value of the center of the arc. */
+        double yc;
+                /*!< Y-value of the center of the arc. */
+        double radius2;
+                /*!< Square of the radius of the arc. */
+        double ymin;
+                /*!< Lowest Y-value of the edge (chord and arc). */
+        double ymax;
+                /*!< Highest Y-value of the edge (chord and arc). */
+} DxfHatchPolylineEdge;
+
+
+/*!
+ * \brief Prepare an edge of a boundary path polyline for point in
+ * polygon tests.
+ *
+ * The center of an arc follows from the chord and the bulge without
+ * any trigonometry.
+ */
+static void
+dxf_hatch_polyline_edge_init
+(
+        DxfHatchPolylineEdge *edge,
+                /*!< the edge. */
+        double x0,
+                /*!< X-value of the start point. */
+        double y0,
+                /*!< Y-value of the start point. */
+        double x1,
+                /*!< X-value of the end point. */
+        double y1,
+                /*!< Y-value of the end point. */
+        double b
+                /*!< bulge of the edge, 0.0 for a straight edge. */
+)
+{
+        double dx;
+        double dy;
+        double h;
+
+        edge->x0 = x0;
+        edge->y0 = y0;
+        edge->x1 = x1;
+        edge->y1 = y1;
+        dx = edge->x1 - edge->x0;
+        dy = edge->y1 - edge->y0;
+        if ((dx == 0.0) && (dy == 0.0))
+        {
+                b = 0.0;
+        }
+        edge->bulge = b;
+        edge->ymin = (edge->y0 < edge->y1) ? edge->y0 : edge->y1;
+        edge->ymax = (edge->y0 < edge->y1) ? edge->y1 : edge->y0;
+        if (b == 0.0)
+        {
+                return;
+        }
+        /* The center lies left of the chord for a positive bulge (a
+         * counterclockwise arc). */
+        h = (1.0 - b * b) / (4.0 * b);
+        edge->xc = 0.5 * (edge->x0 + edge->x1) - h * dy;
+        edge->yc = 0.5 * (edge->y0 + edge->y1) + h * dx;
+        edge->radius2 = (dx * dx + dy * dy) * (1.0 + b * b) * (1.0 + b * b)
+          / (16.0 * b * b);
+        if (fabs (b) > 1.0)
+        {
+                /* More than half a circle. */
+                h = sqrt (edge->radius2);
+                edge->ymin = (edge->ymin < edge->yc - h) ? edge->ymin : edge->yc - h;
+                edge->ymax = (edge->ymax > edge->yc + h) ? edge->ymax : edge->yc + h;
+        }
+        else
+        {
+                /* The arc lies between the chord and the chord moved
+                 * by the sagitta. */
+                h = -0.5 * b * dx;
+                edge->ymin = (edge->ymin < edge->ymin + h) ? edge->ymin : edge->ymin + h;
+                edge->ymax = (edge->ymax > edge->ymax + h) ? edge->ymax : edge->ymax + h;
+        }
+}
+
+
+/*!
+ * \brief Winding number contribution of an edge of a boundary path
+ * polyline around a point.
+ *
+ * The straight chord is counted with a crossing of a ray in the +X
+ * direction (upward crossings left of the point count +1, downward
+ * crossings -1).\n
+ * An arc adds the circular segment between the chord and the arc, so
+ * a point inside that segment gets one more turn in the direction of
+ * the arc.
+ */
+static int
+dxf_hatch_polyline_edge_winding
+(
+        const DxfHatchPolylineEdge *edge,
+                /*!< the edge. */
+        double x,
+                /*!< X-value of the point. */
+        double y
+                /*!< Y-value of the point. */
+)
+{
+        double side;
+        double dx;
+        double dy;
+        int winding = 0;
+
+        if ((y < edge->ymin) || (y > edge->ymax))
+        {
+                return (0);
+        }
+        side = (edge->x1 - edge->x0) * (y - edge->y0)
+          - (x - edge->x0) * (edge->y1 - edge->y0);
+        if (edge->y0 <= y)
+        {
+                if ((edge->y1 > y) && (side > 0.0))
+                {
+                        winding++;
+                }
+        }
+        else if ((edge->y1 <= y) && (side < 0.0))
+        {
+                winding--;
+        }
+        if (edge->bulge != 0.0)
+        {
+                if (side == 0.0)
+                {
+                        /* A point on the chord counts as moved a bit
+                         * in the +X direction (+Y for a horizontal
+                         * chord), as the crossing test does. */
+                        side = (edge->y1 != edge->y0)
+                          ? edge->y0 - edge->y1
+                          : edge->x1 - edge->x0;
+                }
+                /* A positive bulge lies right of the chord. */
+                if ((edge->bulge > 0.0) ? (side < 0.0) : (side > 0.0))
+                {
+                        dx = x - edge->xc;
+                        dy = y - edge->yc;
+                        if (dx * dx + dy * dy < edge->radius2)
+                        {
+                                winding += (edge->bulge > 0.0) ? 1 : -1;
+                        }
+                }
+        }
+        return (winding);
+}
+
+
+/*!
+ * \brief Convert the start and end angle of an arc or elliptical arc
+ * edge of a hatch boundary path to a start angle and a sweep.
+ *
+ * Clockwise edges have mirrored angles.
+ */
+static void
+dxf_hatch_get_edge_sweep
+(
+        double start_angle,
+                /*!< start angle in degrees. */
+        double end_angle,
+                /*!< end angle in degrees. */
+        int is_ccw,
+                /*!< counterclockwise flag. */
+        double *start,
+                /*!< start angle in radians (output). */
+        double *sweep
+                /*!< included angle in radians (output). */
+)
+{
+        double included = end_angle - start_angle;
+
+        while (included > 360.0)
+        {
+                included -= 360.0;
+        }
+        while (included <= 0.0)
+        {
+                included += 360.0;
+        }
+        *start = (is_ccw ? start_angle : -start_angle) * M_PI / 180.0;
+        *sweep = (is_ccw ? included : -included) * M_PI / 180.0;
+}
+
+
+/*!
+ * \brief Winding number contribution of a straight or bulged segment
+ * around a point.
+ */
+static int
+dxf_hatch_segment_winding
+(
+        double x0,
+                /*!< X-value of the start point. */
+        double y0,
+                /*!< Y-value of the start point. */
+        double x1,
+                /*!< X-value of the end point. */
+        double y1,
+                /*!< Y-value of the end point. */
+        double bulge,
+                /*!< bulge of the segment, 0.0 for a straight segment. */
+        double x,
+                /*!< X-value of the point. */
+        double y
+                /*!< Y-value of the point. */
+)
+{
+        DxfHatchPolylineEdge edge;
+
+        dxf_hatch_polyline_edge_init (&edge, x0, y0, x1, y1, bulge);
+        return (dxf_hatch_polyline_edge_winding (&edge, x, y));
+}
 
 
 /* dxf_hatch functions. */
@@ -168,6 +414,8 @@ dxf_hatch_write
         DxfBinaryGraphicsData *data = NULL;
         DxfHatchPatternDefLine *line = NULL;
         DxfHatchPatternSeedPoint *point = NULL;
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -197,7 +445,8 @@ dxf_hatch_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (hatch->layer, "") == 0)
+        layer = hatch->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning: empty layer string for the %s entity with id-code: %x\n")),
@@ -205,9 +454,10 @@ dxf_hatch_write
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0")),
                         dxf_entity_name);
-                hatch->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = DXF_DEFAULT_LAYER;
         }
-        if (strcmp (hatch->linetype, "") == 0)
+        linetype = hatch->linetype;
+        if (strcmp (linetype, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning: empty linetype string for the %s entity with id-code: %x\n")),
@@ -215,7 +465,7 @@ dxf_hatch_write
                 fprintf (stderr,
                   (_("    %s entity is reset to default linetype")),
                         dxf_entity_name);
-                hatch->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = DXF_DEFAULT_LINETYPE;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -255,10 +505,10 @@ dxf_hatch_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", hatch->layer);
-        if (strcmp (hatch->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (strcmp (linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", hatch->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
@@ -414,6 +664,7 @@ dxf_hatch_free_chain
         while (hatches != NULL)
         {
                 struct DxfHatch *iter = hatches->next;
+                hatches->next = NULL;
                 dxf_hatch_free (hatches);
                 hatches = (DxfHatch *) iter;
         }
@@ -2984,6 +3235,7 @@ dxf_hatch_pattern_free_chain
         while (patterns != NULL)
         {
                 struct DxfHatchPattern *iter = patterns->next;
+                patterns->next = NULL;
                 dxf_hatch_pattern_free (patterns);
                 patterns = (DxfHatchPattern *) iter;
         }
@@ -3606,6 +3858,7 @@ dxf_hatch_pattern_def_line_dash_free_chain
         while (dashes != NULL)
         {
                 struct DxfHatchPatternDefLineDash *iter = dashes->next;
+                dashes->next = NULL;
                 dxf_hatch_pattern_def_line_dash_free (dashes);
                 dashes = (DxfHatchPatternDefLineDash *) iter;
         }
@@ -3998,6 +4251,7 @@ dxf_hatch_pattern_def_line_free_chain
         while (lines != NULL)
         {
                 struct DxfHatchPatternDefLine *iter = lines->next;
+                lines->next = NULL;
                 dxf_hatch_pattern_def_line_free (lines);
                 lines = (DxfHatchPatternDefLine *) iter;
         }
@@ -4842,6 +5096,7 @@ dxf_hatch_pattern_seedpoint_free_chain
         while (hatch_pattern_seed_points != NULL)
         {
                 struct DxfHatchPatternSeedPoint *iter = hatch_pattern_seed_points->next;
+                hatch_pattern_seed_points->next = NULL;
                 dxf_hatch_pattern_seedpoint_free (hatch_pattern_seed_points);
                 hatch_pattern_seed_points = (DxfHatchPatternSeedPoint *) iter;
         }
@@ -5212,6 +5467,7 @@ dxf_hatch_boundary_path_init
                 return (NULL);
         }
         path->id_code = 0;
+        path->boundary_path_type_flag = 0;
         dxf_hatch_boundary_path_edge_init ((DxfHatchBoundaryPathEdge *) path->edges);
         dxf_hatch_boundary_path_polyline_init ((DxfHatchBoundaryPathPolyline *) path->polylines);
         path->next = NULL;
@@ -5375,6 +5631,7 @@ dxf_hatch_boundary_path_free_chain
         while (hatch_boundary_paths != NULL)
         {
                 struct DxfHatchBoundaryPath *iter = hatch_boundary_paths->next;
+                hatch_boundary_paths->next = NULL;
                 dxf_hatch_boundary_path_free (hatch_boundary_paths);
                 hatch_boundary_paths = (DxfHatchBoundaryPath *) iter;
         }
@@ -5464,6 +5721,87 @@ dxf_hatch_boundary_path_set_id_code
 }
 
 
+/*!
+ * \brief Get the boundary path type flag from a DXF \c HATCH boundary
+ * path.
+ *
+ * \return boundary path type flag.
+ */
+int
+dxf_hatch_boundary_path_get_boundary_path_type_flag
+(
+        DxfHatchBoundaryPath *path
+                /*!< a pointer to a DXF \c HATCH boundary path. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result;
+
+        /* Do some basic checks. */
+        if (path == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (path->boundary_path_type_flag < 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a negative value was found in the boundary_path_type_flag member.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result = path->boundary_path_type_flag;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Set the boundary path type flag for a DXF \c HATCH boundary
+ * path.
+ */
+DxfHatchBoundaryPath *
+dxf_hatch_boundary_path_set_boundary_path_type_flag
+(
+        DxfHatchBoundaryPath *path,
+                /*!< a pointer to a DXF \c HATCH boundary path. */
+        int boundary_path_type_flag
+                /*!< boundary path type flag, a combination of
+                 * \c DXF_HATCH_BOUNDARY_PATH_* values. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (path == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (boundary_path_type_flag < 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a negative boundary path type flag value was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        path->boundary_path_type_flag = boundary_path_type_flag;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (path);
+}
+
+
 /*!
  * \brief Get the edges from a DXF \c HATCH boundary path.
  *
@@ -5693,6 +6031,171 @@ dxf_hatch_boundary_path_set_next
 }
 
 
+/*!
+ * \brief Compute if the coordinates of a point \c p lie inside or
+ * outside a DXF hatch boundary path \c path.
+ *
+ * The winding number of the polylines and edges of the path around
+ * the point is computed as in
+ * \c dxf_hatch_boundary_path_polyline_point_inside_polyline().\n
+ * Line and arc edges are exact, elliptical arc edges are divided in
+ * \c DXF_HATCH_POINT_INSIDE_ELLIPSE_CHORDS chords and spline edges are
+ * tessellated with \c dxf_nurbs_tessellate().\n
+ * The edges may be kept in any order, as long as they form a closed
+ * loop.
+ *
+ * \note A point exactly on the boundary may be reported as inside or
+ * outside.
+ *
+ * \return \c INSIDE if an interior point, \c OUTSIDE if an exterior
+ * point, or \c EXIT_FAILURE if the path is empty, has an invalid spline
+ * edge or an error occurred.
+ */
+int
+dxf_hatch_boundary_path_point_inside_path
+(
+        DxfHatchBoundaryPath *path,
+                /*!< a pointer to a DXF \c HATCH boundary path. */
+        DxfVec2 point
+                /*!< The point to be tested for. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathEdge *edge = NULL;
+        DxfHatchBoundaryPathEdgeArc *arc = NULL;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse = NULL;
+        DxfHatchBoundaryPathEdgeLine *line = NULL;
+        DxfHatchBoundaryPathEdgeSpline *spline = NULL;
+        DxfHatchBoundaryPathPolyline *polyline = NULL;
+        DxfHatchBoundaryPathPolylineVertex *vertex = NULL;
+        DxfHatchBoundaryPathPolylineVertex *next = NULL;
+        DxfNurbs *nurbs = NULL;
+        DxfVec3 *points = NULL;
+        double start;
+        double sweep;
+        double bulge;
+        double t0;
+        double t1;
+        int number_of_points;
+        int empty = TRUE;
+        int winding = 0;
+        int i;
+
+        /* Do some basic checks. */
+        if (path == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (edge = (DxfHatchBoundaryPathEdge *) path->edges; edge != NULL; edge = (DxfHatchBoundaryPathEdge *) edge->next)
+        {
+                for (line = (DxfHatchBoundaryPathEdgeLine *) edge->lines; line != NULL; line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+                {
+                        winding += dxf_hatch_segment_winding (line->x0, line->y0,
+                          line->x1, line->y1, 0.0, point.x, point.y);
+                        empty = FALSE;
+                }
+                for (arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs; arc != NULL; arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+                {
+                        /* Two halves, so that a full circle has a
+                         * finite bulge. */
+                        dxf_hatch_get_edge_sweep (arc->start_angle, arc->end_angle,
+                          arc->is_ccw, &start, &sweep);
+                        bulge = tan (sweep / 8.0);
+                        for (i = 0; i < 2; i++)
+                        {
+                                t0 = start + 0.5 * i * sweep;
+                                t1 = start + 0.5 * (i + 1) * sweep;
+                                winding += dxf_hatch_segment_winding (
+                                  arc->x0 + arc->radius * cos (t0),
+                                  arc->y0 + arc->radius * sin (t0),
+                                  arc->x0 + arc->radius * cos (t1),
+                                  arc->y0 + arc->radius * sin (t1),
+                                  bulge, point.x, point.y);
+                        }
+                        empty = FALSE;
+                }
+                for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses; ellipse != NULL; ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+                {
+                        /* The minor axis is the major axis rotated a
+                         * quarter turn. */
+                        dxf_hatch_get_edge_sweep (ellipse->start_angle, ellipse->end_angle,
+                          ellipse->is_ccw, &start, &sweep);
+                        for (i = 0; i < DXF_HATCH_POINT_INSIDE_ELLIPSE_CHORDS; i++)
+                        {
+                                t0 = start + sweep * i / DXF_HATCH_POINT_INSIDE_ELLIPSE_CHORDS;
+                                t1 = start + sweep * (i + 1) / DXF_HATCH_POINT_INSIDE_ELLIPSE_CHORDS;
+                                winding += dxf_hatch_segment_winding (
+                                  ellipse->x0 + ellipse->x1 * cos (t0) - ellipse->ratio * ellipse->y1 * sin (t0),
+                                  ellipse->y0 + ellipse->y1 * cos (t0) + ellipse->ratio * ellipse->x1 * sin (t0),
+                                  ellipse->x0 + ellipse->x1 * cos (t1) - ellipse->ratio * ellipse->y1 * sin (t1),
+                                  ellipse->y0 + ellipse->y1 * cos (t1) + ellipse->ratio * ellipse->x1 * sin (t1),
+                                  0.0, point.x, point.y);
+                        }
+                        empty = FALSE;
+                }
+                for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines; spline != NULL; spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+                {
+                        if ((nurbs = dxf_nurbs_init (dxf_nurbs_new ())) == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        points = NULL;
+                        number_of_points = 0;
+                        if ((dxf_nurbs_set_hatch_spline (nurbs, spline) != EXIT_SUCCESS)
+                          || (dxf_nurbs_tessellate (nurbs, 0.0, &points, &number_of_points) != EXIT_SUCCESS))
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () invalid spline edge.\n")),
+                                  __FUNCTION__);
+                                free (points);
+                                dxf_nurbs_free (nurbs);
+                                return (EXIT_FAILURE);
+                        }
+                        for (i = 1; i < number_of_points; i++)
+                        {
+                                winding += dxf_hatch_segment_winding (points[i - 1].x, points[i - 1].y,
+                                  points[i].x, points[i].y, 0.0, point.x, point.y);
+                        }
+                        free (points);
+                        dxf_nurbs_free (nurbs);
+                        empty = FALSE;
+                }
+        }
+        for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines; polyline != NULL; polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+        {
+                /* A boundary polyline is always closed. */
+                for (vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices; vertex != NULL; vertex = (DxfHatchBoundaryPathPolylineVertex *) vertex->next)
+                {
+                        next = (DxfHatchBoundaryPathPolylineVertex *) vertex->next;
+                        if (next == NULL)
+                        {
+                                next = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                        }
+                        winding += dxf_hatch_segment_winding (vertex->x0, vertex->y0,
+                          next->x0, next->y0, vertex->has_bulge ? vertex->bulge : 0.0,
+                          point.x, point.y);
+                        empty = FALSE;
+                }
+        }
+        if (empty)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () boundary path has no edges.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((winding != 0) ? INSIDE : OUTSIDE);
+}
+
+
 /* dxf_hatch_boundary_path_polyline functions. */
 
 /*!
@@ -5911,6 +6414,7 @@ dxf_hatch_boundary_path_polyline_free_chain
         while (polylines != NULL)
         {
                 struct DxfHatchBoundaryPathPolyline *iter = polylines->next;
+                polylines->next = NULL;
                 dxf_hatch_boundary_path_polyline_free (polylines);
                 polylines = (DxfHatchBoundaryPathPolyline *) iter;
         }
@@ -6441,27 +6945,17 @@ dxf_hatch_boundary_path_polyline_close_polyline
  * \brief Compute if the coordinates of a point \c p lie inside or
  * outside a DXF hatch boundary path polyline \c polyline entity.
  *
- * \author Paul Bourke <http://www.paulbourke.net/geometry/insidepoly/>\n
- * Adapted for libDXF by Bert Timmerman <bert.timmerman@xs4all.nl>
- *
- * A solution by Philippe Reverdy is to compute the sum of the angles
- * made between the test point and each pair of points making up the
- * polygon.\n
- * If this sum is (\f$ 2\pi \f$) then the point is an interior point,
- * if 0 then the point is an exterior point.\n
- * This also works for polygons with holes given the polygon is defined
- * with a path made up of coincident edges into and out of the hole as
- * is common practice in many CAD packages.\n
- *
- * \note For most of the "point-in-polygon" algorithms there is a
- * pathological case if the point being queries lies exactly on a
- * vertex.\n
- * The easiest way to cope with this is to test that as a separate
- * process and make your own decision as to whether you want to consider
- * them inside or outside.
+ * The winding number of the polyline around the point is computed
+ * with a crossing test per edge, without trigonometry and without
+ * allocating memory.\n
+ * Edges with a bulge are treated as exact arcs.\n
+ * The polyline is treated as a closed polygon, the edge from the last
+ * vertex back to the first vertex is implied.\n
+ * A non zero winding number means the point is inside, so the
+ * orientation of the polyline does not matter.
  *
- * \note It is assumed that the polygon is simple (does not intersect
- * itself).
+ * \note A point exactly on the boundary may be reported as inside or
+ * outside.
  *
  * \return \c INSIDE if an interior point, \c OUTSIDE if an exterior
  * point, or \c EXIT_FAILURE if an error occurred.
@@ -6471,13 +6965,18 @@ dxf_hatch_boundary_path_polyline_point_inside_polyline
 (
         DxfHatchBoundaryPathPolyline *polyline,
                 /*!< DXF hatch boundary path polyline entity. */
-        DxfPoint *point
+        DxfVec2 point
                 /*!< The point to be tested for. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfHatchBoundaryPathPolylineVertex *vertex = NULL;
+        DxfHatchBoundaryPathPolylineVertex *next = NULL;
+        DxfHatchPolylineEdge edge;
+        int winding = 0;
+
         /* Do some basic checks. */
         if (polyline == NULL)
         {
@@ -6486,59 +6985,229 @@ dxf_hatch_boundary_path_polyline_point_inside_polyline
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (point == NULL)
+        if (polyline->vertices == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () invalid pointer to point (NULL).\n")),
+                  (_("Error in %s () polyline has no vertices.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->is_closed != 1)
+        for (vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices; vertex != NULL; vertex = (DxfHatchBoundaryPathPolylineVertex *) vertex->next)
+        {
+                next = (DxfHatchBoundaryPathPolylineVertex *) vertex->next;
+                if (next == NULL)
+                {
+                        next = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                }
+                dxf_hatch_polyline_edge_init (&edge, vertex->x0, vertex->y0,
+                  next->x0, next->y0, vertex->has_bulge ? vertex->bulge : 0.0);
+                winding += dxf_hatch_polyline_edge_winding (&edge, point.x, point.y);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((winding != 0) ? INSIDE : OUTSIDE);
+}
+
+
+/*!
+ * \brief Compute for a number of points if they lie inside or outside
+ * a DXF hatch boundary path polyline \c polyline entity.
+ *
+ * Gives the same results as
+ * \c dxf_hatch_boundary_path_polyline_point_inside_polyline() for each
+ * point, but prepares the edges once.\n
+ * For a polyline with many edges the edges are bucketed in horizontal
+ * bands over the bounds of the polyline, so each point is tested
+ * against the few edges in its band only, and points outside the
+ * bounds are rejected without testing any edge.\n
+ * The polyline is not modified, so any number of threads can test
+ * their own points against the same polyline.
+ *
+ * \return the number of points inside the polyline, or -1 when an
+ * error occurred.
+ */
+int
+dxf_hatch_boundary_path_polyline_points_inside_polyline
+(
+        DxfHatchBoundaryPathPolyline *polyline,
+                /*!< DXF hatch boundary path polyline entity. */
+        const DxfVec2 *points,
+                /*!< an array of the points to be tested for. */
+        int number_of_points,
+                /*!< number of points in \c points. */
+        int *results
+                /*!< an array of \c number_of_points results, set to
+                 * \c INSIDE or \c OUTSIDE for each point. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathPolylineVertex *vertex = NULL;
+        DxfHatchBoundaryPathPolylineVertex *next = NULL;
+        DxfHatchPolylineEdge *edges = NULL;
+        int *band_start = NULL;
+        int *band_edges = NULL;
+        int number_of_edges = 0;
+        int number_of_bands = 1;
+        double ymin;
+        double ymax;
+        double band_height = 0.0;
+        int first;
+        int last;
+        int winding;
+        int inside = 0;
+        int band;
+        int i;
+        int j;
+
+        /* Do some basic checks. */
+        if ((polyline == NULL)
+          || ((number_of_points > 0) && ((points == NULL) || (results == NULL))))
         {
                 fprintf (stderr,
-                  (_("Error in %s () polyline is not a closed polygon.\n")),
+                  (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (EXIT_FAILURE);
+                return (-1);
         }
-        DxfHatchBoundaryPathPolylineVertex *p0;
-        DxfHatchBoundaryPathPolylineVertex *p1;
-        DxfHatchBoundaryPathPolylineVertex *iter;
-        DxfHatchBoundaryPathPolylineVertex *next;
-        double angle;
-        p0 = dxf_hatch_boundary_path_polyline_vertex_new ();
-        p1 = dxf_hatch_boundary_path_polyline_vertex_new ();
-        iter = dxf_hatch_boundary_path_polyline_vertex_new ();
-        next = dxf_hatch_boundary_path_polyline_vertex_new ();
-        iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
-        next = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
-        angle = 0;
-        for (;;)
+        if (polyline->vertices == NULL)
         {
+                fprintf (stderr,
+                  (_("Error in %s () polyline has no vertices.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (number_of_points <= 0)
+        {
+                return (0);
+        }
+        for (vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices; vertex != NULL; vertex = (DxfHatchBoundaryPathPolylineVertex *) vertex->next)
+        {
+                number_of_edges++;
+        }
+        if ((edges = malloc (number_of_edges * sizeof (DxfHatchPolylineEdge))) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        i = 0;
+        for (vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices; vertex != NULL; vertex = (DxfHatchBoundaryPathPolylineVertex *) vertex->next)
+        {
+                next = (DxfHatchBoundaryPathPolylineVertex *) vertex->next;
                 if (next == NULL)
                 {
-                        /* iter is the last vertex, no use to continue. */
-                        break;
+                        next = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
                 }
-                next = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
-                p0->x0 = iter->x0 - point->x0;
-                p0->y0 = iter->y0 - point->y0;
-                p1->x0 = next->x0 - point->x0;
-                p1->y0 = next->y0 - point->y0;
-                angle += dxf_hatch_boundary_path_polyline_vertex_angle (iter, next);
-                iter = next;
+                dxf_hatch_polyline_edge_init (&edges[i], vertex->x0, vertex->y0,
+                  next->x0, next->y0, vertex->has_bulge ? vertex->bulge : 0.0);
+                i++;
         }
-        /* clean up. */
-        dxf_hatch_boundary_path_polyline_vertex_free (p0);
-        dxf_hatch_boundary_path_polyline_vertex_free (p1);
-        if (abs (angle) < M_PI)
-                return (OUTSIDE);
-        else
-                return (INSIDE);
+        ymin = edges[0].ymin;
+        ymax = edges[0].ymax;
+        for (i = 1; i < number_of_edges; i++)
+        {
+                ymin = (edges[i].ymin < ymin) ? edges[i].ymin : ymin;
+                ymax = (edges[i].ymax > ymax) ? edges[i].ymax : ymax;
+        }
+        if ((number_of_edges >= DXF_HATCH_POINT_INSIDE_GRID_MIN_EDGES)
+          && (ymax > ymin))
+        {
+                /* About one edge per band for an evenly spread
+                 * polyline. */
+                number_of_bands = number_of_edges;
+                band_height = (ymax - ymin) / number_of_bands;
+                band_start = calloc (number_of_bands + 1, sizeof (int));
+                if (band_start == NULL)
+                {
+                        number_of_bands = 1;
+                }
+        }
+        if (band_start != NULL)
+        {
+                /* Count the edges per band, then store the edge
+                 * indices of the bands in one array. */
+                for (i = 0; i < number_of_edges; i++)
+                {
+                        first = (int) ((edges[i].ymin - ymin) / band_height);
+                        last = (int) ((edges[i].ymax - ymin) / band_height);
+                        last = (last < number_of_bands) ? last : number_of_bands - 1;
+                        for (band = first; band <= last; band++)
+                        {
+                                band_start[band + 1]++;
+                        }
+                }
+                for (band = 0; band < number_of_bands; band++)
+                {
+                        band_start[band + 1] += band_start[band];
+                }
+                band_edges = malloc ((band_start[number_of_bands] + 1) * sizeof (int));
+                if (band_edges == NULL)
+                {
+                        free (band_start);
+                        band_start = NULL;
+                        number_of_bands = 1;
+                }
+                else
+                {
+                        for (i = 0; i < number_of_edges; i++)
+                        {
+                                first = (int) ((edges[i].ymin - ymin) / band_height);
+                                last = (int) ((edges[i].ymax - ymin) / band_height);
+                                last = (last < number_of_bands) ? last : number_of_bands - 1;
+                                for (band = first; band <= last; band++)
+                                {
+                                        band_edges[band_start[band]++] = i;
+                                }
+                        }
+                        /* Filling advanced each start to the start of
+                         * the next band, shift them back. */
+                        for (band = number_of_bands; band > 0; band--)
+                        {
+                                band_start[band] = band_start[band - 1];
+                        }
+                        band_start[0] = 0;
+                }
+        }
+        for (i = 0; i < number_of_points; i++)
+        {
+                winding = 0;
+                if ((points[i].y >= ymin) && (points[i].y <= ymax))
+                {
+                        if (band_start == NULL)
+                        {
+                                for (j = 0; j < number_of_edges; j++)
+                                {
+                                        winding += dxf_hatch_polyline_edge_winding (&edges[j],
+                                          points[i].x, points[i].y);
+                                }
+                        }
+                        else
+                        {
+                                band = (int) ((points[i].y - ymin) / band_height);
+                                band = (band < number_of_bands) ? band : number_of_bands - 1;
+                                for (j = band_start[band]; j < band_start[band + 1]; j++)
+                                {
+                                        winding += dxf_hatch_polyline_edge_winding (&edges[band_edges[j]],
+                                          points[i].x, points[i].y);
+                                }
+                        }
+                }
+                results[i] = (winding != 0) ? INSIDE : OUTSIDE;
+                if (winding != 0)
+                {
+                        inside++;
+                }
+        }
+        free (band_edges);
+        free (band_start);
+        free (edges);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        /*! \todo This is a dead code path. */
-        return (EXIT_FAILURE);
+        return (inside);
 }
 
 
@@ -6737,6 +7406,7 @@ dxf_hatch_boundary_path_polyline_vertex_free_chain
         while (hatch_boundary_path_polyline_vertices != NULL)
         {
                 struct DxfHatchBoundaryPathPolylineVertex *iter = hatch_boundary_path_polyline_vertices->next;
+                hatch_boundary_path_polyline_vertices->next = NULL;
                 dxf_hatch_boundary_path_polyline_vertex_free (hatch_boundary_path_polyline_vertices);
                 hatch_boundary_path_polyline_vertices = (DxfHatchBoundaryPathPolylineVertex *) iter;
         }
@@ -7440,6 +8110,7 @@ dxf_hatch_boundary_path_edge_free_chain
         while (edges != NULL)
         {
                 struct DxfHatchBoundaryPathEdge *iter = edges->next;
+                edges->next = NULL;
                 dxf_hatch_boundary_path_edge_free (edges);
                 edges = (DxfHatchBoundaryPathEdge *) iter;
         }
@@ -8119,6 +8790,7 @@ dxf_hatch_boundary_path_edge_arc_free_chain
         while (hatch_boundary_path_edge_arcs != NULL)
         {
                 struct DxfHatchBoundaryPathEdgeArc *iter = hatch_boundary_path_edge_arcs->next;
+                hatch_boundary_path_edge_arcs->next = NULL;
                 dxf_hatch_boundary_path_edge_arc_free (hatch_boundary_path_edge_arcs);
                 hatch_boundary_path_edge_arcs = (DxfHatchBoundaryPathEdgeArc *) iter;
         }
@@ -8345,51 +9017,34 @@ dxf_hatch_boundary_path_edge_arc_set_y0
  *
  * \return the center point.
  */
-DxfPoint *
+DxfVec2
 dxf_hatch_boundary_path_edge_arc_get_center_point
 (
-        DxfHatchBoundaryPathEdgeArc *arc,
+        DxfHatchBoundaryPathEdgeArc *arc
                 /*!< a pointer to a DXF \c HATCH boundary path edge arc. */
-        int id_code
-                /*!< Identification number for the \c DXfPoint entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file. */
 )
 {
 #ifdef DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        DxfPoint *p1 = NULL;
+        DxfVec2 point;
 
+        point.x = 0.0;
+        point.y = 0.0;
         /* Do some basic checks. */
         if (arc == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        p1 = dxf_point_init (p1);
-        if (p1 == NULL)
-        {
-              fprintf (stderr,
-                  (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
-                __FUNCTION__);
-              return (NULL);
-        }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () passed id_code is smaller than 0.\n")),
-                __FUNCTION__);
+                return (point);
         }
-        p1->id_code = id_code;
-        p1->x0 = arc->x0;
-        p1->y0 = arc->y0;
+        point.x = arc->x0;
+        point.y = arc->y0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (p1);
+        return (point);
 }
 
 
@@ -8403,8 +9058,8 @@ dxf_hatch_boundary_path_edge_arc_set_center_point
 (
         DxfHatchBoundaryPathEdgeArc *arc,
                 /*!< a pointer to a DXF \c HATCH boundary path edge arc. */
-        DxfPoint *point
-                /*!< a pointer to a DXF \c POINT entity. */
+        DxfVec2 point
+                /*!< the point. */
 )
 {
 #ifdef DEBUG
@@ -8418,15 +9073,8 @@ dxf_hatch_boundary_path_edge_arc_set_center_point
                   __FUNCTION__);
                 return (NULL);
         }
-        if (point == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        arc->x0 = point->x0;
-        arc->y0 = point->y0;
+        arc->x0 = point.x;
+        arc->y0 = point.y;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -8967,6 +9615,7 @@ dxf_hatch_boundary_path_edge_ellipse_free_chain
         while (hatch_boundary_path_edge_ellipses != NULL)
         {
                 struct DxfHatchBoundaryPathEdgeEllipse *iter = hatch_boundary_path_edge_ellipses->next;
+                hatch_boundary_path_edge_ellipses->next = NULL;
                 dxf_hatch_boundary_path_edge_ellipse_free (hatch_boundary_path_edge_ellipses);
                 hatch_boundary_path_edge_ellipses = (DxfHatchBoundaryPathEdgeEllipse *) iter;
         }
@@ -9203,52 +9852,35 @@ dxf_hatch_boundary_path_edge_ellipse_set_y0
  *
  * \return the center point.
  */
-DxfPoint *
+DxfVec2
 dxf_hatch_boundary_path_edge_ellipse_get_center_point
 (
-        DxfHatchBoundaryPathEdgeEllipse *ellipse,
+        DxfHatchBoundaryPathEdgeEllipse *ellipse
                 /*!< a pointer to a DXF \c HATCH boundary path edge
                  * ellipse. */
-        int id_code
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file. */
 )
 {
 #ifdef DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        DxfPoint *p1 = NULL;
+        DxfVec2 point;
 
+        point.x = 0.0;
+        point.y = 0.0;
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        p1 = dxf_point_init (p1);
-        if (p1 == NULL)
-        {
-              fprintf (stderr,
-                  (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
-                __FUNCTION__);
-              return (NULL);
-        }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () passed id_code is smaller than 0.\n")),
-                __FUNCTION__);
+                return (point);
         }
-        p1->id_code = id_code;
-        p1->x0 = ellipse->x0;
-        p1->y0 = ellipse->y0;
+        point.x = ellipse->x0;
+        point.y = ellipse->y0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (p1);
+        return (point);
 }
 
 
@@ -9264,8 +9896,8 @@ dxf_hatch_boundary_path_edge_ellipse_set_center_point
         DxfHatchBoundaryPathEdgeEllipse *ellipse,
                 /*!< a pointer to a DXF \c HATCH boundary path edge
                  * ellipse. */
-        DxfPoint *point
-                /*!< a pointer to a DXF \c POINT entity. */
+        DxfVec2 point
+                /*!< the point. */
 )
 {
 #ifdef DEBUG
@@ -9279,15 +9911,8 @@ dxf_hatch_boundary_path_edge_ellipse_set_center_point
                   __FUNCTION__);
                 return (NULL);
         }
-        if (point == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ellipse->x0 = point->x0;
-        ellipse->y0 = point->y0;
+        ellipse->x0 = point.x;
+        ellipse->y0 = point.y;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -9439,52 +10064,35 @@ dxf_hatch_boundary_path_edge_ellipse_set_y1
  *
  * \return the end point.
  */
-DxfPoint *
+DxfVec2
 dxf_hatch_boundary_path_edge_ellipse_get_end_point
 (
-        DxfHatchBoundaryPathEdgeEllipse *ellipse,
+        DxfHatchBoundaryPathEdgeEllipse *ellipse
                 /*!< a pointer to a DXF \c HATCH boundary path edge
                  * ellipse. */
-        int id_code
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file. */
 )
 {
 #ifdef DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        DxfPoint *p1 = NULL;
+        DxfVec2 point;
 
+        point.x = 0.0;
+        point.y = 0.0;
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        p1 = dxf_point_init (p1);
-        if (p1 == NULL)
-        {
-              fprintf (stderr,
-                  (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
-                __FUNCTION__);
-              return (NULL);
-        }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () passed id_code is smaller than 0.\n")),
-                __FUNCTION__);
+                return (point);
         }
-        p1->id_code = id_code;
-        p1->x0 = ellipse->x1;
-        p1->y0 = ellipse->y1;
+        point.x = ellipse->x1;
+        point.y = ellipse->y1;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (p1);
+        return (point);
 }
 
 
@@ -9500,8 +10108,8 @@ dxf_hatch_boundary_path_edge_ellipse_set_end_point
         DxfHatchBoundaryPathEdgeEllipse *ellipse,
                 /*!< a pointer to a DXF \c HATCH boundary path edge
                  * ellipse. */
-        DxfPoint *point
-                /*!< a pointer to a DXF \c POINT entity. */
+        DxfVec2 point
+                /*!< the point. */
 )
 {
 #ifdef DEBUG
@@ -9515,15 +10123,8 @@ dxf_hatch_boundary_path_edge_ellipse_set_end_point
                   __FUNCTION__);
                 return (NULL);
         }
-        if (point == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        ellipse->x1 = point->x0;
-        ellipse->y1 = point->y0;
+        ellipse->x1 = point.x;
+        ellipse->y1 = point.y;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -10077,6 +10678,7 @@ dxf_hatch_boundary_path_edge_line_free_chain
         while (hatch_boundary_path_edge_lines != NULL)
         {
                 struct DxfHatchBoundaryPathEdgeLine *iter = hatch_boundary_path_edge_lines->next;
+                hatch_boundary_path_edge_lines->next = NULL;
                 dxf_hatch_boundary_path_edge_line_free (hatch_boundary_path_edge_lines);
                 hatch_boundary_path_edge_lines = (DxfHatchBoundaryPathEdgeLine *) iter;
         }
@@ -10307,59 +10909,34 @@ dxf_hatch_boundary_path_edge_line_set_y0
  *
  * \return the start point.
  */
-DxfPoint *
+DxfVec2
 dxf_hatch_boundary_path_edge_line_get_start_point
 (
-        DxfHatchBoundaryPathEdgeLine *line,
+        DxfHatchBoundaryPathEdgeLine *line
                 /*!< a pointer to a DXF \c HATCH boundary path edge line. */
-        int id_code
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file. */
 )
 {
 #ifdef DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        DxfPoint *p1 = NULL;
+        DxfVec2 point;
 
+        point.x = 0.0;
+        point.y = 0.0;
         /* Do some basic checks. */
         if (line == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if ((line->x0 == line->x1)
-          && (line->y0 == line->y1))
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a LINE with points with identical coordinates were passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (point);
         }
-        p1 = dxf_point_init (p1);
-        if (p1 == NULL)
-        {
-              fprintf (stderr,
-                  (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
-                __FUNCTION__);
-              return (NULL);
-        }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () passed id_code is smaller than 0.\n")),
-                __FUNCTION__);
-        }
-        p1->id_code = id_code;
-        p1->x0 = line->x0;
-        p1->y0 = line->y0;
+        point.x = line->x0;
+        point.y = line->y0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (p1);
+        return (point);
 }
 
 
@@ -10373,8 +10950,8 @@ dxf_hatch_boundary_path_edge_line_set_start_point
 (
         DxfHatchBoundaryPathEdgeLine *line,
                 /*!< a pointer to a DXF \c HATCH boundary path edge line. */
-        DxfPoint *point
-                /*!< a pointer to a DXF \c POINT entity. */
+        DxfVec2 point
+                /*!< the point. */
 )
 {
 #ifdef DEBUG
@@ -10388,15 +10965,8 @@ dxf_hatch_boundary_path_edge_line_set_start_point
                   __FUNCTION__);
                 return (NULL);
         }
-        if (point == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        line->x0 = point->x0;
-        line->y0 = point->y0;
+        line->x0 = point.x;
+        line->y0 = point.y;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -10543,59 +11113,34 @@ dxf_hatch_boundary_path_edge_line_set_y1
  *
  * \return the end point.
  */
-DxfPoint *
+DxfVec2
 dxf_hatch_boundary_path_edge_line_get_end_point
 (
-        DxfHatchBoundaryPathEdgeLine *line,
+        DxfHatchBoundaryPathEdgeLine *line
                 /*!< a pointer to a DXF \c HATCH boundary path edge line. */
-        int id_code
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file. */
 )
 {
 #ifdef DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        DxfPoint *p2 = NULL;
+        DxfVec2 point;
 
+        point.x = 0.0;
+        point.y = 0.0;
         /* Do some basic checks. */
         if (line == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if ((line->x0 == line->x1)
-          && (line->y0 == line->y1))
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a line with endpoints with identical coordinates was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        p2 = dxf_point_init (p2);
-        if (p2 == NULL)
-        {
-              fprintf (stderr,
-                  (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
-                __FUNCTION__);
-              return (NULL);
-        }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () passed id_code is smaller than 0.\n")),
-                __FUNCTION__);
+                return (point);
         }
-        p2->id_code = id_code;
-        p2->x0 = line->x1;
-        p2->y0 = line->y1;
+        point.x = line->x1;
+        point.y = line->y1;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (p2);
+        return (point);
 }
 
 
@@ -10609,8 +11154,8 @@ dxf_hatch_boundary_path_edge_line_set_end_point
 (
         DxfHatchBoundaryPathEdgeLine *line,
                 /*!< a pointer to a DXF \c HATCH boundary path edge line. */
-        DxfPoint *point
-                /*!< a pointer to a DXF \c POINT entity. */
+        DxfVec2 point
+                /*!< the point. */
 )
 {
 #ifdef DEBUG
@@ -10624,15 +11169,8 @@ dxf_hatch_boundary_path_edge_line_set_end_point
                   __FUNCTION__);
                 return (NULL);
         }
-        if (point == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        line->x1 = point->x0;
-        line->y1 = point->y0;
+        line->x1 = point.x;
+        line->y1 = point.y;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -10777,8 +11315,6 @@ dxf_hatch_boundary_path_edge_spline_init
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
-
         /* Do some basic checks. */
         if (spline == NULL)
         {
@@ -10799,10 +11335,8 @@ dxf_hatch_boundary_path_edge_spline_init
         spline->rational = 0;
         spline->periodic = 0;
         spline->number_of_knots = 0;
-        for (i = 0; i >= DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS; i++)
-        {
-                spline->knots[i] = 0.0;
-        }
+        spline->knots = NULL;
+        spline->knots_size = 0;
         spline->number_of_control_points = 0;
         spline->control_points = NULL;
         spline->next = NULL;
@@ -10846,6 +11380,7 @@ dxf_hatch_boundary_path_edge_spline_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
+        free (spline->knots);
         free (spline->control_points);
         free (spline);
         spline = NULL;
@@ -10881,6 +11416,7 @@ dxf_hatch_boundary_path_edge_spline_free_chain
         while (hatch_boundary_path_edge_splines != NULL)
         {
                 struct DxfHatchBoundaryPathEdgeSpline *iter = hatch_boundary_path_edge_splines->next;
+                hatch_boundary_path_edge_splines->next = NULL;
                 dxf_hatch_boundary_path_edge_spline_free (hatch_boundary_path_edge_splines);
                 hatch_boundary_path_edge_splines = (DxfHatchBoundaryPathEdgeSpline *) iter;
         }
@@ -11267,9 +11803,13 @@ dxf_hatch_boundary_path_edge_spline_set_number_of_knots
 /*!
  * \brief Get the knot values from a DXF \c HATCH boundary path spline.
  *
- * \return pointer to the knot values.
+ * The \c number_of_knots knot values are copied into \c knots.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  *
- * \warning No checks are performed on the returned pointer (double).
+ * \warning Make sure enough memory is allocated for the destination
+ * array.
  */
 int
 dxf_hatch_boundary_path_edge_spline_get_knots
@@ -11277,7 +11817,7 @@ dxf_hatch_boundary_path_edge_spline_get_knots
         DxfHatchBoundaryPathEdgeSpline *spline,
                 /*!< a pointer to a DXF \c HATCH boundary path edge
                  * spline. */
-        double knots[DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS]
+        double *knots
                 /*!< array of knot values. */
 )
 {
@@ -11287,14 +11827,14 @@ dxf_hatch_boundary_path_edge_spline_get_knots
         int i;
 
         /* Do some basic checks. */
-        if (spline == NULL)
+        if ((spline == NULL) || (knots == NULL))
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        for (i = 1; i < DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS; i++)
+        for (i = 0; i < spline->number_of_knots; i++)
         {
                 knots[i] = spline->knots[i];
         }
@@ -11307,6 +11847,9 @@ dxf_hatch_boundary_path_edge_spline_get_knots
 
 /*!
  * \brief Set the knot values for a DXF \c HATCH boundary path spline.
+ *
+ * The \c number_of_knots knot values are copied from \c knots, set
+ * the \c number_of_knots before calling this function.
  */
 DxfHatchBoundaryPathEdgeSpline *
 dxf_hatch_boundary_path_edge_spline_set_knots
@@ -11314,9 +11857,8 @@ dxf_hatch_boundary_path_edge_spline_set_knots
         DxfHatchBoundaryPathEdgeSpline *spline,
                 /*!< a pointer to a DXF \c HATCH boundary path edge
                  * spline. */
-        double knots[DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS]
-                /*!< an array containing the additional proprietary data
-                 * for the entity. */
+        double *knots
+                /*!< an array containing the knot values. */
 )
 {
 #if DEBUG
@@ -11325,22 +11867,20 @@ dxf_hatch_boundary_path_edge_spline_set_knots
         int i;
 
         /* Do some basic checks. */
-        if (spline == NULL)
+        if ((spline == NULL) || (knots == NULL))
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        for (i = 1; i < DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS; i++)
+        if (dxf_hatch_boundary_path_edge_spline_reserve_knots (spline,
+          spline->number_of_knots) == EXIT_FAILURE)
+        {
+                return (NULL);
+        }
+        for (i = 0; i < spline->number_of_knots; i++)
         {
-                if (&knots[i] ==  NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () a NULL pointer was found in the knots array at element %d.\n")),
-                          __FUNCTION__, i);
-                        return (NULL);
-                }
                 spline->knots[i] = knots[i];
         }
 #if DEBUG
@@ -12151,13 +12691,6 @@ dxf_hatch_boundary_path_edge_spline_insert_control_point
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (position > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () received a position greater than DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
         if (control_point == NULL)
         {
                 fprintf (stderr,
@@ -12290,13 +12823,6 @@ dxf_hatch_boundary_path_edge_spline_remove_control_point
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (position >= DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () received a position greater than DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
         if (spline->number_of_control_points <= position)
         {
                 fprintf (stderr,
@@ -12523,12 +13049,73 @@ dxf_hatch_boundary_path_edge_spline_copy_control_points
 }
 
 
+/*!
+ * \brief Reserve memory for the knot values of a \c HATCH boundary
+ * path edge spline entity.
+ *
+ * The \c knots array is grown (doubling its size) until it can hold
+ * \c number_of_knots values, the \c number_of_knots is not changed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_boundary_path_edge_spline_reserve_knots
+(
+        DxfHatchBoundaryPathEdgeSpline *spline,
+                /*!< DXF \c HATCH boundary path edge spline entity. */
+        int number_of_knots
+                /*!< number of knot values to make room for. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double *knots = NULL;
+        int size;
+
+        /* Do some basic checks. */
+        if (spline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (number_of_knots <= spline->knots_size)
+        {
+                return (EXIT_SUCCESS);
+        }
+        size = (spline->knots_size == 0)
+          ? DXF_HATCH_BOUNDARY_PATH_EDGE_SPLINE_INITIAL_NUMBER_OF_KNOTS
+          : spline->knots_size;
+        while (size < number_of_knots)
+        {
+                size *= 2;
+        }
+        knots = realloc (spline->knots, (size_t) size * sizeof (double));
+        if (knots == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for knot values.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        spline->knots = knots;
+        spline->knots_size = size;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /*!
  * \brief Append a knot value to a \c HATCH boundary path edge spline
  * entity.
  *
- * After testing for a \c NULL pointer or an array pointer overflow,
- * both the knot value is appended and the \c number_of_knots is
+ * After testing for a \c NULL pointer and making room in the \c knots
+ * array, both the knot value is appended and the \c number_of_knots is
  * increased by 1.
  *
  * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
@@ -12554,14 +13141,12 @@ dxf_hatch_boundary_path_edge_spline_append_knot_value
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if ((spline->number_of_knots + 1) > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
+        if (dxf_hatch_boundary_path_edge_spline_reserve_knots (spline,
+          spline->number_of_knots + 1) == EXIT_FAILURE)
         {
-                fprintf (stderr,
-                  (("Error in %s () resulted in a array pointer overflow.\n")),
-                  __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        spline->knots[spline->number_of_knots + 1] = knot_value;
+        spline->knots[spline->number_of_knots] = knot_value;
         spline->number_of_knots++;
 #if DEBUG
         DXF_DEBUG_END
@@ -12574,9 +13159,9 @@ dxf_hatch_boundary_path_edge_spline_append_knot_value
  * \brief Prepend a knot value to a \c HATCH boundary path edge spline
  * entity.
  *
- * After testing for a \c NULL pointer or an array pointer overflow, all
- * the \c knots[] values are shifted one position up, the knot value is
- * prepended and the \c number_of_knots is increased by 1.
+ * After testing for a \c NULL pointer and making room in the \c knots
+ * array, all the \c knots[] values are shifted one position up, the
+ * knot value is prepended and the \c number_of_knots is increased by 1.
  *
  * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
  * occurred.
@@ -12593,8 +13178,6 @@ dxf_hatch_boundary_path_edge_spline_prepend_knot_value
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
-
         /* Do some basic checks. */
         if (spline == NULL)
         {
@@ -12603,17 +13186,13 @@ dxf_hatch_boundary_path_edge_spline_prepend_knot_value
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if ((spline->number_of_knots + 1) > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
+        if (dxf_hatch_boundary_path_edge_spline_reserve_knots (spline,
+          spline->number_of_knots + 1) == EXIT_FAILURE)
         {
-                fprintf (stderr,
-                  (_("Error in %s () resulted in a array pointer overflow.\n")),
-                  __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        for (i = spline->number_of_knots; i > 0; i--)
-        {
-                spline->knots[i + 1] = spline->knots[i];
-        }
+        memmove (&spline->knots[1], &spline->knots[0],
+          (size_t) spline->number_of_knots * sizeof (double));
         spline->knots[0] = knot_value;
         spline->number_of_knots++;
 #if DEBUG
@@ -12627,7 +13206,7 @@ dxf_hatch_boundary_path_edge_spline_prepend_knot_value
  * \brief Get a knot value from a \c HATCH boundary path edge spline
  * entity.
  *
- * After testing for a \c NULL pointer or an array pointer overflow, the
+ * After testing for a \c NULL pointer or an invalid position, the
  * desired knot value at \c position is returned.
  *
  * \return the knot value.
@@ -12638,7 +13217,8 @@ dxf_hatch_boundary_path_edge_spline_get_knot_value
         DxfHatchBoundaryPathEdgeSpline *spline,
                 /*!< DXF \c HATCH boundary path edge spline entity. */
         int position
-                /*!< position in the array of knot values [0 .. DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS]. */
+                /*!< position in the array of knot values
+                 * [0 .. number_of_knots - 1]. */
 )
 {
 #if DEBUG
@@ -12654,20 +13234,13 @@ dxf_hatch_boundary_path_edge_spline_get_knot_value
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (position <= 0)
+        if ((position < 0) || (position >= spline->number_of_knots))
         {
                 fprintf (stderr,
                   (_("Error in %s () received an invalid value in position.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (position > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
-        {
-                fprintf (stderr,
-                  (_("Error in  %s () received a position greater than DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
         knot_value = spline->knots[position];
 #if DEBUG
         DXF_DEBUG_END
@@ -12679,7 +13252,7 @@ dxf_hatch_boundary_path_edge_spline_get_knot_value
 /*!
  * \brief Set a knot value to a \c HATCH boundary path edge spline entity.
  *
- * After testing for a \c NULL pointer or an array pointer overflow, the
+ * After testing for a \c NULL pointer or an invalid position, the
  * desired knot value at \c position is set.
  *
  * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
@@ -12691,7 +13264,8 @@ dxf_hatch_boundary_path_edge_spline_set_knot_value
         DxfHatchBoundaryPathEdgeSpline *spline,
                 /*!< DXF \c HATCH boundary path edge spline entity. */
         int position,
-                /*!< position in the array of knot values [0 .. DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS]. */
+                /*!< position in the array of knot values
+                 * [0 .. number_of_knots - 1]. */
         double knot_value
                 /*!< knot value. */
 )
@@ -12707,20 +13281,13 @@ dxf_hatch_boundary_path_edge_spline_set_knot_value
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (position <= 0)
+        if ((position < 0) || (position >= spline->number_of_knots))
         {
                 fprintf (stderr,
                   (_("Error in %s () received an invalid value in position.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (position > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () received a position greater than DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
         spline->knots[position] = knot_value;
 #if DEBUG
         DXF_DEBUG_END
@@ -12733,8 +13300,8 @@ dxf_hatch_boundary_path_edge_spline_set_knot_value
  * \brief Insert a knot value into a \c HATCH boundary path edge spline
  * entity.
  *
- * After testing for a \c NULL pointer or an array pointer overflow, all
- * the knot values upwards of \c knots[\c position] are shifted one
+ * After testing for a \c NULL pointer or an invalid position, all the
+ * knot values upwards of \c knots[\c position] are shifted one
  * position,  the knot value is inserted at \c knots[\c position] and
  * the  \c number_of_knots is increased by 1.
  *
@@ -12747,7 +13314,8 @@ dxf_hatch_boundary_path_edge_spline_insert_knot_value
         DxfHatchBoundaryPathEdgeSpline *spline,
                 /*!< DXF \c HATCH boundary path edge spline entity. */
         int position,
-                /*!< position in the array of knot values [0 .. DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS]. */
+                /*!< position in the array of knot values
+                 * [0 .. number_of_knots]. */
         double knot_value
                 /*!< knot value. */
 )
@@ -12755,8 +13323,6 @@ dxf_hatch_boundary_path_edge_spline_insert_knot_value
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
-
         /* Do some basic checks. */
         if (spline == NULL)
         {
@@ -12765,31 +13331,20 @@ dxf_hatch_boundary_path_edge_spline_insert_knot_value
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if ((spline->number_of_knots + 1) > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () resulted in a array pointer overflow.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (position <= 0)
+        if ((position < 0) || (position > spline->number_of_knots))
         {
                 fprintf (stderr,
                   (_("Error in %s () received an invalid value in position.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (position >= DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
+        if (dxf_hatch_boundary_path_edge_spline_reserve_knots (spline,
+          spline->number_of_knots + 1) == EXIT_FAILURE)
         {
-                fprintf (stderr,
-                  (_("Error in %s () received a position greater than DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS.\n")),
-                  __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        for (i = spline->number_of_knots; i <= position; i--)
-        {
-                spline->knots[i + 1] = spline->knots[i];
-        }
+        memmove (&spline->knots[position + 1], &spline->knots[position],
+          (size_t) (spline->number_of_knots - position) * sizeof (double));
         spline->knots[position] = knot_value;
         spline->number_of_knots++;
 #if DEBUG
@@ -12803,8 +13358,8 @@ dxf_hatch_boundary_path_edge_spline_insert_knot_value
  * \brief Remove a knot value from a \c HATCH boundary path edge spline
  * entity.
  *
- * After testing for a \c NULL pointer or an array pointer overflow, all
- * the knot values upwards of \c knots[\c position] are shifted one
+ * After testing for a \c NULL pointer or an invalid position, all the
+ * knot values upwards of \c knots[\c position] are shifted one
  * position down, and the \c number_of_knots is decreased by 1.
  *
  * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
@@ -12816,14 +13371,13 @@ dxf_hatch_boundary_path_edge_spline_remove_knot_value
         DxfHatchBoundaryPathEdgeSpline *spline,
                 /*!< DXF \c HATCH boundary path edge spline entity. */
         int position
-                /*!< position in the array of knot values [0 .. DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS]. */
+                /*!< position in the array of knot values
+                 * [0 .. number_of_knots - 1]. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
-
         /* Do some basic checks. */
         if (spline == NULL)
         {
@@ -12832,38 +13386,15 @@ dxf_hatch_boundary_path_edge_spline_remove_knot_value
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->number_of_knots > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () resulted in a array pointer overflow.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if ((spline->number_of_knots - 1) < 0)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () resulted in a array pointer underflow.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (position <= 0)
+        if ((position < 0) || (position >= spline->number_of_knots))
         {
                 fprintf (stderr,
                   (_("Error in %s () received an invalid value in position.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (position >= DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () received a position greater than DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        for (i = position; i >= spline->number_of_knots; i++)
-        {
-                spline->knots[i] = spline->knots[i + 1];
-        }
+        memmove (&spline->knots[position], &spline->knots[position + 1],
+          (size_t) (spline->number_of_knots - position - 1) * sizeof (double));
         spline->number_of_knots--;
 #if DEBUG
         DXF_DEBUG_END
@@ -12876,9 +13407,9 @@ dxf_hatch_boundary_path_edge_spline_remove_knot_value
  * \brief Copy knot values from a \c HATCH boundary path edge spline
  * entity into an array.
  *
- * After testing for a \c NULL pointer or an array pointer overflow, all
- * the knot values from \c spline (source) are copied into an array
- * \c knot_values (destination).
+ * After testing for a \c NULL pointer, all the knot values from
+ * \c spline (source) are copied into an array \c knot_values
+ * (destination).
  *
  * \warning Make sure enough memory is allocated for the destination
  * array.
@@ -12891,15 +13422,13 @@ dxf_hatch_boundary_path_edge_spline_copy_knot_values
 (
         DxfHatchBoundaryPathEdgeSpline *spline,
                 /*!< DXF \c HATCH boundary path edge spline entity (source). */
-        double *knot_values[DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS]
+        double *knot_values
                 /*!< Array of knot values (destination). */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
-
         /* Do some basic checks. */
         if (spline == NULL)
         {
@@ -12908,16 +13437,17 @@ dxf_hatch_boundary_path_edge_spline_copy_knot_values
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (spline->number_of_knots > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
+        if (knot_values == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () resulted in a array pointer overflow.\n")),
+                  (_("Error in %s () received a NULL pointer value in knot_values.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        for (i = 0; i < spline->number_of_knots; i++)
+        if (spline->number_of_knots > 0)
         {
-                *knot_values[i] = spline->knots[i];
+                memcpy (knot_values, spline->knots,
+                  (size_t) spline->number_of_knots * sizeof (double));
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -13075,6 +13605,7 @@ dxf_hatch_boundary_path_edge_spline_control_point_free_chain
         while (hatch_boundary_path_edge_spline_control_points != NULL)
         {
                 struct DxfHatchBoundaryPathEdgeSplineCp *iter = hatch_boundary_path_edge_spline_control_points->next;
+                hatch_boundary_path_edge_spline_control_points->next = NULL;
                 dxf_hatch_boundary_path_edge_spline_control_point_free (hatch_boundary_path_edge_spline_control_points);
                 hatch_boundary_path_edge_spline_control_points = (DxfHatchBoundaryPathEdgeSplineCp *) iter;
         }
@@ -13312,52 +13843,35 @@ dxf_hatch_boundary_path_edge_spline_cp_set_y0
  *
  * \return the point.
  */
-DxfPoint *
+DxfVec2
 dxf_hatch_boundary_path_edge_spline_cp_get_point
 (
-        DxfHatchBoundaryPathEdgeSplineCp *control_point,
+        DxfHatchBoundaryPathEdgeSplineCp *control_point
                 /*!< a pointer to a DXF \c HATCH boundary path spline
                  * control point. */
-        int id_code
-                /*!< Identification number for the \c DXfPoint entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file. */
 )
 {
 #ifdef DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        DxfPoint *p1 = NULL;
+        DxfVec2 point;
 
+        point.x = 0.0;
+        point.y = 0.0;
         /* Do some basic checks. */
         if (control_point == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        p1 = dxf_point_init (p1);
-        if (p1 == NULL)
-        {
-              fprintf (stderr,
-                  (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
-                __FUNCTION__);
-              return (NULL);
-        }
-        if (id_code < 0)
-        {
-              fprintf (stderr,
-                  (_("Warning in %s () passed id_code is smaller than 0.\n")),
-                __FUNCTION__);
+                return (point);
         }
-        p1->id_code = id_code;
-        p1->x0 = control_point->x0;
-        p1->y0 = control_point->y0;
+        point.x = control_point->x0;
+        point.y = control_point->y0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (p1);
+        return (point);
 }
 
 
@@ -13374,8 +13888,8 @@ dxf_hatch_boundary_path_edge_spline_cp_set_point
         DxfHatchBoundaryPathEdgeSplineCp *control_point,
                 /*!< a pointer to a DXF \c HATCH boundary path spline
                  * control point. */
-        DxfPoint *point
-                /*!< a pointer to a DXF \c POINT entity. */
+        DxfVec2 point
+                /*!< the point. */
 )
 {
 #ifdef DEBUG
@@ -13389,15 +13903,8 @@ dxf_hatch_boundary_path_edge_spline_cp_set_point
                   __FUNCTION__);
                 return (NULL);
         }
-        if (point == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        control_point->x0 = point->x0;
-        control_point->y0 = point->y0;
+        control_point->x0 = point.x;
+        control_point->y0 = point.y;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -44,11 +44,30 @@
 
 #include "global.h"
 #include "point.h"
+#include "vec.h"
 #include "binary_graphics_data.h"
 
 
 #define DXF_MAX_HATCH_PATTERN_DEF_LINE_DASH_ITEMS 16
-#define DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS 64
+#define DXF_HATCH_BOUNDARY_PATH_EDGE_SPLINE_INITIAL_NUMBER_OF_KNOTS 8
+        /*!< \brief The number of knot values allocated for a
+         * \c DxfHatchBoundaryPathEdgeSpline when the first knot value
+         * is added. */
+#define DXF_HATCH_BOUNDARY_PATH_EXTERNAL 1
+        /*!< \brief Boundary path type flag of an external boundary
+         * path. */
+#define DXF_HATCH_BOUNDARY_PATH_POLYLINE 2
+        /*!< \brief Boundary path type flag of a polyline boundary
+         * path. */
+#define DXF_HATCH_BOUNDARY_PATH_DERIVED 4
+        /*!< \brief Boundary path type flag of a derived boundary
+         * path. */
+#define DXF_HATCH_BOUNDARY_PATH_TEXTBOX 8
+        /*!< \brief Boundary path type flag of a text box boundary
+         * path. */
+#define DXF_HATCH_BOUNDARY_PATH_OUTERMOST 16
+        /*!< \brief Boundary path type flag of an outermost boundary
+         * path. */
 
 
 /*!
@@ -197,10 +216,14 @@ dxf_hatch_boundary_path_edge_spline
         int number_of_knots;
                 /*!< Number of knots.\n
                  * Group code = 95. */
-        double knots[DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS];
+        double *knots;
                 /*!< Knot values control the shape of the curve as it
                  * passes through the control points.\n
+                 * Array of \c number_of_knots values, \c NULL when
+                 * no knot values were added yet.\n
                  * Group code = 40. */
+        int knots_size;
+                /*!< Number of knot values allocated in \c knots. */
         int number_of_control_points;
                 /*!< Number of control points.\n
                  * Group code = 96. */
@@ -312,6 +335,15 @@ dxf_hatch_boundary_path
                 /*!< Treat the boundary path as if it were a single
                  * (composite) entity.\n
                  * Group code = 5. */
+        int boundary_path_type_flag;
+                /*!< Boundary path type flag (bit coded):\n
+                 * 0 = default\n
+                 * 1 = external\n
+                 * 2 = polyline\n
+                 * 4 = derived\n
+                 * 8 = textbox\n
+                 * 16 = outermost.\n
+                 * Group code = 92. */
         struct DxfHatchBoundaryPathEdge *edges;
                 /*!< Pointer to the first DxfHatchBoundaryPathEdge.\n
                  * \c NULL if there is no DxfHatchBoundaryPathEdge in
@@ -1286,6 +1318,17 @@ dxf_hatch_boundary_path_set_id_code
         DxfHatchBoundaryPath *path,
         int id_code
 );
+int
+dxf_hatch_boundary_path_get_boundary_path_type_flag
+(
+        DxfHatchBoundaryPath *path
+);
+DxfHatchBoundaryPath *
+dxf_hatch_boundary_path_set_boundary_path_type_flag
+(
+        DxfHatchBoundaryPath *path,
+        int boundary_path_type_flag
+);
 DxfHatchBoundaryPathEdge *
 dxf_hatch_boundary_path_get_edges
 (
@@ -1319,6 +1362,12 @@ dxf_hatch_boundary_path_set_next
         DxfHatchBoundaryPath *path,
         DxfHatchBoundaryPath *next
 );
+int
+dxf_hatch_boundary_path_point_inside_path
+(
+        DxfHatchBoundaryPath *path,
+        DxfVec2 point
+);
 /* dxf_hatch_boundary_path_polyline functions. */
 DxfHatchBoundaryPathPolyline *
 dxf_hatch_boundary_path_polyline_new ();
@@ -1407,7 +1456,15 @@ int
 dxf_hatch_boundary_path_polyline_point_inside_polyline
 (
         DxfHatchBoundaryPathPolyline *polyline,
-        DxfPoint *point
+        DxfVec2 point
+);
+int
+dxf_hatch_boundary_path_polyline_points_inside_polyline
+(
+        DxfHatchBoundaryPathPolyline *polyline,
+        const DxfVec2 *points,
+        int number_of_points,
+        int *results
 );
 /* dxf_hatch_boundary_pathPolyline_vertex functions. */
 DxfHatchBoundaryPathPolylineVertex *
@@ -1640,17 +1697,16 @@ dxf_hatch_boundary_path_edge_arc_set_y0
         DxfHatchBoundaryPathEdgeArc *arc,
         double y0
 );
-DxfPoint *
+DxfVec2
 dxf_hatch_boundary_path_edge_arc_get_center_point
 (
-        DxfHatchBoundaryPathEdgeArc *arc,
-        int id_code
+        DxfHatchBoundaryPathEdgeArc *arc
 );
 DxfHatchBoundaryPathEdgeArc *
 dxf_hatch_boundary_path_edge_arc_set_center_point
 (
         DxfHatchBoundaryPathEdgeArc *arc,
-        DxfPoint *point
+        DxfVec2 point
 );
 double
 dxf_hatch_boundary_path_edge_arc_get_radius
@@ -1758,17 +1814,16 @@ dxf_hatch_boundary_path_edge_ellipse_set_y0
         DxfHatchBoundaryPathEdgeEllipse *ellipse,
         double y0
 );
-DxfPoint *
+DxfVec2
 dxf_hatch_boundary_path_edge_ellipse_get_center_point
 (
-        DxfHatchBoundaryPathEdgeEllipse *ellipse,
-        int id_code
+        DxfHatchBoundaryPathEdgeEllipse *ellipse
 );
 DxfHatchBoundaryPathEdgeEllipse *
 dxf_hatch_boundary_path_edge_ellipse_set_center_point
 (
         DxfHatchBoundaryPathEdgeEllipse *ellipse,
-        DxfPoint *point
+        DxfVec2 point
 );
 double
 dxf_hatch_boundary_path_edge_ellipse_get_x1
@@ -1792,17 +1847,16 @@ dxf_hatch_boundary_path_edge_ellipse_set_y1
         DxfHatchBoundaryPathEdgeEllipse *ellipse,
         double y1
 );
-DxfPoint *
+DxfVec2
 dxf_hatch_boundary_path_edge_ellipse_get_end_point
 (
-        DxfHatchBoundaryPathEdgeEllipse *ellipse,
-        int id_code
+        DxfHatchBoundaryPathEdgeEllipse *ellipse
 );
 DxfHatchBoundaryPathEdgeEllipse *
 dxf_hatch_boundary_path_edge_ellipse_set_end_point
 (
         DxfHatchBoundaryPathEdgeEllipse *ellipse,
-        DxfPoint *point
+        DxfVec2 point
 );
 double
 dxf_hatch_boundary_path_edge_ellipse_get_ratio
@@ -1910,17 +1964,16 @@ dxf_hatch_boundary_path_edge_line_set_y0
         DxfHatchBoundaryPathEdgeLine *line,
         double y0
 );
-DxfPoint *
+DxfVec2
 dxf_hatch_boundary_path_edge_line_get_start_point
 (
-        DxfHatchBoundaryPathEdgeLine *line,
-        int id_code
+        DxfHatchBoundaryPathEdgeLine *line
 );
 DxfHatchBoundaryPathEdgeLine *
 dxf_hatch_boundary_path_edge_line_set_start_point
 (
         DxfHatchBoundaryPathEdgeLine *line,
-        DxfPoint *point
+        DxfVec2 point
 );
 double
 dxf_hatch_boundary_path_edge_line_get_x1
@@ -1944,17 +1997,16 @@ dxf_hatch_boundary_path_edge_line_set_y1
         DxfHatchBoundaryPathEdgeLine *line,
         double y1
 );
-DxfPoint *
+DxfVec2
 dxf_hatch_boundary_path_edge_line_get_end_point
 (
-        DxfHatchBoundaryPathEdgeLine *line,
-        int id_code
+        DxfHatchBoundaryPathEdgeLine *line
 );
 DxfHatchBoundaryPathEdgeLine *
 dxf_hatch_boundary_path_edge_line_set_end_point
 (
         DxfHatchBoundaryPathEdgeLine *line,
-        DxfPoint *point
+        DxfVec2 point
 );
 DxfHatchBoundaryPathEdgeLine *
 dxf_hatch_boundary_path_edge_line_get_next
@@ -2044,13 +2096,13 @@ int
 dxf_hatch_boundary_path_edge_spline_get_knots
 (
         DxfHatchBoundaryPathEdgeSpline *spline,
-        double knots[DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS]
+        double *knots
 );
 DxfHatchBoundaryPathEdgeSpline *
 dxf_hatch_boundary_path_edge_spline_set_knots
 (
         DxfHatchBoundaryPathEdgeSpline *spline,
-        double knots[DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS]
+        double *knots
 );
 int
 dxf_hatch_boundary_path_edge_spline_get_number_of_control_points
@@ -2129,6 +2181,12 @@ dxf_hatch_boundary_path_edge_spline_copy_control_points
         DxfHatchBoundaryPathEdgeSpline *spline
 );
 int
+dxf_hatch_boundary_path_edge_spline_reserve_knots
+(
+        DxfHatchBoundaryPathEdgeSpline *spline,
+        int number_of_knots
+);
+int
 dxf_hatch_boundary_path_edge_spline_append_knot_value
 (
         DxfHatchBoundaryPathEdgeSpline *spline,
@@ -2170,7 +2228,7 @@ int
 dxf_hatch_boundary_path_edge_spline_copy_knot_values
 (
         DxfHatchBoundaryPathEdgeSpline *spline,
-        double *knot_values[DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS]
+        double *knot_values
 );
 /* dxf_hatch_boundary_path_edge_splie_control_point functions. */
 DxfHatchBoundaryPathEdgeSplineCp *
@@ -2223,17 +2281,16 @@ dxf_hatch_boundary_path_edge_spline_cp_set_y0
         DxfHatchBoundaryPathEdgeSplineCp *control_point,
         double y0
 );
-DxfPoint *
+DxfVec2
 dxf_hatch_boundary_path_edge_spline_cp_get_point
 (
-        DxfHatchBoundaryPathEdgeSplineCp *control_point,
-        int id_code
+        DxfHatchBoundaryPathEdgeSplineCp *control_point
 );
 DxfHatchBoundaryPathEdgeSplineCp *
 dxf_hatch_boundary_path_edge_spline_cp_set_point
 (
         DxfHatchBoundaryPathEdgeSplineCp *control_point,
-        DxfPoint *point
+        DxfVec2 point
 );
 double
 dxf_hatch_boundary_path_edge_spline_cp_get_weight
@@ -0,0 +1,1319 @@
+/*!
+ * \file hatch_fill.c
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Functions for the generation of the pattern lines of DXF hatches.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <pthread.h>
+#include "hatch_fill.h"
+
+
+/*!
+ * \brief Straight edge of a flattened hatch boundary in the OCS of the
+ * hatch.
+ */
+typedef struct
+dxf_hatch_fill_edge
+{
+        double x0;
+                /*!< X-value of the start point. */
+        double y0;
+                /*!< Y-value of the start point. */
+        double x1;
+                /*!< X-value of the end point. */
+        double y1;
+                /*!< Y-value of the end point. */
+} DxfHatchFillEdge;
+
+
+/*!
+ * \brief Edge of a flattened hatch boundary in the coordinates of a
+ * pattern line family (\c u along the lines, \c v across the lines).
+ */
+typedef struct
+dxf_hatch_fill_scan_edge
+{
+        double vmin;
+                /*!< Lowest V-value. */
+        double vmax;
+                /*!< Highest V-value. */
+        double u;
+                /*!< U-value at \c vmin. */
+        double slope;
+                /*!< Change of U per unit of V. */
+} DxfHatchFillScanEdge;
+
+
+/*!
+ * \brief The flattened boundary set of a hatch.
+ */
+typedef struct
+dxf_hatch_fill_boundary
+{
+        DxfHatchFillEdge *edges;
+                /*!< Array of edges. */
+        int number_of_edges;
+                /*!< Number of edges in \c edges. */
+        int edges_size;
+                /*!< Number of allocated edges. */
+        DxfOcs ocs;
+                /*!< OCS of the hatch. */
+        double z;
+                /*!< Elevation of the hatch. */
+        DxfTessellation tessellation;
+                /*!< Tolerance of the arcs in the boundary. */
+        DxfVec3 *points;
+                /*!< Array of tessellated points of an arc, reused for
+                 * every arc. */
+        int points_size;
+                /*!< Number of allocated points. */
+        int result;
+                /*!< \c EXIT_SUCCESS or \c EXIT_FAILURE. */
+} DxfHatchFillBoundary;
+
+
+/*!
+ * \brief Add an edge to a hatch boundary.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_hatch_fill_add_edge
+(
+        DxfHatchFillBoundary *boundary,
+                /*!< the boundary. */
+        double x0,
+                /*!< X-value of the start point. */
+        double y0,
+                /*!< Y-value of the start point. */
+        double x1,
+                /*!< X-value of the end point. */
+        double y1
+                /*!< Y-value of the end point. */
+)
+{
+        DxfHatchFillEdge *edges = NULL;
+        int size;
+
+        if (boundary->number_of_edges == boundary->edges_size)
+        {
+                size = (boundary->edges_size == 0) ? 64 : 2 * boundary->edges_size;
+                edges = realloc (boundary->edges, size * sizeof (DxfHatchFillEdge));
+                if (edges == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for boundary edges.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                boundary->edges = edges;
+                boundary->edges_size = size;
+        }
+        edges = &boundary->edges[boundary->number_of_edges++];
+        edges->x0 = x0;
+        edges->y0 = y0;
+        edges->x1 = x1;
+        edges->y1 = y1;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add the chords of the tessellated points of an arc to a hatch
+ * boundary.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_hatch_fill_add_chords
+(
+        DxfHatchFillBoundary *boundary,
+                /*!< the boundary. */
+        int number_of_points
+                /*!< number of points in \c boundary->points. */
+)
+{
+        DxfVec3 *points = boundary->points;
+        int i;
+
+        for (i = 1; i < number_of_points; i++)
+        {
+                if (dxf_hatch_fill_add_edge (boundary, points[i - 1].x, points[i - 1].y,
+                  points[i].x, points[i].y) != EXIT_SUCCESS)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Make room for a number of tessellated points in a hatch
+ * boundary.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_hatch_fill_reserve_points
+(
+        DxfHatchFillBoundary *boundary,
+                /*!< the boundary. */
+        int number_of_points
+                /*!< number of points. */
+)
+{
+        DxfVec3 *points = NULL;
+
+        if (number_of_points > boundary->points_size)
+        {
+                points = realloc (boundary->points, number_of_points * sizeof (DxfVec3));
+                if (points == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for boundary points.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                boundary->points = points;
+                boundary->points_size = number_of_points;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add an elliptical (or circular) arc to a hatch boundary as
+ * chords.
+ *
+ * The points of the arc are \f$ c + u \cos t + v \sin t \f$ for \c t
+ * from \c start over \c sweep radians, see
+ * \c dxf_tessellation_elliptical_arc().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_hatch_fill_add_arc
+(
+        DxfHatchFillBoundary *boundary,
+                /*!< the boundary. */
+        double xc,
+                /*!< X-value of the center point. */
+        double yc,
+                /*!< Y-value of the center point. */
+        double ux,
+                /*!< X-value of the major axis. */
+        double uy,
+                /*!< Y-value of the major axis. */
+        double vx,
+                /*!< X-value of the minor axis. */
+        double vy,
+                /*!< Y-value of the minor axis. */
+        double start,
+                /*!< start parameter in radians. */
+        double sweep
+                /*!< included parameter range in radians. */
+)
+{
+        DxfVec3 center;
+        DxfVec3 u;
+        DxfVec3 v;
+        int n;
+
+        center.x = xc;
+        center.y = yc;
+        center.z = 0.0;
+        u.x = ux;
+        u.y = uy;
+        u.z = 0.0;
+        v.x = vx;
+        v.y = vy;
+        v.z = 0.0;
+        n = dxf_tessellation_elliptical_arc (&boundary->tessellation,
+          center, u, v, start, sweep, NULL, 0);
+        if (dxf_hatch_fill_reserve_points (boundary, n) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_tessellation_elliptical_arc (&boundary->tessellation,
+          center, u, v, start, sweep, boundary->points, n);
+        return (dxf_hatch_fill_add_chords (boundary, n));
+}
+
+
+/*!
+ * \brief Add a polyline segment with a bulge to a hatch boundary.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_hatch_fill_add_bulge_segment
+(
+        DxfHatchFillBoundary *boundary,
+                /*!< the boundary. */
+        double x0,
+                /*!< X-value of the start point. */
+        double y0,
+                /*!< Y-value of the start point. */
+        double x1,
+                /*!< X-value of the end point. */
+        double y1,
+                /*!< Y-value of the end point. */
+        double bulge
+                /*!< bulge of the segment. */
+)
+{
+        int n;
+
+        n = dxf_tessellation_bulge (&boundary->tessellation, NULL,
+          x0, y0, x1, y1, 0.0, bulge, NULL, 0);
+        if (dxf_hatch_fill_reserve_points (boundary, n) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_tessellation_bulge (&boundary->tessellation, NULL,
+          x0, y0, x1, y1, 0.0, bulge, boundary->points, n);
+        return (dxf_hatch_fill_add_chords (boundary, n));
+}
+
+
+/*!
+ * \brief Add a spline edge to a hatch boundary as chords.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the edge
+ * has no valid set of control points and knots or no memory could be
+ * allocated.
+ */
+static int
+dxf_hatch_fill_add_spline
+(
+        DxfHatchFillBoundary *boundary,
+                /*!< the boundary. */
+        DxfHatchBoundaryPathEdgeSpline *spline,
+                /*!< the spline edge. */
+        double tolerance
+                /*!< chord tolerance. */
+)
+{
+        DxfNurbs *nurbs = NULL;
+        DxfVec3 *points = NULL;
+        int number_of_points = 0;
+        int result;
+        int i;
+
+        nurbs = dxf_nurbs_init (dxf_nurbs_new ());
+        if (nurbs == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        result = dxf_nurbs_set_hatch_spline (nurbs, spline);
+        if (result == EXIT_SUCCESS)
+        {
+                result = dxf_nurbs_tessellate (nurbs, tolerance, &points, &number_of_points);
+        }
+        for (i = 1; (i < number_of_points) && (result == EXIT_SUCCESS); i++)
+        {
+                result = dxf_hatch_fill_add_edge (boundary, points[i - 1].x, points[i - 1].y,
+                  points[i].x, points[i].y);
+        }
+        free (points);
+        dxf_nurbs_free (nurbs);
+        return (result);
+}
+
+
+/*!
+ * \brief Get the start and the signed included angle of an arc or
+ * elliptical arc edge of a hatch boundary path.
+ *
+ * Clockwise edges have mirrored angles.
+ */
+static void
+dxf_hatch_fill_get_edge_sweep
+(
+        double start_angle,
+                /*!< start angle in degrees. */
+        double end_angle,
+                /*!< end angle in degrees. */
+        int is_ccw,
+                /*!< counterclockwise flag. */
+        double *start,
+                /*!< start angle in radians (output). */
+        double *sweep
+                /*!< included angle in radians (output). */
+)
+{
+        double included = end_angle - start_angle;
+
+        while (included > 360.0)
+        {
+                included -= 360.0;
+        }
+        while (included <= 0.0)
+        {
+                included += 360.0;
+        }
+        *start = (is_ccw ? start_angle : -start_angle) * M_PI / 180.0;
+        *sweep = (is_ccw ? included : -included) * M_PI / 180.0;
+}
+
+
+/*!
+ * \brief Test if a boundary path of a hatch is filled with the style of
+ * the hatch.
+ *
+ * The Ignore style fills the external boundary paths only, the Outer
+ * style the external and outermost boundary paths, and the Normal
+ * style all boundary paths.\n
+ * When no boundary path has a type flag the style has no effect.
+ *
+ * \return \c TRUE when the path takes part in the fill.
+ */
+static int
+dxf_hatch_fill_use_path
+(
+        DxfHatch *hatch,
+                /*!< the hatch. */
+        DxfHatchBoundaryPath *path,
+                /*!< a boundary path of the hatch. */
+        int flagged
+                /*!< \c TRUE when a path of the hatch has the external
+                 * flag. */
+)
+{
+        if (!flagged)
+        {
+                return (TRUE);
+        }
+        switch (hatch->hatch_style)
+        {
+                case 1:
+                        return ((path->boundary_path_type_flag
+                          & (DXF_HATCH_BOUNDARY_PATH_EXTERNAL | DXF_HATCH_BOUNDARY_PATH_OUTERMOST)) != 0);
+                case 2:
+                        return ((path->boundary_path_type_flag & DXF_HATCH_BOUNDARY_PATH_EXTERNAL) != 0);
+                default:
+                        return (TRUE);
+        }
+}
+
+
+/*!
+ * \brief Flatten the boundary paths of a hatch into straight edges.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a boundary
+ * path has an invalid spline edge or no memory could be allocated.
+ */
+static int
+dxf_hatch_fill_build_boundary
+(
+        DxfHatch *hatch,
+                /*!< the hatch. */
+        double tolerance,
+                /*!< chord tolerance. */
+        DxfHatchFillBoundary *boundary
+                /*!< the boundary (output). */
+)
+{
+        DxfHatchBoundaryPath *path = NULL;
+        DxfHatchBoundaryPathEdge *edge = NULL;
+        DxfHatchBoundaryPathEdgeArc *arc = NULL;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse = NULL;
+        DxfHatchBoundaryPathEdgeLine *line = NULL;
+        DxfHatchBoundaryPathEdgeSpline *spline = NULL;
+        DxfHatchBoundaryPathPolyline *polyline = NULL;
+        DxfHatchBoundaryPathPolylineVertex *vertex = NULL;
+        DxfHatchBoundaryPathPolylineVertex *next = NULL;
+        double start;
+        double sweep;
+        int flagged = FALSE;
+        int result = EXIT_SUCCESS;
+
+        memset (boundary, 0, sizeof (DxfHatchFillBoundary));
+        dxf_ocs_init (&boundary->ocs, hatch->extr_x0, hatch->extr_y0, hatch->extr_z0);
+        boundary->z = hatch->z0;
+        if (tolerance > 0.0)
+        {
+                boundary->tessellation.chord_height = tolerance;
+        }
+        else
+        {
+                boundary->tessellation.angle = 2.0 * acos (1.0 - DXF_HATCH_FILL_RELATIVE_TOLERANCE);
+        }
+        for (path = (DxfHatchBoundaryPath *) hatch->paths; path != NULL; path = (DxfHatchBoundaryPath *) path->next)
+        {
+                if (path->boundary_path_type_flag & DXF_HATCH_BOUNDARY_PATH_EXTERNAL)
+                {
+                        flagged = TRUE;
+                }
+        }
+        for (path = (DxfHatchBoundaryPath *) hatch->paths; path != NULL; path = (DxfHatchBoundaryPath *) path->next)
+        {
+                if (!dxf_hatch_fill_use_path (hatch, path, flagged))
+                {
+                        continue;
+                }
+                for (edge = (DxfHatchBoundaryPathEdge *) path->edges; edge != NULL; edge = (DxfHatchBoundaryPathEdge *) edge->next)
+                {
+                        for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines; spline != NULL; spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+                        {
+                                result |= dxf_hatch_fill_add_spline (boundary, spline, tolerance);
+                        }
+                        for (line = (DxfHatchBoundaryPathEdgeLine *) edge->lines; line != NULL; line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+                        {
+                                result |= dxf_hatch_fill_add_edge (boundary, line->x0, line->y0, line->x1, line->y1);
+                        }
+                        for (arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs; arc != NULL; arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+                        {
+                                dxf_hatch_fill_get_edge_sweep (arc->start_angle, arc->end_angle,
+                                  arc->is_ccw, &start, &sweep);
+                                result |= dxf_hatch_fill_add_arc (boundary, arc->x0, arc->y0,
+                                  arc->radius, 0.0, 0.0, arc->radius, start, sweep);
+                        }
+                        for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses; ellipse != NULL; ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+                        {
+                                dxf_hatch_fill_get_edge_sweep (ellipse->start_angle, ellipse->end_angle,
+                                  ellipse->is_ccw, &start, &sweep);
+                                result |= dxf_hatch_fill_add_arc (boundary, ellipse->x0, ellipse->y0,
+                                  ellipse->x1, ellipse->y1,
+                                  -ellipse->ratio * ellipse->y1, ellipse->ratio * ellipse->x1,
+                                  start, sweep);
+                        }
+                }
+                for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines; polyline != NULL; polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+                {
+                        /* A boundary polyline is always closed. */
+                        for (vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices; vertex != NULL; vertex = (DxfHatchBoundaryPathPolylineVertex *) vertex->next)
+                        {
+                                next = (DxfHatchBoundaryPathPolylineVertex *) vertex->next;
+                                if (next == NULL)
+                                {
+                                        next = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                                }
+                                result |= dxf_hatch_fill_add_bulge_segment (boundary,
+                                  vertex->x0, vertex->y0, next->x0, next->y0,
+                                  vertex->has_bulge ? vertex->bulge : 0.0);
+                        }
+                }
+        }
+        free (boundary->points);
+        boundary->points = NULL;
+        boundary->points_size = 0;
+        boundary->result = (result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE;
+        return (boundary->result);
+}
+
+
+/*!
+ * \brief Add a segment in the coordinates of a pattern line family to
+ * a buffer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_hatch_fill_buffer_add
+(
+        DxfHatchFillBuffer *buffer,
+                /*!< the buffer. */
+        DxfHatchFillBoundary *boundary,
+                /*!< the boundary (for the OCS). */
+        const double *frame,
+                /*!< base point X and Y, direction X and Y of the family. */
+        double v,
+                /*!< V-value of the line. */
+        double u0,
+                /*!< U-value of the start point. */
+        double u1
+                /*!< U-value of the end point. */
+)
+{
+        DxfHatchFillSegment *segments = NULL;
+        int size;
+
+        if (buffer->number_of_segments == buffer->segments_size)
+        {
+                size = (buffer->segments_size == 0) ? 256 : 2 * buffer->segments_size;
+                segments = realloc (buffer->segments, size * sizeof (DxfHatchFillSegment));
+                if (segments == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for hatch segments.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                buffer->segments = segments;
+                buffer->segments_size = size;
+        }
+        segments = &buffer->segments[buffer->number_of_segments++];
+        /* Point = base + u * direction + v * normal. */
+        segments->start = dxf_ocs_to_wcs (&boundary->ocs,
+          frame[0] + u0 * frame[2] - v * frame[3],
+          frame[1] + u0 * frame[3] + v * frame[2], boundary->z);
+        segments->end = dxf_ocs_to_wcs (&boundary->ocs,
+          frame[0] + u1 * frame[2] - v * frame[3],
+          frame[1] + u1 * frame[3] + v * frame[2], boundary->z);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compare two scan edges by their lowest V-value (for qsort).
+ */
+static int
+dxf_hatch_fill_compare_edges
+(
+        const void *a,
+        const void *b
+)
+{
+        double va = ((const DxfHatchFillScanEdge *) a)->vmin;
+        double vb = ((const DxfHatchFillScanEdge *) b)->vmin;
+
+        return ((va < vb) ? -1 : ((va > vb) ? 1 : 0));
+}
+
+
+/*!
+ * \brief Compare two doubles (for qsort).
+ */
+static int
+dxf_hatch_fill_compare_doubles
+(
+        const void *a,
+        const void *b
+)
+{
+        double da = *(const double *) a;
+        double db = *(const double *) b;
+
+        return ((da < db) ? -1 : ((da > db) ? 1 : 0));
+}
+
+
+/*!
+ * \brief Generate the segments of one pattern definition line family
+ * clipped to a hatch boundary.
+ *
+ * The boundary edges are transformed to the coordinates of the family
+ * and sorted, then the lines of the family are swept across the
+ * boundary with an active edge list, so each line only intersects the
+ * edges it crosses.\n
+ * The inside intervals of a line follow from the even-odd rule, the
+ * dashes are laid out from the base point of the line.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the family
+ * is too dense or no memory could be allocated.
+ */
+static int
+dxf_hatch_fill_family
+(
+        DxfHatchFillBoundary *boundary,
+                /*!< the flattened boundary. */
+        DxfHatchPatternDefLine *line,
+                /*!< the pattern definition line. */
+        DxfHatchFillBuffer *buffer
+                /*!< the buffer receiving the segments. */
+)
+{
+        DxfHatchPatternDefLineDash *dash = NULL;
+        DxfHatchFillScanEdge *scan = NULL;
+        DxfHatchFillScanEdge *edge = NULL;
+        double dashes[DXF_MAX_HATCH_PATTERN_DEF_LINE_DASH_ITEMS];
+        double frame[4];
+        double *crossings = NULL;
+        int *active = NULL;
+        double spacing;
+        double shift;
+        double period = 0.0;
+        double vmin;
+        double vmax;
+        double u0;
+        double u1;
+        double v0;
+        double v1;
+        double v;
+        double a;
+        double b;
+        double t;
+        long k;
+        long kmin;
+        long kmax;
+        int number_of_dashes = 0;
+        int number_of_scan_edges = 0;
+        int number_of_active = 0;
+        int number_of_crossings;
+        int next_edge = 0;
+        int result = EXIT_SUCCESS;
+        int i;
+        int j;
+
+        frame[0] = line->x0;
+        frame[1] = line->y0;
+        frame[2] = cos (line->angle * M_PI / 180.0);
+        frame[3] = sin (line->angle * M_PI / 180.0);
+        /* Distance between the lines and shift of the dashes from one
+         * line to the next. */
+        spacing = -line->x1 * frame[3] + line->y1 * frame[2];
+        shift = line->x1 * frame[2] + line->y1 * frame[3];
+        if (spacing < 0.0)
+        {
+                spacing = -spacing;
+                shift = -shift;
+        }
+        if ((spacing < 1e-12) || (boundary->number_of_edges == 0))
+        {
+                return (EXIT_SUCCESS);
+        }
+        for (dash = (DxfHatchPatternDefLineDash *) line->dashes; dash != NULL; dash = (DxfHatchPatternDefLineDash *) dash->next)
+        {
+                if (number_of_dashes == DXF_MAX_HATCH_PATTERN_DEF_LINE_DASH_ITEMS)
+                {
+                        break;
+                }
+                dashes[number_of_dashes++] = dash->length;
+                period += fabs (dash->length);
+        }
+        scan = malloc (boundary->number_of_edges * sizeof (DxfHatchFillScanEdge));
+        active = malloc (boundary->number_of_edges * sizeof (int));
+        crossings = malloc (boundary->number_of_edges * sizeof (double));
+        if ((scan == NULL) || (active == NULL) || (crossings == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for the scan edges.\n")),
+                  __FUNCTION__);
+                free (scan);
+                free (active);
+                free (crossings);
+                return (EXIT_FAILURE);
+        }
+        vmin = HUGE_VAL;
+        vmax = -HUGE_VAL;
+        for (i = 0; i < boundary->number_of_edges; i++)
+        {
+                a = boundary->edges[i].x0 - frame[0];
+                b = boundary->edges[i].y0 - frame[1];
+                u0 = a * frame[2] + b * frame[3];
+                v0 = -a * frame[3] + b * frame[2];
+                a = boundary->edges[i].x1 - frame[0];
+                b = boundary->edges[i].y1 - frame[1];
+                u1 = a * frame[2] + b * frame[3];
+                v1 = -a * frame[3] + b * frame[2];
+                if (v0 == v1)
+                {
+                        /* Parallel to the lines, never crossed. */
+                        continue;
+                }
+                edge = &scan[number_of_scan_edges++];
+                if (v0 > v1)
+                {
+                        t = u0; u0 = u1; u1 = t;
+                        t = v0; v0 = v1; v1 = t;
+                }
+                edge->vmin = v0;
+                edge->vmax = v1;
+                edge->u = u0;
+                edge->slope = (u1 - u0) / (v1 - v0);
+                vmin = (v0 < vmin) ? v0 : vmin;
+                vmax = (v1 > vmax) ? v1 : vmax;
+        }
+        if (number_of_scan_edges == 0)
+        {
+                free (scan);
+                free (active);
+                free (crossings);
+                return (EXIT_SUCCESS);
+        }
+        kmin = (long) ceil (vmin / spacing);
+        kmax = (long) floor (vmax / spacing);
+        if (kmax - kmin >= DXF_HATCH_FILL_MAX_LINES)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the hatch pattern is too dense.\n")),
+                  __FUNCTION__);
+                free (scan);
+                free (active);
+                free (crossings);
+                return (EXIT_FAILURE);
+        }
+        qsort (scan, number_of_scan_edges, sizeof (DxfHatchFillScanEdge), dxf_hatch_fill_compare_edges);
+        for (k = kmin; (k <= kmax) && (result == EXIT_SUCCESS); k++)
+        {
+                v = k * spacing;
+                /* Edges are crossed from their lowest V-value up to
+                 * (not including) their highest V-value. */
+                while ((next_edge < number_of_scan_edges) && (scan[next_edge].vmin <= v))
+                {
+                        active[number_of_active++] = next_edge++;
+                }
+                number_of_crossings = 0;
+                for (i = 0; i < number_of_active; i++)
+                {
+                        edge = &scan[active[i]];
+                        if (edge->vmax <= v)
+                        {
+                                active[i--] = active[--number_of_active];
+                                continue;
+                        }
+                        crossings[number_of_crossings++] = edge->u + edge->slope * (v - edge->vmin);
+                }
+                qsort (crossings, number_of_crossings, sizeof (double), dxf_hatch_fill_compare_doubles);
+                for (i = 0; i + 1 < number_of_crossings; i += 2)
+                {
+                        u0 = crossings[i];
+                        u1 = crossings[i + 1];
+                        if ((number_of_dashes == 0) || (period <= 0.0))
+                        {
+                                result |= dxf_hatch_fill_buffer_add (buffer, boundary, frame, v, u0, u1);
+                                continue;
+                        }
+                        /* Start at the repetition of the dash pattern
+                         * holding u0. */
+                        t = k * shift;
+                        t += floor ((u0 - t) / period) * period;
+                        for (; (t <= u1) && (result == EXIT_SUCCESS); t += period)
+                        {
+                                a = t;
+                                for (j = 0; j < number_of_dashes; j++)
+                                {
+                                        b = a + fabs (dashes[j]);
+                                        if (dashes[j] > 0.0)
+                                        {
+                                                if ((b > u0) && (a < u1))
+                                                {
+                                                        result |= dxf_hatch_fill_buffer_add (buffer, boundary, frame, v,
+                                                          (a > u0) ? a : u0, (b < u1) ? b : u1);
+                                                }
+                                        }
+                                        else if ((dashes[j] == 0.0) && (a >= u0) && (a <= u1))
+                                        {
+                                                result |= dxf_hatch_fill_buffer_add (buffer, boundary, frame, v, a, a);
+                                        }
+                                        a = b;
+                                }
+                        }
+                }
+        }
+        free (scan);
+        free (active);
+        free (crossings);
+        return ((result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Get the pattern definition lines of a hatch.
+ *
+ * \return the first pattern definition line, or \c NULL.
+ */
+static DxfHatchPatternDefLine *
+dxf_hatch_fill_get_def_lines
+(
+        DxfHatch *hatch
+                /*!< the hatch. */
+)
+{
+        if (hatch->def_lines != NULL)
+        {
+                return ((DxfHatchPatternDefLine *) hatch->def_lines);
+        }
+        if (hatch->patterns != NULL)
+        {
+                return ((DxfHatchPatternDefLine *) ((DxfHatchPattern *) hatch->patterns)->def_lines);
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Allocate memory for a hatch fill buffer.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfHatchFillBuffer *
+dxf_hatch_fill_buffer_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchFillBuffer *buffer = NULL;
+        size_t size;
+
+        size = sizeof (DxfHatchFillBuffer);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((buffer = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfHatchFillBuffer struct.\n")),
+                  __FUNCTION__);
+                buffer = NULL;
+        }
+        else
+        {
+                memset (buffer, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (buffer);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in an empty hatch
+ * fill buffer.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfHatchFillBuffer *
+dxf_hatch_fill_buffer_init
+(
+        DxfHatchFillBuffer *buffer
+                /*!< a pointer to a hatch fill buffer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                buffer = dxf_hatch_fill_buffer_new ();
+        }
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfHatchFillBuffer struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        buffer->segments = NULL;
+        buffer->number_of_segments = 0;
+        buffer->segments_size = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (buffer);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a hatch fill buffer and its
+ * segments.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_fill_buffer_free
+(
+        DxfHatchFillBuffer *buffer
+                /*!< a pointer to the memory occupied by the buffer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (buffer->segments);
+        free (buffer);
+        buffer = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Generate the pattern line segments of a DXF \c HATCH entity.
+ *
+ * Every pattern definition line family (angle, base point, offset and
+ * dashes, as stored in the hatch: rotated and scaled already) is swept
+ * across the boundary paths of the hatch.\n
+ * The boundary paths taking part follow the hatch style (see
+ * \c dxf_hatch_fill_use_path()), the inside of the boundary follows the
+ * even-odd rule, so islands and islands within islands alternate.\n
+ * Arcs, elliptical arcs and spline edges in the boundary are flattened
+ * to chords within \c tolerance.\n
+ * The segments are appended to \c buffer in WCS, family by family.\n
+ * Solid filled hatches have no pattern lines.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a boundary
+ * path has an invalid spline edge, a pattern is too dense or an error
+ * occurred.
+ */
+int
+dxf_hatch_fill
+(
+        DxfHatch *hatch,
+                /*!< a pointer to a DXF \c HATCH entity. */
+        double tolerance,
+                /*!< maximum distance between the flattened boundary
+                 * and curves in the boundary, 0.0 for
+                 * \c DXF_HATCH_FILL_RELATIVE_TOLERANCE of the radius of
+                 * arcs and \c DXF_NURBS_RELATIVE_TOLERANCE of the size
+                 * of splines. */
+        DxfHatchFillBuffer *buffer
+                /*!< the buffer receiving the segments. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchFillBoundary boundary;
+        DxfHatchPatternDefLine *line = NULL;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if ((hatch == NULL) || (buffer == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (hatch->solid_fill)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (dxf_hatch_fill_build_boundary (hatch, tolerance, &boundary) == EXIT_SUCCESS)
+        {
+                for (line = dxf_hatch_fill_get_def_lines (hatch); line != NULL; line = (DxfHatchPatternDefLine *) line->next)
+                {
+                        if ((result = dxf_hatch_fill_family (&boundary, line, buffer)) != EXIT_SUCCESS)
+                        {
+                                break;
+                        }
+                }
+        }
+        else
+        {
+                result = EXIT_FAILURE;
+        }
+        free (boundary.edges);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief A pattern line family of a hatch in \c dxf_hatch_fill_hatches().
+ */
+typedef struct
+dxf_hatch_fill_task
+{
+        int hatch;
+                /*!< Index of the hatch. */
+        DxfHatchPatternDefLine *line;
+                /*!< The pattern definition line. */
+        DxfHatchFillBuffer buffer;
+                /*!< The segments of the family. */
+        int result;
+                /*!< \c EXIT_SUCCESS or \c EXIT_FAILURE. */
+} DxfHatchFillTask;
+
+
+/*!
+ * \brief The hatches and tasks shared by the threads of
+ * \c dxf_hatch_fill_hatches().
+ */
+typedef struct
+dxf_hatch_fill_job
+{
+        DxfHatch **hatches;
+                /*!< Array of hatches. */
+        DxfHatchFillBoundary *boundaries;
+                /*!< Array of the flattened boundaries of the hatches. */
+        int number_of_hatches;
+                /*!< Number of hatches. */
+        double tolerance;
+                /*!< Chord tolerance. */
+        DxfHatchFillTask *tasks;
+                /*!< Array of tasks, in output order. */
+        int number_of_tasks;
+                /*!< Number of tasks. */
+        int next_hatch;
+                /*!< Index of the next hatch to flatten. */
+        int next_task;
+                /*!< Index of the next unclaimed task. */
+} DxfHatchFillJob;
+
+
+/*!
+ * \brief Run a worker thread of \c dxf_hatch_fill_hatches().
+ *
+ * Flattens the boundaries of the hatches when \c job->next_hatch has
+ * not passed the last hatch, else generates the segments of the
+ * families.
+ *
+ * \return \c NULL.
+ */
+static void *
+dxf_hatch_fill_worker
+(
+        void *data
+                /*!< a pointer to the \c DxfHatchFillJob. */
+)
+{
+        DxfHatchFillJob *job = (DxfHatchFillJob *) data;
+        DxfHatchFillTask *task = NULL;
+        int i;
+
+        while ((i = __atomic_fetch_add (&job->next_hatch, 1, __ATOMIC_RELAXED)) < job->number_of_hatches)
+        {
+                dxf_hatch_fill_build_boundary (job->hatches[i], job->tolerance, &job->boundaries[i]);
+        }
+        while ((i = __atomic_fetch_add (&job->next_task, 1, __ATOMIC_RELAXED)) < job->number_of_tasks)
+        {
+                task = &job->tasks[i];
+                task->result = job->boundaries[task->hatch].result;
+                if (task->result == EXIT_SUCCESS)
+                {
+                        task->result = dxf_hatch_fill_family (&job->boundaries[task->hatch],
+                          task->line, &task->buffer);
+                }
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Run the threads of \c dxf_hatch_fill_hatches() for one phase.
+ */
+static void
+dxf_hatch_fill_run
+(
+        DxfHatchFillJob *job,
+                /*!< the job. */
+        pthread_t *threads,
+                /*!< room for \c number_of_threads - 1 threads. */
+        int number_of_threads
+                /*!< number of threads. */
+)
+{
+        int started = 0;
+        int i;
+
+        for (i = 1; i < number_of_threads; i++)
+        {
+                if (pthread_create (&threads[started], NULL, dxf_hatch_fill_worker, job) == 0)
+                {
+                        started++;
+                }
+        }
+        /* The calling thread takes work too. */
+        dxf_hatch_fill_worker (job);
+        for (i = 0; i < started; i++)
+        {
+                pthread_join (threads[i], NULL);
+        }
+}
+
+
+/*!
+ * \brief Generate the pattern line segments of a number of DXF
+ * \c HATCH entities on multiple threads.
+ *
+ * The boundaries of the hatches are flattened in parallel first, then
+ * all pattern line families of all hatches are generated in parallel
+ * into private buffers, which are appended to the buffer of their
+ * hatch in order.\n
+ * The output is identical to \c dxf_hatch_fill() for each hatch.\n
+ * The hatches must not be modified while they are filled.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the fill of
+ * one of the hatches failed or an error occurred.
+ */
+int
+dxf_hatch_fill_hatches
+(
+        DxfHatch **hatches,
+                /*!< an array of pointers to DXF \c HATCH entities. */
+        int number_of_hatches,
+                /*!< number of hatches in \c hatches. */
+        double tolerance,
+                /*!< chord tolerance, see \c dxf_hatch_fill(). */
+        DxfHatchFillBuffer **buffers,
+                /*!< an array of \c number_of_hatches buffers receiving
+                 * the segments of each hatch. */
+        int number_of_threads
+                /*!< number of threads, 0 for the number of online
+                 * processors. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchFillJob job;
+        DxfHatchFillTask *task = NULL;
+        DxfHatchFillBuffer *buffer = NULL;
+        DxfHatchPatternDefLine *line = NULL;
+        DxfHatchFillSegment *segments = NULL;
+        pthread_t *threads = NULL;
+        int result = EXIT_SUCCESS;
+        int size;
+        int i;
+
+        /* Do some basic checks. */
+        if ((number_of_hatches > 0) && ((hatches == NULL) || (buffers == NULL)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < number_of_hatches; i++)
+        {
+                if ((hatches[i] == NULL) || (buffers[i] == NULL))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () a NULL pointer was passed.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (number_of_threads <= 0)
+        {
+                number_of_threads = (int) sysconf (_SC_NPROCESSORS_ONLN);
+        }
+        memset (&job, 0, sizeof (DxfHatchFillJob));
+        job.hatches = hatches;
+        job.number_of_hatches = number_of_hatches;
+        job.tolerance = tolerance;
+        for (i = 0; i < number_of_hatches; i++)
+        {
+                if (hatches[i]->solid_fill)
+                {
+                        continue;
+                }
+                for (line = dxf_hatch_fill_get_def_lines (hatches[i]); line != NULL; line = (DxfHatchPatternDefLine *) line->next)
+                {
+                        job.number_of_tasks++;
+                }
+        }
+        job.boundaries = calloc (number_of_hatches + 1, sizeof (DxfHatchFillBoundary));
+        job.tasks = calloc (job.number_of_tasks + 1, sizeof (DxfHatchFillTask));
+        threads = malloc ((number_of_threads + 1) * sizeof (pthread_t));
+        if ((job.boundaries == NULL) || (job.tasks == NULL) || (threads == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for fill tasks.\n")),
+                  __FUNCTION__);
+                free (job.boundaries);
+                free (job.tasks);
+                free (threads);
+                return (EXIT_FAILURE);
+        }
+        job.number_of_tasks = 0;
+        for (i = 0; i < number_of_hatches; i++)
+        {
+                if (hatches[i]->solid_fill)
+                {
+                        continue;
+                }
+                for (line = dxf_hatch_fill_get_def_lines (hatches[i]); line != NULL; line = (DxfHatchPatternDefLine *) line->next)
+                {
+                        task = &job.tasks[job.number_of_tasks++];
+                        task->hatch = i;
+                        task->line = line;
+                }
+        }
+        /* Flatten all boundaries before any family is generated. */
+        i = job.number_of_tasks;
+        job.number_of_tasks = 0;
+        dxf_hatch_fill_run (&job, threads, number_of_threads);
+        job.number_of_tasks = i;
+        job.next_task = 0;
+        dxf_hatch_fill_run (&job, threads, number_of_threads);
+        /* Append the segments of the families in order. */
+        for (i = 0; i < job.number_of_tasks; i++)
+        {
+                task = &job.tasks[i];
+                buffer = buffers[task->hatch];
+                result |= task->result;
+                if ((task->result == EXIT_SUCCESS)
+                  && (task->buffer.number_of_segments > 0))
+                {
+                        if (buffer->segments_size - buffer->number_of_segments < task->buffer.number_of_segments)
+                        {
+                                size = buffer->number_of_segments + task->buffer.number_of_segments;
+                                segments = realloc (buffer->segments, size * sizeof (DxfHatchFillSegment));
+                                if (segments == NULL)
+                                {
+                                        result = EXIT_FAILURE;
+                                        free (task->buffer.segments);
+                                        continue;
+                                }
+                                buffer->segments = segments;
+                                buffer->segments_size = size;
+                        }
+                        memcpy (buffer->segments + buffer->number_of_segments,
+                          task->buffer.segments,
+                          task->buffer.number_of_segments * sizeof (DxfHatchFillSegment));
+                        buffer->number_of_segments += task->buffer.number_of_segments;
+                }
+                free (task->buffer.segments);
+        }
+        for (i = 0; i < number_of_hatches; i++)
+        {
+                free (job.boundaries[i].edges);
+        }
+        free (job.boundaries);
+        free (job.tasks);
+        free (threads);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/* EOF */
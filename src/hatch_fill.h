@@ -0,0 +1,120 @@
+/*!
+ * \file hatch_fill.h
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Header file for the generation of the pattern lines of DXF hatches.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_HATCH_FILL_H
+#define LIBDXF_SRC_HATCH_FILL_H
+
+
+#include "global.h"
+#include "vec.h"
+#include "hatch.h"
+#include "nurbs.h"
+#include "tessellation.h"
+
+
+#define DXF_HATCH_FILL_MAX_LINES 10000000
+        /*!< \brief The maximum number of lines of one pattern
+         * definition line family across a hatch, denser patterns are
+         * refused. */
+
+
+#define DXF_HATCH_FILL_RELATIVE_TOLERANCE 0.001
+        /*!< \brief The chord tolerance for arcs and elliptical arcs in
+         * a boundary relative to their radius, used when no tolerance
+         * is given. */
+
+
+/*!
+ * \brief Definition of a segment of a hatch pattern line.
+ *
+ * A dot of the pattern has identical start and end points.
+ */
+typedef struct
+dxf_hatch_fill_segment_struct
+{
+        DxfVec3 start;
+                /*!< Start point in WCS. */
+        DxfVec3 end;
+                /*!< End point in WCS. */
+} DxfHatchFillSegment;
+
+
+/*!
+ * \brief Definition of a buffer of hatch pattern line segments.
+ */
+typedef struct
+dxf_hatch_fill_buffer_struct
+{
+        DxfHatchFillSegment *segments;
+                /*!< Array of segments. */
+        int number_of_segments;
+                /*!< Number of segments in \c segments. */
+        int segments_size;
+                /*!< Number of allocated segments. */
+} DxfHatchFillBuffer;
+
+
+DxfHatchFillBuffer *
+dxf_hatch_fill_buffer_new ();
+DxfHatchFillBuffer *
+dxf_hatch_fill_buffer_init
+(
+        DxfHatchFillBuffer *buffer
+);
+int
+dxf_hatch_fill_buffer_free
+(
+        DxfHatchFillBuffer *buffer
+);
+int
+dxf_hatch_fill
+(
+        DxfHatch *hatch,
+        double tolerance,
+        DxfHatchFillBuffer *buffer
+);
+int
+dxf_hatch_fill_hatches
+(
+        DxfHatch **hatches,
+        int number_of_hatches,
+        double tolerance,
+        DxfHatchFillBuffer **buffers,
+        int number_of_threads
+);
+
+#endif /* LIBDXF_SRC_HATCH_FILL_H */
+
+
+/* EOF */
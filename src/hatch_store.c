@@ -0,0 +1,1785 @@
+/*!
+ * \file hatch_store.c
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Functions for libDXF contiguous hatch storage.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "hatch_store.h"
+
+
+/*!
+ * \brief Make room for one more row in an array of a hatch store.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_hatch_store_reserve
+(
+        void **array,
+                /*!< a pointer to the array. */
+        int *size,
+                /*!< a pointer to the number of rows allocated. */
+        int number_of_rows,
+                /*!< the number of rows in use. */
+        size_t row_size
+                /*!< the size of a row. */
+)
+{
+        void *rows = NULL;
+        int new_size;
+
+        if (number_of_rows < *size)
+        {
+                return (EXIT_SUCCESS);
+        }
+        new_size = (*size == 0)
+          ? DXF_HATCH_STORE_INITIAL_NUMBER_OF_ROWS
+          : *size * 2;
+        rows = realloc (*array, (size_t) new_size * row_size);
+        if (rows == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfHatchStore array.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        *array = rows;
+        *size = new_size;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Pack a composite boundary path edge into the last boundary
+ * path of a libDXF hatch store.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_hatch_store_pack_edge
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        DxfHatchBoundaryPathEdge *composite
+                /*!< a pointer to a DXF \c HATCH boundary path edge. */
+)
+{
+        DxfHatchBoundaryPathEdgeArc *arc = NULL;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse = NULL;
+        DxfHatchBoundaryPathEdgeLine *line = NULL;
+        DxfHatchBoundaryPathEdgeSpline *spline = NULL;
+        DxfHatchBoundaryPathEdgeSplineCp *cp = NULL;
+        DxfHatchStoreEdge edge;
+        DxfHatchStoreControlPoint control_point;
+        int i;
+
+        for (arc = (DxfHatchBoundaryPathEdgeArc *) composite->arcs;
+          arc != NULL;
+          arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+        {
+                memset (&edge, 0, sizeof (DxfHatchStoreEdge));
+                edge.type = DXF_HATCH_STORE_EDGE_ARC;
+                edge.id_code = arc->id_code;
+                edge.x0 = arc->x0;
+                edge.y0 = arc->y0;
+                edge.radius = arc->radius;
+                edge.start_angle = arc->start_angle;
+                edge.end_angle = arc->end_angle;
+                edge.is_ccw = arc->is_ccw;
+                if (dxf_hatch_store_append_edge (store, &edge) < 0)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) composite->ellipses;
+          ellipse != NULL;
+          ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+        {
+                memset (&edge, 0, sizeof (DxfHatchStoreEdge));
+                edge.type = DXF_HATCH_STORE_EDGE_ELLIPSE;
+                edge.id_code = ellipse->id_code;
+                edge.x0 = ellipse->x0;
+                edge.y0 = ellipse->y0;
+                edge.x1 = ellipse->x1;
+                edge.y1 = ellipse->y1;
+                edge.ratio = ellipse->ratio;
+                edge.start_angle = ellipse->start_angle;
+                edge.end_angle = ellipse->end_angle;
+                edge.is_ccw = ellipse->is_ccw;
+                if (dxf_hatch_store_append_edge (store, &edge) < 0)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        for (line = (DxfHatchBoundaryPathEdgeLine *) composite->lines;
+          line != NULL;
+          line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+        {
+                memset (&edge, 0, sizeof (DxfHatchStoreEdge));
+                edge.type = DXF_HATCH_STORE_EDGE_LINE;
+                edge.id_code = line->id_code;
+                edge.x0 = line->x0;
+                edge.y0 = line->y0;
+                edge.x1 = line->x1;
+                edge.y1 = line->y1;
+                if (dxf_hatch_store_append_edge (store, &edge) < 0)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        for (spline = (DxfHatchBoundaryPathEdgeSpline *) composite->splines;
+          spline != NULL;
+          spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+        {
+                if (dxf_hatch_store_append_spline (store, spline->id_code,
+                  spline->degree, spline->rational, spline->periodic) < 0)
+                {
+                        return (EXIT_FAILURE);
+                }
+                for (i = 0; i < spline->number_of_knots; i++)
+                {
+                        if (dxf_hatch_store_append_knot (store, spline->knots[i]) < 0)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+                for (cp = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points;
+                  cp != NULL;
+                  cp = (DxfHatchBoundaryPathEdgeSplineCp *) cp->next)
+                {
+                        control_point.id_code = cp->id_code;
+                        control_point.x0 = cp->x0;
+                        control_point.y0 = cp->y0;
+                        control_point.weight = cp->weight;
+                        if (dxf_hatch_store_append_control_point (store, &control_point) < 0)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Pack a boundary path polyline into the last boundary path of
+ * a libDXF hatch store.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_hatch_store_pack_polyline
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        DxfHatchBoundaryPathPolyline *polyline
+                /*!< a pointer to a DXF \c HATCH boundary path
+                 * polyline. */
+)
+{
+        DxfHatchBoundaryPathPolylineVertex *iter = NULL;
+        DxfHatchStoreVertex vertex;
+
+        if (dxf_hatch_store_append_polyline (store, polyline->id_code,
+          polyline->is_closed) < 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+          iter != NULL;
+          iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next)
+        {
+                vertex.id_code = iter->id_code;
+                vertex.x0 = iter->x0;
+                vertex.y0 = iter->y0;
+                vertex.bulge = iter->bulge;
+                vertex.has_bulge = iter->has_bulge;
+                if (dxf_hatch_store_append_vertex (store, &vertex) < 0)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Create the list view of a boundary path of a libDXF hatch
+ * store.
+ *
+ * The edges are collected in one composite boundary path edge.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred (the nodes created so far are linked into \c path).
+ */
+static int
+dxf_hatch_store_unpack_path
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        DxfHatchStorePath *row,
+                /*!< a pointer to the boundary path in the store. */
+        DxfHatchBoundaryPath *path
+                /*!< a pointer to the (empty) DXF \c HATCH boundary
+                 * path to link the nodes into. */
+)
+{
+        DxfHatchBoundaryPathEdge *composite = NULL;
+        DxfHatchBoundaryPathEdgeArc *arc = NULL;
+        DxfHatchBoundaryPathEdgeArc *last_arc = NULL;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse = NULL;
+        DxfHatchBoundaryPathEdgeEllipse *last_ellipse = NULL;
+        DxfHatchBoundaryPathEdgeLine *line = NULL;
+        DxfHatchBoundaryPathEdgeLine *last_line = NULL;
+        DxfHatchBoundaryPathEdgeSpline *spline = NULL;
+        DxfHatchBoundaryPathEdgeSpline *last_spline = NULL;
+        DxfHatchBoundaryPathEdgeSplineCp *cp = NULL;
+        DxfHatchBoundaryPathEdgeSplineCp *last_cp = NULL;
+        DxfHatchBoundaryPathPolyline *polyline = NULL;
+        DxfHatchBoundaryPathPolyline *last_polyline = NULL;
+        DxfHatchBoundaryPathPolylineVertex *vertex = NULL;
+        DxfHatchBoundaryPathPolylineVertex *last_vertex = NULL;
+        DxfHatchStoreEdge *edge = NULL;
+        DxfHatchStoreSpline *spline_row = NULL;
+        DxfHatchStoreControlPoint *control_point = NULL;
+        DxfHatchStorePolyline *polyline_row = NULL;
+        DxfHatchStoreVertex *vertex_row = NULL;
+        int i;
+        int j;
+
+        path->id_code = row->id_code;
+        if (row->number_of_edges > 0)
+        {
+                composite = dxf_hatch_boundary_path_edge_init (dxf_hatch_boundary_path_edge_new ());
+                if (composite == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                composite->id_code = row->id_code;
+                path->edges = (struct DxfHatchBoundaryPathEdge *) composite;
+        }
+        for (i = 0; i < row->number_of_edges; i++)
+        {
+                edge = &store->edges[row->first_edge + i];
+                switch (edge->type)
+                {
+                        case DXF_HATCH_STORE_EDGE_ARC:
+                                arc = dxf_hatch_boundary_path_edge_arc_init (dxf_hatch_boundary_path_edge_arc_new ());
+                                if (arc == NULL)
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                                arc->id_code = edge->id_code;
+                                arc->x0 = edge->x0;
+                                arc->y0 = edge->y0;
+                                arc->radius = edge->radius;
+                                arc->start_angle = edge->start_angle;
+                                arc->end_angle = edge->end_angle;
+                                arc->is_ccw = edge->is_ccw;
+                                if (last_arc == NULL)
+                                {
+                                        composite->arcs = (struct DxfHatchBoundaryPathEdgeArc *) arc;
+                                }
+                                else
+                                {
+                                        last_arc->next = (struct DxfHatchBoundaryPathEdgeArc *) arc;
+                                }
+                                last_arc = arc;
+                                break;
+                        case DXF_HATCH_STORE_EDGE_ELLIPSE:
+                                ellipse = dxf_hatch_boundary_path_edge_ellipse_init (dxf_hatch_boundary_path_edge_ellipse_new ());
+                                if (ellipse == NULL)
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                                ellipse->id_code = edge->id_code;
+                                ellipse->x0 = edge->x0;
+                                ellipse->y0 = edge->y0;
+                                ellipse->x1 = edge->x1;
+                                ellipse->y1 = edge->y1;
+                                ellipse->ratio = edge->ratio;
+                                ellipse->start_angle = edge->start_angle;
+                                ellipse->end_angle = edge->end_angle;
+                                ellipse->is_ccw = edge->is_ccw;
+                                if (last_ellipse == NULL)
+                                {
+                                        composite->ellipses = (struct DxfHatchBoundaryPathEdgeEllipse *) ellipse;
+                                }
+                                else
+                                {
+                                        last_ellipse->next = (struct DxfHatchBoundaryPathEdgeEllipse *) ellipse;
+                                }
+                                last_ellipse = ellipse;
+                                break;
+                        case DXF_HATCH_STORE_EDGE_LINE:
+                                line = dxf_hatch_boundary_path_edge_line_init (dxf_hatch_boundary_path_edge_line_new ());
+                                if (line == NULL)
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                                line->id_code = edge->id_code;
+                                line->x0 = edge->x0;
+                                line->y0 = edge->y0;
+                                line->x1 = edge->x1;
+                                line->y1 = edge->y1;
+                                if (last_line == NULL)
+                                {
+                                        composite->lines = (struct DxfHatchBoundaryPathEdgeLine *) line;
+                                }
+                                else
+                                {
+                                        last_line->next = (struct DxfHatchBoundaryPathEdgeLine *) line;
+                                }
+                                last_line = line;
+                                break;
+                        case DXF_HATCH_STORE_EDGE_SPLINE:
+                                spline_row = &store->splines[edge->spline];
+                                spline = dxf_hatch_boundary_path_edge_spline_init (dxf_hatch_boundary_path_edge_spline_new ());
+                                if (spline == NULL)
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                                spline->id_code = spline_row->id_code;
+                                spline->degree = spline_row->degree;
+                                spline->rational = spline_row->rational;
+                                spline->periodic = spline_row->periodic;
+                                if (last_spline == NULL)
+                                {
+                                        composite->splines = (struct DxfHatchBoundaryPathEdgeSpline *) spline;
+                                }
+                                else
+                                {
+                                        last_spline->next = (struct DxfHatchBoundaryPathEdgeSpline *) spline;
+                                }
+                                last_spline = spline;
+                                if (dxf_hatch_boundary_path_edge_spline_reserve_knots (spline,
+                                  spline_row->number_of_knots) == EXIT_FAILURE)
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                                for (j = 0; j < spline_row->number_of_knots; j++)
+                                {
+                                        spline->knots[j] = store->knots[spline_row->first_knot + j];
+                                }
+                                spline->number_of_knots = spline_row->number_of_knots;
+                                last_cp = NULL;
+                                for (j = 0; j < spline_row->number_of_control_points; j++)
+                                {
+                                        control_point = &store->control_points[spline_row->first_control_point + j];
+                                        cp = dxf_hatch_boundary_path_edge_spline_control_point_init (dxf_hatch_boundary_path_edge_spline_control_point_new ());
+                                        if (cp == NULL)
+                                        {
+                                                return (EXIT_FAILURE);
+                                        }
+                                        cp->id_code = control_point->id_code;
+                                        cp->x0 = control_point->x0;
+                                        cp->y0 = control_point->y0;
+                                        cp->weight = control_point->weight;
+                                        if (last_cp == NULL)
+                                        {
+                                                spline->control_points = (struct DxfHatchBoundaryPathEdgeSplineCp *) cp;
+                                        }
+                                        else
+                                        {
+                                                last_cp->next = (struct DxfHatchBoundaryPathEdgeSplineCp *) cp;
+                                        }
+                                        last_cp = cp;
+                                        spline->number_of_control_points++;
+                                }
+                                break;
+                        default:
+                                fprintf (stderr,
+                                  (_("Error in %s () an invalid edge type %d was found.\n")),
+                                  __FUNCTION__, edge->type);
+                                return (EXIT_FAILURE);
+                }
+        }
+        for (i = 0; i < row->number_of_polylines; i++)
+        {
+                polyline_row = &store->polylines[row->first_polyline + i];
+                polyline = dxf_hatch_boundary_path_polyline_init (dxf_hatch_boundary_path_polyline_new ());
+                if (polyline == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                polyline->id_code = polyline_row->id_code;
+                polyline->is_closed = polyline_row->is_closed;
+                if (last_polyline == NULL)
+                {
+                        path->polylines = (struct DxfHatchBoundaryPathPolyline *) polyline;
+                }
+                else
+                {
+                        last_polyline->next = (struct DxfHatchBoundaryPathPolyline *) polyline;
+                }
+                last_polyline = polyline;
+                last_vertex = NULL;
+                for (j = 0; j < polyline_row->number_of_vertices; j++)
+                {
+                        vertex_row = &store->vertices[polyline_row->first_vertex + j];
+                        vertex = dxf_hatch_boundary_path_polyline_vertex_init (dxf_hatch_boundary_path_polyline_vertex_new ());
+                        if (vertex == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        vertex->id_code = vertex_row->id_code;
+                        vertex->x0 = vertex_row->x0;
+                        vertex->y0 = vertex_row->y0;
+                        vertex->bulge = vertex_row->bulge;
+                        vertex->has_bulge = vertex_row->has_bulge;
+                        if (last_vertex == NULL)
+                        {
+                                polyline->vertices = (struct DxfHatchBoundaryPathPolylineVertex *) vertex;
+                        }
+                        else
+                        {
+                                last_vertex->next = (struct DxfHatchBoundaryPathPolylineVertex *) vertex;
+                        }
+                        last_vertex = vertex;
+                        polyline->number_of_vertices++;
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a libDXF hatch store.
+ *
+ * Fill the memory contents with zeros.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfHatchStore *
+dxf_hatch_store_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchStore *store = NULL;
+        size_t size;
+
+        size = sizeof (DxfHatchStore);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((store = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfHatchStore struct.\n")),
+                  __FUNCTION__);
+                store = NULL;
+        }
+        else
+        {
+                memset (store, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (store);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a libDXF hatch
+ * store.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfHatchStore *
+dxf_hatch_store_init
+(
+        DxfHatchStore *store
+                /*!< a pointer to a libDXF hatch store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (store == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                store = dxf_hatch_store_new ();
+        }
+        if (store == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfHatchStore struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        store->paths = NULL;
+        store->number_of_paths = 0;
+        store->paths_size = 0;
+        store->polylines = NULL;
+        store->number_of_polylines = 0;
+        store->polylines_size = 0;
+        store->vertices = NULL;
+        store->number_of_vertices = 0;
+        store->vertices_size = 0;
+        store->edges = NULL;
+        store->number_of_edges = 0;
+        store->edges_size = 0;
+        store->splines = NULL;
+        store->number_of_splines = 0;
+        store->splines_size = 0;
+        store->control_points = NULL;
+        store->number_of_control_points = 0;
+        store->control_points_size = 0;
+        store->knots = NULL;
+        store->number_of_knots = 0;
+        store->knots_size = 0;
+        store->def_lines = NULL;
+        store->number_of_def_lines = 0;
+        store->def_lines_size = 0;
+        store->dashes = NULL;
+        store->number_of_dashes = 0;
+        store->dashes_size = 0;
+        store->seed_points = NULL;
+        store->number_of_seed_points = 0;
+        store->seed_points_size = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (store);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a libDXF hatch store and all
+ * it's data fields.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_store_free
+(
+        DxfHatchStore *store
+                /*!< a pointer to the memory occupied by the libDXF
+                 * hatch store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (store == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (store->paths);
+        free (store->polylines);
+        free (store->vertices);
+        free (store->edges);
+        free (store->splines);
+        free (store->control_points);
+        free (store->knots);
+        free (store->def_lines);
+        free (store->dashes);
+        free (store->seed_points);
+        free (store);
+        store = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove all rows from a libDXF hatch store.
+ *
+ * The allocated arrays are kept for reuse.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_store_clear
+(
+        DxfHatchStore *store
+                /*!< a pointer to a libDXF hatch store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (store == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        store->number_of_paths = 0;
+        store->number_of_polylines = 0;
+        store->number_of_vertices = 0;
+        store->number_of_edges = 0;
+        store->number_of_splines = 0;
+        store->number_of_control_points = 0;
+        store->number_of_knots = 0;
+        store->number_of_def_lines = 0;
+        store->number_of_dashes = 0;
+        store->number_of_seed_points = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a boundary path to a libDXF hatch store.
+ *
+ * Subsequently appended edges and polylines belong to this boundary
+ * path.
+ *
+ * \return the index of the boundary path, or -1 when an error
+ * occurred.
+ */
+int
+dxf_hatch_store_append_path
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        int id_code
+                /*!< identification number of the boundary path. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchStorePath *path = NULL;
+
+        /* Do some basic checks. */
+        if (store == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (dxf_hatch_store_reserve ((void **) &store->paths,
+          &store->paths_size, store->number_of_paths,
+          sizeof (DxfHatchStorePath)) == EXIT_FAILURE)
+        {
+                return (-1);
+        }
+        path = &store->paths[store->number_of_paths];
+        path->id_code = id_code;
+        path->first_edge = store->number_of_edges;
+        path->number_of_edges = 0;
+        path->first_polyline = store->number_of_polylines;
+        path->number_of_polylines = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (store->number_of_paths++);
+}
+
+
+/*!
+ * \brief Append a polyline to the last boundary path of a libDXF hatch
+ * store.
+ *
+ * Subsequently appended vertices belong to this polyline.
+ *
+ * \return the index of the polyline, or -1 when an error occurred.
+ */
+int
+dxf_hatch_store_append_polyline
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        int id_code,
+                /*!< identification number of the polyline. */
+        int is_closed
+                /*!< polyline is closed flag. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchStorePolyline *polyline = NULL;
+
+        /* Do some basic checks. */
+        if (store == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (store->number_of_paths == 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no boundary path was appended.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (dxf_hatch_store_reserve ((void **) &store->polylines,
+          &store->polylines_size, store->number_of_polylines,
+          sizeof (DxfHatchStorePolyline)) == EXIT_FAILURE)
+        {
+                return (-1);
+        }
+        polyline = &store->polylines[store->number_of_polylines];
+        polyline->id_code = id_code;
+        polyline->is_closed = is_closed;
+        polyline->first_vertex = store->number_of_vertices;
+        polyline->number_of_vertices = 0;
+        store->paths[store->number_of_paths - 1].number_of_polylines++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (store->number_of_polylines++);
+}
+
+
+/*!
+ * \brief Append a vertex to the last polyline of a libDXF hatch store.
+ *
+ * \return the index of the vertex, or -1 when an error occurred.
+ */
+int
+dxf_hatch_store_append_vertex
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        DxfHatchStoreVertex *vertex
+                /*!< the vertex to copy into the store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((store == NULL) || (vertex == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (store->number_of_polylines == 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no polyline was appended.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (dxf_hatch_store_reserve ((void **) &store->vertices,
+          &store->vertices_size, store->number_of_vertices,
+          sizeof (DxfHatchStoreVertex)) == EXIT_FAILURE)
+        {
+                return (-1);
+        }
+        store->vertices[store->number_of_vertices] = *vertex;
+        store->polylines[store->number_of_polylines - 1].number_of_vertices++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (store->number_of_vertices++);
+}
+
+
+/*!
+ * \brief Append a line, arc or ellipse edge to the last boundary path
+ * of a libDXF hatch store.
+ *
+ * Spline edges are appended with \c dxf_hatch_store_append_spline().
+ *
+ * \return the index of the edge, or -1 when an error occurred.
+ */
+int
+dxf_hatch_store_append_edge
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        DxfHatchStoreEdge *edge
+                /*!< the edge to copy into the store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((store == NULL) || (edge == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if ((edge->type != DXF_HATCH_STORE_EDGE_LINE)
+          && (edge->type != DXF_HATCH_STORE_EDGE_ARC)
+          && (edge->type != DXF_HATCH_STORE_EDGE_ELLIPSE))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid edge type %d was passed.\n")),
+                  __FUNCTION__, edge->type);
+                return (-1);
+        }
+        if (store->number_of_paths == 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no boundary path was appended.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (dxf_hatch_store_reserve ((void **) &store->edges,
+          &store->edges_size, store->number_of_edges,
+          sizeof (DxfHatchStoreEdge)) == EXIT_FAILURE)
+        {
+                return (-1);
+        }
+        store->edges[store->number_of_edges] = *edge;
+        store->edges[store->number_of_edges].spline = -1;
+        store->paths[store->number_of_paths - 1].number_of_edges++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (store->number_of_edges++);
+}
+
+
+/*!
+ * \brief Append a spline edge to the last boundary path of a libDXF
+ * hatch store.
+ *
+ * Both a spline row and an edge row of type
+ * \c DXF_HATCH_STORE_EDGE_SPLINE are appended.\n
+ * Subsequently appended knot values and control points belong to this
+ * spline.
+ *
+ * \return the index of the spline, or -1 when an error occurred.
+ */
+int
+dxf_hatch_store_append_spline
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        int id_code,
+                /*!< identification number of the spline. */
+        int degree,
+                /*!< degree of the spline. */
+        int rational,
+                /*!< rational flag. */
+        int periodic
+                /*!< periodic flag. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchStoreSpline *spline = NULL;
+        DxfHatchStoreEdge *edge = NULL;
+
+        /* Do some basic checks. */
+        if (store == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (store->number_of_paths == 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no boundary path was appended.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if ((dxf_hatch_store_reserve ((void **) &store->splines,
+          &store->splines_size, store->number_of_splines,
+          sizeof (DxfHatchStoreSpline)) == EXIT_FAILURE)
+          || (dxf_hatch_store_reserve ((void **) &store->edges,
+          &store->edges_size, store->number_of_edges,
+          sizeof (DxfHatchStoreEdge)) == EXIT_FAILURE))
+        {
+                return (-1);
+        }
+        spline = &store->splines[store->number_of_splines];
+        spline->id_code = id_code;
+        spline->degree = degree;
+        spline->rational = rational;
+        spline->periodic = periodic;
+        spline->first_knot = store->number_of_knots;
+        spline->number_of_knots = 0;
+        spline->first_control_point = store->number_of_control_points;
+        spline->number_of_control_points = 0;
+        edge = &store->edges[store->number_of_edges];
+        memset (edge, 0, sizeof (DxfHatchStoreEdge));
+        edge->type = DXF_HATCH_STORE_EDGE_SPLINE;
+        edge->id_code = id_code;
+        edge->spline = store->number_of_splines;
+        store->number_of_edges++;
+        store->paths[store->number_of_paths - 1].number_of_edges++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (store->number_of_splines++);
+}
+
+
+/*!
+ * \brief Append a knot value to the last spline of a libDXF hatch
+ * store.
+ *
+ * \return the index of the knot value, or -1 when an error occurred.
+ */
+int
+dxf_hatch_store_append_knot
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        double knot
+                /*!< the knot value. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (store == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (store->number_of_splines == 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no spline was appended.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (dxf_hatch_store_reserve ((void **) &store->knots,
+          &store->knots_size, store->number_of_knots,
+          sizeof (double)) == EXIT_FAILURE)
+        {
+                return (-1);
+        }
+        store->knots[store->number_of_knots] = knot;
+        store->splines[store->number_of_splines - 1].number_of_knots++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (store->number_of_knots++);
+}
+
+
+/*!
+ * \brief Append a control point to the last spline of a libDXF hatch
+ * store.
+ *
+ * \return the index of the control point, or -1 when an error
+ * occurred.
+ */
+int
+dxf_hatch_store_append_control_point
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        DxfHatchStoreControlPoint *control_point
+                /*!< the control point to copy into the store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((store == NULL) || (control_point == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (store->number_of_splines == 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no spline was appended.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (dxf_hatch_store_reserve ((void **) &store->control_points,
+          &store->control_points_size, store->number_of_control_points,
+          sizeof (DxfHatchStoreControlPoint)) == EXIT_FAILURE)
+        {
+                return (-1);
+        }
+        store->control_points[store->number_of_control_points] = *control_point;
+        store->splines[store->number_of_splines - 1].number_of_control_points++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (store->number_of_control_points++);
+}
+
+
+/*!
+ * \brief Append a pattern definition line to a libDXF hatch store.
+ *
+ * Subsequently appended dash lengths belong to this pattern definition
+ * line.
+ *
+ * \return the index of the pattern definition line, or -1 when an
+ * error occurred.
+ */
+int
+dxf_hatch_store_append_def_line
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        DxfHatchStoreDefLine *def_line
+                /*!< the pattern definition line to copy into the
+                 * store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((store == NULL) || (def_line == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (dxf_hatch_store_reserve ((void **) &store->def_lines,
+          &store->def_lines_size, store->number_of_def_lines,
+          sizeof (DxfHatchStoreDefLine)) == EXIT_FAILURE)
+        {
+                return (-1);
+        }
+        store->def_lines[store->number_of_def_lines] = *def_line;
+        store->def_lines[store->number_of_def_lines].first_dash = store->number_of_dashes;
+        store->def_lines[store->number_of_def_lines].number_of_dashes = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (store->number_of_def_lines++);
+}
+
+
+/*!
+ * \brief Append a dash length to the last pattern definition line of a
+ * libDXF hatch store.
+ *
+ * \return the index of the dash length, or -1 when an error occurred.
+ */
+int
+dxf_hatch_store_append_dash
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        double length
+                /*!< the dash length. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (store == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (store->number_of_def_lines == 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no pattern definition line was appended.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (dxf_hatch_store_reserve ((void **) &store->dashes,
+          &store->dashes_size, store->number_of_dashes,
+          sizeof (double)) == EXIT_FAILURE)
+        {
+                return (-1);
+        }
+        store->dashes[store->number_of_dashes] = length;
+        store->def_lines[store->number_of_def_lines - 1].number_of_dashes++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (store->number_of_dashes++);
+}
+
+
+/*!
+ * \brief Append a seed point to a libDXF hatch store.
+ *
+ * \return the index of the seed point, or -1 when an error occurred.
+ */
+int
+dxf_hatch_store_append_seed_point
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        DxfHatchStoreSeedPoint *seed_point
+                /*!< the seed point to copy into the store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((store == NULL) || (seed_point == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (dxf_hatch_store_reserve ((void **) &store->seed_points,
+          &store->seed_points_size, store->number_of_seed_points,
+          sizeof (DxfHatchStoreSeedPoint)) == EXIT_FAILURE)
+        {
+                return (-1);
+        }
+        store->seed_points[store->number_of_seed_points] = *seed_point;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (store->number_of_seed_points++);
+}
+
+
+/*!
+ * \brief Get a boundary path from a libDXF hatch store.
+ *
+ * \return a pointer to the boundary path, or \c NULL when an error
+ * occurred.
+ */
+DxfHatchStorePath *
+dxf_hatch_store_get_path
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        int index
+                /*!< index of the boundary path
+                 * [0 .. number_of_paths - 1]. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (store == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((index < 0) || (index >= store->number_of_paths))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () received an invalid value in index.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (&store->paths[index]);
+}
+
+
+/*!
+ * \brief Get an edge of a boundary path from a libDXF hatch store.
+ *
+ * \return a pointer to the edge, or \c NULL when an error occurred.
+ */
+DxfHatchStoreEdge *
+dxf_hatch_store_get_edge
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        DxfHatchStorePath *path,
+                /*!< a pointer to a boundary path in the store. */
+        int index
+                /*!< index of the edge in the boundary path
+                 * [0 .. number_of_edges - 1]. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((store == NULL) || (path == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((index < 0) || (index >= path->number_of_edges))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () received an invalid value in index.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (&store->edges[path->first_edge + index]);
+}
+
+
+/*!
+ * \brief Get a polyline of a boundary path from a libDXF hatch store.
+ *
+ * \return a pointer to the polyline, or \c NULL when an error
+ * occurred.
+ */
+DxfHatchStorePolyline *
+dxf_hatch_store_get_polyline
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        DxfHatchStorePath *path,
+                /*!< a pointer to a boundary path in the store. */
+        int index
+                /*!< index of the polyline in the boundary path
+                 * [0 .. number_of_polylines - 1]. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((store == NULL) || (path == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((index < 0) || (index >= path->number_of_polylines))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () received an invalid value in index.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (&store->polylines[path->first_polyline + index]);
+}
+
+
+/*!
+ * \brief Get a vertex of a polyline from a libDXF hatch store.
+ *
+ * \return a pointer to the vertex, or \c NULL when an error occurred.
+ */
+DxfHatchStoreVertex *
+dxf_hatch_store_get_vertex
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        DxfHatchStorePolyline *polyline,
+                /*!< a pointer to a polyline in the store. */
+        int index
+                /*!< index of the vertex in the polyline
+                 * [0 .. number_of_vertices - 1]. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((store == NULL) || (polyline == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((index < 0) || (index >= polyline->number_of_vertices))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () received an invalid value in index.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (&store->vertices[polyline->first_vertex + index]);
+}
+
+
+/*!
+ * \brief Get the spline of a spline edge from a libDXF hatch store.
+ *
+ * \return a pointer to the spline, or \c NULL when an error occurred.
+ */
+DxfHatchStoreSpline *
+dxf_hatch_store_get_spline
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        DxfHatchStoreEdge *edge
+                /*!< a pointer to a spline edge in the store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((store == NULL) || (edge == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((edge->type != DXF_HATCH_STORE_EDGE_SPLINE)
+          || (edge->spline < 0)
+          || (edge->spline >= store->number_of_splines))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the edge is not a spline.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (&store->splines[edge->spline]);
+}
+
+
+/*!
+ * \brief Get the knot values of a spline from a libDXF hatch store.
+ *
+ * \return a pointer to the first of \c number_of_knots knot values, or
+ * \c NULL when the spline has no knot values or an error occurred.
+ */
+double *
+dxf_hatch_store_get_knots
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        DxfHatchStoreSpline *spline
+                /*!< a pointer to a spline in the store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((store == NULL) || (spline == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (spline->number_of_knots == 0)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (&store->knots[spline->first_knot]);
+}
+
+
+/*!
+ * \brief Get the control points of a spline from a libDXF hatch store.
+ *
+ * \return a pointer to the first of \c number_of_control_points control
+ * points, or \c NULL when the spline has no control points or an error
+ * occurred.
+ */
+DxfHatchStoreControlPoint *
+dxf_hatch_store_get_control_points
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        DxfHatchStoreSpline *spline
+                /*!< a pointer to a spline in the store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((store == NULL) || (spline == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (spline->number_of_control_points == 0)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (&store->control_points[spline->first_control_point]);
+}
+
+
+/*!
+ * \brief Get the dash lengths of a pattern definition line from a
+ * libDXF hatch store.
+ *
+ * \return a pointer to the first of \c number_of_dashes dash lengths,
+ * or \c NULL when the pattern definition line has no dashes or an error
+ * occurred.
+ */
+double *
+dxf_hatch_store_get_dashes
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        DxfHatchStoreDefLine *def_line
+                /*!< a pointer to a pattern definition line in the
+                 * store. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((store == NULL) || (def_line == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (def_line->number_of_dashes == 0)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (&store->dashes[def_line->first_dash]);
+}
+
+
+/*!
+ * \brief Pack the boundary paths, pattern definition lines and seed
+ * points of a DXF \c HATCH entity into a libDXF hatch store.
+ *
+ * The store is cleared first, so one store can be reused for all the
+ * \c HATCH entities of a drawing.\n
+ * The edges of a composite boundary path edge are packed in the order
+ * arcs, ellipses, lines and splines.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_store_pack
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        DxfHatch *hatch
+                /*!< a pointer to a DXF \c HATCH entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPath *path = NULL;
+        DxfHatchBoundaryPathEdge *composite = NULL;
+        DxfHatchBoundaryPathPolyline *polyline = NULL;
+        DxfHatchPatternDefLine *line = NULL;
+        DxfHatchPatternDefLineDash *dash = NULL;
+        DxfHatchPatternSeedPoint *point = NULL;
+        DxfHatchStoreDefLine def_line;
+        DxfHatchStoreSeedPoint seed_point;
+
+        /* Do some basic checks. */
+        if ((store == NULL) || (hatch == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_hatch_store_clear (store);
+        for (path = (DxfHatchBoundaryPath *) hatch->paths;
+          path != NULL;
+          path = (DxfHatchBoundaryPath *) path->next)
+        {
+                if (dxf_hatch_store_append_path (store, path->id_code) < 0)
+                {
+                        return (EXIT_FAILURE);
+                }
+                for (composite = (DxfHatchBoundaryPathEdge *) path->edges;
+                  composite != NULL;
+                  composite = (DxfHatchBoundaryPathEdge *) composite->next)
+                {
+                        if (dxf_hatch_store_pack_edge (store, composite) == EXIT_FAILURE)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+                for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines;
+                  polyline != NULL;
+                  polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+                {
+                        if (dxf_hatch_store_pack_polyline (store, polyline) == EXIT_FAILURE)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+        }
+        for (line = (DxfHatchPatternDefLine *) hatch->def_lines;
+          line != NULL;
+          line = (DxfHatchPatternDefLine *) line->next)
+        {
+                def_line.id_code = line->id_code;
+                def_line.angle = line->angle;
+                def_line.x0 = line->x0;
+                def_line.y0 = line->y0;
+                def_line.x1 = line->x1;
+                def_line.y1 = line->y1;
+                if (dxf_hatch_store_append_def_line (store, &def_line) < 0)
+                {
+                        return (EXIT_FAILURE);
+                }
+                for (dash = (DxfHatchPatternDefLineDash *) line->dashes;
+                  dash != NULL;
+                  dash = (DxfHatchPatternDefLineDash *) dash->next)
+                {
+                        if (dxf_hatch_store_append_dash (store, dash->length) < 0)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+        }
+        for (point = (DxfHatchPatternSeedPoint *) hatch->seed_points;
+          point != NULL;
+          point = (DxfHatchPatternSeedPoint *) point->next)
+        {
+                seed_point.id_code = point->id_code;
+                seed_point.x0 = point->x0;
+                seed_point.y0 = point->y0;
+                if (dxf_hatch_store_append_seed_point (store, &seed_point) < 0)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Create the linked list view of a libDXF hatch store in a DXF
+ * \c HATCH entity.
+ *
+ * The boundary paths, pattern definition lines and seed points of the
+ * store are copied into newly allocated list nodes, which are linked
+ * into the (empty) \c paths, \c def_lines and \c seed_points members of
+ * \c hatch, and the counters of \c hatch are updated.\n
+ * The edges of a boundary path are collected in one composite boundary
+ * path edge.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred (the nodes created so far are linked into \c hatch).
+ */
+int
+dxf_hatch_store_unpack
+(
+        DxfHatchStore *store,
+                /*!< a pointer to a libDXF hatch store. */
+        DxfHatch *hatch
+                /*!< a pointer to a DXF \c HATCH entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPath *path = NULL;
+        DxfHatchBoundaryPath *last_path = NULL;
+        DxfHatchPatternDefLine *line = NULL;
+        DxfHatchPatternDefLine *last_line = NULL;
+        DxfHatchPatternDefLineDash *dash = NULL;
+        DxfHatchPatternDefLineDash *last_dash = NULL;
+        DxfHatchPatternSeedPoint *point = NULL;
+        DxfHatchPatternSeedPoint *last_point = NULL;
+        DxfHatchStoreDefLine *def_line = NULL;
+        int i;
+        int j;
+
+        /* Do some basic checks. */
+        if ((store == NULL) || (hatch == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((hatch->paths != NULL)
+          || (hatch->def_lines != NULL)
+          || (hatch->seed_points != NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the DxfHatch already contains boundary paths, pattern definition lines or seed points.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        hatch->number_of_boundary_paths = 0;
+        hatch->number_of_pattern_def_lines = 0;
+        hatch->number_of_seed_points = 0;
+        for (i = 0; i < store->number_of_paths; i++)
+        {
+                path = dxf_hatch_boundary_path_new ();
+                if (path == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                if (last_path == NULL)
+                {
+                        hatch->paths = (struct DxfHatchBoundaryPath *) path;
+                }
+                else
+                {
+                        last_path->next = (struct DxfHatchBoundaryPath *) path;
+                }
+                last_path = path;
+                hatch->number_of_boundary_paths++;
+                if (dxf_hatch_store_unpack_path (store, &store->paths[i], path) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        for (i = 0; i < store->number_of_def_lines; i++)
+        {
+                def_line = &store->def_lines[i];
+                line = dxf_hatch_pattern_def_line_init (dxf_hatch_pattern_def_line_new ());
+                if (line == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                line->id_code = def_line->id_code;
+                line->angle = def_line->angle;
+                line->x0 = def_line->x0;
+                line->y0 = def_line->y0;
+                line->x1 = def_line->x1;
+                line->y1 = def_line->y1;
+                if (last_line == NULL)
+                {
+                        hatch->def_lines = (struct DxfHatchPatternDefLine *) line;
+                }
+                else
+                {
+                        last_line->next = (struct DxfHatchPatternDefLine *) line;
+                }
+                last_line = line;
+                hatch->number_of_pattern_def_lines++;
+                last_dash = NULL;
+                for (j = 0; j < def_line->number_of_dashes; j++)
+                {
+                        dash = dxf_hatch_pattern_def_line_dash_init (dxf_hatch_pattern_def_line_dash_new ());
+                        if (dash == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        dash->length = store->dashes[def_line->first_dash + j];
+                        if (last_dash == NULL)
+                        {
+                                line->dashes = (struct DxfHatchPatternDefLineDash *) dash;
+                        }
+                        else
+                        {
+                                last_dash->next = (struct DxfHatchPatternDefLineDash *) dash;
+                        }
+                        last_dash = dash;
+                        line->number_of_dash_items++;
+                }
+        }
+        for (i = 0; i < store->number_of_seed_points; i++)
+        {
+                point = dxf_hatch_pattern_seedpoint_init (dxf_hatch_pattern_seedpoint_new ());
+                if (point == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                point->id_code = store->seed_points[i].id_code;
+                point->x0 = store->seed_points[i].x0;
+                point->y0 = store->seed_points[i].y0;
+                if (last_point == NULL)
+                {
+                        hatch->seed_points = (struct DxfHatchPatternSeedPoint *) point;
+                }
+                else
+                {
+                        last_point->next = (struct DxfHatchPatternSeedPoint *) point;
+                }
+                last_point = point;
+                hatch->number_of_seed_points++;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
@@ -0,0 +1,494 @@
+/*!
+ * \file hatch_store.h
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Header file for libDXF contiguous hatch storage.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_HATCH_STORE_H
+#define LIBDXF_SRC_HATCH_STORE_H
+
+
+#include "global.h"
+#include "hatch.h"
+
+
+#define DXF_HATCH_STORE_INITIAL_NUMBER_OF_ROWS 16
+        /*!< \brief The number of rows allocated for an array of a
+         * \c DxfHatchStore when the first row is appended. */
+
+#define DXF_HATCH_STORE_EDGE_LINE 1
+        /*!< \brief Hatch boundary path edge type: line. */
+#define DXF_HATCH_STORE_EDGE_ARC 2
+        /*!< \brief Hatch boundary path edge type: circular arc. */
+#define DXF_HATCH_STORE_EDGE_ELLIPSE 3
+        /*!< \brief Hatch boundary path edge type: elliptic arc. */
+#define DXF_HATCH_STORE_EDGE_SPLINE 4
+        /*!< \brief Hatch boundary path edge type: spline. */
+
+
+/*!
+ * \brief Definition of a boundary path in a \c DxfHatchStore.
+ *
+ * The edges and polylines of the boundary path are the
+ * \c number_of_edges rows starting at \c first_edge and the
+ * \c number_of_polylines rows starting at \c first_polyline.
+ */
+typedef struct
+dxf_hatch_store_path
+{
+        int id_code;
+                /*!< Group code = 5. */
+        int first_edge;
+                /*!< Index of the first edge of the boundary path. */
+        int number_of_edges;
+                /*!< Number of edges of the boundary path. */
+        int first_polyline;
+                /*!< Index of the first polyline of the boundary path. */
+        int number_of_polylines;
+                /*!< Number of polylines of the boundary path. */
+} DxfHatchStorePath;
+
+
+/*!
+ * \brief Definition of a boundary path polyline in a
+ * \c DxfHatchStore.
+ */
+typedef struct
+dxf_hatch_store_polyline
+{
+        int id_code;
+                /*!< Group code = 5. */
+        int is_closed;
+                /*!< Group code = 73. */
+        int first_vertex;
+                /*!< Index of the first vertex of the polyline. */
+        int number_of_vertices;
+                /*!< Number of vertices of the polyline.\n
+                 * Group code = 93. */
+} DxfHatchStorePolyline;
+
+
+/*!
+ * \brief Definition of a boundary path polyline vertex in a
+ * \c DxfHatchStore.
+ */
+typedef struct
+dxf_hatch_store_vertex
+{
+        int id_code;
+                /*!< Group code = 5. */
+        double x0;
+                /*!< Group code = 10. */
+        double y0;
+                /*!< Group code = 20. */
+        double bulge;
+                /*!< Group code = 42. */
+        int has_bulge;
+                /*!< Group code = 72. */
+} DxfHatchStoreVertex;
+
+
+/*!
+ * \brief Definition of a boundary path edge in a \c DxfHatchStore.
+ *
+ * One row for every type of edge, tagged by \c type.\n
+ * Members which are not used by the type of edge are 0.0.
+ */
+typedef struct
+dxf_hatch_store_edge
+{
+        int type;
+                /*!< Edge type, one of \c DXF_HATCH_STORE_EDGE_LINE,
+                 * \c DXF_HATCH_STORE_EDGE_ARC,
+                 * \c DXF_HATCH_STORE_EDGE_ELLIPSE or
+                 * \c DXF_HATCH_STORE_EDGE_SPLINE.\n
+                 * Group code = 72. */
+        int id_code;
+                /*!< Group code = 5. */
+        double x0;
+                /*!< X-value of the start point (line) or the center
+                 * point (arc, ellipse).\n
+                 * Group code = 10. */
+        double y0;
+                /*!< Y-value of the start point (line) or the center
+                 * point (arc, ellipse).\n
+                 * Group code = 20. */
+        double x1;
+                /*!< X-value of the end point (line) or the end point
+                 * of the major axis (ellipse).\n
+                 * Group code = 11. */
+        double y1;
+                /*!< Y-value of the end point (line) or the end point
+                 * of the major axis (ellipse).\n
+                 * Group code = 21. */
+        double radius;
+                /*!< Radius (arc).\n
+                 * Group code = 40. */
+        double ratio;
+                /*!< Ratio of minor axis to major axis (ellipse).\n
+                 * Group code = 40. */
+        double start_angle;
+                /*!< Start angle (arc, ellipse).\n
+                 * Group code = 50. */
+        double end_angle;
+                /*!< End angle (arc, ellipse).\n
+                 * Group code = 51. */
+        int is_ccw;
+                /*!< Counterclockwise flag (arc, ellipse).\n
+                 * Group code = 73. */
+        int spline;
+                /*!< Index of the spline (spline), -1 for the other
+                 * types of edges. */
+} DxfHatchStoreEdge;
+
+
+/*!
+ * \brief Definition of a boundary path edge spline in a
+ * \c DxfHatchStore.
+ */
+typedef struct
+dxf_hatch_store_spline
+{
+        int id_code;
+                /*!< Group code = 5. */
+        int degree;
+                /*!< Group code = 94. */
+        int rational;
+                /*!< Group code = 73. */
+        int periodic;
+                /*!< Group code = 74. */
+        int first_knot;
+                /*!< Index of the first knot value of the spline. */
+        int number_of_knots;
+                /*!< Number of knot values of the spline.\n
+                 * Group code = 95. */
+        int first_control_point;
+                /*!< Index of the first control point of the spline. */
+        int number_of_control_points;
+                /*!< Number of control points of the spline.\n
+                 * Group code = 96. */
+} DxfHatchStoreSpline;
+
+
+/*!
+ * \brief Definition of a boundary path edge spline control point in a
+ * \c DxfHatchStore.
+ */
+typedef struct
+dxf_hatch_store_control_point
+{
+        int id_code;
+                /*!< Group code = 5. */
+        double x0;
+                /*!< Group code = 10. */
+        double y0;
+                /*!< Group code = 20. */
+        double weight;
+                /*!< Group code = 42. */
+} DxfHatchStoreControlPoint;
+
+
+/*!
+ * \brief Definition of a pattern definition line in a
+ * \c DxfHatchStore.
+ */
+typedef struct
+dxf_hatch_store_def_line
+{
+        int id_code;
+                /*!< Group code = 5. */
+        double angle;
+                /*!< Group code = 53. */
+        double x0;
+                /*!< Group code = 43. */
+        double y0;
+                /*!< Group code = 44. */
+        double x1;
+                /*!< Group code = 45. */
+        double y1;
+                /*!< Group code = 46. */
+        int first_dash;
+                /*!< Index of the first dash length of the pattern
+                 * definition line. */
+        int number_of_dashes;
+                /*!< Number of dash lengths of the pattern definition
+                 * line.\n
+                 * Group code = 79. */
+} DxfHatchStoreDefLine;
+
+
+/*!
+ * \brief Definition of a seed point in a \c DxfHatchStore.
+ */
+typedef struct
+dxf_hatch_store_seed_point
+{
+        int id_code;
+                /*!< Group code = 5. */
+        double x0;
+                /*!< Group code = 10. */
+        double y0;
+                /*!< Group code = 20. */
+} DxfHatchStoreSeedPoint;
+
+
+/*!
+ * \brief Definition of a libDXF contiguous hatch store.
+ *
+ * Holds the boundary paths, edges, polyline vertices, spline knots and
+ * control points, pattern definition lines, dashes and seed points of
+ * a \c HATCH entity in one contiguous array per type of row, in stead
+ * of one linked list node (and one allocation) per item.\n
+ * Rows refer to their children by index (\c first_ and
+ * \c number_of_ members), all rows of a parent are adjacent.\n
+ * The arrays are grown by doubling and are kept when a store is
+ * reused for the next \c HATCH entity.\n
+ * The linked list members of a \c DxfHatch are a view which can be
+ * (re)created from the store with \c dxf_hatch_store_unpack().
+ */
+typedef struct
+dxf_hatch_store
+{
+        DxfHatchStorePath *paths;
+                /*!< Array of boundary paths. */
+        int number_of_paths;
+                /*!< Number of boundary paths. */
+        int paths_size;
+                /*!< Number of boundary paths allocated. */
+        DxfHatchStorePolyline *polylines;
+                /*!< Array of boundary path polylines. */
+        int number_of_polylines;
+                /*!< Number of boundary path polylines. */
+        int polylines_size;
+                /*!< Number of boundary path polylines allocated. */
+        DxfHatchStoreVertex *vertices;
+                /*!< Array of boundary path polyline vertices. */
+        int number_of_vertices;
+                /*!< Number of boundary path polyline vertices. */
+        int vertices_size;
+                /*!< Number of boundary path polyline vertices
+                 * allocated. */
+        DxfHatchStoreEdge *edges;
+                /*!< Array of boundary path edges. */
+        int number_of_edges;
+                /*!< Number of boundary path edges. */
+        int edges_size;
+                /*!< Number of boundary path edges allocated. */
+        DxfHatchStoreSpline *splines;
+                /*!< Array of boundary path edge splines. */
+        int number_of_splines;
+                /*!< Number of boundary path edge splines. */
+        int splines_size;
+                /*!< Number of boundary path edge splines allocated. */
+        DxfHatchStoreControlPoint *control_points;
+                /*!< Array of spline control points. */
+        int number_of_control_points;
+                /*!< Number of spline control points. */
+        int control_points_size;
+                /*!< Number of spline control points allocated. */
+        double *knots;
+                /*!< Array of spline knot values. */
+        int number_of_knots;
+                /*!< Number of spline knot values. */
+        int knots_size;
+                /*!< Number of spline knot values allocated. */
+        DxfHatchStoreDefLine *def_lines;
+                /*!< Array of pattern definition lines. */
+        int number_of_def_lines;
+                /*!< Number of pattern definition lines. */
+        int def_lines_size;
+                /*!< Number of pattern definition lines allocated. */
+        double *dashes;
+                /*!< Array of pattern definition line dash lengths. */
+        int number_of_dashes;
+                /*!< Number of pattern definition line dash lengths. */
+        int dashes_size;
+                /*!< Number of pattern definition line dash lengths
+                 * allocated. */
+        DxfHatchStoreSeedPoint *seed_points;
+                /*!< Array of seed points. */
+        int number_of_seed_points;
+                /*!< Number of seed points. */
+        int seed_points_size;
+                /*!< Number of seed points allocated. */
+} DxfHatchStore;
+
+
+DxfHatchStore *
+dxf_hatch_store_new ();
+DxfHatchStore *
+dxf_hatch_store_init
+(
+        DxfHatchStore *store
+);
+int
+dxf_hatch_store_free
+(
+        DxfHatchStore *store
+);
+int
+dxf_hatch_store_clear
+(
+        DxfHatchStore *store
+);
+int
+dxf_hatch_store_append_path
+(
+        DxfHatchStore *store,
+        int id_code
+);
+int
+dxf_hatch_store_append_polyline
+(
+        DxfHatchStore *store,
+        int id_code,
+        int is_closed
+);
+int
+dxf_hatch_store_append_vertex
+(
+        DxfHatchStore *store,
+        DxfHatchStoreVertex *vertex
+);
+int
+dxf_hatch_store_append_edge
+(
+        DxfHatchStore *store,
+        DxfHatchStoreEdge *edge
+);
+int
+dxf_hatch_store_append_spline
+(
+        DxfHatchStore *store,
+        int id_code,
+        int degree,
+        int rational,
+        int periodic
+);
+int
+dxf_hatch_store_append_knot
+(
+        DxfHatchStore *store,
+        double knot
+);
+int
+dxf_hatch_store_append_control_point
+(
+        DxfHatchStore *store,
+        DxfHatchStoreControlPoint *control_point
+);
+int
+dxf_hatch_store_append_def_line
+(
+        DxfHatchStore *store,
+        DxfHatchStoreDefLine *def_line
+);
+int
+dxf_hatch_store_append_dash
+(
+        DxfHatchStore *store,
+        double length
+);
+int
+dxf_hatch_store_append_seed_point
+(
+        DxfHatchStore *store,
+        DxfHatchStoreSeedPoint *seed_point
+);
+DxfHatchStorePath *
+dxf_hatch_store_get_path
+(
+        DxfHatchStore *store,
+        int index
+);
+DxfHatchStoreEdge *
+dxf_hatch_store_get_edge
+(
+        DxfHatchStore *store,
+        DxfHatchStorePath *path,
+        int index
+);
+DxfHatchStorePolyline *
+dxf_hatch_store_get_polyline
+(
+        DxfHatchStore *store,
+        DxfHatchStorePath *path,
+        int index
+);
+DxfHatchStoreVertex *
+dxf_hatch_store_get_vertex
+(
+        DxfHatchStore *store,
+        DxfHatchStorePolyline *polyline,
+        int index
+);
+DxfHatchStoreSpline *
+dxf_hatch_store_get_spline
+(
+        DxfHatchStore *store,
+        DxfHatchStoreEdge *edge
+);
+double *
+dxf_hatch_store_get_knots
+(
+        DxfHatchStore *store,
+        DxfHatchStoreSpline *spline
+);
+DxfHatchStoreControlPoint *
+dxf_hatch_store_get_control_points
+(
+        DxfHatchStore *store,
+        DxfHatchStoreSpline *spline
+);
+double *
+dxf_hatch_store_get_dashes
+(
+        DxfHatchStore *store,
+        DxfHatchStoreDefLine *def_line
+);
+int
+dxf_hatch_store_pack
+(
+        DxfHatchStore *store,
+        DxfHatch *hatch
+);
+int
+dxf_hatch_store_unpack
+(
+        DxfHatchStore *store,
+        DxfHatch *hatch
+);
+
+
+#endif /* LIBDXF_SRC_HATCH_STORE_H */
+
+
+/* EOF */
@@ -1784,14 +1784,14 @@ dxf_header_read_parser
                                               TRUE,
                                               2,
                                               &header->PLimMin.x0,
-                                              header->PLimMin.y0);
+                                              &header->PLimMin.y0);
         dxf_return(ret);
     
         ret = dxf_header_read_parse_n_double (fp, temp_string, "$PLIMMAX",
                                               TRUE,
                                               2,
                                               &header->PLimMax.x0,
-                                              header->PLimMax.y0);
+                                              &header->PLimMax.y0);
         dxf_return(ret);
         /*
         fprintf (fp, "  9\n$UNITMODE\n 70\n%i\n", header->UnitMode);
@@ -1906,12 +1906,18 @@ dxf_header_read
     
         /*! \todo FIXME: stores the autocad version as int */
         header->_AcadVer = acad_version_number;
+        /* The entity readers depend on the version of the file. */
+        fp->acad_version_number = acad_version_number;
     
         /* a loop to read all the header with no particulary order */
         while (!feof (fp->fp))
         {
-                /* reads the next header content */
-                dxf_read_scanf (fp, "%i\n%s\n", &n, temp_string);
+                /* reads the next header content, stop when no group
+                 * code and value could be read (no progress). */
+                if (dxf_read_scanf (fp, "%i\n%s\n", &n, temp_string) != 2)
+                {
+                        break;
+                }
                 /* if it is a valid line */
                 if (n == 9)
                 {
@@ -1930,6 +1936,7 @@ dxf_header_read
                           (_("[File: %s: line: %d] read_header :: Section Ended.\n")),
                           __FILE__, __LINE__);
 #endif
+                        break;
                 }        
         }
 #if DEBUG
@@ -1939,6 +1946,75 @@ dxf_header_read
 }
 
 
+/*!
+ * \brief Copy a DXF \c HEADER and all it's string data fields.
+ *
+ * The members of the embedded \c DxfPoint structs are copied by value
+ * (their strings are shared, they are not freed by
+ * \c dxf_header_free()).
+ *
+ * \return a pointer to the copy, or \c NULL when an error occurred.
+ */
+DxfHeader *
+dxf_header_copy
+(
+        DxfHeader *header
+                /*!< Pointer to the DXF \c HEADER to copy. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHeader *copy = NULL;
+
+        /* Do some basic checks. */
+        if (header == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_header_new ();
+        if (copy == NULL)
+        {
+                return (NULL);
+        }
+        memcpy (copy, header, sizeof (DxfHeader));
+        copy->AcadVer = (header->AcadVer == NULL) ? NULL : strdup (header->AcadVer);
+        copy->DWGCodePage = (header->DWGCodePage == NULL) ? NULL : strdup (header->DWGCodePage);
+        copy->TextStyle = (header->TextStyle == NULL) ? NULL : strdup (header->TextStyle);
+        copy->CLayer = (header->CLayer == NULL) ? NULL : strdup (header->CLayer);
+        copy->CELType = (header->CELType == NULL) ? NULL : strdup (header->CELType);
+        copy->DimBLK = (header->DimBLK == NULL) ? NULL : strdup (header->DimBLK);
+        copy->DimPOST = (header->DimPOST == NULL) ? NULL : strdup (header->DimPOST);
+        copy->DimAPOST = (header->DimAPOST == NULL) ? NULL : strdup (header->DimAPOST);
+        copy->DimBLK1 = (header->DimBLK1 == NULL) ? NULL : strdup (header->DimBLK1);
+        copy->DimBLK2 = (header->DimBLK2 == NULL) ? NULL : strdup (header->DimBLK2);
+        copy->DimSTYLE = (header->DimSTYLE == NULL) ? NULL : strdup (header->DimSTYLE);
+        copy->DimTXSTY = (header->DimTXSTY == NULL) ? NULL : strdup (header->DimTXSTY);
+        copy->DimLDRBLK = (header->DimLDRBLK == NULL) ? NULL : strdup (header->DimLDRBLK);
+        copy->Menu = (header->Menu == NULL) ? NULL : strdup (header->Menu);
+        copy->HandSeed = (header->HandSeed == NULL) ? NULL : strdup (header->HandSeed);
+        copy->UCSBase = (header->UCSBase == NULL) ? NULL : strdup (header->UCSBase);
+        copy->UCSName = (header->UCSName == NULL) ? NULL : strdup (header->UCSName);
+        copy->UCSOrthoRef = (header->UCSOrthoRef == NULL) ? NULL : strdup (header->UCSOrthoRef);
+        copy->PUCSBase = (header->PUCSBase == NULL) ? NULL : strdup (header->PUCSBase);
+        copy->PUCSName = (header->PUCSName == NULL) ? NULL : strdup (header->PUCSName);
+        copy->PUCSOrthoRef = (header->PUCSOrthoRef == NULL) ? NULL : strdup (header->PUCSOrthoRef);
+        copy->CMLStyle = (header->CMLStyle == NULL) ? NULL : strdup (header->CMLStyle);
+        copy->HyperLinkBase = (header->HyperLinkBase == NULL) ? NULL : strdup (header->HyperLinkBase);
+        copy->StyleSheet = (header->StyleSheet == NULL) ? NULL : strdup (header->StyleSheet);
+        copy->FingerPrintGUID = (header->FingerPrintGUID == NULL) ? NULL : strdup (header->FingerPrintGUID);
+        copy->VersionGUID = (header->VersionGUID == NULL) ? NULL : strdup (header->VersionGUID);
+        copy->ProjectName = (header->ProjectName == NULL) ? NULL : strdup (header->ProjectName);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
 /*!
  * \brief Free the allocated memory for a DXF \c HEADER and all it's
  * data fields.
@@ -2004,6 +2080,8 @@ dxf_header_free
 //        dxf_point_free ((struct DxfPoint) header->PUCSOrg);
 //        dxf_point_free ((struct DxfPoint) header->PUCSXDir);
 //        dxf_point_free ((struct DxfPoint) header->PUCSYDir);
+        free (header->PUCSBase);
+        free (header->PUCSName);
         free (header->PUCSOrthoRef);
 //        dxf_point_free ((struct DxfPoint) header->PUCSOrgTop);
 //        dxf_point_free ((struct DxfPoint) header->PUCSOrgBottom);
@@ -381,6 +381,11 @@ dxf_header_write_metric_new
         DxfFile *fp
 );
 DxfHeader *
+dxf_header_copy
+(
+        DxfHeader *header
+);
+DxfHeader *
 dxf_header_free
 (
         DxfHeader *header
@@ -35,6 +35,8 @@
 
 
 #include "helix.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -110,9 +112,15 @@ dxf_helix_init
         helix->id_code = 0;
         helix->linetype = strdup (DXF_DEFAULT_LINETYPE);
         helix->layer = strdup (DXF_DEFAULT_LAYER);
-        helix->p0 = dxf_point_init (helix->p0);
-        helix->p1 = dxf_point_init (helix->p1);
-        helix->p2 = dxf_point_init (helix->p2);
+        helix->p0.x = 0.0;
+        helix->p0.y = 0.0;
+        helix->p0.z = 0.0;
+        helix->p1.x = 0.0;
+        helix->p1.y = 0.0;
+        helix->p1.z = 0.0;
+        helix->p2.x = 0.0;
+        helix->p2.y = 0.0;
+        helix->p2.z = 0.0;
         helix->thickness = 0.0;
         helix->radius = 0.0;
         helix->number_of_turns = 0.0;
@@ -180,7 +188,7 @@ dxf_helix_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (helix == NULL)
@@ -193,9 +201,10 @@ dxf_helix_read
         }
         i = 0;
         binary_graphics_data = (DxfBinaryGraphicsData *) helix->binary_graphics_data;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -204,7 +213,7 @@ dxf_helix_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -219,76 +228,76 @@ dxf_helix_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", helix->linetype);
+                        helix->linetype = dxf_read_string (fp, helix->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", helix->layer);
+                        helix->layer = dxf_read_string (fp, helix->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
                         /* Now follows a string containing the
                          * X-coordinate of the axis base point. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p0->x0);
+                        fscanf (fp->fp, "%lf\n", &helix->p0.x);
                 }
                 else if (strcmp (temp_string, "20") == 0)
                 {
                         /* Now follows a string containing the
                          * Y-coordinate of the axis base point. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p0->y0);
+                        fscanf (fp->fp, "%lf\n", &helix->p0.y);
                 }
                 else if (strcmp (temp_string, "30") == 0)
                 {
                         /* Now follows a string containing the
                          * Z-coordinate of the axis base point. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p0->z0);
+                        fscanf (fp->fp, "%lf\n", &helix->p0.z);
                 }
                 else if (strcmp (temp_string, "11") == 0)
                 {
                         /* Now follows a string containing the
                          * X-coordinate of the start point. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p1->x0);
+                        fscanf (fp->fp, "%lf\n", &helix->p1.x);
                 }
                 else if (strcmp (temp_string, "21") == 0)
                 {
                         /* Now follows a string containing the
                          * Y-coordinate of the start point. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p1->y0);
+                        fscanf (fp->fp, "%lf\n", &helix->p1.y);
                 }
                 else if (strcmp (temp_string, "31") == 0)
                 {
                         /* Now follows a string containing the
                          * Z-coordinate of the start point. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p1->z0);
+                        fscanf (fp->fp, "%lf\n", &helix->p1.z);
                 }
                 else if (strcmp (temp_string, "12") == 0)
                 {
                         /* Now follows a string containing the
                          * X-coordinate of the axis vector point. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p2->x0);
+                        fscanf (fp->fp, "%lf\n", &helix->p2.x);
                 }
                 else if (strcmp (temp_string, "22") == 0)
                 {
                         /* Now follows a string containing the
                          * Y-coordinate of the axis vector point. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p2->y0);
+                        fscanf (fp->fp, "%lf\n", &helix->p2.y);
                 }
                 else if (strcmp (temp_string, "32") == 0)
                 {
                         /* Now follows a string containing the
                          * Z-coordinate of the axis vector point. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &helix->p2->z0);
+                        fscanf (fp->fp, "%lf\n", &helix->p2.z);
                 }
                 else if (strcmp (temp_string, "39") == 0)
                 {
@@ -418,7 +427,7 @@ dxf_helix_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", binary_graphics_data->data_line);
+                        binary_graphics_data->data_line = dxf_read_string (fp, binary_graphics_data->data_line);
                         dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) binary_graphics_data->next);
                         binary_graphics_data = (DxfBinaryGraphicsData *) binary_graphics_data->next;
                 }
@@ -427,21 +436,21 @@ dxf_helix_read
                         /* Now follows a string containing a
                          * soft-pointer ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", helix->dictionary_owner_soft);
+                        helix->dictionary_owner_soft = dxf_read_string (fp, helix->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", helix->material);
+                        helix->material = dxf_read_string (fp, helix->material);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", helix->dictionary_owner_hard);
+                        helix->dictionary_owner_hard = dxf_read_string (fp, helix->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -455,7 +464,7 @@ dxf_helix_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", helix->plot_style_name);
+                        helix->plot_style_name = dxf_read_string (fp, helix->plot_style_name);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -468,7 +477,7 @@ dxf_helix_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", helix->color_name);
+                        helix->color_name = dxf_read_string (fp, helix->color_name);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -489,7 +498,13 @@ dxf_helix_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (helix->linetype, "") == 0)
@@ -501,7 +516,7 @@ dxf_helix_read
                 helix->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -529,6 +544,11 @@ dxf_helix_write
 #endif
         char *dxf_entity_name = strdup ("HELIX");
         int i;
+        DxfBinaryGraphicsData *binary_graphics_data = NULL;
+        int flag;
+        int degree;
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -566,7 +586,8 @@ dxf_helix_write
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        if (strcmp (helix->linetype, "") == 0)
+        linetype = helix->linetype;
+        if (strcmp (linetype, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -574,9 +595,10 @@ dxf_helix_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                helix->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = DXF_DEFAULT_LINETYPE;
         }
-        if (strcmp (helix->layer, "") == 0)
+        layer = helix->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
@@ -584,7 +606,7 @@ dxf_helix_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
-                helix->layer = DXF_DEFAULT_LAYER;
+                layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -598,10 +620,10 @@ dxf_helix_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", helix->layer);
-        if (strcmp (helix->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (strcmp (linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", helix->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if (strcmp (helix->material, "") != 0)
         {
@@ -621,10 +643,11 @@ dxf_helix_write
                 fprintf (fp->fp, " 60\n%d\n", helix->visibility);
         }
         fprintf (fp->fp, " 92\n%d\n", helix->graphics_data_size);
-        while (helix->binary_graphics_data != NULL)
+        binary_graphics_data = (DxfBinaryGraphicsData *) helix->binary_graphics_data;
+        while (binary_graphics_data != NULL)
         {
-                fprintf (fp->fp, "310\n%s\n", helix->binary_graphics_data->data_line);
-                helix->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (helix->binary_graphics_data);
+                fprintf (fp->fp, "310\n%s\n", binary_graphics_data->data_line);
+                binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (binary_graphics_data);
         }
         fprintf (fp->fp, "370\n%d\n", helix->lineweight);
         fprintf (fp->fp, "420\n%ld\n", helix->color_value);
@@ -633,22 +656,22 @@ dxf_helix_write
         fprintf (fp->fp, "390\n%s\n", helix->plot_style_name);
         fprintf (fp->fp, "284\n%d\n", helix->shadow_mode);
         /* Write a spline to a DxfFile. */
-        helix->spline->flag = 0;
-        helix->spline->degree = 3;
+        flag = 0;
+        degree = 3;
         fprintf (fp->fp, "100\nAcDbSpline\n");
-        fprintf (fp->fp, " 70\n%d\n", helix->spline->flag);
-        fprintf (fp->fp, " 71\n%d\n", helix->spline->degree);
+        fprintf (fp->fp, " 70\n%d\n", flag);
+        fprintf (fp->fp, " 71\n%d\n", degree);
         fprintf (fp->fp, " 72\n%d\n", helix->spline->number_of_knots);
         fprintf (fp->fp, " 73\n%d\n", helix->spline->number_of_control_points);
         fprintf (fp->fp, " 74\n%d\n", helix->spline->number_of_fit_points);
         fprintf (fp->fp, " 42\n%f\n", helix->spline->knot_tolerance);
         fprintf (fp->fp, " 43\n%f\n", helix->spline->control_point_tolerance);
-        fprintf (fp->fp, " 12\n%f\n", helix->spline->p2->x0);
-        fprintf (fp->fp, " 22\n%f\n", helix->spline->p2->y0);
-        fprintf (fp->fp, " 32\n%f\n", helix->spline->p2->z0);
-        fprintf (fp->fp, " 13\n%f\n", helix->spline->p3->x0);
-        fprintf (fp->fp, " 23\n%f\n", helix->spline->p3->y0);
-        fprintf (fp->fp, " 33\n%f\n", helix->spline->p3->z0);
+        fprintf (fp->fp, " 12\n%f\n", helix->spline->p2.x);
+        fprintf (fp->fp, " 22\n%f\n", helix->spline->p2.y);
+        fprintf (fp->fp, " 32\n%f\n", helix->spline->p2.z);
+        fprintf (fp->fp, " 13\n%f\n", helix->spline->p3.x);
+        fprintf (fp->fp, " 23\n%f\n", helix->spline->p3.y);
+        fprintf (fp->fp, " 33\n%f\n", helix->spline->p3.z);
         for (i = 0; i < helix->spline->number_of_knots; i++)
         {
                 fprintf (fp->fp, " 40\n%f\n", helix->spline->knot_value[i]);
@@ -660,33 +683,31 @@ dxf_helix_write
                         fprintf (fp->fp, " 41\n%f\n", helix->spline->weight_value[i]);
                 }
         }
-        while (helix->spline->p0 != NULL)
+        for (i = 0; (helix->spline->p0 != NULL) && (i < helix->spline->number_of_control_points); i++)
         {
-                fprintf (fp->fp, " 10\n%f\n", helix->spline->p0->x0);
-                fprintf (fp->fp, " 20\n%f\n", helix->spline->p0->y0);
-                fprintf (fp->fp, " 30\n%f\n", helix->spline->p0->z0);
-                helix->spline->p0 = (DxfPoint *) helix->spline->p0->next;
+                fprintf (fp->fp, " 10\n%f\n", helix->spline->p0[i].x);
+                fprintf (fp->fp, " 20\n%f\n", helix->spline->p0[i].y);
+                fprintf (fp->fp, " 30\n%f\n", helix->spline->p0[i].z);
         }
-        while (helix->spline->p1 != NULL)
+        for (i = 0; (helix->spline->p1 != NULL) && (i < helix->spline->number_of_fit_points); i++)
         {
-                fprintf (fp->fp, " 11\n%f\n", helix->spline->p1->x0);
-                fprintf (fp->fp, " 21\n%f\n", helix->spline->p1->y0);
-                fprintf (fp->fp, " 31\n%f\n", helix->spline->p1->z0);
-                helix->spline->p1 = (DxfPoint *) helix->spline->p1->next;
+                fprintf (fp->fp, " 11\n%f\n", helix->spline->p1[i].x);
+                fprintf (fp->fp, " 21\n%f\n", helix->spline->p1[i].y);
+                fprintf (fp->fp, " 31\n%f\n", helix->spline->p1[i].z);
         }
         /* Continue writing helix entity parameters. */
         fprintf (fp->fp, "100\nAcDbHelix\n");
         fprintf (fp->fp, " 90\n%ld\n", helix->major_release_number);
         fprintf (fp->fp, " 91\n%ld\n", helix->maintainance_release_number);
-        fprintf (fp->fp, " 10\n%f\n", helix->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", helix->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", helix->p0->z0);
-        fprintf (fp->fp, " 11\n%f\n", helix->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", helix->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", helix->p1->z0);
-        fprintf (fp->fp, " 12\n%f\n", helix->p2->x0);
-        fprintf (fp->fp, " 22\n%f\n", helix->p2->y0);
-        fprintf (fp->fp, " 32\n%f\n", helix->p2->z0);
+        fprintf (fp->fp, " 10\n%f\n", helix->p0.x);
+        fprintf (fp->fp, " 20\n%f\n", helix->p0.y);
+        fprintf (fp->fp, " 30\n%f\n", helix->p0.z);
+        fprintf (fp->fp, " 11\n%f\n", helix->p1.x);
+        fprintf (fp->fp, " 21\n%f\n", helix->p1.y);
+        fprintf (fp->fp, " 31\n%f\n", helix->p1.z);
+        fprintf (fp->fp, " 12\n%f\n", helix->p2.x);
+        fprintf (fp->fp, " 22\n%f\n", helix->p2.y);
+        fprintf (fp->fp, " 32\n%f\n", helix->p2.z);
         fprintf (fp->fp, " 40\n%f\n", helix->radius);
         fprintf (fp->fp, " 41\n%f\n", helix->number_of_turns);
         fprintf (fp->fp, " 42\n%f\n", helix->turn_height);
@@ -734,8 +755,6 @@ dxf_helix_free
         free (helix->dictionary_owner_soft);
         free (helix->plot_style_name);
         free (helix->color_name);
-        dxf_point_free (helix->p0);
-        dxf_point_free (helix->p1);
         free (helix);
         helix = NULL;
 #if DEBUG
@@ -2311,7 +2330,7 @@ dxf_helix_set_transparency
  * \return axis base point \c p0 when sucessful, or \c NULL when an
  * error occurred.
  */
-DxfPoint *
+DxfVec3 *
 dxf_helix_get_p0
 (
         DxfHelix *helix
@@ -2329,17 +2348,10 @@ dxf_helix_get_p0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (helix->p0 ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the p0 member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfPoint *) helix->p0);
+        return ((DxfVec3 *) &helix->p0);
 }
 
 
@@ -2354,7 +2366,7 @@ dxf_helix_set_p0
 (
         DxfHelix *helix,
                 /*!< a pointer to a DXF \c HELIX entity. */
-        DxfPoint *p0
+        DxfVec3 *p0
                 /*!< an axis base point \c p0 for the * entity. */
 )
 {
@@ -2376,7 +2388,7 @@ dxf_helix_set_p0
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->p0 = (DxfPoint *) p0;
+        helix->p0 = *p0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2411,7 +2423,7 @@ dxf_helix_get_x0
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->p0->x0);
+        return (helix->p0.x);
 }
 
 
@@ -2442,7 +2454,7 @@ dxf_helix_set_x0
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->p0->x0 = x0;
+        helix->p0.x = x0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2477,7 +2489,7 @@ dxf_helix_get_y0
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->p0->y0);
+        return (helix->p0.y);
 }
 
 
@@ -2508,7 +2520,7 @@ dxf_helix_set_y0
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->p0->y0 = y0;
+        helix->p0.y = y0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2543,7 +2555,7 @@ dxf_helix_get_z0
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->p0->z0);
+        return (helix->p0.z);
 }
 
 
@@ -2574,7 +2586,7 @@ dxf_helix_set_z0
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->p0->z0 = z0;
+        helix->p0.z = z0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2588,7 +2600,7 @@ dxf_helix_set_z0
  * \return start point \c p1 when sucessful, or \c NULL when an error
  * occurred.
  */
-DxfPoint *
+DxfVec3 *
 dxf_helix_get_p1
 (
         DxfHelix *helix
@@ -2606,17 +2618,10 @@ dxf_helix_get_p1
                   __FUNCTION__);
                 return (NULL);
         }
-        if (helix->p1 ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found in the p1 member.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfPoint *) helix->p1);
+        return ((DxfVec3 *) &helix->p1);
 }
 
 
@@ -2631,7 +2636,7 @@ dxf_helix_set_p1
 (
         DxfHelix *helix,
                 /*!< a pointer to a DXF \c HELIX entity. */
-        DxfPoint *p1
+        DxfVec3 *p1
                 /*!< a start point \c p1 for the * entity. */
 )
 {
@@ -2653,7 +2658,7 @@ dxf_helix_set_p1
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->p1 = (DxfPoint *) p1;
+        helix->p1 = *p1;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2688,7 +2693,7 @@ dxf_helix_get_x1
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->p1->x0);
+        return (helix->p1.x);
 }
 
 
@@ -2719,7 +2724,7 @@ dxf_helix_set_x1
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->p1->x0 = x1;
+        helix->p1.x = x1;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2754,7 +2759,7 @@ dxf_helix_get_y1
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->p1->y0);
+        return (helix->p1.y);
 }
 
 
@@ -2784,7 +2789,7 @@ dxf_helix_set_y1
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->p1->y0 = y1;
+        helix->p1.y = y1;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2819,7 +2824,7 @@ dxf_helix_get_z1
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->p1->z0);
+        return (helix->p1.z);
 }
 
 
@@ -2850,7 +2855,7 @@ dxf_helix_set_z1
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->p1->z0 = z1;
+        helix->p1.z = z1;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2885,7 +2890,7 @@ dxf_helix_get_x2
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->p2->x0);
+        return (helix->p2.x);
 }
 
 
@@ -2916,7 +2921,7 @@ dxf_helix_set_x2
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->p2->x0 = x2;
+        helix->p2.x = x2;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2951,7 +2956,7 @@ dxf_helix_get_y2
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->p2->y0);
+        return (helix->p2.y);
 }
 
 
@@ -2982,7 +2987,7 @@ dxf_helix_set_y2
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->p2->y0 = y2;
+        helix->p2.y = y2;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3017,7 +3022,7 @@ dxf_helix_get_z2
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (helix->p2->z0);
+        return (helix->p2.z);
 }
 
 
@@ -3048,7 +3053,7 @@ dxf_helix_set_z2
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->p2->z0 = z2;
+        helix->p2.z = z2;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -40,6 +40,7 @@
 #include "spline.h"
 #include "binary_graphics_data.h"
 #include "point.h"
+#include "vec.h"
 
 
 /*!
@@ -155,13 +156,13 @@ dxf_helix_struct
                  * class-level transparency data.\n
                  * Group code = 440. */
         /* Specific members for a DXF helix. */
-        DxfPoint *p0;
+        DxfVec3 p0;
                 /*!< Axis base point.\n
                  * Group codes = 10, 20 and 30.*/
-        DxfPoint *p1;
+        DxfVec3 p1;
                 /*!< Start point.\n
                  * Group codes = 11, 21 and 31. */
-        DxfPoint *p2;
+        DxfVec3 p2;
                 /*!< Axis vector point.\n
                  * Group codes = 12, 22 and 32. */
         double radius;
@@ -444,7 +445,7 @@ dxf_helix_set_transparency
         DxfHelix *helix,
         long transparency
 );
-DxfPoint *
+DxfVec3 *
 dxf_helix_get_p0
 (
         DxfHelix *helix
@@ -453,7 +454,7 @@ DxfHelix *
 dxf_helix_set_p0
 (
         DxfHelix *helix,
-        DxfPoint *p0
+        DxfVec3 *p0
 );
 double
 dxf_helix_get_x0
@@ -488,7 +489,7 @@ dxf_helix_set_z0
         DxfHelix *helix,
         double z0
 );
-DxfPoint *
+DxfVec3 *
 dxf_helix_get_p1
 (
         DxfHelix *helix
@@ -497,7 +498,7 @@ DxfHelix *
 dxf_helix_set_p1
 (
         DxfHelix *helix,
-        DxfPoint *p1
+        DxfVec3 *p1
 );
 double
 dxf_helix_get_x1
@@ -41,6 +41,8 @@
 
 
 #include "idbuffer.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -156,7 +158,7 @@ dxf_idbuffer_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -175,9 +177,10 @@ dxf_idbuffer_read
         }
         i = 0;
         entity_pointer = (DxfIdbufferEntityPointer *) dxf_idbuffer_entity_pointer_init (entity_pointer);
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -185,7 +188,7 @@ dxf_idbuffer_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -216,7 +219,7 @@ dxf_idbuffer_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", idbuffer->dictionary_owner_soft);
+                        idbuffer->dictionary_owner_soft = dxf_read_string (fp, idbuffer->dictionary_owner_soft);
                         i++;
                 }
                 else if ((strcmp (temp_string, "330") == 0)
@@ -225,7 +228,7 @@ dxf_idbuffer_read
                         /* Now follows a string containing a Soft
                          * pointer reference to entity. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", entity_pointer->soft_pointer);
+                        entity_pointer->soft_pointer = dxf_read_string (fp, entity_pointer->soft_pointer);
                         dxf_idbuffer_entity_pointer_init ((DxfIdbufferEntityPointer *) entity_pointer->next);
                         entity_pointer = (DxfIdbufferEntityPointer *) entity_pointer->next;
                 }
@@ -234,7 +237,7 @@ dxf_idbuffer_read
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", idbuffer->dictionary_owner_hard);
+                        idbuffer->dictionary_owner_hard = dxf_read_string (fp, idbuffer->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -248,10 +251,22 @@ dxf_idbuffer_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
+        }
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (idbuffer->id_code > 0))
+        {
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) idbuffer->id_code, IDBUFFER, idbuffer);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -340,7 +355,7 @@ dxf_idbuffer_write
                 fprintf (fp->fp, "100\nAcDbIdBuffer\n");
         }
         entity_pointer = (DxfIdbufferEntityPointer *) idbuffer->entity_pointer;
-        while (idbuffer->entity_pointer != NULL)
+        while (entity_pointer != NULL)
         {
                 fprintf (fp->fp, "330\n%s\n", entity_pointer->soft_pointer);
                 entity_pointer = dxf_idbuffer_entity_pointer_get_next (entity_pointer);
@@ -415,6 +430,7 @@ dxf_idbuffer_free_chain
         while (id_buffers != NULL)
         {
                 struct DxfIdbuffer *iter = id_buffers->next;
+                id_buffers->next = NULL;
                 dxf_idbuffer_free (id_buffers);
                 id_buffers = (DxfIdbuffer *) iter;
         }
@@ -891,6 +907,7 @@ dxf_idbuffer_entity_pointer_free_chain
         while (entity_pointers != NULL)
         {
                 struct DxfIdbufferEntityPointer *iter = entity_pointers->next;
+                entity_pointers->next = NULL;
                 dxf_idbuffer_entity_pointer_free (entity_pointers);
                 entity_pointers = (DxfIdbufferEntityPointer *) iter;
         }
@@ -1068,4 +1085,45 @@ dxf_idbuffer_entity_pointer_set_next
 }
 
 
+/*!
+ * \brief Resolve the soft pointer of a DXF \c IDBUFFER entity pointer
+ * into the entity.
+ *
+ * \return a pointer to the entity, or \c NULL when the handle could not
+ * be resolved.
+ */
+void *
+dxf_idbuffer_entity_pointer_resolve_soft_pointer
+(
+        DxfIdbufferEntityPointer *entity_pointer,
+                /*!< a pointer to a DXF \c IDBUFFER entity pointer. */
+        DxfHandleTable *handle_table,
+                /*!< a pointer to the DXF handle table of the drawing. */
+        int *type
+                /*!< the \c DxfEntityType of the entity is stored here
+                 * (may be \c NULL). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        void *result = NULL;
+
+        /* Do some basic checks. */
+        if ((entity_pointer == NULL) || (handle_table == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        result = dxf_handle_table_resolve_string (handle_table,
+          entity_pointer->soft_pointer, type);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
 /* EOF*/
@@ -45,6 +45,7 @@
 
 
 #include "global.h"
+#include "handle_table.h"
 
 
 /*!
@@ -205,6 +206,13 @@ dxf_idbuffer_entity_pointer_set_next
         DxfIdbufferEntityPointer *entity_pointer,
         DxfIdbufferEntityPointer *next
 );
+void *
+dxf_idbuffer_entity_pointer_resolve_soft_pointer
+(
+        DxfIdbufferEntityPointer *entity_pointer,
+        DxfHandleTable *handle_table,
+        int *type
+);
 
 
 #endif /* LIBDXF_SRC_IDBUFFER_H */
@@ -37,6 +37,8 @@
 
 
 #include "image.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -196,7 +198,7 @@ dxf_image_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (image == NULL)
@@ -209,9 +211,10 @@ dxf_image_read
         }
         i = 0;
         j = 0;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -220,7 +223,7 @@ dxf_image_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -235,13 +238,13 @@ dxf_image_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", image->linetype);
+                        image->linetype = dxf_read_string (fp, image->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", image->layer);
+                        image->layer = dxf_read_string (fp, image->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -456,21 +459,21 @@ dxf_image_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", image->dictionary_owner_soft);
+                        image->dictionary_owner_soft = dxf_read_string (fp, image->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "340") == 0)
                 {
                         /* Now follows a string containing a hard
                          * reference to imagedef object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", image->imagedef_object);
+                        image->imagedef_object = dxf_read_string (fp, image->imagedef_object);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing a hard
                          * reference to imagedef_reactor object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", image->imagedef_reactor_object);
+                        image->imagedef_reactor_object = dxf_read_string (fp, image->imagedef_reactor_object);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -484,7 +487,13 @@ dxf_image_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (image->linetype, "") == 0)
@@ -495,8 +504,14 @@ dxf_image_read
         {
                 image->layer = strdup (DXF_DEFAULT_LAYER);
         }
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (image->id_code > 0))
+        {
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) image->id_code, IMAGE, image);
+        }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -526,6 +541,8 @@ dxf_image_write
 #endif
         char *dxf_entity_name = strdup ("IMAGE");
         int i;
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -552,7 +569,8 @@ dxf_image_write
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        if (strcmp (image->linetype, "") == 0)
+        linetype = image->linetype;
+        if (strcmp (linetype, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -560,9 +578,10 @@ dxf_image_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                image->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = DXF_DEFAULT_LINETYPE;
         }
-        if (strcmp (image->layer, "") == 0)
+        layer = image->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
@@ -570,7 +589,7 @@ dxf_image_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
-                image->layer = DXF_DEFAULT_LAYER;
+                layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -610,10 +629,10 @@ dxf_image_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", image->layer);
-        if (strcmp (image->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (strcmp (linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", image->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
@@ -3281,4 +3300,80 @@ dxf_image_set_next
 }
 
 
+/*!
+ * \brief Resolve the \c imagedef_object handle of a DXF \c IMAGE
+ * entity into the DXF \c IMAGEDEF object.
+ *
+ * \return a pointer to the \c IMAGEDEF object, or \c NULL when the
+ * handle could not be resolved.
+ */
+DxfImagedef *
+dxf_image_resolve_imagedef_object
+(
+        DxfImage *image,
+                /*!< a pointer to a DXF \c IMAGE entity. */
+        DxfHandleTable *handle_table
+                /*!< a pointer to the DXF handle table of the drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfImagedef *result = NULL;
+
+        /* Do some basic checks. */
+        if ((image == NULL) || (handle_table == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        result = (DxfImagedef *) dxf_handle_table_resolve_typed (handle_table,
+          image->imagedef_object, IMAGEDEF);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Resolve the \c imagedef_reactor_object handle of a DXF
+ * \c IMAGE entity into the DXF \c IMAGEDEF_REACTOR object.
+ *
+ * \return a pointer to the \c IMAGEDEF_REACTOR object, or \c NULL when
+ * the handle could not be resolved.
+ */
+DxfImagedefReactor *
+dxf_image_resolve_imagedef_reactor_object
+(
+        DxfImage *image,
+                /*!< a pointer to a DXF \c IMAGE entity. */
+        DxfHandleTable *handle_table
+                /*!< a pointer to the DXF handle table of the drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfImagedefReactor *result = NULL;
+
+        /* Do some basic checks. */
+        if ((image == NULL) || (handle_table == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        result = (DxfImagedefReactor *) dxf_handle_table_resolve_typed (handle_table,
+          image->imagedef_reactor_object, IMAGEDEF_REACTOR);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
 /* EOF */
@@ -41,7 +41,10 @@
 
 
 #include "global.h"
+#include "handle_table.h"
 #include "binary_graphics_data.h"
+#include "imagedef.h"
+#include "imagedef_reactor.h"
 
 
 /*!
@@ -647,6 +650,18 @@ dxf_image_set_next
         DxfImage *image,
         DxfImage *next
 );
+DxfImagedef *
+dxf_image_resolve_imagedef_object
+(
+        DxfImage *image,
+        DxfHandleTable *handle_table
+);
+DxfImagedefReactor *
+dxf_image_resolve_imagedef_reactor_object
+(
+        DxfImage *image,
+        DxfHandleTable *handle_table
+);
 
 
 #endif /* LIBDXF_SRC_IMAGE_H */
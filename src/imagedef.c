@@ -35,6 +35,8 @@
 
 
 #include "imagedef.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -181,7 +183,7 @@ dxf_imagedef_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -199,9 +201,10 @@ dxf_imagedef_read
                 imagedef = dxf_imagedef_init (imagedef);
         }
         i = 0;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -209,7 +212,7 @@ dxf_imagedef_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -217,9 +220,9 @@ dxf_imagedef_read
                 {
                         /* Now follows a string containing a file name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", imagedef->file_name);
+                        imagedef->file_name = dxf_read_string (fp, imagedef->file_name);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -297,7 +300,7 @@ dxf_imagedef_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", imagedef->dictionary_owner_soft);
+                        imagedef->dictionary_owner_soft = dxf_read_string (fp, imagedef->dictionary_owner_soft);
                         i++;
                 }
                 else if ((strcmp (temp_string, "330") == 0)
@@ -306,7 +309,7 @@ dxf_imagedef_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", imagedef->acad_image_dict_soft);
+                        imagedef->acad_image_dict_soft = dxf_read_string (fp, imagedef->acad_image_dict_soft);
                         i++;
                         /*! \todo Check for overrun of array index. */
                 }
@@ -324,7 +327,7 @@ dxf_imagedef_read
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", imagedef->dictionary_owner_hard);
+                        imagedef->dictionary_owner_hard = dxf_read_string (fp, imagedef->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -338,10 +341,22 @@ dxf_imagedef_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
+        }
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (imagedef->id_code > 0))
+        {
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) imagedef->id_code, IMAGEDEF, imagedef);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
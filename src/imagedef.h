@@ -39,6 +39,7 @@
 
 
 #include "global.h"
+#include "handle_table.h"
 
 
 /*!
@@ -35,6 +35,8 @@
 
 
 #include "imagedef_reactor.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -169,7 +171,7 @@ dxf_imagedef_reactor_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -187,9 +189,10 @@ dxf_imagedef_reactor_read
                 imagedef_reactor = dxf_imagedef_reactor_init (imagedef_reactor);
         }
         i = 0;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -197,7 +200,7 @@ dxf_imagedef_reactor_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -235,7 +238,7 @@ dxf_imagedef_reactor_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", imagedef_reactor->dictionary_owner_soft);
+                        imagedef_reactor->dictionary_owner_soft = dxf_read_string (fp, imagedef_reactor->dictionary_owner_soft);
                         i++;
                 }
                 else if ((strcmp (temp_string, "330") == 0)
@@ -244,7 +247,7 @@ dxf_imagedef_reactor_read
                         /* Now follows a string containing object ID for
                          * associated image object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", imagedef_reactor->associated_image_object);
+                        imagedef_reactor->associated_image_object = dxf_read_string (fp, imagedef_reactor->associated_image_object);
                         i++;
                 }
                 else if (strcmp (temp_string, "360") == 0)
@@ -252,7 +255,7 @@ dxf_imagedef_reactor_read
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", imagedef_reactor->dictionary_owner_hard);
+                        imagedef_reactor->dictionary_owner_hard = dxf_read_string (fp, imagedef_reactor->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -266,10 +269,22 @@ dxf_imagedef_reactor_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
+        }
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (imagedef_reactor->id_code > 0))
+        {
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) imagedef_reactor->id_code, IMAGEDEF_REACTOR, imagedef_reactor);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -303,6 +318,7 @@ dxf_imagedef_reactor_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("IMAGEDEF_REACTOR");
+        int class_version;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -329,9 +345,10 @@ dxf_imagedef_reactor_write
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, imagedef_reactor->id_code);
         }
+        class_version = imagedef_reactor->class_version;
         if (fp->acad_version_number == AutoCAD_14)
         {
-                imagedef_reactor->class_version = 2;
+                class_version = 2;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -367,7 +384,7 @@ dxf_imagedef_reactor_write
         {
                 fprintf (fp->fp, "100\nAcDbRasterImageDefReactor\n");
         }
-        fprintf (fp->fp, " 90\n%d\n", imagedef_reactor->class_version);
+        fprintf (fp->fp, " 90\n%d\n", class_version);
         fprintf (fp->fp, "330\n%s\n", imagedef_reactor->associated_image_object);
         /* Clean up. */
         free (dxf_entity_name);
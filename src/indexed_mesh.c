@@ -0,0 +1,621 @@
+/*!
+ * \file indexed_mesh.c
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Functions for libDXF indexed meshes.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "indexed_mesh.h"
+
+
+/*!
+ * \brief Allocate memory for a libDXF indexed mesh.
+ *
+ * Fill the memory contents with zeros.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfIndexedMesh *
+dxf_indexed_mesh_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfIndexedMesh *mesh = NULL;
+        size_t size;
+
+        size = sizeof (DxfIndexedMesh);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((mesh = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfIndexedMesh struct.\n")),
+                  __FUNCTION__);
+                mesh = NULL;
+        }
+        else
+        {
+                memset (mesh, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (mesh);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a libDXF indexed
+ * mesh.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfIndexedMesh *
+dxf_indexed_mesh_init
+(
+        DxfIndexedMesh *mesh,
+                /*!< a pointer to a libDXF indexed mesh. */
+        int flag,
+                /*!< the polyline flag of the mesh. */
+        int polygon_mesh_M_vertex_count,
+                /*!< the M vertex count of a polygon mesh, or 0. */
+        int polygon_mesh_N_vertex_count
+                /*!< the N vertex count of a polygon mesh, or 0. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                mesh = dxf_indexed_mesh_new ();
+        }
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfIndexedMesh struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        mesh->flag = flag;
+        mesh->polygon_mesh_M_vertex_count = polygon_mesh_M_vertex_count;
+        mesh->polygon_mesh_N_vertex_count = polygon_mesh_N_vertex_count;
+        mesh->vertices = NULL;
+        mesh->number_of_vertices = 0;
+        mesh->vertices_size = 0;
+        mesh->indices = NULL;
+        mesh->number_of_triangles = 0;
+        mesh->triangles_size = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (mesh);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a libDXF indexed mesh and all
+ * it's data fields.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_indexed_mesh_free
+(
+        DxfIndexedMesh *mesh
+                /*!< a pointer to the memory occupied by the libDXF
+                 * indexed mesh. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (mesh->vertices);
+        free (mesh->indices);
+        free (mesh);
+        mesh = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a vertex to a libDXF indexed mesh.
+ *
+ * \return the (zero based) index of the vertex, or -1 when an error
+ * occurred.
+ */
+int
+dxf_indexed_mesh_append_vertex
+(
+        DxfIndexedMesh *mesh,
+                /*!< a pointer to a libDXF indexed mesh. */
+        double x0,
+                /*!< X-value of the vertex. */
+        double y0,
+                /*!< Y-value of the vertex. */
+        double z0
+                /*!< Z-value of the vertex. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double *vertices = NULL;
+        double *vertex = NULL;
+        int size;
+
+        /* Do some basic checks. */
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (mesh->number_of_vertices >= mesh->vertices_size)
+        {
+                size = (mesh->vertices_size == 0)
+                  ? DXF_INDEXED_MESH_INITIAL_NUMBER_OF_VERTICES
+                  : 2 * mesh->vertices_size;
+                vertices = realloc (mesh->vertices, (size_t) size * 3 * sizeof (double));
+                if (vertices == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for the vertices.\n")),
+                          __FUNCTION__);
+                        return (-1);
+                }
+                mesh->vertices = vertices;
+                mesh->vertices_size = size;
+        }
+        vertex = &mesh->vertices[3 * mesh->number_of_vertices];
+        vertex[0] = x0;
+        vertex[1] = y0;
+        vertex[2] = z0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (mesh->number_of_vertices++);
+}
+
+
+/*!
+ * \brief Append a triangle to a libDXF indexed mesh.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_indexed_mesh_append_triangle
+(
+        DxfIndexedMesh *mesh,
+                /*!< a pointer to a libDXF indexed mesh. */
+        uint32_t index_1,
+                /*!< zero based index of the first vertex. */
+        uint32_t index_2,
+                /*!< zero based index of the second vertex. */
+        uint32_t index_3
+                /*!< zero based index of the third vertex. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        uint32_t *indices = NULL;
+        uint32_t *triangle = NULL;
+        int size;
+
+        /* Do some basic checks. */
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (mesh->number_of_triangles >= mesh->triangles_size)
+        {
+                size = (mesh->triangles_size == 0)
+                  ? DXF_INDEXED_MESH_INITIAL_NUMBER_OF_VERTICES
+                  : 2 * mesh->triangles_size;
+                indices = realloc (mesh->indices, (size_t) size * 3 * sizeof (uint32_t));
+                if (indices == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for the indices.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                mesh->indices = indices;
+                mesh->triangles_size = size;
+        }
+        triangle = &mesh->indices[3 * mesh->number_of_triangles];
+        triangle[0] = index_1;
+        triangle[1] = index_2;
+        triangle[2] = index_3;
+        mesh->number_of_triangles++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a polyface mesh face record to a libDXF indexed mesh.
+ *
+ * The vertex indices are one based indices into the vertices of the
+ * polyface mesh, a negative index marks an invisible edge and a fourth
+ * index of 0 marks a triangular face.\n
+ * A quadrilateral face is split into two triangles.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred (the face refers to a vertex that was not read, or has less
+ * than three vertices).
+ */
+int
+dxf_indexed_mesh_append_face
+(
+        DxfIndexedMesh *mesh,
+                /*!< a pointer to a libDXF indexed mesh. */
+        int polyface_mesh_vertex_index_1,
+                /*!< first polyface mesh vertex index (group code 71). */
+        int polyface_mesh_vertex_index_2,
+                /*!< second polyface mesh vertex index (group code 72). */
+        int polyface_mesh_vertex_index_3,
+                /*!< third polyface mesh vertex index (group code 73). */
+        int polyface_mesh_vertex_index_4
+                /*!< fourth polyface mesh vertex index (group code 74),
+                 * or 0. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int index[4];
+        int i;
+
+        /* Do some basic checks. */
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        index[0] = abs (polyface_mesh_vertex_index_1);
+        index[1] = abs (polyface_mesh_vertex_index_2);
+        index[2] = abs (polyface_mesh_vertex_index_3);
+        index[3] = abs (polyface_mesh_vertex_index_4);
+        for (i = 0; i < 4; i++)
+        {
+                if (index[i] > mesh->number_of_vertices)
+                {
+                        fprintf (stderr,
+                          (_("Warning in %s () a face refers to vertex %d of %d vertices.\n")),
+                          __FUNCTION__, index[i], mesh->number_of_vertices);
+                        return (EXIT_FAILURE);
+                }
+        }
+        if ((index[0] == 0) || (index[1] == 0) || (index[2] == 0))
+        {
+                return (EXIT_FAILURE);
+        }
+        if (dxf_indexed_mesh_append_triangle (mesh, (uint32_t) index[0] - 1,
+          (uint32_t) index[1] - 1, (uint32_t) index[2] - 1) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((index[3] != 0)
+          && (dxf_indexed_mesh_append_triangle (mesh, (uint32_t) index[0] - 1,
+          (uint32_t) index[2] - 1, (uint32_t) index[3] - 1) == EXIT_FAILURE))
+        {
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a DXF \c VERTEX entity of a mesh \c POLYLINE to a libDXF
+ * indexed mesh.
+ *
+ * Polyface mesh face records (vertex flag 128 without 64) are appended
+ * as triangles, all other vertices as mesh vertices.\n
+ * The \c VERTEX entity is not referenced by the mesh and can be freed
+ * right away, so that a mesh is built in a single pass while reading.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_indexed_mesh_add_vertex
+(
+        DxfIndexedMesh *mesh,
+                /*!< a pointer to a libDXF indexed mesh. */
+        DxfVertex *vertex
+                /*!< a pointer to a DXF \c VERTEX entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((mesh == NULL) || (vertex == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((vertex->flag & DXF_VERTEX_FLAG_POLYFACE_MESH)
+          && !(vertex->flag & DXF_VERTEX_FLAG_POLYGON_MESH))
+        {
+                return (dxf_indexed_mesh_append_face (mesh,
+                  vertex->polyface_mesh_vertex_index_1,
+                  vertex->polyface_mesh_vertex_index_2,
+                  vertex->polyface_mesh_vertex_index_3,
+                  vertex->polyface_mesh_vertex_index_4));
+        }
+        if (dxf_indexed_mesh_append_vertex (mesh, vertex->x0, vertex->y0,
+          vertex->z0) == -1)
+        {
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Finish a libDXF indexed mesh after the last vertex was added.
+ *
+ * For a M x N polygon mesh the quadrilaterals between the vertices (N
+ * vertices per row, M rows) are split into triangles, including the
+ * closing rows and columns of a mesh closed in the M and/or N
+ * direction.\n
+ * A polyface mesh has its triangles already.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_indexed_mesh_finish
+(
+        DxfIndexedMesh *mesh
+                /*!< a pointer to a libDXF indexed mesh. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int m;
+        int n;
+        int rows;
+        int columns;
+        int i;
+        int j;
+        uint32_t a;
+        uint32_t b;
+        uint32_t c;
+        uint32_t d;
+
+        /* Do some basic checks. */
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (!(mesh->flag & DXF_POLYLINE_FLAG_POLYGON_MESH))
+        {
+                return (EXIT_SUCCESS);
+        }
+        m = mesh->polygon_mesh_M_vertex_count;
+        n = mesh->polygon_mesh_N_vertex_count;
+        if ((m < 2) || (n < 2) || (m * n != mesh->number_of_vertices))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () %d vertices do not match a %d x %d polygon mesh.\n")),
+                  __FUNCTION__, mesh->number_of_vertices, m, n);
+                return (EXIT_FAILURE);
+        }
+        rows = (mesh->flag & DXF_POLYLINE_FLAG_CLOSED_M) ? m : m - 1;
+        columns = (mesh->flag & DXF_POLYLINE_FLAG_CLOSED_N) ? n : n - 1;
+        for (i = 0; i < rows; i++)
+        {
+                for (j = 0; j < columns; j++)
+                {
+                        a = (uint32_t) ((i * n) + j);
+                        b = (uint32_t) ((i * n) + ((j + 1) % n));
+                        c = (uint32_t) ((((i + 1) % m) * n) + ((j + 1) % n));
+                        d = (uint32_t) ((((i + 1) % m) * n) + j);
+                        if ((dxf_indexed_mesh_append_triangle (mesh, a, b, c) == EXIT_FAILURE)
+                          || (dxf_indexed_mesh_append_triangle (mesh, a, c, d) == EXIT_FAILURE))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of vertices from a libDXF indexed mesh.
+ *
+ * \return the number of vertices, or -1 when an error occurred.
+ */
+int
+dxf_indexed_mesh_get_number_of_vertices
+(
+        DxfIndexedMesh *mesh
+                /*!< a pointer to a libDXF indexed mesh. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (mesh->number_of_vertices);
+}
+
+
+/*!
+ * \brief Get the vertex coordinates from a libDXF indexed mesh.
+ *
+ * \return a pointer to the X, Y and Z-values of the vertices (3 values
+ * per vertex, owned by the mesh), or \c NULL when an error occurred.
+ */
+double *
+dxf_indexed_mesh_get_vertices
+(
+        DxfIndexedMesh *mesh
+                /*!< a pointer to a libDXF indexed mesh. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (mesh->vertices);
+}
+
+
+/*!
+ * \brief Get the number of triangles from a libDXF indexed mesh.
+ *
+ * \return the number of triangles, or -1 when an error occurred.
+ */
+int
+dxf_indexed_mesh_get_number_of_triangles
+(
+        DxfIndexedMesh *mesh
+                /*!< a pointer to a libDXF indexed mesh. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (mesh->number_of_triangles);
+}
+
+
+/*!
+ * \brief Get the triangle vertex indices from a libDXF indexed mesh.
+ *
+ * \return a pointer to the (zero based) vertex indices (3 indices per
+ * triangle, owned by the mesh), or \c NULL when an error occurred.
+ */
+uint32_t *
+dxf_indexed_mesh_get_indices
+(
+        DxfIndexedMesh *mesh
+                /*!< a pointer to a libDXF indexed mesh. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (mesh->indices);
+}
+
+
+/* EOF */
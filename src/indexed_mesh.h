@@ -0,0 +1,179 @@
+/*!
+ * \file indexed_mesh.h
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Header file for libDXF indexed meshes.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_INDEXED_MESH_H
+#define LIBDXF_SRC_INDEXED_MESH_H
+
+
+#include "global.h"
+#include "vertex.h"
+
+
+#define DXF_INDEXED_MESH_INITIAL_NUMBER_OF_VERTICES 64
+        /*!< \brief The number of vertices allocated for a new
+         * \c DxfIndexedMesh. */
+
+#define DXF_POLYLINE_FLAG_CLOSED_M 1
+        /*!< \brief Polyline flag: closed polyline, or polygon mesh
+         * closed in the M direction. */
+#define DXF_POLYLINE_FLAG_POLYGON_MESH 16
+        /*!< \brief Polyline flag: 3D polygon mesh. */
+#define DXF_POLYLINE_FLAG_CLOSED_N 32
+        /*!< \brief Polyline flag: polygon mesh closed in the N
+         * direction. */
+#define DXF_POLYLINE_FLAG_POLYFACE_MESH 64
+        /*!< \brief Polyline flag: polyface mesh. */
+
+#define DXF_VERTEX_FLAG_POLYGON_MESH 64
+        /*!< \brief Vertex flag: 3D polygon mesh vertex. */
+#define DXF_VERTEX_FLAG_POLYFACE_MESH 128
+        /*!< \brief Vertex flag: polyface mesh vertex (a face record
+         * when the polygon mesh bit is not set). */
+
+
+/*!
+ * \brief Definition of a libDXF indexed triangle mesh.
+ *
+ * A compact representation of a polyface mesh or a M x N polygon mesh
+ * \c POLYLINE: one array with the coordinates of the vertices and one
+ * array with three (zero based) vertex indices per triangle.\n
+ * Quadrilateral faces are split into two triangles.
+ */
+typedef struct
+dxf_indexed_mesh
+{
+        int flag;
+                /*!< Polyline flag of the mesh (bit coded, see
+                 * \c DxfPolyline), either
+                 * \c DXF_POLYLINE_FLAG_POLYFACE_MESH or
+                 * \c DXF_POLYLINE_FLAG_POLYGON_MESH, optionally with
+                 * \c DXF_POLYLINE_FLAG_CLOSED_M and/or
+                 * \c DXF_POLYLINE_FLAG_CLOSED_N. */
+        int polygon_mesh_M_vertex_count;
+                /*!< M vertex count of a polygon mesh. */
+        int polygon_mesh_N_vertex_count;
+                /*!< N vertex count of a polygon mesh. */
+        double *vertices;
+                /*!< X, Y and Z-values of the vertices, 3 values per
+                 * vertex. */
+        int number_of_vertices;
+                /*!< Number of vertices in \c vertices. */
+        int vertices_size;
+                /*!< Number of vertices allocated in \c vertices. */
+        uint32_t *indices;
+                /*!< Vertex indices, 3 indices per triangle. */
+        int number_of_triangles;
+                /*!< Number of triangles in \c indices. */
+        int triangles_size;
+                /*!< Number of triangles allocated in \c indices. */
+} DxfIndexedMesh;
+
+
+DxfIndexedMesh *
+dxf_indexed_mesh_new ();
+DxfIndexedMesh *
+dxf_indexed_mesh_init
+(
+        DxfIndexedMesh *mesh,
+        int flag,
+        int polygon_mesh_M_vertex_count,
+        int polygon_mesh_N_vertex_count
+);
+int
+dxf_indexed_mesh_free
+(
+        DxfIndexedMesh *mesh
+);
+int
+dxf_indexed_mesh_append_vertex
+(
+        DxfIndexedMesh *mesh,
+        double x0,
+        double y0,
+        double z0
+);
+int
+dxf_indexed_mesh_append_triangle
+(
+        DxfIndexedMesh *mesh,
+        uint32_t index_1,
+        uint32_t index_2,
+        uint32_t index_3
+);
+int
+dxf_indexed_mesh_append_face
+(
+        DxfIndexedMesh *mesh,
+        int polyface_mesh_vertex_index_1,
+        int polyface_mesh_vertex_index_2,
+        int polyface_mesh_vertex_index_3,
+        int polyface_mesh_vertex_index_4
+);
+int
+dxf_indexed_mesh_add_vertex
+(
+        DxfIndexedMesh *mesh,
+        DxfVertex *vertex
+);
+int
+dxf_indexed_mesh_finish
+(
+        DxfIndexedMesh *mesh
+);
+int
+dxf_indexed_mesh_get_number_of_vertices
+(
+        DxfIndexedMesh *mesh
+);
+double *
+dxf_indexed_mesh_get_vertices
+(
+        DxfIndexedMesh *mesh
+);
+int
+dxf_indexed_mesh_get_number_of_triangles
+(
+        DxfIndexedMesh *mesh
+);
+uint32_t *
+dxf_indexed_mesh_get_indices
+(
+        DxfIndexedMesh *mesh
+);
+
+
+#endif /* LIBDXF_SRC_INDEXED_MESH_H */
+
+
+/* EOF */
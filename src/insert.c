@@ -37,6 +37,8 @@
 
 
 #include "insert.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -144,6 +146,7 @@ dxf_insert_init
         insert->extr_z0 = 0.0;
         insert->dictionary_owner_soft = strdup ("");
         insert->dictionary_owner_hard = strdup ("");
+        insert->intern = NULL;
         insert->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -190,7 +193,7 @@ dxf_insert_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (insert == NULL)
@@ -201,9 +204,13 @@ dxf_insert_read
                 insert = dxf_insert_new ();
                 insert = dxf_insert_init (insert);
         }
+        /* The symbol names are interned in the intern table of the
+         * file. */
+        insert->intern = fp->intern;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -212,7 +219,7 @@ dxf_insert_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "2") == 0)
@@ -220,7 +227,7 @@ dxf_insert_read
                         /* Now follows a string containing a block name
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", insert->block_name);
+                        insert->block_name = dxf_intern_read_string (fp, insert->block_name);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -234,13 +241,13 @@ dxf_insert_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", insert->linetype);
+                        insert->linetype = dxf_intern_read_string (fp, insert->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", insert->layer);
+                        insert->layer = dxf_intern_read_string (fp, insert->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -416,14 +423,14 @@ dxf_insert_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", insert->dictionary_owner_soft);
+                        insert->dictionary_owner_soft = dxf_read_string (fp, insert->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", insert->dictionary_owner_hard);
+                        insert->dictionary_owner_hard = dxf_read_string (fp, insert->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -437,19 +444,38 @@ dxf_insert_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
-        }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
+        }
+        /* Symbol names not found in the file are still the copies
+         * made by the init function. */
+        insert->linetype = dxf_intern_adopt_string ((DxfIntern *) insert->intern, insert->linetype);
+        insert->layer = dxf_intern_adopt_string ((DxfIntern *) insert->intern, insert->layer);
+        insert->block_name = dxf_intern_adopt_string ((DxfIntern *) insert->intern, insert->block_name);
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (insert->linetype, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) insert->intern, insert->linetype, DXF_INTERN_ID_EMPTY))
+        {
+                dxf_intern_free_string ((DxfIntern *) insert->intern, insert->linetype);
+                insert->linetype = dxf_intern_string ((DxfIntern *) insert->intern, DXF_DEFAULT_LINETYPE);
+        }
+        if (dxf_intern_is_symbol ((DxfIntern *) insert->intern, insert->layer, DXF_INTERN_ID_EMPTY))
         {
-                insert->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_intern_free_string ((DxfIntern *) insert->intern, insert->layer);
+                insert->layer = dxf_intern_string ((DxfIntern *) insert->intern, DXF_DEFAULT_LAYER);
         }
-        if (strcmp (insert->layer, "") == 0)
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (insert->id_code > 0))
         {
-                insert->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) insert->id_code, INSERT, insert);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -482,6 +508,13 @@ dxf_insert_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("INSERT");
+        char *layer = NULL;
+        char *linetype = NULL;
+        double rel_x_scale;
+        double rel_y_scale;
+        double rel_z_scale;
+        int columns;
+        int rows;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -502,7 +535,8 @@ dxf_insert_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (insert->linetype, "") == 0)
+        linetype = insert->linetype;
+        if (dxf_intern_is_symbol ((DxfIntern *) insert->intern, linetype, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -510,9 +544,10 @@ dxf_insert_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                insert->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = dxf_intern_get_symbol ((DxfIntern *) insert->intern, DXF_INTERN_ID_DEFAULT_LINETYPE);
         }
-        if (strcmp (insert->layer, "") == 0)
+        layer = insert->layer;
+        if (dxf_intern_is_symbol ((DxfIntern *) insert->intern, layer, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -520,9 +555,10 @@ dxf_insert_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0.\n")),
                   dxf_entity_name);
-                insert->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = dxf_intern_get_symbol ((DxfIntern *) insert->intern, DXF_INTERN_ID_DEFAULT_LAYER);
         }
-        if (insert->rel_x_scale == 0.0)
+        rel_x_scale = insert->rel_x_scale;
+        if (rel_x_scale == 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
@@ -530,9 +566,10 @@ dxf_insert_write
                 fprintf (stderr,
                   (_("\tdefault relative X-scale of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
-                insert->rel_x_scale = 1.0;
+                rel_x_scale = 1.0;
         }
-        if (insert->rel_y_scale == 0.0)
+        rel_y_scale = insert->rel_y_scale;
+        if (rel_y_scale == 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () relative Y-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
@@ -540,9 +577,10 @@ dxf_insert_write
                 fprintf (stderr,
                   (_("\tdefault relative Y-scale of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
-                insert->rel_y_scale = 1.0;
+                rel_y_scale = 1.0;
         }
-        if (insert->rel_z_scale == 0.0)
+        rel_z_scale = insert->rel_z_scale;
+        if (rel_z_scale == 0.0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () relative Z-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
@@ -550,9 +588,10 @@ dxf_insert_write
                 fprintf (stderr,
                   (_("\tdefault relative Z-scale of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
-                insert->rel_z_scale = 1.0;
+                rel_z_scale = 1.0;
         }
-        if ((insert->columns > 1) && (insert->column_spacing == 0.0))
+        columns = insert->columns;
+        if ((columns > 1) && (insert->column_spacing == 0.0))
         {
                 fprintf (stderr,
                   (_("Warning in %s () number of columns is greater than 1 and the column spacing has a value of 0.0 for the %s entity with id-code: %x\n")),
@@ -560,9 +599,10 @@ dxf_insert_write
                 fprintf (stderr,
                   (_("\tdefault number of columns value of 1 applied to %s entity.\n")),
                   dxf_entity_name);
-                insert->columns = 1;
+                columns = 1;
         }
-        if ((insert->rows > 1) && (insert->row_spacing == 0.0))
+        rows = insert->rows;
+        if ((rows > 1) && (insert->row_spacing == 0.0))
         {
                 fprintf (stderr,
                   (_("Warning in %s () number of rows is greater than 1 and the row spacing has a value of 0.0 for the %s entity with id-code: %x\n")),
@@ -570,7 +610,7 @@ dxf_insert_write
                 fprintf (stderr,
                   (_("\tdefault number of rows value of 1 applied to %s entity.\n")),
                   dxf_entity_name);
-                insert->rows = 1;
+                rows = 1;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -610,10 +650,10 @@ dxf_insert_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", insert->layer);
-        if (strcmp (insert->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (!dxf_intern_is_symbol ((DxfIntern *) insert->intern, linetype, DXF_INTERN_ID_DEFAULT_LINETYPE))
         {
-                fprintf (fp->fp, "  6\n%s\n", insert->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
@@ -654,35 +694,35 @@ dxf_insert_write
         fprintf (fp->fp, " 10\n%f\n", insert->x0);
         fprintf (fp->fp, " 20\n%f\n", insert->y0);
         fprintf (fp->fp, " 30\n%f\n", insert->z0);
-        if (insert->rel_x_scale != 1.0)
+        if (rel_x_scale != 1.0)
         {
-                fprintf (fp->fp, " 41\n%f\n", insert->rel_x_scale);
+                fprintf (fp->fp, " 41\n%f\n", rel_x_scale);
         }
-        if (insert->rel_y_scale != 1.0)
+        if (rel_y_scale != 1.0)
         {
-                fprintf (fp->fp, " 42\n%f\n", insert->rel_y_scale);
+                fprintf (fp->fp, " 42\n%f\n", rel_y_scale);
         }
-        if (insert->rel_z_scale != 1.0)
+        if (rel_z_scale != 1.0)
         {
-                fprintf (fp->fp, " 43\n%f\n", insert->rel_z_scale);
+                fprintf (fp->fp, " 43\n%f\n", rel_z_scale);
         }
         if (insert->rot_angle != 0.0)
         {
                 fprintf (fp->fp, " 50\n%f\n", insert->rot_angle);
         }
-        if (insert->columns > 1)
+        if (columns > 1)
         {
-                fprintf (fp->fp, " 70\n%d\n", insert->columns);
+                fprintf (fp->fp, " 70\n%d\n", columns);
         }
-        if (insert->rows > 1)
+        if (rows > 1)
         {
-                fprintf (fp->fp, " 71\n%d\n", insert->rows);
+                fprintf (fp->fp, " 71\n%d\n", rows);
         }
-        if ((insert->columns > 1) && (insert->column_spacing > 0.0))
+        if ((columns > 1) && (insert->column_spacing > 0.0))
         {
                 fprintf (fp->fp, " 44\n%f\n", insert->column_spacing);
         }
-        if ((insert->rows > 1) && (insert->row_spacing > 0.0))
+        if ((rows > 1) && (insert->row_spacing > 0.0))
         {
                 fprintf (fp->fp, " 45\n%f\n", insert->row_spacing);
         }
@@ -732,9 +772,9 @@ dxf_insert_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (insert->linetype);
-        free (insert->layer);
-        free (insert->block_name);
+        dxf_intern_free_string ((DxfIntern *) insert->intern, insert->linetype);
+        dxf_intern_free_string ((DxfIntern *) insert->intern, insert->layer);
+        dxf_intern_free_string ((DxfIntern *) insert->intern, insert->block_name);
         free (insert->dictionary_owner_soft);
         free (insert->dictionary_owner_hard);
         free (insert);
@@ -0,0 +1,765 @@
+/*!
+ * \file intern.c
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Functions for a libDXF string intern table (symbol names).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "intern.h"
+
+
+/*!
+ * \brief The symbol names interned by \c dxf_intern_init(), indexed by
+ * their \c DXF_INTERN_ID_* id.
+ */
+static const char *dxf_intern_symbols[DXF_INTERN_NUMBER_OF_SYMBOLS] =
+{
+        "",
+        DXF_DEFAULT_LAYER,
+        DXF_DEFAULT_LINETYPE,
+        DXF_DEFAULT_TEXTSTYLE
+};
+
+
+/*!
+ * \brief Calculate a hash value for a string (FNV-1a).
+ *
+ * \return the hash value.
+ */
+static uint32_t
+dxf_intern_hash
+(
+        const char *string
+                /*!< a string. */
+)
+{
+        uint32_t hash = 2166136261u;
+
+        while (*string != '\0')
+        {
+                hash ^= (unsigned char) *string++;
+                hash *= 16777619u;
+        }
+        return (hash);
+}
+
+
+/*!
+ * \brief Find the slot for a string in a DXF intern table.
+ *
+ * \return the index of the slot containing \c string, or the index of
+ * the empty slot where \c string is to be inserted.
+ */
+static int
+dxf_intern_find_slot
+(
+        DxfIntern *intern,
+                /*!< a pointer to a DXF intern table. */
+        const char *string,
+                /*!< a string. */
+        uint32_t hash
+                /*!< the hash value of \c string. */
+)
+{
+        int mask;
+        int i;
+        int32_t id;
+
+        mask = intern->number_of_slots - 1;
+        i = (int) (hash & (uint32_t) mask);
+        while ((id = intern->slots[i]) != -1)
+        {
+                if ((intern->hashes[id] == hash)
+                  && (strcmp (intern->strings[id], string) == 0))
+                {
+                        break;
+                }
+                i = (i + 1) & mask;
+        }
+        return (i);
+}
+
+
+/*!
+ * \brief Double the number of hash slots in a DXF intern table.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_intern_grow_slots
+(
+        DxfIntern *intern
+                /*!< a pointer to a DXF intern table. */
+)
+{
+        int32_t *slots = NULL;
+        int number_of_slots;
+        int mask;
+        int i;
+        int j;
+
+        number_of_slots = 2 * intern->number_of_slots;
+        if ((slots = malloc (number_of_slots * sizeof (int32_t))) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for hash slots.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (slots, 0xff, number_of_slots * sizeof (int32_t));
+        mask = number_of_slots - 1;
+        for (i = 0; i < intern->number_of_strings; i++)
+        {
+                j = (int) (intern->hashes[i] & (uint32_t) mask);
+                while (slots[j] != -1)
+                {
+                        j = (j + 1) & mask;
+                }
+                slots[j] = i;
+        }
+        free (intern->slots);
+        intern->slots = slots;
+        intern->number_of_slots = number_of_slots;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a DXF intern table.
+ *
+ * Fill the memory contents with zeros.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfIntern *
+dxf_intern_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfIntern *intern = NULL;
+        size_t size;
+
+        size = sizeof (DxfIntern);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((intern = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfIntern struct.\n")),
+                  __FUNCTION__);
+                intern = NULL;
+        }
+        else
+        {
+                memset (intern, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (intern);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a DXF intern
+ * table.
+ *
+ * The empty string and the default layer, linetype and text style
+ * names are interned first, with the \c DXF_INTERN_ID_* ids.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfIntern *
+dxf_intern_init
+(
+        DxfIntern *intern
+                /*!< a pointer to a DXF intern table. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (intern == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                intern = dxf_intern_new ();
+        }
+        if (intern == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfIntern struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        intern->number_of_slots = DXF_INTERN_INITIAL_NUMBER_OF_SLOTS;
+        intern->slots = malloc (intern->number_of_slots * sizeof (int32_t));
+        if (intern->slots == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for hash slots.\n")),
+                  __FUNCTION__);
+                free (intern);
+                return (NULL);
+        }
+        memset (intern->slots, 0xff, intern->number_of_slots * sizeof (int32_t));
+        intern->strings = NULL;
+        intern->hashes = NULL;
+        intern->number_of_strings = 0;
+        intern->strings_size = 0;
+        intern->string_bytes = 0;
+        for (i = 0; i < DXF_INTERN_NUMBER_OF_SYMBOLS; i++)
+        {
+                if (dxf_intern_string (intern, dxf_intern_symbols[i]) == NULL)
+                {
+                        dxf_intern_free (intern);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (intern);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a DXF intern table and all
+ * interned strings.
+ *
+ * \warning Entities still refering to interned strings of this table
+ * are left with dangling pointers.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_intern_free
+(
+        DxfIntern *intern
+                /*!< a pointer to the memory occupied by the DXF intern
+                 * table. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (intern == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < intern->number_of_strings; i++)
+        {
+                free (intern->strings[i]);
+        }
+        free (intern->strings);
+        free (intern->hashes);
+        free (intern->slots);
+        free (intern);
+        intern = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Intern a string in a DXF intern table.
+ *
+ * If \c intern is \c NULL a private copy of \c string is returned, so
+ * readers behave as before when no intern table is attached to the
+ * DXF file.
+ *
+ * \return a pointer to the shared copy of \c string owned by the intern
+ * table, or \c NULL when an error occurred.
+ */
+char *
+dxf_intern_string
+(
+        DxfIntern *intern,
+                /*!< a pointer to a DXF intern table. */
+        const char *string
+                /*!< the string to intern. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        uint32_t hash;
+        int slot;
+        int id;
+
+        /* Do some basic checks. */
+        if (string == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (intern == NULL)
+        {
+                return (strdup (string));
+        }
+        hash = dxf_intern_hash (string);
+        slot = dxf_intern_find_slot (intern, string, hash);
+        if (intern->slots[slot] != -1)
+        {
+                return (intern->strings[intern->slots[slot]]);
+        }
+        /* Keep the load factor below one half. */
+        if (2 * (intern->number_of_strings + 1) > intern->number_of_slots)
+        {
+                if (dxf_intern_grow_slots (intern) == EXIT_FAILURE)
+                {
+                        return (NULL);
+                }
+                slot = dxf_intern_find_slot (intern, string, hash);
+        }
+        if (intern->number_of_strings == intern->strings_size)
+        {
+                char **strings = NULL;
+                uint32_t *hashes = NULL;
+                int strings_size;
+
+                strings_size = (intern->strings_size == 0) ? 64 : 2 * intern->strings_size;
+                strings = realloc (intern->strings, strings_size * sizeof (char *));
+                if (strings == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for interned strings.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                intern->strings = strings;
+                hashes = realloc (intern->hashes, strings_size * sizeof (uint32_t));
+                if (hashes == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for interned strings.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                intern->hashes = hashes;
+                intern->strings_size = strings_size;
+        }
+        id = intern->number_of_strings;
+        intern->strings[id] = strdup (string);
+        if (intern->strings[id] == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for an interned string.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        intern->hashes[id] = hash;
+        intern->slots[slot] = id;
+        intern->number_of_strings++;
+        intern->string_bytes += strlen (string) + 1;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (intern->strings[id]);
+}
+
+
+/*!
+ * \brief Get the id of an interned string from a DXF intern table.
+ *
+ * The string is not interned when it is not yet present in the table.
+ *
+ * \return the id of \c string, or -1 when \c string is not interned or
+ * an error occurred.
+ */
+int
+dxf_intern_get_id
+(
+        DxfIntern *intern,
+                /*!< a pointer to a DXF intern table. */
+        const char *string
+                /*!< the string to look up. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result;
+
+        /* Do some basic checks. */
+        if ((intern == NULL) || (string == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        result = intern->slots[dxf_intern_find_slot (intern, string, dxf_intern_hash (string))];
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Get an interned string by id from a DXF intern table.
+ *
+ * \return a pointer to the interned string (not a copy), or \c NULL
+ * when an error occurred.
+ */
+char *
+dxf_intern_get_string
+(
+        DxfIntern *intern,
+                /*!< a pointer to a DXF intern table. */
+        int id
+                /*!< the id of an interned string. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (intern == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((id < 0) || (id >= intern->number_of_strings))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range id was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (intern->strings[id]);
+}
+
+
+/*!
+ * \brief Get the number of interned strings from a DXF intern table.
+ *
+ * \return the number of interned strings, or -1 when an error occurred.
+ */
+int
+dxf_intern_get_number_of_strings
+(
+        DxfIntern *intern
+                /*!< a pointer to a DXF intern table. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (intern == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (intern->number_of_strings);
+}
+
+
+/*!
+ * \brief Test if a string is owned by a DXF intern table.
+ *
+ * Only the pointer is compared, an equal string which is a private
+ * copy is not owned by the table.
+ *
+ * \return \c TRUE when \c string is owned by \c intern, \c FALSE
+ * otherwise (also when \c intern is \c NULL).
+ */
+int
+dxf_intern_is_interned
+(
+        DxfIntern *intern,
+                /*!< a pointer to a DXF intern table, may be \c NULL. */
+        const char *string
+                /*!< the string to test. */
+)
+{
+        int32_t id;
+
+        if ((intern == NULL) || (string == NULL))
+        {
+                return (FALSE);
+        }
+        id = intern->slots[dxf_intern_find_slot (intern, string, dxf_intern_hash (string))];
+        return ((id != -1) && (intern->strings[id] == string));
+}
+
+
+/*!
+ * \brief Release a symbol name string held by an entity.
+ *
+ * Private copies are freed, strings owned by \c intern (the intern
+ * table recorded in the entity) are left alone, they are freed
+ * together with the table.
+ */
+void
+dxf_intern_free_string
+(
+        DxfIntern *intern,
+                /*!< the intern table owning the symbol names of the
+                 * entity, may be \c NULL. */
+        char *string
+                /*!< the string to release. */
+)
+{
+        if ((string != NULL) && (!dxf_intern_is_interned (intern, string)))
+        {
+                free (string);
+        }
+}
+
+
+/*!
+ * \brief Compare two symbol names.
+ *
+ * Two strings interned in the same table are equal if, and only if,
+ * the pointers are equal, so the string compare is only done for
+ * strings which are not interned (or interned in different tables).
+ *
+ * \return \c TRUE when both strings are equal, \c FALSE otherwise.
+ */
+int
+dxf_intern_equal
+(
+        const char *string1,
+                /*!< a string. */
+        const char *string2
+                /*!< a string. */
+)
+{
+        if (string1 == string2)
+        {
+                return (TRUE);
+        }
+        if ((string1 == NULL) || (string2 == NULL))
+        {
+                return (FALSE);
+        }
+        return (strcmp (string1, string2) == 0);
+}
+
+
+/*!
+ * \brief Replace a private copy of a symbol name held by an entity with
+ * the interned string.
+ *
+ * Readers call this for the symbol names which were not found in the
+ * file, these are still the copies made by the init function of the
+ * entity.
+ *
+ * \return the interned string (the private copy is freed), or
+ * \c string when \c intern is \c NULL or an error occurred.
+ */
+char *
+dxf_intern_adopt_string
+(
+        DxfIntern *intern,
+                /*!< the intern table of the entity, may be \c NULL. */
+        char *string
+                /*!< the symbol name held by the entity. */
+)
+{
+        char *result = NULL;
+
+        if ((intern == NULL) || (string == NULL))
+        {
+                return (string);
+        }
+        result = dxf_intern_string (intern, string);
+        if (result == NULL)
+        {
+                return (string);
+        }
+        if (result != string)
+        {
+                free (string);
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Test if a symbol name held by an entity is one of the symbol
+ * names interned by \c dxf_intern_init().
+ *
+ * With an intern table this is a pointer compare, as the symbol names
+ * of an entity recording a table are interned in it, without a table
+ * the strings are compared.
+ *
+ * \return \c TRUE when \c string is the symbol name with \c id,
+ * \c FALSE otherwise.
+ */
+int
+dxf_intern_is_symbol
+(
+        DxfIntern *intern,
+                /*!< the intern table of the entity, may be \c NULL. */
+        const char *string,
+                /*!< the symbol name held by the entity. */
+        int id
+                /*!< a \c DXF_INTERN_ID_* id. */
+)
+{
+        if ((string == NULL) || (id < 0) || (id >= DXF_INTERN_NUMBER_OF_SYMBOLS))
+        {
+                return (FALSE);
+        }
+        if (intern != NULL)
+        {
+                return (string == intern->strings[id]);
+        }
+        return (strcmp (string, dxf_intern_symbols[id]) == 0);
+}
+
+
+/*!
+ * \brief Get one of the symbol names interned by \c dxf_intern_init().
+ *
+ * Does not modify the table, so writers can substitute a default name
+ * without touching the entity.
+ *
+ * \return the symbol name with \c id, interned in \c intern when a
+ * table is passed, or \c NULL when an invalid id was passed.
+ */
+char *
+dxf_intern_get_symbol
+(
+        DxfIntern *intern,
+                /*!< the intern table of the entity, may be \c NULL. */
+        int id
+                /*!< a \c DXF_INTERN_ID_* id. */
+)
+{
+        if ((id < 0) || (id >= DXF_INTERN_NUMBER_OF_SYMBOLS))
+        {
+                return (NULL);
+        }
+        if (intern != NULL)
+        {
+                return (intern->strings[id]);
+        }
+        return ((char *) dxf_intern_symbols[id]);
+}
+
+
+/*!
+ * \brief Read a symbol name (layer, linetype, style or block name)
+ * from a DXF file.
+ *
+ * The line following the group code is read, the previous value in
+ * \c string is released and the new value is interned in the intern
+ * table attached to \c fp (a private copy when no table is attached).
+ *
+ * \return a pointer to the new symbol name, or \c string when an
+ * error occurred.
+ */
+char *
+dxf_intern_read_string
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        char *string
+                /*!< the current value of the symbol name. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        char *result = NULL;
+        size_t length;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (string);
+        }
+        if (fgets (temp_string, DXF_MAX_STRING_LENGTH, fp->fp) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () while reading from: %s in line: %d.\n")),
+                  __FUNCTION__, fp->filename, fp->line_number);
+                return (string);
+        }
+        /* Strip the line end, DXF files from other platforms may
+         * contain a carriage return. */
+        length = strlen (temp_string);
+        while ((length > 0)
+          && ((temp_string[length - 1] == '\n') || (temp_string[length - 1] == '\r')))
+        {
+                temp_string[--length] = '\0';
+        }
+        result = dxf_intern_string ((DxfIntern *) fp->intern, temp_string);
+        if (result == NULL)
+        {
+                return (string);
+        }
+        dxf_intern_free_string ((DxfIntern *) fp->intern, string);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/* EOF */
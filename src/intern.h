@@ -0,0 +1,189 @@
+/*!
+ * \file intern.h
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Header file for a libDXF string intern table (symbol names).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_INTERN_H
+#define LIBDXF_SRC_INTERN_H
+
+
+#include "global.h"
+
+
+#define DXF_INTERN_INITIAL_NUMBER_OF_SLOTS 256
+        /*!< \brief The initial number of hash slots in a \c DxfIntern
+         * table (has to be a power of two). */
+#define DXF_INTERN_ID_EMPTY 0
+        /*!< \brief Id of the empty string in a \c DxfIntern table. */
+#define DXF_INTERN_ID_DEFAULT_LAYER 1
+        /*!< \brief Id of \c DXF_DEFAULT_LAYER in a \c DxfIntern
+         * table. */
+#define DXF_INTERN_ID_DEFAULT_LINETYPE 2
+        /*!< \brief Id of \c DXF_DEFAULT_LINETYPE in a \c DxfIntern
+         * table. */
+#define DXF_INTERN_ID_DEFAULT_TEXTSTYLE 3
+        /*!< \brief Id of \c DXF_DEFAULT_TEXTSTYLE in a \c DxfIntern
+         * table. */
+#define DXF_INTERN_NUMBER_OF_SYMBOLS 4
+        /*!< \brief Number of symbol names interned by
+         * \c dxf_intern_init(). */
+
+
+/*!
+ * \brief Definition of a libDXF string intern table.
+ *
+ * A drawing holds only a few hundred distinct layer, linetype, style
+ * and block names, while every entity refers to one of them.\n
+ * Readers store one shared copy of each of these symbol names in the
+ * intern table of the drawing, so that entities refer to the same
+ * string and a comparison of two interned names is a pointer compare.\n
+ * Every interned string also has a small integer id (the order of
+ * interning), which can be used as a compact key in other tables.\n
+ * Interned strings are owned by the table and are freed by
+ * \c dxf_intern_free().\n
+ * Entities record the table holding their symbol names, entity free
+ * functions release their symbol names with
+ * \c dxf_intern_free_string() and that table.\n
+ * The symbol names of an entity recording a table are always interned
+ * in that table (the readers and setters take care of this), so they
+ * are compared with the symbol names interned by \c dxf_intern_init()
+ * with \c dxf_intern_is_symbol().\n
+ * A table is not locked, it should only be modified by one thread at
+ * a time (e.g. the thread reading the drawing).
+ */
+typedef struct
+dxf_intern_struct
+{
+        char **strings;
+                /*!< Array of interned strings, indexed by id. */
+        uint32_t *hashes;
+                /*!< Array of hash values, indexed by id. */
+        int32_t *slots;
+                /*!< Open addressing hash slots containing an id, or -1
+                 * for an empty slot. */
+        int number_of_strings;
+                /*!< Number of interned strings. */
+        int strings_size;
+                /*!< Number of allocated entries in \c strings and
+                 * \c hashes. */
+        int number_of_slots;
+                /*!< Number of hash slots (a power of two). */
+        size_t string_bytes;
+                /*!< Number of bytes allocated for the interned strings
+                 * (including the terminating \c NUL characters). */
+} DxfIntern;
+
+
+DxfIntern *
+dxf_intern_new ();
+DxfIntern *
+dxf_intern_init
+(
+        DxfIntern *intern
+);
+int
+dxf_intern_free
+(
+        DxfIntern *intern
+);
+char *
+dxf_intern_string
+(
+        DxfIntern *intern,
+        const char *string
+);
+int
+dxf_intern_get_id
+(
+        DxfIntern *intern,
+        const char *string
+);
+char *
+dxf_intern_get_string
+(
+        DxfIntern *intern,
+        int id
+);
+int
+dxf_intern_get_number_of_strings
+(
+        DxfIntern *intern
+);
+int
+dxf_intern_is_interned
+(
+        DxfIntern *intern,
+        const char *string
+);
+void
+dxf_intern_free_string
+(
+        DxfIntern *intern,
+        char *string
+);
+int
+dxf_intern_equal
+(
+        const char *string1,
+        const char *string2
+);
+char *
+dxf_intern_adopt_string
+(
+        DxfIntern *intern,
+        char *string
+);
+int
+dxf_intern_is_symbol
+(
+        DxfIntern *intern,
+        const char *string,
+        int id
+);
+char *
+dxf_intern_get_symbol
+(
+        DxfIntern *intern,
+        int id
+);
+char *
+dxf_intern_read_string
+(
+        DxfFile *fp,
+        char *string
+);
+
+
+#endif /* LIBDXF_SRC_INTERN_H */
+
+
+/* EOF */
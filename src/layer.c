@@ -37,6 +37,8 @@
 
 
 #include "layer.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -160,7 +162,7 @@ dxf_layer_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (layer == NULL)
@@ -171,9 +173,10 @@ dxf_layer_read
                 layer = dxf_layer_new ();
                 layer = dxf_layer_init (layer);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -182,7 +185,7 @@ dxf_layer_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "2") == 0)
@@ -190,14 +193,14 @@ dxf_layer_read
                         /* Now follows a string containing the layer
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", layer->layer_name);
+                        layer->layer_name = dxf_read_string (fp, layer->layer_name);
                 }
                 else if (strcmp (temp_string, "6") == 0)
                 {
                         /* Now follows a string containing the linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", layer->linetype);
+                        layer->linetype = dxf_read_string (fp, layer->linetype);
                 }
                 else if (strcmp (temp_string, "62") == 0)
                 {
@@ -240,20 +243,20 @@ dxf_layer_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", layer->dictionary_owner_soft);
+                        layer->dictionary_owner_soft = dxf_read_string (fp, layer->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing the material. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", layer->material);
+                        layer->material = dxf_read_string (fp, layer->material);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", layer->dictionary_owner_hard);
+                        layer->dictionary_owner_hard = dxf_read_string (fp, layer->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -267,7 +270,7 @@ dxf_layer_read
                         /* Now follows a string containing the plot style
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", layer->plot_style_name);
+                        layer->plot_style_name = dxf_read_string (fp, layer->plot_style_name);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -281,7 +284,13 @@ dxf_layer_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (layer->layer_name, "") == 0)
@@ -298,7 +307,7 @@ dxf_layer_read
                 layer->linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -325,6 +334,7 @@ dxf_layer_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("LAYER");
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -354,7 +364,8 @@ dxf_layer_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (layer->linetype, "") == 0)
+        linetype = layer->linetype;
+        if (strcmp (linetype, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s layer\n")),
@@ -362,7 +373,7 @@ dxf_layer_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                layer->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = DXF_DEFAULT_LINETYPE;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -398,7 +409,7 @@ dxf_layer_write
         fprintf (fp->fp, "  2\n%s\n", layer->layer_name);
         fprintf (fp->fp, " 70\n%d\n", layer->flag);
         fprintf (fp->fp, " 62\n%d\n", layer->color);
-        fprintf (fp->fp, "  6\n%s\n", layer->linetype);
+        fprintf (fp->fp, "  6\n%s\n", linetype);
         if (fp->acad_version_number >= AutoCAD_2000)
         {
                 fprintf (fp->fp, "290\n%d\n", layer->plotting_flag);
@@ -34,7 +34,12 @@
  */
 
 
+#include <limits.h>
+
 #include "layer_index.h"
+#include "idbuffer.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -177,7 +182,7 @@ dxf_layer_index_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -197,9 +202,10 @@ dxf_layer_index_read
         i = 0;
         j = 0;
         k = 0;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -207,7 +213,7 @@ dxf_layer_index_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -218,7 +224,7 @@ dxf_layer_index_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%x\n", &layer_index->id_code);
                 }
-                if (strcmp (temp_string, "8") == 0)
+                else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name
                          * (multiple entries may exist). */
@@ -226,13 +232,13 @@ dxf_layer_index_read
                         fscanf (fp->fp, "%s\n", layer_index->layer_name[i]);
                         i++;
                 }
-                if (strcmp (temp_string, "40") == 0)
+                else if (strcmp (temp_string, "40") == 0)
                 {
                         /* Now follows a string containing a time stamp. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &layer_index->time_stamp);
                 }
-                if (strcmp (temp_string, "90") == 0)
+                else if (strcmp (temp_string, "90") == 0)
                 {
                         /* Now follows a string containing a number of
                          * entries in the LAYER_INDEX list (multiple
@@ -261,7 +267,7 @@ dxf_layer_index_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", layer_index->dictionary_owner_soft);
+                        layer_index->dictionary_owner_soft = dxf_read_string (fp, layer_index->dictionary_owner_soft);
                 }
                 else if ((strcmp (temp_string, "360") == 0)
                   && (k == 0))
@@ -269,7 +275,7 @@ dxf_layer_index_read
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", layer_index->dictionary_owner_hard);
+                        layer_index->dictionary_owner_hard = dxf_read_string (fp, layer_index->dictionary_owner_hard);
                         k++;
                 }
                 else if ((strcmp (temp_string, "360") == 0)
@@ -295,10 +301,16 @@ dxf_layer_index_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -394,13 +406,18 @@ dxf_layer_index_write
         }
         fprintf (fp->fp, " 40\n%lf\n", layer_index->time_stamp);
         i = 0;
-        while (strlen (layer_index->layer_name[i]) > 0)
+        while ((i < DXF_MAX_PARAM)
+          && (layer_index->layer_name[i] != NULL)
+          && (strlen (layer_index->layer_name[i]) > 0))
         {
                 fprintf (fp->fp, "  8\n%s\n", layer_index->layer_name[i]);
-                fprintf (fp->fp, "360\n%s\n", layer_index->hard_owner_reference[i]);
+                if ((layer_index->hard_owner_reference[i] != NULL)
+                  && (strlen (layer_index->hard_owner_reference[i]) > 0))
+                {
+                        fprintf (fp->fp, "360\n%s\n", layer_index->hard_owner_reference[i]);
+                }
                 fprintf (fp->fp, " 90\n%d\n", layer_index->number_of_entries[i]);
                 i++;
-                /*! \todo Check for overrun of array index. */
         }
         /* Clean up. */
         free (dxf_entity_name);
@@ -499,4 +516,797 @@ dxf_layer_index_free_chain
 }
 
 
+/*!
+ * \brief Allocate memory for a layer index map.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfLayerIndexMap *
+dxf_layer_index_map_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLayerIndexMap *map = NULL;
+        size_t size;
+
+        size = sizeof (DxfLayerIndexMap);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((map = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfLayerIndexMap struct.\n")),
+                  __FUNCTION__);
+                map = NULL;
+        }
+        else
+        {
+                memset (map, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (map);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in an empty layer
+ * index map.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfLayerIndexMap *
+dxf_layer_index_map_init
+(
+        DxfLayerIndexMap *map,
+                /*!< a pointer to a layer index map. */
+        DxfIntern *intern
+                /*!< a pointer to the intern table for the layer names,
+                 * usually the one of the drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (intern == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (map == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                map = dxf_layer_index_map_new ();
+        }
+        if (map == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfLayerIndexMap struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        map->intern = (struct DxfIntern *) intern;
+        map->members = NULL;
+        map->members_size = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (map);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a layer index map.
+ *
+ * The entities and the \c LAYER table entries are not freed, the
+ * layer names are released from the intern table.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_layer_index_map_free
+(
+        DxfLayerIndexMap *map
+                /*!< a pointer to the memory occupied by the map. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (map == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < map->members_size; i++)
+        {
+                free (map->members[i].entities);
+                if (map->members[i].layer_name != NULL)
+                {
+                        dxf_intern_free_string ((DxfIntern *) map->intern, map->members[i].layer_name);
+                }
+        }
+        free (map->members);
+        free (map);
+        map = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the members of a layer, adding the layer when it is not
+ * yet in the map.
+ *
+ * An entity without a layer is on the default layer (\c "0").
+ *
+ * \return a pointer to the members, or \c NULL when no memory could be
+ * allocated.
+ */
+static DxfLayerIndexMembers *
+dxf_layer_index_map_add_layer
+(
+        DxfLayerIndexMap *map,
+                /*!< a pointer to a layer index map. */
+        const char *layer_name
+                /*!< the name of the layer. */
+)
+{
+        DxfLayerIndexMembers *members = NULL;
+        char *name = NULL;
+        int id;
+        int size;
+
+        if (layer_name == NULL)
+        {
+                layer_name = DXF_DEFAULT_LAYER;
+        }
+        id = dxf_intern_get_id ((DxfIntern *) map->intern, layer_name);
+        if ((id >= 0) && (id < map->members_size)
+          && (map->members[id].layer_name != NULL))
+        {
+                return (&map->members[id]);
+        }
+        /* A new layer, the map keeps a reference to its name. */
+        if ((name = dxf_intern_string ((DxfIntern *) map->intern, layer_name)) == NULL)
+        {
+                return (NULL);
+        }
+        id = dxf_intern_get_id ((DxfIntern *) map->intern, name);
+        if (id >= map->members_size)
+        {
+                size = (map->members_size == 0) ? 16 : map->members_size;
+                while (size <= id)
+                {
+                        size *= 2;
+                }
+                members = realloc (map->members, size * sizeof (DxfLayerIndexMembers));
+                if (members == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for layer members.\n")),
+                          __FUNCTION__);
+                        dxf_intern_free_string ((DxfIntern *) map->intern, name);
+                        return (NULL);
+                }
+                memset (members + map->members_size, 0,
+                  (size - map->members_size) * sizeof (DxfLayerIndexMembers));
+                map->members = members;
+                map->members_size = size;
+        }
+        /* Visible until a LAYER table entry says otherwise. */
+        members = &map->members[id];
+        members->layer_name = name;
+        members->visible = TRUE;
+        return (members);
+}
+
+
+/*!
+ * \brief Set the \c LAYER table entries of the layers in a layer index
+ * map.
+ *
+ * Every layer of the list is added to the map (also when no entity is
+ * on it yet), layers which are no longer in the list keep their
+ * entities without a table entry.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_layer_index_map_set_layers
+(
+        DxfLayerIndexMap *map,
+                /*!< a pointer to a layer index map. */
+        DxfLayer *layers
+                /*!< a pointer to the first \c LAYER table entry (a
+                 * single linked list), may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLayerIndexMembers *members = NULL;
+        DxfLayer *layer = NULL;
+        int i;
+
+        /* Do some basic checks. */
+        if (map == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < map->members_size; i++)
+        {
+                map->members[i].layer = NULL;
+        }
+        for (layer = layers; layer != NULL; layer = (DxfLayer *) layer->next)
+        {
+                if ((members = dxf_layer_index_map_add_layer (map, layer->layer_name)) == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                members->layer = layer;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_layer_index_map_update_visibility (map));
+}
+
+
+/*!
+ * \brief Update the visibility of the layers in a layer index map from
+ * their \c LAYER table entries.
+ *
+ * A layer is invisible when it is frozen (see \c dxf_layer_is_frozen())
+ * or off (see \c dxf_layer_is_off()).\n
+ * Call this function after changing the flags or the color of a
+ * \c LAYER table entry.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_layer_index_map_update_visibility
+(
+        DxfLayerIndexMap *map
+                /*!< a pointer to a layer index map. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLayerIndexMembers *members = NULL;
+        int i;
+
+        /* Do some basic checks. */
+        if (map == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < map->members_size; i++)
+        {
+                members = &map->members[i];
+                members->visible = (members->layer == NULL)
+                  || ((dxf_layer_is_frozen (members->layer) == FALSE)
+                  && (dxf_layer_is_off (members->layer) == FALSE));
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add an entity to the members of its layer in a layer index
+ * map.
+ *
+ * Appending is amortized O(1).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_layer_index_map_add_entity
+(
+        DxfLayerIndexMap *map,
+                /*!< a pointer to a layer index map. */
+        int type,
+                /*!< type of the entity, a \c DxfEntityType value. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLayerIndexMembers *members = NULL;
+        DxfDrawingEntity *entities = NULL;
+        int size;
+
+        /* Do some basic checks. */
+        if ((map == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        members = dxf_layer_index_map_add_layer (map, dxf_entity_get_layer (type, entity));
+        if (members == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (members->number_of_entities == members->entities_size)
+        {
+                size = (members->entities_size == 0) ? 16 : 2 * members->entities_size;
+                entities = realloc (members->entities, size * sizeof (DxfDrawingEntity));
+                if (entities == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for layer members.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                members->entities = entities;
+                members->entities_size = size;
+        }
+        members->entities[members->number_of_entities].type = type;
+        members->entities[members->number_of_entities].entity = entity;
+        members->number_of_entities++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove an entity from the members of a layer in a layer index
+ * map.
+ *
+ * The last entity of the layer takes the place of the removed entity,
+ * so the order of the members changes.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the entity
+ * is not on the layer or an error occurred.
+ */
+int
+dxf_layer_index_map_remove_entity
+(
+        DxfLayerIndexMap *map,
+                /*!< a pointer to a layer index map. */
+        int type,
+                /*!< type of the entity, a \c DxfEntityType value. */
+        void *entity,
+                /*!< a pointer to the entity. */
+        const char *layer_name
+                /*!< the layer the entity was added on, \c NULL for the
+                 * current layer of the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLayerIndexMembers *members = NULL;
+        int i;
+
+        /* Do some basic checks. */
+        if ((map == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (layer_name == NULL)
+        {
+                layer_name = dxf_entity_get_layer (type, entity);
+        }
+        members = dxf_layer_index_map_get_members (map, layer_name);
+        if (members == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = members->number_of_entities - 1; i >= 0; i--)
+        {
+                if (members->entities[i].entity == entity)
+                {
+                        members->number_of_entities--;
+                        members->entities[i] = members->entities[members->number_of_entities];
+#if DEBUG
+                        DXF_DEBUG_END
+#endif
+                        return (EXIT_SUCCESS);
+                }
+        }
+        return (EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Build a layer index map for all entities of a drawing.
+ *
+ * Replaces the members of the map, the layers are taken from the
+ * \c TABLES section of the drawing.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_layer_index_map_build
+(
+        DxfLayerIndexMap *map,
+                /*!< a pointer to a layer index map. */
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfChunkListIter iter;
+        DxfDrawingEntity *entry = NULL;
+        int i;
+
+        /* Do some basic checks. */
+        if ((map == NULL) || (drawing == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < map->members_size; i++)
+        {
+                map->members[i].number_of_entities = 0;
+        }
+        if (dxf_layer_index_map_set_layers (map, (drawing->tables_list == NULL)
+          ? NULL : (DxfLayer *) ((DxfTables *) drawing->tables_list)->layers) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (drawing->entities != NULL)
+        {
+                dxf_chunk_list_iter_init ((DxfChunkList *) drawing->entities, &iter);
+                while ((entry = (DxfDrawingEntity *) dxf_chunk_list_iter_next (&iter)) != NULL)
+                {
+                        if (dxf_layer_index_map_add_entity (map, entry->type, entry->entity) != EXIT_SUCCESS)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of layers in a layer index map.
+ *
+ * The members are indexed by the id of the layer name in the intern
+ * table, \c map->members[i] (for \c i from 0 to \c members_size)
+ * holds a layer when its \c layer_name is not \c NULL.
+ *
+ * \return the number of layers, or -1 when an error occurred.
+ */
+int
+dxf_layer_index_map_get_number_of_layers
+(
+        DxfLayerIndexMap *map
+                /*!< a pointer to a layer index map. */
+)
+{
+        int number_of_layers = 0;
+        int i;
+
+        if (map == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        for (i = 0; i < map->members_size; i++)
+        {
+                if (map->members[i].layer_name != NULL)
+                {
+                        number_of_layers++;
+                }
+        }
+        return (number_of_layers);
+}
+
+
+/*!
+ * \brief Get the members of a layer in a layer index map.
+ *
+ * \return a pointer to the members, or \c NULL when the layer is not in
+ * the map.
+ */
+DxfLayerIndexMembers *
+dxf_layer_index_map_get_members
+(
+        DxfLayerIndexMap *map,
+                /*!< a pointer to a layer index map. */
+        const char *layer_name
+                /*!< the name of the layer, \c NULL for the default
+                 * layer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int id;
+
+        /* Do some basic checks. */
+        if (map == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (layer_name == NULL)
+        {
+                layer_name = DXF_DEFAULT_LAYER;
+        }
+        id = dxf_intern_get_id ((DxfIntern *) map->intern, layer_name);
+        if ((id < 0) || (id >= map->members_size)
+          || (map->members[id].layer_name == NULL))
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (&map->members[id]);
+}
+
+
+/*!
+ * \brief Test if the layer of an entity is visible.
+ *
+ * \return \c TRUE when the layer of the entity is visible or not in
+ * the map, \c FALSE when it is frozen or off, or -1 when an error
+ * occurred.
+ */
+int
+dxf_layer_index_map_is_visible
+(
+        DxfLayerIndexMap *map,
+                /*!< a pointer to a layer index map. */
+        int type,
+                /*!< type of the entity, a \c DxfEntityType value. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+        DxfLayerIndexMembers *members = NULL;
+
+        /* Do some basic checks. */
+        if ((map == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        members = dxf_layer_index_map_get_members (map, dxf_entity_get_layer (type, entity));
+        return ((members == NULL) || members->visible);
+}
+
+
+/*!
+ * \brief Fill a DXF \c LAYER_INDEX object from the layer index map of
+ * a libDXF drawing.
+ *
+ * The map is rebuilt first, so entities which changed layer with one
+ * of the \c dxf_*_set_layer() functions are counted on their new
+ * layer.\n
+ * The object lists every layer holding entities with its number of
+ * entities, and gets the current time as time stamp.\n
+ * Every layer gets a new \c IDBUFFER object, owned by the
+ * \c LAYER_INDEX object, with soft pointers to the entities on the
+ * layer (entities without a handle are left out), and the object gets
+ * a hard owner reference to it.\n
+ * The handles of the \c IDBUFFER objects are reserved in the drawing,
+ * give the \c LAYER_INDEX object its handle before calling this
+ * function.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred (more than \c DXF_MAX_PARAM layers hold entities).
+ */
+int
+dxf_layer_index_map_fill_layer_index
+(
+        DxfLayerIndexMap *map,
+                /*!< a pointer to the layer index map of \c drawing. */
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        DxfLayerIndex *layer_index,
+                /*!< a pointer to a DXF \c LAYER_INDEX object. */
+        DxfIdbuffer **idbuffers
+                /*!< the new chain of \c IDBUFFER objects is returned
+                 * here, in the order of the layers in \c layer_index,
+                 * to be added to the \c OBJECTS section (owned by the
+                 * caller). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLayerIndexMembers *members = NULL;
+        DxfIdbuffer *idbuffer = NULL;
+        DxfIdbuffer *last = NULL;
+        DxfIdbufferEntityPointer *entity_pointer = NULL;
+        DxfIdbufferEntityPointer *last_pointer = NULL;
+        char owner[17];
+        char reference[17];
+        uint64_t first_handle;
+        int number_of_layers = 0;
+        int id_code;
+        int entity_id_code;
+        int i;
+        int j;
+        int k = 0;
+
+        /* Do some basic checks. */
+        if ((map == NULL) || (drawing == NULL)
+          || (layer_index == NULL) || (idbuffers == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        *idbuffers = NULL;
+        if (dxf_layer_index_map_build (map, drawing) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < map->members_size; i++)
+        {
+                if (map->members[i].number_of_entities > 0)
+                {
+                        number_of_layers++;
+                }
+        }
+        if (number_of_layers > DXF_MAX_PARAM)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () too many layers for a LAYER_INDEX object.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        first_handle = 0;
+        if (number_of_layers > 0)
+        {
+                first_handle = dxf_drawing_reserve_handles (drawing, number_of_layers);
+                if ((first_handle == 0)
+                  || (first_handle + number_of_layers - 1 > INT_MAX))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not reserve handles for the IDBUFFER objects.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+        }
+        snprintf (owner, sizeof (owner), "%x", layer_index->id_code);
+        for (i = 0; i < map->members_size; i++)
+        {
+                members = &map->members[i];
+                if (members->number_of_entities == 0)
+                {
+                        continue;
+                }
+                /* The IDBUFFER of the layer. */
+                idbuffer = dxf_idbuffer_init (dxf_idbuffer_new ());
+                if (idbuffer == NULL)
+                {
+                        dxf_idbuffer_free_chain (*idbuffers);
+                        *idbuffers = NULL;
+                        return (EXIT_FAILURE);
+                }
+                id_code = (int) (first_handle + k);
+                idbuffer->id_code = id_code;
+                free (idbuffer->dictionary_owner_soft);
+                idbuffer->dictionary_owner_soft = strdup (owner);
+                dxf_idbuffer_entity_pointer_free_chain (idbuffer->entity_pointer);
+                idbuffer->entity_pointer = NULL;
+                if (last == NULL)
+                {
+                        *idbuffers = idbuffer;
+                }
+                else
+                {
+                        last->next = (struct DxfIdbuffer *) idbuffer;
+                }
+                last = idbuffer;
+                last_pointer = NULL;
+                for (j = 0; j < members->number_of_entities; j++)
+                {
+                        entity_id_code = dxf_entity_get_id_code (members->entities[j].type,
+                          members->entities[j].entity);
+                        if (entity_id_code <= 0)
+                        {
+                                continue;
+                        }
+                        entity_pointer = dxf_idbuffer_entity_pointer_init (dxf_idbuffer_entity_pointer_new ());
+                        if (entity_pointer == NULL)
+                        {
+                                dxf_idbuffer_free_chain (*idbuffers);
+                                *idbuffers = NULL;
+                                return (EXIT_FAILURE);
+                        }
+                        snprintf (reference, sizeof (reference), "%x", entity_id_code);
+                        free (entity_pointer->soft_pointer);
+                        entity_pointer->soft_pointer = strdup (reference);
+                        if (last_pointer == NULL)
+                        {
+                                idbuffer->entity_pointer = entity_pointer;
+                        }
+                        else
+                        {
+                                last_pointer->next = (struct DxfIdbufferEntityPointer *) entity_pointer;
+                        }
+                        last_pointer = entity_pointer;
+                }
+                /* The entry of the layer in the LAYER_INDEX. */
+                free (layer_index->layer_name[k]);
+                layer_index->layer_name[k] = strdup (members->layer_name);
+                snprintf (reference, sizeof (reference), "%x", id_code);
+                free (layer_index->hard_owner_reference[k]);
+                layer_index->hard_owner_reference[k] = strdup (reference);
+                layer_index->number_of_entries[k] = members->number_of_entities;
+                k++;
+        }
+        /* Clear the remaining entries. */
+        for (; k < DXF_MAX_PARAM; k++)
+        {
+                if ((layer_index->layer_name[k] == NULL)
+                  || (strlen (layer_index->layer_name[k]) > 0))
+                {
+                        free (layer_index->layer_name[k]);
+                        layer_index->layer_name[k] = strdup ("");
+                        free (layer_index->hard_owner_reference[k]);
+                        layer_index->hard_owner_reference[k] = strdup ("");
+                }
+                layer_index->number_of_entries[k] = 0;
+        }
+        /* Julian date. */
+        layer_index->time_stamp = 2440587.5 + (double) time (NULL) / 86400.0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF*/
@@ -39,6 +39,10 @@
 
 
 #include "global.h"
+#include "drawing.h"
+#include "layer.h"
+#include "idbuffer.h"
+#include "intern.h"
 
 
 /*!
@@ -86,6 +90,65 @@ dxf_layer_index
 } DxfLayerIndex;
 
 
+/*!
+ * \brief Definition of the entities on one layer in a
+ * \c DxfLayerIndexMap.
+ */
+typedef struct
+dxf_layer_index_members
+{
+        char *layer_name;
+                /*!< Name of the layer (interned in the map). */
+        DxfLayer *layer;
+                /*!< The \c LAYER table entry, or \c NULL when the
+                 * layer is used by entities but not in the \c TABLES
+                 * section. */
+        int visible;
+                /*!< \c FALSE when the layer is frozen or off, else
+                 * \c TRUE. */
+        DxfDrawingEntity *entities;
+                /*!< Compact array of the entities on the layer (not
+                 * owned), in the order they were added. */
+        int number_of_entities;
+                /*!< Number of entities in \c entities. */
+        int entities_size;
+                /*!< Number of allocated entries in \c entities. */
+} DxfLayerIndexMembers;
+
+
+/*!
+ * \brief Definition of a live index of the entities per layer.
+ *
+ * Filtering entities by layer otherwise means a \c strcmp() of the
+ * layer of every entity in the drawing.\n
+ * Layer names are looked up in the intern table of the drawing, the
+ * id of an interned name is the index of its \c DxfLayerIndexMembers,
+ * so finding the members of a layer is a single hash lookup.\n
+ * The map of a drawing (see \c dxf_drawing_get_layer_map()) is kept up
+ * to date by \c dxf_drawing_append_entity() and
+ * \c dxf_drawing_set_tables_list().\n
+ * The \c dxf_*_set_layer() functions do not know the drawing of the
+ * entity: remove an entity changing layer from the map with its old
+ * layer and add it again, or rebuild the map with
+ * \c dxf_layer_index_map_build().\n
+ * \c dxf_layer_index_map_fill_layer_index() rebuilds the map before
+ * writing it.
+ */
+typedef struct
+dxf_layer_index_map
+{
+        struct DxfIntern *intern;
+                /*!< Intern table for the layer names (not owned by the
+                 * map, the map keeps a reference to the name of every
+                 * layer in it). */
+        DxfLayerIndexMembers *members;
+                /*!< Array of members, indexed by the id of the layer
+                 * name in \c intern. */
+        int members_size;
+                /*!< Number of allocated entries in \c members. */
+} DxfLayerIndexMap;
+
+
 DxfLayerIndex *
 dxf_layer_index_new ();
 DxfLayerIndex *
@@ -116,6 +179,77 @@ dxf_layer_index_free_chain
         DxfLayerIndex *layer_indices
 );
 
+DxfLayerIndexMap *
+dxf_layer_index_map_new ();
+DxfLayerIndexMap *
+dxf_layer_index_map_init
+(
+        DxfLayerIndexMap *map,
+        DxfIntern *intern
+);
+int
+dxf_layer_index_map_free
+(
+        DxfLayerIndexMap *map
+);
+int
+dxf_layer_index_map_set_layers
+(
+        DxfLayerIndexMap *map,
+        DxfLayer *layers
+);
+int
+dxf_layer_index_map_update_visibility
+(
+        DxfLayerIndexMap *map
+);
+int
+dxf_layer_index_map_add_entity
+(
+        DxfLayerIndexMap *map,
+        int type,
+        void *entity
+);
+int
+dxf_layer_index_map_remove_entity
+(
+        DxfLayerIndexMap *map,
+        int type,
+        void *entity,
+        const char *layer_name
+);
+int
+dxf_layer_index_map_build
+(
+        DxfLayerIndexMap *map,
+        DxfDrawing *drawing
+);
+int
+dxf_layer_index_map_get_number_of_layers
+(
+        DxfLayerIndexMap *map
+);
+DxfLayerIndexMembers *
+dxf_layer_index_map_get_members
+(
+        DxfLayerIndexMap *map,
+        const char *layer_name
+);
+int
+dxf_layer_index_map_is_visible
+(
+        DxfLayerIndexMap *map,
+        int type,
+        void *entity
+);
+int
+dxf_layer_index_map_fill_layer_index
+(
+        DxfLayerIndexMap *map,
+        DxfDrawing *drawing,
+        DxfLayerIndex *layer_index,
+        DxfIdbuffer **idbuffers
+);
 
 #endif /* LIBDXF_SRC_LAYER_INDEX_H */
 
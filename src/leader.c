@@ -35,6 +35,8 @@
 
 
 #include "leader.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -208,7 +210,7 @@ dxf_leader_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
@@ -226,9 +228,10 @@ dxf_leader_read
                 leader = dxf_leader_init (leader);
         }
         i = 0;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -236,7 +239,7 @@ dxf_leader_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -245,9 +248,9 @@ dxf_leader_read
                         /* Now follows a string containing additional
                          * proprietary data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", leader->dimension_style_name);
+                        leader->dimension_style_name = dxf_read_string (fp, leader->dimension_style_name);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -259,13 +262,13 @@ dxf_leader_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", leader->linetype);
+                        leader->linetype = dxf_read_string (fp, leader->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", leader->layer);
+                        leader->layer = dxf_read_string (fp, leader->layer);
                 }
                 else if ((strcmp (temp_string, "10") == 0)
                   || (strcmp (temp_string, "20") == 0)
@@ -515,7 +518,7 @@ dxf_leader_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", leader->dictionary_owner_soft);
+                        leader->dictionary_owner_soft = dxf_read_string (fp, leader->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "340") == 0)
                 {
@@ -523,14 +526,14 @@ dxf_leader_read
                          * reference to associated annotation (mtext,
                          * tolerance, or insert entity). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", leader->annotation_reference_hard);
+                        leader->annotation_reference_hard = dxf_read_string (fp, leader->annotation_reference_hard);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", leader->dictionary_owner_hard);
+                        leader->dictionary_owner_hard = dxf_read_string (fp, leader->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -544,7 +547,13 @@ dxf_leader_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (leader->linetype, "") == 0)
@@ -556,7 +565,7 @@ dxf_leader_read
                 leader->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -584,6 +593,8 @@ dxf_leader_write
 #endif
         char *dxf_entity_name = strdup ("LEADER");
         int i;
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -610,7 +621,8 @@ dxf_leader_write
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, leader->id_code);
         }
-        if (strcmp (leader->linetype, "") == 0)
+        linetype = leader->linetype;
+        if (strcmp (linetype, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -618,9 +630,10 @@ dxf_leader_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                leader->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = DXF_DEFAULT_LINETYPE;
         }
-        if (strcmp (leader->layer, "") == 0)
+        layer = leader->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -628,7 +641,7 @@ dxf_leader_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                leader->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -668,10 +681,10 @@ dxf_leader_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", leader->layer);
-        if (strcmp (leader->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (strcmp (linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", leader->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if (leader->color != DXF_COLOR_BYLAYER)
         {
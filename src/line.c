@@ -33,6 +33,7 @@
 
 
 #include "line.h"
+#include "util.h"
 
 
 /*!
@@ -61,17 +62,14 @@ dxf_line_new ()
         size = sizeof (DxfLine);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((line = malloc (size)) == NULL)
+        /* recycle a released DxfLine when available. */
+        if ((line = dxf_pool_alloc (DXF_POOL_LINE, size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfLine struct.\n")),
                   __FUNCTION__);
                 line = NULL;
         }
-        else
-        {
-                memset (line, 0, size);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -137,6 +135,7 @@ dxf_line_init
         line->paperspace = DXF_MODELSPACE;
         line->dictionary_owner_soft = strdup ("");
         line->dictionary_owner_hard = strdup ("");
+        line->intern = NULL;
         line->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -183,7 +182,7 @@ dxf_line_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (line == NULL)
@@ -194,9 +193,13 @@ dxf_line_read
                 line = dxf_line_new ();
                 line = dxf_line_init (line);
         }
+        /* The symbol names are interned in the intern table of the
+         * file. */
+        line->intern = fp->intern;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -205,7 +208,7 @@ dxf_line_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -220,13 +223,13 @@ dxf_line_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->linetype);
+                        line->linetype = dxf_intern_read_string (fp, line->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->layer);
+                        line->layer = dxf_intern_read_string (fp, line->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -355,14 +358,14 @@ dxf_line_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->dictionary_owner_soft);
+                        line->dictionary_owner_soft = dxf_read_string (fp, line->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->dictionary_owner_hard);
+                        line->dictionary_owner_hard = dxf_read_string (fp, line->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -376,19 +379,37 @@ dxf_line_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
-        }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
+        }
+        /* Symbol names not found in the file are still the copies
+         * made by the init function. */
+        line->linetype = dxf_intern_adopt_string ((DxfIntern *) line->intern, line->linetype);
+        line->layer = dxf_intern_adopt_string ((DxfIntern *) line->intern, line->layer);
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (line->linetype, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) line->intern, line->linetype, DXF_INTERN_ID_EMPTY))
+        {
+                dxf_intern_free_string ((DxfIntern *) line->intern, line->linetype);
+                line->linetype = dxf_intern_string ((DxfIntern *) line->intern, DXF_DEFAULT_LINETYPE);
+        }
+        if (dxf_intern_is_symbol ((DxfIntern *) line->intern, line->layer, DXF_INTERN_ID_EMPTY))
         {
-                line->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_intern_free_string ((DxfIntern *) line->intern, line->layer);
+                line->layer = dxf_intern_string ((DxfIntern *) line->intern, DXF_DEFAULT_LAYER);
         }
-        if (strcmp (line->layer, "") == 0)
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (line->id_code > 0))
         {
-                line->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) line->id_code, LINE, line);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -421,6 +442,8 @@ dxf_line_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("LINE");
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -453,7 +476,8 @@ dxf_line_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (line->linetype, "") == 0)
+        linetype = line->linetype;
+        if (dxf_intern_is_symbol ((DxfIntern *) line->intern, linetype, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -461,9 +485,10 @@ dxf_line_write
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                line->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = dxf_intern_get_symbol ((DxfIntern *) line->intern, DXF_INTERN_ID_DEFAULT_LINETYPE);
         }
-        if (strcmp (line->layer, "") == 0)
+        layer = line->layer;
+        if (dxf_intern_is_symbol ((DxfIntern *) line->intern, layer, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -471,7 +496,7 @@ dxf_line_write
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                line->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = dxf_intern_get_symbol ((DxfIntern *) line->intern, DXF_INTERN_ID_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -511,10 +536,10 @@ dxf_line_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", line->layer);
-        if (strcmp (line->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (!dxf_intern_is_symbol ((DxfIntern *) line->intern, linetype, DXF_INTERN_ID_DEFAULT_LINETYPE))
         {
-                fprintf (fp->fp, "  6\n%s\n", line->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
@@ -597,11 +622,11 @@ dxf_line_free
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (line->linetype);
-        free (line->layer);
+        dxf_intern_free_string ((DxfIntern *) line->intern, line->linetype);
+        dxf_intern_free_string ((DxfIntern *) line->intern, line->layer);
         free (line->dictionary_owner_soft);
         free (line->dictionary_owner_hard);
-        free (line);
+        dxf_pool_free (DXF_POOL_LINE, line);
         line = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -822,7 +847,10 @@ dxf_line_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        line->linetype = strdup (linetype);
+        /* Intern first, the new name may be the old one. */
+        linetype = dxf_intern_string ((DxfIntern *) line->intern, linetype);
+        dxf_intern_free_string ((DxfIntern *) line->intern, line->linetype);
+        line->linetype = linetype;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -912,7 +940,10 @@ dxf_line_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        line->layer = strdup (layer);
+        /* Intern first, the new name may be the old one. */
+        layer = dxf_intern_string ((DxfIntern *) line->intern, layer);
+        dxf_intern_free_string ((DxfIntern *) line->intern, line->layer);
+        line->layer = layer;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2499,4 +2530,62 @@ dxf_line_create_from_points
 }
 
 
+/*!
+ * \brief Calculate the nearest point on a DXF \c LINE to a point.
+ *
+ * \return the distance between the point and the \c line in drawing
+ * units, or -1.0 when an error occurred.
+ *
+ * \version According to DXF R10.
+ * \version According to DXF R11.
+ * \version According to DXF R12.
+ * \version According to DXF R13.
+ * \version According to DXF R14.
+ */
+double
+dxf_line_calculate_nearest_point
+(
+        DxfLine *line,
+                /*!< a pointer to a DXF \c LINE entity. */
+        DxfVec3 point,
+                /*!< the point in WCS. */
+        DxfVec3 *nearest,
+                /*!< the nearest point on the \c line (output), may be
+                 * \c NULL. */
+        double *parameter
+                /*!< the parameter of the nearest point, 0.0 at the
+                 * start point and 1.0 at the end point (output), may be
+                 * \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVec3 start;
+        DxfVec3 end;
+        double distance;
+
+        /* Do some basic checks. */
+        if (line == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1.0);
+        }
+        start.x = line->x0;
+        start.y = line->y0;
+        start.z = line->z0;
+        end.x = line->x1;
+        end.y = line->y1;
+        end.z = line->z1;
+        distance = dxf_vec3_nearest_point_on_segment (start, end, point,
+          nearest, parameter);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (distance);
+}
+
+
 /* EOF */
@@ -37,7 +37,11 @@
 
 
 #include "global.h"
+#include "intern.h"
+#include "handle_table.h"
+#include "pool.h"
 #include "point.h"
+#include "vec.h"
 
 
 /*!
@@ -131,6 +135,11 @@ dxf_line
                 /*!< Z value of the extrusion direction.\n
                  * Optional, if ommited defaults to 1.0.\n
                  * Group code = 230. */
+        struct DxfIntern *intern;
+                /*!< Intern table holding the interned symbol names of
+                 * this entity, \c NULL when none are interned.\n
+                 * Symbol names not found in this table are private
+                 * copies. */
         struct DxfLine *next;
                 /*!< pointer to the next DxfLine.\n
                  * \c NULL in the last DxfLine. */
@@ -358,6 +367,14 @@ dxf_line_create_from_points
         int inheritance
 );
 
+double
+dxf_line_calculate_nearest_point
+(
+        DxfLine *line,
+        DxfVec3 point,
+        DxfVec3 *nearest,
+        double *parameter
+);
 
 #endif /* LIBDXF_SRC_LINE_H */
 
@@ -33,6 +33,8 @@
 
 
 #include "ltype.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -183,7 +185,7 @@ dxf_ltype_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (ltype == NULL)
@@ -195,9 +197,10 @@ dxf_ltype_read
                 ltype = dxf_ltype_init (ltype);
         }
         element = 0;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -206,7 +209,7 @@ dxf_ltype_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -221,13 +224,13 @@ dxf_ltype_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ltype->linetype_name);
+                        ltype->linetype_name = dxf_read_string (fp, ltype->linetype_name);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a description. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ltype->description);
+                        ltype->description = dxf_read_string (fp, ltype->description);
                 }
                 else if (strcmp (temp_string, "9") == 0)
                 {
@@ -326,7 +329,7 @@ dxf_ltype_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ltype->dictionary_owner_soft);
+                        ltype->dictionary_owner_soft = dxf_read_string (fp, ltype->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "340") == 0)
                 {
@@ -340,7 +343,7 @@ dxf_ltype_read
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ltype->dictionary_owner_hard);
+                        ltype->dictionary_owner_hard = dxf_read_string (fp, ltype->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -354,7 +357,13 @@ dxf_ltype_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (ltype->linetype_name, "") == 0)
@@ -371,7 +380,7 @@ dxf_ltype_read
                 ltype->alignment = 65;
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
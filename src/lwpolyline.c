@@ -35,6 +35,8 @@
 
 
 #include "lwpolyline.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -135,7 +137,9 @@ dxf_lwpolyline_init
         lwpolyline->extr_z0 = 0.0;
         lwpolyline->dictionary_owner_soft = strdup ("");
         lwpolyline->dictionary_owner_hard = strdup ("");
-        lwpolyline->vertices = (struct DxfVertex *) dxf_vertex_new ();
+        lwpolyline->vertices = NULL;
+        lwpolyline->vertices_size = 0;
+        lwpolyline->intern = NULL;
         lwpolyline->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -144,6 +148,122 @@ dxf_lwpolyline_init
 }
 
 
+/*!
+ * \brief Get a new (last) vertex in the vertex array of a DXF
+ * \c LWPOLYLINE entity, growing the array when it is full.
+ *
+ * The widths of the new vertex default to the constant width of the
+ * light weight polyline, the coordinates and bulge to 0.0.
+ *
+ * \return a pointer to the new vertex, or \c NULL when an error
+ * occurred.
+ */
+static DxfLWPolylineVertex *
+dxf_lwpolyline_next_vertex
+(
+        DxfLWPolyline *lwpolyline
+                /*!< a pointer to the DXF \c LWPOLYLINE entity. */
+)
+{
+        DxfLWPolylineVertex *vertex = NULL;
+        int size;
+
+        if (lwpolyline->number_vertices >= lwpolyline->vertices_size)
+        {
+                size = (lwpolyline->vertices_size == 0)
+                  ? DXF_LWPOLYLINE_INITIAL_NUMBER_OF_VERTICES
+                  : 2 * lwpolyline->vertices_size;
+                if (dxf_lwpolyline_reserve_vertices (lwpolyline, size) == EXIT_FAILURE)
+                {
+                        return (NULL);
+                }
+        }
+        vertex = &lwpolyline->vertices[lwpolyline->number_vertices];
+        vertex->x0 = 0.0;
+        vertex->y0 = 0.0;
+        vertex->start_width = lwpolyline->constant_width;
+        vertex->end_width = lwpolyline->constant_width;
+        vertex->bulge = 0.0;
+        lwpolyline->number_vertices++;
+        return (vertex);
+}
+
+
+/*!
+ * \brief Read a run of vertices from a DXF file into the vertex array of
+ * a DXF \c LWPOLYLINE entity.
+ *
+ * The last line read from file contained the group code 10 of the first
+ * vertex of the run.\n
+ * Group codes 10, 20, 40, 41 and 42 are read straight into the vertex
+ * array until another group code is found, values found before the
+ * first group code 10 have no vertex and are skipped.
+ *
+ * \return the first group code following the run, or -1 when an error
+ * occurred.
+ */
+static int
+dxf_lwpolyline_read_vertices
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfLWPolyline *lwpolyline
+                /*!< a pointer to the DXF \c LWPOLYLINE entity. */
+)
+{
+        DxfLWPolylineVertex *vertex = NULL;
+        int group_code = 10;
+        double value;
+
+        for (;;)
+        {
+                (fp->line_number)++;
+                if (fscanf (fp->fp, "%lf\n", &value) != 1)
+                {
+                        return (-1);
+                }
+                if (group_code == 10)
+                {
+                        vertex = dxf_lwpolyline_next_vertex (lwpolyline);
+                        if (vertex == NULL)
+                        {
+                                return (-1);
+                        }
+                        vertex->x0 = value;
+                }
+                else if (vertex != NULL)
+                {
+                        switch (group_code)
+                        {
+                                case 20:
+                                        vertex->y0 = value;
+                                        break;
+                                case 40:
+                                        vertex->start_width = value;
+                                        break;
+                                case 41:
+                                        vertex->end_width = value;
+                                        break;
+                                case 42:
+                                        vertex->bulge = value;
+                                        break;
+                        }
+                }
+                (fp->line_number)++;
+                if (fscanf (fp->fp, "%d\n", &group_code) != 1)
+                {
+                        return (-1);
+                }
+                if ((group_code != 10) && (group_code != 20)
+                  && (group_code != 40) && (group_code != 41)
+                  && (group_code != 42))
+                {
+                        return (group_code);
+                }
+        }
+}
+
+
 /*!
  * \brief Read data from a DXF file into an \c LWPOLYLINE entity.
  *
@@ -174,7 +294,8 @@ dxf_lwpolyline_read
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfVertex *iter = NULL;
+        int group_code;
+        int number_vertices;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -183,7 +304,7 @@ dxf_lwpolyline_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (lwpolyline == NULL)
@@ -194,10 +315,14 @@ dxf_lwpolyline_read
                 lwpolyline = dxf_lwpolyline_new ();
                 lwpolyline = dxf_lwpolyline_init (lwpolyline);
         }
-        iter = (DxfVertex *) lwpolyline->vertices;
+        lwpolyline->number_vertices = 0;
+        /* The symbol names are interned in the intern table of the
+         * file. */
+        lwpolyline->intern = fp->intern;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -219,27 +344,33 @@ dxf_lwpolyline_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", lwpolyline->linetype);
+                        lwpolyline->linetype = dxf_intern_read_string (fp, lwpolyline->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", lwpolyline->layer);
+                        lwpolyline->layer = dxf_intern_read_string (fp, lwpolyline->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
-                        /* Now follows a string containing the
-                        * X-coordinate of a vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                        * Y-coordinate of a vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter->y0);
+                        /* Now follows a run of vertices, the
+                         * coordinates, widths and bulge of each vertex
+                         * are read straight into the vertex array. */
+                        group_code = dxf_lwpolyline_read_vertices (fp, lwpolyline);
+                        if (group_code == -1)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                /* Clean up. */
+                                dxf_pool_string_free (temp_string);
+                                return (NULL);
+                        }
+                        /* The group code following the run is handled
+                         * next. */
+                        sprintf (temp_string, "%d", group_code);
+                        continue;
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                         && (strcmp (temp_string, "38") == 0)
@@ -257,32 +388,6 @@ dxf_lwpolyline_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &lwpolyline->thickness);
                 }
-                else if (strcmp (temp_string, "40") == 0)
-                {
-                        /* Now follows a string containing the
-                         * start width of the vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter->start_width);
-                }
-                else if (strcmp (temp_string, "41") == 0)
-                {
-                        /* Now follows a string containing the
-                         * start width of the vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter->end_width);
-                }
-                else if (strcmp (temp_string, "42") == 0)
-                {
-                        /* Now follows a string containing the bulge of
-                         * the vertex. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &iter->bulge);
-                        /* The last member of the vertex is read.\n */
-                        /*! \todo The pointer administration needs to be checked for functionality. */
-                         /* Increment iter to next DxfVertex. */
-                        iter->next = (struct DxfVertex *) dxf_vertex_new ();
-                        iter = (DxfVertex *) iter->next;
-                }
                 else if (strcmp (temp_string, "43") == 0)
                 {
                         /* Now follows a string containing the
@@ -330,7 +435,21 @@ dxf_lwpolyline_read
                         /* Now follows a string containing the number
                          * of following vertices. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &lwpolyline->number_vertices);
+                        fscanf (fp->fp, "%d\n", &number_vertices);
+                        /* Size the vertex array from the vertex count,
+                         * the count is only a hint as the array grows
+                         * while reading the vertices. */
+                        if (number_vertices > DXF_VEC_ARRAY_MAX_RESERVE)
+                        {
+                                number_vertices = DXF_VEC_ARRAY_MAX_RESERVE;
+                        }
+                        if ((number_vertices > 0)
+                          && (dxf_lwpolyline_reserve_vertices (lwpolyline, number_vertices) == EXIT_FAILURE))
+                        {
+                                fprintf (stderr,
+                                  (_("Warning in %s () could not reserve %d vertices while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, number_vertices, fp->filename, fp->line_number);
+                        }
                 }
                 else if ((fp->acad_version_number >= AutoCAD_12)
                         && (strcmp (temp_string, "100") == 0))
@@ -369,14 +488,14 @@ dxf_lwpolyline_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", lwpolyline->dictionary_owner_soft);
+                        lwpolyline->dictionary_owner_soft = dxf_read_string (fp, lwpolyline->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", lwpolyline->dictionary_owner_hard);
+                        lwpolyline->dictionary_owner_hard = dxf_read_string (fp, lwpolyline->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -390,23 +509,37 @@ dxf_lwpolyline_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
-        /*! \todo Free memory to the last (unused) vertex in the linked list. */
-
-        /* Set the pointer to the last (unused) vertex in the linked list to NULL. */
-        iter->next = NULL;
+        /* Symbol names not found in the file are still the copies
+         * made by the init function. */
+        lwpolyline->linetype = dxf_intern_adopt_string ((DxfIntern *) lwpolyline->intern, lwpolyline->linetype);
+        lwpolyline->layer = dxf_intern_adopt_string ((DxfIntern *) lwpolyline->intern, lwpolyline->layer);
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (lwpolyline->linetype, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) lwpolyline->intern, lwpolyline->linetype, DXF_INTERN_ID_EMPTY))
+        {
+                dxf_intern_free_string ((DxfIntern *) lwpolyline->intern, lwpolyline->linetype);
+                lwpolyline->linetype = dxf_intern_string ((DxfIntern *) lwpolyline->intern, DXF_DEFAULT_LINETYPE);
+        }
+        if (dxf_intern_is_symbol ((DxfIntern *) lwpolyline->intern, lwpolyline->layer, DXF_INTERN_ID_EMPTY))
         {
-                lwpolyline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_intern_free_string ((DxfIntern *) lwpolyline->intern, lwpolyline->layer);
+                lwpolyline->layer = dxf_intern_string ((DxfIntern *) lwpolyline->intern, DXF_DEFAULT_LAYER);
         }
-        if (strcmp (lwpolyline->layer, "") == 0)
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (lwpolyline->id_code > 0))
         {
-                lwpolyline->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) lwpolyline->id_code, LWPOLYLINE, lwpolyline);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -446,7 +579,10 @@ dxf_lwpolyline_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("LWPOLYLINE");
-        DxfVertex *iter = NULL;
+        DxfLWPolylineVertex *vertex = NULL;
+        int i;
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -481,7 +617,8 @@ dxf_lwpolyline_write
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, lwpolyline->id_code);
         }
-        if (strcmp (lwpolyline->linetype, "") == 0)
+        linetype = lwpolyline->linetype;
+        if (dxf_intern_is_symbol ((DxfIntern *) lwpolyline->intern, linetype, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -489,9 +626,10 @@ dxf_lwpolyline_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                lwpolyline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = dxf_intern_get_symbol ((DxfIntern *) lwpolyline->intern, DXF_INTERN_ID_DEFAULT_LINETYPE);
         }
-        if (strcmp (lwpolyline->layer, "") == 0)
+        layer = lwpolyline->layer;
+        if (dxf_intern_is_symbol ((DxfIntern *) lwpolyline->intern, layer, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -499,7 +637,7 @@ dxf_lwpolyline_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                lwpolyline->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = dxf_intern_get_symbol ((DxfIntern *) lwpolyline->intern, DXF_INTERN_ID_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -539,10 +677,10 @@ dxf_lwpolyline_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", lwpolyline->layer);
-        if (strcmp (lwpolyline->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (!dxf_intern_is_symbol ((DxfIntern *) lwpolyline->intern, linetype, DXF_INTERN_ID_DEFAULT_LINETYPE))
         {
-                fprintf (fp->fp, "  6\n%s\n", lwpolyline->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if (lwpolyline->color != DXF_COLOR_BYLAYER)
         {
@@ -572,19 +710,18 @@ dxf_lwpolyline_write
                 fprintf (fp->fp, " 39\n%f\n", lwpolyline->thickness);
         }
         /* Start of writing (multiple) vertices. */
-        iter = (DxfVertex *) lwpolyline->vertices;
-        while (iter != NULL)
+        for (i = 0; i < lwpolyline->number_vertices; i++)
         {
-                fprintf (fp->fp, " 10\n%f\n", iter->x0);
-                fprintf (fp->fp, " 20\n%f\n", iter->y0);
-                if ((iter->start_width != lwpolyline->constant_width)
-                  || (iter->end_width != lwpolyline->constant_width))
+                vertex = &lwpolyline->vertices[i];
+                fprintf (fp->fp, " 10\n%f\n", vertex->x0);
+                fprintf (fp->fp, " 20\n%f\n", vertex->y0);
+                if ((vertex->start_width != lwpolyline->constant_width)
+                  || (vertex->end_width != lwpolyline->constant_width))
                 {
-                        fprintf (fp->fp, " 40\n%f\n", iter->start_width);
-                        fprintf (fp->fp, " 41\n%f\n", iter->end_width);
+                        fprintf (fp->fp, " 40\n%f\n", vertex->start_width);
+                        fprintf (fp->fp, " 41\n%f\n", vertex->end_width);
                 }
-                fprintf (fp->fp, " 42\n%f\n", iter->bulge);
-                iter = (DxfVertex *) iter->next;
+                fprintf (fp->fp, " 42\n%f\n", vertex->bulge);
         }
         /* End of writing (multiple) vertices. */
         if (fp->acad_version_number >= AutoCAD_12)
@@ -632,8 +769,9 @@ dxf_lwpolyline_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (lwpolyline->linetype);
-        free (lwpolyline->layer);
+        dxf_intern_free_string ((DxfIntern *) lwpolyline->intern, lwpolyline->linetype);
+        dxf_intern_free_string ((DxfIntern *) lwpolyline->intern, lwpolyline->layer);
+        free (lwpolyline->vertices);
         free (lwpolyline);
         lwpolyline = NULL;
 #if DEBUG
@@ -681,4 +819,293 @@ dxf_lwpolyline_free_chain
 }
 
 
+/*!
+ * \brief Allocate room for at least \c number_vertices vertices in the
+ * vertex array of a DXF \c LWPOLYLINE entity.
+ *
+ * Vertices already in the array are kept.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_lwpolyline_reserve_vertices
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to the DXF \c LWPOLYLINE entity. */
+        int number_vertices
+                /*!< the number of vertices to allocate room for. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLWPolylineVertex *vertices = NULL;
+
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (number_vertices < 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a negative number of vertices was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (number_vertices <= lwpolyline->vertices_size)
+        {
+                return (EXIT_SUCCESS);
+        }
+        vertices = realloc (lwpolyline->vertices,
+          (size_t) number_vertices * sizeof (DxfLWPolylineVertex));
+        if (vertices == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for the vertices.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        lwpolyline->vertices = vertices;
+        lwpolyline->vertices_size = number_vertices;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a vertex to the vertex array of a DXF \c LWPOLYLINE
+ * entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_lwpolyline_append_vertex
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to the DXF \c LWPOLYLINE entity. */
+        double x0,
+                /*!< X-value of the vertex. */
+        double y0,
+                /*!< Y-value of the vertex. */
+        double start_width,
+                /*!< start width of the vertex. */
+        double end_width,
+                /*!< end width of the vertex. */
+        double bulge
+                /*!< bulge of the vertex. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLWPolylineVertex *vertex = NULL;
+
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        vertex = dxf_lwpolyline_next_vertex (lwpolyline);
+        if (vertex == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        vertex->x0 = x0;
+        vertex->y0 = y0;
+        vertex->start_width = start_width;
+        vertex->end_width = end_width;
+        vertex->bulge = bulge;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get a vertex from the vertex array of a DXF \c LWPOLYLINE
+ * entity.
+ *
+ * \return a pointer to the vertex (owned by the \c LWPOLYLINE), or
+ * \c NULL when an error occurred.
+ */
+DxfLWPolylineVertex *
+dxf_lwpolyline_get_vertex
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to the DXF \c LWPOLYLINE entity. */
+        int i
+                /*!< the index of the vertex. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((i < 0) || (i >= lwpolyline->number_vertices))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range index was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (&lwpolyline->vertices[i]);
+}
+
+
+/*!
+ * \brief Calculate the nearest point on a DXF \c LWPOLYLINE to a
+ * point.
+ *
+ * Segments with a bulge are handled as exact circular arcs, and the
+ * closing segment of a closed polyline is included.\n
+ * The point may be outside the plane of the \c lwpolyline, the
+ * distance is measured in 3D.
+ *
+ * \return the distance between the point and the \c lwpolyline in
+ * drawing units, or -1.0 when an error occurred.
+ *
+ * \version According to DXF R14.
+ */
+double
+dxf_lwpolyline_calculate_nearest_point
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        DxfVec3 point,
+                /*!< the point in WCS. */
+        DxfVec3 *nearest,
+                /*!< the nearest point on the \c lwpolyline in WCS
+                 * (output), may be \c NULL. */
+        double *parameter
+                /*!< the parameter of the nearest point, the index of
+                 * the start vertex of the segment plus the fraction of
+                 * the segment (output), may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfOcs ocs;
+        DxfLWPolylineVertex *vertices = NULL;
+        DxfVec2 p1;
+        DxfVec2 p2;
+        DxfVec2 center;
+        DxfVec3 start;
+        DxfVec3 end;
+        DxfVec3 arc_center;
+        DxfVec3 q;
+        double radius;
+        double start_angle;
+        double end_angle;
+        double sweep;
+        double t;
+        double d;
+        double distance = HUGE_VAL;
+        int n;
+        int i;
+
+        /* Do some basic checks. */
+        if (lwpolyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1.0);
+        }
+        vertices = lwpolyline->vertices;
+        n = lwpolyline->number_vertices;
+        if ((vertices == NULL) || (n < 1))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a polyline without vertices was passed.\n")),
+                  __FUNCTION__);
+                return (-1.0);
+        }
+        dxf_ocs_init (&ocs, lwpolyline->extr_x0, lwpolyline->extr_y0, lwpolyline->extr_z0);
+        if (n == 1)
+        {
+                q = dxf_ocs_to_wcs (&ocs, vertices[0].x0, vertices[0].y0, lwpolyline->elevation);
+                distance = dxf_vec3_nearest_point_on_segment (q, q, point, nearest, NULL);
+                if (parameter != NULL)
+                {
+                        *parameter = 0.0;
+                }
+                return (distance);
+        }
+        for (i = 0; i < ((lwpolyline->flag & 1) ? n : n - 1); i++)
+        {
+                p1.x = vertices[i].x0;
+                p1.y = vertices[i].y0;
+                p2.x = vertices[(i + 1) % n].x0;
+                p2.y = vertices[(i + 1) % n].y0;
+                if (dxf_vec2_bulge_to_arc (p1, p2, vertices[i].bulge,
+                  &center, &radius, &start_angle, &end_angle))
+                {
+                        arc_center.x = center.x;
+                        arc_center.y = center.y;
+                        arc_center.z = lwpolyline->elevation;
+                        sweep = 4.0 * atan (fabs (vertices[i].bulge));
+                        if (vertices[i].bulge > 0.0)
+                        {
+                                d = dxf_vec3_nearest_point_on_arc (&ocs, arc_center,
+                                  radius, start_angle, end_angle, point, &q, &t);
+                                t = (t - start_angle) / sweep;
+                        }
+                        else
+                        {
+                                /* Clockwise, the same arc counter
+                                 * clockwise from the end point. */
+                                d = dxf_vec3_nearest_point_on_arc (&ocs, arc_center,
+                                  radius, end_angle, start_angle, point, &q, &t);
+                                t = 1.0 - (t - end_angle) / sweep;
+                        }
+                }
+                else
+                {
+                        start = dxf_ocs_to_wcs (&ocs, p1.x, p1.y, lwpolyline->elevation);
+                        end = dxf_ocs_to_wcs (&ocs, p2.x, p2.y, lwpolyline->elevation);
+                        d = dxf_vec3_nearest_point_on_segment (start, end, point, &q, &t);
+                }
+                if (d < distance)
+                {
+                        distance = d;
+                        if (nearest != NULL)
+                        {
+                                *nearest = q;
+                        }
+                        if (parameter != NULL)
+                        {
+                                *parameter = i + t;
+                        }
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (distance);
+}
+
+
 /* EOF */
@@ -39,7 +39,45 @@
 
 
 #include "global.h"
-#include "vertex.h"
+#include "intern.h"
+#include "handle_table.h"
+#include "vec.h"
+
+
+#define DXF_LWPOLYLINE_INITIAL_NUMBER_OF_VERTICES 16
+        /*!< \brief The number of vertices allocated for a
+         * \c LWPOLYLINE when no vertex count (group code 90) was read
+         * before the first vertex. */
+
+
+/*!
+ * \brief Definition of a DXF light weight polyline vertex.
+ *
+ * The vertices of a \c LWPOLYLINE are plain (x, y, widths, bulge)
+ * tuples, stored in one contiguous array owned by the light weight
+ * polyline.
+ */
+typedef struct
+dxf_lwpolyline_vertex
+{
+        double x0;
+                /*!< X-value of the vertex.\n
+                 * Group code = 10. */
+        double y0;
+                /*!< Y-value of the vertex.\n
+                 * Group code = 20. */
+        double start_width;
+                /*!< Start width (optional), defaults to the constant
+                 * width.\n
+                 * Group code = 40. */
+        double end_width;
+                /*!< End width (optional), defaults to the constant
+                 * width.\n
+                 * Group code = 41. */
+        double bulge;
+                /*!< Bulge (optional; default = 0.0).\n
+                 * Group code = 42. */
+} DxfLWPolylineVertex;
 
 
 /*!
@@ -117,7 +155,7 @@ dxf_lwpolyline
                  * Optional, defaults to 0.\n
                  * Group code = 70. */
         int number_vertices;
-                /*!< Number of vertices.\n
+                /*!< Number of vertices in \c vertices.\n
                  * Group code = 90. */
         double extr_x0;
                 /*!< Extrusion direction (optional; default = 0, 0, 1)\n
@@ -131,11 +169,17 @@ dxf_lwpolyline
         double extr_z0;
                 /*!< DXF: Z value of extrusion direction (optional).\n
                  * Group code = 230. */
-        struct DxfVertex *vertices;
-                /*!< Pointer to the first DxfVertex of the lwpolyline.\n
-                 * \c NULL in the last DxfVertex.\n
-                 * \note Not all members of the DxfVertex struct are
-                 * used for lwpolylines. */
+        DxfLWPolylineVertex *vertices;
+                /*!< Array of \c number_vertices vertices.\n
+                 * Sized from the vertex count (group code 90) when the
+                 * lwpolyline is read. */
+        int vertices_size;
+                /*!< Number of allocated entries in \c vertices. */
+        struct DxfIntern *intern;
+                /*!< Intern table holding the interned symbol names of
+                 * this entity, \c NULL when none are interned.\n
+                 * Symbol names not found in this table are private
+                 * copies. */
         struct DxfLWPolyline *next;
                 /*!< Pointer to the next DxfLWPolyline.\n
                  * \c NULL in the last DxfLWPolyline. */
@@ -170,7 +214,37 @@ dxf_lwpolyline_free_chain
 (
         DxfLWPolyline *lwpolylines
 );
+int
+dxf_lwpolyline_reserve_vertices
+(
+        DxfLWPolyline *lwpolyline,
+        int number_vertices
+);
+int
+dxf_lwpolyline_append_vertex
+(
+        DxfLWPolyline *lwpolyline,
+        double x0,
+        double y0,
+        double start_width,
+        double end_width,
+        double bulge
+);
+DxfLWPolylineVertex *
+dxf_lwpolyline_get_vertex
+(
+        DxfLWPolyline *lwpolyline,
+        int i
+);
 
+double
+dxf_lwpolyline_calculate_nearest_point
+(
+        DxfLWPolyline *lwpolyline,
+        DxfVec3 point,
+        DxfVec3 *nearest,
+        double *parameter
+);
 
 #endif /* LIBDXF_SRC_LWPOLYLINE_H */
 
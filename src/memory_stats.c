@@ -0,0 +1,1527 @@
+/*!
+ * \file memory_stats.c
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Functions for memory accounting of a libDXF drawing.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include "memory_stats.h"
+
+
+/*!
+ * \brief Account a string owned by a struct.
+ */
+static void
+dxf_memory_stats_add_string
+(
+        DxfMemoryStatsRecord *record,
+                /*!< the record to account in. */
+        const char *string
+                /*!< the string, may be \c NULL. */
+)
+{
+        if (string == NULL)
+        {
+                return;
+        }
+        record->string_bytes += strlen (string) + 1;
+}
+
+
+/*!
+ * \brief Account a symbol name held by an entity.
+ *
+ * Symbol names owned by the intern table of the entity are accounted
+ * with the table, private copies are accounted as strings.
+ */
+static void
+dxf_memory_stats_add_symbol
+(
+        DxfMemoryStatsRecord *record,
+                /*!< the record to account in. */
+        DxfIntern *intern,
+                /*!< the intern table of the entity, may be \c NULL. */
+        const char *string
+                /*!< the symbol name, may be \c NULL. */
+)
+{
+        if (dxf_intern_is_interned (intern, string))
+        {
+                return;
+        }
+        dxf_memory_stats_add_string (record, string);
+}
+
+
+/*!
+ * \brief Account a fixed size array of strings owned by a struct.
+ *
+ * The array itself is part of the struct, its unused entries are
+ * accounted as slack.
+ */
+static void
+dxf_memory_stats_add_strings
+(
+        DxfMemoryStatsRecord *record,
+                /*!< the record to account in. */
+        char **strings,
+                /*!< the array of strings. */
+        int size
+                /*!< the number of entries in \c strings. */
+)
+{
+        int i;
+
+        for (i = 0; i < size; i++)
+        {
+                if (strings[i] == NULL)
+                {
+                        record->slack_bytes += sizeof (char *);
+                }
+                else
+                {
+                        dxf_memory_stats_add_string (record, strings[i]);
+                }
+        }
+}
+
+
+/*!
+ * \brief Account the unused entries of an array as slack.
+ */
+static void
+dxf_memory_stats_add_slack
+(
+        DxfMemoryStatsRecord *record,
+                /*!< the record to account in. */
+        long used,
+                /*!< the number of entries in use. */
+        long size,
+                /*!< the number of entries allocated. */
+        size_t element_size
+                /*!< the size of an entry. */
+)
+{
+        if ((used >= 0) && (used < size))
+        {
+                record->slack_bytes += (size_t) (size - used) * element_size;
+        }
+}
+
+
+/*!
+ * \brief Account a chunk list as a sub-record.
+ */
+static void
+dxf_memory_stats_add_chunk_list
+(
+        DxfMemoryStatsRecord *record,
+                /*!< the record to account in. */
+        DxfChunkList *list
+                /*!< the chunk list, may be \c NULL. */
+)
+{
+        DxfChunkListBlock *block = NULL;
+        size_t block_bytes;
+
+        if (list == NULL)
+        {
+                return;
+        }
+        block_bytes = (size_t) list->block_size * (size_t) list->element_size;
+        record->sub_record_bytes += sizeof (DxfChunkList);
+        for (block = (DxfChunkListBlock *) list->first; block != NULL; block = (DxfChunkListBlock *) block->next)
+        {
+                record->sub_record_bytes += sizeof (DxfChunkListBlock) + block_bytes;
+                dxf_memory_stats_add_slack (record, block->number_of_entries,
+                  list->block_size, (size_t) list->element_size);
+        }
+}
+
+
+/*!
+ * \brief Account a list of binary graphics data as sub-records.
+ */
+static void
+dxf_memory_stats_add_binary_graphics_data
+(
+        DxfMemoryStatsRecord *record,
+                /*!< the record to account in. */
+        DxfBinaryGraphicsData *data
+                /*!< the first binary graphics data, may be \c NULL. */
+)
+{
+        DxfMemoryStatsRecord strings;
+
+        memset (&strings, 0, sizeof (DxfMemoryStatsRecord));
+        for (; data != NULL; data = (DxfBinaryGraphicsData *) data->next)
+        {
+                record->sub_record_bytes += sizeof (DxfBinaryGraphicsData);
+                dxf_memory_stats_add_string (&strings, data->data_line);
+        }
+        record->sub_record_bytes += strings.string_bytes;
+}
+
+
+/*!
+ * \brief Account the definition lines and seed points of a hatch
+ * pattern as sub-records.
+ */
+static void
+dxf_memory_stats_add_hatch_pattern
+(
+        DxfMemoryStatsRecord *record,
+                /*!< the record to account in. */
+        DxfHatchPatternDefLine *def_line,
+                /*!< the first definition line, may be \c NULL. */
+        DxfHatchPatternSeedPoint *seed_point
+                /*!< the first seed point, may be \c NULL. */
+)
+{
+        DxfHatchPatternDefLineDash *dash = NULL;
+
+        for (; def_line != NULL; def_line = (DxfHatchPatternDefLine *) def_line->next)
+        {
+                record->sub_record_bytes += sizeof (DxfHatchPatternDefLine);
+                for (dash = (DxfHatchPatternDefLineDash *) def_line->dashes; dash != NULL; dash = (DxfHatchPatternDefLineDash *) dash->next)
+                {
+                        record->sub_record_bytes += sizeof (DxfHatchPatternDefLineDash);
+                }
+        }
+        for (; seed_point != NULL; seed_point = (DxfHatchPatternSeedPoint *) seed_point->next)
+        {
+                record->sub_record_bytes += sizeof (DxfHatchPatternSeedPoint);
+        }
+}
+
+
+/*!
+ * \brief Account the boundary paths and patterns of a \c HATCH entity
+ * as sub-records.
+ */
+static void
+dxf_memory_stats_add_hatch
+(
+        DxfMemoryStatsRecord *record,
+                /*!< the record to account in. */
+        DxfHatch *hatch
+                /*!< the \c HATCH entity. */
+)
+{
+        DxfHatchBoundaryPath *path = NULL;
+        DxfHatchBoundaryPathEdge *edge = NULL;
+        DxfHatchBoundaryPathEdgeArc *arc = NULL;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse = NULL;
+        DxfHatchBoundaryPathEdgeLine *line = NULL;
+        DxfHatchBoundaryPathEdgeSpline *spline = NULL;
+        DxfHatchBoundaryPathEdgeSplineCp *control_point = NULL;
+        DxfHatchBoundaryPathPolyline *polyline = NULL;
+        DxfHatchBoundaryPathPolylineVertex *vertex = NULL;
+        DxfHatchPattern *pattern = NULL;
+
+        for (path = (DxfHatchBoundaryPath *) hatch->paths; path != NULL; path = (DxfHatchBoundaryPath *) path->next)
+        {
+                record->sub_record_bytes += sizeof (DxfHatchBoundaryPath);
+                for (edge = (DxfHatchBoundaryPathEdge *) path->edges; edge != NULL; edge = (DxfHatchBoundaryPathEdge *) edge->next)
+                {
+                        record->sub_record_bytes += sizeof (DxfHatchBoundaryPathEdge);
+                        for (arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs; arc != NULL; arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+                        {
+                                record->sub_record_bytes += sizeof (DxfHatchBoundaryPathEdgeArc);
+                        }
+                        for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses; ellipse != NULL; ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+                        {
+                                record->sub_record_bytes += sizeof (DxfHatchBoundaryPathEdgeEllipse);
+                        }
+                        for (line = (DxfHatchBoundaryPathEdgeLine *) edge->lines; line != NULL; line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+                        {
+                                record->sub_record_bytes += sizeof (DxfHatchBoundaryPathEdgeLine);
+                        }
+                        for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines; spline != NULL; spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+                        {
+                                record->sub_record_bytes += sizeof (DxfHatchBoundaryPathEdgeSpline)
+                                  + (size_t) spline->knots_size * sizeof (double);
+                                dxf_memory_stats_add_slack (record, spline->number_of_knots,
+                                  spline->knots_size, sizeof (double));
+                                for (control_point = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points; control_point != NULL; control_point = (DxfHatchBoundaryPathEdgeSplineCp *) control_point->next)
+                                {
+                                        record->sub_record_bytes += sizeof (DxfHatchBoundaryPathEdgeSplineCp);
+                                }
+                        }
+                }
+                for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines; polyline != NULL; polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+                {
+                        record->sub_record_bytes += sizeof (DxfHatchBoundaryPathPolyline);
+                        for (vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices; vertex != NULL; vertex = (DxfHatchBoundaryPathPolylineVertex *) vertex->next)
+                        {
+                                record->sub_record_bytes += sizeof (DxfHatchBoundaryPathPolylineVertex);
+                        }
+                }
+        }
+        dxf_memory_stats_add_hatch_pattern (record,
+          (DxfHatchPatternDefLine *) hatch->def_lines,
+          (DxfHatchPatternSeedPoint *) hatch->seed_points);
+        for (pattern = (DxfHatchPattern *) hatch->patterns; pattern != NULL; pattern = (DxfHatchPattern *) pattern->next)
+        {
+                record->sub_record_bytes += sizeof (DxfHatchPattern);
+                /* Skip lists shared with the hatch itself. */
+                dxf_memory_stats_add_hatch_pattern (record,
+                  (pattern->def_lines == hatch->def_lines) ? NULL : (DxfHatchPatternDefLine *) pattern->def_lines,
+                  (pattern->seed_points == hatch->seed_points) ? NULL : (DxfHatchPatternSeedPoint *) pattern->seed_points);
+        }
+}
+
+
+/*!
+ * \brief Account the cells of a \c TABLE entity as sub-records.
+ */
+static void
+dxf_memory_stats_add_table_cells
+(
+        DxfMemoryStatsRecord *record,
+                /*!< the record to account in. */
+        DxfTableCell *cell
+                /*!< the first cell, may be \c NULL. */
+)
+{
+        for (; cell != NULL; cell = (DxfTableCell *) cell->next)
+        {
+                record->sub_record_bytes += sizeof (DxfTableCell);
+                dxf_memory_stats_add_string (record, cell->text_string);
+                dxf_memory_stats_add_string (record, cell->text_style_name);
+                dxf_memory_stats_add_string (record, cell->attdef_text_string);
+                dxf_memory_stats_add_string (record, cell->block_table_record_hard_pointer);
+                dxf_memory_stats_add_string (record, cell->field_object_pointer);
+                dxf_memory_stats_add_strings (record, cell->optional_text_string, DXF_MAX_PARAM);
+                dxf_memory_stats_add_strings (record, cell->attdef_soft_pointer, DXF_MAX_PARAM);
+        }
+}
+
+
+static void *
+dxf_memory_stats_account_entity
+(
+        DxfMemoryStatsRecord *record,
+        int type,
+        void *entity
+);
+
+
+/*!
+ * \brief Account the vertices, vertex index and mesh of a \c POLYLINE
+ * entity as sub-records.
+ */
+static void
+dxf_memory_stats_add_polyline
+(
+        DxfMemoryStatsRecord *record,
+                /*!< the record to account in. */
+        DxfPolyline *polyline
+                /*!< the \c POLYLINE entity. */
+)
+{
+        DxfMemoryStatsRecord vertices;
+        DxfIndexedMesh *mesh = NULL;
+        void *vertex = NULL;
+
+        memset (&vertices, 0, sizeof (DxfMemoryStatsRecord));
+        for (vertex = polyline->vertices; vertex != NULL;)
+        {
+                vertex = dxf_memory_stats_account_entity (&vertices, VERTEX, vertex);
+        }
+        record->sub_record_bytes += vertices.struct_bytes + vertices.sub_record_bytes;
+        record->string_bytes += vertices.string_bytes;
+        record->slack_bytes += vertices.slack_bytes;
+        dxf_memory_stats_add_chunk_list (record, (DxfChunkList *) polyline->vertex_index);
+        mesh = (DxfIndexedMesh *) polyline->mesh;
+        if (mesh != NULL)
+        {
+                record->sub_record_bytes += sizeof (DxfIndexedMesh)
+                  + (size_t) mesh->vertices_size * 3 * sizeof (double)
+                  + (size_t) mesh->triangles_size * 3 * sizeof (uint32_t);
+                dxf_memory_stats_add_slack (record, mesh->number_of_vertices,
+                  mesh->vertices_size, 3 * sizeof (double));
+                dxf_memory_stats_add_slack (record, mesh->number_of_triangles,
+                  mesh->triangles_size, 3 * sizeof (uint32_t));
+        }
+}
+
+
+/*!
+ * \brief Account the memory of one entity.
+ *
+ * \return a pointer to the next entity in the list of \c entity, or
+ * \c NULL.
+ */
+static void *
+dxf_memory_stats_account_entity
+(
+        DxfMemoryStatsRecord *record,
+                /*!< the record to account in. */
+        int type,
+                /*!< type of the entity, a \c DxfEntityType value, or
+                 * \c UNKNOWN_ENTITY for a \c MLINE entity. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+        void *next = NULL;
+
+        record->number_of_objects++;
+        switch (type)
+        {
+                case DFACE:
+                {
+                        Dxf3dface *dface = (Dxf3dface *) entity;
+
+                        record->struct_bytes += sizeof (Dxf3dface);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) dface->intern, dface->linetype);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) dface->intern, dface->layer);
+                        dxf_memory_stats_add_string (record, dface->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, dface->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, dface->plot_style_name);
+                        dxf_memory_stats_add_string (record, dface->color_name);
+                        dxf_memory_stats_add_binary_graphics_data (record, (DxfBinaryGraphicsData *) dface->binary_graphics_data);
+                        next = dface->next;
+                        break;
+                }
+                case DSOLID:
+                {
+                        Dxf3dsolid *dsolid = (Dxf3dsolid *) entity;
+
+                        record->struct_bytes += sizeof (Dxf3dsolid);
+                        dxf_memory_stats_add_string (record, dsolid->linetype);
+                        dxf_memory_stats_add_string (record, dsolid->layer);
+                        dxf_memory_stats_add_string (record, dsolid->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, dsolid->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, dsolid->history);
+                        dxf_memory_stats_add_strings (record, dsolid->proprietary_data, DXF_MAX_PARAM);
+                        dxf_memory_stats_add_strings (record, dsolid->additional_proprietary_data, DXF_MAX_PARAM);
+                        next = dsolid->next;
+                        break;
+                }
+                case ACADPROXYENTITY:
+                {
+                        DxfAcadProxyEntity *proxy = (DxfAcadProxyEntity *) entity;
+
+                        record->struct_bytes += sizeof (DxfAcadProxyEntity);
+                        dxf_memory_stats_add_string (record, proxy->linetype);
+                        dxf_memory_stats_add_string (record, proxy->layer);
+                        dxf_memory_stats_add_string (record, proxy->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, proxy->dictionary_owner_hard);
+                        dxf_memory_stats_add_strings (record, proxy->binary_graphics_data, DXF_MAX_PARAM);
+                        dxf_memory_stats_add_strings (record, proxy->object_id, DXF_MAX_PARAM);
+                        next = proxy->next;
+                        break;
+                }
+                case ARC:
+                {
+                        DxfArc *arc = (DxfArc *) entity;
+
+                        record->struct_bytes += sizeof (DxfArc);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) arc->intern, arc->linetype);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) arc->intern, arc->layer);
+                        dxf_memory_stats_add_string (record, arc->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, arc->dictionary_owner_hard);
+                        next = arc->next;
+                        break;
+                }
+                case ATTDEF:
+                {
+                        DxfAttdef *attdef = (DxfAttdef *) entity;
+
+                        record->struct_bytes += sizeof (DxfAttdef);
+                        dxf_memory_stats_add_string (record, attdef->linetype);
+                        dxf_memory_stats_add_string (record, attdef->layer);
+                        dxf_memory_stats_add_string (record, attdef->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, attdef->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, attdef->default_value);
+                        dxf_memory_stats_add_string (record, attdef->tag_value);
+                        dxf_memory_stats_add_string (record, attdef->prompt_value);
+                        dxf_memory_stats_add_string (record, attdef->text_style);
+                        next = attdef->next;
+                        break;
+                }
+                case ATTRIB:
+                {
+                        DxfAttrib *attrib = (DxfAttrib *) entity;
+
+                        record->struct_bytes += sizeof (DxfAttrib);
+                        dxf_memory_stats_add_string (record, attrib->linetype);
+                        dxf_memory_stats_add_string (record, attrib->layer);
+                        dxf_memory_stats_add_string (record, attrib->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, attrib->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, attrib->default_value);
+                        dxf_memory_stats_add_string (record, attrib->tag_value);
+                        dxf_memory_stats_add_string (record, attrib->text_style);
+                        next = attrib->next;
+                        break;
+                }
+                case BODY:
+                {
+                        DxfBody *body = (DxfBody *) entity;
+
+                        record->struct_bytes += sizeof (DxfBody);
+                        dxf_memory_stats_add_string (record, body->linetype);
+                        dxf_memory_stats_add_string (record, body->layer);
+                        dxf_memory_stats_add_string (record, body->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, body->dictionary_owner_hard);
+                        dxf_memory_stats_add_strings (record, body->proprietary_data, DXF_MAX_PARAM);
+                        dxf_memory_stats_add_strings (record, body->additional_proprietary_data, DXF_MAX_PARAM);
+                        next = body->next;
+                        break;
+                }
+                case CIRCLE:
+                {
+                        DxfCircle *circle = (DxfCircle *) entity;
+
+                        record->struct_bytes += sizeof (DxfCircle);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) circle->intern, circle->linetype);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) circle->intern, circle->layer);
+                        dxf_memory_stats_add_string (record, circle->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, circle->dictionary_owner_hard);
+                        next = circle->next;
+                        break;
+                }
+                case DIMENSION:
+                {
+                        DxfDimension *dimension = (DxfDimension *) entity;
+
+                        record->struct_bytes += sizeof (DxfDimension);
+                        dxf_memory_stats_add_string (record, dimension->linetype);
+                        dxf_memory_stats_add_string (record, dimension->layer);
+                        dxf_memory_stats_add_string (record, dimension->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, dimension->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, dimension->dim_text);
+                        dxf_memory_stats_add_string (record, dimension->dimblock_name);
+                        dxf_memory_stats_add_string (record, dimension->dimstyle_name);
+                        next = dimension->next;
+                        break;
+                }
+                case ELLIPSE:
+                {
+                        DxfEllipse *ellipse = (DxfEllipse *) entity;
+
+                        record->struct_bytes += sizeof (DxfEllipse);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) ellipse->intern, ellipse->linetype);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) ellipse->intern, ellipse->layer);
+                        dxf_memory_stats_add_string (record, ellipse->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, ellipse->dictionary_owner_hard);
+                        next = ellipse->next;
+                        break;
+                }
+                case HATCH:
+                {
+                        DxfHatch *hatch = (DxfHatch *) entity;
+
+                        record->struct_bytes += sizeof (DxfHatch);
+                        dxf_memory_stats_add_string (record, hatch->linetype);
+                        dxf_memory_stats_add_string (record, hatch->layer);
+                        dxf_memory_stats_add_string (record, hatch->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, hatch->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, hatch->pattern_name);
+                        dxf_memory_stats_add_binary_graphics_data (record, (DxfBinaryGraphicsData *) hatch->binary_graphics_data);
+                        dxf_memory_stats_add_hatch (record, hatch);
+                        next = hatch->next;
+                        break;
+                }
+                case HELIX:
+                {
+                        DxfHelix *helix = (DxfHelix *) entity;
+
+                        record->struct_bytes += sizeof (DxfHelix);
+                        dxf_memory_stats_add_string (record, helix->linetype);
+                        dxf_memory_stats_add_string (record, helix->layer);
+                        dxf_memory_stats_add_string (record, helix->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, helix->material);
+                        dxf_memory_stats_add_string (record, helix->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, helix->plot_style_name);
+                        dxf_memory_stats_add_string (record, helix->color_name);
+                        dxf_memory_stats_add_binary_graphics_data (record, (DxfBinaryGraphicsData *) helix->binary_graphics_data);
+                        next = helix->next;
+                        break;
+                }
+                case IMAGE:
+                {
+                        DxfImage *image = (DxfImage *) entity;
+
+                        record->struct_bytes += sizeof (DxfImage);
+                        dxf_memory_stats_add_string (record, image->linetype);
+                        dxf_memory_stats_add_string (record, image->layer);
+                        dxf_memory_stats_add_string (record, image->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, image->material);
+                        dxf_memory_stats_add_string (record, image->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, image->plot_style_name);
+                        dxf_memory_stats_add_string (record, image->color_name);
+                        dxf_memory_stats_add_string (record, image->imagedef_object);
+                        dxf_memory_stats_add_string (record, image->imagedef_reactor_object);
+                        dxf_memory_stats_add_binary_graphics_data (record, (DxfBinaryGraphicsData *) image->binary_graphics_data);
+                        dxf_memory_stats_add_slack (record, image->number_of_clip_boundary_vertices, DXF_MAX_PARAM, 2 * sizeof (double));
+                        next = image->next;
+                        break;
+                }
+                case INSERT:
+                {
+                        DxfInsert *insert = (DxfInsert *) entity;
+
+                        record->struct_bytes += sizeof (DxfInsert);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) insert->intern, insert->linetype);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) insert->intern, insert->layer);
+                        dxf_memory_stats_add_string (record, insert->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, insert->dictionary_owner_hard);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) insert->intern, insert->block_name);
+                        next = insert->next;
+                        break;
+                }
+                case LEADER:
+                {
+                        DxfLeader *leader = (DxfLeader *) entity;
+
+                        record->struct_bytes += sizeof (DxfLeader);
+                        dxf_memory_stats_add_string (record, leader->linetype);
+                        dxf_memory_stats_add_string (record, leader->layer);
+                        dxf_memory_stats_add_string (record, leader->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, leader->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, leader->dimension_style_name);
+                        dxf_memory_stats_add_string (record, leader->annotation_reference_hard);
+                        dxf_memory_stats_add_slack (record, leader->number_vertices, DXF_MAX_PARAM, 3 * sizeof (double));
+                        next = leader->next;
+                        break;
+                }
+                case LINE:
+                {
+                        DxfLine *line = (DxfLine *) entity;
+
+                        record->struct_bytes += sizeof (DxfLine);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) line->intern, line->linetype);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) line->intern, line->layer);
+                        dxf_memory_stats_add_string (record, line->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, line->dictionary_owner_hard);
+                        next = line->next;
+                        break;
+                }
+                case LWPOLYLINE:
+                {
+                        DxfLWPolyline *lwpolyline = (DxfLWPolyline *) entity;
+
+                        record->struct_bytes += sizeof (DxfLWPolyline);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) lwpolyline->intern, lwpolyline->linetype);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) lwpolyline->intern, lwpolyline->layer);
+                        dxf_memory_stats_add_string (record, lwpolyline->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, lwpolyline->dictionary_owner_hard);
+                        if (lwpolyline->vertices != NULL)
+                        {
+                                record->sub_record_bytes += (size_t) lwpolyline->vertices_size * sizeof (DxfLWPolylineVertex);
+                                dxf_memory_stats_add_slack (record, lwpolyline->number_vertices, lwpolyline->vertices_size, sizeof (DxfLWPolylineVertex));
+                        }
+                        next = lwpolyline->next;
+                        break;
+                }
+                case MTEXT:
+                {
+                        DxfMtext *mtext = (DxfMtext *) entity;
+
+                        record->struct_bytes += sizeof (DxfMtext);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) mtext->intern, mtext->linetype);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) mtext->intern, mtext->layer);
+                        dxf_memory_stats_add_string (record, mtext->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, mtext->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, mtext->text_value);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) mtext->intern, mtext->text_style);
+                        dxf_memory_stats_add_string (record, mtext->background_color_name);
+                        dxf_memory_stats_add_strings (record, mtext->text_additional_value, DXF_MAX_PARAM);
+                        next = mtext->next;
+                        break;
+                }
+                case OLEFRAME:
+                {
+                        DxfOleFrame *oleframe = (DxfOleFrame *) entity;
+
+                        record->struct_bytes += sizeof (DxfOleFrame);
+                        dxf_memory_stats_add_string (record, oleframe->linetype);
+                        dxf_memory_stats_add_string (record, oleframe->layer);
+                        dxf_memory_stats_add_string (record, oleframe->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, oleframe->dictionary_owner_hard);
+                        dxf_memory_stats_add_strings (record, oleframe->binary_data, DXF_MAX_PARAM);
+                        next = oleframe->next;
+                        break;
+                }
+                case OLE2FRAME:
+                {
+                        DxfOle2Frame *ole2frame = (DxfOle2Frame *) entity;
+
+                        record->struct_bytes += sizeof (DxfOle2Frame);
+                        dxf_memory_stats_add_string (record, ole2frame->linetype);
+                        dxf_memory_stats_add_string (record, ole2frame->layer);
+                        dxf_memory_stats_add_string (record, ole2frame->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, ole2frame->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, ole2frame->end_of_data);
+                        dxf_memory_stats_add_string (record, ole2frame->length_of_binary_data);
+                        dxf_memory_stats_add_strings (record, ole2frame->binary_data, DXF_MAX_PARAM);
+                        next = ole2frame->next;
+                        break;
+                }
+                case POINT:
+                {
+                        DxfPoint *point = (DxfPoint *) entity;
+
+                        record->struct_bytes += sizeof (DxfPoint);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) point->intern, point->linetype);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) point->intern, point->layer);
+                        dxf_memory_stats_add_string (record, point->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, point->material);
+                        dxf_memory_stats_add_string (record, point->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, point->plot_style_name);
+                        dxf_memory_stats_add_string (record, point->color_name);
+                        dxf_memory_stats_add_binary_graphics_data (record, (DxfBinaryGraphicsData *) point->binary_graphics_data);
+                        next = point->next;
+                        break;
+                }
+                case POLYLINE:
+                {
+                        DxfPolyline *polyline = (DxfPolyline *) entity;
+
+                        record->struct_bytes += sizeof (DxfPolyline);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) polyline->intern, polyline->linetype);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) polyline->intern, polyline->layer);
+                        dxf_memory_stats_add_string (record, polyline->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, polyline->dictionary_owner_hard);
+                        dxf_memory_stats_add_polyline (record, polyline);
+                        next = polyline->next;
+                        break;
+                }
+                case RAY:
+                {
+                        DxfRay *ray = (DxfRay *) entity;
+
+                        record->struct_bytes += sizeof (DxfRay);
+                        dxf_memory_stats_add_string (record, ray->linetype);
+                        dxf_memory_stats_add_string (record, ray->layer);
+                        dxf_memory_stats_add_string (record, ray->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, ray->dictionary_owner_hard);
+                        next = ray->next;
+                        break;
+                }
+                case REGION:
+                {
+                        DxfRegion *region = (DxfRegion *) entity;
+
+                        record->struct_bytes += sizeof (DxfRegion);
+                        dxf_memory_stats_add_string (record, region->linetype);
+                        dxf_memory_stats_add_string (record, region->layer);
+                        dxf_memory_stats_add_string (record, region->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, region->dictionary_owner_hard);
+                        dxf_memory_stats_add_strings (record, region->proprietary_data, DXF_MAX_PARAM);
+                        dxf_memory_stats_add_strings (record, region->additional_proprietary_data, DXF_MAX_PARAM);
+                        next = region->next;
+                        break;
+                }
+                case SHAPE:
+                {
+                        DxfShape *shape = (DxfShape *) entity;
+
+                        record->struct_bytes += sizeof (DxfShape);
+                        dxf_memory_stats_add_string (record, shape->linetype);
+                        dxf_memory_stats_add_string (record, shape->layer);
+                        dxf_memory_stats_add_string (record, shape->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, shape->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, shape->shape_name);
+                        next = shape->next;
+                        break;
+                }
+                case SOLID:
+                {
+                        DxfSolid *solid = (DxfSolid *) entity;
+
+                        record->struct_bytes += sizeof (DxfSolid);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) solid->intern, solid->linetype);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) solid->intern, solid->layer);
+                        dxf_memory_stats_add_string (record, solid->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, solid->dictionary_owner_hard);
+                        next = solid->next;
+                        break;
+                }
+                case SPLINE:
+                {
+                        DxfSpline *spline = (DxfSpline *) entity;
+
+                        record->struct_bytes += sizeof (DxfSpline);
+                        dxf_memory_stats_add_string (record, spline->linetype);
+                        dxf_memory_stats_add_string (record, spline->layer);
+                        dxf_memory_stats_add_string (record, spline->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, spline->material);
+                        dxf_memory_stats_add_string (record, spline->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, spline->plot_style_name);
+                        dxf_memory_stats_add_string (record, spline->color_name);
+                        dxf_memory_stats_add_binary_graphics_data (record, (DxfBinaryGraphicsData *) spline->binary_graphics_data);
+                        dxf_memory_stats_add_slack (record, spline->number_of_knots, DXF_MAX_PARAM, 2 * sizeof (double));
+                        if (spline->p0 != NULL)
+                        {
+                                record->sub_record_bytes += (size_t) spline->number_of_control_points * sizeof (DxfVec3);
+                                dxf_memory_stats_add_slack (record, spline->number_of_control_points, spline->p0_size, sizeof (DxfVec3));
+                        }
+                        if (spline->p1 != NULL)
+                        {
+                                record->sub_record_bytes += (size_t) spline->number_of_fit_points * sizeof (DxfVec3);
+                                dxf_memory_stats_add_slack (record, spline->number_of_fit_points, spline->p1_size, sizeof (DxfVec3));
+                        }
+                        next = spline->next;
+                        break;
+                }
+                case TABLE:
+                {
+                        DxfTable *table = (DxfTable *) entity;
+
+                        record->struct_bytes += sizeof (DxfTable);
+                        dxf_memory_stats_add_string (record, table->linetype);
+                        dxf_memory_stats_add_string (record, table->layer);
+                        dxf_memory_stats_add_string (record, table->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, table->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, table->block_name);
+                        dxf_memory_stats_add_string (record, table->table_text_style_name);
+                        dxf_memory_stats_add_string (record, table->tablestyle_object_pointer);
+                        dxf_memory_stats_add_string (record, table->owning_block_pointer);
+                        dxf_memory_stats_add_strings (record, table->binary_graphics_data, DXF_MAX_PARAM);
+                        dxf_memory_stats_add_slack (record, table->number_of_rows, DXF_MAX_PARAM, sizeof (double));
+                        dxf_memory_stats_add_slack (record, table->number_of_columns, DXF_MAX_PARAM, sizeof (double));
+                        dxf_memory_stats_add_table_cells (record, (DxfTableCell *) table->cells);
+                        next = table->next;
+                        break;
+                }
+                case TEXT:
+                {
+                        DxfText *text = (DxfText *) entity;
+
+                        record->struct_bytes += sizeof (DxfText);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) text->intern, text->linetype);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) text->intern, text->layer);
+                        dxf_memory_stats_add_string (record, text->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, text->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, text->text_value);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) text->intern, text->text_style);
+                        next = text->next;
+                        break;
+                }
+                case TOLERANCE:
+                {
+                        DxfTolerance *tolerance = (DxfTolerance *) entity;
+
+                        record->struct_bytes += sizeof (DxfTolerance);
+                        dxf_memory_stats_add_string (record, tolerance->linetype);
+                        dxf_memory_stats_add_string (record, tolerance->layer);
+                        dxf_memory_stats_add_string (record, tolerance->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, tolerance->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, tolerance->dimstyle_name);
+                        next = tolerance->next;
+                        break;
+                }
+                case TRACE:
+                {
+                        DxfTrace *trace = (DxfTrace *) entity;
+
+                        record->struct_bytes += sizeof (DxfTrace);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) trace->intern, trace->linetype);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) trace->intern, trace->layer);
+                        dxf_memory_stats_add_string (record, trace->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, trace->dictionary_owner_hard);
+                        next = trace->next;
+                        break;
+                }
+                case VERTEX:
+                {
+                        DxfVertex *vertex = (DxfVertex *) entity;
+
+                        record->struct_bytes += sizeof (DxfVertex);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) vertex->intern, vertex->linetype);
+                        dxf_memory_stats_add_symbol (record, (DxfIntern *) vertex->intern, vertex->layer);
+                        dxf_memory_stats_add_string (record, vertex->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, vertex->dictionary_owner_hard);
+                        next = vertex->next;
+                        break;
+                }
+                case VIEWPORT:
+                {
+                        DxfViewport *viewport = (DxfViewport *) entity;
+
+                        record->struct_bytes += sizeof (DxfViewport);
+                        dxf_memory_stats_add_string (record, viewport->linetype);
+                        dxf_memory_stats_add_string (record, viewport->layer);
+                        dxf_memory_stats_add_string (record, viewport->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, viewport->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, viewport->app_name);
+                        dxf_memory_stats_add_string (record, viewport->viewport_data);
+                        dxf_memory_stats_add_string (record, viewport->window_descriptor_begin);
+                        dxf_memory_stats_add_string (record, viewport->frozen_layer_list_begin);
+                        dxf_memory_stats_add_string (record, viewport->frozen_layer_list_end);
+                        dxf_memory_stats_add_string (record, viewport->window_descriptor_end);
+                        dxf_memory_stats_add_strings (record, viewport->frozen_layers, DXF_MAX_LAYERS);
+                        next = viewport->next;
+                        break;
+                }
+                case UNKNOWN_ENTITY:
+                {
+                        DxfMline *mline = (DxfMline *) entity;
+
+                        record->struct_bytes += sizeof (DxfMline);
+                        dxf_memory_stats_add_string (record, mline->linetype);
+                        dxf_memory_stats_add_string (record, mline->layer);
+                        dxf_memory_stats_add_string (record, mline->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, mline->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, mline->style_name);
+                        dxf_memory_stats_add_string (record, mline->mlinestyle_dictionary);
+                        dxf_memory_stats_add_slack (record, mline->number_of_vertices, DXF_MAX_PARAM, 9 * sizeof (double));
+                        dxf_memory_stats_add_slack (record, mline->number_of_parameters, DXF_MAX_PARAM, sizeof (double));
+                        dxf_memory_stats_add_slack (record, mline->number_of_area_fill_parameters, DXF_MAX_PARAM, sizeof (double));
+                        next = mline->next;
+                        break;
+                }
+                default:
+                        record->number_of_objects--;
+                        break;
+        }
+        return (next);
+}
+
+
+/*!
+ * \brief Account the memory of one symbol table entry.
+ *
+ * \return a pointer to the next entry in the symbol table of \c entry,
+ * or \c NULL.
+ */
+static void *
+dxf_memory_stats_account_table_entry
+(
+        DxfMemoryStatsRecord *record,
+                /*!< the record to account in. */
+        int type,
+                /*!< type of the entry, a \c DxfObjectType value. */
+        void *entry
+                /*!< a pointer to the symbol table entry. */
+)
+{
+        void *next = NULL;
+
+        record->number_of_objects++;
+        switch (type)
+        {
+                case APPID:
+                {
+                        DxfAppid *appid = (DxfAppid *) entry;
+
+                        record->struct_bytes += sizeof (DxfAppid);
+                        dxf_memory_stats_add_string (record, appid->application_name);
+                        dxf_memory_stats_add_string (record, appid->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, appid->dictionary_owner_hard);
+                        next = appid->next;
+                        break;
+                }
+                case BLOCK_RECORD:
+                {
+                        DxfBlockRecord *block_record = (DxfBlockRecord *) entry;
+
+                        record->struct_bytes += sizeof (DxfBlockRecord);
+                        dxf_memory_stats_add_string (record, block_record->block_name);
+                        dxf_memory_stats_add_string (record, block_record->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, block_record->dictionary_owner_hard);
+                        next = block_record->next;
+                        break;
+                }
+                case DIMSTYLE:
+                {
+                        DxfDimStyle *dimstyle = (DxfDimStyle *) entry;
+
+                        record->struct_bytes += sizeof (DxfDimStyle);
+                        dxf_memory_stats_add_string (record, dimstyle->dimstyle_name);
+                        dxf_memory_stats_add_string (record, dimstyle->dimpost);
+                        dxf_memory_stats_add_string (record, dimstyle->dimapost);
+                        dxf_memory_stats_add_string (record, dimstyle->dimblk);
+                        dxf_memory_stats_add_string (record, dimstyle->dimblk1);
+                        dxf_memory_stats_add_string (record, dimstyle->dimblk2);
+                        dxf_memory_stats_add_string (record, dimstyle->dimtxsty);
+                        next = dimstyle->next;
+                        break;
+                }
+                case LAYER:
+                {
+                        DxfLayer *layer = (DxfLayer *) entry;
+
+                        record->struct_bytes += sizeof (DxfLayer);
+                        dxf_memory_stats_add_string (record, layer->layer_name);
+                        dxf_memory_stats_add_string (record, layer->linetype);
+                        dxf_memory_stats_add_string (record, layer->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, layer->material);
+                        dxf_memory_stats_add_string (record, layer->dictionary_owner_hard);
+                        dxf_memory_stats_add_string (record, layer->plot_style_name);
+                        next = layer->next;
+                        break;
+                }
+                case LTYPE:
+                {
+                        DxfLType *ltype = (DxfLType *) entry;
+
+                        record->struct_bytes += sizeof (DxfLType);
+                        dxf_memory_stats_add_string (record, ltype->linetype_name);
+                        dxf_memory_stats_add_string (record, ltype->description);
+                        dxf_memory_stats_add_string (record, ltype->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, ltype->dictionary_owner_hard);
+                        dxf_memory_stats_add_strings (record, ltype->complex_text_string, DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS);
+                        dxf_memory_stats_add_strings (record, ltype->complex_style_pointer, DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS);
+                        next = ltype->next;
+                        break;
+                }
+                case STYLE:
+                {
+                        DxfStyle *style = (DxfStyle *) entry;
+
+                        record->struct_bytes += sizeof (DxfStyle);
+                        dxf_memory_stats_add_string (record, style->style_name);
+                        dxf_memory_stats_add_string (record, style->primary_font_filename);
+                        dxf_memory_stats_add_string (record, style->big_font_filename);
+                        dxf_memory_stats_add_string (record, style->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, style->dictionary_owner_hard);
+                        next = style->next;
+                        break;
+                }
+                case UCS:
+                {
+                        DxfUcs *ucs = (DxfUcs *) entry;
+
+                        record->struct_bytes += sizeof (DxfUcs);
+                        dxf_memory_stats_add_string (record, ucs->UCS_name);
+                        dxf_memory_stats_add_string (record, ucs->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, ucs->dictionary_owner_hard);
+                        next = ucs->next;
+                        break;
+                }
+                case VIEW:
+                {
+                        DxfView *view = (DxfView *) entry;
+
+                        record->struct_bytes += sizeof (DxfView);
+                        dxf_memory_stats_add_string (record, view->view_name);
+                        dxf_memory_stats_add_string (record, view->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, view->dictionary_owner_hard);
+                        next = view->next;
+                        break;
+                }
+                case VPORT:
+                {
+                        DxfVPort *vport = (DxfVPort *) entry;
+
+                        record->struct_bytes += sizeof (DxfVPort);
+                        dxf_memory_stats_add_string (record, vport->viewport_name);
+                        dxf_memory_stats_add_string (record, vport->dictionary_owner_soft);
+                        dxf_memory_stats_add_string (record, vport->dictionary_owner_hard);
+                        next = vport->next;
+                        break;
+                }
+                default:
+                        record->number_of_objects--;
+                        break;
+        }
+        return (next);
+}
+
+
+/*!
+ * \brief Add a record to another record.
+ */
+static void
+dxf_memory_stats_add_record
+(
+        DxfMemoryStatsRecord *record,
+                /*!< the record to add to. */
+        DxfMemoryStatsRecord *other
+                /*!< the record to add. */
+)
+{
+        record->number_of_objects += other->number_of_objects;
+        record->struct_bytes += other->struct_bytes;
+        record->string_bytes += other->string_bytes;
+        record->sub_record_bytes += other->sub_record_bytes;
+        record->slack_bytes += other->slack_bytes;
+}
+
+
+/*!
+ * \brief Account the memory of an entity in the memory accounting of a
+ * drawing.
+ *
+ * Only \c entity itself is accounted, not the entities following it.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_memory_stats_add_entity
+(
+        DxfMemoryStats *stats,
+                /*!< a pointer to the memory accounting. */
+        int type,
+                /*!< type of the entity, a \c DxfEntityType value. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((stats == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((type < 0) || (type >= DXF_MEMORY_STATS_NUMBER_OF_ENTITY_TYPES))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () received an invalid value in type.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_memory_stats_account_entity (&stats->entity[type], type, entity);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of bytes accounted in a record.
+ *
+ * \return the sum of the struct, string and sub-record bytes (slack is
+ * part of these), or 0 when an error occurred.
+ */
+size_t
+dxf_memory_stats_get_bytes
+(
+        DxfMemoryStatsRecord *record
+                /*!< a pointer to a memory accounting record. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (record == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (record->struct_bytes + record->string_bytes + record->sub_record_bytes);
+}
+
+
+/*!
+ * \brief Account the memory used by a libDXF drawing.
+ *
+ * Fills \c stats with the bytes per entity type and per section of the
+ * drawing.\n
+ * The entities are taken from the entity container of the drawing
+ * (see \c dxf_drawing_append_entity()), or from the per type entity
+ * lists when the drawing has no entity container.\n
+ * Sizes are those requested from the allocator, so the results are
+ * the same for any allocator backend.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_memory_stats
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        DxfMemoryStats *stats
+                /*!< a pointer to the memory accounting, overwritten. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfMemoryStatsRecord *record = NULL;
+        DxfHeader *header = NULL;
+        DxfClass *class = NULL;
+        DxfTables *tables = NULL;
+        DxfBlock *block = NULL;
+        DxfEndblk *endblk = NULL;
+        DxfEntities *entities = NULL;
+        DxfObject *object = NULL;
+        DxfThumbnail *thumbnail = NULL;
+        DxfIntern *intern = NULL;
+        DxfHandleTable *handle_table = NULL;
+        DxfChunkListIter iter;
+        DxfDrawingEntity *entry_entity = NULL;
+        DxfParam unused_parameter;
+        void *lists[DXF_MEMORY_STATS_NUMBER_OF_ENTITY_TYPES];
+        void *entry = NULL;
+        int i;
+
+        /* Do some basic checks. */
+        if ((drawing == NULL) || (stats == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (stats, 0, sizeof (DxfMemoryStats));
+        /* HEADER section. */
+        header = (DxfHeader *) drawing->header;
+        if (header != NULL)
+        {
+                record = &stats->section[DXF_MEMORY_STATS_HEADER];
+                record->number_of_objects = 1;
+                record->struct_bytes += sizeof (DxfHeader);
+                dxf_memory_stats_add_string (record, header->AcadVer);
+                dxf_memory_stats_add_string (record, header->DWGCodePage);
+                dxf_memory_stats_add_string (record, header->TextStyle);
+                dxf_memory_stats_add_string (record, header->CLayer);
+                dxf_memory_stats_add_string (record, header->CELType);
+                dxf_memory_stats_add_string (record, header->DimBLK);
+                dxf_memory_stats_add_string (record, header->DimPOST);
+                dxf_memory_stats_add_string (record, header->DimAPOST);
+                dxf_memory_stats_add_string (record, header->DimBLK1);
+                dxf_memory_stats_add_string (record, header->DimBLK2);
+                dxf_memory_stats_add_string (record, header->DimSTYLE);
+                dxf_memory_stats_add_string (record, header->DimTXSTY);
+                dxf_memory_stats_add_string (record, header->DimLDRBLK);
+                dxf_memory_stats_add_string (record, header->Menu);
+                dxf_memory_stats_add_string (record, header->HandSeed);
+                dxf_memory_stats_add_string (record, header->UCSBase);
+                dxf_memory_stats_add_string (record, header->UCSName);
+                dxf_memory_stats_add_string (record, header->UCSOrthoRef);
+                dxf_memory_stats_add_string (record, header->PUCSBase);
+                dxf_memory_stats_add_string (record, header->PUCSName);
+                dxf_memory_stats_add_string (record, header->PUCSOrthoRef);
+                dxf_memory_stats_add_string (record, header->CMLStyle);
+                dxf_memory_stats_add_string (record, header->HyperLinkBase);
+                dxf_memory_stats_add_string (record, header->StyleSheet);
+                dxf_memory_stats_add_string (record, header->FingerPrintGUID);
+                dxf_memory_stats_add_string (record, header->VersionGUID);
+                dxf_memory_stats_add_string (record, header->ProjectName);
+        }
+        /* CLASSES section. */
+        record = &stats->section[DXF_MEMORY_STATS_CLASSES];
+        for (class = (DxfClass *) drawing->class_list; class != NULL; class = (DxfClass *) class->next)
+        {
+                record->number_of_objects++;
+                record->struct_bytes += sizeof (DxfClass);
+                dxf_memory_stats_add_string (record, class->record_type);
+                dxf_memory_stats_add_string (record, class->record_name);
+                dxf_memory_stats_add_string (record, class->class_name);
+                dxf_memory_stats_add_string (record, class->app_name);
+        }
+        /* TABLES section. */
+        tables = (DxfTables *) drawing->tables_list;
+        if (tables != NULL)
+        {
+                record = &stats->section[DXF_MEMORY_STATS_TABLES];
+                record->struct_bytes += sizeof (DxfTables);
+                for (entry = tables->appids; entry != NULL;)
+                {
+                        entry = dxf_memory_stats_account_table_entry (record, APPID, entry);
+                }
+                for (entry = tables->block_records; entry != NULL;)
+                {
+                        entry = dxf_memory_stats_account_table_entry (record, BLOCK_RECORD, entry);
+                }
+                for (entry = tables->dimstyles; entry != NULL;)
+                {
+                        entry = dxf_memory_stats_account_table_entry (record, DIMSTYLE, entry);
+                }
+                for (entry = tables->layers; entry != NULL;)
+                {
+                        entry = dxf_memory_stats_account_table_entry (record, LAYER, entry);
+                }
+                for (entry = tables->ltypes; entry != NULL;)
+                {
+                        entry = dxf_memory_stats_account_table_entry (record, LTYPE, entry);
+                }
+                for (entry = tables->styles; entry != NULL;)
+                {
+                        entry = dxf_memory_stats_account_table_entry (record, STYLE, entry);
+                }
+                for (entry = tables->ucss; entry != NULL;)
+                {
+                        entry = dxf_memory_stats_account_table_entry (record, UCS, entry);
+                }
+                for (entry = tables->views; entry != NULL;)
+                {
+                        entry = dxf_memory_stats_account_table_entry (record, VIEW, entry);
+                }
+                for (entry = tables->vports; entry != NULL;)
+                {
+                        entry = dxf_memory_stats_account_table_entry (record, VPORT, entry);
+                }
+        }
+        /* BLOCKS section. */
+        record = &stats->section[DXF_MEMORY_STATS_BLOCKS];
+        for (block = (DxfBlock *) drawing->block_list; block != NULL; block = (DxfBlock *) block->next)
+        {
+                record->number_of_objects++;
+                record->struct_bytes += sizeof (DxfBlock);
+                dxf_memory_stats_add_string (record, block->xref_name);
+                dxf_memory_stats_add_string (record, block->block_name);
+                dxf_memory_stats_add_string (record, block->block_name_additional);
+                dxf_memory_stats_add_string (record, block->description);
+                dxf_memory_stats_add_string (record, block->layer);
+                dxf_memory_stats_add_string (record, block->dictionary_owner_soft);
+                endblk = (DxfEndblk *) block->endblk;
+                if (endblk != NULL)
+                {
+                        record->sub_record_bytes += sizeof (DxfEndblk);
+                        dxf_memory_stats_add_string (record, endblk->layer);
+                        dxf_memory_stats_add_string (record, endblk->dictionary_owner_soft);
+                }
+        }
+        /* ENTITIES section. */
+        if (drawing->entities != NULL)
+        {
+                dxf_chunk_list_iter_init ((DxfChunkList *) drawing->entities, &iter);
+                while ((entry_entity = (DxfDrawingEntity *) dxf_chunk_list_iter_next (&iter)) != NULL)
+                {
+                        if ((entry_entity->type >= 0)
+                          && (entry_entity->type < DXF_MEMORY_STATS_NUMBER_OF_ENTITY_TYPES))
+                        {
+                                dxf_memory_stats_account_entity (&stats->entity[entry_entity->type],
+                                  entry_entity->type, entry_entity->entity);
+                        }
+                }
+        }
+        else if (drawing->entities_list != NULL)
+        {
+                entities = (DxfEntities *) drawing->entities_list;
+                memset (lists, 0, sizeof (lists));
+                lists[DFACE] = entities->dface_list;
+                lists[DSOLID] = entities->dsolid_list;
+                lists[ACADPROXYENTITY] = entities->acad_proxy_entity_list;
+                lists[ARC] = entities->arc_list;
+                lists[ATTDEF] = entities->attdef_list;
+                lists[ATTRIB] = entities->attrib_list;
+                lists[BODY] = entities->body_list;
+                lists[CIRCLE] = entities->circle_list;
+                lists[DIMENSION] = entities->dimension_list;
+                lists[ELLIPSE] = entities->ellipse_list;
+                lists[HATCH] = entities->hatch_list;
+                lists[HELIX] = entities->helix_list;
+                lists[IMAGE] = entities->image_list;
+                lists[INSERT] = entities->insert_list;
+                lists[LEADER] = entities->leader_list;
+                lists[LINE] = entities->line_list;
+                lists[LWPOLYLINE] = entities->lw_polyline_list;
+                lists[UNKNOWN_ENTITY] = entities->mline_list;
+                lists[MTEXT] = entities->mtext_list;
+                lists[OLEFRAME] = entities->oleframe_list;
+                lists[OLE2FRAME] = entities->ole2frame_list;
+                lists[POINT] = entities->point_list;
+                lists[POLYLINE] = entities->polyline_list;
+                lists[RAY] = entities->ray_list;
+                lists[REGION] = entities->region_list;
+                lists[SHAPE] = entities->shape_list;
+                lists[SOLID] = entities->solid_list;
+                lists[SPLINE] = entities->spline_list;
+                lists[TABLE] = entities->table_list;
+                lists[TEXT] = entities->text_list;
+                lists[TOLERANCE] = entities->tolerance_list;
+                lists[TRACE] = entities->trace_list;
+                lists[VERTEX] = entities->vertex_list;
+                lists[VIEWPORT] = entities->viewport_list;
+                for (i = 0; i < DXF_MEMORY_STATS_NUMBER_OF_ENTITY_TYPES; i++)
+                {
+                        for (entry = lists[i]; entry != NULL;)
+                        {
+                                entry = dxf_memory_stats_account_entity (&stats->entity[i], i, entry);
+                        }
+                }
+        }
+        record = &stats->section[DXF_MEMORY_STATS_ENTITIES];
+        if (drawing->entities_list != NULL)
+        {
+                record->struct_bytes += sizeof (DxfEntities);
+        }
+        for (i = 0; i < DXF_MEMORY_STATS_NUMBER_OF_ENTITY_TYPES; i++)
+        {
+                dxf_memory_stats_add_record (record, &stats->entity[i]);
+        }
+        /* OBJECTS section, parameters which were never set are slack. */
+        record = &stats->section[DXF_MEMORY_STATS_OBJECTS];
+        memset (&unused_parameter, 0, sizeof (DxfParam));
+        for (object = (DxfObject *) drawing->object_list; object != NULL; object = (DxfObject *) object->next)
+        {
+                record->number_of_objects++;
+                record->struct_bytes += sizeof (DxfObject);
+                for (i = 0; i < DXF_MAX_PARAM; i++)
+                {
+                        if (memcmp (&object->parameter[i], &unused_parameter, sizeof (DxfParam)) == 0)
+                        {
+                                record->slack_bytes += sizeof (DxfParam);
+                        }
+                }
+        }
+        /* THUMBNAILIMAGE section. */
+        thumbnail = (DxfThumbnail *) drawing->thumbnail;
+        if (thumbnail != NULL)
+        {
+                record = &stats->section[DXF_MEMORY_STATS_THUMBNAIL];
+                record->number_of_objects = 1;
+                record->struct_bytes += sizeof (DxfThumbnail);
+                dxf_memory_stats_add_strings (record, thumbnail->preview_image_data, DXF_MAX_PARAM);
+        }
+        /* Intern table, handle table and entity container. */
+        record = &stats->section[DXF_MEMORY_STATS_INDEX];
+        intern = (DxfIntern *) drawing->intern;
+        if (intern != NULL)
+        {
+                record->number_of_objects++;
+                record->struct_bytes += sizeof (DxfIntern);
+                record->string_bytes += intern->string_bytes;
+                record->sub_record_bytes += (size_t) intern->strings_size * (sizeof (char *) + sizeof (uint32_t))
+                  + (size_t) intern->number_of_slots * sizeof (int32_t);
+                dxf_memory_stats_add_slack (record, intern->number_of_strings,
+                  intern->strings_size, sizeof (char *) + sizeof (uint32_t));
+                dxf_memory_stats_add_slack (record, intern->number_of_strings,
+                  intern->number_of_slots, sizeof (int32_t));
+        }
+        handle_table = (DxfHandleTable *) drawing->handle_table;
+        if (handle_table != NULL)
+        {
+                record->number_of_objects++;
+                record->struct_bytes += sizeof (DxfHandleTable);
+                record->sub_record_bytes += (size_t) handle_table->number_of_slots * sizeof (DxfHandleTableEntry);
+                dxf_memory_stats_add_slack (record, handle_table->number_of_entries,
+                  handle_table->number_of_slots, sizeof (DxfHandleTableEntry));
+        }
+        if (drawing->entities != NULL)
+        {
+                record->number_of_objects++;
+                dxf_memory_stats_add_chunk_list (record, (DxfChunkList *) drawing->entities);
+        }
+        for (i = 0; i < DXF_MEMORY_STATS_NUMBER_OF_SECTIONS; i++)
+        {
+                dxf_memory_stats_add_record (&stats->total, &stats->section[i]);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write the memory accounting of a drawing as a table.
+ *
+ * Entity types without entities are omitted.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_memory_stats_write
+(
+        FILE *fp,
+                /*!< a file pointer to an output file (or device). */
+        DxfMemoryStats *stats
+                /*!< a pointer to the memory accounting. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const char *section_names[DXF_MEMORY_STATS_NUMBER_OF_SECTIONS] =
+        {
+                "HEADER",
+                "CLASSES",
+                "TABLES",
+                "BLOCKS",
+                "ENTITIES",
+                "OBJECTS",
+                "THUMBNAILIMAGE",
+                "INDEX"
+        };
+        DxfMemoryStatsRecord *record = NULL;
+        int i;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (stats == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fprintf (fp, "%-16s %10s %12s %12s %12s %12s\n",
+          "", "objects", "struct", "string", "sub-record", "slack");
+        for (i = 0; i < DXF_MEMORY_STATS_NUMBER_OF_ENTITY_TYPES; i++)
+        {
+                record = &stats->entity[i];
+                if (record->number_of_objects == 0)
+                {
+                        continue;
+                }
+                fprintf (fp, "entity %-9d %10d %12lu %12lu %12lu %12lu\n",
+                  i, record->number_of_objects,
+                  (unsigned long) record->struct_bytes,
+                  (unsigned long) record->string_bytes,
+                  (unsigned long) record->sub_record_bytes,
+                  (unsigned long) record->slack_bytes);
+        }
+        for (i = 0; i <= DXF_MEMORY_STATS_NUMBER_OF_SECTIONS; i++)
+        {
+                record = (i < DXF_MEMORY_STATS_NUMBER_OF_SECTIONS)
+                  ? &stats->section[i]
+                  : &stats->total;
+                fprintf (fp, "%-16s %10d %12lu %12lu %12lu %12lu\n",
+                  (i < DXF_MEMORY_STATS_NUMBER_OF_SECTIONS)
+                    ? section_names[i]
+                    : "total",
+                  record->number_of_objects,
+                  (unsigned long) record->struct_bytes,
+                  (unsigned long) record->string_bytes,
+                  (unsigned long) record->sub_record_bytes,
+                  (unsigned long) record->slack_bytes);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
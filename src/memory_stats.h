@@ -0,0 +1,198 @@
+/*!
+ * \file memory_stats.h
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Header file for memory accounting of a libDXF drawing.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_MEMORY_STATS_H
+#define LIBDXF_SRC_MEMORY_STATS_H
+
+
+#include "global.h"
+#include "drawing.h"
+#include "entity.h"
+#include "3dface.h"
+#include "3dsolid.h"
+#include "acad_proxy_entity.h"
+#include "arc.h"
+#include "attdef.h"
+#include "attrib.h"
+#include "body.h"
+#include "circle.h"
+#include "dimension.h"
+#include "ellipse.h"
+#include "hatch.h"
+#include "helix.h"
+#include "image.h"
+#include "insert.h"
+#include "leader.h"
+#include "line.h"
+#include "lwpolyline.h"
+#include "mline.h"
+#include "mtext.h"
+#include "oleframe.h"
+#include "ole2frame.h"
+#include "point.h"
+#include "polyline.h"
+#include "ray.h"
+#include "region.h"
+#include "shape.h"
+#include "solid.h"
+#include "spline.h"
+#include "table.h"
+#include "text.h"
+#include "tolerance.h"
+#include "trace.h"
+#include "vertex.h"
+#include "viewport.h"
+#include "appid.h"
+#include "block_record.h"
+#include "dimstyle.h"
+#include "layer.h"
+#include "ltype.h"
+#include "style.h"
+#include "ucs.h"
+#include "view.h"
+#include "vport.h"
+#include "endblk.h"
+
+
+#define DXF_MEMORY_STATS_NUMBER_OF_ENTITY_TYPES (XLINE + 1)
+        /*!< \brief The number of \c DxfEntityType values, the size of
+         * the per entity type table in \c DxfMemoryStats. */
+
+
+/*!
+ * \brief Sections of a drawing accounted by \c dxf_drawing_memory_stats().
+ */
+typedef enum
+dxf_memory_stats_section
+{
+        DXF_MEMORY_STATS_HEADER,
+                /*!< The \c HEADER section. */
+        DXF_MEMORY_STATS_CLASSES,
+                /*!< The \c CLASSES section. */
+        DXF_MEMORY_STATS_TABLES,
+                /*!< The \c TABLES section. */
+        DXF_MEMORY_STATS_BLOCKS,
+                /*!< The \c BLOCKS section. */
+        DXF_MEMORY_STATS_ENTITIES,
+                /*!< The \c ENTITIES section. */
+        DXF_MEMORY_STATS_OBJECTS,
+                /*!< The \c OBJECTS section. */
+        DXF_MEMORY_STATS_THUMBNAIL,
+                /*!< The \c THUMBNAILIMAGE section. */
+        DXF_MEMORY_STATS_INDEX,
+                /*!< The intern table, handle table and entity container
+                 * of the drawing. */
+        DXF_MEMORY_STATS_NUMBER_OF_SECTIONS
+                /*!< The number of sections, not a section. */
+} DxfMemoryStatsSection;
+
+
+/*!
+ * \brief Memory accounted for a group of libDXF structs.
+ *
+ * Sizes are the number of bytes requested from the allocator, so they
+ * do not depend on the allocator used and do not contain its overhead.
+ */
+typedef struct
+dxf_memory_stats_record
+{
+        int number_of_objects;
+                /*!< Number of entities, table entries or records. */
+        size_t struct_bytes;
+                /*!< Bytes in the structs themselves. */
+        size_t string_bytes;
+                /*!< Bytes in strings owned by the structs, including the
+                 * terminating \c NUL characters.\n
+                 * Strings in a registered \c DxfIntern table are
+                 * accounted once, in the \c DXF_MEMORY_STATS_INDEX
+                 * section. */
+        size_t sub_record_bytes;
+                /*!< Bytes in arrays and linked records owned by the
+                 * structs (vertices, boundary paths, knots, ...). */
+        size_t slack_bytes;
+                /*!< Bytes allocated but not in use, such as the unused
+                 * entries of \c DXF_MAX_PARAM arrays or the unused
+                 * capacity of growable arrays.\n
+                 * These bytes are part of \c struct_bytes or
+                 * \c sub_record_bytes. */
+} DxfMemoryStatsRecord;
+
+
+/*!
+ * \brief Memory accounting of a libDXF drawing.
+ */
+typedef struct
+dxf_memory_stats
+{
+        DxfMemoryStatsRecord entity[DXF_MEMORY_STATS_NUMBER_OF_ENTITY_TYPES];
+                /*!< Entities per \c DxfEntityType value.\n
+                 * Entities without a \c DxfEntityType value (\c MLINE)
+                 * are accounted in \c UNKNOWN_ENTITY. */
+        DxfMemoryStatsRecord section[DXF_MEMORY_STATS_NUMBER_OF_SECTIONS];
+                /*!< Per section of the drawing. */
+        DxfMemoryStatsRecord total;
+                /*!< The sum of all sections. */
+} DxfMemoryStats;
+
+
+int
+dxf_memory_stats_add_entity
+(
+        DxfMemoryStats *stats,
+        int type,
+        void *entity
+);
+size_t
+dxf_memory_stats_get_bytes
+(
+        DxfMemoryStatsRecord *record
+);
+int
+dxf_drawing_memory_stats
+(
+        DxfDrawing *drawing,
+        DxfMemoryStats *stats
+);
+int
+dxf_memory_stats_write
+(
+        FILE *fp,
+        DxfMemoryStats *stats
+);
+
+
+#endif /* LIBDXF_SRC_MEMORY_STATS_H */
+
+
+/* EOF */
@@ -35,6 +35,8 @@
 
 
 #include "mline.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -210,7 +212,7 @@ dxf_mline_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (mline == NULL)
@@ -226,9 +228,10 @@ dxf_mline_read
         k = 0;
         l = 0;
         m = 0;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -237,7 +240,7 @@ dxf_mline_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "2") == 0)
@@ -246,9 +249,9 @@ dxf_mline_read
                          * up to 32 characters with the name of the
                          * style used for this mline. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mline->style_name);
+                        mline->style_name = dxf_read_string (fp, mline->style_name);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -260,13 +263,13 @@ dxf_mline_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mline->linetype);
+                        mline->linetype = dxf_read_string (fp, mline->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mline->layer);
+                        mline->layer = dxf_read_string (fp, mline->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -521,21 +524,21 @@ dxf_mline_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mline->dictionary_owner_soft);
+                        mline->dictionary_owner_soft = dxf_read_string (fp, mline->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "340") == 0)
                 {
                         /* Now follows a string containing a
                          * Pointer-handle/ID of MLINESTYLE dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mline->mlinestyle_dictionary);
+                        mline->mlinestyle_dictionary = dxf_read_string (fp, mline->mlinestyle_dictionary);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mline->dictionary_owner_hard);
+                        mline->dictionary_owner_hard = dxf_read_string (fp, mline->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -549,7 +552,13 @@ dxf_mline_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (mline->linetype, "") == 0)
@@ -561,7 +570,7 @@ dxf_mline_read
                 mline->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -602,6 +611,8 @@ dxf_mline_write
 #endif
         char *dxf_entity_name = strdup ("MLINE");
         int i;
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -636,7 +647,8 @@ dxf_mline_write
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, mline->id_code);
         }
-        if (strcmp (mline->linetype, "") == 0)
+        linetype = mline->linetype;
+        if (strcmp (linetype, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -644,9 +656,10 @@ dxf_mline_write
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                mline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = DXF_DEFAULT_LINETYPE;
         }
-        if (strcmp (mline->layer, "") == 0)
+        layer = mline->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -654,7 +667,7 @@ dxf_mline_write
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                mline->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -694,10 +707,10 @@ dxf_mline_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", mline->layer);
-        if (strcmp (mline->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (strcmp (linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", mline->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
@@ -35,6 +35,8 @@
 
 
 #include "mlinestyle.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -184,7 +186,7 @@ dxf_mlinestyle_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -202,9 +204,10 @@ dxf_mlinestyle_read
                 mlinestyle = dxf_mlinestyle_init (mlinestyle);
         }
         i = 0;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -212,7 +215,7 @@ dxf_mlinestyle_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -221,23 +224,23 @@ dxf_mlinestyle_read
                         /* Now follows a string containing a mlinestyle
                          * name string. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mlinestyle->name);
+                        mlinestyle->name = dxf_read_string (fp, mlinestyle->name);
                 }
-                if (strcmp (temp_string, "3") == 0)
+                else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a description
                          * string. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mlinestyle->description);
+                        mlinestyle->description = dxf_read_string (fp, mlinestyle->description);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%x\n", &mlinestyle->id_code);
                 }
-                if (strcmp (temp_string, "6") == 0)
+                else if (strcmp (temp_string, "6") == 0)
                 {
                         /* Now follows a string containing an element
                          * linetype. */
@@ -245,21 +248,21 @@ dxf_mlinestyle_read
                         fscanf (fp->fp, "%s\n", mlinestyle->element_linetype[i]);
                         i++;
                 }
-                if (strcmp (temp_string, "49") == 0)
+                else if (strcmp (temp_string, "49") == 0)
                 {
                         /* Now follows a string containing an element
                          * offset value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &mlinestyle->element_offset[i]);
                 }
-                if (strcmp (temp_string, "51") == 0)
+                else if (strcmp (temp_string, "51") == 0)
                 {
                         /* Now follows a string containing a start angle
                          * value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &mlinestyle->start_angle);
                 }
-                if (strcmp (temp_string, "52") == 0)
+                else if (strcmp (temp_string, "52") == 0)
                 {
                         /* Now follows a string containing a end angle
                          * value. */
@@ -283,14 +286,14 @@ dxf_mlinestyle_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &mlinestyle->element_color[i]);
                 }
-                if (strcmp (temp_string, "70") == 0)
+                else if (strcmp (temp_string, "70") == 0)
                 {
                         /* Now follows a string containing a flags
                          * value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &mlinestyle->flags);
                 }
-                if (strcmp (temp_string, "71") == 0)
+                else if (strcmp (temp_string, "71") == 0)
                 {
                         /* Now follows a string containing a number of
                          * elements value. */
@@ -316,14 +319,14 @@ dxf_mlinestyle_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mlinestyle->dictionary_owner_soft);
+                        mlinestyle->dictionary_owner_soft = dxf_read_string (fp, mlinestyle->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mlinestyle->dictionary_owner_hard);
+                        mlinestyle->dictionary_owner_hard = dxf_read_string (fp, mlinestyle->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -337,10 +340,16 @@ dxf_mlinestyle_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -33,6 +33,8 @@
 
 
 #include "mtext.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -117,13 +119,15 @@ dxf_mtext_init
         }
         mtext->id_code = 0;
         mtext->text_value = strdup ("");
-        for (i = 1; i < DXF_MAX_PARAM; i++)
+        for (i = 0; i < DXF_MAX_PARAM; i++)
         {
                 mtext->text_additional_value[i] = strdup ("");
         }
         mtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
         mtext->text_style = strdup ("");
         mtext->layer = strdup (DXF_DEFAULT_LAYER);
+        mtext->dictionary_owner_soft = strdup ("");
+        mtext->dictionary_owner_hard = strdup ("");
         mtext->x0 = 0.0;
         mtext->y0 = 0.0;
         mtext->z0 = 0.0;
@@ -158,6 +162,7 @@ dxf_mtext_init
         mtext->extr_z0 = 0.0;
         mtext->background_color_rgb = 0;
         mtext->background_color_name = strdup ("");
+        mtext->intern = NULL;
         mtext->background_transparency = 0;
 #if DEBUG
         DXF_DEBUG_END
@@ -205,7 +210,7 @@ dxf_mtext_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (mtext == NULL)
@@ -216,9 +221,13 @@ dxf_mtext_read
                 mtext = dxf_mtext_new ();
                 mtext = dxf_mtext_init (mtext);
         }
+        /* The symbol names are interned in the intern table of the
+         * file. */
+        mtext->intern = fp->intern;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -227,19 +236,22 @@ dxf_mtext_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing a text value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mtext->text_value);
+                        mtext->text_value = dxf_read_string (fp, mtext->text_value);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a text value. */
                         (fp->line_number)++;
+                        /*! \todo Store the additional text values,
+                         * skip them for now. */
+                        dxf_read_group_code (fp, temp_string);
                         //fscanf (fp->fp, "%s\n", mtext->text_additional_value[number_additional]);
                         //number_additional++;
                 }
@@ -256,20 +268,20 @@ dxf_mtext_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mtext->linetype);
+                        mtext->linetype = dxf_intern_read_string (fp, mtext->linetype);
                 }
                 else if (strcmp (temp_string, "7") == 0)
                 {
                         /* Now follows a string containing a text style
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mtext->text_style);
+                        mtext->text_style = dxf_intern_read_string (fp, mtext->text_style);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mtext->layer);
+                        mtext->layer = dxf_intern_read_string (fp, mtext->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -379,6 +391,7 @@ dxf_mtext_read
                          * rotation angle or column heights. */
                         (fp->line_number)++;
                 /*!< Add more code here, I'm stop because the double use of group code 50*/
+                        fscanf (fp->fp, "%lf\n", &mtext->rot_angle);
                 }
                 else if (strcmp (temp_string, "63") == 0)
                 {
@@ -492,23 +505,42 @@ dxf_mtext_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
+        /* Symbol names not found in the file are still the copies
+         * made by the init function. */
+        mtext->linetype = dxf_intern_adopt_string ((DxfIntern *) mtext->intern, mtext->linetype);
+        mtext->layer = dxf_intern_adopt_string ((DxfIntern *) mtext->intern, mtext->layer);
+        mtext->text_style = dxf_intern_adopt_string ((DxfIntern *) mtext->intern, mtext->text_style);
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (mtext->linetype, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) mtext->intern, mtext->linetype, DXF_INTERN_ID_EMPTY))
         {
-                mtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_intern_free_string ((DxfIntern *) mtext->intern, mtext->linetype);
+                mtext->linetype = dxf_intern_string ((DxfIntern *) mtext->intern, DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (mtext->layer, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) mtext->intern, mtext->layer, DXF_INTERN_ID_EMPTY))
         {
-                mtext->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_intern_free_string ((DxfIntern *) mtext->intern, mtext->layer);
+                mtext->layer = dxf_intern_string ((DxfIntern *) mtext->intern, DXF_DEFAULT_LAYER);
+        }
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (mtext->id_code > 0))
+        {
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) mtext->id_code, MTEXT, mtext);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (mtext);
 }
 
 
@@ -545,6 +577,8 @@ dxf_mtext_write
 #endif
         char *dxf_entity_name = strdup ("MTEXT");
         int i;
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -579,7 +613,8 @@ dxf_mtext_write
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, mtext->id_code);
         }
-        if (strcmp (mtext->linetype, "") == 0)
+        linetype = mtext->linetype;
+        if (dxf_intern_is_symbol ((DxfIntern *) mtext->intern, linetype, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -587,9 +622,10 @@ dxf_mtext_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                mtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = dxf_intern_get_symbol ((DxfIntern *) mtext->intern, DXF_INTERN_ID_DEFAULT_LINETYPE);
         }
-        if (strcmp (mtext->layer, "") == 0)
+        layer = mtext->layer;
+        if (dxf_intern_is_symbol ((DxfIntern *) mtext->intern, layer, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -597,7 +633,7 @@ dxf_mtext_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                mtext->layer = DXF_DEFAULT_LAYER;
+                layer = dxf_intern_get_symbol ((DxfIntern *) mtext->intern, DXF_INTERN_ID_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -637,10 +673,10 @@ dxf_mtext_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", mtext->layer);
-        if (strcmp (mtext->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (!dxf_intern_is_symbol ((DxfIntern *) mtext->intern, linetype, DXF_INTERN_ID_DEFAULT_LINETYPE))
         {
-                fprintf (fp->fp, "  6\n%s\n", mtext->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if (mtext->color != DXF_COLOR_BYLAYER)
         {
@@ -677,7 +713,8 @@ dxf_mtext_write
         fprintf (fp->fp, " 72\n%d\n", mtext->drawing_direction);
         fprintf (fp->fp, "  1\n%s\n", mtext->text_value);
         i = 0;
-        while (strlen (mtext->text_additional_value[i]) > 0)
+        while ((i < DXF_MAX_PARAM)
+          && (strlen (mtext->text_additional_value[i]) > 0))
         {
                 fprintf (fp->fp, "  3\n%s\n", mtext->text_additional_value[i]);
                 i++;
@@ -740,14 +777,14 @@ dxf_mtext_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (mtext->linetype);
-        free (mtext->layer);
+        dxf_intern_free_string ((DxfIntern *) mtext->intern, mtext->linetype);
+        dxf_intern_free_string ((DxfIntern *) mtext->intern, mtext->layer);
         free (mtext->text_value);
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
                 free (mtext->text_additional_value[i]);
         }
-        free (mtext->text_style);
+        dxf_intern_free_string ((DxfIntern *) mtext->intern, mtext->text_style);
         free (mtext->dictionary_owner_soft);
         free (mtext->dictionary_owner_hard);
         free (mtext->background_color_name);
@@ -37,6 +37,8 @@
 
 
 #include "global.h"
+#include "intern.h"
+#include "handle_table.h"
 
 
 /*!
@@ -267,6 +269,11 @@ dxf_mtext
                 /*!< Transparency of background fill color.\n
                  * Not yet implemented in AutoCAD.\n
                  * Group code = 441. */
+        struct DxfIntern *intern;
+                /*!< Intern table holding the interned symbol names of
+                 * this entity, \c NULL when none are interned.\n
+                 * Symbol names not found in this table are private
+                 * copies. */
         struct DxfMtext *next;
                 /*!< pointer to the next DxfMtext.\n
                  * \c NULL in the last DxfMtext. */
@@ -0,0 +1,1475 @@
+/*!
+ * \file nurbs.c
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Functions for the evaluation of NURBS curves (splines and hatch spline edges).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "nurbs.h"
+
+
+/*!
+ * \brief A piece of a curve waiting to be bisected in
+ * \c dxf_nurbs_tessellate().
+ */
+typedef struct
+dxf_nurbs_piece
+{
+        double u;
+                /*!< Parameter of the end of the piece. */
+        DxfVec3 point;
+                /*!< Point at the end of the piece. */
+        int depth;
+                /*!< Number of bisections leading to the piece. */
+} DxfNurbsPiece;
+
+
+/*!
+ * \brief Release the control points and knots of a curve.
+ */
+static void
+dxf_nurbs_clear
+(
+        DxfNurbs *nurbs
+                /*!< the curve. */
+)
+{
+        free (nurbs->control_points);
+        free (nurbs->knots);
+        nurbs->control_points = NULL;
+        nurbs->knots = NULL;
+        nurbs->degree = 0;
+        nurbs->number_of_control_points = 0;
+        nurbs->rational = FALSE;
+}
+
+
+/*!
+ * \brief Set the curve of a \c DxfNurbs.
+ *
+ * A periodic curve with a knot vector of one period
+ * (\c number_of_control_points + 1 knots) is unrolled: the first
+ * \c degree control points are repeated at the end and the knot vector
+ * is extended with the knot spacing of the adjacent period on both
+ * sides.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the degree,
+ * the knots or the number of control points do not describe a curve or
+ * no memory could be allocated (\c control_points is freed).
+ */
+static int
+dxf_nurbs_set_curve
+(
+        DxfNurbs *nurbs,
+                /*!< the curve. */
+        int degree,
+                /*!< degree of the curve. */
+        double *control_points,
+                /*!< homogeneous control points, room for
+                 * \c number_of_control_points + \c degree entries
+                 * (taken over by the curve). */
+        int number_of_control_points,
+                /*!< number of control points. */
+        const double *knots,
+                /*!< knot values. */
+        int number_of_knots,
+                /*!< number of knot values. */
+        int periodic
+                /*!< \c TRUE for a periodic curve. */
+)
+{
+        double period;
+        int n = number_of_control_points;
+        int i;
+        int j;
+        int q;
+
+        dxf_nurbs_clear (nurbs);
+        if ((degree < 1) || (degree > DXF_SPLINE_MAX_DEGREE) || (n < 1) || (knots == NULL))
+        {
+                free (control_points);
+                return (EXIT_FAILURE);
+        }
+        if (periodic && (number_of_knots == n + 1) && (n > degree))
+        {
+                memcpy (control_points + 4 * n, control_points, 4 * degree * sizeof (double));
+                n += degree;
+        }
+        else if ((number_of_knots != n + degree + 1) || (n < degree + 1))
+        {
+                free (control_points);
+                return (EXIT_FAILURE);
+        }
+        nurbs->knots = malloc ((n + degree + 1) * sizeof (double));
+        if (nurbs->knots == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for knot values.\n")),
+                  __FUNCTION__);
+                free (control_points);
+                return (EXIT_FAILURE);
+        }
+        if (n == number_of_control_points)
+        {
+                memcpy (nurbs->knots, knots, number_of_knots * sizeof (double));
+        }
+        else
+        {
+                period = knots[number_of_control_points] - knots[0];
+                for (i = 0; i < n + degree + 1; i++)
+                {
+                        j = i - degree;
+                        q = (j < 0) ? -((-j + number_of_control_points - 1) / number_of_control_points)
+                          : j / number_of_control_points;
+                        j -= q * number_of_control_points;
+                        nurbs->knots[i] = knots[j] + q * period;
+                }
+        }
+        for (i = 0; i < n + degree; i++)
+        {
+                if (nurbs->knots[i] > nurbs->knots[i + 1])
+                {
+                        break;
+                }
+        }
+        if ((i < n + degree) || (nurbs->knots[degree] >= nurbs->knots[n]))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the knot values do not describe a curve.\n")),
+                  __FUNCTION__);
+                free (nurbs->knots);
+                nurbs->knots = NULL;
+                free (control_points);
+                return (EXIT_FAILURE);
+        }
+        nurbs->control_points = control_points;
+        nurbs->number_of_control_points = n;
+        nurbs->degree = degree;
+        nurbs->rational = FALSE;
+        for (i = 0; i < n; i++)
+        {
+                if (control_points[4 * i + 3] != 1.0)
+                {
+                        nurbs->rational = TRUE;
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find the knot span of a parameter.
+ *
+ * \return the index \c k of the (non empty) knot span
+ * <tt>[knots[k], knots[k + 1])</tt> holding \c u, clamped to the spans
+ * of the curve.
+ */
+static int
+dxf_nurbs_find_span
+(
+        DxfNurbs *nurbs,
+                /*!< the curve. */
+        double u
+                /*!< the parameter. */
+)
+{
+        const double *knots = nurbs->knots;
+        int n = nurbs->number_of_control_points;
+        int low = nurbs->degree;
+        int high = n;
+        int mid;
+
+        if (u >= knots[n])
+        {
+                mid = n - 1;
+                while ((mid > low) && (knots[mid] >= knots[mid + 1]))
+                {
+                        mid--;
+                }
+                return (mid);
+        }
+        if (u <= knots[low])
+        {
+                mid = low;
+                while ((mid < n - 1) && (knots[mid] >= knots[mid + 1]))
+                {
+                        mid++;
+                }
+                return (mid);
+        }
+        /* Bisect with knots[low] <= u < knots[high]. */
+        while (high - low > 1)
+        {
+                mid = (low + high) / 2;
+                if (u < knots[mid])
+                {
+                        high = mid;
+                }
+                else
+                {
+                        low = mid;
+                }
+        }
+        return (low);
+}
+
+
+/*!
+ * \brief Calculate a point and its derivatives in a knot span.
+ *
+ * The homogeneous point and derivatives are weighted sums of the
+ * control points of the span, the derivatives of the rational curve
+ * follow from the quotient rule.
+ */
+static void
+dxf_nurbs_evaluate
+(
+        DxfNurbs *nurbs,
+                /*!< the curve. */
+        int span,
+                /*!< the knot span holding \c u. */
+        double u,
+                /*!< the parameter. */
+        int number_of_derivatives,
+                /*!< number of derivatives, at most
+                 * \c DXF_NURBS_MAX_DERIVATIVES. */
+        DxfVec3 *derivatives
+                /*!< the point and its derivatives (output). */
+)
+{
+        double basis[DXF_NURBS_MAX_DERIVATIVES + 1][DXF_SPLINE_MAX_DEGREE + 1];
+        double a[DXF_NURBS_MAX_DERIVATIVES + 1][4];
+        const double *cp = NULL;
+        double w;
+        int p = nurbs->degree;
+        int k;
+        int r;
+
+        dxf_nurbs_calculate_basis (nurbs->knots, p, span, u, number_of_derivatives, basis);
+        cp = nurbs->control_points + 4 * (span - p);
+        for (k = 0; k <= number_of_derivatives; k++)
+        {
+                a[k][0] = 0.0;
+                a[k][1] = 0.0;
+                a[k][2] = 0.0;
+                a[k][3] = 0.0;
+                for (r = 0; r <= p; r++)
+                {
+                        a[k][0] += basis[k][r] * cp[4 * r];
+                        a[k][1] += basis[k][r] * cp[4 * r + 1];
+                        a[k][2] += basis[k][r] * cp[4 * r + 2];
+                        a[k][3] += basis[k][r] * cp[4 * r + 3];
+                }
+        }
+        w = a[0][3];
+        derivatives[0].x = a[0][0] / w;
+        derivatives[0].y = a[0][1] / w;
+        derivatives[0].z = a[0][2] / w;
+        if (number_of_derivatives >= 1)
+        {
+                derivatives[1].x = (a[1][0] - a[1][3] * derivatives[0].x) / w;
+                derivatives[1].y = (a[1][1] - a[1][3] * derivatives[0].y) / w;
+                derivatives[1].z = (a[1][2] - a[1][3] * derivatives[0].z) / w;
+        }
+        if (number_of_derivatives >= 2)
+        {
+                derivatives[2].x = (a[2][0] - 2.0 * a[1][3] * derivatives[1].x - a[2][3] * derivatives[0].x) / w;
+                derivatives[2].y = (a[2][1] - 2.0 * a[1][3] * derivatives[1].y - a[2][3] * derivatives[0].y) / w;
+                derivatives[2].z = (a[2][2] - 2.0 * a[1][3] * derivatives[1].z - a[2][3] * derivatives[0].z) / w;
+        }
+}
+
+
+/*!
+ * \brief Get the distance between a point and the chord of a piece of
+ * a curve.
+ *
+ * \return the distance.
+ */
+static double
+dxf_nurbs_get_chord_distance
+(
+        DxfVec3 start,
+                /*!< start point of the chord. */
+        DxfVec3 end,
+                /*!< end point of the chord. */
+        DxfVec3 point
+                /*!< the point. */
+)
+{
+        DxfVec3 nearest;
+        double t;
+
+        return (dxf_vec3_nearest_point_on_segment (start, end, point, &nearest, &t));
+}
+
+
+/*!
+ * \brief Estimate a derivative from the parabola through three points.
+ *
+ * The points are at parameters -h0, 0 and h1.
+ */
+static void
+dxf_nurbs_estimate_derivative
+(
+        DxfVec3 a,
+                /*!< the first point. */
+        DxfVec3 b,
+                /*!< the middle point. */
+        DxfVec3 c,
+                /*!< the last point. */
+        double h0,
+                /*!< parameter distance between \c a and \c b. */
+        double h1,
+                /*!< parameter distance between \c b and \c c. */
+        int at,
+                /*!< 0 for the derivative at \c a, 1 at \c b, 2 at
+                 * \c c. */
+        DxfVec3 *derivative
+                /*!< the derivative (output). */
+)
+{
+        DxfVec3 s0;
+        DxfVec3 s1;
+        double f;
+
+        s0.x = (b.x - a.x) / h0;
+        s0.y = (b.y - a.y) / h0;
+        s0.z = (b.z - a.z) / h0;
+        s1.x = (c.x - b.x) / h1;
+        s1.y = (c.y - b.y) / h1;
+        s1.z = (c.z - b.z) / h1;
+        if (at == 1)
+        {
+                derivative->x = (h1 * s0.x + h0 * s1.x) / (h0 + h1);
+                derivative->y = (h1 * s0.y + h0 * s1.y) / (h0 + h1);
+                derivative->z = (h1 * s0.z + h0 * s1.z) / (h0 + h1);
+        }
+        else if (at == 0)
+        {
+                f = h0 / (h0 + h1);
+                derivative->x = s0.x - f * (s1.x - s0.x);
+                derivative->y = s0.y - f * (s1.y - s0.y);
+                derivative->z = s0.z - f * (s1.z - s0.z);
+        }
+        else
+        {
+                f = h1 / (h0 + h1);
+                derivative->x = s1.x + f * (s1.x - s0.x);
+                derivative->y = s1.y + f * (s1.y - s0.y);
+                derivative->z = s1.z + f * (s1.z - s0.z);
+        }
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfNurbs.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfNurbs *
+dxf_nurbs_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfNurbs *nurbs = NULL;
+        size_t size;
+
+        size = sizeof (DxfNurbs);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((nurbs = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfNurbs struct.\n")),
+                  __FUNCTION__);
+                nurbs = NULL;
+        }
+        else
+        {
+                memset (nurbs, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (nurbs);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in an empty
+ * \c DxfNurbs.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfNurbs *
+dxf_nurbs_init
+(
+        DxfNurbs *nurbs
+                /*!< a pointer to the curve. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (nurbs == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                nurbs = dxf_nurbs_new ();
+        }
+        if (nurbs == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfNurbs struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        nurbs->degree = 0;
+        nurbs->number_of_control_points = 0;
+        nurbs->control_points = NULL;
+        nurbs->knots = NULL;
+        nurbs->rational = FALSE;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (nurbs);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfNurbs and its control
+ * points and knots.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_nurbs_free
+(
+        DxfNurbs *nurbs
+                /*!< a pointer to the memory occupied by the curve. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (nurbs == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_nurbs_clear (nurbs);
+        free (nurbs);
+        nurbs = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set a \c DxfNurbs to the curve of a DXF \c SPLINE entity.
+ *
+ * Weights are used for a rational spline (bit 4 of the spline flag),
+ * weights which are not positive count as 1.0.\n
+ * A periodic spline (bit 2 of the spline flag) may have a knot vector
+ * of one period.\n
+ * A spline without a valid set of control points and knots is
+ * interpolated through its fit points, with the start and end tangents
+ * when they are given (see \c dxf_nurbs_interpolate()).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the spline
+ * has no curve or an error occurred.
+ */
+int
+dxf_nurbs_set_spline
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the curve. */
+        DxfSpline *spline
+                /*!< a pointer to a DXF \c SPLINE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double *control_points = NULL;
+        DxfVec3 zero = {0.0, 0.0, 0.0};
+        double w;
+        int n;
+        int i;
+
+        /* Do some basic checks. */
+        if ((nurbs == NULL) || (spline == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        n = spline->number_of_control_points;
+        if ((spline->p0 != NULL)
+          && (spline->degree >= 1)
+          && (spline->degree <= DXF_SPLINE_MAX_DEGREE)
+          && (n >= 1)
+          && (spline->number_of_knots <= DXF_MAX_PARAM)
+          && ((spline->number_of_knots == n + spline->degree + 1)
+          || ((spline->flag & 2) && (spline->number_of_knots == n + 1))))
+        {
+                control_points = malloc (4 * (n + spline->degree) * sizeof (double));
+                if (control_points == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for control points.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                for (i = 0; i < n; i++)
+                {
+                        w = ((spline->flag & 4) && (i < DXF_MAX_PARAM) && (spline->weight_value[i] > 0.0))
+                          ? spline->weight_value[i] : 1.0;
+                        control_points[4 * i] = w * spline->p0[i].x;
+                        control_points[4 * i + 1] = w * spline->p0[i].y;
+                        control_points[4 * i + 2] = w * spline->p0[i].z;
+                        control_points[4 * i + 3] = w;
+                }
+                if (dxf_nurbs_set_curve (nurbs, spline->degree, control_points, n,
+                  spline->knot_value, spline->number_of_knots, (spline->flag & 2) != 0) == EXIT_SUCCESS)
+                {
+#if DEBUG
+                        DXF_DEBUG_END
+#endif
+                        return (EXIT_SUCCESS);
+                }
+        }
+        if ((spline->p1 != NULL) && (spline->number_of_fit_points >= 2))
+        {
+                return (dxf_nurbs_interpolate (nurbs, spline->p1, spline->number_of_fit_points,
+                  memcmp (&spline->p2, &zero, sizeof (DxfVec3)) ? &spline->p2 : NULL,
+                  memcmp (&spline->p3, &zero, sizeof (DxfVec3)) ? &spline->p3 : NULL,
+                  (spline->flag & 1) != 0));
+        }
+        fprintf (stderr,
+          (_("Error in %s () the spline has no valid control points and knots.\n")),
+          __FUNCTION__);
+        dxf_nurbs_clear (nurbs);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Set a \c DxfNurbs to the curve of a hatch boundary path spline
+ * edge.
+ *
+ * The curve lies in the plane of the hatch (the OCS), at Z = 0.\n
+ * Weights are used for a rational edge, weights which are not positive
+ * count as 1.0.\n
+ * A periodic edge may have a knot vector of one period.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the edge
+ * has no valid set of control points and knots or an error occurred.
+ */
+int
+dxf_nurbs_set_hatch_spline
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the curve. */
+        DxfHatchBoundaryPathEdgeSpline *spline
+                /*!< a pointer to a hatch boundary path spline edge. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathEdgeSplineCp *cp = NULL;
+        double *control_points = NULL;
+        double w;
+        int n = 0;
+        int result;
+
+        /* Do some basic checks. */
+        if ((nurbs == NULL) || (spline == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (cp = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points; cp != NULL; cp = (DxfHatchBoundaryPathEdgeSplineCp *) cp->next)
+        {
+                n++;
+        }
+        if ((n == 0) || (spline->degree < 1) || (spline->degree > DXF_SPLINE_MAX_DEGREE))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the spline edge has no valid control points and knots.\n")),
+                  __FUNCTION__);
+                dxf_nurbs_clear (nurbs);
+                return (EXIT_FAILURE);
+        }
+        control_points = malloc (4 * (n + spline->degree) * sizeof (double));
+        if (control_points == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for control points.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        n = 0;
+        for (cp = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points; cp != NULL; cp = (DxfHatchBoundaryPathEdgeSplineCp *) cp->next)
+        {
+                w = (spline->rational && (cp->weight > 0.0)) ? cp->weight : 1.0;
+                control_points[4 * n] = w * cp->x0;
+                control_points[4 * n + 1] = w * cp->y0;
+                control_points[4 * n + 2] = 0.0;
+                control_points[4 * n + 3] = w;
+                n++;
+        }
+        result = dxf_nurbs_set_curve (nurbs, spline->degree, control_points, n,
+          spline->knots, spline->number_of_knots, spline->periodic);
+        if (result != EXIT_SUCCESS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the spline edge has no valid control points and knots.\n")),
+                  __FUNCTION__);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Set a \c DxfNurbs to a cubic curve interpolating a number of
+ * points.
+ *
+ * The curve passes through the points at parameters proportional to
+ * the chord lengths between the points, from 0.0 to 1.0, with the
+ * points as knots, and has the given tangent directions at both ends
+ * (global interpolation with end derivatives, the system of equations
+ * is tridiagonal).\n
+ * Missing tangents are estimated from the parabola through the first
+ * (or last) three points, for a closed curve from the points on both
+ * sides of the start point.\n
+ * Coincident consecutive points are skipped, a closed curve returns to
+ * the first point.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when there are
+ * fewer than two distinct points or an error occurred.
+ */
+int
+dxf_nurbs_interpolate
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the curve. */
+        const DxfVec3 *points,
+                /*!< an array of points. */
+        int number_of_points,
+                /*!< number of points in \c points. */
+        const DxfVec3 *start_tangent,
+                /*!< tangent direction at the start (the length does
+                 * not matter), or \c NULL. */
+        const DxfVec3 *end_tangent,
+                /*!< tangent direction at the end (the length does not
+                 * matter), or \c NULL. */
+        int closed
+                /*!< \c TRUE for a closed curve. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double basis[DXF_NURBS_MAX_DERIVATIVES + 1][DXF_SPLINE_MAX_DEGREE + 1];
+        DxfVec3 *q = NULL;
+        DxfVec3 *p = NULL;
+        DxfVec3 d0;
+        DxfVec3 d1;
+        double *t = NULL;
+        double *knots = NULL;
+        double *c = NULL;
+        double *control_points = NULL;
+        double length;
+        double f;
+        int m;
+        int n;
+        int i;
+        int k;
+        int result;
+
+        /* Do some basic checks. */
+        if ((nurbs == NULL) || (points == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_nurbs_clear (nurbs);
+        if (number_of_points < 2)
+        {
+                return (EXIT_FAILURE);
+        }
+        q = malloc ((number_of_points + 1) * sizeof (DxfVec3));
+        p = malloc ((number_of_points + 4) * sizeof (DxfVec3));
+        t = malloc ((number_of_points + 1) * sizeof (double));
+        knots = malloc ((number_of_points + 8) * sizeof (double));
+        c = malloc ((number_of_points + 1) * sizeof (double));
+        control_points = malloc (4 * (number_of_points + 7) * sizeof (double));
+        if ((q == NULL) || (p == NULL) || (t == NULL) || (knots == NULL) || (c == NULL) || (control_points == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for the interpolation.\n")),
+                  __FUNCTION__);
+                free (q);
+                free (p);
+                free (t);
+                free (knots);
+                free (c);
+                free (control_points);
+                return (EXIT_FAILURE);
+        }
+        /* Distinct points and their chord length parameters. */
+        m = 0;
+        q[0] = points[0];
+        t[0] = 0.0;
+        for (i = 1; i <= number_of_points; i++)
+        {
+                if (i == number_of_points)
+                {
+                        if (!closed)
+                        {
+                                break;
+                        }
+                        q[m + 1] = points[0];
+                }
+                else
+                {
+                        q[m + 1] = points[i];
+                }
+                length = sqrt ((q[m + 1].x - q[m].x) * (q[m + 1].x - q[m].x)
+                  + (q[m + 1].y - q[m].y) * (q[m + 1].y - q[m].y)
+                  + (q[m + 1].z - q[m].z) * (q[m + 1].z - q[m].z));
+                if (length > 0.0)
+                {
+                        m++;
+                        t[m] = t[m - 1] + length;
+                }
+        }
+        if ((m < 1) || (closed && (m < 3)))
+        {
+                free (q);
+                free (p);
+                free (t);
+                free (knots);
+                free (c);
+                free (control_points);
+                return (EXIT_FAILURE);
+        }
+        length = t[m];
+        for (i = 1; i < m; i++)
+        {
+                t[i] /= length;
+        }
+        t[m] = 1.0;
+        /* End derivatives, a tangent direction is scaled to the length
+         * of the curve (the parameter runs from 0.0 to 1.0). */
+        if (start_tangent != NULL)
+        {
+                f = sqrt (start_tangent->x * start_tangent->x
+                  + start_tangent->y * start_tangent->y
+                  + start_tangent->z * start_tangent->z);
+                d0.x = length * start_tangent->x / f;
+                d0.y = length * start_tangent->y / f;
+                d0.z = length * start_tangent->z / f;
+        }
+        else if (closed)
+        {
+                dxf_nurbs_estimate_derivative (q[m - 1], q[0], q[1],
+                  1.0 - t[m - 1], t[1], 1, &d0);
+        }
+        else if (m >= 2)
+        {
+                dxf_nurbs_estimate_derivative (q[0], q[1], q[2],
+                  t[1], t[2] - t[1], 0, &d0);
+        }
+        else
+        {
+                d0.x = q[1].x - q[0].x;
+                d0.y = q[1].y - q[0].y;
+                d0.z = q[1].z - q[0].z;
+        }
+        if (end_tangent != NULL)
+        {
+                f = sqrt (end_tangent->x * end_tangent->x
+                  + end_tangent->y * end_tangent->y
+                  + end_tangent->z * end_tangent->z);
+                d1.x = length * end_tangent->x / f;
+                d1.y = length * end_tangent->y / f;
+                d1.z = length * end_tangent->z / f;
+        }
+        else if (closed)
+        {
+                d1 = d0;
+        }
+        else if (m >= 2)
+        {
+                dxf_nurbs_estimate_derivative (q[m - 2], q[m - 1], q[m],
+                  t[m - 1] - t[m - 2], t[m] - t[m - 1], 2, &d1);
+        }
+        else
+        {
+                d1 = d0;
+        }
+        /* Knots 0, 0, 0, 0, t[1], ..., t[m - 1], 1, 1, 1, 1. */
+        n = m + 3;
+        for (i = 0; i < 4; i++)
+        {
+                knots[i] = 0.0;
+                knots[n + i] = 1.0;
+        }
+        for (i = 1; i < m; i++)
+        {
+                knots[i + 3] = t[i];
+        }
+        /* The first two and the last two control points follow from
+         * the end points and the end derivatives. */
+        f = knots[4] / 3.0;
+        p[0] = q[0];
+        p[1].x = q[0].x + f * d0.x;
+        p[1].y = q[0].y + f * d0.y;
+        p[1].z = q[0].z + f * d0.z;
+        f = (1.0 - knots[n - 1]) / 3.0;
+        p[n - 1] = q[m];
+        p[n - 2].x = q[m].x - f * d1.x;
+        p[n - 2].y = q[m].y - f * d1.y;
+        p[n - 2].z = q[m].z - f * d1.z;
+        /* Point k (0 < k < m) gives a[k] P[k] + b[k] P[k + 1]
+         * + c[k] P[k + 2] = Q[k], solved for P[2] ... P[m] by
+         * forward elimination and back substitution. */
+        for (k = 1; k < m; k++)
+        {
+                dxf_nurbs_calculate_basis (knots, 3, k + 3, t[k], 0, basis);
+                if (k == 1)
+                {
+                        p[2].x = q[1].x - basis[0][0] * p[1].x;
+                        p[2].y = q[1].y - basis[0][0] * p[1].y;
+                        p[2].z = q[1].z - basis[0][0] * p[1].z;
+                        f = basis[0][1];
+                }
+                else
+                {
+                        f = basis[0][1] - basis[0][0] * c[k - 1];
+                        p[k + 1].x = q[k].x - basis[0][0] * p[k].x;
+                        p[k + 1].y = q[k].y - basis[0][0] * p[k].y;
+                        p[k + 1].z = q[k].z - basis[0][0] * p[k].z;
+                }
+                if (k == m - 1)
+                {
+                        p[k + 1].x -= basis[0][2] * p[k + 2].x;
+                        p[k + 1].y -= basis[0][2] * p[k + 2].y;
+                        p[k + 1].z -= basis[0][2] * p[k + 2].z;
+                        c[k] = 0.0;
+                }
+                else
+                {
+                        c[k] = basis[0][2] / f;
+                }
+                p[k + 1].x /= f;
+                p[k + 1].y /= f;
+                p[k + 1].z /= f;
+        }
+        for (k = m - 2; k >= 1; k--)
+        {
+                p[k + 1].x -= c[k] * p[k + 2].x;
+                p[k + 1].y -= c[k] * p[k + 2].y;
+                p[k + 1].z -= c[k] * p[k + 2].z;
+        }
+        for (i = 0; i < n; i++)
+        {
+                control_points[4 * i] = p[i].x;
+                control_points[4 * i + 1] = p[i].y;
+                control_points[4 * i + 2] = p[i].z;
+                control_points[4 * i + 3] = 1.0;
+        }
+        result = dxf_nurbs_set_curve (nurbs, 3, control_points, n, knots, n + 4, FALSE);
+        free (q);
+        free (p);
+        free (t);
+        free (knots);
+        free (c);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Calculate the non zero B-spline basis functions and their
+ * derivatives at a parameter.
+ *
+ * The basis functions are computed with the triangular scheme of Cox
+ * and de Boor, the derivatives from the differences of the basis
+ * functions of lower degree.\n
+ * <tt>basis[k][r]</tt> is the k-th derivative of the basis function of
+ * control point <tt>span - degree + r</tt>, derivatives higher than
+ * the degree are zero.
+ */
+void
+dxf_nurbs_calculate_basis
+(
+        const double *knots,
+                /*!< the knot values. */
+        int degree,
+                /*!< degree of the curve, at most
+                 * \c DXF_SPLINE_MAX_DEGREE. */
+        int span,
+                /*!< the (non empty) knot span holding \c u. */
+        double u,
+                /*!< the parameter. */
+        int number_of_derivatives,
+                /*!< number of derivatives, at most
+                 * \c DXF_NURBS_MAX_DERIVATIVES. */
+        double basis[][DXF_SPLINE_MAX_DEGREE + 1]
+                /*!< the basis functions and their derivatives
+                 * (output), \c number_of_derivatives + 1 rows. */
+)
+{
+        double ndu[DXF_SPLINE_MAX_DEGREE + 1][DXF_SPLINE_MAX_DEGREE + 1];
+        double a[2][DXF_SPLINE_MAX_DEGREE + 1];
+        double left[DXF_SPLINE_MAX_DEGREE + 1];
+        double right[DXF_SPLINE_MAX_DEGREE + 1];
+        double saved;
+        double temp;
+        double d;
+        int p = degree;
+        int s1;
+        int s2;
+        int j1;
+        int j2;
+        int rk;
+        int pk;
+        int i;
+        int j;
+        int k;
+        int r;
+
+        /* Basis functions in the upper triangle of ndu, knot
+         * differences in the lower triangle. */
+        ndu[0][0] = 1.0;
+        for (j = 1; j <= p; j++)
+        {
+                left[j] = u - knots[span + 1 - j];
+                right[j] = knots[span + j] - u;
+                saved = 0.0;
+                for (r = 0; r < j; r++)
+                {
+                        ndu[j][r] = right[r + 1] + left[j - r];
+                        temp = ndu[r][j - 1] / ndu[j][r];
+                        ndu[r][j] = saved + right[r + 1] * temp;
+                        saved = left[j - r] * temp;
+                }
+                ndu[j][j] = saved;
+        }
+        for (r = 0; r <= p; r++)
+        {
+                basis[0][r] = ndu[r][p];
+        }
+        for (k = p + 1; k <= number_of_derivatives; k++)
+        {
+                for (r = 0; r <= p; r++)
+                {
+                        basis[k][r] = 0.0;
+                }
+        }
+        if (number_of_derivatives > p)
+        {
+                number_of_derivatives = p;
+        }
+        for (r = 0; r <= p; r++)
+        {
+                /* Coefficients of the derivatives in alternating rows
+                 * of a. */
+                s1 = 0;
+                s2 = 1;
+                a[0][0] = 1.0;
+                for (k = 1; k <= number_of_derivatives; k++)
+                {
+                        d = 0.0;
+                        rk = r - k;
+                        pk = p - k;
+                        if (r >= k)
+                        {
+                                a[s2][0] = a[s1][0] / ndu[pk + 1][rk];
+                                d = a[s2][0] * ndu[rk][pk];
+                        }
+                        j1 = (rk >= -1) ? 1 : -rk;
+                        j2 = (r - 1 <= pk) ? k - 1 : p - r;
+                        for (j = j1; j <= j2; j++)
+                        {
+                                a[s2][j] = (a[s1][j] - a[s1][j - 1]) / ndu[pk + 1][rk + j];
+                                d += a[s2][j] * ndu[rk + j][pk];
+                        }
+                        if (r <= pk)
+                        {
+                                a[s2][k] = -a[s1][k - 1] / ndu[pk + 1][r];
+                                d += a[s2][k] * ndu[r][pk];
+                        }
+                        basis[k][r] = d;
+                        i = s1;
+                        s1 = s2;
+                        s2 = i;
+                }
+        }
+        r = p;
+        for (k = 1; k <= number_of_derivatives; k++)
+        {
+                for (j = 0; j <= p; j++)
+                {
+                        basis[k][j] *= r;
+                }
+                r *= (p - k);
+        }
+}
+
+
+/*!
+ * \brief Get the parameter of the start point of a \c DxfNurbs.
+ *
+ * \return the lowest parameter of the curve, or 0.0 when an error
+ * occurred.
+ */
+double
+dxf_nurbs_get_start_parameter
+(
+        DxfNurbs *nurbs
+                /*!< a pointer to the curve. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((nurbs == NULL) || (nurbs->knots == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0.0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (nurbs->knots[nurbs->degree]);
+}
+
+
+/*!
+ * \brief Get the parameter of the end point of a \c DxfNurbs.
+ *
+ * \return the highest parameter of the curve, or 0.0 when an error
+ * occurred.
+ */
+double
+dxf_nurbs_get_end_parameter
+(
+        DxfNurbs *nurbs
+                /*!< a pointer to the curve. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((nurbs == NULL) || (nurbs->knots == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0.0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (nurbs->knots[nurbs->number_of_control_points]);
+}
+
+
+/*!
+ * \brief Calculate a point of a \c DxfNurbs and its derivatives at a
+ * parameter.
+ *
+ * Parameters outside the curve domain (see
+ * \c dxf_nurbs_get_start_parameter() and
+ * \c dxf_nurbs_get_end_parameter()) are clamped to the domain.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_nurbs_calculate_point
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the curve. */
+        double u,
+                /*!< the parameter. */
+        int number_of_derivatives,
+                /*!< number of derivatives, from 0 (the point only) to
+                 * \c DXF_NURBS_MAX_DERIVATIVES. */
+        DxfVec3 *derivatives
+                /*!< an array of \c number_of_derivatives + 1 entries
+                 * receiving the point and its derivatives to the
+                 * parameter (output). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((nurbs == NULL) || (derivatives == NULL) || (nurbs->knots == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((number_of_derivatives < 0) || (number_of_derivatives > DXF_NURBS_MAX_DERIVATIVES))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid number of derivatives was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (u < nurbs->knots[nurbs->degree])
+        {
+                u = nurbs->knots[nurbs->degree];
+        }
+        if (u > nurbs->knots[nurbs->number_of_control_points])
+        {
+                u = nurbs->knots[nurbs->number_of_control_points];
+        }
+        dxf_nurbs_evaluate (nurbs, dxf_nurbs_find_span (nurbs, u), u,
+          number_of_derivatives, derivatives);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Calculate the curvature of a \c DxfNurbs at a parameter.
+ *
+ * The curvature is \f$ |C' \times C''| / |C'|^3 \f$, the inverse of the
+ * radius of the osculating circle.
+ *
+ * \return the curvature, 0.0 where the first derivative vanishes, or
+ * -1.0 when an error occurred.
+ */
+double
+dxf_nurbs_calculate_curvature
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the curve. */
+        double u
+                /*!< the parameter. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVec3 d[3];
+        double cx;
+        double cy;
+        double cz;
+        double speed;
+
+        if (dxf_nurbs_calculate_point (nurbs, u, 2, d) != EXIT_SUCCESS)
+        {
+                return (-1.0);
+        }
+        speed = sqrt (d[1].x * d[1].x + d[1].y * d[1].y + d[1].z * d[1].z);
+        if (speed == 0.0)
+        {
+                return (0.0);
+        }
+        cx = d[1].y * d[2].z - d[1].z * d[2].y;
+        cy = d[1].z * d[2].x - d[1].x * d[2].z;
+        cz = d[1].x * d[2].y - d[1].y * d[2].x;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (sqrt (cx * cx + cy * cy + cz * cz) / (speed * speed * speed));
+}
+
+
+/*!
+ * \brief Calculate the points of a \c DxfNurbs at an array of
+ * parameters.
+ *
+ * The knot span of a parameter is searched from the span of the
+ * previous parameter, so ascending (or descending) parameters in the
+ * same span share one search.\n
+ * Parameters outside the curve domain are clamped to the domain.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_nurbs_calculate_points
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the curve. */
+        const double *u,
+                /*!< an array of parameters. */
+        int number_of_parameters,
+                /*!< number of parameters in \c u. */
+        DxfVec3 *points,
+                /*!< an array of \c number_of_parameters points
+                 * (output). */
+        DxfVec3 *derivatives
+                /*!< an array of \c number_of_parameters first
+                 * derivatives (output), may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVec3 d[2];
+        const double *knots = NULL;
+        double start;
+        double end;
+        double t;
+        int span;
+        int i;
+
+        /* Do some basic checks. */
+        if ((nurbs == NULL) || (nurbs->knots == NULL)
+          || ((number_of_parameters > 0) && ((u == NULL) || (points == NULL))))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        knots = nurbs->knots;
+        start = knots[nurbs->degree];
+        end = knots[nurbs->number_of_control_points];
+        span = nurbs->degree;
+        for (i = 0; i < number_of_parameters; i++)
+        {
+                t = (u[i] < start) ? start : ((u[i] > end) ? end : u[i]);
+                if ((t < knots[span]) || (t >= knots[span + 1]))
+                {
+                        span = dxf_nurbs_find_span (nurbs, t);
+                }
+                dxf_nurbs_evaluate (nurbs, span, t, (derivatives != NULL) ? 1 : 0, d);
+                points[i] = d[0];
+                if (derivatives != NULL)
+                {
+                        derivatives[i] = d[1];
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Tessellate a \c DxfNurbs into a polyline within a chord
+ * tolerance.
+ *
+ * Every knot span is divided into \c degree pieces, and every piece is
+ * bisected until the point at the middle of its parameter range lies
+ * within \c tolerance of its chord (or after
+ * \c DXF_NURBS_TESSELLATE_MAX_DEPTH bisections), so straight parts of
+ * the curve take few points and curved parts many.\n
+ * The points are appended to \c points with
+ * \c dxf_vec3_array_append(), starting with the start point of the
+ * curve and ending with its end point.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred (the points appended so far are kept).
+ */
+int
+dxf_nurbs_tessellate
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the curve. */
+        double tolerance,
+                /*!< maximum distance between the curve and the
+                 * polyline, 0.0 for \c DXF_NURBS_RELATIVE_TOLERANCE of
+                 * the size of the control polygon. */
+        DxfVec3 **points,
+                /*!< a pointer to an array of points grown with
+                 * \c dxf_vec3_array_append(), or to \c NULL for a new
+                 * array (input and output). */
+        int *number_of_points
+                /*!< the number of points in \c points (input and
+                 * output). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfNurbsPiece stack[DXF_NURBS_TESSELLATE_MAX_DEPTH + 2];
+        DxfVec3 *array = NULL;
+        DxfVec3 point;
+        DxfVec3 min;
+        DxfVec3 max;
+        const double *knots = NULL;
+        const double *cp = NULL;
+        double start;
+        double u;
+        int top;
+        int pieces;
+        int size;
+        int p;
+        int i;
+        int k;
+
+        /* Do some basic checks. */
+        if ((nurbs == NULL) || (points == NULL) || (number_of_points == NULL)
+          || (nurbs->knots == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        knots = nurbs->knots;
+        p = nurbs->degree;
+        if (tolerance <= 0.0)
+        {
+                cp = nurbs->control_points;
+                min.x = max.x = cp[0] / cp[3];
+                min.y = max.y = cp[1] / cp[3];
+                min.z = max.z = cp[2] / cp[3];
+                for (i = 1; i < nurbs->number_of_control_points; i++)
+                {
+                        cp = nurbs->control_points + 4 * i;
+                        point.x = cp[0] / cp[3];
+                        point.y = cp[1] / cp[3];
+                        point.z = cp[2] / cp[3];
+                        min.x = (point.x < min.x) ? point.x : min.x;
+                        min.y = (point.y < min.y) ? point.y : min.y;
+                        min.z = (point.z < min.z) ? point.z : min.z;
+                        max.x = (point.x > max.x) ? point.x : max.x;
+                        max.y = (point.y > max.y) ? point.y : max.y;
+                        max.z = (point.z > max.z) ? point.z : max.z;
+                }
+                tolerance = DXF_NURBS_RELATIVE_TOLERANCE * sqrt ((max.x - min.x) * (max.x - min.x)
+                  + (max.y - min.y) * (max.y - min.y)
+                  + (max.z - min.z) * (max.z - min.z));
+                if (tolerance <= 0.0)
+                {
+                        /* All control points coincide. */
+                        tolerance = 1.0;
+                }
+        }
+        pieces = (p > 1) ? p : 1;
+        /* The number of allocated entries in the passed array is not
+         * known, the first append reallocates it. */
+        size = 0;
+        dxf_nurbs_evaluate (nurbs, dxf_nurbs_find_span (nurbs, knots[p]), knots[p], 0, &point);
+        array = dxf_vec3_array_append (*points, *number_of_points, &size, point);
+        if (array == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        *points = array;
+        (*number_of_points)++;
+        for (k = p; k < nurbs->number_of_control_points; k++)
+        {
+                if (knots[k] >= knots[k + 1])
+                {
+                        continue;
+                }
+                for (i = 1; i <= pieces; i++)
+                {
+                        /* The start of the piece is the last point
+                         * appended. */
+                        start = knots[k] + (knots[k + 1] - knots[k]) * (i - 1) / pieces;
+                        top = 0;
+                        stack[0].u = (i == pieces) ? knots[k + 1] : knots[k] + (knots[k + 1] - knots[k]) * i / pieces;
+                        stack[0].depth = 0;
+                        dxf_nurbs_evaluate (nurbs, k, stack[0].u, 0, &stack[0].point);
+                        while (top >= 0)
+                        {
+                                u = 0.5 * (start + stack[top].u);
+                                dxf_nurbs_evaluate (nurbs, k, u, 0, &point);
+                                if ((stack[top].depth < DXF_NURBS_TESSELLATE_MAX_DEPTH)
+                                  && (dxf_nurbs_get_chord_distance ((*points)[*number_of_points - 1],
+                                  stack[top].point, point) > tolerance))
+                                {
+                                        /* Bisect, the first half is
+                                         * on top. */
+                                        stack[top + 1].u = u;
+                                        stack[top + 1].point = point;
+                                        stack[top + 1].depth = stack[top].depth + 1;
+                                        stack[top].depth++;
+                                        top++;
+                                        continue;
+                                }
+                                array = dxf_vec3_array_append (*points, *number_of_points, &size, stack[top].point);
+                                if (array == NULL)
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                                *points = array;
+                                (*number_of_points)++;
+                                start = stack[top].u;
+                                top--;
+                        }
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
@@ -0,0 +1,183 @@
+/*!
+ * \file nurbs.h
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Header file for the evaluation of NURBS curves (splines and hatch spline edges).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_NURBS_H
+#define LIBDXF_SRC_NURBS_H
+
+
+#include "global.h"
+#include "vec.h"
+#include "spline.h"
+#include "hatch.h"
+
+
+#define DXF_NURBS_MAX_DERIVATIVES 2
+        /*!< \brief The highest derivative calculated by
+         * \c dxf_nurbs_calculate_point(). */
+
+
+#define DXF_NURBS_RELATIVE_TOLERANCE 0.001
+        /*!< \brief The chord tolerance of \c dxf_nurbs_tessellate()
+         * relative to the size of the control polygon, used when no
+         * tolerance is given. */
+
+
+#define DXF_NURBS_TESSELLATE_MAX_DEPTH 24
+        /*!< \brief The maximum number of bisections of a piece of a
+         * curve in \c dxf_nurbs_tessellate(). */
+
+
+/*!
+ * \brief Definition of a NURBS curve prepared for evaluation.
+ *
+ * A \c DxfNurbs holds a copy of the curve of a DXF \c SPLINE entity or
+ * a hatch boundary path spline edge, with the control points multiplied
+ * by their weights (homogeneous coordinates), so a point is a single
+ * weighted sum of the control points and the entity is not consulted
+ * again.\n
+ * Periodic curves with a knot vector of one period are unrolled into
+ * an equivalent open curve, splines with fit points only are
+ * interpolated (see \c dxf_nurbs_interpolate()).\n
+ * Evaluation does not modify the curve, so any number of threads can
+ * evaluate the same \c DxfNurbs.
+ */
+typedef struct
+dxf_nurbs
+{
+        int degree;
+                /*!< Degree of the curve. */
+        int number_of_control_points;
+                /*!< Number of control points. */
+        double *control_points;
+                /*!< Array of \c number_of_control_points homogeneous
+                 * control points (X * weight, Y * weight, Z * weight,
+                 * weight). */
+        double *knots;
+                /*!< Array of \c number_of_control_points + \c degree + 1
+                 * knot values. */
+        int rational;
+                /*!< \c TRUE when a weight is not 1.0. */
+} DxfNurbs;
+
+
+DxfNurbs *
+dxf_nurbs_new ();
+DxfNurbs *
+dxf_nurbs_init
+(
+        DxfNurbs *nurbs
+);
+int
+dxf_nurbs_free
+(
+        DxfNurbs *nurbs
+);
+int
+dxf_nurbs_set_spline
+(
+        DxfNurbs *nurbs,
+        DxfSpline *spline
+);
+int
+dxf_nurbs_set_hatch_spline
+(
+        DxfNurbs *nurbs,
+        DxfHatchBoundaryPathEdgeSpline *spline
+);
+int
+dxf_nurbs_interpolate
+(
+        DxfNurbs *nurbs,
+        const DxfVec3 *points,
+        int number_of_points,
+        const DxfVec3 *start_tangent,
+        const DxfVec3 *end_tangent,
+        int closed
+);
+void
+dxf_nurbs_calculate_basis
+(
+        const double *knots,
+        int degree,
+        int span,
+        double u,
+        int number_of_derivatives,
+        double basis[][DXF_SPLINE_MAX_DEGREE + 1]
+);
+double
+dxf_nurbs_get_start_parameter
+(
+        DxfNurbs *nurbs
+);
+double
+dxf_nurbs_get_end_parameter
+(
+        DxfNurbs *nurbs
+);
+int
+dxf_nurbs_calculate_point
+(
+        DxfNurbs *nurbs,
+        double u,
+        int number_of_derivatives,
+        DxfVec3 *derivatives
+);
+double
+dxf_nurbs_calculate_curvature
+(
+        DxfNurbs *nurbs,
+        double u
+);
+int
+dxf_nurbs_calculate_points
+(
+        DxfNurbs *nurbs,
+        const double *u,
+        int number_of_parameters,
+        DxfVec3 *points,
+        DxfVec3 *derivatives
+);
+int
+dxf_nurbs_tessellate
+(
+        DxfNurbs *nurbs,
+        double tolerance,
+        DxfVec3 **points,
+        int *number_of_points
+);
+
+#endif /* LIBDXF_SRC_NURBS_H */
+
+
+/* EOF */
@@ -40,6 +40,45 @@
 #include "param.h"
 
 
+/*!
+ * \brief DXF non-graphical object types.
+ *
+ * Also contains the symbol table entries and blocks, which own a handle
+ * too.\n
+ * The values do not overlap with the \c DxfEntityType values, so both
+ * can be stored in the same type field (see \c DxfHandleTable).
+ */
+typedef enum
+dxf_object_type
+{
+        UNKNOWN_OBJECT = 1000,
+        ACAD_PROXY_OBJECT,
+        APPID,
+        BLOCK,
+        BLOCK_RECORD,
+        DICTIONARY,
+        DICTIONARYVAR,
+        DIMSTYLE,
+        GROUP,
+        IDBUFFER,
+        IMAGEDEF,
+        IMAGEDEF_REACTOR,
+        LAYER,
+        LAYER_INDEX,
+        LTYPE,
+        MLINESTYLE,
+        RASTERVARIABLES,
+        SORTENTSTABLE,
+        SPATIAL_FILTER,
+        SPATIAL_INDEX,
+        STYLE,
+        UCS,
+        VIEW,
+        VPORT,
+        XRECORD
+} DxfObjectType;
+
+
 /*!
  * \brief DXF definition of an object.
  */
@@ -54,6 +54,7 @@
 
 
 #include "point.h"
+#include "util.h"
 
 
 /*!
@@ -73,17 +74,14 @@ dxf_point_new ()
         size = sizeof (DxfPoint);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((point = malloc (size)) == NULL)
+        /* recycle a released DxfPoint when available. */
+        if ((point = dxf_pool_alloc (DXF_POOL_POINT, size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                   __FUNCTION__);
                 point = NULL;
         }
-        else
-        {
-                memset (point, 0, size);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -140,6 +138,7 @@ dxf_point_init
         point->extr_z0 = 0.0;
         point->dictionary_owner_soft = strdup ("");
         point->dictionary_owner_hard = strdup ("");
+        point->intern = NULL;
         point->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -181,7 +180,7 @@ dxf_point_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (point == NULL)
@@ -192,9 +191,13 @@ dxf_point_read
                 point = dxf_point_new ();
                 point = dxf_point_init (point);
         }
+        /* The symbol names are interned in the intern table of the
+         * file. */
+        point->intern = fp->intern;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -203,7 +206,7 @@ dxf_point_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -218,13 +221,13 @@ dxf_point_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", point->linetype);
+                        point->linetype = dxf_intern_read_string (fp, point->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", point->layer);
+                        point->layer = dxf_intern_read_string (fp, point->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -339,14 +342,14 @@ dxf_point_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", point->dictionary_owner_soft);
+                        point->dictionary_owner_soft = dxf_read_string (fp, point->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", point->dictionary_owner_hard);
+                        point->dictionary_owner_hard = dxf_read_string (fp, point->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -360,19 +363,37 @@ dxf_point_read
                         fprintf (stderr,
                           (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
-        }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
+        }
+        /* Symbol names not found in the file are still the copies
+         * made by the init function. */
+        point->linetype = dxf_intern_adopt_string ((DxfIntern *) point->intern, point->linetype);
+        point->layer = dxf_intern_adopt_string ((DxfIntern *) point->intern, point->layer);
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (point->linetype, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) point->intern, point->linetype, DXF_INTERN_ID_EMPTY))
+        {
+                dxf_intern_free_string ((DxfIntern *) point->intern, point->linetype);
+                point->linetype = dxf_intern_string ((DxfIntern *) point->intern, DXF_DEFAULT_LINETYPE);
+        }
+        if (dxf_intern_is_symbol ((DxfIntern *) point->intern, point->layer, DXF_INTERN_ID_EMPTY))
         {
-                point->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_intern_free_string ((DxfIntern *) point->intern, point->layer);
+                point->layer = dxf_intern_string ((DxfIntern *) point->intern, DXF_DEFAULT_LAYER);
         }
-        if (strcmp (point->layer, "") == 0)
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (point->id_code > 0))
         {
-                point->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) point->id_code, POINT, point);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -399,6 +420,8 @@ dxf_point_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("POINT");
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -419,7 +442,8 @@ dxf_point_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (point->linetype, "") == 0)
+        linetype = point->linetype;
+        if (dxf_intern_is_symbol ((DxfIntern *) point->intern, linetype, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -427,9 +451,10 @@ dxf_point_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                point->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = dxf_intern_get_symbol ((DxfIntern *) point->intern, DXF_INTERN_ID_DEFAULT_LINETYPE);
         }
-        if (strcmp (point->layer, "") == 0)
+        layer = point->layer;
+        if (dxf_intern_is_symbol ((DxfIntern *) point->intern, layer, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -438,7 +463,7 @@ dxf_point_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                point->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = dxf_intern_get_symbol ((DxfIntern *) point->intern, DXF_INTERN_ID_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -478,10 +503,10 @@ dxf_point_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", point->layer);
-        if (strcmp (point->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (!dxf_intern_is_symbol ((DxfIntern *) point->intern, linetype, DXF_INTERN_ID_DEFAULT_LINETYPE))
         {
-                fprintf (fp->fp, "  6\n%s\n", point->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
@@ -556,11 +581,11 @@ dxf_point_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (point->linetype);
-        free (point->layer);
+        dxf_intern_free_string ((DxfIntern *) point->intern, point->linetype);
+        dxf_intern_free_string ((DxfIntern *) point->intern, point->layer);
         free (point->dictionary_owner_soft);
         free (point->dictionary_owner_hard);
-        free (point);
+        dxf_pool_free (DXF_POOL_POINT, point);
         point = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -757,7 +782,10 @@ dxf_point_set_linetype
                   __FUNCTION__);
                 return (NULL);
         }
-        point->linetype = strdup (linetype);
+        /* Intern first, the new name may be the old one. */
+        linetype = dxf_intern_string ((DxfIntern *) point->intern, linetype);
+        dxf_intern_free_string ((DxfIntern *) point->intern, point->linetype);
+        point->linetype = linetype;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -838,7 +866,10 @@ dxf_point_set_layer
                   __FUNCTION__);
                 return (NULL);
         }
-        point->layer = strdup (layer);
+        /* Intern first, the new name may be the old one. */
+        layer = dxf_intern_string ((DxfIntern *) point->intern, layer);
+        dxf_intern_free_string ((DxfIntern *) point->intern, point->layer);
+        point->layer = layer;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -36,6 +36,9 @@
 
 
 #include "global.h"
+#include "intern.h"
+#include "handle_table.h"
+#include "pool.h"
 #include "binary_graphics_data.h"
 
 
@@ -189,6 +192,11 @@ dxf_point_struct
                 /*!< group code = 230\n
                  * extrusion direction\n
                  * optional, if ommited defaults to 1.0. */
+        struct DxfIntern *intern;
+                /*!< Intern table holding the interned symbol names of
+                 * this entity, \c NULL when none are interned.\n
+                 * Symbol names not found in this table are private
+                 * copies. */
         struct DxfPoint *next;
                 /*!< pointer to the next DxfPoint.\n
                  * \c NULL in the last DxfPoint. */
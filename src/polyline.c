@@ -33,6 +33,8 @@
 
 
 #include "polyline.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -139,6 +141,8 @@ dxf_polyline_init
         polyline->extr_z0 = 0.0;
         polyline->dictionary_owner_soft = strdup ("");
         polyline->dictionary_owner_hard = strdup ("");
+        polyline->mesh = NULL;
+        polyline->intern = NULL;
         polyline->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -187,7 +191,7 @@ dxf_polyline_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (polyline == NULL)
@@ -198,9 +202,13 @@ dxf_polyline_read
                 polyline = dxf_polyline_new ();
                 polyline = dxf_polyline_init (polyline);
         }
+        /* The symbol names are interned in the intern table of the
+         * file. */
+        polyline->intern = fp->intern;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -209,7 +217,7 @@ dxf_polyline_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -224,13 +232,13 @@ dxf_polyline_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", polyline->linetype);
+                        polyline->linetype = dxf_intern_read_string (fp, polyline->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", polyline->layer);
+                        polyline->layer = dxf_intern_read_string (fp, polyline->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -397,14 +405,14 @@ dxf_polyline_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", polyline->dictionary_owner_soft);
+                        polyline->dictionary_owner_soft = dxf_read_string (fp, polyline->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", polyline->dictionary_owner_hard);
+                        polyline->dictionary_owner_hard = dxf_read_string (fp, polyline->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -418,19 +426,37 @@ dxf_polyline_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
+        /* Symbol names not found in the file are still the copies
+         * made by the init function. */
+        polyline->linetype = dxf_intern_adopt_string ((DxfIntern *) polyline->intern, polyline->linetype);
+        polyline->layer = dxf_intern_adopt_string ((DxfIntern *) polyline->intern, polyline->layer);
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (polyline->linetype, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) polyline->intern, polyline->linetype, DXF_INTERN_ID_EMPTY))
+        {
+                dxf_intern_free_string ((DxfIntern *) polyline->intern, polyline->linetype);
+                polyline->linetype = dxf_intern_string ((DxfIntern *) polyline->intern, DXF_DEFAULT_LINETYPE);
+        }
+        if (dxf_intern_is_symbol ((DxfIntern *) polyline->intern, polyline->layer, DXF_INTERN_ID_EMPTY))
         {
-                polyline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_intern_free_string ((DxfIntern *) polyline->intern, polyline->layer);
+                polyline->layer = dxf_intern_string ((DxfIntern *) polyline->intern, DXF_DEFAULT_LAYER);
         }
-        if (strcmp (polyline->layer, "") == 0)
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (polyline->id_code > 0))
         {
-                polyline->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) polyline->id_code, POLYLINE, polyline);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -464,6 +490,9 @@ dxf_polyline_write
 #endif
         char *dxf_entity_name = strdup ("POLYLINE");
         DxfVertex *iter = NULL;
+        DxfSeqend *seqend = NULL;
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -511,7 +540,8 @@ dxf_polyline_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (polyline->linetype, "") == 0)
+        linetype = polyline->linetype;
+        if (dxf_intern_is_symbol ((DxfIntern *) polyline->intern, linetype, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -519,9 +549,10 @@ dxf_polyline_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                polyline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = dxf_intern_get_symbol ((DxfIntern *) polyline->intern, DXF_INTERN_ID_DEFAULT_LINETYPE);
         }
-        if (strcmp (polyline->layer, "") == 0)
+        layer = polyline->layer;
+        if (dxf_intern_is_symbol ((DxfIntern *) polyline->intern, layer, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -529,7 +560,7 @@ dxf_polyline_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                polyline->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = dxf_intern_get_symbol ((DxfIntern *) polyline->intern, DXF_INTERN_ID_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -569,10 +600,10 @@ dxf_polyline_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", polyline->layer);
-        if (strcmp (polyline->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (!dxf_intern_is_symbol ((DxfIntern *) polyline->intern, linetype, DXF_INTERN_ID_DEFAULT_LINETYPE))
         {
-                fprintf (fp->fp, "  6\n%s\n", polyline->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
@@ -634,7 +665,16 @@ dxf_polyline_write
                 dxf_vertex_write (fp, iter);
                 iter = (DxfVertex *) iter->next;
         }
-        dxf_vertex_free (iter);
+        /* The vertices are terminated by a SEQEND marker on the layer
+         * of the polyline. */
+        seqend = dxf_seqend_init (dxf_seqend_new ());
+        if (seqend != NULL)
+        {
+                free (seqend->layer);
+                seqend->layer = strdup (layer);
+                dxf_seqend_write (fp, seqend);
+                dxf_seqend_free (seqend);
+        }
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -675,8 +715,18 @@ dxf_polyline_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (polyline->linetype);
-        free (polyline->layer);
+        dxf_intern_free_string ((DxfIntern *) polyline->intern, polyline->linetype);
+        dxf_intern_free_string ((DxfIntern *) polyline->intern, polyline->layer);
+        free (polyline->dictionary_owner_soft);
+        free (polyline->dictionary_owner_hard);
+        if (polyline->mesh != NULL)
+        {
+                dxf_indexed_mesh_free ((DxfIndexedMesh *) polyline->mesh);
+        }
+        if (polyline->vertex_index != NULL)
+        {
+                dxf_chunk_list_free ((DxfChunkList *) polyline->vertex_index);
+        }
         free (polyline);
         polyline = NULL;
 #if DEBUG
@@ -724,4 +774,456 @@ dxf_polyline_free_chain
 }
 
 
+/*!
+ * \brief Read the \c VERTEX entities and the \c SEQEND marker following
+ * a DXF \c POLYLINE entity.
+ *
+ * The last line read from file contained the "  0" string terminating
+ * the \c POLYLINE data read by \c dxf_polyline_read().\n
+ * Now follows a sequence of \c VERTEX entities terminated by a \c SEQEND
+ * entity.\n
+ * When \c fp->build_meshes is set and the polyline is a polyface mesh
+ * or a polygon mesh, the vertices and face records are added to an
+ * indexed mesh (\c polyline->mesh) while reading, each \c VERTEX being
+ * freed as soon as it is read.\n
+ * Otherwise the vertices are appended to \c polyline->vertices.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_polyline_read_vertices
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfPolyline *polyline
+                /*!< a pointer to the DXF \c POLYLINE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        DxfVertex *vertex = NULL;
+        DxfVertex *last = NULL;
+        DxfSeqend *seqend = NULL;
+        DxfIndexedMesh *mesh = NULL;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (polyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((fp->build_meshes)
+          && (polyline->flag & (DXF_POLYLINE_FLAG_POLYGON_MESH | DXF_POLYLINE_FLAG_POLYFACE_MESH)))
+        {
+                mesh = dxf_indexed_mesh_init (dxf_indexed_mesh_new (),
+                  polyline->flag,
+                  polyline->polygon_mesh_M_vertex_count,
+                  polyline->polygon_mesh_N_vertex_count);
+                if (mesh == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        /* Append to the vertices already in the polyline. */
+        for (last = (DxfVertex *) polyline->vertices;
+          (last != NULL) && (last->next != NULL);
+          last = (DxfVertex *) last->next);
+        for (;;)
+        {
+                (fp->line_number)++;
+                if (fscanf (fp->fp, "%s\n", temp_string) != 1)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        break;
+                }
+                if (strcmp (temp_string, "VERTEX") == 0)
+                {
+                        vertex = dxf_vertex_read (fp, dxf_vertex_init (dxf_vertex_new ()));
+                        if (vertex == NULL)
+                        {
+                                break;
+                        }
+                        if (mesh != NULL)
+                        {
+                                dxf_indexed_mesh_add_vertex (mesh, vertex);
+                                dxf_vertex_free (vertex);
+                        }
+                        else if (last == NULL)
+                        {
+                                polyline->vertices = (struct DxfVertex *) vertex;
+                                last = vertex;
+                        }
+                        else
+                        {
+                                last->next = (struct DxfVertex *) vertex;
+                                last = vertex;
+                        }
+                }
+                else if (strcmp (temp_string, "SEQEND") == 0)
+                {
+                        seqend = dxf_seqend_read (fp, dxf_seqend_init (dxf_seqend_new ()));
+                        if (seqend != NULL)
+                        {
+                                dxf_seqend_free (seqend);
+                        }
+                        if (mesh != NULL)
+                        {
+                                dxf_indexed_mesh_finish (mesh);
+                                if (polyline->mesh != NULL)
+                                {
+                                        dxf_indexed_mesh_free ((DxfIndexedMesh *) polyline->mesh);
+                                }
+                                polyline->mesh = (struct DxfIndexedMesh *) mesh;
+                        }
+#if DEBUG
+                        DXF_DEBUG_END
+#endif
+                        return (EXIT_SUCCESS);
+                }
+                else
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () unexpected %s entity in the vertices of the POLYLINE with id-code: %x.\n")),
+                          __FUNCTION__, temp_string, polyline->id_code);
+                        break;
+                }
+        }
+        /* Clean up. */
+        if (mesh != NULL)
+        {
+                dxf_indexed_mesh_free (mesh);
+        }
+        return (EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Build an indexed mesh from the vertices of a polyface or
+ * polygon mesh DXF \c POLYLINE entity.
+ *
+ * The list of vertices is walked once, the mesh is stored in
+ * \c polyline->mesh (replacing a previous mesh) and the vertices are
+ * left in place.
+ *
+ * \return a pointer to the indexed mesh, or \c NULL when the polyline
+ * is not a mesh or an error occurred.
+ */
+DxfIndexedMesh *
+dxf_polyline_build_mesh
+(
+        DxfPolyline *polyline
+                /*!< a pointer to the DXF \c POLYLINE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfIndexedMesh *mesh = NULL;
+        DxfVertex *iter = NULL;
+
+        /* Do some basic checks. */
+        if (polyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (!(polyline->flag & (DXF_POLYLINE_FLAG_POLYGON_MESH | DXF_POLYLINE_FLAG_POLYFACE_MESH)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the POLYLINE with id-code: %x is not a mesh.\n")),
+                  __FUNCTION__, polyline->id_code);
+                return (NULL);
+        }
+        mesh = dxf_indexed_mesh_init (dxf_indexed_mesh_new (),
+          polyline->flag,
+          polyline->polygon_mesh_M_vertex_count,
+          polyline->polygon_mesh_N_vertex_count);
+        if (mesh == NULL)
+        {
+                return (NULL);
+        }
+        for (iter = (DxfVertex *) polyline->vertices; iter != NULL; iter = (DxfVertex *) iter->next)
+        {
+                dxf_indexed_mesh_add_vertex (mesh, iter);
+        }
+        if (dxf_indexed_mesh_finish (mesh) == EXIT_FAILURE)
+        {
+                dxf_indexed_mesh_free (mesh);
+                return (NULL);
+        }
+        if (polyline->mesh != NULL)
+        {
+                dxf_indexed_mesh_free ((DxfIndexedMesh *) polyline->mesh);
+        }
+        polyline->mesh = (struct DxfIndexedMesh *) mesh;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (mesh);
+}
+
+
+/*!
+ * \brief Get the indexed mesh from a DXF \c POLYLINE entity.
+ *
+ * \return a pointer to the indexed mesh, or \c NULL when the polyline
+ * has no indexed mesh or an error occurred.
+ */
+DxfIndexedMesh *
+dxf_polyline_get_mesh
+(
+        DxfPolyline *polyline
+                /*!< a pointer to the DXF \c POLYLINE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (polyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((DxfIndexedMesh *) polyline->mesh);
+}
+
+
+/*!
+ * \brief Set the indexed mesh for a DXF \c POLYLINE entity.
+ *
+ * \return a pointer to \c polyline when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfPolyline *
+dxf_polyline_set_mesh
+(
+        DxfPolyline *polyline,
+                /*!< a pointer to the DXF \c POLYLINE entity. */
+        DxfIndexedMesh *mesh
+                /*!< a pointer to an indexed mesh, owned by the polyline
+                 * from now on. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (polyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        polyline->mesh = (struct DxfIndexedMesh *) mesh;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (polyline);
+}
+
+
+/*!
+ * \brief Append a vertex to a DXF \c POLYLINE entity.
+ *
+ * The vertex is linked after the last vertex in \c vertices and added
+ * to the \c vertex_index, so appending does not walk the list.\n
+ * The first call indexes the vertices already linked into the
+ * polyline.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_polyline_append_vertex
+(
+        DxfPolyline *polyline,
+                /*!< a pointer to the DXF \c POLYLINE entity. */
+        DxfVertex *vertex
+                /*!< a pointer to the DXF \c VERTEX entity, owned by the
+                 * polyline from now on. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfChunkList *index = NULL;
+        DxfVertex **last = NULL;
+        DxfVertex *iter = NULL;
+
+        /* Do some basic checks. */
+        if ((polyline == NULL) || (vertex == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        index = (DxfChunkList *) polyline->vertex_index;
+        if (index == NULL)
+        {
+                index = dxf_chunk_list_init (dxf_chunk_list_new (),
+                  sizeof (DxfVertex *), 0);
+                if (index == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                for (iter = (DxfVertex *) polyline->vertices; iter != NULL; iter = (DxfVertex *) iter->next)
+                {
+                        if (dxf_chunk_list_append (index, &iter) == NULL)
+                        {
+                                dxf_chunk_list_free (index);
+                                return (EXIT_FAILURE);
+                        }
+                }
+                polyline->vertex_index = (struct DxfChunkList *) index;
+        }
+        last = (DxfVertex **) dxf_chunk_list_get_last (index);
+        if (dxf_chunk_list_append (index, &vertex) == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        vertex->next = NULL;
+        if (last == NULL)
+        {
+                polyline->vertices = (struct DxfVertex *) vertex;
+        }
+        else
+        {
+                (*last)->next = (struct DxfVertex *) vertex;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of vertices of a DXF \c POLYLINE entity.
+ *
+ * O(1) when the vertices were appended with
+ * \c dxf_polyline_append_vertex(), otherwise the list is walked.
+ *
+ * \return the number of vertices, or -1 when an error occurred.
+ */
+int
+dxf_polyline_get_number_of_vertices
+(
+        DxfPolyline *polyline
+                /*!< a pointer to the DXF \c POLYLINE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVertex *iter = NULL;
+        int number_of_vertices = 0;
+
+        /* Do some basic checks. */
+        if (polyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (polyline->vertex_index != NULL)
+        {
+                return (dxf_chunk_list_get_number_of_entries ((DxfChunkList *) polyline->vertex_index));
+        }
+        for (iter = (DxfVertex *) polyline->vertices; iter != NULL; iter = (DxfVertex *) iter->next)
+        {
+                number_of_vertices++;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (number_of_vertices);
+}
+
+
+/*!
+ * \brief Get a vertex of a DXF \c POLYLINE entity.
+ *
+ * Uses the \c vertex_index when present, otherwise the list is walked.
+ *
+ * \return a pointer to the vertex, or \c NULL when an error occurred.
+ */
+DxfVertex *
+dxf_polyline_get_vertex
+(
+        DxfPolyline *polyline,
+                /*!< a pointer to the DXF \c POLYLINE entity. */
+        int index
+                /*!< index of the vertex [0 .. number of vertices - 1]. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVertex **entry = NULL;
+        DxfVertex *iter = NULL;
+
+        /* Do some basic checks. */
+        if (polyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (index < 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () received an invalid value in index.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (polyline->vertex_index != NULL)
+        {
+                entry = (DxfVertex **) dxf_chunk_list_get ((DxfChunkList *) polyline->vertex_index, index);
+                return ((entry == NULL) ? NULL : *entry);
+        }
+        for (iter = (DxfVertex *) polyline->vertices;
+          (iter != NULL) && (index > 0);
+          iter = (DxfVertex *) iter->next)
+        {
+                index--;
+        }
+        if (iter == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () received an invalid value in index.\n")),
+                  __FUNCTION__);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (iter);
+}
+
+
 /* EOF */
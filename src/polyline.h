@@ -37,7 +37,12 @@
 
 
 #include "global.h"
+#include "intern.h"
+#include "handle_table.h"
 #include "vertex.h"
+#include "seqend.h"
+#include "indexed_mesh.h"
+#include "chunk_list.h"
 
 
 /*!
@@ -219,6 +224,20 @@ dxf_polyline
                  * \c NULL in the last DxfVertex.\n
                  * \note Not all members of the DxfVertex struct are
                  * used for polylines. */
+        struct DxfIndexedMesh *mesh;
+                /*!< Indexed mesh of a polyface or polygon mesh
+                 * polyline, \c NULL when the vertices are kept in
+                 * \c vertices. */
+        struct DxfChunkList *vertex_index;
+                /*!< Pointers to the vertices in \c vertices, in order,
+                 * for O(1) append and count and indexed access.\n
+                 * \c NULL until the first vertex is appended with
+                 * \c dxf_polyline_append_vertex(). */
+        struct DxfIntern *intern;
+                /*!< Intern table holding the interned symbol names of
+                 * this entity, \c NULL when none are interned.\n
+                 * Symbol names not found in this table are private
+                 * copies. */
         struct DxfPolyline *next;
                 /*!< pointer to the next DxfPolyline.\n
                  * \c NULL in the last DxfPolyline. */
@@ -254,6 +273,45 @@ dxf_polyline_free_chain
 (
         DxfPolyline *polylines
 );
+int
+dxf_polyline_read_vertices
+(
+        DxfFile *fp,
+        DxfPolyline *polyline
+);
+DxfIndexedMesh *
+dxf_polyline_build_mesh
+(
+        DxfPolyline *polyline
+);
+DxfIndexedMesh *
+dxf_polyline_get_mesh
+(
+        DxfPolyline *polyline
+);
+DxfPolyline *
+dxf_polyline_set_mesh
+(
+        DxfPolyline *polyline,
+        DxfIndexedMesh *mesh
+);
+int
+dxf_polyline_append_vertex
+(
+        DxfPolyline *polyline,
+        DxfVertex *vertex
+);
+int
+dxf_polyline_get_number_of_vertices
+(
+        DxfPolyline *polyline
+);
+DxfVertex *
+dxf_polyline_get_vertex
+(
+        DxfPolyline *polyline,
+        int index
+);
 
 
 #endif /* LIBDXF_SRC_POLYLINE_H */
@@ -0,0 +1,414 @@
+/*!
+ * \file pool.c
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Functions for libDXF per thread object pools.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <pthread.h>
+#include "pool.h"
+
+
+/*!
+ * \brief Definition of the object pools of one thread.
+ *
+ * Released objects are kept in a singly linked list per type of
+ * object, the link is stored in the first bytes of the released object
+ * itself.
+ */
+typedef struct
+dxf_pool_thread
+{
+        void *free_objects[DXF_POOL_NUMBER_OF_TYPES];
+                /*!< First released object per type of object. */
+        size_t sizes[DXF_POOL_NUMBER_OF_TYPES];
+                /*!< Size of the objects per type of object, 0 when no
+                 * object of this type was allocated by this thread. */
+        DxfPoolStats stats[DXF_POOL_NUMBER_OF_TYPES];
+                /*!< Counters per type of object. */
+} DxfPoolThread;
+
+
+static pthread_key_t dxf_pool_key;
+        /*!< Key for the \c DxfPoolThread of the calling thread. */
+static pthread_once_t dxf_pool_key_once = PTHREAD_ONCE_INIT;
+        /*!< Guard for the creation of \c dxf_pool_key. */
+
+
+/*!
+ * \brief Free all released objects kept in the pools of a thread.
+ */
+static void
+dxf_pool_thread_release
+(
+        DxfPoolThread *pool
+                /*!< a pointer to the pools of a thread. */
+)
+{
+        void *object = NULL;
+        int i;
+
+        for (i = 0; i < DXF_POOL_NUMBER_OF_TYPES; i++)
+        {
+                while (pool->free_objects[i] != NULL)
+                {
+                        object = pool->free_objects[i];
+                        pool->free_objects[i] = *(void **) object;
+                        free (object);
+                }
+                pool->stats[i].number_of_free_objects = 0;
+        }
+}
+
+
+/*!
+ * \brief Free the pools of a thread when the thread exits.
+ */
+static void
+dxf_pool_thread_free
+(
+        void *pool
+                /*!< a pointer to the pools of the exiting thread. */
+)
+{
+        dxf_pool_thread_release ((DxfPoolThread *) pool);
+        free (pool);
+}
+
+
+/*!
+ * \brief Create the key for the pools of the threads.
+ */
+static void
+dxf_pool_key_create ()
+{
+        pthread_key_create (&dxf_pool_key, dxf_pool_thread_free);
+}
+
+
+/*!
+ * \brief Get the pools of the calling thread, creating them when
+ * needed.
+ *
+ * \return a pointer to the pools, or \c NULL when no memory could be
+ * allocated.
+ */
+static DxfPoolThread *
+dxf_pool_get_thread ()
+{
+        DxfPoolThread *pool = NULL;
+
+        pthread_once (&dxf_pool_key_once, dxf_pool_key_create);
+        pool = pthread_getspecific (dxf_pool_key);
+        if (pool == NULL)
+        {
+                pool = calloc (1, sizeof (DxfPoolThread));
+                if (pool == NULL)
+                {
+                        return (NULL);
+                }
+                if (pthread_setspecific (dxf_pool_key, pool) != 0)
+                {
+                        free (pool);
+                        return (NULL);
+                }
+        }
+        return (pool);
+}
+
+
+/*!
+ * \brief Allocate a zero filled object from the pool of the calling
+ * thread.
+ *
+ * A released object of the same type is reused when available,
+ * otherwise the object is allocated with \c malloc().\n
+ * All objects of one type are expected to have the same \c size.
+ *
+ * \return a pointer to the object, or \c NULL when no memory could be
+ * allocated.
+ */
+void *
+dxf_pool_alloc
+(
+        DxfPoolType type,
+                /*!< the type of object. */
+        size_t size
+                /*!< the size of the object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoolThread *pool = NULL;
+        void *object = NULL;
+
+        /* Do some basic checks. */
+        if ((type < 0) || (type >= DXF_POOL_NUMBER_OF_TYPES))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid pool type was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        /* avoid malloc of less than the size of the free list link. */
+        if (size < sizeof (void *)) size = sizeof (void *);
+        pool = dxf_pool_get_thread ();
+        if ((pool != NULL)
+          && (pool->free_objects[type] != NULL)
+          && (pool->sizes[type] == size))
+        {
+                object = pool->free_objects[type];
+                pool->free_objects[type] = *(void **) object;
+                pool->stats[type].number_of_free_objects--;
+                pool->stats[type].hits++;
+        }
+        else
+        {
+                if ((object = malloc (size)) == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for a pooled object.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                if (pool != NULL)
+                {
+                        if (pool->free_objects[type] == NULL)
+                        {
+                                pool->sizes[type] = size;
+                        }
+                        pool->stats[type].misses++;
+                }
+        }
+        memset (object, 0, size);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (object);
+}
+
+
+/*!
+ * \brief Release an object to the pool of the calling thread.
+ *
+ * The object is kept for reuse by \c dxf_pool_alloc(), or freed when
+ * the pool is full or the object type was never allocated by this
+ * thread.\n
+ * Objects allocated by \c dxf_pool_alloc() may also be released with
+ * \c free().
+ */
+void
+dxf_pool_free
+(
+        DxfPoolType type,
+                /*!< the type of object. */
+        void *object
+                /*!< a pointer to the object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoolThread *pool = NULL;
+
+        /* Do some basic checks. */
+        if (object == NULL)
+        {
+                return;
+        }
+        if ((type < 0) || (type >= DXF_POOL_NUMBER_OF_TYPES))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid pool type was passed.\n")),
+                  __FUNCTION__);
+                free (object);
+                return;
+        }
+        pool = dxf_pool_get_thread ();
+        if ((pool == NULL) || (pool->sizes[type] == 0))
+        {
+                free (object);
+                return;
+        }
+        if (pool->stats[type].number_of_free_objects >= DXF_POOL_MAX_FREE_OBJECTS)
+        {
+                pool->stats[type].discards++;
+                free (object);
+                return;
+        }
+        *(void **) object = pool->free_objects[type];
+        pool->free_objects[type] = object;
+        pool->stats[type].number_of_free_objects++;
+        pool->stats[type].releases++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+}
+
+
+/*!
+ * \brief Allocate an empty string buffer of \c DXF_MAX_STRING_LENGTH
+ * characters from the pool of the calling thread.
+ *
+ * \return a pointer to the string buffer, or \c NULL when no memory
+ * could be allocated.
+ */
+char *
+dxf_pool_string_alloc ()
+{
+        return ((char *) dxf_pool_alloc (DXF_POOL_STRING,
+          DXF_MAX_STRING_LENGTH * sizeof (char)));
+}
+
+
+/*!
+ * \brief Release a string buffer allocated with
+ * \c dxf_pool_string_alloc() to the pool of the calling thread.
+ */
+void
+dxf_pool_string_free
+(
+        char *string
+                /*!< a pointer to the string buffer. */
+)
+{
+        dxf_pool_free (DXF_POOL_STRING, string);
+}
+
+
+/*!
+ * \brief Get the counters of a pool of the calling thread.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_pool_get_stats
+(
+        DxfPoolType type,
+                /*!< the type of object. */
+        DxfPoolStats *stats
+                /*!< a pointer to the counters to fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoolThread *pool = NULL;
+
+        /* Do some basic checks. */
+        if (stats == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((type < 0) || (type >= DXF_POOL_NUMBER_OF_TYPES))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid pool type was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        pool = dxf_pool_get_thread ();
+        if (pool == NULL)
+        {
+                memset (stats, 0, sizeof (DxfPoolStats));
+                return (EXIT_FAILURE);
+        }
+        *stats = pool->stats[type];
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Reset the hit, miss, release and discard counters of the
+ * pools of the calling thread.
+ */
+void
+dxf_pool_reset_stats ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoolThread *pool = NULL;
+        int i;
+
+        pool = dxf_pool_get_thread ();
+        if (pool == NULL)
+        {
+                return;
+        }
+        for (i = 0; i < DXF_POOL_NUMBER_OF_TYPES; i++)
+        {
+                pool->stats[i].hits = 0;
+                pool->stats[i].misses = 0;
+                pool->stats[i].releases = 0;
+                pool->stats[i].discards = 0;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+}
+
+
+/*!
+ * \brief Free all released objects kept in the pools of the calling
+ * thread.
+ *
+ * The pools of a thread are freed automatically when the thread exits,
+ * this function returns the memory earlier (e.g. between batches).
+ */
+void
+dxf_pool_release ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoolThread *pool = NULL;
+
+        pthread_once (&dxf_pool_key_once, dxf_pool_key_create);
+        pool = pthread_getspecific (dxf_pool_key);
+        if (pool != NULL)
+        {
+                dxf_pool_thread_release (pool);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+}
+
+
+/* EOF */
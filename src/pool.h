@@ -0,0 +1,122 @@
+/*!
+ * \file pool.h
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Header file for libDXF per thread object pools.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_POOL_H
+#define LIBDXF_SRC_POOL_H
+
+
+#include "global.h"
+
+
+#define DXF_POOL_MAX_FREE_OBJECTS 256
+        /*!< \brief The maximum number of released objects kept per
+         * type of object in the pool of a thread, further released
+         * objects are freed. */
+
+
+/*!
+ * \brief Types of objects recycled by the libDXF object pools.
+ */
+typedef enum
+dxf_pool_type
+{
+        DXF_POOL_LINE,
+                /*!< \c DxfLine structs. */
+        DXF_POOL_POINT,
+                /*!< \c DxfPoint structs. */
+        DXF_POOL_VERTEX,
+                /*!< \c DxfVertex structs. */
+        DXF_POOL_STRING,
+                /*!< String buffers of \c DXF_MAX_STRING_LENGTH
+                 * characters. */
+        DXF_POOL_NUMBER_OF_TYPES
+                /*!< Number of types of objects. */
+} DxfPoolType;
+
+
+/*!
+ * \brief Counters of a libDXF object pool.
+ */
+typedef struct
+dxf_pool_stats
+{
+        unsigned long hits;
+                /*!< Number of allocations served from the pool. */
+        unsigned long misses;
+                /*!< Number of allocations served by \c malloc(). */
+        unsigned long releases;
+                /*!< Number of released objects kept in the pool. */
+        unsigned long discards;
+                /*!< Number of released objects freed because the pool
+                 * was full. */
+        int number_of_free_objects;
+                /*!< Number of objects currently kept in the pool. */
+} DxfPoolStats;
+
+
+void *
+dxf_pool_alloc
+(
+        DxfPoolType type,
+        size_t size
+);
+void
+dxf_pool_free
+(
+        DxfPoolType type,
+        void *object
+);
+char *
+dxf_pool_string_alloc ();
+void
+dxf_pool_string_free
+(
+        char *string
+);
+int
+dxf_pool_get_stats
+(
+        DxfPoolType type,
+        DxfPoolStats *stats
+);
+void
+dxf_pool_reset_stats ();
+void
+dxf_pool_release ();
+
+
+#endif /* LIBDXF_SRC_POOL_H */
+
+
+/* EOF */
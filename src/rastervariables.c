@@ -35,6 +35,8 @@
 
 
 #include "rastervariables.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -170,7 +172,7 @@ dxf_rastervariables_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -188,9 +190,10 @@ dxf_rastervariables_read
                 rastervariables = dxf_rastervariables_init (rastervariables);
         }
         i = 0;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -198,7 +201,7 @@ dxf_rastervariables_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -209,21 +212,21 @@ dxf_rastervariables_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%x\n", &rastervariables->id_code);
                 }
-                if (strcmp (temp_string, "70") == 0)
+                else if (strcmp (temp_string, "70") == 0)
                 {
                         /* Now follows a string containing a display
                          * image frame flag value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &rastervariables->display_image_frame);
                 }
-                if (strcmp (temp_string, "71") == 0)
+                else if (strcmp (temp_string, "71") == 0)
                 {
                         /* Now follows a string containing a display
                          * quality flag value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &rastervariables->display_quality);
                 }
-                if (strcmp (temp_string, "72") == 0)
+                else if (strcmp (temp_string, "72") == 0)
                 {
                         /* Now follows a string containing a units
                          * value. */
@@ -256,7 +259,7 @@ dxf_rastervariables_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", rastervariables->dictionary_owner_soft);
+                        rastervariables->dictionary_owner_soft = dxf_read_string (fp, rastervariables->dictionary_owner_soft);
                         i++;
                 }
                 else if (strcmp (temp_string, "360") == 0)
@@ -264,7 +267,7 @@ dxf_rastervariables_read
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", rastervariables->dictionary_owner_hard);
+                        rastervariables->dictionary_owner_hard = dxf_read_string (fp, rastervariables->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -278,10 +281,16 @@ dxf_rastervariables_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
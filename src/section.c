@@ -33,25 +33,31 @@
 
 
 #include "section.h"
+#include "drawing.h"
 
 
 /*!
  * \brief Function reads a SECTION in a DXF file.
+ *
+ * \warning Only the \c HEADER and \c ENTITIES sections are parsed into
+ * \c drawing; the contents of the \c CLASSES, \c TABLES, \c BLOCKS,
+ * \c OBJECTS and \c THUMBNAIL sections are not read.
  */
 int
 dxf_section_read
 (
-        DxfFile *fp
+        DxfFile *fp,
                 /*!< DXF file handle of input file (or device). */
+        DxfDrawing *drawing
+                /*!< the drawing receiving the sections read, holds
+                 * all parse state. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         char *temp_string = NULL;
-        DxfHeader dxf_header;
-        DxfBlock dxf_block;
-        char *dxf_entities_list = NULL;
+        DxfHeader *header = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -59,8 +65,19 @@ dxf_section_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
+                return (EXIT_FAILURE);
+        }
+        if ((drawing == NULL) || (drawing->header == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        header = (DxfHeader *) drawing->header;
+        temp_string = dxf_pool_string_alloc ();
+        if (temp_string == NULL)
+        {
                 return (EXIT_FAILURE);
         }
         dxf_read_line (temp_string, fp);
@@ -72,7 +89,7 @@ dxf_section_read
                         if (strcmp (temp_string, "HEADER") == 0)
                         {
                                 /* We have found the begin of the HEADER section. */
-                                dxf_header_read (fp, &dxf_header);
+                                dxf_header_read (fp, header);
                         }
                         else if (strcmp (temp_string, "CLASSES") == 0)
                         {
@@ -93,17 +110,14 @@ dxf_section_read
 //                                (
 //                                        fp->fp,
 //                                        &dxf_blocks_list,
-//                                        dxf_header._AcadVer
+//                                        header->_AcadVer
 //                                );
                         }
                         else if (strcmp (temp_string, "ENTITIES") == 0)
                         {
                                 /* We have found the begin of the ENTITIES sction. */
-                                dxf_entities_read_table (fp->filename,
-                                                   fp->fp,
-                                                   fp->line_number,
-                                                   dxf_entities_list,
-                                                   dxf_header._AcadVer);                        }
+                                dxf_entities_read_table (fp, drawing);
+                        }
                         else if (strcmp (temp_string, "OBJECTS") == 0)
                         {
                                 /* We have found the begin of the OBJECTS sction. */
@@ -123,7 +137,7 @@ dxf_section_read
                   __FUNCTION__, fp->line_number, fp->filename);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
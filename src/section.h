@@ -41,9 +41,15 @@
 #include "header.h"
 #include "util.h"
 #include "block.h"
+#include "pool.h"
 
 
-int dxf_section_read (DxfFile *fp);
+/* Defined in drawing.h, which can not be included here as it
+ * includes this file indirectly. */
+struct dxf_drawing_struct;
+
+
+int dxf_section_read (DxfFile *fp, struct dxf_drawing_struct *drawing);
 int dxf_section_write (DxfFile *fp, char *section_name);
 
 
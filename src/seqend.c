@@ -33,6 +33,8 @@
 
 
 #include "seqend.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -174,7 +176,7 @@ dxf_seqend_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (seqend == NULL)
@@ -185,9 +187,10 @@ dxf_seqend_read
                 seqend = dxf_seqend_new ();
                 seqend = dxf_seqend_init (seqend);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -196,7 +199,7 @@ dxf_seqend_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -211,13 +214,13 @@ dxf_seqend_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", seqend->linetype);
+                        seqend->linetype = dxf_read_string (fp, seqend->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", seqend->layer);
+                        seqend->layer = dxf_read_string (fp, seqend->layer);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                         && (strcmp (temp_string, "38") == 0)
@@ -282,14 +285,14 @@ dxf_seqend_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", seqend->dictionary_owner_soft);
+                        seqend->dictionary_owner_soft = dxf_read_string (fp, seqend->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", seqend->dictionary_owner_hard);
+                        seqend->dictionary_owner_hard = dxf_read_string (fp, seqend->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -303,7 +306,13 @@ dxf_seqend_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (seqend->linetype, "") == 0)
@@ -315,7 +324,7 @@ dxf_seqend_read
                 seqend->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -356,6 +365,8 @@ dxf_seqend_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("SEQEND");
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -376,7 +387,8 @@ dxf_seqend_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (seqend->linetype, "") == 0)
+        linetype = seqend->linetype;
+        if (strcmp (linetype, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -384,9 +396,10 @@ dxf_seqend_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                seqend->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = DXF_DEFAULT_LINETYPE;
         }
-        if (strcmp (seqend->layer, "") == 0)
+        layer = seqend->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -394,7 +407,7 @@ dxf_seqend_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                seqend->layer = DXF_DEFAULT_LAYER;
+                layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -435,16 +448,16 @@ dxf_seqend_write
         {
                 fprintf (fp->fp, "100\nAcDbEntity\n");
         }
-        fprintf (fp->fp, "  8\n%s\n", seqend->layer);
+        fprintf (fp->fp, "  8\n%s\n", layer);
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
           && (seqend->elevation != 0.0))
         {
                 fprintf (fp->fp, " 38\n%f\n", seqend->elevation);
         }
-        if (strcmp (seqend->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        if (strcmp (linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", seqend->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if (seqend->color != DXF_COLOR_BYLAYER)
         {
@@ -33,6 +33,8 @@
 
 
 #include "shape.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -185,7 +187,7 @@ dxf_shape_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (shape == NULL)
@@ -196,9 +198,10 @@ dxf_shape_read
                 shape = dxf_shape_new ();
                 shape = dxf_shape_init (shape);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -207,7 +210,7 @@ dxf_shape_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "2") == 0)
@@ -215,7 +218,7 @@ dxf_shape_read
                         /* Now follows a string containing a shape
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", shape->shape_name);
+                        shape->shape_name = dxf_read_string (fp, shape->shape_name);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -229,13 +232,13 @@ dxf_shape_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", shape->linetype);
+                        shape->linetype = dxf_read_string (fp, shape->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", shape->layer);
+                        shape->layer = dxf_read_string (fp, shape->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -371,14 +374,14 @@ dxf_shape_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", shape->dictionary_owner_soft);
+                        shape->dictionary_owner_soft = dxf_read_string (fp, shape->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", shape->dictionary_owner_hard);
+                        shape->dictionary_owner_hard = dxf_read_string (fp, shape->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -392,7 +395,13 @@ dxf_shape_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (shape->shape_name, "") == 0)
@@ -411,7 +420,7 @@ dxf_shape_read
                 shape->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -445,6 +454,8 @@ dxf_shape_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("SHAPE");
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -474,7 +485,8 @@ dxf_shape_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (shape->linetype, "") == 0)
+        linetype = shape->linetype;
+        if (strcmp (linetype, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -482,9 +494,10 @@ dxf_shape_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                shape->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = DXF_DEFAULT_LINETYPE;
         }
-        if (strcmp (shape->layer, "") == 0)
+        layer = shape->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -492,7 +505,7 @@ dxf_shape_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                shape->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = DXF_DEFAULT_LAYER;
         }
         if (shape->size == 0.0)
         {
@@ -544,10 +557,10 @@ dxf_shape_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", shape->layer);
-        if (strcmp (shape->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (strcmp (linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", shape->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
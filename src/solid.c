@@ -40,6 +40,8 @@
 
 
 #include "solid.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -146,6 +148,7 @@ dxf_solid_init
         solid->paperspace = DXF_MODELSPACE;
         solid->dictionary_owner_soft = strdup ("");
         solid->dictionary_owner_hard = strdup ("");
+        solid->intern = NULL;
         solid->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -192,7 +195,7 @@ dxf_solid_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (solid == NULL)
@@ -203,9 +206,13 @@ dxf_solid_read
                 solid = dxf_solid_new ();
                 solid = dxf_solid_init (solid);
         }
+        /* The symbol names are interned in the intern table of the
+         * file. */
+        solid->intern = fp->intern;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -214,7 +221,7 @@ dxf_solid_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -229,13 +236,13 @@ dxf_solid_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->linetype);
+                        solid->linetype = dxf_intern_read_string (fp, solid->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->layer);
+                        solid->layer = dxf_intern_read_string (fp, solid->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -402,14 +409,14 @@ dxf_solid_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->dictionary_owner_soft);
+                        solid->dictionary_owner_soft = dxf_read_string (fp, solid->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->dictionary_owner_hard);
+                        solid->dictionary_owner_hard = dxf_read_string (fp, solid->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -423,19 +430,37 @@ dxf_solid_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
+        /* Symbol names not found in the file are still the copies
+         * made by the init function. */
+        solid->linetype = dxf_intern_adopt_string ((DxfIntern *) solid->intern, solid->linetype);
+        solid->layer = dxf_intern_adopt_string ((DxfIntern *) solid->intern, solid->layer);
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (solid->linetype, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) solid->intern, solid->linetype, DXF_INTERN_ID_EMPTY))
+        {
+                dxf_intern_free_string ((DxfIntern *) solid->intern, solid->linetype);
+                solid->linetype = dxf_intern_string ((DxfIntern *) solid->intern, DXF_DEFAULT_LINETYPE);
+        }
+        if (dxf_intern_is_symbol ((DxfIntern *) solid->intern, solid->layer, DXF_INTERN_ID_EMPTY))
         {
-                solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_intern_free_string ((DxfIntern *) solid->intern, solid->layer);
+                solid->layer = dxf_intern_string ((DxfIntern *) solid->intern, DXF_DEFAULT_LAYER);
         }
-        if (strcmp (solid->layer, "") == 0)
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (solid->id_code > 0))
         {
-                solid->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) solid->id_code, SOLID, solid);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -468,6 +493,8 @@ dxf_solid_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("SOLID");
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -488,7 +515,8 @@ dxf_solid_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (solid->linetype, "") == 0)
+        linetype = solid->linetype;
+        if (dxf_intern_is_symbol ((DxfIntern *) solid->intern, linetype, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -496,9 +524,10 @@ dxf_solid_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = dxf_intern_get_symbol ((DxfIntern *) solid->intern, DXF_INTERN_ID_DEFAULT_LINETYPE);
         }
-        if (strcmp (solid->layer, "") == 0)
+        layer = solid->layer;
+        if (dxf_intern_is_symbol ((DxfIntern *) solid->intern, layer, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -506,7 +535,7 @@ dxf_solid_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                solid->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = dxf_intern_get_symbol ((DxfIntern *) solid->intern, DXF_INTERN_ID_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -546,10 +575,10 @@ dxf_solid_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", solid->layer);
-        if (strcmp (solid->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (!dxf_intern_is_symbol ((DxfIntern *) solid->intern, linetype, DXF_INTERN_ID_DEFAULT_LINETYPE))
         {
-                fprintf (fp->fp, "  6\n%s\n", solid->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
@@ -638,8 +667,8 @@ dxf_solid_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (solid->linetype);
-        free (solid->layer);
+        dxf_intern_free_string ((DxfIntern *) solid->intern, solid->linetype);
+        dxf_intern_free_string ((DxfIntern *) solid->intern, solid->layer);
         free (solid->dictionary_owner_soft);
         free (solid->dictionary_owner_hard);
         free (solid);
@@ -44,6 +44,8 @@
 
 
 #include "global.h"
+#include "intern.h"
+#include "handle_table.h"
 
 
 /*!
@@ -161,6 +163,11 @@ dxf_solid
                 /*!< Z-value of the extrusion vector.\n
                  * Defaults to 1.0 if ommitted in the DXF file.\n
                  * Group code = 230. */
+        struct DxfIntern *intern;
+                /*!< Intern table holding the interned symbol names of
+                 * this entity, \c NULL when none are interned.\n
+                 * Symbol names not found in this table are private
+                 * copies. */
         struct DxfSolid *next;
                 /*!< pointer to the next DxfSolid.\n
                  * \c NULL in the last DxfSolid. */
@@ -35,6 +35,8 @@
 
 
 #include "sortentstable.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -176,7 +178,7 @@ dxf_sortentstable_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -196,9 +198,10 @@ dxf_sortentstable_read
         i = 0;
         j = 0;
         k = 0;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -206,7 +209,7 @@ dxf_sortentstable_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -246,7 +249,7 @@ dxf_sortentstable_read
                         /* Now follows a string containing a soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", sortentstable->dictionary_owner_soft);
+                        sortentstable->dictionary_owner_soft = dxf_read_string (fp, sortentstable->dictionary_owner_soft);
                         j++;
                 }
                 else if ((strcmp (temp_string, "330") == 0)
@@ -256,7 +259,7 @@ dxf_sortentstable_read
                          * ID/handle to owner (currently only the
                          * *MODEL_SPACE or *PAPER_SPACE blocks). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", sortentstable->block_owner);
+                        sortentstable->block_owner = dxf_read_string (fp, sortentstable->block_owner);
                         j++;
                         /*! \todo Check for overrun of array index. */
                 }
@@ -275,7 +278,7 @@ dxf_sortentstable_read
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", sortentstable->dictionary_owner_hard);
+                        sortentstable->dictionary_owner_hard = dxf_read_string (fp, sortentstable->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -289,10 +292,16 @@ dxf_sortentstable_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -35,6 +35,8 @@
 
 
 #include "spatial_filter.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -192,7 +194,7 @@ dxf_spatial_filter_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -212,9 +214,10 @@ dxf_spatial_filter_read
         i = 0;
         j = 0;
         k = 0;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -222,7 +225,7 @@ dxf_spatial_filter_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -383,7 +386,7 @@ dxf_spatial_filter_read
                          * of the normal to the plane containing the
                          * clip boundary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spatial_filter->dictionary_owner_soft);
+                        spatial_filter->dictionary_owner_soft = dxf_read_string (fp, spatial_filter->dictionary_owner_soft);
                         i++;
                 }
                 else if (strcmp (temp_string, "360") == 0)
@@ -391,7 +394,7 @@ dxf_spatial_filter_read
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spatial_filter->dictionary_owner_hard);
+                        spatial_filter->dictionary_owner_hard = dxf_read_string (fp, spatial_filter->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -405,10 +408,16 @@ dxf_spatial_filter_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
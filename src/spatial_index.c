@@ -35,6 +35,8 @@
 
 
 #include "spatial_index.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -181,7 +183,7 @@ dxf_spatial_index_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
@@ -199,9 +201,10 @@ dxf_spatial_index_read
                 spatial_index = dxf_spatial_index_init (spatial_index);
         }
         i = 0;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -209,7 +212,7 @@ dxf_spatial_index_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -220,7 +223,7 @@ dxf_spatial_index_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%x\n", &spatial_index->id_code);
                 }
-                if (strcmp (temp_string, "40") == 0)
+                else if (strcmp (temp_string, "40") == 0)
                 {
                         /* Now follows a string containing a timestamp
                          * (Julian date). */
@@ -247,7 +250,7 @@ dxf_spatial_index_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spatial_index->dictionary_owner_soft);
+                        spatial_index->dictionary_owner_soft = dxf_read_string (fp, spatial_index->dictionary_owner_soft);
                         i++;
                 }
                 else if (strcmp (temp_string, "360") == 0)
@@ -255,7 +258,7 @@ dxf_spatial_index_read
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spatial_index->dictionary_owner_hard);
+                        spatial_index->dictionary_owner_hard = dxf_read_string (fp, spatial_index->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -269,10 +272,16 @@ dxf_spatial_index_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -464,4 +473,1803 @@ dxf_spatial_index_free_chain
 }
 
 
+/*!
+ * \brief Definition of an entry of a level of a Sort-Tile-Recursive
+ * bulk load.
+ */
+typedef struct
+dxf_spatial_index_entry
+{
+        DxfBounds bounds;
+                /*!< Bounds of the child. */
+        void *child;
+                /*!< The child, an item or a node. */
+} DxfSpatialIndexEntry;
+
+
+/*!
+ * \brief Test if two bounds overlap in the XY plane.
+ *
+ * \return \c TRUE when the bounds overlap, \c FALSE otherwise.
+ */
+static int
+dxf_spatial_index_intersects
+(
+        const DxfBounds *a,
+                /*!< a pointer to bounds. */
+        const DxfBounds *b
+                /*!< a pointer to bounds. */
+)
+{
+        return ((a->min.x <= b->max.x) && (a->max.x >= b->min.x)
+          && (a->min.y <= b->max.y) && (a->max.y >= b->min.y));
+}
+
+
+/*!
+ * \brief Test if bounds contain other bounds in the XY plane.
+ *
+ * \return \c TRUE when \c outer contains \c inner, \c FALSE otherwise.
+ */
+static int
+dxf_spatial_index_contains
+(
+        const DxfBounds *outer,
+                /*!< a pointer to the outer bounds. */
+        const DxfBounds *inner
+                /*!< a pointer to the inner bounds. */
+)
+{
+        return ((inner->min.x >= outer->min.x) && (inner->max.x <= outer->max.x)
+          && (inner->min.y >= outer->min.y) && (inner->max.y <= outer->max.y));
+}
+
+
+/*!
+ * \brief Get the union of two bounds.
+ *
+ * \return the union.
+ */
+static DxfBounds
+dxf_spatial_index_union
+(
+        const DxfBounds *a,
+                /*!< a pointer to bounds. */
+        const DxfBounds *b
+                /*!< a pointer to bounds. */
+)
+{
+        DxfBounds u = *a;
+
+        dxf_bounds_add_bounds (&u, (DxfBounds *) b);
+        return (u);
+}
+
+
+/*!
+ * \brief Get the area of bounds in the XY plane.
+ *
+ * \return the area.
+ */
+static double
+dxf_spatial_index_area
+(
+        const DxfBounds *bounds
+                /*!< a pointer to bounds. */
+)
+{
+        if (dxf_bounds_is_empty ((DxfBounds *) bounds))
+        {
+                return (0.0);
+        }
+        return ((bounds->max.x - bounds->min.x) * (bounds->max.y - bounds->min.y));
+}
+
+
+/*!
+ * \brief Allocate an empty node.
+ *
+ * \return a pointer to the node, or \c NULL when no memory could be
+ * allocated.
+ */
+static DxfSpatialIndexNode *
+dxf_spatial_index_node_new
+(
+        int leaf
+                /*!< \c TRUE for a leaf node. */
+)
+{
+        DxfSpatialIndexNode *node = NULL;
+
+        if ((node = malloc (sizeof (DxfSpatialIndexNode))) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfSpatialIndexNode struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (node, 0, sizeof (DxfSpatialIndexNode));
+        node->leaf = leaf;
+        return (node);
+}
+
+
+/*!
+ * \brief Free a node and all nodes below it.
+ */
+static void
+dxf_spatial_index_node_free
+(
+        DxfSpatialIndexNode *node
+                /*!< a pointer to the node. */
+)
+{
+        int i;
+
+        if (node == NULL)
+        {
+                return;
+        }
+        if (!node->leaf)
+        {
+                for (i = 0; i < node->number_of_entries; i++)
+                {
+                        dxf_spatial_index_node_free ((DxfSpatialIndexNode *) node->children[i]);
+                }
+        }
+        free (node);
+}
+
+
+/*!
+ * \brief Get the bounds of all children of a node.
+ *
+ * \return the bounds.
+ */
+static DxfBounds
+dxf_spatial_index_node_get_bounds
+(
+        DxfSpatialIndexNode *node
+                /*!< a pointer to the node. */
+)
+{
+        DxfBounds bounds;
+        int i;
+
+        dxf_bounds_init (&bounds);
+        for (i = 0; i < node->number_of_entries; i++)
+        {
+                dxf_bounds_add_bounds (&bounds, &node->bounds[i]);
+        }
+        return (bounds);
+}
+
+
+/*!
+ * \brief Append a child to a node and link the child to the node.
+ */
+static void
+dxf_spatial_index_node_append
+(
+        DxfSpatialIndexNode *node,
+                /*!< a pointer to the node. */
+        DxfBounds *bounds,
+                /*!< bounds of the child. */
+        void *child
+                /*!< the child, an item or a node. */
+)
+{
+        node->bounds[node->number_of_entries] = *bounds;
+        node->children[node->number_of_entries] = child;
+        node->number_of_entries++;
+        if (node->leaf)
+        {
+                ((DxfSpatialIndexItem *) child)->leaf = (struct DxfSpatialIndexNode *) node;
+        }
+        else
+        {
+                ((DxfSpatialIndexNode *) child)->parent = (struct DxfSpatialIndexNode *) node;
+        }
+}
+
+
+/*!
+ * \brief Get the index of a child in a node.
+ *
+ * \return the index, or -1 when the child is not found.
+ */
+static int
+dxf_spatial_index_node_find
+(
+        DxfSpatialIndexNode *node,
+                /*!< a pointer to the node. */
+        void *child
+                /*!< the child. */
+)
+{
+        int i;
+
+        for (i = 0; i < node->number_of_entries; i++)
+        {
+                if (node->children[i] == child)
+                {
+                        return (i);
+                }
+        }
+        return (-1);
+}
+
+
+/*!
+ * \brief Split an overflowing node with the quadratic split of
+ * Guttman.
+ *
+ * \return a pointer to the new sibling node, or \c NULL when no memory
+ * could be allocated.
+ */
+static DxfSpatialIndexNode *
+dxf_spatial_index_node_split
+(
+        DxfSpatialIndexNode *node
+                /*!< a pointer to the overflowing node. */
+)
+{
+        DxfSpatialIndexNode *sibling = NULL;
+        DxfBounds bounds[DXF_SPATIAL_INDEX_TREE_MAX_ENTRIES + 1];
+        void *children[DXF_SPATIAL_INDEX_TREE_MAX_ENTRIES + 1];
+        int assigned[DXF_SPATIAL_INDEX_TREE_MAX_ENTRIES + 1];
+        DxfBounds group_bounds[2];
+        DxfBounds u;
+        DxfSpatialIndexNode *group[2];
+        int n = node->number_of_entries;
+        int remaining;
+        int seed_a = 0;
+        int seed_b = 1;
+        int best;
+        int target;
+        int preferred = 0;
+        int g;
+        int i;
+        int j;
+        double waste;
+        double worst = -HUGE_VAL;
+        double d0;
+        double d1;
+        double best_difference;
+
+        if ((sibling = dxf_spatial_index_node_new (node->leaf)) == NULL)
+        {
+                return (NULL);
+        }
+        memcpy (bounds, node->bounds, n * sizeof (DxfBounds));
+        memcpy (children, node->children, n * sizeof (void *));
+        /* Pick the pair of entries wasting the most area as seeds. */
+        for (i = 0; i < n; i++)
+        {
+                for (j = i + 1; j < n; j++)
+                {
+                        u = dxf_spatial_index_union (&bounds[i], &bounds[j]);
+                        waste = dxf_spatial_index_area (&u)
+                          - dxf_spatial_index_area (&bounds[i])
+                          - dxf_spatial_index_area (&bounds[j]);
+                        if (waste > worst)
+                        {
+                                worst = waste;
+                                seed_a = i;
+                                seed_b = j;
+                        }
+                }
+        }
+        memset (assigned, 0, sizeof (assigned));
+        group[0] = node;
+        group[1] = sibling;
+        node->number_of_entries = 0;
+        dxf_spatial_index_node_append (node, &bounds[seed_a], children[seed_a]);
+        dxf_spatial_index_node_append (sibling, &bounds[seed_b], children[seed_b]);
+        group_bounds[0] = bounds[seed_a];
+        group_bounds[1] = bounds[seed_b];
+        assigned[seed_a] = TRUE;
+        assigned[seed_b] = TRUE;
+        remaining = n - 2;
+        while (remaining > 0)
+        {
+                /* A group which needs all remaining entries to reach
+                 * the minimum gets them. */
+                target = -1;
+                for (g = 0; g < 2; g++)
+                {
+                        if (group[g]->number_of_entries + remaining <= DXF_SPATIAL_INDEX_TREE_MIN_ENTRIES)
+                        {
+                                target = g;
+                        }
+                }
+                /* Otherwise pick the entry with the largest preference
+                 * for one group. */
+                best = -1;
+                best_difference = -1.0;
+                for (i = 0; i < n; i++)
+                {
+                        if (assigned[i])
+                        {
+                                continue;
+                        }
+                        u = dxf_spatial_index_union (&group_bounds[0], &bounds[i]);
+                        d0 = dxf_spatial_index_area (&u) - dxf_spatial_index_area (&group_bounds[0]);
+                        u = dxf_spatial_index_union (&group_bounds[1], &bounds[i]);
+                        d1 = dxf_spatial_index_area (&u) - dxf_spatial_index_area (&group_bounds[1]);
+                        if (fabs (d0 - d1) > best_difference)
+                        {
+                                best_difference = fabs (d0 - d1);
+                                best = i;
+                                if (d0 != d1)
+                                {
+                                        preferred = (d0 < d1) ? 0 : 1;
+                                }
+                                else
+                                {
+                                        preferred = (group[0]->number_of_entries <= group[1]->number_of_entries) ? 0 : 1;
+                                }
+                        }
+                        if (target >= 0)
+                        {
+                                break;
+                        }
+                }
+                g = (target >= 0) ? target : preferred;
+                dxf_spatial_index_node_append (group[g], &bounds[best], children[best]);
+                group_bounds[g] = dxf_spatial_index_union (&group_bounds[g], &bounds[best]);
+                assigned[best] = TRUE;
+                remaining--;
+        }
+        return (sibling);
+}
+
+
+/*!
+ * \brief Propagate a change of a node up to the root, splitting
+ * overflowing nodes on the way.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_spatial_index_adjust_tree
+(
+        DxfSpatialIndexTree *tree,
+                /*!< a pointer to the tree. */
+        DxfSpatialIndexNode *node
+                /*!< the changed node. */
+)
+{
+        DxfSpatialIndexNode *sibling = NULL;
+        DxfSpatialIndexNode *parent = NULL;
+        DxfSpatialIndexNode *root = NULL;
+        DxfBounds bounds;
+        int i;
+
+        while (node != NULL)
+        {
+                sibling = NULL;
+                if (node->number_of_entries > DXF_SPATIAL_INDEX_TREE_MAX_ENTRIES)
+                {
+                        if ((sibling = dxf_spatial_index_node_split (node)) == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+                parent = (DxfSpatialIndexNode *) node->parent;
+                if (parent == NULL)
+                {
+                        if (sibling != NULL)
+                        {
+                                /* Grow a new root. */
+                                if ((root = dxf_spatial_index_node_new (FALSE)) == NULL)
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                                bounds = dxf_spatial_index_node_get_bounds (node);
+                                dxf_spatial_index_node_append (root, &bounds, node);
+                                bounds = dxf_spatial_index_node_get_bounds (sibling);
+                                dxf_spatial_index_node_append (root, &bounds, sibling);
+                                tree->root = (struct DxfSpatialIndexNode *) root;
+                        }
+                        break;
+                }
+                i = dxf_spatial_index_node_find (parent, node);
+                parent->bounds[i] = dxf_spatial_index_node_get_bounds (node);
+                if (sibling != NULL)
+                {
+                        bounds = dxf_spatial_index_node_get_bounds (sibling);
+                        dxf_spatial_index_node_append (parent, &bounds, sibling);
+                }
+                node = parent;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Insert an item into the leaf needing the least enlargement.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_spatial_index_insert_item
+(
+        DxfSpatialIndexTree *tree,
+                /*!< a pointer to the tree. */
+        DxfSpatialIndexItem *item
+                /*!< the item. */
+)
+{
+        DxfSpatialIndexNode *node = (DxfSpatialIndexNode *) tree->root;
+        DxfBounds u;
+        double enlargement;
+        double area;
+        double best_enlargement;
+        double best_area;
+        int best;
+        int i;
+
+        while (!node->leaf)
+        {
+                best = 0;
+                best_enlargement = HUGE_VAL;
+                best_area = HUGE_VAL;
+                for (i = 0; i < node->number_of_entries; i++)
+                {
+                        area = dxf_spatial_index_area (&node->bounds[i]);
+                        u = dxf_spatial_index_union (&node->bounds[i], &item->bounds);
+                        enlargement = dxf_spatial_index_area (&u) - area;
+                        if ((enlargement < best_enlargement)
+                          || ((enlargement == best_enlargement) && (area < best_area)))
+                        {
+                                best = i;
+                                best_enlargement = enlargement;
+                                best_area = area;
+                        }
+                }
+                node = (DxfSpatialIndexNode *) node->children[best];
+        }
+        dxf_spatial_index_node_append (node, &item->bounds, item);
+        return (dxf_spatial_index_adjust_tree (tree, node));
+}
+
+
+/*!
+ * \brief Collect the items below a node and free the nodes.
+ *
+ * \return the number of items in \c items.
+ */
+static int
+dxf_spatial_index_collect_items
+(
+        DxfSpatialIndexNode *node,
+                /*!< a pointer to the node, freed. */
+        DxfSpatialIndexItem ***items,
+                /*!< a pointer to an allocated array of items. */
+        int number_of_items,
+                /*!< number of items already in the array. */
+        int *items_size
+                /*!< a pointer to the number of allocated entries. */
+)
+{
+        DxfSpatialIndexItem **new_items = NULL;
+        int i;
+
+        for (i = 0; i < node->number_of_entries; i++)
+        {
+                if (!node->leaf)
+                {
+                        number_of_items = dxf_spatial_index_collect_items ((DxfSpatialIndexNode *) node->children[i],
+                          items, number_of_items, items_size);
+                        continue;
+                }
+                if (number_of_items == *items_size)
+                {
+                        new_items = realloc (*items, 2 * (*items_size + 8) * sizeof (DxfSpatialIndexItem *));
+                        if (new_items == NULL)
+                        {
+                                /*! \todo The item is lost from the
+                                 * tree when memory runs out. */
+                                continue;
+                        }
+                        *items = new_items;
+                        *items_size = 2 * (*items_size + 8);
+                }
+                (*items)[number_of_items++] = (DxfSpatialIndexItem *) node->children[i];
+        }
+        free (node);
+        return (number_of_items);
+}
+
+
+/*!
+ * \brief Compare two entries on the X value of their center.
+ */
+static int
+dxf_spatial_index_compare_x
+(
+        const void *a,
+                /*!< a pointer to an entry. */
+        const void *b
+                /*!< a pointer to an entry. */
+)
+{
+        const DxfSpatialIndexEntry *entry_a = (const DxfSpatialIndexEntry *) a;
+        const DxfSpatialIndexEntry *entry_b = (const DxfSpatialIndexEntry *) b;
+        double center_a = entry_a->bounds.min.x + entry_a->bounds.max.x;
+        double center_b = entry_b->bounds.min.x + entry_b->bounds.max.x;
+
+        return ((center_a > center_b) - (center_a < center_b));
+}
+
+
+/*!
+ * \brief Compare two entries on the Y value of their center.
+ */
+static int
+dxf_spatial_index_compare_y
+(
+        const void *a,
+                /*!< a pointer to an entry. */
+        const void *b
+                /*!< a pointer to an entry. */
+)
+{
+        const DxfSpatialIndexEntry *entry_a = (const DxfSpatialIndexEntry *) a;
+        const DxfSpatialIndexEntry *entry_b = (const DxfSpatialIndexEntry *) b;
+        double center_a = entry_a->bounds.min.y + entry_a->bounds.max.y;
+        double center_b = entry_b->bounds.min.y + entry_b->bounds.max.y;
+
+        return ((center_a > center_b) - (center_a < center_b));
+}
+
+
+/*!
+ * \brief Pack entries into a tree with the Sort-Tile-Recursive
+ * algorithm.
+ *
+ * Every level is sorted on X into vertical slices of
+ * <tt>sqrt (number_of_nodes)</tt> nodes, every slice on Y, and packed
+ * into full nodes, until one node is left.\n
+ * \c entries is overwritten with the entries of the upper levels.
+ *
+ * \return a pointer to the root node, or \c NULL when no memory could
+ * be allocated.
+ */
+static DxfSpatialIndexNode *
+dxf_spatial_index_bulk_load
+(
+        DxfSpatialIndexEntry *entries,
+                /*!< array of entries. */
+        int number_of_entries
+                /*!< number of entries in the array (at least 1). */
+)
+{
+        DxfSpatialIndexNode *node = NULL;
+        int leaf = TRUE;
+        int number_of_nodes;
+        int slice_size;
+        int i;
+        int k;
+
+        while (TRUE)
+        {
+                number_of_nodes = (number_of_entries + DXF_SPATIAL_INDEX_TREE_MAX_ENTRIES - 1)
+                  / DXF_SPATIAL_INDEX_TREE_MAX_ENTRIES;
+                slice_size = (int) ceil (sqrt ((double) number_of_nodes))
+                  * DXF_SPATIAL_INDEX_TREE_MAX_ENTRIES;
+                qsort (entries, number_of_entries, sizeof (DxfSpatialIndexEntry),
+                  dxf_spatial_index_compare_x);
+                for (i = 0; i < number_of_entries; i += slice_size)
+                {
+                        qsort (entries + i,
+                          (number_of_entries - i < slice_size) ? number_of_entries - i : slice_size,
+                          sizeof (DxfSpatialIndexEntry), dxf_spatial_index_compare_y);
+                }
+                /* The node for entries [i, i + MAX) is stored at
+                 * i / MAX, which is never beyond i. */
+                for (i = 0; i < number_of_entries; i += DXF_SPATIAL_INDEX_TREE_MAX_ENTRIES)
+                {
+                        if ((node = dxf_spatial_index_node_new (leaf)) == NULL)
+                        {
+                                return (NULL);
+                        }
+                        for (k = i; (k < number_of_entries) && (k < i + DXF_SPATIAL_INDEX_TREE_MAX_ENTRIES); k++)
+                        {
+                                dxf_spatial_index_node_append (node, &entries[k].bounds, entries[k].child);
+                        }
+                        entries[i / DXF_SPATIAL_INDEX_TREE_MAX_ENTRIES].bounds = dxf_spatial_index_node_get_bounds (node);
+                        entries[i / DXF_SPATIAL_INDEX_TREE_MAX_ENTRIES].child = node;
+                }
+                if (number_of_nodes == 1)
+                {
+                        return (node);
+                }
+                number_of_entries = number_of_nodes;
+                leaf = FALSE;
+        }
+}
+
+
+/*!
+ * \brief Test an item against the layer and type filters of a query.
+ *
+ * \return \c TRUE when the item passes the filters, else \c FALSE.
+ */
+static int
+dxf_spatial_index_item_matches
+(
+        DxfSpatialIndexItem *item,
+                /*!< a pointer to the item. */
+        const char *layer,
+                /*!< the layer, \c NULL for all layers. */
+        int type
+                /*!< the entity type, \c UNKNOWN_ENTITY for all types. */
+)
+{
+        if ((type != UNKNOWN_ENTITY) && (item->type != type))
+        {
+                return (FALSE);
+        }
+        if ((layer != NULL)
+          && ((item->layer == NULL)
+          || ((item->layer != layer) && (strcmp (item->layer, layer) != 0))))
+        {
+                return (FALSE);
+        }
+        return (TRUE);
+}
+
+
+/*!
+ * \brief Query a node and the nodes below it.
+ */
+static void
+dxf_spatial_index_query_node
+(
+        DxfSpatialIndexNode *node,
+                /*!< a pointer to the node. */
+        DxfBounds *window,
+                /*!< the window. */
+        DxfSpatialIndexQueryMode mode,
+                /*!< the selection mode. */
+        const char *layer,
+                /*!< the layer, \c NULL for all layers. */
+        int type,
+                /*!< the entity type, \c UNKNOWN_ENTITY for all types. */
+        DxfSpatialIndexItem **results,
+                /*!< array for the found items. */
+        int results_size,
+                /*!< number of entries in \c results. */
+        int *number_of_results
+                /*!< a pointer to the number of found items. */
+)
+{
+        DxfSpatialIndexItem *item = NULL;
+        int i;
+
+        for (i = 0; i < node->number_of_entries; i++)
+        {
+                if (!dxf_spatial_index_intersects (window, &node->bounds[i]))
+                {
+                        continue;
+                }
+                if (!node->leaf)
+                {
+                        dxf_spatial_index_query_node ((DxfSpatialIndexNode *) node->children[i],
+                          window, mode, layer, type, results, results_size,
+                          number_of_results);
+                        continue;
+                }
+                item = (DxfSpatialIndexItem *) node->children[i];
+                if ((mode == DXF_SPATIAL_INDEX_WINDOW)
+                  && !dxf_spatial_index_contains (window, &item->bounds))
+                {
+                        continue;
+                }
+                if (!dxf_spatial_index_item_matches (item, layer, type))
+                {
+                        continue;
+                }
+                if (*number_of_results < results_size)
+                {
+                        results[*number_of_results] = item;
+                }
+                (*number_of_results)++;
+        }
+}
+
+
+/*!
+ * \brief Allocate memory for a spatial index tree.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfSpatialIndexTree *
+dxf_spatial_index_tree_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSpatialIndexTree *tree = NULL;
+        size_t size;
+
+        size = sizeof (DxfSpatialIndexTree);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((tree = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfSpatialIndexTree struct.\n")),
+                  __FUNCTION__);
+                tree = NULL;
+        }
+        else
+        {
+                memset (tree, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tree);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in an empty
+ * spatial index tree.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfSpatialIndexTree *
+dxf_spatial_index_tree_init
+(
+        DxfSpatialIndexTree *tree
+                /*!< a pointer to a spatial index tree. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (tree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                tree = dxf_spatial_index_tree_new ();
+        }
+        if (tree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfSpatialIndexTree struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        tree->root = (struct DxfSpatialIndexNode *) dxf_spatial_index_node_new (TRUE);
+        tree->items = (struct DxfChunkList *) dxf_chunk_list_init (dxf_chunk_list_new (),
+          sizeof (DxfSpatialIndexItem), 0);
+        if ((tree->root == NULL) || (tree->items == NULL))
+        {
+                free (tree->root);
+                if (tree->items != NULL)
+                {
+                        dxf_chunk_list_free ((DxfChunkList *) tree->items);
+                }
+                free (tree);
+                return (NULL);
+        }
+        tree->free_items = NULL;
+        tree->number_of_items = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tree);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a spatial index tree.
+ *
+ * The indexed entities are not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_spatial_index_tree_free
+(
+        DxfSpatialIndexTree *tree
+                /*!< a pointer to the memory occupied by the tree. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (tree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_spatial_index_node_free ((DxfSpatialIndexNode *) tree->root);
+        if (tree->items != NULL)
+        {
+                dxf_chunk_list_free ((DxfChunkList *) tree->items);
+        }
+        free (tree);
+        tree = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Build a spatial index tree over all entities of a drawing.
+ *
+ * Replaces the contents of the tree.\n
+ * The bounds of the entities are computed with
+ * \c dxf_bounds_add_entity(), entities without known bounds are not
+ * indexed.\n
+ * The tree is bulk loaded with the Sort-Tile-Recursive algorithm,
+ * which packs the nodes full and gives a low overlap between nodes.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_spatial_index_tree_build
+(
+        DxfSpatialIndexTree *tree,
+                /*!< a pointer to a spatial index tree. */
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        DxfBoundsCache *cache
+                /*!< a cache with the bounds of blocks for \c INSERT
+                 * entities, may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfChunkListIter iter;
+        DxfDrawingEntity *entry = NULL;
+        DxfSpatialIndexEntry *entries = NULL;
+        DxfSpatialIndexItem item;
+        DxfSpatialIndexItem *new_item = NULL;
+        DxfSpatialIndexNode *root = NULL;
+        int number_of_entries = 0;
+
+        /* Do some basic checks. */
+        if ((tree == NULL) || (drawing == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* Start from an empty tree. */
+        dxf_spatial_index_node_free ((DxfSpatialIndexNode *) tree->root);
+        dxf_chunk_list_free ((DxfChunkList *) tree->items);
+        tree->root = (struct DxfSpatialIndexNode *) dxf_spatial_index_node_new (TRUE);
+        tree->items = (struct DxfChunkList *) dxf_chunk_list_init (dxf_chunk_list_new (),
+          sizeof (DxfSpatialIndexItem), 0);
+        tree->free_items = NULL;
+        tree->number_of_items = 0;
+        if ((tree->root == NULL) || (tree->items == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((drawing->entities == NULL)
+          || (dxf_chunk_list_get_number_of_entries ((DxfChunkList *) drawing->entities) == 0))
+        {
+                return (EXIT_SUCCESS);
+        }
+        entries = malloc (dxf_chunk_list_get_number_of_entries ((DxfChunkList *) drawing->entities)
+          * sizeof (DxfSpatialIndexEntry));
+        if (entries == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for the entries.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_chunk_list_iter_init ((DxfChunkList *) drawing->entities, &iter);
+        while ((entry = (DxfDrawingEntity *) dxf_chunk_list_iter_next (&iter)) != NULL)
+        {
+                memset (&item, 0, sizeof (DxfSpatialIndexItem));
+                dxf_bounds_init (&item.bounds);
+                if ((dxf_bounds_add_entity (&item.bounds, entry->type, entry->entity, cache) != EXIT_SUCCESS)
+                  || dxf_bounds_is_empty (&item.bounds))
+                {
+                        continue;
+                }
+                item.type = entry->type;
+                item.entity = entry->entity;
+                item.layer = dxf_entity_get_layer (entry->type, entry->entity);
+                new_item = (DxfSpatialIndexItem *) dxf_chunk_list_append ((DxfChunkList *) tree->items, &item);
+                if (new_item == NULL)
+                {
+                        free (entries);
+                        return (EXIT_FAILURE);
+                }
+                entries[number_of_entries].bounds = new_item->bounds;
+                entries[number_of_entries].child = new_item;
+                number_of_entries++;
+        }
+        if (number_of_entries > 0)
+        {
+                root = dxf_spatial_index_bulk_load (entries, number_of_entries);
+                if (root == NULL)
+                {
+                        free (entries);
+                        return (EXIT_FAILURE);
+                }
+                free (tree->root);
+                tree->root = (struct DxfSpatialIndexNode *) root;
+                tree->number_of_items = number_of_entries;
+        }
+        free (entries);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Insert an entity into a spatial index tree.
+ *
+ * \return a pointer to the item of the entity, or \c NULL when the
+ * bounds of the entity are unknown or an error occurred.
+ */
+DxfSpatialIndexItem *
+dxf_spatial_index_tree_insert
+(
+        DxfSpatialIndexTree *tree,
+                /*!< a pointer to a spatial index tree. */
+        int type,
+                /*!< type of the entity, a \c DxfEntityType value. */
+        void *entity,
+                /*!< a pointer to the entity. */
+        DxfBounds *bounds
+                /*!< bounds of the entity, \c NULL to compute them with
+                 * \c dxf_bounds_add_entity(). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSpatialIndexItem item;
+        DxfSpatialIndexItem *new_item = NULL;
+
+        /* Do some basic checks. */
+        if ((tree == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (&item, 0, sizeof (DxfSpatialIndexItem));
+        if (bounds != NULL)
+        {
+                item.bounds = *bounds;
+        }
+        else
+        {
+                dxf_bounds_init (&item.bounds);
+                dxf_bounds_add_entity (&item.bounds, type, entity, NULL);
+        }
+        if (dxf_bounds_is_empty (&item.bounds))
+        {
+                return (NULL);
+        }
+        item.type = type;
+        item.entity = entity;
+        item.layer = dxf_entity_get_layer (type, entity);
+        if (tree->free_items != NULL)
+        {
+                /* Reuse a removed item. */
+                new_item = (DxfSpatialIndexItem *) tree->free_items;
+                tree->free_items = new_item->next_free;
+                *new_item = item;
+        }
+        else
+        {
+                new_item = (DxfSpatialIndexItem *) dxf_chunk_list_append ((DxfChunkList *) tree->items, &item);
+                if (new_item == NULL)
+                {
+                        return (NULL);
+                }
+        }
+        if (dxf_spatial_index_insert_item (tree, new_item) != EXIT_SUCCESS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a node.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        tree->number_of_items++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (new_item);
+}
+
+
+/*!
+ * \brief Remove an entity from a spatial index tree.
+ *
+ * Nodes falling below \c DXF_SPATIAL_INDEX_TREE_MIN_ENTRIES entries are
+ * dissolved and their items inserted again.\n
+ * To move an entity, remove its item and insert the entity again.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_spatial_index_tree_remove
+(
+        DxfSpatialIndexTree *tree,
+                /*!< a pointer to a spatial index tree. */
+        DxfSpatialIndexItem *item
+                /*!< the item of the entity, as returned by
+                 * \c dxf_spatial_index_tree_insert() or
+                 * \c dxf_spatial_index_tree_find(). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSpatialIndexNode *node = NULL;
+        DxfSpatialIndexNode *parent = NULL;
+        DxfSpatialIndexNode *root = NULL;
+        DxfSpatialIndexItem **orphans = NULL;
+        int number_of_orphans = 0;
+        int orphans_size = 0;
+        int result = EXIT_SUCCESS;
+        int i;
+
+        /* Do some basic checks. */
+        if ((tree == NULL) || (item == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        node = (DxfSpatialIndexNode *) item->leaf;
+        if ((item->entity == NULL) || (node == NULL)
+          || ((i = dxf_spatial_index_node_find (node, item)) < 0))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the item is not in the tree.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        node->number_of_entries--;
+        node->bounds[i] = node->bounds[node->number_of_entries];
+        node->children[i] = node->children[node->number_of_entries];
+        item->entity = NULL;
+        item->leaf = NULL;
+        item->next_free = (struct DxfSpatialIndexItem *) tree->free_items;
+        tree->free_items = (struct DxfSpatialIndexItem *) item;
+        tree->number_of_items--;
+        /* Condense the tree. */
+        while ((parent = (DxfSpatialIndexNode *) node->parent) != NULL)
+        {
+                i = dxf_spatial_index_node_find (parent, node);
+                if (node->number_of_entries < DXF_SPATIAL_INDEX_TREE_MIN_ENTRIES)
+                {
+                        parent->number_of_entries--;
+                        parent->bounds[i] = parent->bounds[parent->number_of_entries];
+                        parent->children[i] = parent->children[parent->number_of_entries];
+                        number_of_orphans = dxf_spatial_index_collect_items (node,
+                          &orphans, number_of_orphans, &orphans_size);
+                }
+                else
+                {
+                        parent->bounds[i] = dxf_spatial_index_node_get_bounds (node);
+                }
+                node = parent;
+        }
+        /* Shorten the tree while the root has a single child node. */
+        root = (DxfSpatialIndexNode *) tree->root;
+        while (!root->leaf && (root->number_of_entries == 1))
+        {
+                tree->root = (struct DxfSpatialIndexNode *) root->children[0];
+                free (root);
+                root = (DxfSpatialIndexNode *) tree->root;
+                root->parent = NULL;
+        }
+        if (!root->leaf && (root->number_of_entries == 0))
+        {
+                root->leaf = TRUE;
+        }
+        for (i = 0; i < number_of_orphans; i++)
+        {
+                result |= dxf_spatial_index_insert_item (tree, orphans[i]);
+        }
+        free (orphans);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Find the item of an entity in a spatial index tree.
+ *
+ * A linear search, keep the items returned by
+ * \c dxf_spatial_index_tree_insert() when entities are moved often.
+ *
+ * \return a pointer to the item, or \c NULL when the entity is not in
+ * the tree.
+ */
+DxfSpatialIndexItem *
+dxf_spatial_index_tree_find
+(
+        DxfSpatialIndexTree *tree,
+                /*!< a pointer to a spatial index tree. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfChunkListIter iter;
+        DxfSpatialIndexItem *item = NULL;
+
+        /* Do some basic checks. */
+        if ((tree == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        dxf_chunk_list_iter_init ((DxfChunkList *) tree->items, &iter);
+        while ((item = (DxfSpatialIndexItem *) dxf_chunk_list_iter_next (&iter)) != NULL)
+        {
+                if (item->entity == entity)
+                {
+                        break;
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (item);
+}
+
+
+/*!
+ * \brief Get the number of entities in a spatial index tree.
+ *
+ * \return the number of entities, or -1 when an error occurred.
+ */
+int
+dxf_spatial_index_tree_get_number_of_items
+(
+        DxfSpatialIndexTree *tree
+                /*!< a pointer to a spatial index tree. */
+)
+{
+        if (tree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        return (tree->number_of_items);
+}
+
+
+/*!
+ * \brief Query the entities in a window of a spatial index tree.
+ *
+ * The window is tested in the XY plane.\n
+ * At most \c results_size items are stored in \c results, the return
+ * value is the total number of matching entities, so a query can be
+ * repeated with a larger array when the results did not fit.
+ *
+ * \return the number of matching entities, or -1 when an error
+ * occurred.
+ */
+int
+dxf_spatial_index_tree_query
+(
+        DxfSpatialIndexTree *tree,
+                /*!< a pointer to a spatial index tree. */
+        DxfBounds *window,
+                /*!< the window. */
+        DxfSpatialIndexQueryMode mode,
+                /*!< \c DXF_SPATIAL_INDEX_WINDOW for entities fully
+                 * inside the window, \c DXF_SPATIAL_INDEX_CROSSING for
+                 * entities inside or crossing the window. */
+        const char *layer,
+                /*!< only entities on this layer, \c NULL for all
+                 * layers. */
+        int type,
+                /*!< only entities of this \c DxfEntityType,
+                 * \c UNKNOWN_ENTITY for all types. */
+        DxfSpatialIndexItem **results,
+                /*!< array for the found items, may be \c NULL when
+                 * \c results_size is 0. */
+        int results_size
+                /*!< number of entries in \c results. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int number_of_results = 0;
+
+        /* Do some basic checks. */
+        if ((tree == NULL) || (window == NULL)
+          || ((results == NULL) && (results_size > 0)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        dxf_spatial_index_query_node ((DxfSpatialIndexNode *) tree->root,
+          window, mode, layer, type, results, results_size,
+          &number_of_results);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (number_of_results);
+}
+
+
+/*!
+ * \brief Definition of an entry in the priority queue of a nearest
+ * search.
+ */
+typedef struct
+dxf_spatial_index_heap_entry
+{
+        double key;
+                /*!< Distance, or a lower bound of the distance. */
+        int kind;
+                /*!< \c DXF_SPATIAL_INDEX_HEAP_NODE,
+                 * \c DXF_SPATIAL_INDEX_HEAP_ITEM or
+                 * \c DXF_SPATIAL_INDEX_HEAP_RESULT. */
+        void *pointer;
+                /*!< The node or the item. */
+        DxfVec3 point;
+                /*!< The nearest point of a result. */
+        double parameter;
+                /*!< The parameter of a result. */
+} DxfSpatialIndexHeapEntry;
+
+
+#define DXF_SPATIAL_INDEX_HEAP_NODE 0
+#define DXF_SPATIAL_INDEX_HEAP_ITEM 1
+#define DXF_SPATIAL_INDEX_HEAP_RESULT 2
+
+
+/*!
+ * \brief Definition of the priority queue (a binary min heap) of a
+ * nearest search.
+ */
+typedef struct
+dxf_spatial_index_heap
+{
+        DxfSpatialIndexHeapEntry *entries;
+                /*!< The entries. */
+        int number_of_entries;
+                /*!< Number of entries. */
+        int size;
+                /*!< Number of allocated entries. */
+} DxfSpatialIndexHeap;
+
+
+/*!
+ * \brief Push an entry on the priority queue.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_spatial_index_heap_push
+(
+        DxfSpatialIndexHeap *heap,
+                /*!< a pointer to the heap. */
+        DxfSpatialIndexHeapEntry *entry
+                /*!< the entry. */
+)
+{
+        DxfSpatialIndexHeapEntry *entries = NULL;
+        int i;
+
+        if (heap->number_of_entries == heap->size)
+        {
+                entries = realloc (heap->entries,
+                  2 * (heap->size + 16) * sizeof (DxfSpatialIndexHeapEntry));
+                if (entries == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                heap->entries = entries;
+                heap->size = 2 * (heap->size + 16);
+        }
+        /* Sift up. */
+        i = heap->number_of_entries++;
+        while ((i > 0) && (heap->entries[(i - 1) / 2].key > entry->key))
+        {
+                heap->entries[i] = heap->entries[(i - 1) / 2];
+                i = (i - 1) / 2;
+        }
+        heap->entries[i] = *entry;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Pop the entry with the smallest key from the priority queue.
+ */
+static void
+dxf_spatial_index_heap_pop
+(
+        DxfSpatialIndexHeap *heap,
+                /*!< a pointer to a heap with at least one entry. */
+        DxfSpatialIndexHeapEntry *entry
+                /*!< the entry (output). */
+)
+{
+        DxfSpatialIndexHeapEntry last;
+        int n;
+        int i = 0;
+        int child;
+
+        *entry = heap->entries[0];
+        n = --heap->number_of_entries;
+        last = heap->entries[n];
+        /* Sift down. */
+        while ((child = 2 * i + 1) < n)
+        {
+                if ((child + 1 < n) && (heap->entries[child + 1].key < heap->entries[child].key))
+                {
+                        child++;
+                }
+                if (heap->entries[child].key >= last.key)
+                {
+                        break;
+                }
+                heap->entries[i] = heap->entries[child];
+                i = child;
+        }
+        heap->entries[i] = last;
+}
+
+
+/*!
+ * \brief Get the distance between a point and bounds in the XY plane.
+ *
+ * \return the distance, a lower bound of the distance to anything
+ * inside the bounds.
+ */
+static double
+dxf_spatial_index_distance
+(
+        const DxfBounds *bounds,
+                /*!< a pointer to bounds. */
+        DxfVec3 point
+                /*!< the point. */
+)
+{
+        double dx = 0.0;
+        double dy = 0.0;
+
+        if (point.x < bounds->min.x)
+        {
+                dx = bounds->min.x - point.x;
+        }
+        else if (point.x > bounds->max.x)
+        {
+                dx = point.x - bounds->max.x;
+        }
+        if (point.y < bounds->min.y)
+        {
+                dy = bounds->min.y - point.y;
+        }
+        else if (point.y > bounds->max.y)
+        {
+                dy = point.y - bounds->max.y;
+        }
+        return (hypot (dx, dy));
+}
+
+
+/*!
+ * \brief Calculate the nearest point on an entity of any supported
+ * type.
+ *
+ * \return the distance, or -1.0 for an entity type without a
+ * \c dxf_*_calculate_nearest_point() function.
+ */
+static double
+dxf_spatial_index_nearest_point
+(
+        DxfSpatialIndexItem *item,
+                /*!< a pointer to the item of the entity. */
+        DxfVec3 point,
+                /*!< the point. */
+        DxfVec3 *nearest,
+                /*!< the nearest point (output). */
+        double *parameter
+                /*!< the parameter of the nearest point (output). */
+)
+{
+        DxfPoint *dxf_point = NULL;
+
+        switch (item->type)
+        {
+                case LINE:
+                        return (dxf_line_calculate_nearest_point ((DxfLine *) item->entity,
+                          point, nearest, parameter));
+                case ARC:
+                        return (dxf_arc_calculate_nearest_point ((DxfArc *) item->entity,
+                          point, nearest, parameter));
+                case CIRCLE:
+                        return (dxf_circle_calculate_nearest_point ((DxfCircle *) item->entity,
+                          point, nearest, parameter));
+                case ELLIPSE:
+                        return (dxf_ellipse_calculate_nearest_point ((DxfEllipse *) item->entity,
+                          point, nearest, parameter));
+                case LWPOLYLINE:
+                        return (dxf_lwpolyline_calculate_nearest_point ((DxfLWPolyline *) item->entity,
+                          point, nearest, parameter));
+                case SPLINE:
+                        return (dxf_spline_calculate_nearest_point ((DxfSpline *) item->entity,
+                          point, nearest, parameter));
+                case POINT:
+                        dxf_point = (DxfPoint *) item->entity;
+                        nearest->x = dxf_point->x0;
+                        nearest->y = dxf_point->y0;
+                        nearest->z = dxf_point->z0;
+                        *parameter = 0.0;
+                        return (dxf_vec3_nearest_point_on_segment (*nearest,
+                          *nearest, point, NULL, NULL));
+                default:
+                        return (-1.0);
+        }
+}
+
+
+/*!
+ * \brief Push a result for an end point on the priority queue.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_spatial_index_push_end_point
+(
+        DxfSpatialIndexHeap *heap,
+                /*!< a pointer to the heap. */
+        DxfSpatialIndexItem *item,
+                /*!< a pointer to the item of the entity. */
+        DxfVec3 point,
+                /*!< the query point. */
+        DxfVec3 end_point,
+                /*!< the end point. */
+        double parameter
+                /*!< the parameter of the end point. */
+)
+{
+        DxfSpatialIndexHeapEntry entry;
+
+        entry.key = dxf_vec3_nearest_point_on_segment (end_point, end_point,
+          point, NULL, NULL);
+        entry.kind = DXF_SPATIAL_INDEX_HEAP_RESULT;
+        entry.pointer = item;
+        entry.point = end_point;
+        entry.parameter = parameter;
+        return (dxf_spatial_index_heap_push (heap, &entry));
+}
+
+
+/*!
+ * \brief Push the end points and vertices of an entity on the priority
+ * queue.
+ *
+ * Lines, arcs, elliptical arcs and splines have two end points, light
+ * weight polylines a point per vertex, and points are their own end
+ * point.\n
+ * The parameters are those of the \c dxf_*_calculate_nearest_point()
+ * function of the entity type.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_spatial_index_push_end_points
+(
+        DxfSpatialIndexHeap *heap,
+                /*!< a pointer to the heap. */
+        DxfSpatialIndexItem *item,
+                /*!< a pointer to the item of the entity. */
+        DxfVec3 point
+                /*!< the query point. */
+)
+{
+        DxfOcs ocs;
+        DxfLine *line = NULL;
+        DxfArc *arc = NULL;
+        DxfEllipse *ellipse = NULL;
+        DxfLWPolyline *lwpolyline = NULL;
+        DxfSpline *spline = NULL;
+        DxfPoint *dxf_point = NULL;
+        DxfVec3 p;
+        double u;
+        int result = EXIT_SUCCESS;
+        int i;
+
+        switch (item->type)
+        {
+                case LINE:
+                        line = (DxfLine *) item->entity;
+                        p.x = line->x0;
+                        p.y = line->y0;
+                        p.z = line->z0;
+                        result |= dxf_spatial_index_push_end_point (heap, item, point, p, 0.0);
+                        p.x = line->x1;
+                        p.y = line->y1;
+                        p.z = line->z1;
+                        result |= dxf_spatial_index_push_end_point (heap, item, point, p, 1.0);
+                        break;
+                case ARC:
+                        arc = (DxfArc *) item->entity;
+                        dxf_ocs_init (&ocs, arc->extr_x0, arc->extr_y0, arc->extr_z0);
+                        p = dxf_ocs_to_wcs (&ocs,
+                          arc->x0 + arc->radius * cos (arc->start_angle * M_PI / 180.0),
+                          arc->y0 + arc->radius * sin (arc->start_angle * M_PI / 180.0),
+                          arc->z0);
+                        result |= dxf_spatial_index_push_end_point (heap, item, point, p, arc->start_angle);
+                        p = dxf_ocs_to_wcs (&ocs,
+                          arc->x0 + arc->radius * cos (arc->end_angle * M_PI / 180.0),
+                          arc->y0 + arc->radius * sin (arc->end_angle * M_PI / 180.0),
+                          arc->z0);
+                        result |= dxf_spatial_index_push_end_point (heap, item, point, p, arc->end_angle);
+                        break;
+                case ELLIPSE:
+                        ellipse = (DxfEllipse *) item->entity;
+                        if ((ellipse->start_angle == ellipse->end_angle)
+                          || (fabs (ellipse->end_angle - ellipse->start_angle) >= 2.0 * M_PI))
+                        {
+                                /* A closed ellipse has no end points. */
+                                break;
+                        }
+                        dxf_ocs_init (&ocs, ellipse->extr_x0, ellipse->extr_y0, ellipse->extr_z0);
+                        for (i = 0; i < 2; i++)
+                        {
+                                u = (i == 0) ? ellipse->start_angle : ellipse->end_angle;
+                                p.x = ellipse->x0 + cos (u) * ellipse->x1
+                                  + sin (u) * ellipse->ratio * (ocs.az.y * ellipse->z1 - ocs.az.z * ellipse->y1);
+                                p.y = ellipse->y0 + cos (u) * ellipse->y1
+                                  + sin (u) * ellipse->ratio * (ocs.az.z * ellipse->x1 - ocs.az.x * ellipse->z1);
+                                p.z = ellipse->z0 + cos (u) * ellipse->z1
+                                  + sin (u) * ellipse->ratio * (ocs.az.x * ellipse->y1 - ocs.az.y * ellipse->x1);
+                                result |= dxf_spatial_index_push_end_point (heap, item, point, p, u);
+                        }
+                        break;
+                case LWPOLYLINE:
+                        lwpolyline = (DxfLWPolyline *) item->entity;
+                        if (lwpolyline->vertices == NULL)
+                        {
+                                break;
+                        }
+                        dxf_ocs_init (&ocs, lwpolyline->extr_x0, lwpolyline->extr_y0, lwpolyline->extr_z0);
+                        for (i = 0; i < lwpolyline->number_vertices; i++)
+                        {
+                                p = dxf_ocs_to_wcs (&ocs, lwpolyline->vertices[i].x0,
+                                  lwpolyline->vertices[i].y0, lwpolyline->elevation);
+                                result |= dxf_spatial_index_push_end_point (heap, item, point, p, (double) i);
+                        }
+                        break;
+                case SPLINE:
+                        spline = (DxfSpline *) item->entity;
+                        if ((spline->p0 != NULL)
+                          && (spline->degree >= 1)
+                          && (spline->number_of_knots == spline->number_of_control_points + spline->degree + 1)
+                          && (spline->number_of_knots <= DXF_MAX_PARAM))
+                        {
+                                for (i = 0; i < 2; i++)
+                                {
+                                        u = spline->knot_value[(i == 0) ? spline->degree : spline->number_of_control_points];
+                                        if (dxf_spline_calculate_point (spline, u, &p, NULL) == EXIT_SUCCESS)
+                                        {
+                                                result |= dxf_spatial_index_push_end_point (heap, item, point, p, u);
+                                        }
+                                }
+                        }
+                        else if ((spline->p1 != NULL) && (spline->number_of_fit_points > 0))
+                        {
+                                result |= dxf_spatial_index_push_end_point (heap, item, point,
+                                  spline->p1[0], 0.0);
+                                result |= dxf_spatial_index_push_end_point (heap, item, point,
+                                  spline->p1[spline->number_of_fit_points - 1],
+                                  (double) (spline->number_of_fit_points - 1));
+                        }
+                        break;
+                case POINT:
+                        dxf_point = (DxfPoint *) item->entity;
+                        p.x = dxf_point->x0;
+                        p.y = dxf_point->y0;
+                        p.z = dxf_point->z0;
+                        result |= dxf_spatial_index_push_end_point (heap, item, point, p, 0.0);
+                        break;
+                default:
+                        break;
+        }
+        return ((result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Find the entities nearest to a point in a spatial index tree.
+ *
+ * A best-first search: nodes and entities are visited in the order of
+ * the distance between the point and their bounds (in the XY plane),
+ * the exact distance of an entity is only calculated when its bounds
+ * are nearer than every result found so far, and the search stops at
+ * \c results_size results or at \c tolerance.\n
+ * In \c DXF_SPATIAL_INDEX_NEAREST_CURVE mode the distance is the exact
+ * 3D distance to a \c LINE, \c ARC, \c CIRCLE, \c ELLIPSE,
+ * \c LWPOLYLINE, \c SPLINE or \c POINT (other entity types are
+ * skipped), for picking the entity under the cursor.\n
+ * In \c DXF_SPATIAL_INDEX_NEAREST_END_POINT mode the results are the
+ * nearest end points and vertices of these entities, for snapping.
+ *
+ * \return the number of results stored in \c results (nearest first),
+ * or -1 when an error occurred.
+ */
+int
+dxf_spatial_index_tree_nearest
+(
+        DxfSpatialIndexTree *tree,
+                /*!< a pointer to a spatial index tree. */
+        DxfVec3 point,
+                /*!< the query point in WCS. */
+        double tolerance,
+                /*!< the largest distance of a result, \c HUGE_VAL for
+                 * any distance. */
+        DxfSpatialIndexNearestMode mode,
+                /*!< the measure, \c DXF_SPATIAL_INDEX_NEAREST_CURVE or
+                 * \c DXF_SPATIAL_INDEX_NEAREST_END_POINT. */
+        const char *layer,
+                /*!< only entities on this layer, \c NULL for all
+                 * layers. */
+        int type,
+                /*!< only entities of this \c DxfEntityType,
+                 * \c UNKNOWN_ENTITY for all types. */
+        DxfSpatialIndexNearest *results,
+                /*!< array for the results. */
+        int results_size
+                /*!< number of entries in \c results, the number of
+                 * nearest entities (or end points) to find. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSpatialIndexHeap heap;
+        DxfSpatialIndexHeapEntry entry;
+        DxfSpatialIndexHeapEntry child;
+        DxfSpatialIndexNode *node = NULL;
+        DxfSpatialIndexItem *item = NULL;
+        int number_of_results = 0;
+        int result = EXIT_SUCCESS;
+        int i;
+
+        /* Do some basic checks. */
+        if ((tree == NULL) || (results == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (tolerance < 0.0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a negative tolerance was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        memset (&heap, 0, sizeof (DxfSpatialIndexHeap));
+        entry.key = 0.0;
+        entry.kind = DXF_SPATIAL_INDEX_HEAP_NODE;
+        entry.pointer = tree->root;
+        result |= dxf_spatial_index_heap_push (&heap, &entry);
+        while ((number_of_results < results_size) && (heap.number_of_entries > 0))
+        {
+                dxf_spatial_index_heap_pop (&heap, &entry);
+                if (entry.key > tolerance)
+                {
+                        break;
+                }
+                switch (entry.kind)
+                {
+                        case DXF_SPATIAL_INDEX_HEAP_NODE:
+                                node = (DxfSpatialIndexNode *) entry.pointer;
+                                for (i = 0; i < node->number_of_entries; i++)
+                                {
+                                        child.key = dxf_spatial_index_distance (&node->bounds[i], point);
+                                        if (child.key > tolerance)
+                                        {
+                                                continue;
+                                        }
+                                        child.pointer = node->children[i];
+                                        child.kind = DXF_SPATIAL_INDEX_HEAP_NODE;
+                                        if (node->leaf)
+                                        {
+                                                if (!dxf_spatial_index_item_matches ((DxfSpatialIndexItem *) child.pointer,
+                                                  layer, type))
+                                                {
+                                                        continue;
+                                                }
+                                                child.kind = DXF_SPATIAL_INDEX_HEAP_ITEM;
+                                        }
+                                        result |= dxf_spatial_index_heap_push (&heap, &child);
+                                }
+                                break;
+                        case DXF_SPATIAL_INDEX_HEAP_ITEM:
+                                /* Replace the bounds by the exact
+                                 * distance. */
+                                item = (DxfSpatialIndexItem *) entry.pointer;
+                                if (mode == DXF_SPATIAL_INDEX_NEAREST_END_POINT)
+                                {
+                                        result |= dxf_spatial_index_push_end_points (&heap, item, point);
+                                        break;
+                                }
+                                entry.key = dxf_spatial_index_nearest_point (item, point,
+                                  &entry.point, &entry.parameter);
+                                if (entry.key < 0.0)
+                                {
+                                        break;
+                                }
+                                entry.kind = DXF_SPATIAL_INDEX_HEAP_RESULT;
+                                result |= dxf_spatial_index_heap_push (&heap, &entry);
+                                break;
+                        case DXF_SPATIAL_INDEX_HEAP_RESULT:
+                                results[number_of_results].item = (DxfSpatialIndexItem *) entry.pointer;
+                                results[number_of_results].distance = entry.key;
+                                results[number_of_results].point = entry.point;
+                                results[number_of_results].parameter = entry.parameter;
+                                number_of_results++;
+                                break;
+                }
+        }
+        free (heap.entries);
+        if (result != EXIT_SUCCESS)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for the search.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (number_of_results);
+}
+
+
 /* EOF*/
@@ -39,6 +39,8 @@
 
 
 #include "global.h"
+#include "bounds.h"
+#include "chunk_list.h"
 
 
 /*!
@@ -75,6 +77,137 @@ dxf_spatial_index
 } DxfSpatialIndex;
 
 
+#define DXF_SPATIAL_INDEX_TREE_MAX_ENTRIES 16
+        /*!< \brief The maximum number of entries in a node of a
+         * \c DxfSpatialIndexTree. */
+
+
+#define DXF_SPATIAL_INDEX_TREE_MIN_ENTRIES 6
+        /*!< \brief The minimum number of entries in a node (other than
+         * the root) of a \c DxfSpatialIndexTree after a removal. */
+
+
+/*!
+ * \brief Selection modes of \c dxf_spatial_index_tree_query().
+ */
+typedef enum
+dxf_spatial_index_query_mode
+{
+        DXF_SPATIAL_INDEX_WINDOW,
+                /*!< Entities fully inside the window. */
+        DXF_SPATIAL_INDEX_CROSSING
+                /*!< Entities inside or crossing the window. */
+} DxfSpatialIndexQueryMode;
+
+
+/*!
+ * \brief Measures of \c dxf_spatial_index_tree_nearest().
+ */
+typedef enum
+dxf_spatial_index_nearest_mode
+{
+        DXF_SPATIAL_INDEX_NEAREST_CURVE,
+                /*!< The nearest point on the entity (picking). */
+        DXF_SPATIAL_INDEX_NEAREST_END_POINT
+                /*!< The nearest end points and vertices of entities
+                 * (snapping), one result per end point. */
+} DxfSpatialIndexNearestMode;
+
+
+/*!
+ * \brief Definition of an entity in a \c DxfSpatialIndexTree.
+ */
+typedef struct
+dxf_spatial_index_item
+{
+        DxfBounds bounds;
+                /*!< Bounds of the entity when it was inserted. */
+        int type;
+                /*!< Type of the entity, a \c DxfEntityType value. */
+        void *entity;
+                /*!< Pointer to the entity (not owned by the tree),
+                 * \c NULL for a removed item. */
+        char *layer;
+                /*!< Layer of the entity (not a copy). */
+        struct DxfSpatialIndexNode *leaf;
+                /*!< The leaf node holding the item. */
+        struct DxfSpatialIndexItem *next_free;
+                /*!< Pointer to the next removed item available for
+                 * reuse. */
+} DxfSpatialIndexItem;
+
+
+/*!
+ * \brief Definition of a node of a \c DxfSpatialIndexTree.
+ */
+typedef struct
+dxf_spatial_index_node
+{
+        int leaf;
+                /*!< \c TRUE when the children are items,
+                 * \c FALSE when the children are nodes. */
+        int number_of_entries;
+                /*!< Number of children. */
+        DxfBounds bounds[DXF_SPATIAL_INDEX_TREE_MAX_ENTRIES + 1];
+                /*!< Bounds of the children (one spare entry for a
+                 * node about to be split). */
+        void *children[DXF_SPATIAL_INDEX_TREE_MAX_ENTRIES + 1];
+                /*!< The children, \c DxfSpatialIndexItem or
+                 * \c DxfSpatialIndexNode. */
+        struct DxfSpatialIndexNode *parent;
+                /*!< The parent node, \c NULL for the root. */
+} DxfSpatialIndexNode;
+
+
+/*!
+ * \brief Definition of a result of \c dxf_spatial_index_tree_nearest().
+ */
+typedef struct
+dxf_spatial_index_nearest
+{
+        DxfSpatialIndexItem *item;
+                /*!< The item of the entity (with the entity, its type
+                 * and its layer). */
+        double distance;
+                /*!< Distance between the query point and \c point. */
+        DxfVec3 point;
+                /*!< The nearest point on the entity, or the end
+                 * point. */
+        double parameter;
+                /*!< Parameter of \c point on the entity, as returned
+                 * by the \c dxf_*_calculate_nearest_point() function of
+                 * the entity type. */
+} DxfSpatialIndexNearest;
+
+
+/*!
+ * \brief Definition of an in-memory R-tree over the entities of a
+ * drawing.
+ *
+ * Built from the bounds of the entities (see \c bounds.h) in one pass
+ * with a Sort-Tile-Recursive bulk load, or entity by entity with
+ * \c dxf_spatial_index_tree_insert() and
+ * \c dxf_spatial_index_tree_remove().\n
+ * The tree indexes the XY plane, the Z values of the bounds are kept
+ * but not queried.\n
+ * Queries do not modify the tree, so any number of threads can query
+ * a tree which is not being modified.
+ */
+typedef struct
+dxf_spatial_index_tree
+{
+        struct DxfSpatialIndexNode *root;
+                /*!< The root node. */
+        struct DxfChunkList *items;
+                /*!< All items, including removed items (stable
+                 * addresses). */
+        struct DxfSpatialIndexItem *free_items;
+                /*!< Removed items available for reuse. */
+        int number_of_items;
+                /*!< Number of entities in the tree. */
+} DxfSpatialIndexTree;
+
+
 DxfSpatialIndex *
 dxf_spatial_index_new ();
 DxfSpatialIndex *
@@ -104,7 +237,74 @@ dxf_spatial_index_free_chain
 (
         DxfSpatialIndex *spatial_indices
 );
+DxfSpatialIndexTree *
+dxf_spatial_index_tree_new ();
+DxfSpatialIndexTree *
+dxf_spatial_index_tree_init
+(
+        DxfSpatialIndexTree *tree
+);
+int
+dxf_spatial_index_tree_free
+(
+        DxfSpatialIndexTree *tree
+);
+int
+dxf_spatial_index_tree_build
+(
+        DxfSpatialIndexTree *tree,
+        DxfDrawing *drawing,
+        DxfBoundsCache *cache
+);
+DxfSpatialIndexItem *
+dxf_spatial_index_tree_insert
+(
+        DxfSpatialIndexTree *tree,
+        int type,
+        void *entity,
+        DxfBounds *bounds
+);
+int
+dxf_spatial_index_tree_remove
+(
+        DxfSpatialIndexTree *tree,
+        DxfSpatialIndexItem *item
+);
+DxfSpatialIndexItem *
+dxf_spatial_index_tree_find
+(
+        DxfSpatialIndexTree *tree,
+        void *entity
+);
+int
+dxf_spatial_index_tree_get_number_of_items
+(
+        DxfSpatialIndexTree *tree
+);
+int
+dxf_spatial_index_tree_query
+(
+        DxfSpatialIndexTree *tree,
+        DxfBounds *window,
+        DxfSpatialIndexQueryMode mode,
+        const char *layer,
+        int type,
+        DxfSpatialIndexItem **results,
+        int results_size
+);
 
+int
+dxf_spatial_index_tree_nearest
+(
+        DxfSpatialIndexTree *tree,
+        DxfVec3 point,
+        double tolerance,
+        DxfSpatialIndexNearestMode mode,
+        const char *layer,
+        int type,
+        DxfSpatialIndexNearest *results,
+        int results_size
+);
 
 #endif /* LIBDXF_SRC_SPATIAL_INDEX_H */
 
@@ -230,6 +230,9 @@
 
 
 #include "spline.h"
+#include "util.h"
+#include "pool.h"
+#include "nurbs.h"
 
 
 /*!
@@ -324,15 +327,19 @@ dxf_spline_init
         spline->color_value = 0;
         spline->color_name = strdup ("");
         spline->transparency = 0;
-        spline->p0 = dxf_point_init (spline->p0);
-        spline->p1 = dxf_point_init (spline->p1);
+        spline->p0 = NULL;
+        spline->p1 = NULL;
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
                 spline->knot_value[i] = 0.0;
                 spline->weight_value[i] = 0.0;
         }
-        spline->p2 = dxf_point_init (spline->p2);
-        spline->p3 = dxf_point_init (spline->p3);
+        spline->p2.x = 0.0;
+        spline->p2.y = 0.0;
+        spline->p2.z = 0.0;
+        spline->p3.x = 0.0;
+        spline->p3.y = 0.0;
+        spline->p3.z = 0.0;
         spline->extr_x0 = 0.0;
         spline->extr_y0 = 0.0;
         spline->extr_z0 = 0.0;
@@ -344,6 +351,8 @@ dxf_spline_init
         spline->number_of_knots = 0;
         spline->number_of_control_points = 0;
         spline->number_of_fit_points = 0;
+        spline->p0_size = 0;
+        spline->p1_size = 0;
         spline->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -379,10 +388,11 @@ dxf_spline_read
         int i_knot_value;
         int i_weight_value;
         DxfBinaryGraphicsData *binary_graphics_data = NULL;
-        DxfPoint *p0 = NULL;
-        DxfPoint *p1 = NULL;
-        DxfPoint *p2 = NULL;
-        DxfPoint *p3 = NULL;
+        int i_p0;
+        int i_p1;
+        DxfVec3 vec;
+        DxfVec3 *array = NULL;
+        double value;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -391,7 +401,7 @@ dxf_spline_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (spline == NULL)
@@ -405,13 +415,18 @@ dxf_spline_read
         i_knot_value = 0;
         i_weight_value = 0;
         binary_graphics_data = (DxfBinaryGraphicsData *) spline->binary_graphics_data;
-        p0 = (DxfPoint *) spline->p0;
-        p1 = (DxfPoint *) spline->p1;
-        p2 = (DxfPoint *) spline->p2;
-        p3 = (DxfPoint *) spline->p3;
+        i_p0 = 0;
+        i_p1 = 0;
+        free (spline->p0);
+        free (spline->p1);
+        spline->p0 = NULL;
+        spline->p1 = NULL;
+        spline->p0_size = 0;
+        spline->p1_size = 0;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -420,7 +435,7 @@ dxf_spline_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -435,13 +450,13 @@ dxf_spline_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spline->linetype);
+                        spline->linetype = dxf_read_string (fp, spline->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spline->layer);
+                        spline->layer = dxf_read_string (fp, spline->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -449,7 +464,16 @@ dxf_spline_read
                          * X-value of the control point coordinate
                          * (multiple entries). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p0->x0);
+                        vec.x = 0.0;
+                        vec.y = 0.0;
+                        vec.z = 0.0;
+                        fscanf (fp->fp, "%lf\n", &vec.x);
+                        array = dxf_vec3_array_append (spline->p0, i_p0, &spline->p0_size, vec);
+                        if (array != NULL)
+                        {
+                                spline->p0 = array;
+                                i_p0++;
+                        }
                 }
                 else if (strcmp (temp_string, "20") == 0)
                 {
@@ -457,7 +481,11 @@ dxf_spline_read
                          * Y-coordinate of control point coordinate
                          * (multiple entries). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p0->y0);
+                        fscanf (fp->fp, "%lf\n", &value);
+                        if (i_p0 > 0)
+                        {
+                                spline->p0[i_p0 - 1].y = value;
+                        }
                 }
                 else if (strcmp (temp_string, "30") == 0)
                 {
@@ -465,9 +493,11 @@ dxf_spline_read
                          * Z-coordinate of the control point coordinate
                          * (multiple entries). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p0->z0);
-                        dxf_point_init ((DxfPoint *) p0->next);
-                        p0 = (DxfPoint *) p0->next;
+                        fscanf (fp->fp, "%lf\n", &value);
+                        if (i_p0 > 0)
+                        {
+                                spline->p0[i_p0 - 1].z = value;
+                        }
                 }
                 else if (strcmp (temp_string, "11") == 0)
                 {
@@ -475,7 +505,16 @@ dxf_spline_read
                          * X-coordinate of the fit point coordinate
                          * (multiple entries). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p1->x0);
+                        vec.x = 0.0;
+                        vec.y = 0.0;
+                        vec.z = 0.0;
+                        fscanf (fp->fp, "%lf\n", &vec.x);
+                        array = dxf_vec3_array_append (spline->p1, i_p1, &spline->p1_size, vec);
+                        if (array != NULL)
+                        {
+                                spline->p1 = array;
+                                i_p1++;
+                        }
                 }
                 else if (strcmp (temp_string, "21") == 0)
                 {
@@ -483,7 +522,11 @@ dxf_spline_read
                          * Y-coordinate of the fit point coordinate
                          * (multiple entries). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p1->y0);
+                        fscanf (fp->fp, "%lf\n", &value);
+                        if (i_p1 > 0)
+                        {
+                                spline->p1[i_p1 - 1].y = value;
+                        }
                 }
                 else if (strcmp (temp_string, "31") == 0)
                 {
@@ -491,9 +534,11 @@ dxf_spline_read
                          * Z-coordinate of the fit point coordinate
                          * (multiple entries). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p1->z0);
-                        dxf_point_init ((DxfPoint *) p1->next);
-                        p1 = (DxfPoint *) p1->next;
+                        fscanf (fp->fp, "%lf\n", &value);
+                        if (i_p1 > 0)
+                        {
+                                spline->p1[i_p1 - 1].z = value;
+                        }
                 }
                 else if (strcmp (temp_string, "12") == 0)
                 {
@@ -501,7 +546,7 @@ dxf_spline_read
                          * X-coordinate of the start tangent,
                          * may be omitted (in WCS). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p2->x0);
+                        fscanf (fp->fp, "%lf\n", &spline->p2.x);
                 }
                 else if (strcmp (temp_string, "22") == 0)
                 {
@@ -509,7 +554,7 @@ dxf_spline_read
                          * Y-coordinate of the start tangent,
                          * may be omitted (in WCS). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p2->y0);
+                        fscanf (fp->fp, "%lf\n", &spline->p2.y);
                 }
                 else if (strcmp (temp_string, "32") == 0)
                 {
@@ -517,7 +562,7 @@ dxf_spline_read
                          * Z-coordinate of the start tangent,
                          * may be omitted (in WCS). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p2->z0);
+                        fscanf (fp->fp, "%lf\n", &spline->p2.z);
                 }
                 else if (strcmp (temp_string, "13") == 0)
                 {
@@ -525,7 +570,7 @@ dxf_spline_read
                          * X-coordinate of the end tangent,
                          * may be omitted (in WCS). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p3->x0);
+                        fscanf (fp->fp, "%lf\n", &spline->p3.x);
                 }
                 else if (strcmp (temp_string, "23") == 0)
                 {
@@ -533,7 +578,7 @@ dxf_spline_read
                          * Y-coordinate of the end tangent,
                          * may be omitted (in WCS). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p3->y0);
+                        fscanf (fp->fp, "%lf\n", &spline->p3.y);
                 }
                 else if (strcmp (temp_string, "33") == 0)
                 {
@@ -541,7 +586,7 @@ dxf_spline_read
                          * Z-coordinate of the end tangent,
                          * may be omitted (in WCS). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &p3->z0);
+                        fscanf (fp->fp, "%lf\n", &spline->p3.z);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                         && (strcmp (temp_string, "38") == 0)
@@ -557,20 +602,27 @@ dxf_spline_read
                         /* Now follows a thickness value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &spline->thickness);
-                        i_knot_value++;
                 }
                 else if (strcmp (temp_string, "40") == 0)
                 {
                         /* Now follows a knot value (one entry per knot, multiple entries). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spline->knot_value[i_knot_value]);
+                        fscanf (fp->fp, "%lf\n", &value);
+                        if (i_knot_value < DXF_MAX_PARAM)
+                        {
+                                spline->knot_value[i_knot_value] = value;
+                        }
                         i_knot_value++;
                 }
                 else if (strcmp (temp_string, "41") == 0)
                 {
                         /* Now follows a weight value (one entry per knot, multiple entries). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spline->weight_value[i_weight_value]);
+                        fscanf (fp->fp, "%lf\n", &value);
+                        if (i_weight_value < DXF_MAX_PARAM)
+                        {
+                                spline->weight_value[i_weight_value] = value;
+                        }
                         i_weight_value++;
                 }
                 else if (strcmp (temp_string, "42") == 0)
@@ -596,7 +648,6 @@ dxf_spline_read
                         /* Now follows a linetype scale value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &spline->linetype_scale);
-                        i_knot_value++;
                 }
                 else if (strcmp (temp_string, "60") == 0)
                 {
@@ -642,12 +693,26 @@ dxf_spline_read
                         /* Now follows a number of control points value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &spline->number_of_control_points);
+                        /* Make room for the control points that follow, the
+                         * count is only a hint. */
+                        array = dxf_vec3_array_reserve (spline->p0, &spline->p0_size, spline->number_of_control_points);
+                        if (array != NULL)
+                        {
+                                spline->p0 = array;
+                        }
                 }
                 else if (strcmp (temp_string, "74") == 0)
                 {
                         /* Now follows a number of fit points value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &spline->number_of_fit_points);
+                        /* Make room for the fit points that follow, the
+                         * count is only a hint. */
+                        array = dxf_vec3_array_reserve (spline->p1, &spline->p1_size, spline->number_of_fit_points);
+                        if (array != NULL)
+                        {
+                                spline->p1 = array;
+                        }
                 }
                 else if (strcmp (temp_string, "92") == 0)
                 {
@@ -668,7 +733,7 @@ dxf_spline_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", binary_graphics_data->data_line);
+                        binary_graphics_data->data_line = dxf_read_string (fp, binary_graphics_data->data_line);
                         dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) binary_graphics_data->next);
                         binary_graphics_data = (DxfBinaryGraphicsData *) binary_graphics_data->next;
                 }
@@ -677,21 +742,21 @@ dxf_spline_read
                         /* Now follows a string containing a
                          * soft-pointer ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spline->dictionary_owner_soft);
+                        spline->dictionary_owner_soft = dxf_read_string (fp, spline->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spline->material);
+                        spline->material = dxf_read_string (fp, spline->material);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spline->dictionary_owner_hard);
+                        spline->dictionary_owner_hard = dxf_read_string (fp, spline->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -705,7 +770,7 @@ dxf_spline_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spline->plot_style_name);
+                        spline->plot_style_name = dxf_read_string (fp, spline->plot_style_name);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -718,7 +783,7 @@ dxf_spline_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spline->color_name);
+                        spline->color_name = dxf_read_string (fp, spline->color_name);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -739,8 +804,26 @@ dxf_spline_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
+        }
+        /* The arrays hold the knots, control and fit points actually
+         * read. */
+        if ((i_knot_value > DXF_MAX_PARAM) || (i_weight_value > DXF_MAX_PARAM))
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () more than %d knot or weight values for the SPLINE entity with id-code: %x, the remaining values are dropped.\n")),
+                  __FUNCTION__, DXF_MAX_PARAM, spline->id_code);
+                i_knot_value = (i_knot_value > DXF_MAX_PARAM) ? DXF_MAX_PARAM : i_knot_value;
         }
+        spline->number_of_knots = i_knot_value;
+        spline->number_of_control_points = i_p0;
+        spline->number_of_fit_points = i_p1;
         /* Handle omitted members and/or illegal values. */
         if (strcmp (spline->linetype, "") == 0)
         {
@@ -751,7 +834,7 @@ dxf_spline_read
                 spline->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -780,10 +863,8 @@ dxf_spline_write
         char *dxf_entity_name = strdup ("SPLINE");
         int i;
         DxfBinaryGraphicsData *binary_graphics_data = NULL;
-        DxfPoint *p0 = NULL;
-        DxfPoint *p1 = NULL;
-        DxfPoint *p2 = NULL;
-        DxfPoint *p3 = NULL;
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -810,7 +891,8 @@ dxf_spline_write
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        if (strcmp (spline->linetype, "") == 0)
+        linetype = spline->linetype;
+        if (strcmp (linetype, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -818,9 +900,10 @@ dxf_spline_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                spline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = DXF_DEFAULT_LINETYPE;
         }
-        if (strcmp (spline->layer, "") == 0)
+        layer = spline->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
@@ -828,14 +911,10 @@ dxf_spline_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
-                spline->layer = DXF_DEFAULT_LAYER;
+                layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         binary_graphics_data = (DxfBinaryGraphicsData *) spline->binary_graphics_data;
-        p0 = (DxfPoint *) spline->p0;
-        p1 = (DxfPoint *) spline->p1;
-        p2 = (DxfPoint *) spline->p2;
-        p3 = (DxfPoint *) spline->p3;
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
         if (spline->id_code != -1)
         {
@@ -873,10 +952,10 @@ dxf_spline_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", spline->layer);
-        if (strcmp (spline->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (strcmp (linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", spline->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
@@ -931,12 +1010,12 @@ dxf_spline_write
         fprintf (fp->fp, " 74\n%d\n", spline->number_of_fit_points);
         fprintf (fp->fp, " 42\n%f\n", spline->knot_tolerance);
         fprintf (fp->fp, " 43\n%f\n", spline->control_point_tolerance);
-        fprintf (fp->fp, " 12\n%f\n", p2->x0);
-        fprintf (fp->fp, " 22\n%f\n", p2->y0);
-        fprintf (fp->fp, " 32\n%f\n", p2->z0);
-        fprintf (fp->fp, " 13\n%f\n", p3->x0);
-        fprintf (fp->fp, " 23\n%f\n", p3->y0);
-        fprintf (fp->fp, " 33\n%f\n", p3->z0);
+        fprintf (fp->fp, " 12\n%f\n", spline->p2.x);
+        fprintf (fp->fp, " 22\n%f\n", spline->p2.y);
+        fprintf (fp->fp, " 32\n%f\n", spline->p2.z);
+        fprintf (fp->fp, " 13\n%f\n", spline->p3.x);
+        fprintf (fp->fp, " 23\n%f\n", spline->p3.y);
+        fprintf (fp->fp, " 33\n%f\n", spline->p3.z);
         for (i = 0; i < spline->number_of_knots; i++)
         {
                 fprintf (fp->fp, " 40\n%f\n", spline->knot_value[i]);
@@ -948,19 +1027,17 @@ dxf_spline_write
                         fprintf (fp->fp, " 41\n%f\n", spline->weight_value[i]);
                 }
         }
-        while (spline->p0 != NULL)
+        for (i = 0; (spline->p0 != NULL) && (i < spline->number_of_control_points); i++)
         {
-                fprintf (fp->fp, " 10\n%f\n", p0->x0);
-                fprintf (fp->fp, " 20\n%f\n", p0->y0);
-                fprintf (fp->fp, " 30\n%f\n", p0->z0);
-                p0 = (DxfPoint *) dxf_point_get_next (p0);
+                fprintf (fp->fp, " 10\n%f\n", spline->p0[i].x);
+                fprintf (fp->fp, " 20\n%f\n", spline->p0[i].y);
+                fprintf (fp->fp, " 30\n%f\n", spline->p0[i].z);
         }
-        while (spline->p1 != NULL)
+        for (i = 0; (spline->p1 != NULL) && (i < spline->number_of_fit_points); i++)
         {
-                fprintf (fp->fp, " 11\n%f\n", p1->x0);
-                fprintf (fp->fp, " 21\n%f\n", p1->y0);
-                fprintf (fp->fp, " 31\n%f\n", p1->z0);
-                p1 = (DxfPoint *) dxf_point_get_next (p1);
+                fprintf (fp->fp, " 11\n%f\n", spline->p1[i].x);
+                fprintf (fp->fp, " 21\n%f\n", spline->p1[i].y);
+                fprintf (fp->fp, " 31\n%f\n", spline->p1[i].z);
         }
         /* Clean up. */
         free (dxf_entity_name);
@@ -1004,6 +1081,8 @@ dxf_spline_free
         free (spline->plot_style_name);
         free (spline->color_name);
         dxf_binary_graphics_data_free_chain (spline->binary_graphics_data);
+        free (spline->p0);
+        free (spline->p1);
         free (spline);
         spline = NULL;
 #if DEBUG
@@ -2641,14 +2720,15 @@ dxf_spline_set_transparency
 
 
 /*!
- * \brief Get the first control point \c p0 from a DXF \c SPLINE entity.
+ * \brief Get the control points \c p0 from a DXF \c SPLINE entity.
  *
- * \c p0 is the first control point in a single linked list.
+ * \c p0 is an array of \c number_of_control_points control points,
+ * owned by the \c SPLINE entity.
  *
- * \return control point \c p0 when sucessful, or \c NULL when an error
+ * \return control points \c p0 when sucessful, or \c NULL when an error
  * occurred.
  */
-DxfPoint *
+DxfVec3 *
 dxf_spline_get_p0
 (
         DxfSpline *spline
@@ -2676,14 +2756,15 @@ dxf_spline_get_p0
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfPoint *) spline->p0);
+        return ((DxfVec3 *) spline->p0);
 }
 
 
 /*!
- * \brief Set the first control point \c p0 for a DXF \c SPLINE entity.
+ * \brief Set the control points \c p0 for a DXF \c SPLINE entity.
  *
- * \c p0 is the first control point in a single linked list.
+ * \c p0 is an array of \c number_of_control_points control points,
+ * owned by the \c SPLINE entity.
  *
  * \return a pointer to \c spline when successful, or \c NULL when an
  * error occurred.
@@ -2693,9 +2774,9 @@ dxf_spline_set_p0
 (
         DxfSpline *spline,
                 /*!< a pointer to a DXF \c SPLINE entity. */
-        DxfPoint *p0
-                /*!< a control point \c p0 (multiple entries) for the
-                 * entity. */
+        DxfVec3 *p0
+                /*!< an array of control points \c p0 (multiple
+                 * entries) for the entity, allocated with \c malloc(). */
 )
 {
 #if DEBUG
@@ -2716,7 +2797,9 @@ dxf_spline_set_p0
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->p0 = (DxfPoint *) p0;
+        spline->p0 = (DxfVec3 *) p0;
+        /* The number of allocated entries is not known. */
+        spline->p0_size = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2725,14 +2808,15 @@ dxf_spline_set_p0
 
 
 /*!
- * \brief Get the first fit point \c p1 from a DXF \c SPLINE entity.
+ * \brief Get the fit points \c p1 from a DXF \c SPLINE entity.
  *
- * \c p1 is the first fit point in a single linked list.
+ * \c p1 is an array of \c number_of_fit_points fit points, owned by
+ * the \c SPLINE entity.
  *
- * \return fit point \c p1 when sucessful, or \c NULL when an error
+ * \return fit points \c p1 when sucessful, or \c NULL when an error
  * occurred.
  */
-DxfPoint *
+DxfVec3 *
 dxf_spline_get_p1
 (
         DxfSpline *spline
@@ -2760,14 +2844,15 @@ dxf_spline_get_p1
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfPoint *) spline->p1);
+        return ((DxfVec3 *) spline->p1);
 }
 
 
 /*!
- * \brief Set the first fit point \c p1 for a DXF \c SPLINE entity.
+ * \brief Set the fit points \c p1 for a DXF \c SPLINE entity.
  *
- * \c p1 is the first fit point in a single linked list.
+ * \c p1 is an array of \c number_of_fit_points fit points, owned by
+ * the \c SPLINE entity.
  *
  * \return a pointer to \c spline when successful, or \c NULL when an
  * error occurred.
@@ -2777,9 +2862,9 @@ dxf_spline_set_p1
 (
         DxfSpline *spline,
                 /*!< a pointer to a DXF \c SPLINE entity. */
-        DxfPoint *p1
-                /*!< a fit point \c p0 (multiple entries) for the
-                 * entity. */
+        DxfVec3 *p1
+                /*!< an array of fit points \c p1 (multiple entries)
+                 * for the entity, allocated with \c malloc(). */
 )
 {
 #if DEBUG
@@ -2800,7 +2885,9 @@ dxf_spline_set_p1
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->p1 = (DxfPoint *) p1;
+        spline->p1 = (DxfVec3 *) p1;
+        /* The number of allocated entries is not known. */
+        spline->p1_size = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2808,4 +2895,449 @@ dxf_spline_set_p1
 }
 
 
+/*!
+ * \brief Test if the control points and knots of a DXF \c SPLINE
+ * describe a curve which can be evaluated.
+ *
+ * \return \c TRUE when the curve can be evaluated, else \c FALSE.
+ */
+static int
+dxf_spline_is_evaluable
+(
+        DxfSpline *spline
+                /*!< a pointer to a DXF \c SPLINE entity. */
+)
+{
+        if ((spline->p0 == NULL)
+          || (spline->degree < 1)
+          || (spline->degree > DXF_SPLINE_MAX_DEGREE)
+          || (spline->number_of_control_points < spline->degree + 1)
+          || (spline->number_of_knots != spline->number_of_control_points + spline->degree + 1)
+          || (spline->number_of_knots > DXF_MAX_PARAM)
+          || (spline->knot_value[spline->degree] >= spline->knot_value[spline->number_of_control_points]))
+        {
+                return (FALSE);
+        }
+        return (TRUE);
+}
+
+
+/*!
+ * \brief Find the knot span of a parameter.
+ *
+ * \return the index \c k of the (non empty) knot span
+ * <tt>[knot_value[k], knot_value[k + 1])</tt> holding \c u, clamped to
+ * the spans of the curve.
+ */
+static int
+dxf_spline_find_span
+(
+        DxfSpline *spline,
+                /*!< a pointer to a DXF \c SPLINE entity. */
+        double u
+                /*!< the parameter. */
+)
+{
+        const double *knots = spline->knot_value;
+        int n = spline->number_of_control_points;
+        int low = spline->degree;
+        int high = n;
+        int mid;
+
+        if (u >= knots[n])
+        {
+                mid = n - 1;
+                while ((mid > low) && (knots[mid] >= knots[mid + 1]))
+                {
+                        mid--;
+                }
+                return (mid);
+        }
+        if (u <= knots[low])
+        {
+                mid = low;
+                while ((mid < n - 1) && (knots[mid] >= knots[mid + 1]))
+                {
+                        mid++;
+                }
+                return (mid);
+        }
+        /* Bisect with knots[low] <= u < knots[high]. */
+        while (high - low > 1)
+        {
+                mid = (low + high) / 2;
+                if (u < knots[mid])
+                {
+                        high = mid;
+                }
+                else
+                {
+                        low = mid;
+                }
+        }
+        return (low);
+}
+
+
+/*!
+ * \brief Calculate a point and the first derivative of a DXF
+ * \c SPLINE at a parameter.
+ *
+ * The non zero B-spline basis functions and their derivatives are
+ * computed with the triangular scheme of Cox and de Boor (see
+ * \c dxf_nurbs_calculate_basis()), weights are applied for a rational
+ * spline (bit 4 of the spline flag).\n
+ * For second derivatives, curvature, many points or tessellation
+ * convert the spline into a \c DxfNurbs with
+ * \c dxf_nurbs_set_spline().\n
+ * Parameters outside the curve domain
+ * <tt>[knot_value[degree], knot_value[number_of_control_points]]</tt>
+ * are clamped to the domain.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred (a spline without a valid set of control points and knots).
+ *
+ * \version According to DXF R13.
+ * \version According to DXF R14.
+ */
+int
+dxf_spline_calculate_point
+(
+        DxfSpline *spline,
+                /*!< a pointer to a DXF \c SPLINE entity. */
+        double u,
+                /*!< the parameter. */
+        DxfVec3 *point,
+                /*!< the point on the curve (output), may be \c NULL. */
+        DxfVec3 *derivative
+                /*!< the first derivative to the parameter (output),
+                 * may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double basis[2][DXF_SPLINE_MAX_DEGREE + 1];
+        const double *knots = NULL;
+        DxfVec3 a = {0.0, 0.0, 0.0};
+        DxfVec3 da = {0.0, 0.0, 0.0};
+        DxfVec3 c;
+        double w_sum = 0.0;
+        double dw_sum = 0.0;
+        double w;
+        int p;
+        int span;
+        int i;
+        int r;
+
+        /* Do some basic checks. */
+        if (spline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (!dxf_spline_is_evaluable (spline))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the spline has no valid control points and knots.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        knots = spline->knot_value;
+        p = spline->degree;
+        if (u < knots[p])
+        {
+                u = knots[p];
+        }
+        if (u > knots[spline->number_of_control_points])
+        {
+                u = knots[spline->number_of_control_points];
+        }
+        span = dxf_spline_find_span (spline, u);
+        dxf_nurbs_calculate_basis (knots, p, span, u, 1, basis);
+        for (r = 0; r <= p; r++)
+        {
+                i = span - p + r;
+                w = ((spline->flag & 4) && (spline->weight_value[i] > 0.0))
+                  ? spline->weight_value[i] : 1.0;
+                a.x += basis[0][r] * w * spline->p0[i].x;
+                a.y += basis[0][r] * w * spline->p0[i].y;
+                a.z += basis[0][r] * w * spline->p0[i].z;
+                da.x += basis[1][r] * w * spline->p0[i].x;
+                da.y += basis[1][r] * w * spline->p0[i].y;
+                da.z += basis[1][r] * w * spline->p0[i].z;
+                w_sum += basis[0][r] * w;
+                dw_sum += basis[1][r] * w;
+        }
+        c.x = a.x / w_sum;
+        c.y = a.y / w_sum;
+        c.z = a.z / w_sum;
+        if (point != NULL)
+        {
+                *point = c;
+        }
+        if (derivative != NULL)
+        {
+                /* Quotient rule on A (u) / W (u). */
+                derivative->x = (da.x - dw_sum * c.x) / w_sum;
+                derivative->y = (da.y - dw_sum * c.y) / w_sum;
+                derivative->z = (da.z - dw_sum * c.z) / w_sum;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Refine a local minimum of the distance between a point and a
+ * DXF \c SPLINE.
+ *
+ * The derivative of the squared distance changes sign inside the
+ * bracket, secant steps on the derivative (a Gauss-Newton step for
+ * the first) are taken while they stay inside the bracket, and the
+ * bracket is bisected otherwise.
+ *
+ * \return the parameter of the local minimum.
+ */
+static double
+dxf_spline_refine_nearest_point
+(
+        DxfSpline *spline,
+                /*!< a pointer to a DXF \c SPLINE entity. */
+        DxfVec3 point,
+                /*!< the point in WCS. */
+        double lower,
+                /*!< lower end of the bracket. */
+        double upper,
+                /*!< upper end of the bracket. */
+        double u
+                /*!< the start parameter inside the bracket. */
+)
+{
+        DxfVec3 c;
+        DxfVec3 dc;
+        double f;
+        double df;
+        double f_previous = 0.0;
+        double u_previous = u;
+        double step;
+        int i;
+
+        for (i = 0; i < 64; i++)
+        {
+                dxf_spline_calculate_point (spline, u, &c, &dc);
+                f = (c.x - point.x) * dc.x + (c.y - point.y) * dc.y + (c.z - point.z) * dc.z;
+                df = dc.x * dc.x + dc.y * dc.y + dc.z * dc.z;
+                if (f == 0.0)
+                {
+                        break;
+                }
+                if (f < 0.0)
+                {
+                        lower = u;
+                }
+                else
+                {
+                        upper = u;
+                }
+                if ((i > 0) && (u != u_previous))
+                {
+                        /* Secant slope, the slope of the derivative
+                         * includes the curvature of the spline. */
+                        df = (f - f_previous) / (u - u_previous);
+                }
+                step = (df > 0.0) ? f / df : 0.0;
+                if ((df <= 0.0) || (u - step <= lower) || (u - step >= upper))
+                {
+                        step = u - 0.5 * (lower + upper);
+                }
+                u_previous = u;
+                f_previous = f;
+                u -= step;
+                if ((fabs (step) < 1e-15 * (1.0 + fabs (u)))
+                  || (upper - lower < 1e-15 * (1.0 + fabs (u))))
+                {
+                        break;
+                }
+        }
+        return (u);
+}
+
+
+/*!
+ * \brief Calculate the nearest point on a DXF \c SPLINE to a point.
+ *
+ * Every knot span is sampled \c DXF_SPLINE_NEAREST_SAMPLES_PER_SPAN
+ * times, and every local minimum of the samples is refined with
+ * \c dxf_spline_refine_nearest_point().\n
+ * A spline with fit points only is measured along the polyline through
+ * its fit points.
+ *
+ * \return the distance between the point and the \c spline in drawing
+ * units, or -1.0 when an error occurred.
+ *
+ * \version According to DXF R13.
+ * \version According to DXF R14.
+ */
+double
+dxf_spline_calculate_nearest_point
+(
+        DxfSpline *spline,
+                /*!< a pointer to a DXF \c SPLINE entity. */
+        DxfVec3 point,
+                /*!< the point in WCS. */
+        DxfVec3 *nearest,
+                /*!< the nearest point on the \c spline (output), may be
+                 * \c NULL. */
+        double *parameter
+                /*!< the parameter of the nearest point, a knot value,
+                 * or the index of the fit point plus the fraction of
+                 * the segment to the next fit point (output), may be
+                 * \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const double *knots = NULL;
+        DxfVec3 c;
+        DxfVec3 q;
+        double best_u = 0.0;
+        double best_distance = HUGE_VAL;
+        double distance;
+        double u;
+        double t;
+        double samples_u[3];
+        double samples_distance[3];
+        int number_of_samples = 0;
+        int i;
+        int k;
+
+        /* Do some basic checks. */
+        if (spline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1.0);
+        }
+        if (!dxf_spline_is_evaluable (spline))
+        {
+                if ((spline->p1 == NULL) || (spline->number_of_fit_points < 1))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () the spline has no valid control points and knots.\n")),
+                          __FUNCTION__);
+                        return (-1.0);
+                }
+                for (i = 0; i < spline->number_of_fit_points; i++)
+                {
+                        distance = dxf_vec3_nearest_point_on_segment (spline->p1[i],
+                          spline->p1[(i + 1 < spline->number_of_fit_points) ? i + 1 : i],
+                          point, &q, &t);
+                        if (distance < best_distance)
+                        {
+                                best_distance = distance;
+                                best_u = i + t;
+                                if (nearest != NULL)
+                                {
+                                        *nearest = q;
+                                }
+                        }
+                }
+                if (parameter != NULL)
+                {
+                        *parameter = best_u;
+                }
+                return (best_distance);
+        }
+        knots = spline->knot_value;
+        /* Sweep the samples with a window of three, refining the
+         * middle sample when it is a local minimum, and the first and
+         * the last sample when they are nearer than their neighbour. */
+        for (k = spline->degree; k <= spline->number_of_control_points; k++)
+        {
+                if ((k < spline->number_of_control_points) && (knots[k] >= knots[k + 1]))
+                {
+                        continue;
+                }
+                for (i = 0; i < DXF_SPLINE_NEAREST_SAMPLES_PER_SPAN; i++)
+                {
+                        if (k == spline->number_of_control_points)
+                        {
+                                /* The end of the curve. */
+                                u = knots[k];
+                        }
+                        else
+                        {
+                                u = knots[k] + (knots[k + 1] - knots[k]) * i / DXF_SPLINE_NEAREST_SAMPLES_PER_SPAN;
+                        }
+                        dxf_spline_calculate_point (spline, u, &c, NULL);
+                        distance = (c.x - point.x) * (c.x - point.x)
+                          + (c.y - point.y) * (c.y - point.y)
+                          + (c.z - point.z) * (c.z - point.z);
+                        if (distance < best_distance)
+                        {
+                                /* Also covers the end samples. */
+                                best_distance = distance;
+                                best_u = u;
+                        }
+                        if (number_of_samples == 3)
+                        {
+                                samples_u[0] = samples_u[1];
+                                samples_distance[0] = samples_distance[1];
+                                samples_u[1] = samples_u[2];
+                                samples_distance[1] = samples_distance[2];
+                                number_of_samples = 2;
+                        }
+                        samples_u[number_of_samples] = u;
+                        samples_distance[number_of_samples] = distance;
+                        number_of_samples++;
+                        if (((number_of_samples == 2)
+                          && (samples_distance[0] <= samples_distance[1]))
+                          || ((number_of_samples == 3)
+                          && (samples_distance[1] <= samples_distance[0])
+                          && (samples_distance[1] <= samples_distance[2]))
+                          || ((k == spline->number_of_control_points)
+                          && (samples_distance[number_of_samples - 1] <= samples_distance[number_of_samples - 2])))
+                        {
+                                t = dxf_spline_refine_nearest_point (spline, point,
+                                  samples_u[0], samples_u[number_of_samples - 1],
+                                  samples_u[(number_of_samples == 3) ? 1 : 0]);
+                                dxf_spline_calculate_point (spline, t, &c, NULL);
+                                distance = (c.x - point.x) * (c.x - point.x)
+                                  + (c.y - point.y) * (c.y - point.y)
+                                  + (c.z - point.z) * (c.z - point.z);
+                                if (distance < best_distance)
+                                {
+                                        best_distance = distance;
+                                        best_u = t;
+                                }
+                        }
+                        if (k == spline->number_of_control_points)
+                        {
+                                break;
+                        }
+                }
+        }
+        dxf_spline_calculate_point (spline, best_u, &c, NULL);
+        if (nearest != NULL)
+        {
+                *nearest = c;
+        }
+        if (parameter != NULL)
+        {
+                *parameter = best_u;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (sqrt (best_distance));
+}
+
+
 /* EOF */
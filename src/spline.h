@@ -39,11 +39,18 @@
 #include "global.h"
 #include "binary_graphics_data.h"
 #include "point.h"
+#include "vec.h"
 
 
 #define DXF_SPLINE_KNOT_TOLERANCE_DEFAULT 0.0000001
 #define DXF_SPLINE_CONTROL_POINT_TOLERANCE_DEFAULT 0.0000001
 #define DXF_SPLINE_FIT_TOLERANCE_DEFAULT 0.0000000001
+#define DXF_SPLINE_MAX_DEGREE 15
+        /*!< \brief The highest degree of a spline curve which can be
+         * evaluated. */
+#define DXF_SPLINE_NEAREST_SAMPLES_PER_SPAN 8
+        /*!< \brief Number of samples per knot span taken before
+         * refining the nearest point on a spline curve. */
 
 
 /*!
@@ -165,17 +172,19 @@ dxf_spline_struct
                  * class-level transparency data.\n
                  * Group code = 440. */
         /* Specific members for a DXF spline. */
-        DxfPoint *p0;
-                /*! Control point (multiple entries).\n
+        DxfVec3 *p0;
+                /*!< Control points (multiple entries), an array of
+                 * \c number_of_control_points entries.\n
                  * Group codes = 10, 20 and 30.*/
-        DxfPoint *p1;
-                /*! Fit point (multiple entries).\n
+        DxfVec3 *p1;
+                /*!< Fit points (multiple entries), an array of
+                 * \c number_of_fit_points entries.\n
                  * Group codes = 11, 21 and 31.*/
-        DxfPoint *p2;
-                /*! Start tangent point.\n
+        DxfVec3 p2;
+                /*!< Start tangent point.\n
                  * May be omitted (in WCS).\n
                  * Group codes = 12, 22 and 32.*/
-        DxfPoint *p3;
+        DxfVec3 p3;
                 /*!< End tangent point.\n
                  * May be omitted (in WCS).\n
                  * Group codes = 13, 23 and 33. */
@@ -217,6 +226,12 @@ dxf_spline_struct
         int number_of_fit_points;
                 /*!< group code = 74\n
                  * Number of fit points (if any).*/
+        int p0_size;
+                /*!< Number of allocated entries in \c p0, 0 when
+                 * unknown (set with \c dxf_spline_set_p0()). */
+        int p1_size;
+                /*!< Number of allocated entries in \c p1, 0 when
+                 * unknown (set with \c dxf_spline_set_p1()). */
         double extr_x0;
                 /*!< X-value of the extrusion vector.\n
                  * Defaults to 0.0 if omitted in the DXF file.\n
@@ -484,7 +499,7 @@ dxf_spline_set_transparency
         DxfSpline *spline,
         long transparency
 );
-DxfPoint *
+DxfVec3 *
 dxf_spline_get_p0
 (
         DxfSpline *spline
@@ -493,9 +508,9 @@ DxfSpline *
 dxf_spline_set_p0
 (
         DxfSpline *spline,
-        DxfPoint *p0
+        DxfVec3 *p0
 );
-DxfPoint *
+DxfVec3 *
 dxf_spline_get_p1
 (
         DxfSpline *spline
@@ -504,9 +519,25 @@ DxfSpline *
 dxf_spline_set_p1
 (
         DxfSpline *spline,
-        DxfPoint *p1
+        DxfVec3 *p1
 );
 
+int
+dxf_spline_calculate_point
+(
+        DxfSpline *spline,
+        double u,
+        DxfVec3 *point,
+        DxfVec3 *derivative
+);
+double
+dxf_spline_calculate_nearest_point
+(
+        DxfSpline *spline,
+        DxfVec3 point,
+        DxfVec3 *nearest,
+        double *parameter
+);
 
 #endif /* LIBDXF_SRC_SPLINE_H */
 
@@ -33,6 +33,8 @@
 
 
 #include "style.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -173,7 +175,7 @@ dxf_style_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (style == NULL)
@@ -184,9 +186,10 @@ dxf_style_read
                 style = dxf_style_new ();
                 style = dxf_style_init (style);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -195,7 +198,7 @@ dxf_style_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -209,21 +212,21 @@ dxf_style_read
                 {
                         /* Now follows a string containing a style name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", style->style_name);
+                        style->style_name = dxf_read_string (fp, style->style_name);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a primary
                          * font filename. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", style->primary_font_filename);
+                        style->primary_font_filename = dxf_read_string (fp, style->primary_font_filename);
                 }
                 else if (strcmp (temp_string, "4") == 0)
                 {
                         /* Now follows a string containing a big font
                          * filename. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", style->big_font_filename);
+                        style->big_font_filename = dxf_read_string (fp, style->big_font_filename);
                 }
                 else if (strcmp (temp_string, "40") == 0)
                 {
@@ -287,14 +290,14 @@ dxf_style_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", style->dictionary_owner_soft);
+                        style->dictionary_owner_soft = dxf_read_string (fp, style->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", style->dictionary_owner_hard);
+                        style->dictionary_owner_hard = dxf_read_string (fp, style->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -308,7 +311,13 @@ dxf_style_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (style->style_name, "") == 0)
@@ -327,7 +336,7 @@ dxf_style_read
                   __FUNCTION__, fp->filename, fp->line_number);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -35,6 +35,8 @@
 
 
 #include "table.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -356,7 +358,7 @@ dxf_table_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (table == NULL)
@@ -371,9 +373,10 @@ dxf_table_read
         j = 0;
         k = 0;
         l = 0;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -382,16 +385,16 @@ dxf_table_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a block name;
                          * an anonymous block begins with a *T value. */
-                        fscanf (fp->fp, "%s\n", table->block_name);
+                        table->block_name = dxf_read_string (fp, table->block_name);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -547,28 +550,28 @@ dxf_table_read
                         /* Now follows a string containing a soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->dictionary_owner_soft);
+                        table->dictionary_owner_soft = dxf_read_string (fp, table->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "342") == 0)
                 {
                         /* Now follows a string containing a hard pointer
                          * ID of the TABLESTYLE object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->tablestyle_object_pointer);
+                        table->tablestyle_object_pointer = dxf_read_string (fp, table->tablestyle_object_pointer);
                 }
                 else if (strcmp (temp_string, "343") == 0)
                 {
                         /* Now follows a string containing a hard pointer
                          * ID of the owning BLOCK record. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->owning_block_pointer);
+                        table->owning_block_pointer = dxf_read_string (fp, table->owning_block_pointer);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing a hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->dictionary_owner_hard);
+                        table->dictionary_owner_hard = dxf_read_string (fp, table->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -582,10 +585,16 @@ dxf_table_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -0,0 +1,1478 @@
+/*!
+ * \file tessellation.c
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Functions for the tessellation of arcs, circles, ellipses and bulges.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <pthread.h>
+#include "tessellation.h"
+
+
+/*!
+ * \brief A number of entities tessellated by one thread of
+ * \c dxf_tessellation_add_entities().
+ */
+typedef struct
+dxf_tessellation_task
+{
+        int first;
+                /*!< Index of the first entity. */
+        int last;
+                /*!< Index after the last entity. */
+        DxfTessellationBuffer buffer;
+                /*!< The polylines of the entities. */
+        int number_of_entities;
+                /*!< Number of entities tessellated. */
+} DxfTessellationTask;
+
+
+/*!
+ * \brief The entities and tasks shared by the threads of
+ * \c dxf_tessellation_add_entities().
+ */
+typedef struct
+dxf_tessellation_job
+{
+        const DxfTessellation *tolerance;
+                /*!< The tolerance. */
+        DxfDrawingEntity *entities;
+                /*!< Array of entities. */
+        DxfTessellationTask *tasks;
+                /*!< Array of tasks, in entity order. */
+        int number_of_tasks;
+                /*!< Number of tasks. */
+        int next_task;
+                /*!< Index of the next unclaimed task. */
+} DxfTessellationJob;
+
+
+/*!
+ * \brief Reserve room for a number of points at the end of a buffer.
+ *
+ * \return a pointer to the room, or \c NULL when no memory could be
+ * allocated.
+ */
+static DxfVec3 *
+dxf_tessellation_reserve
+(
+        DxfTessellationBuffer *buffer,
+                /*!< the buffer. */
+        int number_of_points
+                /*!< number of points. */
+)
+{
+        DxfVec3 *points = NULL;
+        int size;
+
+        if (buffer->number_of_points + number_of_points > buffer->points_size)
+        {
+                size = (buffer->points_size == 0) ? 256 : 2 * buffer->points_size;
+                while (size < buffer->number_of_points + number_of_points)
+                {
+                        size *= 2;
+                }
+                points = realloc (buffer->points, size * sizeof (DxfVec3));
+                if (points == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for tessellation points.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                buffer->points = points;
+                buffer->points_size = size;
+        }
+        return (buffer->points + buffer->number_of_points);
+}
+
+
+/*!
+ * \brief Reserve room for a number of polylines at the end of a buffer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_tessellation_reserve_runs
+(
+        DxfTessellationBuffer *buffer,
+                /*!< the buffer. */
+        int number_of_runs
+                /*!< number of polylines. */
+)
+{
+        DxfTessellationRun *runs = NULL;
+        int size;
+
+        if (buffer->number_of_runs + number_of_runs > buffer->runs_size)
+        {
+                size = (buffer->runs_size == 0) ? 16 : 2 * buffer->runs_size;
+                while (size < buffer->number_of_runs + number_of_runs)
+                {
+                        size *= 2;
+                }
+                runs = realloc (buffer->runs, size * sizeof (DxfTessellationRun));
+                if (runs == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for tessellation runs.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                buffer->runs = runs;
+                buffer->runs_size = size;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Start a polyline in a buffer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_tessellation_begin_run
+(
+        DxfTessellationBuffer *buffer,
+                /*!< the buffer. */
+        int entity
+                /*!< index of the entity. */
+)
+{
+        DxfTessellationRun *runs = NULL;
+
+        if (dxf_tessellation_reserve_runs (buffer, 1) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        runs = &buffer->runs[buffer->number_of_runs++];
+        runs->entity = entity;
+        runs->first = buffer->number_of_points;
+        runs->number_of_points = 0;
+        runs->closed = FALSE;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Finish the last polyline in a buffer.
+ */
+static void
+dxf_tessellation_end_run
+(
+        DxfTessellationBuffer *buffer,
+                /*!< the buffer. */
+        int closed
+                /*!< \c TRUE for a closed polyline. */
+)
+{
+        DxfTessellationRun *run = &buffer->runs[buffer->number_of_runs - 1];
+
+        run->number_of_points = buffer->number_of_points - run->first;
+        run->closed = closed;
+}
+
+
+/*!
+ * \brief Add a point to the last polyline in a buffer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_tessellation_add_point
+(
+        DxfTessellationBuffer *buffer,
+                /*!< the buffer. */
+        DxfVec3 point
+                /*!< the point. */
+)
+{
+        DxfVec3 *room = dxf_tessellation_reserve (buffer, 1);
+
+        if (room == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        *room = point;
+        buffer->number_of_points++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add an elliptical arc to the last polyline in a buffer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_tessellation_add_elliptical_arc
+(
+        DxfTessellationBuffer *buffer,
+                /*!< the buffer. */
+        const DxfTessellation *tolerance,
+                /*!< the tolerance. */
+        DxfVec3 center,
+                /*!< center point. */
+        DxfVec3 u,
+                /*!< major axis. */
+        DxfVec3 v,
+                /*!< minor axis. */
+        double start,
+                /*!< start parameter in radians. */
+        double sweep
+                /*!< included parameter range in radians. */
+)
+{
+        DxfVec3 *room = NULL;
+        int n;
+
+        n = dxf_tessellation_elliptical_arc (tolerance, center, u, v, start, sweep, NULL, 0);
+        room = dxf_tessellation_reserve (buffer, n);
+        if (room == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        buffer->number_of_points += dxf_tessellation_elliptical_arc (tolerance,
+          center, u, v, start, sweep, room, n);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a polyline segment with a bulge to the last polyline in a
+ * buffer.
+ *
+ * The start point of the segment is the last point of the polyline.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_tessellation_add_bulge
+(
+        DxfTessellationBuffer *buffer,
+                /*!< the buffer. */
+        const DxfTessellation *tolerance,
+                /*!< the tolerance. */
+        DxfOcs *ocs,
+                /*!< the OCS of the polyline. */
+        double x0,
+                /*!< X-value of the start point in the OCS. */
+        double y0,
+                /*!< Y-value of the start point in the OCS. */
+        double x1,
+                /*!< X-value of the end point in the OCS. */
+        double y1,
+                /*!< Y-value of the end point in the OCS. */
+        double elevation,
+                /*!< elevation of the polyline. */
+        double bulge
+                /*!< bulge of the segment. */
+)
+{
+        DxfVec3 *room = NULL;
+        int n;
+
+        buffer->number_of_points--;
+        n = dxf_tessellation_bulge (tolerance, ocs, x0, y0, x1, y1, elevation, bulge, NULL, 0);
+        room = dxf_tessellation_reserve (buffer, n);
+        if (room == NULL)
+        {
+                buffer->number_of_points++;
+                return (EXIT_FAILURE);
+        }
+        buffer->number_of_points += dxf_tessellation_bulge (tolerance, ocs,
+          x0, y0, x1, y1, elevation, bulge, room, n);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the start and the signed included angle of an arc or
+ * elliptical arc edge of a hatch boundary path.
+ *
+ * Clockwise edges have mirrored angles.
+ */
+static void
+dxf_tessellation_get_edge_sweep
+(
+        double start_angle,
+                /*!< start angle in degrees. */
+        double end_angle,
+                /*!< end angle in degrees. */
+        int is_ccw,
+                /*!< counterclockwise flag. */
+        double *start,
+                /*!< start angle in radians (output). */
+        double *sweep
+                /*!< included angle in radians (output). */
+)
+{
+        double included = end_angle - start_angle;
+
+        while (included > 360.0)
+        {
+                included -= 360.0;
+        }
+        while (included <= 0.0)
+        {
+                included += 360.0;
+        }
+        *start = (is_ccw ? start_angle : -start_angle) * M_PI / 180.0;
+        *sweep = (is_ccw ? included : -included) * M_PI / 180.0;
+}
+
+
+/*!
+ * \brief Add the boundary paths of a hatch to a buffer.
+ *
+ * Every edge becomes a polyline, every polyline path a closed
+ * polyline.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a spline
+ * edge is invalid or no memory could be allocated.
+ */
+static int
+dxf_tessellation_add_hatch
+(
+        DxfTessellationBuffer *buffer,
+                /*!< the buffer. */
+        const DxfTessellation *tolerance,
+                /*!< the tolerance. */
+        DxfHatch *hatch,
+                /*!< the hatch. */
+        int index
+                /*!< index of the hatch. */
+)
+{
+        DxfHatchBoundaryPath *path = NULL;
+        DxfHatchBoundaryPathEdge *edge = NULL;
+        DxfHatchBoundaryPathEdgeArc *arc = NULL;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse = NULL;
+        DxfHatchBoundaryPathEdgeLine *line = NULL;
+        DxfHatchBoundaryPathEdgeSpline *spline = NULL;
+        DxfHatchBoundaryPathPolyline *polyline = NULL;
+        DxfHatchBoundaryPathPolylineVertex *vertex = NULL;
+        DxfHatchBoundaryPathPolylineVertex *next = NULL;
+        DxfNurbs *nurbs = NULL;
+        DxfVec3 *points = NULL;
+        DxfOcs ocs;
+        DxfVec3 center;
+        DxfVec3 u;
+        DxfVec3 v;
+        double z = hatch->z0;
+        double start;
+        double sweep;
+        int number_of_points;
+        int result = EXIT_SUCCESS;
+        int i;
+
+        dxf_ocs_init (&ocs, hatch->extr_x0, hatch->extr_y0, hatch->extr_z0);
+        for (path = (DxfHatchBoundaryPath *) hatch->paths; (path != NULL) && (result == EXIT_SUCCESS); path = (DxfHatchBoundaryPath *) path->next)
+        {
+                for (edge = (DxfHatchBoundaryPathEdge *) path->edges; (edge != NULL) && (result == EXIT_SUCCESS); edge = (DxfHatchBoundaryPathEdge *) edge->next)
+                {
+                        for (line = (DxfHatchBoundaryPathEdgeLine *) edge->lines; (line != NULL) && (result == EXIT_SUCCESS); line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+                        {
+                                result = dxf_tessellation_begin_run (buffer, index);
+                                if (result == EXIT_SUCCESS)
+                                {
+                                        result = dxf_tessellation_add_point (buffer, dxf_ocs_to_wcs (&ocs, line->x0, line->y0, z));
+                                        result |= dxf_tessellation_add_point (buffer, dxf_ocs_to_wcs (&ocs, line->x1, line->y1, z));
+                                        dxf_tessellation_end_run (buffer, FALSE);
+                                }
+                        }
+                        for (arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs; (arc != NULL) && (result == EXIT_SUCCESS); arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+                        {
+                                dxf_tessellation_get_edge_sweep (arc->start_angle, arc->end_angle,
+                                  arc->is_ccw, &start, &sweep);
+                                center = dxf_ocs_to_wcs (&ocs, arc->x0, arc->y0, z);
+                                u = dxf_ocs_to_wcs (&ocs, arc->radius, 0.0, 0.0);
+                                v = dxf_ocs_to_wcs (&ocs, 0.0, arc->radius, 0.0);
+                                result = dxf_tessellation_begin_run (buffer, index);
+                                if (result == EXIT_SUCCESS)
+                                {
+                                        result = dxf_tessellation_add_elliptical_arc (buffer, tolerance,
+                                          center, u, v, start, sweep);
+                                        dxf_tessellation_end_run (buffer, fabs (sweep) >= 2.0 * M_PI);
+                                }
+                        }
+                        for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses; (ellipse != NULL) && (result == EXIT_SUCCESS); ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+                        {
+                                dxf_tessellation_get_edge_sweep (ellipse->start_angle, ellipse->end_angle,
+                                  ellipse->is_ccw, &start, &sweep);
+                                center = dxf_ocs_to_wcs (&ocs, ellipse->x0, ellipse->y0, z);
+                                u = dxf_ocs_to_wcs (&ocs, ellipse->x1, ellipse->y1, 0.0);
+                                v = dxf_ocs_to_wcs (&ocs, -ellipse->ratio * ellipse->y1,
+                                  ellipse->ratio * ellipse->x1, 0.0);
+                                result = dxf_tessellation_begin_run (buffer, index);
+                                if (result == EXIT_SUCCESS)
+                                {
+                                        result = dxf_tessellation_add_elliptical_arc (buffer, tolerance,
+                                          center, u, v, start, sweep);
+                                        dxf_tessellation_end_run (buffer, fabs (sweep) >= 2.0 * M_PI);
+                                }
+                        }
+                        for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines; (spline != NULL) && (result == EXIT_SUCCESS); spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+                        {
+                                if (nurbs == NULL)
+                                {
+                                        nurbs = dxf_nurbs_init (dxf_nurbs_new ());
+                                }
+                                number_of_points = 0;
+                                result = EXIT_FAILURE;
+                                if ((nurbs != NULL)
+                                  && (dxf_nurbs_set_hatch_spline (nurbs, spline) == EXIT_SUCCESS)
+                                  && (dxf_nurbs_tessellate (nurbs, tolerance->chord_height,
+                                  &points, &number_of_points) == EXIT_SUCCESS))
+                                {
+                                        result = dxf_tessellation_begin_run (buffer, index);
+                                        for (i = 0; (i < number_of_points) && (result == EXIT_SUCCESS); i++)
+                                        {
+                                                result = dxf_tessellation_add_point (buffer,
+                                                  dxf_ocs_to_wcs (&ocs, points[i].x, points[i].y, z));
+                                        }
+                                        if (result == EXIT_SUCCESS)
+                                        {
+                                                dxf_tessellation_end_run (buffer, FALSE);
+                                        }
+                                }
+                                free (points);
+                                points = NULL;
+                        }
+                }
+                for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines; (polyline != NULL) && (result == EXIT_SUCCESS); polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+                {
+                        vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                        if (vertex == NULL)
+                        {
+                                continue;
+                        }
+                        result = dxf_tessellation_begin_run (buffer, index);
+                        if (result == EXIT_SUCCESS)
+                        {
+                                result = dxf_tessellation_add_point (buffer, dxf_ocs_to_wcs (&ocs, vertex->x0, vertex->y0, z));
+                        }
+                        /* A boundary polyline is always closed. */
+                        for (; (vertex != NULL) && (result == EXIT_SUCCESS); vertex = (DxfHatchBoundaryPathPolylineVertex *) vertex->next)
+                        {
+                                next = (DxfHatchBoundaryPathPolylineVertex *) vertex->next;
+                                if (next == NULL)
+                                {
+                                        next = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                                }
+                                result = dxf_tessellation_add_bulge (buffer, tolerance, &ocs,
+                                  vertex->x0, vertex->y0, next->x0, next->y0, z,
+                                  vertex->has_bulge ? vertex->bulge : 0.0);
+                        }
+                        if (result == EXIT_SUCCESS)
+                        {
+                                dxf_tessellation_end_run (buffer, TRUE);
+                        }
+                }
+        }
+        if (nurbs != NULL)
+        {
+                dxf_nurbs_free (nurbs);
+        }
+        return ((result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Add the polyline of a DXF \c ARC, \c CIRCLE or \c ELLIPSE
+ * entity to a buffer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the entity
+ * is degenerate or no memory could be allocated.
+ */
+static int
+dxf_tessellation_add_conic
+(
+        DxfTessellationBuffer *buffer,
+                /*!< the buffer. */
+        const DxfTessellation *tolerance,
+                /*!< the tolerance. */
+        int type,
+                /*!< type of the entity, \c ARC, \c CIRCLE or
+                 * \c ELLIPSE. */
+        void *entity,
+                /*!< the entity. */
+        int index
+                /*!< index of the entity. */
+)
+{
+        DxfArc *arc = NULL;
+        DxfCircle *circle = NULL;
+        DxfEllipse *ellipse = NULL;
+        DxfOcs ocs;
+        DxfVec3 center;
+        DxfVec3 u;
+        DxfVec3 v;
+        double start = 0.0;
+        double sweep = 2.0 * M_PI;
+        int result;
+
+        if (type == ELLIPSE)
+        {
+                ellipse = (DxfEllipse *) entity;
+                if ((ellipse->ratio <= 0.0)
+                  || ((ellipse->x1 == 0.0) && (ellipse->y1 == 0.0) && (ellipse->z1 == 0.0)))
+                {
+                        return (EXIT_FAILURE);
+                }
+                /* The center and the major axis are in WCS, the minor
+                 * axis is perpendicular to both the extrusion and the
+                 * major axis. */
+                dxf_ocs_init (&ocs, ellipse->extr_x0, ellipse->extr_y0, ellipse->extr_z0);
+                center.x = ellipse->x0;
+                center.y = ellipse->y0;
+                center.z = ellipse->z0;
+                u.x = ellipse->x1;
+                u.y = ellipse->y1;
+                u.z = ellipse->z1;
+                v.x = ellipse->ratio * (ocs.az.y * u.z - ocs.az.z * u.y);
+                v.y = ellipse->ratio * (ocs.az.z * u.x - ocs.az.x * u.z);
+                v.z = ellipse->ratio * (ocs.az.x * u.y - ocs.az.y * u.x);
+                if (ellipse->start_angle != ellipse->end_angle)
+                {
+                        start = ellipse->start_angle;
+                        sweep = ellipse->end_angle - ellipse->start_angle;
+                        while (sweep <= 0.0)
+                        {
+                                sweep += 2.0 * M_PI;
+                        }
+                        sweep = (sweep > 2.0 * M_PI) ? 2.0 * M_PI : sweep;
+                }
+        }
+        else
+        {
+                if (type == ARC)
+                {
+                        arc = (DxfArc *) entity;
+                        dxf_ocs_init (&ocs, arc->extr_x0, arc->extr_y0, arc->extr_z0);
+                        center = dxf_ocs_to_wcs (&ocs, arc->x0, arc->y0, arc->z0);
+                        u = dxf_ocs_to_wcs (&ocs, arc->radius, 0.0, 0.0);
+                        v = dxf_ocs_to_wcs (&ocs, 0.0, arc->radius, 0.0);
+                        start = arc->start_angle * M_PI / 180.0;
+                        sweep = arc->end_angle - arc->start_angle;
+                        while (sweep <= 0.0)
+                        {
+                                sweep += 360.0;
+                        }
+                        sweep = (sweep > 360.0) ? 2.0 * M_PI : sweep * M_PI / 180.0;
+                        if (arc->radius <= 0.0)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+                else
+                {
+                        circle = (DxfCircle *) entity;
+                        dxf_ocs_init (&ocs, circle->extr_x0, circle->extr_y0, circle->extr_z0);
+                        center = dxf_ocs_to_wcs (&ocs, circle->x0, circle->y0, circle->z0);
+                        u = dxf_ocs_to_wcs (&ocs, circle->radius, 0.0, 0.0);
+                        v = dxf_ocs_to_wcs (&ocs, 0.0, circle->radius, 0.0);
+                        if (circle->radius <= 0.0)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+        }
+        result = dxf_tessellation_begin_run (buffer, index);
+        if (result == EXIT_SUCCESS)
+        {
+                result = dxf_tessellation_add_elliptical_arc (buffer, tolerance,
+                  center, u, v, start, sweep);
+                dxf_tessellation_end_run (buffer, sweep >= 2.0 * M_PI);
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Add the polyline of a DXF \c LWPOLYLINE entity to a buffer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * polyline has no vertices or no memory could be allocated.
+ */
+static int
+dxf_tessellation_add_lwpolyline
+(
+        DxfTessellationBuffer *buffer,
+                /*!< the buffer. */
+        const DxfTessellation *tolerance,
+                /*!< the tolerance. */
+        DxfLWPolyline *lwpolyline,
+                /*!< the polyline. */
+        int index
+                /*!< index of the polyline. */
+)
+{
+        DxfLWPolylineVertex *vertices = lwpolyline->vertices;
+        DxfOcs ocs;
+        int closed = (lwpolyline->flag & 1) && (lwpolyline->number_vertices > 1);
+        int n = lwpolyline->number_vertices;
+        int result;
+        int i;
+        int j;
+
+        if ((vertices == NULL) || (n < 1))
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_ocs_init (&ocs, lwpolyline->extr_x0, lwpolyline->extr_y0, lwpolyline->extr_z0);
+        result = dxf_tessellation_begin_run (buffer, index);
+        if (result == EXIT_SUCCESS)
+        {
+                result = dxf_tessellation_add_point (buffer, dxf_ocs_to_wcs (&ocs,
+                  vertices[0].x0, vertices[0].y0, lwpolyline->elevation));
+        }
+        for (i = 0; (i < (closed ? n : n - 1)) && (result == EXIT_SUCCESS); i++)
+        {
+                j = (i + 1) % n;
+                result = dxf_tessellation_add_bulge (buffer, tolerance, &ocs,
+                  vertices[i].x0, vertices[i].y0, vertices[j].x0, vertices[j].y0,
+                  lwpolyline->elevation, vertices[i].bulge);
+        }
+        if (result == EXIT_SUCCESS)
+        {
+                dxf_tessellation_end_run (buffer, closed);
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Skip the spline frame control points of a polyline.
+ *
+ * \return the first vertex which is not a spline frame control point,
+ * or \c NULL.
+ */
+static DxfVertex *
+dxf_tessellation_skip_frame_vertices
+(
+        DxfVertex *vertex
+                /*!< a vertex of a polyline, may be \c NULL. */
+)
+{
+        while ((vertex != NULL) && (vertex->flag & 16))
+        {
+                vertex = (DxfVertex *) vertex->next;
+        }
+        return (vertex);
+}
+
+
+/*!
+ * \brief Add the polyline of a DXF \c POLYLINE entity to a buffer.
+ *
+ * A 2D polyline is in its OCS at the elevation of the polyline, a 3D
+ * polyline is in WCS and has no bulges.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * polyline is a mesh, has no vertices or no memory could be allocated.
+ */
+static int
+dxf_tessellation_add_polyline
+(
+        DxfTessellationBuffer *buffer,
+                /*!< the buffer. */
+        const DxfTessellation *tolerance,
+                /*!< the tolerance. */
+        DxfPolyline *polyline,
+                /*!< the polyline. */
+        int index
+                /*!< index of the polyline. */
+)
+{
+        DxfVertex *first = NULL;
+        DxfVertex *vertex = NULL;
+        DxfVertex *next = NULL;
+        DxfOcs ocs;
+        int closed = FALSE;
+        int result;
+
+        first = dxf_tessellation_skip_frame_vertices ((DxfVertex *) polyline->vertices);
+        if ((first == NULL) || (polyline->flag & (16 | 64)))
+        {
+                return (EXIT_FAILURE);
+        }
+        if (polyline->flag & 8)
+        {
+                dxf_ocs_init (&ocs, 0.0, 0.0, 1.0);
+        }
+        else
+        {
+                dxf_ocs_init (&ocs, polyline->extr_x0, polyline->extr_y0, polyline->extr_z0);
+        }
+        result = dxf_tessellation_begin_run (buffer, index);
+        if (result == EXIT_SUCCESS)
+        {
+                result = dxf_tessellation_add_point (buffer, dxf_ocs_to_wcs (&ocs,
+                  first->x0, first->y0, (polyline->flag & 8) ? first->z0 : polyline->z0));
+        }
+        for (vertex = first; (vertex != NULL) && (result == EXIT_SUCCESS); vertex = next)
+        {
+                next = dxf_tessellation_skip_frame_vertices ((DxfVertex *) vertex->next);
+                if (next == NULL)
+                {
+                        if (!(polyline->flag & 1) || (vertex == first))
+                        {
+                                break;
+                        }
+                        next = first;
+                        closed = TRUE;
+                }
+                if (polyline->flag & 8)
+                {
+                        result = dxf_tessellation_add_point (buffer,
+                          dxf_ocs_to_wcs (&ocs, next->x0, next->y0, next->z0));
+                }
+                else
+                {
+                        result = dxf_tessellation_add_bulge (buffer, tolerance, &ocs,
+                          vertex->x0, vertex->y0, next->x0, next->y0, polyline->z0,
+                          vertex->bulge);
+                }
+                if (closed)
+                {
+                        break;
+                }
+        }
+        if (result == EXIT_SUCCESS)
+        {
+                dxf_tessellation_end_run (buffer, closed);
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Get the number of segments of an arc.
+ *
+ * The angle of a segment is the largest angle within the chord height
+ * and the angle of the \c tolerance, see \c DxfTessellation.\n
+ * The chord height of an elliptical arc is within the chord height of
+ * the circle of its major radius.
+ *
+ * \return the number of segments, at least 1.
+ */
+int
+dxf_tessellation_get_number_of_segments
+(
+        const DxfTessellation *tolerance,
+                /*!< the tolerance, \c NULL for the default angle. */
+        double radius,
+                /*!< radius (major radius) of the arc. */
+        double sweep
+                /*!< included angle of the arc in radians. */
+)
+{
+        double step = 2.0 * M_PI / DXF_TESSELLATION_MIN_SEGMENTS;
+        double limit;
+        int n;
+
+        if ((tolerance == NULL)
+          || ((tolerance->chord_height <= 0.0) && (tolerance->angle <= 0.0)))
+        {
+                step = DXF_TESSELLATION_DEFAULT_ANGLE;
+        }
+        else
+        {
+                if ((tolerance->chord_height > 0.0) && (tolerance->chord_height < radius))
+                {
+                        limit = 2.0 * acos (1.0 - tolerance->chord_height / radius);
+                        step = (limit < step) ? limit : step;
+                }
+                if (tolerance->angle > 0.0)
+                {
+                        step = (tolerance->angle < step) ? tolerance->angle : step;
+                }
+        }
+        if (step < 2.0 * M_PI / DXF_TESSELLATION_MAX_SEGMENTS)
+        {
+                step = 2.0 * M_PI / DXF_TESSELLATION_MAX_SEGMENTS;
+        }
+        /* Allow for rounding in the sweep of a full turn. */
+        n = (int) ceil (fabs (sweep) / step - 1e-9);
+        return ((n > 1) ? n : 1);
+}
+
+
+/*!
+ * \brief Tessellate an elliptical (or circular) arc.
+ *
+ * The points of the arc are \f$ c + u \cos t + v \sin t \f$ for \c t
+ * from \c start over \c sweep, at equal steps of \c t: the cosine and
+ * the sine of a step are calculated once and every next point follows
+ * from rotating the previous one, the last point is calculated
+ * directly (and equals the first point for a full turn).\n
+ * The arc is in the space of \c center, \c u and \c v, pass WCS
+ * vectors for an arc in an OCS (see \c dxf_ocs_to_wcs()) to transform
+ * the axes once instead of every point.\n
+ * Like \c snprintf(), nothing is written when \c points_size is too
+ * small, and the number of points needed is returned.
+ *
+ * \return the number of points of the arc (the number of segments plus
+ * one).
+ */
+int
+dxf_tessellation_elliptical_arc
+(
+        const DxfTessellation *tolerance,
+                /*!< the tolerance, \c NULL for the default angle. */
+        DxfVec3 center,
+                /*!< center point. */
+        DxfVec3 u,
+                /*!< major axis (the radius along X for an arc). */
+        DxfVec3 v,
+                /*!< minor axis (the radius along Y for an arc). */
+        double start,
+                /*!< start parameter (angle) in radians. */
+        double sweep,
+                /*!< included parameter range in radians, negative for
+                 * clockwise. */
+        DxfVec3 *points,
+                /*!< an array receiving the points, may be \c NULL. */
+        int points_size
+                /*!< number of points in \c points. */
+)
+{
+        double radius;
+        double c;
+        double s;
+        double ct;
+        double st;
+        double t;
+        int n;
+        int i;
+
+        radius = sqrt (u.x * u.x + u.y * u.y + u.z * u.z);
+        t = sqrt (v.x * v.x + v.y * v.y + v.z * v.z);
+        radius = (t > radius) ? t : radius;
+        n = dxf_tessellation_get_number_of_segments (tolerance, radius, sweep);
+        if ((points == NULL) || (points_size < n + 1))
+        {
+                return (n + 1);
+        }
+        c = cos (sweep / n);
+        s = sin (sweep / n);
+        ct = cos (start);
+        st = sin (start);
+        for (i = 0; i < n; i++)
+        {
+                points[i].x = center.x + u.x * ct + v.x * st;
+                points[i].y = center.y + u.y * ct + v.y * st;
+                points[i].z = center.z + u.z * ct + v.z * st;
+                t = ct * c - st * s;
+                st = st * c + ct * s;
+                ct = t;
+        }
+        if (fabs (sweep) >= 2.0 * M_PI)
+        {
+                points[n] = points[0];
+        }
+        else
+        {
+                ct = cos (start + sweep);
+                st = sin (start + sweep);
+                points[n].x = center.x + u.x * ct + v.x * st;
+                points[n].y = center.y + u.y * ct + v.y * st;
+                points[n].z = center.z + u.z * ct + v.z * st;
+        }
+        return (n + 1);
+}
+
+
+/*!
+ * \brief Tessellate a polyline segment with a bulge.
+ *
+ * The arc follows from \c dxf_vec2_bulge_to_arc(), the points are in
+ * WCS and the first and the last point are the vertices.\n
+ * A straight segment (a bulge of 0.0) has two points.\n
+ * Like \c snprintf(), nothing is written when \c points_size is too
+ * small, and the number of points needed is returned.
+ *
+ * \return the number of points of the segment.
+ */
+int
+dxf_tessellation_bulge
+(
+        const DxfTessellation *tolerance,
+                /*!< the tolerance, \c NULL for the default angle. */
+        DxfOcs *ocs,
+                /*!< the OCS of the polyline, \c NULL for WCS. */
+        double x0,
+                /*!< X-value of the start point in the OCS. */
+        double y0,
+                /*!< Y-value of the start point in the OCS. */
+        double x1,
+                /*!< X-value of the end point in the OCS. */
+        double y1,
+                /*!< Y-value of the end point in the OCS. */
+        double elevation,
+                /*!< elevation (Z-value in the OCS) of the polyline. */
+        double bulge,
+                /*!< bulge of the segment. */
+        DxfVec3 *points,
+                /*!< an array receiving the points, may be \c NULL. */
+        int points_size
+                /*!< number of points in \c points. */
+)
+{
+        DxfOcs wcs;
+        DxfVec2 start;
+        DxfVec2 end;
+        DxfVec2 center;
+        double radius;
+        double start_angle;
+        double end_angle;
+        int n;
+
+        if (ocs == NULL)
+        {
+                dxf_ocs_init (&wcs, 0.0, 0.0, 1.0);
+                ocs = &wcs;
+        }
+        start.x = x0;
+        start.y = y0;
+        end.x = x1;
+        end.y = y1;
+        if (!dxf_vec2_bulge_to_arc (start, end, bulge, &center, &radius, &start_angle, &end_angle))
+        {
+                if ((points != NULL) && (points_size >= 2))
+                {
+                        points[0] = dxf_ocs_to_wcs (ocs, x0, y0, elevation);
+                        points[1] = dxf_ocs_to_wcs (ocs, x1, y1, elevation);
+                }
+                return (2);
+        }
+        n = dxf_tessellation_elliptical_arc (tolerance,
+          dxf_ocs_to_wcs (ocs, center.x, center.y, elevation),
+          dxf_ocs_to_wcs (ocs, radius, 0.0, 0.0),
+          dxf_ocs_to_wcs (ocs, 0.0, radius, 0.0),
+          start_angle, 4.0 * atan (bulge), points, points_size);
+        if ((points != NULL) && (points_size >= n))
+        {
+                /* Keep the vertices exact, for joining segments. */
+                points[0] = dxf_ocs_to_wcs (ocs, x0, y0, elevation);
+                points[n - 1] = dxf_ocs_to_wcs (ocs, x1, y1, elevation);
+        }
+        return (n);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfTessellationBuffer.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfTessellationBuffer *
+dxf_tessellation_buffer_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTessellationBuffer *buffer = NULL;
+        size_t size;
+
+        size = sizeof (DxfTessellationBuffer);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((buffer = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfTessellationBuffer struct.\n")),
+                  __FUNCTION__);
+                buffer = NULL;
+        }
+        else
+        {
+                memset (buffer, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (buffer);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in an empty
+ * \c DxfTessellationBuffer.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfTessellationBuffer *
+dxf_tessellation_buffer_init
+(
+        DxfTessellationBuffer *buffer
+                /*!< a pointer to the buffer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                buffer = dxf_tessellation_buffer_new ();
+        }
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for a DxfTessellationBuffer struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        buffer->points = NULL;
+        buffer->number_of_points = 0;
+        buffer->points_size = 0;
+        buffer->runs = NULL;
+        buffer->number_of_runs = 0;
+        buffer->runs_size = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (buffer);
+}
+
+
+/*!
+ * \brief Remove all polylines from a \c DxfTessellationBuffer, keeping
+ * its memory for reuse.
+ */
+void
+dxf_tessellation_buffer_clear
+(
+        DxfTessellationBuffer *buffer
+                /*!< a pointer to the buffer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return;
+        }
+        buffer->number_of_points = 0;
+        buffer->number_of_runs = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+}
+
+
+/*!
+ * \brief Append the polylines of a \c DxfTessellationBuffer to another
+ * \c DxfTessellationBuffer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated (\c buffer is not changed) or an error occurred.
+ */
+int
+dxf_tessellation_buffer_append
+(
+        DxfTessellationBuffer *buffer,
+                /*!< a pointer to the buffer receiving the polylines. */
+        DxfTessellationBuffer *source,
+                /*!< a pointer to the buffer with the polylines. */
+        int entity
+                /*!< index of the entity stored with the appended
+                 * polylines, -1 to keep the indices of \c source. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTessellationRun *run = NULL;
+        int i;
+
+        /* Do some basic checks. */
+        if ((buffer == NULL) || (source == NULL) || (buffer == source))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_tessellation_reserve (buffer, source->number_of_points) == NULL)
+          || (dxf_tessellation_reserve_runs (buffer, source->number_of_runs) != EXIT_SUCCESS))
+        {
+                return (EXIT_FAILURE);
+        }
+        if (source->number_of_points > 0)
+        {
+                memcpy (buffer->points + buffer->number_of_points, source->points,
+                  source->number_of_points * sizeof (DxfVec3));
+        }
+        for (i = 0; i < source->number_of_runs; i++)
+        {
+                run = &buffer->runs[buffer->number_of_runs + i];
+                *run = source->runs[i];
+                run->first += buffer->number_of_points;
+                if (entity >= 0)
+                {
+                        run->entity = entity;
+                }
+        }
+        buffer->number_of_points += source->number_of_points;
+        buffer->number_of_runs += source->number_of_runs;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfTessellationBuffer and
+ * its points and polylines.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_buffer_free
+(
+        DxfTessellationBuffer *buffer
+                /*!< a pointer to the memory occupied by the buffer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (buffer == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (buffer->points);
+        free (buffer->runs);
+        free (buffer);
+        buffer = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Tessellate a DXF entity into a buffer.
+ *
+ * A \c LINE becomes a polyline of two points, \c ARC, \c CIRCLE and
+ * \c ELLIPSE entities one polyline,
+ * \c LWPOLYLINE and \c POLYLINE entities (not meshes) one polyline
+ * with their bulge segments tessellated, and \c HATCH entities one
+ * polyline per boundary edge and one closed polyline per boundary
+ * polyline (spline edges are tessellated with \c dxf_nurbs_tessellate()
+ * to the chord height of \c tolerance).\n
+ * All points are transformed from the OCS of the entity to WCS.\n
+ * The polylines are appended to the buffer, a buffer is not changed
+ * when the tessellation of an entity fails.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the type
+ * is not supported, the entity is degenerate or an error occurred.
+ */
+int
+dxf_tessellation_add_entity
+(
+        const DxfTessellation *tolerance,
+                /*!< the tolerance, \c NULL for the default angle. */
+        int type,
+                /*!< type of the entity, a \c DxfEntityType value. */
+        void *entity,
+                /*!< a pointer to the entity. */
+        int index,
+                /*!< index of the entity, stored with its polylines. */
+        DxfTessellationBuffer *buffer
+                /*!< the buffer receiving the polylines. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTessellation none;
+        DxfLine *line = NULL;
+        DxfVec3 point;
+        int number_of_points;
+        int number_of_runs;
+        int result;
+
+        /* Do some basic checks. */
+        if ((entity == NULL) || (buffer == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (tolerance == NULL)
+        {
+                none.chord_height = 0.0;
+                none.angle = 0.0;
+                tolerance = &none;
+        }
+        number_of_points = buffer->number_of_points;
+        number_of_runs = buffer->number_of_runs;
+        switch (type)
+        {
+                case LINE:
+                        /* The end points of a line are in WCS. */
+                        line = (DxfLine *) entity;
+                        result = dxf_tessellation_begin_run (buffer, index);
+                        if (result == EXIT_SUCCESS)
+                        {
+                                point.x = line->x0;
+                                point.y = line->y0;
+                                point.z = line->z0;
+                                result = dxf_tessellation_add_point (buffer, point);
+                                point.x = line->x1;
+                                point.y = line->y1;
+                                point.z = line->z1;
+                                result |= dxf_tessellation_add_point (buffer, point);
+                                dxf_tessellation_end_run (buffer, FALSE);
+                        }
+                        break;
+                case ARC:
+                case CIRCLE:
+                case ELLIPSE:
+                        result = dxf_tessellation_add_conic (buffer, tolerance, type, entity, index);
+                        break;
+                case LWPOLYLINE:
+                        result = dxf_tessellation_add_lwpolyline (buffer, tolerance, (DxfLWPolyline *) entity, index);
+                        break;
+                case POLYLINE:
+                        result = dxf_tessellation_add_polyline (buffer, tolerance, (DxfPolyline *) entity, index);
+                        break;
+                case HATCH:
+                        result = dxf_tessellation_add_hatch (buffer, tolerance, (DxfHatch *) entity, index);
+                        break;
+                default:
+                        result = EXIT_FAILURE;
+                        break;
+        }
+        if (result != EXIT_SUCCESS)
+        {
+                buffer->number_of_points = number_of_points;
+                buffer->number_of_runs = number_of_runs;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Run a worker thread of \c dxf_tessellation_add_entities().
+ *
+ * \return \c NULL.
+ */
+static void *
+dxf_tessellation_worker
+(
+        void *data
+                /*!< a pointer to the \c DxfTessellationJob. */
+)
+{
+        DxfTessellationJob *job = (DxfTessellationJob *) data;
+        DxfTessellationTask *task = NULL;
+        int i;
+        int j;
+
+        while ((i = __atomic_fetch_add (&job->next_task, 1, __ATOMIC_RELAXED)) < job->number_of_tasks)
+        {
+                task = &job->tasks[i];
+                for (j = task->first; j < task->last; j++)
+                {
+                        if ((job->entities[j].entity != NULL)
+                          && (dxf_tessellation_add_entity (job->tolerance,
+                          job->entities[j].type, job->entities[j].entity, j,
+                          &task->buffer) == EXIT_SUCCESS))
+                        {
+                                task->number_of_entities++;
+                        }
+                }
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Tessellate a number of DXF entities into a buffer on multiple
+ * threads.
+ *
+ * Every thread tessellates \c DXF_TESSELLATION_ENTITIES_PER_TASK
+ * entities at a time into a private buffer, the private buffers are
+ * appended to \c buffer in entity order, so the output is identical to
+ * calling \c dxf_tessellation_add_entity() for each entity in turn
+ * (with the index in \c entities as the index of the entity).\n
+ * Entities of types without a tessellation are skipped.\n
+ * The entities must not be modified while they are tessellated.
+ *
+ * \return the number of entities tessellated, or -1 when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_entities
+(
+        const DxfTessellation *tolerance,
+                /*!< the tolerance, \c NULL for the default angle. */
+        DxfDrawingEntity *entities,
+                /*!< an array of entities, for example the
+                 * \c entities container of a drawing. */
+        int number_of_entities,
+                /*!< number of entities in \c entities. */
+        DxfTessellationBuffer *buffer,
+                /*!< the buffer receiving the polylines. */
+        int number_of_threads
+                /*!< number of threads, 0 for the number of online
+                 * processors. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTessellationJob job;
+        DxfTessellationTask *task = NULL;
+        pthread_t *threads = NULL;
+        int number_of_tessellated = 0;
+        int number_of_points;
+        int number_of_runs;
+        int started = 0;
+        int i;
+
+        /* Do some basic checks. */
+        if ((buffer == NULL) || ((number_of_entities > 0) && (entities == NULL)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (number_of_threads <= 0)
+        {
+                number_of_threads = (int) sysconf (_SC_NPROCESSORS_ONLN);
+        }
+        memset (&job, 0, sizeof (DxfTessellationJob));
+        job.tolerance = tolerance;
+        job.entities = entities;
+        job.number_of_tasks = (number_of_entities + DXF_TESSELLATION_ENTITIES_PER_TASK - 1)
+          / DXF_TESSELLATION_ENTITIES_PER_TASK;
+        if (number_of_threads > job.number_of_tasks)
+        {
+                number_of_threads = job.number_of_tasks;
+        }
+        job.tasks = calloc (job.number_of_tasks + 1, sizeof (DxfTessellationTask));
+        threads = malloc ((number_of_threads + 1) * sizeof (pthread_t));
+        if ((job.tasks == NULL) || (threads == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory for tessellation tasks.\n")),
+                  __FUNCTION__);
+                free (job.tasks);
+                free (threads);
+                return (-1);
+        }
+        for (i = 0; i < job.number_of_tasks; i++)
+        {
+                job.tasks[i].first = i * DXF_TESSELLATION_ENTITIES_PER_TASK;
+                job.tasks[i].last = job.tasks[i].first + DXF_TESSELLATION_ENTITIES_PER_TASK;
+                if (job.tasks[i].last > number_of_entities)
+                {
+                        job.tasks[i].last = number_of_entities;
+                }
+        }
+        for (i = 1; i < number_of_threads; i++)
+        {
+                if (pthread_create (&threads[started], NULL, dxf_tessellation_worker, &job) == 0)
+                {
+                        started++;
+                }
+        }
+        /* The calling thread takes work too. */
+        dxf_tessellation_worker (&job);
+        for (i = 0; i < started; i++)
+        {
+                pthread_join (threads[i], NULL);
+        }
+        /* Append the polylines of the tasks in order. */
+        number_of_points = buffer->number_of_points;
+        number_of_runs = buffer->number_of_runs;
+        for (i = 0; i < job.number_of_tasks; i++)
+        {
+                task = &job.tasks[i];
+                if ((number_of_tessellated >= 0)
+                  && (dxf_tessellation_buffer_append (buffer, &task->buffer, -1) == EXIT_SUCCESS))
+                {
+                        number_of_tessellated += task->number_of_entities;
+                }
+                else
+                {
+                        number_of_tessellated = -1;
+                }
+                free (task->buffer.points);
+                free (task->buffer.runs);
+        }
+        if (number_of_tessellated < 0)
+        {
+                buffer->number_of_points = number_of_points;
+                buffer->number_of_runs = number_of_runs;
+        }
+        free (job.tasks);
+        free (threads);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (number_of_tessellated);
+}
+
+
+/* EOF */
@@ -0,0 +1,215 @@
+/*!
+ * \file tessellation.h
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Header file for the tessellation of arcs, circles, ellipses and bulges.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_TESSELLATION_H
+#define LIBDXF_SRC_TESSELLATION_H
+
+
+#include "global.h"
+#include "vec.h"
+#include "drawing.h"
+#include "entity.h"
+#include "arc.h"
+#include "circle.h"
+#include "ellipse.h"
+#include "hatch.h"
+#include "line.h"
+#include "lwpolyline.h"
+#include "polyline.h"
+#include "vertex.h"
+#include "nurbs.h"
+
+
+#define DXF_TESSELLATION_DEFAULT_ANGLE (M_PI / 36.0)
+        /*!< \brief The angle of a segment in radians used when a
+         * \c DxfTessellation has neither a chord height nor an
+         * angle. */
+
+
+#define DXF_TESSELLATION_MIN_SEGMENTS 8
+        /*!< \brief The minimum number of segments of a full turn. */
+
+
+#define DXF_TESSELLATION_MAX_SEGMENTS 4096
+        /*!< \brief The maximum number of segments of a full turn. */
+
+
+#define DXF_TESSELLATION_ENTITIES_PER_TASK 256
+        /*!< \brief The number of entities tessellated by a thread of
+         * \c dxf_tessellation_add_entities() before claiming the next
+         * entities. */
+
+
+/*!
+ * \brief Definition of the tolerance of a tessellation.
+ *
+ * The number of segments of an arc follows from the strictest of the
+ * chord height and the angle, within \c DXF_TESSELLATION_MIN_SEGMENTS
+ * and \c DXF_TESSELLATION_MAX_SEGMENTS segments per full turn.
+ */
+typedef struct
+dxf_tessellation
+{
+        double chord_height;
+                /*!< Maximum distance between a segment and the arc it
+                 * replaces in drawing units, 0.0 for no limit. */
+        double angle;
+                /*!< Maximum angle of a segment in radians, 0.0 for no
+                 * limit. */
+} DxfTessellation;
+
+
+/*!
+ * \brief Definition of a polyline in a \c DxfTessellationBuffer.
+ */
+typedef struct
+dxf_tessellation_run
+{
+        int entity;
+                /*!< Index of the entity the polyline belongs to. */
+        int first;
+                /*!< Index of the first point in the buffer. */
+        int number_of_points;
+                /*!< Number of points. */
+        int closed;
+                /*!< \c TRUE when the last point equals the first
+                 * point. */
+} DxfTessellationRun;
+
+
+/*!
+ * \brief Definition of a buffer of tessellated entities.
+ *
+ * The points of all polylines are kept in one array, in WCS.\n
+ * A buffer can be cleared with \c dxf_tessellation_buffer_clear() and
+ * filled again without releasing its memory.
+ */
+typedef struct
+dxf_tessellation_buffer
+{
+        DxfVec3 *points;
+                /*!< Array of points. */
+        int number_of_points;
+                /*!< Number of points in \c points. */
+        int points_size;
+                /*!< Number of points allocated in \c points. */
+        DxfTessellationRun *runs;
+                /*!< Array of polylines. */
+        int number_of_runs;
+                /*!< Number of polylines in \c runs. */
+        int runs_size;
+                /*!< Number of polylines allocated in \c runs. */
+} DxfTessellationBuffer;
+
+
+int
+dxf_tessellation_get_number_of_segments
+(
+        const DxfTessellation *tolerance,
+        double radius,
+        double sweep
+);
+int
+dxf_tessellation_elliptical_arc
+(
+        const DxfTessellation *tolerance,
+        DxfVec3 center,
+        DxfVec3 u,
+        DxfVec3 v,
+        double start,
+        double sweep,
+        DxfVec3 *points,
+        int points_size
+);
+int
+dxf_tessellation_bulge
+(
+        const DxfTessellation *tolerance,
+        DxfOcs *ocs,
+        double x0,
+        double y0,
+        double x1,
+        double y1,
+        double elevation,
+        double bulge,
+        DxfVec3 *points,
+        int points_size
+);
+DxfTessellationBuffer *
+dxf_tessellation_buffer_new ();
+DxfTessellationBuffer *
+dxf_tessellation_buffer_init
+(
+        DxfTessellationBuffer *buffer
+);
+void
+dxf_tessellation_buffer_clear
+(
+        DxfTessellationBuffer *buffer
+);
+int
+dxf_tessellation_buffer_append
+(
+        DxfTessellationBuffer *buffer,
+        DxfTessellationBuffer *source,
+        int entity
+);
+int
+dxf_tessellation_buffer_free
+(
+        DxfTessellationBuffer *buffer
+);
+int
+dxf_tessellation_add_entity
+(
+        const DxfTessellation *tolerance,
+        int type,
+        void *entity,
+        int index,
+        DxfTessellationBuffer *buffer
+);
+int
+dxf_tessellation_add_entities
+(
+        const DxfTessellation *tolerance,
+        DxfDrawingEntity *entities,
+        int number_of_entities,
+        DxfTessellationBuffer *buffer,
+        int number_of_threads
+);
+
+#endif /* LIBDXF_SRC_TESSELLATION_H */
+
+
+/* EOF */
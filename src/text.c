@@ -33,6 +33,8 @@
 
 
 #include "text.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -142,6 +144,7 @@ dxf_text_init
         text->extr_z0 = 0.0;
         text->dictionary_owner_soft = strdup ("");
         text->dictionary_owner_hard = strdup ("");
+        text->intern = NULL;
         text->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -190,7 +193,7 @@ dxf_text_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (text == NULL)
@@ -201,9 +204,13 @@ dxf_text_read
                 text = dxf_text_new ();
                 text = dxf_text_init (text);
         }
+        /* The symbol names are interned in the intern table of the
+         * file. */
+        text->intern = fp->intern;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -212,14 +219,14 @@ dxf_text_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing a text value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", text->text_value);
+                        text->text_value = dxf_read_string (fp, text->text_value);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -233,20 +240,20 @@ dxf_text_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", text->linetype);
+                        text->linetype = dxf_intern_read_string (fp, text->linetype);
                 }
                 else if (strcmp (temp_string, "7") == 0)
                 {
                         /* Now follows a string containing a text style
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", text->text_style);
+                        text->text_style = dxf_intern_read_string (fp, text->text_style);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", text->layer);
+                        text->layer = dxf_intern_read_string (fp, text->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -403,14 +410,14 @@ dxf_text_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", text->dictionary_owner_soft);
+                        text->dictionary_owner_soft = dxf_read_string (fp, text->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", text->dictionary_owner_hard);
+                        text->dictionary_owner_hard = dxf_read_string (fp, text->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -424,8 +431,19 @@ dxf_text_read
                         fprintf (stderr,
                           (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
+        /* Symbol names not found in the file are still the copies
+         * made by the init function. */
+        text->linetype = dxf_intern_adopt_string ((DxfIntern *) text->intern, text->linetype);
+        text->layer = dxf_intern_adopt_string ((DxfIntern *) text->intern, text->layer);
+        text->text_style = dxf_intern_adopt_string ((DxfIntern *) text->intern, text->text_style);
         /* Handle omitted members and/or illegal values. */
         if (strcmp (text->text_value, "") == 0)
         {
@@ -435,16 +453,24 @@ dxf_text_read
                 dxf_entity_skip (dxf_entity_name);
                 return (NULL);
         }
-        if (strcmp (text->linetype, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) text->intern, text->linetype, DXF_INTERN_ID_EMPTY))
+        {
+                dxf_intern_free_string ((DxfIntern *) text->intern, text->linetype);
+                text->linetype = dxf_intern_string ((DxfIntern *) text->intern, DXF_DEFAULT_LINETYPE);
+        }
+        if (dxf_intern_is_symbol ((DxfIntern *) text->intern, text->layer, DXF_INTERN_ID_EMPTY))
         {
-                text->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_intern_free_string ((DxfIntern *) text->intern, text->layer);
+                text->layer = dxf_intern_string ((DxfIntern *) text->intern, DXF_DEFAULT_LAYER);
         }
-        if (strcmp (text->layer, "") == 0)
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (text->id_code > 0))
         {
-                text->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) text->id_code, TEXT, text);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -474,6 +500,9 @@ dxf_text_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("TEXT");
+        char *layer = NULL;
+        char *text_style = NULL;
+        int vert_align;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -504,13 +533,16 @@ dxf_text_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (text->text_style, "") == 0)
+        text_style = text->text_style;
+        if (dxf_intern_is_symbol ((DxfIntern *) text->intern, text_style, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () text style string is empty for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
-                text->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);        }
-        if (strcmp (text->layer, "") == 0)
+                text_style = dxf_intern_get_symbol ((DxfIntern *) text->intern, DXF_INTERN_ID_DEFAULT_TEXTSTYLE);
+        }
+        layer = text->layer;
+        if (dxf_intern_is_symbol ((DxfIntern *) text->intern, layer, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -518,7 +550,7 @@ dxf_text_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                text->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = dxf_intern_get_symbol ((DxfIntern *) text->intern, DXF_INTERN_ID_DEFAULT_LAYER);
         }
         if (text->height == 0.0)
         {
@@ -570,8 +602,8 @@ dxf_text_write
         {
                 fprintf (fp->fp, " 67\n%d\n", text->paperspace);
         }
-        fprintf (fp->fp, "  8\n%s\n", text->layer);
-        if (strcmp (text->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (!dxf_intern_is_symbol ((DxfIntern *) text->intern, text->linetype, DXF_INTERN_ID_DEFAULT_LINETYPE))
         {
                 fprintf (fp->fp, "  6\n%s\n", text->linetype);
         }
@@ -618,9 +650,9 @@ dxf_text_write
         {
                 fprintf (fp->fp, " 51\n%f\n", text->obl_angle);
         }
-        if (strcmp (text->text_style, DXF_DEFAULT_TEXTSTYLE) != 0)
+        if (!dxf_intern_is_symbol ((DxfIntern *) text->intern, text_style, DXF_INTERN_ID_DEFAULT_TEXTSTYLE))
         {
-                fprintf (fp->fp, "  7\n%s\n", text->text_style);
+                fprintf (fp->fp, "  7\n%s\n", text_style);
         }
         if (text->text_flags != 0)
         {
@@ -630,7 +662,8 @@ dxf_text_write
         {
                 fprintf (fp->fp, " 72\n%d\n", text->hor_align);
         }
-        if ((text->hor_align != 0) || (text->vert_align != 0))
+        vert_align = text->vert_align;
+        if ((text->hor_align != 0) || (vert_align != 0))
         {
                 if ((text->x0 == text->x1) && (text->y0 == text->y1) && (text->z0 == text->z1))
                 {
@@ -640,8 +673,7 @@ dxf_text_write
                         fprintf (stderr,
                           (_("\tdefault justification applied to %s entity\n")),
                           dxf_entity_name);
-                        text->hor_align = 0;
-                        text->vert_align = 0;
+                        vert_align = 0;
                 }
                 else
                 {
@@ -663,9 +695,9 @@ dxf_text_write
         {
                 fprintf (fp->fp, "100\nAcDbText\n");
         }
-        if (text->vert_align != 0)
+        if (vert_align != 0)
         {
-                fprintf (fp->fp, " 73\n%d\n", text->vert_align);
+                fprintf (fp->fp, " 73\n%d\n", vert_align);
         }
         /* Clean up. */
         free (dxf_entity_name);
@@ -707,10 +739,10 @@ dxf_text_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (text->linetype);
-        free (text->layer);
+        dxf_intern_free_string ((DxfIntern *) text->intern, text->linetype);
+        dxf_intern_free_string ((DxfIntern *) text->intern, text->layer);
         free (text->text_value);
-        free (text->text_style);
+        dxf_intern_free_string ((DxfIntern *) text->intern, text->text_style);
         free (text->dictionary_owner_soft);
         free (text->dictionary_owner_hard);
         free (text);
@@ -37,6 +37,8 @@
 
 
 #include "global.h"
+#include "intern.h"
+#include "handle_table.h"
 
 
 /*!
@@ -200,6 +202,11 @@ dxf_text
                 /*!< Z-value of the extrusion vector.\n
                  * Defaults to 1.0 if ommitted in the DXF file.\n
                  * Group code = 230. */
+        struct DxfIntern *intern;
+                /*!< Intern table holding the interned symbol names of
+                 * this entity, \c NULL when none are interned.\n
+                 * Symbol names not found in this table are private
+                 * copies. */
         struct DxfText *next;
                 /*!< Pointer to the next DxfText.\n
                  * \c NULL in the last DxfText. */
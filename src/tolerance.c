@@ -33,6 +33,8 @@
 
 
 #include "tolerance.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -184,7 +186,7 @@ dxf_tolerance_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (tolerance == NULL)
@@ -195,9 +197,10 @@ dxf_tolerance_read
                 tolerance = dxf_tolerance_new ();
                 tolerance = dxf_tolerance_init (tolerance);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -206,7 +209,7 @@ dxf_tolerance_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "3") == 0)
@@ -214,9 +217,9 @@ dxf_tolerance_read
                         /* Now follows a string containing the dimension
                          * style name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", tolerance->dimstyle_name);
+                        tolerance->dimstyle_name = dxf_read_string (fp, tolerance->dimstyle_name);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -228,13 +231,13 @@ dxf_tolerance_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", tolerance->linetype);
+                        tolerance->linetype = dxf_read_string (fp, tolerance->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", tolerance->layer);
+                        tolerance->layer = dxf_read_string (fp, tolerance->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -362,14 +365,14 @@ dxf_tolerance_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", tolerance->dictionary_owner_soft);
+                        tolerance->dictionary_owner_soft = dxf_read_string (fp, tolerance->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", tolerance->dictionary_owner_hard);
+                        tolerance->dictionary_owner_hard = dxf_read_string (fp, tolerance->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -383,7 +386,13 @@ dxf_tolerance_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (tolerance->dimstyle_name, "") == 0)
@@ -399,7 +408,7 @@ dxf_tolerance_read
                 tolerance->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -432,6 +441,8 @@ dxf_tolerance_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("TOLERANCE");
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -462,7 +473,8 @@ dxf_tolerance_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (tolerance->linetype, "") == 0)
+        linetype = tolerance->linetype;
+        if (strcmp (linetype, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -470,9 +482,10 @@ dxf_tolerance_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                tolerance->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = DXF_DEFAULT_LINETYPE;
         }
-        if (strcmp (tolerance->layer, "") == 0)
+        layer = tolerance->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -480,7 +493,7 @@ dxf_tolerance_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                tolerance->layer = DXF_DEFAULT_LAYER;
+                layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -520,10 +533,10 @@ dxf_tolerance_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", tolerance->layer);
-        if (strcmp (tolerance->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (strcmp (linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", tolerance->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
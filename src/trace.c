@@ -33,6 +33,8 @@
 
 
 #include "trace.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -143,6 +145,7 @@ dxf_trace_init
         trace->extr_z0 = 0.0;
         trace->dictionary_owner_soft = strdup ("");
         trace->dictionary_owner_hard = strdup ("");
+        trace->intern = NULL;
         trace->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -187,7 +190,7 @@ dxf_trace_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (trace == NULL)
@@ -198,9 +201,13 @@ dxf_trace_read
                 trace = dxf_trace_new ();
                 trace = dxf_trace_init (trace);
         }
+        /* The symbol names are interned in the intern table of the
+         * file. */
+        trace->intern = fp->intern;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -209,7 +216,7 @@ dxf_trace_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -224,13 +231,13 @@ dxf_trace_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", trace->linetype);
+                        trace->linetype = dxf_intern_read_string (fp, trace->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", trace->layer);
+                        trace->layer = dxf_intern_read_string (fp, trace->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -401,14 +408,14 @@ dxf_trace_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", trace->dictionary_owner_soft);
+                        trace->dictionary_owner_soft = dxf_read_string (fp, trace->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", trace->dictionary_owner_hard);
+                        trace->dictionary_owner_hard = dxf_read_string (fp, trace->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -422,19 +429,37 @@ dxf_trace_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
+        /* Symbol names not found in the file are still the copies
+         * made by the init function. */
+        trace->linetype = dxf_intern_adopt_string ((DxfIntern *) trace->intern, trace->linetype);
+        trace->layer = dxf_intern_adopt_string ((DxfIntern *) trace->intern, trace->layer);
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (trace->linetype, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) trace->intern, trace->linetype, DXF_INTERN_ID_EMPTY))
+        {
+                dxf_intern_free_string ((DxfIntern *) trace->intern, trace->linetype);
+                trace->linetype = dxf_intern_string ((DxfIntern *) trace->intern, DXF_DEFAULT_LINETYPE);
+        }
+        if (dxf_intern_is_symbol ((DxfIntern *) trace->intern, trace->layer, DXF_INTERN_ID_EMPTY))
         {
-                trace->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_intern_free_string ((DxfIntern *) trace->intern, trace->layer);
+                trace->layer = dxf_intern_string ((DxfIntern *) trace->intern, DXF_DEFAULT_LAYER);
         }
-        if (strcmp (trace->layer, "") == 0)
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (trace->id_code > 0))
         {
-                trace->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) trace->id_code, TRACE, trace);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -467,6 +492,8 @@ dxf_trace_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("TRACE");
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -487,7 +514,8 @@ dxf_trace_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (trace->linetype, "") == 0)
+        linetype = trace->linetype;
+        if (dxf_intern_is_symbol ((DxfIntern *) trace->intern, linetype, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -495,9 +523,10 @@ dxf_trace_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                trace->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = dxf_intern_get_symbol ((DxfIntern *) trace->intern, DXF_INTERN_ID_DEFAULT_LINETYPE);
         }
-        if (strcmp (trace->layer, "") == 0)
+        layer = trace->layer;
+        if (dxf_intern_is_symbol ((DxfIntern *) trace->intern, layer, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -505,7 +534,7 @@ dxf_trace_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                trace->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = dxf_intern_get_symbol ((DxfIntern *) trace->intern, DXF_INTERN_ID_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -545,10 +574,10 @@ dxf_trace_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", trace->layer);
-        if (strcmp (trace->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (!dxf_intern_is_symbol ((DxfIntern *) trace->intern, linetype, DXF_INTERN_ID_DEFAULT_LINETYPE))
         {
-                fprintf (fp->fp, "  6\n%s\n", trace->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
@@ -637,8 +666,8 @@ dxf_trace_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (trace->linetype);
-        free (trace->layer);
+        dxf_intern_free_string ((DxfIntern *) trace->intern, trace->linetype);
+        dxf_intern_free_string ((DxfIntern *) trace->intern, trace->layer);
         free (trace->dictionary_owner_soft);
         free (trace->dictionary_owner_hard);
         free (trace);
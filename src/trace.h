@@ -37,6 +37,8 @@
 
 
 #include "global.h"
+#include "intern.h"
+#include "handle_table.h"
 
 
 /*!
@@ -151,6 +153,11 @@ dxf_trace
                 /*!< Z-value of the extrusion vector.\n
                  * Defaults to 1.0 if omitted in the DXF file.\n
                  * Group code = 230. */
+        struct DxfIntern *intern;
+                /*!< Intern table holding the interned symbol names of
+                 * this entity, \c NULL when none are interned.\n
+                 * Symbol names not found in this table are private
+                 * copies. */
         struct DxfTrace *next;
                 /*!< pointer to the next DxfTrace.\n
                  * \c NULL in the last DxfTrace. */
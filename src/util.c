@@ -145,6 +145,13 @@ dxf_read_init (const char *filename)
         file->fp = fp;
         file->filename = strdup(filename);
         file->line_number = 0;
+        /* Updated from the $ACADVER variable when the HEADER section
+         * is read. */
+        file->acad_version_number = AutoCAD_12;
+        file->intern = NULL;
+        file->handle_table = NULL;
+        file->build_meshes = FALSE;
+        file->update_extents = FALSE;
         /*! \todo FIXME: dxf header and blocks need initialized ?
         dxf_header_init (file->dxf_header);
         dxf_block_init (file->dxf_block);
@@ -194,6 +201,7 @@ dxf_read_line (char * temp_string, DxfFile *fp)
         DXF_DEBUG_BEGIN
 #endif
         int ret;
+        int length;
 
         ret = fscanf (fp->fp, "%[^\n]\n", temp_string);
         if (ferror (fp->fp))
@@ -203,9 +211,15 @@ dxf_read_line (char * temp_string, DxfFile *fp)
                   fp->filename, fp->line_number);
                 return (EXIT_FAILURE);
         }
-        if (ret)
+        if (ret == 1)
         {
                 fp->line_number++;
+                /* Strip the carriage return of DOS line endings. */
+                length = strlen (temp_string);
+                if ((length > 0) && (temp_string[length - 1] == '\r'))
+                {
+                        temp_string[length - 1] = '\0';
+                }
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -260,4 +274,124 @@ dxf_read_scanf (DxfFile *fp, const char *template, ...)
 }
 
 
+/*!
+ * \brief Reads a group code from a file.
+ *
+ * Reads the next line from \c fp into \c group_code and strips the
+ * leading spaces of right aligned group codes and the trailing line end.
+ *
+ * The line number is advanced by the caller, like for the values read
+ * by the entity readers.
+ *
+ * \return \c EXIT_SUCCESS when a line was read, \c EXIT_FAILURE at the end
+ * of the file or on a read error, in which case \c group_code holds an
+ * empty string.
+ */
+int
+dxf_read_group_code
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        char *group_code
+                /*!< a string buffer of \c DXF_MAX_STRING_LENGTH
+                 * characters. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t length;
+        size_t offset;
+
+        if ((fp == NULL) || (group_code == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (fgets (group_code, DXF_MAX_STRING_LENGTH, fp->fp) == NULL)
+        {
+                group_code[0] = '\0';
+                return (EXIT_FAILURE);
+        }
+        length = strlen (group_code);
+        while ((length > 0)
+          && ((group_code[length - 1] == '\n')
+          || (group_code[length - 1] == '\r')
+          || (group_code[length - 1] == ' ')))
+        {
+                group_code[--length] = '\0';
+        }
+        offset = strspn (group_code, " ");
+        memmove (group_code, group_code + offset, length - offset + 1);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Reads a string value from a file.
+ *
+ * Reads the whole next line from \c fp, without the line end, into a
+ * newly allocated string and frees \c old_string.\n
+ * Unlike <tt>fscanf ("%s")</tt> the value may contain spaces, and the
+ * length of the value is not limited by the buffer of \c old_string.
+ *
+ * \return a pointer to the new string, or \c old_string when no line
+ * could be read.
+ */
+char *
+dxf_read_string
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        char *old_string
+                /*!< the previous value, freed on success, may be
+                 * \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        char *string = NULL;
+        size_t length;
+
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (old_string);
+        }
+        if (fgets (temp_string, DXF_MAX_STRING_LENGTH, fp->fp) == NULL)
+        {
+                return (old_string);
+        }
+        length = strlen (temp_string);
+        while ((length > 0)
+          && ((temp_string[length - 1] == '\n')
+          || (temp_string[length - 1] == '\r')))
+        {
+                temp_string[--length] = '\0';
+        }
+        string = strdup (temp_string);
+        if (string == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (old_string);
+        }
+        free (old_string);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (string);
+}
+
+
 /* EOF */
@@ -63,6 +63,8 @@ int dxf_read_is_int (int type);
 int dxf_read_is_string (int type);
 int dxf_read_line (char * temp_string, DxfFile *fp);
 int dxf_read_scanf (DxfFile *fp, const char *template, ...);
+int dxf_read_group_code (DxfFile *fp, char *group_code);
+char *dxf_read_string (DxfFile *fp, char *old_string);
 DxfFile *dxf_read_init (const char *filename);
 void dxf_read_close (DxfFile *file);
 
@@ -0,0 +1,715 @@
+/*!
+ * \file vec.c
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Functions for libDXF coordinate value types.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "vec.h"
+
+
+/*!
+ * \brief Get the number of entries to allocate for an array holding
+ * \c number_of_vecs entries in \c size allocated entries, or 0 when
+ * the array is large enough to append an entry.
+ *
+ * Arrays double in size (starting at 4 entries), so that appending is
+ * amortized O(1).
+ */
+static int
+dxf_vec_array_grow_size
+(
+        int number_of_vecs,
+                /*!< the number of entries in the array. */
+        int size
+                /*!< the number of allocated entries in the array. */
+)
+{
+        if (number_of_vecs < size)
+        {
+                return (0);
+        }
+        if (number_of_vecs < 4)
+        {
+                return (4);
+        }
+        return (2 * number_of_vecs);
+}
+
+
+/*!
+ * \brief Append a 2D coordinate to an array of 2D coordinates.
+ *
+ * \return a pointer to the (possibly moved) array when successful, or
+ * \c NULL when an error occurred (the passed array is left intact).
+ */
+DxfVec2 *
+dxf_vec2_array_append
+(
+        DxfVec2 *array,
+                /*!< a pointer to the array, or \c NULL for a new
+                 * array. */
+        int number_of_vecs,
+                /*!< the number of entries in the array. */
+        int *size,
+                /*!< the number of allocated entries in the array, 0
+                 * when unknown (e.g. an array allocated by the caller)
+                 * (input and output). */
+        DxfVec2 vec
+                /*!< the coordinate to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVec2 *new_array = array;
+        int new_size;
+
+        /* Do some basic checks. */
+        if (size == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (number_of_vecs < 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a negative number of entries was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        new_size = dxf_vec_array_grow_size (number_of_vecs, *size);
+        if (new_size > 0)
+        {
+                new_array = realloc (array, (size_t) new_size * sizeof (DxfVec2));
+                if (new_array == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for a DxfVec2 array.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                *size = new_size;
+        }
+        new_array[number_of_vecs] = vec;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (new_array);
+}
+
+
+/*!
+ * \brief Append a 3D coordinate to an array of 3D coordinates.
+ *
+ * \return a pointer to the (possibly moved) array when successful, or
+ * \c NULL when an error occurred (the passed array is left intact).
+ */
+DxfVec3 *
+dxf_vec3_array_append
+(
+        DxfVec3 *array,
+                /*!< a pointer to the array, or \c NULL for a new
+                 * array. */
+        int number_of_vecs,
+                /*!< the number of entries in the array. */
+        int *size,
+                /*!< the number of allocated entries in the array, 0
+                 * when unknown (e.g. an array allocated by the caller)
+                 * (input and output). */
+        DxfVec3 vec
+                /*!< the coordinate to append. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVec3 *new_array = array;
+        int new_size;
+
+        /* Do some basic checks. */
+        if (size == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (number_of_vecs < 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a negative number of entries was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        new_size = dxf_vec_array_grow_size (number_of_vecs, *size);
+        if (new_size > 0)
+        {
+                new_array = realloc (array, (size_t) new_size * sizeof (DxfVec3));
+                if (new_array == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for a DxfVec3 array.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                *size = new_size;
+        }
+        new_array[number_of_vecs] = vec;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (new_array);
+}
+
+
+/*!
+ * \brief Reserve room for a number of 3D coordinates in an array of 3D
+ * coordinates.
+ *
+ * \c capacity is a hint (usually a count read from a file), it is
+ * capped at \c DXF_VEC_ARRAY_MAX_RESERVE entries, larger arrays keep
+ * growing while appending.
+ *
+ * \return a pointer to the (possibly moved) array when successful, or
+ * \c NULL when an error occurred (the passed array is left intact).
+ */
+DxfVec3 *
+dxf_vec3_array_reserve
+(
+        DxfVec3 *array,
+                /*!< a pointer to the array, or \c NULL for a new
+                 * array. */
+        int *size,
+                /*!< the number of allocated entries in the array
+                 * (input and output). */
+        int capacity
+                /*!< the number of entries to make room for. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVec3 *new_array = array;
+
+        /* Do some basic checks. */
+        if (size == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (capacity > DXF_VEC_ARRAY_MAX_RESERVE)
+        {
+                capacity = DXF_VEC_ARRAY_MAX_RESERVE;
+        }
+        if (capacity > *size)
+        {
+                new_array = realloc (array, (size_t) capacity * sizeof (DxfVec3));
+                if (new_array == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory for a DxfVec3 array.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                *size = capacity;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (new_array);
+}
+
+
+/*!
+ * \brief Get the axes of the Object Coordinate System (OCS) for an
+ * extrusion direction with the arbitrary axis algorithm.
+ *
+ * A missing (zero length) extrusion direction gives the WCS.
+ */
+void
+dxf_ocs_init
+(
+        DxfOcs *ocs,
+                /*!< the axes (output). */
+        double extr_x0,
+                /*!< X value of the extrusion direction. */
+        double extr_y0,
+                /*!< Y value of the extrusion direction. */
+        double extr_z0
+                /*!< Z value of the extrusion direction. */
+)
+{
+        double length;
+
+        length = sqrt (extr_x0 * extr_x0 + extr_y0 * extr_y0 + extr_z0 * extr_z0);
+        if (length == 0.0)
+        {
+                /* Missing extrusion direction, use the WCS. */
+                extr_x0 = 0.0;
+                extr_y0 = 0.0;
+                extr_z0 = 1.0;
+                length = 1.0;
+        }
+        ocs->az.x = extr_x0 / length;
+        ocs->az.y = extr_y0 / length;
+        ocs->az.z = extr_z0 / length;
+        if ((fabs (ocs->az.x) < 1.0 / 64.0) && (fabs (ocs->az.y) < 1.0 / 64.0))
+        {
+                /* World Y axis cross extrusion. */
+                ocs->ax.x = ocs->az.z;
+                ocs->ax.y = 0.0;
+                ocs->ax.z = -ocs->az.x;
+        }
+        else
+        {
+                /* World Z axis cross extrusion. */
+                ocs->ax.x = -ocs->az.y;
+                ocs->ax.y = ocs->az.x;
+                ocs->ax.z = 0.0;
+        }
+        length = sqrt (ocs->ax.x * ocs->ax.x + ocs->ax.y * ocs->ax.y + ocs->ax.z * ocs->ax.z);
+        ocs->ax.x /= length;
+        ocs->ax.y /= length;
+        ocs->ax.z /= length;
+        ocs->ay.x = ocs->az.y * ocs->ax.z - ocs->az.z * ocs->ax.y;
+        ocs->ay.y = ocs->az.z * ocs->ax.x - ocs->az.x * ocs->ax.z;
+        ocs->ay.z = ocs->az.x * ocs->ax.y - ocs->az.y * ocs->ax.x;
+}
+
+
+/*!
+ * \brief Transform a point from an OCS to WCS.
+ *
+ * \return the point in WCS.
+ */
+DxfVec3
+dxf_ocs_to_wcs
+(
+        DxfOcs *ocs,
+                /*!< the axes of the OCS. */
+        double x,
+                /*!< X value in the OCS. */
+        double y,
+                /*!< Y value in the OCS. */
+        double z
+                /*!< Z value in the OCS. */
+)
+{
+        DxfVec3 p;
+
+        p.x = x * ocs->ax.x + y * ocs->ay.x + z * ocs->az.x;
+        p.y = x * ocs->ax.y + y * ocs->ay.y + z * ocs->az.y;
+        p.z = x * ocs->ax.z + y * ocs->ay.z + z * ocs->az.z;
+        return (p);
+}
+
+
+/*!
+ * \brief Transform a point from WCS to an OCS.
+ *
+ * The axes are orthonormal, so the inverse transform is the
+ * transpose.
+ *
+ * \return the point in the OCS.
+ */
+DxfVec3
+dxf_ocs_from_wcs
+(
+        DxfOcs *ocs,
+                /*!< the axes of the OCS. */
+        DxfVec3 point
+                /*!< the point in WCS. */
+)
+{
+        DxfVec3 p;
+
+        p.x = point.x * ocs->ax.x + point.y * ocs->ax.y + point.z * ocs->ax.z;
+        p.y = point.x * ocs->ay.x + point.y * ocs->ay.y + point.z * ocs->ay.z;
+        p.z = point.x * ocs->az.x + point.y * ocs->az.y + point.z * ocs->az.z;
+        return (p);
+}
+
+
+/*!
+ * \brief Get the circular arc of a polyline segment with a bulge.
+ *
+ * The bulge is the tangent of a quarter of the included angle, positive
+ * for a counter clockwise arc from \c start to \c end.
+ *
+ * \return \c TRUE for an arc, \c FALSE for a straight segment (a
+ * bulge of 0.0 or coinciding end points), in which case the output
+ * values are not set.
+ */
+int
+dxf_vec2_bulge_to_arc
+(
+        DxfVec2 start,
+                /*!< start point of the segment. */
+        DxfVec2 end,
+                /*!< end point of the segment. */
+        double bulge,
+                /*!< bulge of the segment. */
+        DxfVec2 *center,
+                /*!< center point of the arc (output). */
+        double *radius,
+                /*!< radius of the arc (output). */
+        double *start_angle,
+                /*!< angle of the start point in radians (output). */
+        double *end_angle
+                /*!< angle of the end point in radians (output). */
+)
+{
+        double f;
+
+        if ((bulge == 0.0) || ((start.x == end.x) && (start.y == end.y)))
+        {
+                return (FALSE);
+        }
+        f = (1.0 - bulge * bulge) / (4.0 * bulge);
+        center->x = 0.5 * (start.x + end.x) - f * (end.y - start.y);
+        center->y = 0.5 * (start.y + end.y) + f * (end.x - start.x);
+        *radius = hypot (end.x - start.x, end.y - start.y)
+          * (1.0 + bulge * bulge) / (4.0 * fabs (bulge));
+        *start_angle = atan2 (start.y - center->y, start.x - center->x);
+        *end_angle = atan2 (end.y - center->y, end.x - center->x);
+        return (TRUE);
+}
+
+
+/*!
+ * \brief Get the distance between two points.
+ */
+static double
+dxf_vec3_distance
+(
+        DxfVec3 a,
+                /*!< a point. */
+        DxfVec3 b
+                /*!< a point. */
+)
+{
+        return (sqrt ((a.x - b.x) * (a.x - b.x)
+          + (a.y - b.y) * (a.y - b.y)
+          + (a.z - b.z) * (a.z - b.z)));
+}
+
+
+/*!
+ * \brief Move an angle into <tt>[start, start + 2 pi)</tt>.
+ */
+static double
+dxf_vec_normalize_angle
+(
+        double angle,
+                /*!< the angle in radians. */
+        double start
+                /*!< the start of the range in radians. */
+)
+{
+        angle = start + fmod (angle - start, 2.0 * M_PI);
+        if (angle < start)
+        {
+                angle += 2.0 * M_PI;
+        }
+        return (angle);
+}
+
+
+/*!
+ * \brief Get the nearest point on a line segment to a point.
+ *
+ * \return the distance between the point and the segment.
+ */
+double
+dxf_vec3_nearest_point_on_segment
+(
+        DxfVec3 start,
+                /*!< start point of the segment. */
+        DxfVec3 end,
+                /*!< end point of the segment. */
+        DxfVec3 point,
+                /*!< the point. */
+        DxfVec3 *nearest,
+                /*!< the nearest point on the segment (output), may be
+                 * \c NULL. */
+        double *parameter
+                /*!< the parameter of the nearest point, 0.0 at the
+                 * start point and 1.0 at the end point (output), may
+                 * be \c NULL. */
+)
+{
+        DxfVec3 d;
+        DxfVec3 q;
+        double length2;
+        double t = 0.0;
+
+        d.x = end.x - start.x;
+        d.y = end.y - start.y;
+        d.z = end.z - start.z;
+        length2 = d.x * d.x + d.y * d.y + d.z * d.z;
+        if (length2 > 0.0)
+        {
+                t = ((point.x - start.x) * d.x
+                  + (point.y - start.y) * d.y
+                  + (point.z - start.z) * d.z) / length2;
+                t = (t < 0.0) ? 0.0 : ((t > 1.0) ? 1.0 : t);
+        }
+        q.x = start.x + t * d.x;
+        q.y = start.y + t * d.y;
+        q.z = start.z + t * d.z;
+        if (nearest != NULL)
+        {
+                *nearest = q;
+        }
+        if (parameter != NULL)
+        {
+                *parameter = t;
+        }
+        return (dxf_vec3_distance (q, point));
+}
+
+
+/*!
+ * \brief Get the nearest point on a circular arc in an OCS to a point.
+ *
+ * The point is projected into the plane of the arc, the nearest point
+ * is on the ray from the center through the projection when that ray
+ * crosses the arc, and else one of the end points.
+ *
+ * \return the distance between the point and the arc.
+ */
+double
+dxf_vec3_nearest_point_on_arc
+(
+        DxfOcs *ocs,
+                /*!< the axes of the OCS. */
+        DxfVec3 center,
+                /*!< center point in the OCS. */
+        double radius,
+                /*!< radius. */
+        double start,
+                /*!< start angle in radians. */
+        double end,
+                /*!< end angle in radians (counter clockwise from
+                 * \c start). */
+        DxfVec3 point,
+                /*!< the point in WCS. */
+        DxfVec3 *nearest,
+                /*!< the nearest point on the arc in WCS (output), may
+                 * be \c NULL. */
+        double *angle
+                /*!< the angle of the nearest point in radians, in
+                 * <tt>[start, end]</tt> (output), may be \c NULL. */
+)
+{
+        DxfVec3 q;
+        DxfVec3 p;
+        DxfVec3 p_end;
+        double t;
+
+        while (end <= start)
+        {
+                end += 2.0 * M_PI;
+        }
+        if (end - start > 2.0 * M_PI)
+        {
+                end = start + 2.0 * M_PI;
+        }
+        q = dxf_ocs_from_wcs (ocs, point);
+        if ((q.x == center.x) && (q.y == center.y))
+        {
+                /* Every point of the arc is nearest. */
+                t = start;
+        }
+        else
+        {
+                t = dxf_vec_normalize_angle (atan2 (q.y - center.y, q.x - center.x), start);
+        }
+        if (t > end)
+        {
+                /* Outside the arc, take the nearest end point. */
+                p = dxf_ocs_to_wcs (ocs, center.x + radius * cos (start),
+                  center.y + radius * sin (start), center.z);
+                p_end = dxf_ocs_to_wcs (ocs, center.x + radius * cos (end),
+                  center.y + radius * sin (end), center.z);
+                t = start;
+                if (dxf_vec3_distance (p_end, point) < dxf_vec3_distance (p, point))
+                {
+                        p = p_end;
+                        t = end;
+                }
+        }
+        else
+        {
+                p = dxf_ocs_to_wcs (ocs, center.x + radius * cos (t),
+                  center.y + radius * sin (t), center.z);
+        }
+        if (nearest != NULL)
+        {
+                *nearest = p;
+        }
+        if (angle != NULL)
+        {
+                *angle = t;
+        }
+        return (dxf_vec3_distance (p, point));
+}
+
+
+/*!
+ * \brief Get the nearest point on an elliptical arc to a point.
+ *
+ * The arc is the set of points <tt>center + cos (t) * u + sin (t) * v</tt>
+ * for \c t from \c start to \c end (counter clockwise).\n
+ * The arc is sampled at \c DXF_VEC_ELLIPSE_SAMPLES parameters, and the
+ * best sample is refined with Newton iterations on the derivative of
+ * the squared distance, which converge to machine precision.
+ *
+ * \return the distance between the point and the arc.
+ */
+double
+dxf_vec3_nearest_point_on_elliptical_arc
+(
+        DxfVec3 center,
+                /*!< center point in WCS. */
+        DxfVec3 u,
+                /*!< vector to the point at \c t = 0. */
+        DxfVec3 v,
+                /*!< vector to the point at \c t = pi / 2. */
+        double start,
+                /*!< start parameter in radians. */
+        double end,
+                /*!< end parameter in radians. */
+        DxfVec3 point,
+                /*!< the point in WCS. */
+        DxfVec3 *nearest,
+                /*!< the nearest point on the arc (output), may be
+                 * \c NULL. */
+        double *parameter
+                /*!< the parameter of the nearest point in radians, in
+                 * <tt>[start, end]</tt> (output), may be \c NULL. */
+)
+{
+        DxfVec3 d;
+        DxfVec3 e;
+        DxfVec3 p;
+        double best_t;
+        double best_distance;
+        double distance;
+        double t;
+        double f;
+        double df;
+        double step;
+        int i;
+
+        while (end <= start)
+        {
+                end += 2.0 * M_PI;
+        }
+        if (end - start > 2.0 * M_PI)
+        {
+                end = start + 2.0 * M_PI;
+        }
+        d.x = center.x - point.x;
+        d.y = center.y - point.y;
+        d.z = center.z - point.z;
+        best_t = start;
+        best_distance = HUGE_VAL;
+        for (i = 0; i <= DXF_VEC_ELLIPSE_SAMPLES; i++)
+        {
+                t = start + (end - start) * i / DXF_VEC_ELLIPSE_SAMPLES;
+                e.x = d.x + cos (t) * u.x + sin (t) * v.x;
+                e.y = d.y + cos (t) * u.y + sin (t) * v.y;
+                e.z = d.z + cos (t) * u.z + sin (t) * v.z;
+                distance = e.x * e.x + e.y * e.y + e.z * e.z;
+                if (distance < best_distance)
+                {
+                        best_distance = distance;
+                        best_t = t;
+                }
+        }
+        t = best_t;
+        for (i = 0; i < 16; i++)
+        {
+                /* f is half the derivative of the squared distance,
+                 * with E' = -sin (t) u + cos (t) v and
+                 * E'' = -cos (t) u - sin (t) v. */
+                e.x = d.x + cos (t) * u.x + sin (t) * v.x;
+                e.y = d.y + cos (t) * u.y + sin (t) * v.y;
+                e.z = d.z + cos (t) * u.z + sin (t) * v.z;
+                p.x = -sin (t) * u.x + cos (t) * v.x;
+                p.y = -sin (t) * u.y + cos (t) * v.y;
+                p.z = -sin (t) * u.z + cos (t) * v.z;
+                f = e.x * p.x + e.y * p.y + e.z * p.z;
+                df = p.x * p.x + p.y * p.y + p.z * p.z
+                  - (e.x * (e.x - d.x) + e.y * (e.y - d.y) + e.z * (e.z - d.z));
+                if (df <= 0.0)
+                {
+                        break;
+                }
+                step = f / df;
+                t -= step;
+                t = (t < start) ? start : ((t > end) ? end : t);
+                if (fabs (step) < 1e-15 * (1.0 + fabs (t)))
+                {
+                        break;
+                }
+        }
+        p.x = center.x + cos (t) * u.x + sin (t) * v.x;
+        p.y = center.y + cos (t) * u.y + sin (t) * v.y;
+        p.z = center.z + cos (t) * u.z + sin (t) * v.z;
+        distance = dxf_vec3_distance (p, point);
+        if (distance * distance > best_distance)
+        {
+                /* Newton left the basin, keep the best sample. */
+                t = best_t;
+                p.x = center.x + cos (t) * u.x + sin (t) * v.x;
+                p.y = center.y + cos (t) * u.y + sin (t) * v.y;
+                p.z = center.z + cos (t) * u.z + sin (t) * v.z;
+                distance = dxf_vec3_distance (p, point);
+        }
+        if (nearest != NULL)
+        {
+                *nearest = p;
+        }
+        if (parameter != NULL)
+        {
+                *parameter = t;
+        }
+        return (distance);
+}
+
+
+/* EOF */
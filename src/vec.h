@@ -0,0 +1,202 @@
+/*!
+ * \file vec.h
+ *
+ * \author Copyright (C) 2026 by agent <agent@local>.
+ *
+ * \brief Header file for libDXF coordinate value types.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_VEC_H
+#define LIBDXF_SRC_VEC_H
+
+
+#include "global.h"
+
+
+#define DXF_VEC_ELLIPSE_SAMPLES 64
+        /*!< \brief Number of samples of an elliptical arc taken before
+         * refining the nearest point. */
+#define DXF_VEC_ARRAY_MAX_RESERVE 65536
+        /*!< \brief The largest number of entries reserved ahead in an
+         * array of coordinates, larger arrays grow while appending. */
+
+
+/*!
+ * \brief Definition of a 2D coordinate.
+ *
+ * A plain value type for the geometric points embedded in other
+ * entities (hatch boundary path edges and seed points), in stead of a
+ * full \c DxfPoint entity with its layer, linetype and color members.
+ */
+typedef struct
+dxf_vec2_struct
+{
+        double x;
+                /*!< X value. */
+        double y;
+                /*!< Y value. */
+} DxfVec2;
+
+
+/*!
+ * \brief Definition of a 3D coordinate.
+ *
+ * A plain value type for the geometric points embedded in other
+ * entities (spline control and fit points, helix axis points).\n
+ * Multiple entries are stored as a contiguous array of \c DxfVec3, with
+ * the number of entries and the number of allocated entries kept in the
+ * owning entity.
+ */
+typedef struct
+dxf_vec3_struct
+{
+        double x;
+                /*!< X value. */
+        double y;
+                /*!< Y value. */
+        double z;
+                /*!< Z value. */
+} DxfVec3;
+
+
+/*!
+ * \brief Definition of the axes of an Object Coordinate System (OCS)
+ * in WCS.
+ *
+ * Planar entities (arcs, circles, light weight polylines, hatches) are
+ * stored in the OCS of their extrusion direction, the axes follow from
+ * the arbitrary axis algorithm in \c dxf_ocs_init().
+ */
+typedef struct
+dxf_ocs_struct
+{
+        DxfVec3 ax;
+                /*!< X axis. */
+        DxfVec3 ay;
+                /*!< Y axis. */
+        DxfVec3 az;
+                /*!< Z axis (the extrusion direction). */
+} DxfOcs;
+
+
+DxfVec2 *
+dxf_vec2_array_append
+(
+        DxfVec2 *array,
+        int number_of_vecs,
+        int *size,
+        DxfVec2 vec
+);
+DxfVec3 *
+dxf_vec3_array_append
+(
+        DxfVec3 *array,
+        int number_of_vecs,
+        int *size,
+        DxfVec3 vec
+);
+DxfVec3 *
+dxf_vec3_array_reserve
+(
+        DxfVec3 *array,
+        int *size,
+        int capacity
+);
+void
+dxf_ocs_init
+(
+        DxfOcs *ocs,
+        double extr_x0,
+        double extr_y0,
+        double extr_z0
+);
+DxfVec3
+dxf_ocs_to_wcs
+(
+        DxfOcs *ocs,
+        double x,
+        double y,
+        double z
+);
+DxfVec3
+dxf_ocs_from_wcs
+(
+        DxfOcs *ocs,
+        DxfVec3 point
+);
+int
+dxf_vec2_bulge_to_arc
+(
+        DxfVec2 start,
+        DxfVec2 end,
+        double bulge,
+        DxfVec2 *center,
+        double *radius,
+        double *start_angle,
+        double *end_angle
+);
+double
+dxf_vec3_nearest_point_on_segment
+(
+        DxfVec3 start,
+        DxfVec3 end,
+        DxfVec3 point,
+        DxfVec3 *nearest,
+        double *parameter
+);
+double
+dxf_vec3_nearest_point_on_arc
+(
+        DxfOcs *ocs,
+        DxfVec3 center,
+        double radius,
+        double start,
+        double end,
+        DxfVec3 point,
+        DxfVec3 *nearest,
+        double *angle
+);
+double
+dxf_vec3_nearest_point_on_elliptical_arc
+(
+        DxfVec3 center,
+        DxfVec3 u,
+        DxfVec3 v,
+        double start,
+        double end,
+        DxfVec3 point,
+        DxfVec3 *nearest,
+        double *parameter
+);
+
+
+#endif /* LIBDXF_SRC_VEC_H */
+
+
+/* EOF */
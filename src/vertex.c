@@ -33,6 +33,7 @@
 
 
 #include "vertex.h"
+#include "util.h"
 
 
 /*!
@@ -58,17 +59,14 @@ dxf_vertex_new ()
         size = sizeof (DxfVertex);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((vertex = malloc (size)) == NULL)
+        /* recycle a released DxfVertex when available. */
+        if ((vertex = dxf_pool_alloc (DXF_POOL_VERTEX, size)) == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () could not allocate memory for a DxfVertex struct.\n")),
                   __FUNCTION__);
                 vertex = NULL;
         }
-        else
-        {
-                memset (vertex, 0, size);
-        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -132,6 +130,7 @@ dxf_vertex_init
         vertex->flag = 0;
         vertex->dictionary_owner_soft = strdup ("");
         vertex->dictionary_owner_hard = strdup ("");
+        vertex->intern = NULL;
         vertex->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -178,7 +177,7 @@ dxf_vertex_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (vertex == NULL)
@@ -189,9 +188,13 @@ dxf_vertex_read
                 vertex = dxf_vertex_new ();
                 vertex = dxf_vertex_init (vertex);
         }
+        /* The symbol names are interned in the intern table of the
+         * file. */
+        vertex->intern = fp->intern;
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -200,7 +203,7 @@ dxf_vertex_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -215,13 +218,13 @@ dxf_vertex_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", vertex->linetype);
+                        vertex->linetype = dxf_intern_read_string (fp, vertex->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", vertex->layer);
+                        vertex->layer = dxf_intern_read_string (fp, vertex->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -373,14 +376,14 @@ dxf_vertex_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", vertex->dictionary_owner_soft);
+                        vertex->dictionary_owner_soft = dxf_read_string (fp, vertex->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", vertex->dictionary_owner_hard);
+                        vertex->dictionary_owner_hard = dxf_read_string (fp, vertex->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -394,19 +397,37 @@ dxf_vertex_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
-        }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
+        }
+        /* Symbol names not found in the file are still the copies
+         * made by the init function. */
+        vertex->linetype = dxf_intern_adopt_string ((DxfIntern *) vertex->intern, vertex->linetype);
+        vertex->layer = dxf_intern_adopt_string ((DxfIntern *) vertex->intern, vertex->layer);
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (vertex->linetype, "") == 0)
+        if (dxf_intern_is_symbol ((DxfIntern *) vertex->intern, vertex->linetype, DXF_INTERN_ID_EMPTY))
+        {
+                dxf_intern_free_string ((DxfIntern *) vertex->intern, vertex->linetype);
+                vertex->linetype = dxf_intern_string ((DxfIntern *) vertex->intern, DXF_DEFAULT_LINETYPE);
+        }
+        if (dxf_intern_is_symbol ((DxfIntern *) vertex->intern, vertex->layer, DXF_INTERN_ID_EMPTY))
         {
-                vertex->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_intern_free_string ((DxfIntern *) vertex->intern, vertex->layer);
+                vertex->layer = dxf_intern_string ((DxfIntern *) vertex->intern, DXF_DEFAULT_LAYER);
         }
-        if (strcmp (vertex->layer, "") == 0)
+        /* Register the handle for the resolution of references. */
+        if ((fp->handle_table != NULL) && (vertex->id_code > 0))
         {
-                vertex->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_handle_table_insert ((DxfHandleTable *) fp->handle_table,
+                  (unsigned int) vertex->id_code, VERTEX, vertex);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -439,6 +460,8 @@ dxf_vertex_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("VERTEX");
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -459,7 +482,8 @@ dxf_vertex_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (vertex->linetype, "") == 0)
+        linetype = vertex->linetype;
+        if (dxf_intern_is_symbol ((DxfIntern *) vertex->intern, linetype, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -467,9 +491,10 @@ dxf_vertex_write
                 fprintf (stderr,
                   (_("    %s entity is reset to default linetype")),
                   dxf_entity_name);
-                vertex->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = dxf_intern_get_symbol ((DxfIntern *) vertex->intern, DXF_INTERN_ID_DEFAULT_LINETYPE);
         }
-        if (strcmp (vertex->layer, "") == 0)
+        layer = vertex->layer;
+        if (dxf_intern_is_symbol ((DxfIntern *) vertex->intern, layer, DXF_INTERN_ID_EMPTY))
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -477,7 +502,7 @@ dxf_vertex_write
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0")),
                   dxf_entity_name);
-                vertex->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = dxf_intern_get_symbol ((DxfIntern *) vertex->intern, DXF_INTERN_ID_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -517,10 +542,10 @@ dxf_vertex_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", vertex->layer);
-        if (strcmp (vertex->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (!dxf_intern_is_symbol ((DxfIntern *) vertex->intern, linetype, DXF_INTERN_ID_DEFAULT_LINETYPE))
         {
-                fprintf (fp->fp, "  6\n%s\n", vertex->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
@@ -626,11 +651,11 @@ dxf_vertex_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (vertex->linetype);
-        free (vertex->layer);
+        dxf_intern_free_string ((DxfIntern *) vertex->intern, vertex->linetype);
+        dxf_intern_free_string ((DxfIntern *) vertex->intern, vertex->layer);
         free (vertex->dictionary_owner_soft);
         free (vertex->dictionary_owner_hard);
-        free (vertex);
+        dxf_pool_free (DXF_POOL_VERTEX, vertex);
         vertex = NULL;
 #if DEBUG
         DXF_DEBUG_END
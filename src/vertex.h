@@ -37,6 +37,9 @@
 
 
 #include "global.h"
+#include "intern.h"
+#include "handle_table.h"
+#include "pool.h"
 
 
 /*!
@@ -187,6 +190,11 @@ dxf_vertex
                  * Optional.\n
                  * Present only if nonzero.\n
                  * Group code = 74. */
+        struct DxfIntern *intern;
+                /*!< Intern table holding the interned symbol names of
+                 * this entity, \c NULL when none are interned.\n
+                 * Symbol names not found in this table are private
+                 * copies. */
         struct DxfVertex *next;
                 /*!< Pointer to the next DxfVertex.\n
                  * \c NULL in the last DxfVertex. */
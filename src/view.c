@@ -33,6 +33,8 @@
 
 
 #include "view.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -183,7 +185,7 @@ dxf_view_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (view == NULL)
@@ -194,9 +196,10 @@ dxf_view_read
                 view = dxf_view_new ();
                 view = dxf_view_init (view);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -205,7 +208,7 @@ dxf_view_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -220,7 +223,7 @@ dxf_view_read
                         /* Now follows a string containing a view
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", view->view_name);
+                        view->view_name = dxf_read_string (fp, view->view_name);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -357,14 +360,14 @@ dxf_view_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", view->dictionary_owner_soft);
+                        view->dictionary_owner_soft = dxf_read_string (fp, view->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", view->dictionary_owner_hard);
+                        view->dictionary_owner_hard = dxf_read_string (fp, view->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -378,10 +381,16 @@ dxf_view_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
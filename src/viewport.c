@@ -33,6 +33,8 @@
 
 
 #include "viewport.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -228,7 +230,7 @@ dxf_viewport_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (viewport == NULL)
@@ -239,9 +241,10 @@ dxf_viewport_read
                 viewport = dxf_viewport_new ();
                 viewport = dxf_viewport_init (viewport);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -250,7 +253,7 @@ dxf_viewport_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -265,13 +268,13 @@ dxf_viewport_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", viewport->linetype);
+                        viewport->linetype = dxf_read_string (fp, viewport->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", viewport->layer);
+                        viewport->layer = dxf_read_string (fp, viewport->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -382,7 +385,7 @@ dxf_viewport_read
                         /* Now follows a string containing the appname,
                          * always "ACAD". */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", viewport->app_name);
+                        viewport->app_name = dxf_read_string (fp, viewport->app_name);
                         if (strcmp (viewport->app_name, "ACAD") == 1)
                         {
                                 fprintf (stderr,
@@ -407,7 +410,7 @@ dxf_viewport_read
                         /* Now follows a string containing the viewport
                          * data, always "MVIEW". */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", viewport->viewport_data);
+                        viewport->viewport_data = dxf_read_string (fp, viewport->viewport_data);
                         if (strcmp (viewport->viewport_data, "MVIEW") == 1)
                         {
                                 fprintf (stderr,
@@ -432,7 +435,7 @@ dxf_viewport_read
                         /* Now follows a string containing the window
                          * begin descriptor, always "{". */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", viewport->window_descriptor_begin);
+                        viewport->window_descriptor_begin = dxf_read_string (fp, viewport->window_descriptor_begin);
                         if (strcmp (viewport->window_descriptor_begin, "{") == 1)
                         {
                                 fprintf (stderr,
@@ -896,7 +899,7 @@ dxf_viewport_read
                         /* Now follows a string containing the frozen
                          * layer list begin descriptor, always "{". */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", viewport->frozen_layer_list_begin);
+                        viewport->frozen_layer_list_begin = dxf_read_string (fp, viewport->frozen_layer_list_begin);
                         if (strcmp (viewport->frozen_layer_list_begin, "{") == 1)
                         {
                                 fprintf (stderr,
@@ -954,7 +957,7 @@ dxf_viewport_read
                         /* Now follows a string containing the frozen
                          * layer list end descriptor, always "}". */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", viewport->frozen_layer_list_end);
+                        viewport->frozen_layer_list_end = dxf_read_string (fp, viewport->frozen_layer_list_end);
                         if (strcmp (viewport->frozen_layer_list_end, "}") == 1)
                         {
                                 fprintf (stderr,
@@ -979,7 +982,7 @@ dxf_viewport_read
                         /* Now follows a string containing the window
                          * end descriptor, always "}". */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", viewport->window_descriptor_end);
+                        viewport->window_descriptor_end = dxf_read_string (fp, viewport->window_descriptor_end);
                         if (strcmp (viewport->window_descriptor_end, "}") == 1)
                         {
                                 fprintf (stderr,
@@ -996,7 +999,13 @@ dxf_viewport_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (viewport->linetype, "") == 0)
@@ -1008,7 +1017,7 @@ dxf_viewport_read
                 viewport->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1041,6 +1050,8 @@ dxf_viewport_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("VIEWPORT");
+        char *layer = NULL;
+        char *linetype = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -1061,7 +1072,8 @@ dxf_viewport_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (viewport->linetype, "") == 0)
+        linetype = viewport->linetype;
+        if (strcmp (linetype, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
@@ -1069,9 +1081,10 @@ dxf_viewport_write
                 fprintf (stderr,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                viewport->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                linetype = DXF_DEFAULT_LINETYPE;
         }
-        if (strcmp (viewport->layer, "") == 0)
+        layer = viewport->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
@@ -1079,7 +1092,7 @@ dxf_viewport_write
                 fprintf (stderr,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
-                viewport->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -1119,10 +1132,10 @@ dxf_viewport_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", viewport->layer);
-        if (strcmp (viewport->linetype, DXF_DEFAULT_LINETYPE) != 0)
+        fprintf (fp->fp, "  8\n%s\n", layer);
+        if (strcmp (linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
-                fprintf (fp->fp, "  6\n%s\n", viewport->linetype);
+                fprintf (fp->fp, "  6\n%s\n", linetype);
         }
         if ((fp->acad_version_number <= AutoCAD_11)
           && DXF_FLATLAND
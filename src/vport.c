@@ -39,6 +39,8 @@
 
 
 #include "vport.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -207,7 +209,7 @@ dxf_vport_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (vport == NULL)
@@ -218,9 +220,10 @@ dxf_vport_read
                 vport = dxf_vport_new ();
                 vport = dxf_vport_init (vport);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -229,7 +232,7 @@ dxf_vport_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -244,7 +247,7 @@ dxf_vport_read
                         /* Now follows a string containing a viewport
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", vport->viewport_name);
+                        vport->viewport_name = dxf_read_string (fp, vport->viewport_name);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -503,14 +506,14 @@ dxf_vport_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", vport->dictionary_owner_soft);
+                        vport->dictionary_owner_soft = dxf_read_string (fp, vport->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", vport->dictionary_owner_hard);
+                        vport->dictionary_owner_hard = dxf_read_string (fp, vport->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -520,6 +523,9 @@ dxf_vport_read
                         fprintf (stdout, "DXF comment: %s\n", temp_string);
                 }
 
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if ((strcmp (vport->viewport_name, "") == 0)
@@ -531,7 +537,7 @@ dxf_vport_read
                 return (NULL);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
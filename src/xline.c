@@ -33,6 +33,8 @@
 
 
 #include "xline.h"
+#include "util.h"
+#include "pool.h"
 
 
 /*!
@@ -179,7 +181,7 @@ dxf_xline_read
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_pool_string_free (temp_string);
                 return (NULL);
         }
         if (xline == NULL)
@@ -190,9 +192,10 @@ dxf_xline_read
                 xline = dxf_xline_new ();
                 xline = dxf_xline_init (xline);
         }
+        temp_string = dxf_pool_string_alloc ();
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_group_code (fp, temp_string);
+        while ((strcmp (temp_string, "0") != 0) && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -201,7 +204,7 @@ dxf_xline_read
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_pool_string_free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -216,13 +219,13 @@ dxf_xline_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", xline->linetype);
+                        xline->linetype = dxf_read_string (fp, xline->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", xline->layer);
+                        xline->layer = dxf_read_string (fp, xline->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -329,14 +332,14 @@ dxf_xline_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", xline->dictionary_owner_soft);
+                        xline->dictionary_owner_soft = dxf_read_string (fp, xline->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", xline->dictionary_owner_hard);
+                        xline->dictionary_owner_hard = dxf_read_string (fp, xline->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -350,7 +353,13 @@ dxf_xline_read
                         fprintf (stderr,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_group_code (fp, temp_string);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                dxf_read_group_code (fp, temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (xline->linetype, "") == 0)
@@ -362,7 +371,7 @@ dxf_xline_read
                 xline->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_pool_string_free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -395,6 +404,7 @@ dxf_xline_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("XLINE");
+        char *layer = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -427,7 +437,8 @@ dxf_xline_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (strcmp (xline->layer, "") == 0)
+        layer = xline->layer;
+        if (strcmp (layer, "") == 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
@@ -435,7 +446,7 @@ dxf_xline_write
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                xline->layer = strdup (DXF_DEFAULT_LAYER);
+                layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -475,7 +486,7 @@ dxf_xline_write
         {
                 fprintf (fp->fp, " 67\n%d\n", DXF_PAPERSPACE);
         }
-        fprintf (fp->fp, "  8\n%s\n", xline->layer);
+        fprintf (fp->fp, "  8\n%s\n", layer);
         if (strcmp (xline->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
                 fprintf (fp->fp, "  6\n%s\n", xline->linetype);
@@ -29,19 +29,1105 @@
  * <hr>
  */
 
+#include <pthread.h>
+#include <stdlib.h>
 #include <string.h>
 #include "includes.h"
 
+#define HANDLE_THREADS 4
+#define HANDLES_PER_THREAD 1000
+#define WRITE_LINES 10000
+
+/*
+ * Drawing and output array of a thread allocating handles.
+ */
+typedef struct
+{
+    DxfDrawing *drawing;
+    uint64_t *handles;
+} HandleJob;
+
+/*
+ * Sets up a square hatch boundary path polyline from (min, min) to
+ * (max, max).
+ */
+static void square_path (DxfHatchBoundaryPath *path,
+  DxfHatchBoundaryPathPolyline *polyline,
+  DxfHatchBoundaryPathPolylineVertex *vertices, double min, double max)
+{
+    int i;
+
+    memset (path, 0, sizeof (DxfHatchBoundaryPath));
+    memset (polyline, 0, sizeof (DxfHatchBoundaryPathPolyline));
+    memset (vertices, 0, 4 * sizeof (DxfHatchBoundaryPathPolylineVertex));
+    for (i = 0; i < 4; i++)
+    {
+        vertices[i].x0 = ((i == 1) || (i == 2)) ? max : min;
+        vertices[i].y0 = (i >= 2) ? max : min;
+        if (i < 3)
+            vertices[i].next = (struct DxfHatchBoundaryPathPolylineVertex *) &vertices[i + 1];
+    }
+    polyline->vertices = (struct DxfHatchBoundaryPathPolylineVertex *) vertices;
+    polyline->number_of_vertices = 4;
+    polyline->is_closed = 1;
+    path->polylines = (struct DxfHatchBoundaryPathPolyline *) polyline;
+}
+
+
+/*
+ * Allocates HANDLES_PER_THREAD handles from a range of its own.
+ */
+static void *allocate_handles (void *data)
+{
+    HandleJob *job = (HandleJob *) data;
+    DxfHandleRange range = {0, 0};
+    int i;
+
+    for (i = 0; i < HANDLES_PER_THREAD; i++)
+        job->handles[i] = dxf_drawing_allocate_handle (job->drawing, &range);
+    return (NULL);
+}
+
+
+static int compare_handles (const void *a, const void *b)
+{
+    uint64_t x = *((const uint64_t *) a);
+    uint64_t y = *((const uint64_t *) b);
+
+    return ((x > y) - (x < y));
+}
+
+
+/*
+ * Writes a drawing into a memory buffer on number_of_threads threads.
+ */
+static int write_drawing (DxfDrawing *drawing, int number_of_threads,
+  char **buffer, size_t *size)
+{
+    DxfFile fp;
+    int result;
+
+    memset (&fp, 0, sizeof (DxfFile));
+    fp.fp = open_memstream (buffer, size);
+    if (fp.fp == NULL)
+        return (EXIT_FAILURE);
+    fp.acad_version_number = AutoCAD_2000;
+    result = dxf_file_write_parallel (&fp, drawing, number_of_threads);
+    if (fclose (fp.fp) != 0)
+        result = EXIT_FAILURE;
+    return (result);
+}
+
+
+/*
+ * Frees the boundary paths unpacked from a hatch store, which the
+ * shallow free functions of the list view leave behind.
+ */
+static void free_unpacked_paths (DxfHatchBoundaryPath *path)
+{
+    DxfHatchBoundaryPathPolyline *polyline;
+    DxfHatchBoundaryPathEdge *edge;
+    DxfHatchBoundaryPathEdgeSpline *spline;
+
+    for (; path != NULL; path = (DxfHatchBoundaryPath *) path->next)
+    {
+        for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines;
+          polyline != NULL;
+          polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+        {
+            if (polyline->vertices != NULL)
+                dxf_hatch_boundary_path_polyline_vertex_free_chain ((DxfHatchBoundaryPathPolylineVertex *) polyline->vertices);
+            polyline->vertices = NULL;
+        }
+        for (edge = (DxfHatchBoundaryPathEdge *) path->edges;
+          edge != NULL;
+          edge = (DxfHatchBoundaryPathEdge *) edge->next)
+        {
+            for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines;
+              spline != NULL;
+              spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+            {
+                if (spline->control_points != NULL)
+                    dxf_hatch_boundary_path_edge_spline_control_point_free_chain ((DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points);
+                spline->control_points = NULL;
+            }
+            if (edge->arcs != NULL)
+                dxf_hatch_boundary_path_edge_arc_free_chain ((DxfHatchBoundaryPathEdgeArc *) edge->arcs);
+            if (edge->ellipses != NULL)
+                dxf_hatch_boundary_path_edge_ellipse_free_chain ((DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses);
+            if (edge->lines != NULL)
+                dxf_hatch_boundary_path_edge_line_free_chain ((DxfHatchBoundaryPathEdgeLine *) edge->lines);
+            if (edge->splines != NULL)
+                dxf_hatch_boundary_path_edge_spline_free_chain ((DxfHatchBoundaryPathEdgeSpline *) edge->splines);
+            edge->arcs = NULL;
+            edge->ellipses = NULL;
+            edge->lines = NULL;
+            edge->splines = NULL;
+        }
+    }
+}
+
+
+/*
+ * Compares the edges, knots and vertices of two hatch stores.
+ */
+static int compare_hatch_stores (DxfHatchStore *a, DxfHatchStore *b)
+{
+    int i;
+
+    if ((a->number_of_paths != b->number_of_paths)
+      || (a->number_of_edges != b->number_of_edges)
+      || (a->number_of_knots != b->number_of_knots)
+      || (a->number_of_control_points != b->number_of_control_points)
+      || (a->number_of_vertices != b->number_of_vertices))
+        return (FALSE);
+    for (i = 0; i < a->number_of_edges; i++)
+        if ((a->edges[i].type != b->edges[i].type)
+          || (a->edges[i].x0 != b->edges[i].x0)
+          || (a->edges[i].y1 != b->edges[i].y1)
+          || (a->edges[i].radius != b->edges[i].radius)
+          || (a->edges[i].end_angle != b->edges[i].end_angle)
+          || (a->edges[i].is_ccw != b->edges[i].is_ccw))
+            return (FALSE);
+    for (i = 0; i < a->number_of_knots; i++)
+        if (a->knots[i] != b->knots[i])
+            return (FALSE);
+    for (i = 0; i < a->number_of_control_points; i++)
+        if ((a->control_points[i].y0 != b->control_points[i].y0)
+          || (a->control_points[i].weight != b->control_points[i].weight))
+            return (FALSE);
+    for (i = 0; i < a->number_of_vertices; i++)
+        if ((a->vertices[i].x0 != b->vertices[i].x0)
+          || (a->vertices[i].y0 != b->vertices[i].y0)
+          || (a->vertices[i].bulge != b->vertices[i].bulge)
+          || (a->vertices[i].has_bulge != b->vertices[i].has_bulge))
+            return (FALSE);
+    return (TRUE);
+}
+
+
 int main (void)
 {
+    DxfDrawing *drawing = NULL;
+    DxfDrawing *copy = NULL;
+    DxfChunkListIter iter;
+    DxfLayerIndexMap *layer_map = NULL;
+    DxfLayerIndex *layer_index = NULL;
+    DxfIdbuffer *idbuffers = NULL;
+    DxfLine *line = NULL;
+    DxfHatch hatch;
+    DxfHatchBoundaryPath paths[3];
+    DxfHatchBoundaryPathPolyline polylines[3];
+    DxfHatchBoundaryPathPolylineVertex vertices[3][4];
+    DxfArea area;
+    DxfHatch unpacked;
+    DxfHatchBoundaryPathEdge composite;
+    DxfHatchBoundaryPathEdgeLine edge_line;
+    DxfHatchBoundaryPathEdgeArc edge_arc;
+    DxfHatchBoundaryPathEdgeSpline edge_spline;
+    DxfHatchBoundaryPathEdgeSplineCp control_points[3];
+    double knots[6] = {0.0, 0.0, 0.0, 1.0, 1.0, 1.0};
+    DxfHatchStore *store = NULL;
+    DxfHatchStore *repacked = NULL;
+    DxfLineColumns *line_columns = NULL;
+    DxfPointColumns *point_columns = NULL;
+    DxfLWPolyline *lwpolyline = NULL;
+    DxfPolyline *polyline = NULL;
+    DxfIndexedMesh *mesh = NULL;
+    uint32_t *indices = NULL;
+    void *objects[DXF_POOL_MAX_FREE_OBJECTS + 44];
+    DxfPoolStats pool_stats;
+    DxfChunkList *chunks = NULL;
+    DxfChunkList *chunks_copy = NULL;
+    DxfVertex *vertex = NULL;
+    int *entry = NULL;
+    int *first_entry = NULL;
+    int sum;
+    DxfMemoryStats memory_stats;
+    size_t section_bytes;
+    DxfBounds bounds;
+    DxfFile output;
+    DxfSpatialIndexTree *tree = NULL;
+    DxfSpatialIndexItem *items[16];
+    int number_of_items[4];
+    DxfSpatialIndexNearest nearest[2];
+    DxfHatchBoundaryPathPolylineVertex ring[64];
+    DxfVec2 test_points[441];
+    int inside[441];
+    DxfTessellation tolerance;
+    DxfTessellationBuffer *tessellation = NULL;
+    DxfCircle *circle = NULL;
+    DxfOcs ocs;
+    DxfVec3 arc_points[64];
+    int segments;
+    DxfExpandCache *expand_cache = NULL;
+    DxfBlock blocks[2];
+    DxfLine block_line;
+    DxfInsert inserts[3];
+    DxfDrawingEntity block_entities[2];
+    DxfSpline *spline = NULL;
+    DxfVec3 point;
+    pthread_t threads[HANDLE_THREADS];
+    HandleJob jobs[HANDLE_THREADS];
+    uint64_t handles[HANDLE_THREADS * HANDLES_PER_THREAD];
+    uint64_t first;
+    char *serial = NULL;
+    char *parallel = NULL;
+    size_t serial_size = 0;
+    size_t parallel_size = 0;
+    FILE *file = NULL;
+    int type = UNKNOWN_ENTITY;
+    int i;
+
     /*
      * Reads a dxf file using libdxf form examples dir.
      */
     /* Version 2000 */
-    if (dxf_file_read ("../examples/qcad-example_R2000.dxf"))
+    drawing = dxf_file_read ("../examples/qcad-example_R2000.dxf");
+    if (drawing == NULL)
         fprintf (stdout, "TESTS: R2000 exited with error\n");
     else
+    {
         fprintf (stdout, "TESTS: R2000 exited with no error\n");
+        /* The first LINE entity has handle 43. */
+        line = dxf_handle_table_resolve_string ((DxfHandleTable *) drawing->handle_table,
+          "43", &type);
+        if ((line == NULL) || (type != LINE) || (line->x1 != 320.0))
+            fprintf (stdout, "TESTS: R2000 handle 43 was not resolved\n");
+        else
+            fprintf (stdout, "TESTS: R2000 handle 43 resolved to a LINE\n");
+        dxf_drawing_free (drawing);
+    }
+
+    /*
+     * The LINE entities go into the columnar store, and no DxfLine is
+     * allocated for them.
+     */
+    drawing = dxf_file_read_columnar ("../examples/qcad-example_R2000.dxf");
+    line_columns = dxf_drawing_get_line_columns (drawing);
+    if ((line_columns == NULL)
+      || (line_columns->number_of_rows != 9)
+      || (line_columns->id_code[0] != 0x43)
+      || (line_columns->x1[0] != 320.0)
+      || (dxf_drawing_get_number_of_entities (drawing) != 5))
+        fprintf (stdout, "TESTS: R2000 LINE columns were not read\n");
+    else
+        fprintf (stdout, "TESTS: R2000 LINE columns hold 9 rows\n");
+    if (drawing != NULL)
+        dxf_drawing_free (drawing);
+
+    /* A blank layer name does not shift the following group codes. */
+    file = fopen ("columns.dxf", "w");
+    if (file != NULL)
+    {
+        fputs ("  0\nSECTION\n  2\nENTITIES\n"
+          "  0\nLINE\n  8\n\n 10\n1.0\n 11\n4.0\n"
+          "  0\nPOINT\n  8\n0\n 10\n2.0\n"
+          "  0\nENDSEC\n  0\nEOF\n", file);
+        fclose (file);
+    }
+    drawing = dxf_file_read_columnar ("columns.dxf");
+    line_columns = dxf_drawing_get_line_columns (drawing);
+    point_columns = dxf_drawing_get_point_columns (drawing);
+    if ((line_columns == NULL)
+      || (point_columns == NULL)
+      || (line_columns->number_of_rows != 1)
+      || (line_columns->x0[0] != 1.0)
+      || (line_columns->x1[0] != 4.0)
+      || (strcmp (dxf_intern_get_string (line_columns->intern, line_columns->layer_id[0]), "") != 0)
+      || (point_columns->number_of_rows != 1)
+      || (point_columns->x0[0] != 2.0))
+        fprintf (stdout, "TESTS: LINE and POINT columns were not read\n");
+    else
+        fprintf (stdout, "TESTS: LINE and POINT columns read a blank layer\n");
+    if (drawing != NULL)
+        dxf_drawing_free (drawing);
+    remove ("columns.dxf");
+
+    /*
+     * The vertex count of a LWPOLYLINE is only a hint, an absurd count
+     * neither allocates it nor limits the vertices read.
+     */
+    file = fopen ("lwpolyline.dxf", "w");
+    if (file != NULL)
+    {
+        fputs ("  0\nSECTION\n  2\nENTITIES\n"
+          "  0\nLWPOLYLINE\n  8\n0\n 90\n2000000000\n 70\n1\n"
+          " 10\n0.0\n 20\n0.0\n 10\n4.0\n 20\n0.0\n 42\n1.0\n"
+          " 10\n4.0\n 20\n3.0\n 40\n0.5\n 41\n0.25\n"
+          "  0\nENDSEC\n  0\nEOF\n", file);
+        fclose (file);
+    }
+    drawing = dxf_file_read ("lwpolyline.dxf");
+    lwpolyline = NULL;
+    if ((drawing != NULL) && (dxf_drawing_get_number_of_entities (drawing) == 1))
+        lwpolyline = ((DxfDrawingEntity *) dxf_chunk_list_get ((DxfChunkList *) drawing->entities, 0))->entity;
+    if ((lwpolyline == NULL)
+      || (lwpolyline->number_vertices != 3)
+      || (lwpolyline->vertices_size > DXF_VEC_ARRAY_MAX_RESERVE)
+      || (lwpolyline->vertices[1].bulge != 1.0)
+      || (lwpolyline->vertices[2].y0 != 3.0)
+      || (lwpolyline->vertices[2].start_width != 0.5)
+      || (lwpolyline->vertices[2].end_width != 0.25))
+        fprintf (stdout, "TESTS: LWPOLYLINE vertices were not read\n");
+    else
+        fprintf (stdout, "TESTS: LWPOLYLINE read 3 vertices into its array\n");
+    if (drawing != NULL)
+        dxf_drawing_free (drawing);
+    remove ("lwpolyline.dxf");
+
+    /*
+     * A frozen drawing hands out no modifiable sections but can be
+     * read, a copy-on-write version gets its own entities container.
+     */
+    drawing = dxf_drawing_freeze (dxf_file_read ("../examples/qcad-example_R2000.dxf"));
+    copy = dxf_drawing_copy_on_write (drawing);
+    i = 0;
+    if ((drawing != NULL)
+      && (dxf_drawing_entities_iter_init (drawing, &iter) == EXIT_SUCCESS))
+        while (dxf_chunk_list_iter_next (&iter) != NULL)
+            i++;
+    if ((drawing == NULL)
+      || (dxf_drawing_get_header (drawing) != NULL)
+      || (dxf_drawing_get_entities (drawing) != NULL)
+      || (dxf_drawing_get_const_header (drawing) == NULL)
+      || (i != dxf_drawing_get_number_of_entities (drawing)))
+        fprintf (stdout, "TESTS: frozen drawing handed out a modifiable section\n");
+    else
+        fprintf (stdout, "TESTS: frozen drawing is read only\n");
+    if ((copy == NULL)
+      || (dxf_drawing_get_entities (copy) == NULL)
+      || (dxf_drawing_get_entities (copy) == (DxfChunkList *) drawing->entities)
+      || (dxf_drawing_append_entity (copy, LINE, dxf_line_init (dxf_line_new ())) != EXIT_SUCCESS)
+      || (dxf_drawing_get_number_of_entities (copy) != i + 1)
+      || (dxf_drawing_get_number_of_entities (drawing) != i))
+        fprintf (stdout, "TESTS: copy-on-write drawing modified its base drawing\n");
+    else
+        fprintf (stdout, "TESTS: copy-on-write drawing left its base drawing untouched\n");
+    if (copy != NULL)
+        dxf_drawing_free (copy);
+    if (drawing != NULL)
+        dxf_drawing_unref (drawing);
+
+    /*
+     * The LAYER_INDEX of a drawing counts an entity moved to another
+     * layer with a setter, and refers to an IDBUFFER per layer holding
+     * the handles of its entities.
+     */
+    file = fopen ("layer_index.dxf", "w");
+    if (file != NULL)
+    {
+        fputs ("  0\nSECTION\n  2\nENTITIES\n"
+          "  0\nLINE\n  5\n20\n  8\nA\n 10\n0.0\n 11\n1.0\n"
+          "  0\nLINE\n  5\n21\n  8\nA\n 10\n0.0\n 11\n2.0\n"
+          "  0\nLINE\n  5\n22\n  8\nB\n 10\n0.0\n 11\n3.0\n"
+          "  0\nENDSEC\n  0\nEOF\n", file);
+        fclose (file);
+    }
+    drawing = dxf_file_read ("layer_index.dxf");
+    layer_map = dxf_drawing_get_layer_map (drawing);
+    layer_index = dxf_layer_index_init (dxf_layer_index_new ());
+    if ((layer_map != NULL) && (layer_index != NULL))
+    {
+        line = ((DxfDrawingEntity *) dxf_chunk_list_get ((DxfChunkList *) drawing->entities, 1))->entity;
+        dxf_line_set_layer (line, "C");
+        layer_index->id_code = 0x10;
+        if ((layer_map->intern != drawing->intern)
+          || (dxf_layer_index_map_fill_layer_index (layer_map, drawing, layer_index, &idbuffers) != EXIT_SUCCESS)
+          || (dxf_layer_index_map_get_number_of_layers (layer_map) != 3)
+          || (dxf_layer_index_map_get_members (layer_map, "A")->number_of_entities != 1)
+          || (dxf_layer_index_map_get_members (layer_map, "C")->number_of_entities != 1)
+          || (idbuffers == NULL)
+          || (idbuffers->id_code <= 0x22)
+          || (strcmp (idbuffers->dictionary_owner_soft, "10") != 0)
+          || (strcmp (idbuffers->entity_pointer->soft_pointer, "20") != 0)
+          || (idbuffers->entity_pointer->next != NULL)
+          || (strtol (layer_index->hard_owner_reference[0], NULL, 16) != idbuffers->id_code)
+          || (strtol (layer_index->hard_owner_reference[2], NULL, 16) != idbuffers->id_code + 2)
+          || (strcmp (layer_index->layer_name[2], "C") != 0)
+          || (strcmp (layer_index->layer_name[3], "") != 0))
+            fprintf (stdout, "TESTS: LAYER_INDEX was not filled from the drawing\n");
+        else
+            fprintf (stdout, "TESTS: LAYER_INDEX refers to an IDBUFFER per layer\n");
+        if (idbuffers != NULL)
+            dxf_idbuffer_free_chain (idbuffers);
+    }
+    else
+        fprintf (stdout, "TESTS: LAYER_INDEX was not filled from the drawing\n");
+    if (layer_index != NULL)
+        dxf_layer_index_free (layer_index);
+    if (drawing != NULL)
+        dxf_drawing_free (drawing);
+    remove ("layer_index.dxf");
+
+    /*
+     * A quadratic Bezier SPLINE read from a file passes through (1, 1)
+     * halfway, thickness (39) and linetype scale (48) do not shift the
+     * knots and the knot count comes from the knots read.
+     */
+    file = fopen ("spline.dxf", "w");
+    if (file != NULL)
+    {
+        fputs ("  0\nSECTION\n  2\nENTITIES\n"
+          "  0\nSPLINE\n  8\n0\n 39\n1.0\n 48\n2.0\n 70\n8\n"
+          " 71\n2\n 72\n7\n 73\n3\n 74\n0\n"
+          " 40\n0.0\n 40\n0.0\n 40\n0.0\n 40\n1.0\n 40\n1.0\n 40\n1.0\n"
+          " 10\n0.0\n 20\n0.0\n 30\n0.0\n 10\n1.0\n 20\n2.0\n 30\n0.0\n"
+          " 10\n2.0\n 20\n0.0\n 30\n0.0\n"
+          "  0\nENDSEC\n  0\nEOF\n", file);
+        fclose (file);
+    }
+    drawing = dxf_file_read ("spline.dxf");
+    spline = NULL;
+    if ((drawing != NULL) && (dxf_drawing_get_number_of_entities (drawing) == 1))
+        spline = ((DxfDrawingEntity *) dxf_chunk_list_get ((DxfChunkList *) drawing->entities, 0))->entity;
+    if ((spline == NULL)
+      || (spline->number_of_knots != 6)
+      || (dxf_spline_calculate_point (spline, 0.5, &point, NULL) != EXIT_SUCCESS)
+      || (fabs (point.x - 1.0) > 1e-9)
+      || (fabs (point.y - 1.0) > 1e-9))
+        fprintf (stdout, "TESTS: SPLINE read from a file was not evaluated\n");
+    else
+        fprintf (stdout, "TESTS: SPLINE read from a file passes through (1, 1)\n");
+    if (drawing != NULL)
+        dxf_drawing_free (drawing);
+    remove ("spline.dxf");
+
+    /*
+     * The handle seed is past the largest handle read, even when
+     * $HANDSEED is lower.
+     */
+    file = fopen ("handles.dxf", "w");
+    if (file != NULL)
+    {
+        fputs ("  0\nSECTION\n  2\nENTITIES\n"
+          "  0\nLINE\n  5\nFFFF\n  8\n0\n 10\n0.0\n 11\n1.0\n"
+          "  0\nENDSEC\n  0\nEOF\n", file);
+        fclose (file);
+    }
+    drawing = dxf_file_read ("handles.dxf");
+    if ((drawing == NULL) || (dxf_drawing_get_handle_seed (drawing) != 0x10000))
+        fprintf (stdout, "TESTS: handle seed was not synced with the handle table\n");
+    else
+        fprintf (stdout, "TESTS: handle seed is past the largest handle read\n");
+    remove ("handles.dxf");
+
+    /* Threads allocating handles never hand out the same handle. */
+    for (i = 0; (drawing != NULL) && (i < HANDLE_THREADS); i++)
+    {
+        jobs[i].drawing = drawing;
+        jobs[i].handles = &handles[i * HANDLES_PER_THREAD];
+        pthread_create (&threads[i], NULL, allocate_handles, &jobs[i]);
+    }
+    for (i = 0; (drawing != NULL) && (i < HANDLE_THREADS); i++)
+        pthread_join (threads[i], NULL);
+    if (drawing != NULL)
+    {
+        qsort (handles, HANDLE_THREADS * HANDLES_PER_THREAD, sizeof (uint64_t), compare_handles);
+        for (i = 1; i < HANDLE_THREADS * HANDLES_PER_THREAD; i++)
+            if ((handles[i] == handles[i - 1]) || (handles[i - 1] < 0x10000))
+                break;
+        if (i < HANDLE_THREADS * HANDLES_PER_THREAD)
+            fprintf (stdout, "TESTS: concurrent handle allocation handed out a handle twice\n");
+        else
+            fprintf (stdout, "TESTS: concurrent handle allocation handed out unique handles\n");
+        /* An exhausted handle range is reported, not wrapped around. */
+        drawing->handle_seed = UINT64_MAX - 10;
+        first = dxf_drawing_reserve_handles (drawing, DXF_DRAWING_HANDLE_BLOCK_SIZE);
+        if ((first != 0) || (dxf_drawing_get_handle_seed (drawing) != UINT64_MAX - 10))
+            fprintf (stdout, "TESTS: exhausted handles were reserved\n");
+        else
+            fprintf (stdout, "TESTS: exhausted handles are not reserved\n");
+        dxf_drawing_free (drawing);
+    }
+
+    /*
+     * Entities on an empty layer are written on layer 0 by the
+     * parallel writer exactly as by the serial writer, and are left on
+     * their empty layer.
+     */
+    file = fopen ("parallel.dxf", "w");
+    if (file != NULL)
+    {
+        fputs ("  0\nSECTION\n  2\nENTITIES\n", file);
+        for (i = 0; i < WRITE_LINES; i++)
+            fprintf (file, "  0\nLINE\n  5\n%X\n  8\n0\n 10\n%d.0\n 11\n%d.5\n",
+              i + 0x100, i, i);
+        fputs ("  0\nENDSEC\n  0\nEOF\n", file);
+        fclose (file);
+    }
+    drawing = dxf_file_read ("parallel.dxf");
+    /* The reader already relocates empty layers, empty them again. */
+    for (i = 0; (drawing != NULL) && (i < WRITE_LINES); i += 1000)
+        dxf_line_set_layer (((DxfDrawingEntity *) dxf_chunk_list_get ((DxfChunkList *) drawing->entities, i))->entity, "");
+    if ((drawing == NULL)
+      || (write_drawing (drawing, 4, &parallel, &parallel_size) != EXIT_SUCCESS)
+      || (write_drawing (drawing, 1, &serial, &serial_size) != EXIT_SUCCESS)
+      || (parallel_size != serial_size)
+      || (memcmp (parallel, serial, serial_size) != 0)
+      || (strstr (serial, "LINE\n  5\n100\n100\nAcDbEntity\n  8\n0\n") == NULL))
+        fprintf (stdout, "TESTS: parallel writer output differs from the serial writer\n");
+    else
+        fprintf (stdout, "TESTS: parallel writer output equals the serial writer\n");
+    line = NULL;
+    if (drawing != NULL)
+        line = ((DxfDrawingEntity *) dxf_chunk_list_get ((DxfChunkList *) drawing->entities, 0))->entity;
+    if ((line == NULL) || (strcmp (line->layer, "") != 0))
+        fprintf (stdout, "TESTS: writing relocated an entity on an empty layer\n");
+    else
+        fprintf (stdout, "TESTS: writing left the entities untouched\n");
+    free (serial);
+    free (parallel);
+    if (drawing != NULL)
+        dxf_drawing_free (drawing);
+    remove ("parallel.dxf");
+
+    /*
+     * A Normal style hatch fills an island within an island again:
+     * 100 - 36 + 4 = 68.
+     */
+    memset (&hatch, 0, sizeof (DxfHatch));
+    hatch.extr_z0 = 1.0;
+    for (i = 0; i < 3; i++)
+    {
+        square_path (&paths[i], &polylines[i], vertices[i], 2.0 * i, 10.0 - 2.0 * i);
+        if (i < 2)
+            paths[i].next = (struct DxfHatchBoundaryPath *) &paths[i + 1];
+    }
+    hatch.paths = (struct DxfHatchBoundaryPath *) paths;
+    if ((dxf_area_calculate_hatch (&hatch, &area) != EXIT_SUCCESS)
+      || (fabs (area.area - 68.0) > 1e-9))
+        fprintf (stdout, "TESTS: hatch with nested islands has a wrong area\n");
+    else
+        fprintf (stdout, "TESTS: hatch with nested islands has an area of 68\n");
+
+    /*
+     * A hatch packed into a store, unpacked into lists and packed again
+     * keeps its edge types, knots, control points and vertices.
+     */
+    memset (&composite, 0, sizeof (composite));
+    memset (&edge_line, 0, sizeof (edge_line));
+    memset (&edge_arc, 0, sizeof (edge_arc));
+    memset (&edge_spline, 0, sizeof (edge_spline));
+    memset (control_points, 0, sizeof (control_points));
+    edge_line.x1 = 10.0;
+    edge_arc.x0 = 5.0;
+    edge_arc.radius = 5.0;
+    edge_arc.end_angle = 180.0;
+    edge_arc.is_ccw = 1;
+    for (i = 0; i < 3; i++)
+    {
+        control_points[i].x0 = 5.0 * i;
+        control_points[i].y0 = (i == 1) ? 5.0 : 0.0;
+        control_points[i].weight = (i == 1) ? 0.5 : 1.0;
+        if (i < 2)
+            control_points[i].next = (struct DxfHatchBoundaryPathEdgeSplineCp *) &control_points[i + 1];
+    }
+    edge_spline.degree = 2;
+    edge_spline.rational = 1;
+    edge_spline.knots = knots;
+    edge_spline.number_of_knots = 6;
+    edge_spline.knots_size = 6;
+    edge_spline.control_points = (struct DxfHatchBoundaryPathEdgeSplineCp *) control_points;
+    edge_spline.number_of_control_points = 3;
+    composite.lines = (struct DxfHatchBoundaryPathEdgeLine *) &edge_line;
+    composite.arcs = (struct DxfHatchBoundaryPathEdgeArc *) &edge_arc;
+    composite.splines = (struct DxfHatchBoundaryPathEdgeSpline *) &edge_spline;
+    paths[0].edges = (struct DxfHatchBoundaryPathEdge *) &composite;
+    vertices[1][1].bulge = 0.5;
+    vertices[1][1].has_bulge = 1;
+    memset (&unpacked, 0, sizeof (DxfHatch));
+    store = dxf_hatch_store_init (dxf_hatch_store_new ());
+    repacked = dxf_hatch_store_init (dxf_hatch_store_new ());
+    if ((store == NULL)
+      || (repacked == NULL)
+      || (dxf_hatch_store_pack (store, &hatch) != EXIT_SUCCESS)
+      || (store->number_of_paths != 3)
+      || (store->number_of_edges != 3)
+      || (store->edges[0].type != DXF_HATCH_STORE_EDGE_ARC)
+      || (store->edges[1].type != DXF_HATCH_STORE_EDGE_LINE)
+      || (store->edges[2].type != DXF_HATCH_STORE_EDGE_SPLINE)
+      || (dxf_hatch_store_get_knots (store, dxf_hatch_store_get_spline (store, &store->edges[2]))[3] != 1.0)
+      || (store->number_of_vertices != 12)
+      || (store->vertices[5].bulge != 0.5)
+      || (dxf_hatch_store_unpack (store, &unpacked) != EXIT_SUCCESS)
+      || (unpacked.number_of_boundary_paths != 3)
+      || (dxf_hatch_store_pack (repacked, &unpacked) != EXIT_SUCCESS)
+      || (!compare_hatch_stores (store, repacked)))
+        fprintf (stdout, "TESTS: hatch store round trip lost boundary data\n");
+    else
+        fprintf (stdout, "TESTS: hatch store round trip keeps edges, knots and vertices\n");
+    if (unpacked.paths != NULL)
+    {
+        free_unpacked_paths ((DxfHatchBoundaryPath *) unpacked.paths);
+        dxf_hatch_boundary_path_free_chain ((DxfHatchBoundaryPath *) unpacked.paths);
+    }
+    if (store != NULL)
+        dxf_hatch_store_free (store);
+    if (repacked != NULL)
+        dxf_hatch_store_free (repacked);
+
+    /*
+     * A polyface mesh becomes two triangles for its quadrilateral face,
+     * a polygon mesh closed in the N direction wraps its last column.
+     */
+    file = fopen ("mesh.dxf", "w");
+    if (file != NULL)
+    {
+        fputs ("  0\nSECTION\n  2\nENTITIES\n"
+          "  0\nPOLYLINE\n  8\n0\n 66\n1\n 70\n64\n 71\n4\n 72\n1\n"
+          "  0\nVERTEX\n  8\n0\n 10\n0.0\n 20\n0.0\n 70\n192\n"
+          "  0\nVERTEX\n  8\n0\n 10\n1.0\n 20\n0.0\n 70\n192\n"
+          "  0\nVERTEX\n  8\n0\n 10\n1.0\n 20\n1.0\n 70\n192\n"
+          "  0\nVERTEX\n  8\n0\n 10\n0.0\n 20\n1.0\n 70\n192\n"
+          "  0\nVERTEX\n  8\n0\n 10\n0.0\n 20\n0.0\n 70\n128\n"
+          " 71\n1\n 72\n2\n 73\n-3\n 74\n4\n"
+          "  0\nSEQEND\n  8\n0\n"
+          "  0\nENDSEC\n  0\nEOF\n", file);
+        fclose (file);
+    }
+    drawing = dxf_file_read ("mesh.dxf");
+    polyline = NULL;
+    mesh = NULL;
+    if ((drawing != NULL) && (dxf_drawing_get_number_of_entities (drawing) == 1))
+        polyline = ((DxfDrawingEntity *) dxf_chunk_list_get ((DxfChunkList *) drawing->entities, 0))->entity;
+    if (polyline != NULL)
+        mesh = dxf_polyline_build_mesh (polyline);
+    if ((mesh == NULL)
+      || (dxf_indexed_mesh_get_number_of_vertices (mesh) != 4)
+      || (dxf_indexed_mesh_get_number_of_triangles (mesh) != 2)
+      || ((indices = dxf_indexed_mesh_get_indices (mesh)) == NULL)
+      || (indices[2] != 2)
+      || (indices[3] != 0)
+      || (indices[5] != 3)
+      || (dxf_indexed_mesh_get_vertices (mesh)[7] != 1.0))
+        fprintf (stdout, "TESTS: polyface mesh was not indexed\n");
+    else
+        fprintf (stdout, "TESTS: polyface mesh indexed into 2 triangles\n");
+    if (drawing != NULL)
+        dxf_drawing_free (drawing);
+    remove ("mesh.dxf");
+    mesh = dxf_indexed_mesh_init (dxf_indexed_mesh_new (),
+      DXF_POLYLINE_FLAG_POLYGON_MESH | DXF_POLYLINE_FLAG_CLOSED_N, 2, 3);
+    for (i = 0; i < 6; i++)
+        dxf_indexed_mesh_append_vertex (mesh, (double) (i % 3), (double) (i / 3), 0.0);
+    if ((dxf_indexed_mesh_finish (mesh) != EXIT_SUCCESS)
+      || (dxf_indexed_mesh_get_number_of_triangles (mesh) != 6)
+      || ((indices = dxf_indexed_mesh_get_indices (mesh)) == NULL)
+      || (indices[13] != 0)
+      || (indices[14] != 3))
+        fprintf (stdout, "TESTS: closed polygon mesh was not indexed\n");
+    else
+        fprintf (stdout, "TESTS: closed 2 x 3 polygon mesh indexed into 6 triangles\n");
+    dxf_indexed_mesh_free (mesh);
+
+    /*
+     * A pool keeps up to DXF_POOL_MAX_FREE_OBJECTS released objects of
+     * a type and hands them out again, zero filled.
+     */
+    dxf_pool_release ();
+    dxf_pool_reset_stats ();
+    for (i = 0; i < DXF_POOL_MAX_FREE_OBJECTS + 44; i++)
+        objects[i] = dxf_pool_alloc (DXF_POOL_LINE, sizeof (DxfLine));
+    for (i = 0; i < DXF_POOL_MAX_FREE_OBJECTS + 44; i++)
+        dxf_pool_free (DXF_POOL_LINE, objects[i]);
+    line = dxf_line_new ();
+    if ((dxf_pool_get_stats (DXF_POOL_LINE, &pool_stats) != EXIT_SUCCESS)
+      || (line == NULL)
+      || (line->next != NULL)
+      || (pool_stats.misses != DXF_POOL_MAX_FREE_OBJECTS + 44)
+      || (pool_stats.releases != DXF_POOL_MAX_FREE_OBJECTS)
+      || (pool_stats.discards != 44)
+      || (pool_stats.hits != 1)
+      || (pool_stats.number_of_free_objects != DXF_POOL_MAX_FREE_OBJECTS - 1))
+        fprintf (stdout, "TESTS: LINE pool counters are wrong\n");
+    else
+        fprintf (stdout, "TESTS: LINE pool recycled a released struct\n");
+    if (line != NULL)
+        dxf_line_free (line);
+    dxf_pool_release ();
+    if ((dxf_pool_get_stats (DXF_POOL_LINE, &pool_stats) != EXIT_SUCCESS)
+      || (pool_stats.number_of_free_objects != 0))
+        fprintf (stdout, "TESTS: LINE pool was not released\n");
+
+    /*
+     * A chunked container keeps its entries in place while it grows,
+     * its copy is independent, a POLYLINE indexes its vertices in one.
+     */
+    chunks = dxf_chunk_list_init (dxf_chunk_list_new (), sizeof (int), 4);
+    for (i = 0; i < 10; i++)
+    {
+        entry = dxf_chunk_list_append (chunks, &i);
+        if (i == 0)
+            first_entry = entry;
+    }
+    chunks_copy = dxf_chunk_list_copy (chunks);
+    if (chunks_copy != NULL)
+        *((int *) dxf_chunk_list_get (chunks_copy, 0)) = 100;
+    sum = 0;
+    dxf_chunk_list_iter_init (chunks, &iter);
+    while ((entry = dxf_chunk_list_iter_next (&iter)) != NULL)
+        sum += *entry;
+    if ((chunks_copy == NULL)
+      || (dxf_chunk_list_get_number_of_entries (chunks) != 10)
+      || (dxf_chunk_list_get (chunks, 0) != first_entry)
+      || (*((int *) dxf_chunk_list_get (chunks, 6)) != 6)
+      || (*((int *) dxf_chunk_list_get_last (chunks)) != 9)
+      || (dxf_chunk_list_get (chunks, 10) != NULL)
+      || (sum != 45)
+      || (*((int *) dxf_chunk_list_get (chunks_copy, 9)) != 9))
+        fprintf (stdout, "TESTS: chunk list lost entries\n");
+    else
+        fprintf (stdout, "TESTS: chunk list kept 10 entries in blocks of 4\n");
+    dxf_chunk_list_free (chunks);
+    if (chunks_copy != NULL)
+        dxf_chunk_list_free (chunks_copy);
+    polyline = dxf_polyline_init (dxf_polyline_new ());
+    for (i = 0; i < 100; i++)
+    {
+        vertex = dxf_vertex_init (dxf_vertex_new ());
+        vertex->x0 = (double) i;
+        dxf_polyline_append_vertex (polyline, vertex);
+    }
+    for (i = 0, vertex = (DxfVertex *) polyline->vertices;
+      (vertex != NULL) && (vertex->next != NULL);
+      i++, vertex = (DxfVertex *) vertex->next);
+    if ((dxf_polyline_get_number_of_vertices (polyline) != 100)
+      || (dxf_polyline_get_vertex (polyline, 57)->x0 != 57.0)
+      || (i != 99)
+      || (vertex->x0 != 99.0))
+        fprintf (stdout, "TESTS: POLYLINE vertex index is wrong\n");
+    else
+        fprintf (stdout, "TESTS: POLYLINE indexed 100 appended vertices\n");
+    dxf_entity_free (POLYLINE, polyline);
+
+    /*
+     * The memory accounting counts the entities per type, the unused
+     * capacity of the LWPOLYLINE vertex array as slack, and the total
+     * is the sum of the sections.
+     */
+    file = fopen ("memory.dxf", "w");
+    if (file != NULL)
+    {
+        fputs ("  0\nSECTION\n  2\nENTITIES\n"
+          "  0\nLINE\n  8\n0\n 10\n0.0\n 20\n0.0\n 11\n1.0\n 21\n1.0\n"
+          "  0\nLINE\n  8\nA\n 10\n1.0\n 20\n1.0\n 11\n2.0\n 21\n0.0\n"
+          "  0\nLWPOLYLINE\n  8\n0\n 90\n3\n 70\n0\n"
+          " 10\n0.0\n 20\n0.0\n 10\n4.0\n 20\n0.0\n 10\n4.0\n 20\n3.0\n"
+          "  0\nENDSEC\n  0\nEOF\n", file);
+        fclose (file);
+    }
+    drawing = dxf_file_read ("memory.dxf");
+    lwpolyline = NULL;
+    if ((drawing != NULL) && (dxf_drawing_get_number_of_entities (drawing) == 3))
+        lwpolyline = ((DxfDrawingEntity *) dxf_chunk_list_get ((DxfChunkList *) drawing->entities, 2))->entity;
+    section_bytes = 0;
+    if ((lwpolyline != NULL)
+      && (dxf_drawing_memory_stats (drawing, &memory_stats) == EXIT_SUCCESS))
+        for (i = 0; i < DXF_MEMORY_STATS_NUMBER_OF_SECTIONS; i++)
+            section_bytes += dxf_memory_stats_get_bytes (&memory_stats.section[i]);
+    if ((lwpolyline == NULL)
+      || (memory_stats.entity[LINE].number_of_objects != 2)
+      || (memory_stats.entity[LINE].struct_bytes != 2 * sizeof (DxfLine))
+      || (memory_stats.entity[LWPOLYLINE].number_of_objects != 1)
+      || (memory_stats.entity[LWPOLYLINE].sub_record_bytes != (size_t) lwpolyline->vertices_size * sizeof (DxfLWPolylineVertex))
+      || (memory_stats.entity[LWPOLYLINE].slack_bytes != (size_t) (lwpolyline->vertices_size - 3) * sizeof (DxfLWPolylineVertex))
+      || (memory_stats.section[DXF_MEMORY_STATS_ENTITIES].number_of_objects != 3)
+      || (memory_stats.section[DXF_MEMORY_STATS_INDEX].string_bytes == 0)
+      || (dxf_memory_stats_get_bytes (&memory_stats.total) != section_bytes))
+        fprintf (stdout, "TESTS: memory accounting is wrong\n");
+    else
+        fprintf (stdout, "TESTS: memory accounting counted 2 LINE and 1 LWPOLYLINE\n");
+    if (drawing != NULL)
+        dxf_drawing_free (drawing);
+    remove ("memory.dxf");
+
+    /*
+     * The extents follow the arc and the bulge of a LWPOLYLINE instead
+     * of their end points, and are written as $EXTMIN and $EXTMAX.
+     */
+    file = fopen ("bounds.dxf", "w");
+    if (file != NULL)
+    {
+        fputs ("  0\nSECTION\n  2\nENTITIES\n"
+          "  0\nARC\n  8\n0\n 10\n0.0\n 20\n0.0\n 30\n0.0\n 40\n2.0\n"
+          " 50\n0.0\n 51\n90.0\n"
+          "  0\nLWPOLYLINE\n  8\n0\n 90\n2\n 70\n0\n"
+          " 10\n4.0\n 20\n0.0\n 42\n1.0\n 10\n6.0\n 20\n0.0\n"
+          "  0\nENDSEC\n  0\nEOF\n", file);
+        fclose (file);
+    }
+    drawing = dxf_file_read ("bounds.dxf");
+    serial = NULL;
+    serial_size = 0;
+    memset (&output, 0, sizeof (DxfFile));
+    output.acad_version_number = AutoCAD_2000;
+    output.update_extents = TRUE;
+    if ((drawing != NULL)
+      && (dxf_drawing_get_bounds (drawing, NULL, &bounds) == EXIT_SUCCESS)
+      && ((output.fp = open_memstream (&serial, &serial_size)) != NULL))
+    {
+        dxf_file_write (&output, drawing);
+        fclose (output.fp);
+    }
+    if ((serial == NULL)
+      || (fabs (bounds.min.x) > 1e-9)
+      || (fabs (bounds.min.y + 1.0) > 1e-9)
+      || (fabs (bounds.max.x - 6.0) > 1e-9)
+      || (fabs (bounds.max.y - 2.0) > 1e-9)
+      || (strstr (serial, "$EXTMIN\n 10\n0.000000\n 20\n-1.000000\n") == NULL)
+      || (strstr (serial, "$EXTMAX\n 10\n6.000000\n 20\n2.000000\n") == NULL))
+        fprintf (stdout, "TESTS: drawing extents are wrong\n");
+    else
+        fprintf (stdout, "TESTS: drawing extents cover the arc and the bulge\n");
+    free (serial);
+    serial = NULL;
+    if (drawing != NULL)
+        dxf_drawing_free (drawing);
+    remove ("bounds.dxf");
+
+    /*
+     * An R-tree over a row of 100 vertical LINE entities selects them
+     * by window, crossing window and layer, and forgets removed ones.
+     */
+    file = fopen ("tree.dxf", "w");
+    if (file != NULL)
+    {
+        fputs ("  0\nSECTION\n  2\nENTITIES\n", file);
+        for (i = 0; i < 100; i++)
+            fprintf (file, "  0\nLINE\n  8\n%s\n 10\n%d.0\n 20\n0.0\n 11\n%d.0\n 21\n1.0\n",
+              (i % 2) ? "B" : "A", i, i);
+        fputs ("  0\nENDSEC\n  0\nEOF\n", file);
+        fclose (file);
+    }
+    drawing = dxf_file_read ("tree.dxf");
+    tree = dxf_spatial_index_tree_init (dxf_spatial_index_tree_new ());
+    memset (number_of_items, 0, sizeof (number_of_items));
+    if ((drawing != NULL)
+      && (dxf_spatial_index_tree_build (tree, drawing, NULL) == EXIT_SUCCESS))
+    {
+        dxf_bounds_init (&bounds);
+        dxf_bounds_add_point (&bounds, 9.5, -1.0, 0.0);
+        dxf_bounds_add_point (&bounds, 20.5, 2.0, 0.0);
+        number_of_items[0] = dxf_spatial_index_tree_query (tree, &bounds,
+          DXF_SPATIAL_INDEX_WINDOW, NULL, UNKNOWN_ENTITY, items, 16);
+        number_of_items[1] = dxf_spatial_index_tree_query (tree, &bounds,
+          DXF_SPATIAL_INDEX_WINDOW, "B", LINE, NULL, 0);
+        dxf_spatial_index_tree_remove (tree,
+          dxf_spatial_index_tree_find (tree, ((DxfDrawingEntity *) dxf_chunk_list_get ((DxfChunkList *) drawing->entities, 15))->entity));
+        number_of_items[2] = dxf_spatial_index_tree_query (tree, &bounds,
+          DXF_SPATIAL_INDEX_WINDOW, NULL, UNKNOWN_ENTITY, NULL, 0);
+        dxf_bounds_init (&bounds);
+        dxf_bounds_add_point (&bounds, 9.5, 0.5, 0.0);
+        dxf_bounds_add_point (&bounds, 10.5, 0.6, 0.0);
+        number_of_items[3] = dxf_spatial_index_tree_query (tree, &bounds,
+          DXF_SPATIAL_INDEX_CROSSING, NULL, UNKNOWN_ENTITY, items, 16);
+    }
+    if ((number_of_items[0] != 11)
+      || (number_of_items[1] != 5)
+      || (number_of_items[2] != 10)
+      || (number_of_items[3] != 1)
+      || (((DxfLine *) items[0]->entity)->x0 != 10.0)
+      || (dxf_spatial_index_tree_get_number_of_items (tree) != 99))
+        fprintf (stdout, "TESTS: R-tree queries are wrong\n");
+    else
+        fprintf (stdout, "TESTS: R-tree selected LINE entities by window, layer and crossing\n");
+
+    /*
+     * The nearest LINE entities are picked in order of their distance,
+     * snapping finds the nearest end point, the tolerance is honoured.
+     */
+    point.x = 10.4;
+    point.y = 0.5;
+    point.z = 0.0;
+    number_of_items[0] = dxf_spatial_index_tree_nearest (tree, point, HUGE_VAL,
+      DXF_SPATIAL_INDEX_NEAREST_CURVE, NULL, UNKNOWN_ENTITY, nearest, 2);
+    number_of_items[1] = dxf_spatial_index_tree_nearest (tree, point, 0.3,
+      DXF_SPATIAL_INDEX_NEAREST_CURVE, NULL, UNKNOWN_ENTITY, nearest, 2);
+    if ((number_of_items[0] != 2)
+      || (number_of_items[1] != 0)
+      || (((DxfLine *) nearest[0].item->entity)->x0 != 10.0)
+      || (fabs (nearest[0].distance - 0.4) > 1e-9)
+      || (fabs (nearest[0].point.y - 0.5) > 1e-9)
+      || (((DxfLine *) nearest[1].item->entity)->x0 != 11.0)
+      || (fabs (nearest[1].distance - 0.6) > 1e-9))
+        fprintf (stdout, "TESTS: nearest LINE entities are wrong\n");
+    else
+        fprintf (stdout, "TESTS: nearest LINE entities picked in order\n");
+    point.x = 20.1;
+    point.y = 1.2;
+    if ((dxf_spatial_index_tree_nearest (tree, point, HUGE_VAL,
+      DXF_SPATIAL_INDEX_NEAREST_END_POINT, NULL, LINE, nearest, 1) != 1)
+      || (nearest[0].point.x != 20.0)
+      || (nearest[0].point.y != 1.0)
+      || (fabs (nearest[0].distance - sqrt (0.05)) > 1e-9))
+        fprintf (stdout, "TESTS: nearest end point is wrong\n");
+    else
+        fprintf (stdout, "TESTS: nearest end point snapped to (20, 1)\n");
+    dxf_spatial_index_tree_free (tree);
+    if (drawing != NULL)
+        dxf_drawing_free (drawing);
+    remove ("tree.dxf");
+
+    /*
+     * A bulge bulging out of a square adds area, a negative bulge bites
+     * into it; many points against a 64 edge ring give the same answer
+     * in one batch as one by one.
+     */
+    square_path (&paths[0], &polylines[0], vertices[0], 0.0, 4.0);
+    vertices[0][1].bulge = 1.0;
+    vertices[0][1].has_bulge = 1;
+    vertices[0][2].bulge = -0.5;
+    vertices[0][2].has_bulge = 1;
+    test_points[0].x = 5.0;
+    test_points[0].y = 2.0;
+    test_points[1].x = 5.0;
+    test_points[1].y = 3.9;
+    test_points[2].x = 2.0;
+    test_points[2].y = 3.5;
+    test_points[3].x = 2.0;
+    test_points[3].y = 2.5;
+    if ((dxf_hatch_boundary_path_polyline_point_inside_polyline (&polylines[0], test_points[0]) != INSIDE)
+      || (dxf_hatch_boundary_path_polyline_point_inside_polyline (&polylines[0], test_points[1]) != OUTSIDE)
+      || (dxf_hatch_boundary_path_polyline_point_inside_polyline (&polylines[0], test_points[2]) != OUTSIDE)
+      || (dxf_hatch_boundary_path_polyline_point_inside_polyline (&polylines[0], test_points[3]) != INSIDE))
+        fprintf (stdout, "TESTS: point in polygon ignored a bulge\n");
+    else
+        fprintf (stdout, "TESTS: point in polygon follows positive and negative bulges\n");
+    memset (ring, 0, sizeof (ring));
+    for (i = 0; i < 64; i++)
+    {
+        ring[i].x0 = 10.0 * cos (i * M_PI / 32.0);
+        ring[i].y0 = 10.0 * sin (i * M_PI / 32.0);
+        if (i < 63)
+            ring[i].next = (struct DxfHatchBoundaryPathPolylineVertex *) &ring[i + 1];
+    }
+    polylines[0].vertices = (struct DxfHatchBoundaryPathPolylineVertex *) ring;
+    polylines[0].number_of_vertices = 64;
+    for (i = 0; i < 441; i++)
+    {
+        test_points[i].x = (double) ((i % 21) - 10) + 0.25;
+        test_points[i].y = (double) ((i / 21) - 10) + 0.25;
+    }
+    sum = 0;
+    for (i = 0; i < 441; i++)
+        if (dxf_hatch_boundary_path_polyline_point_inside_polyline (&polylines[0], test_points[i]) == INSIDE)
+            sum++;
+    number_of_items[0] = dxf_hatch_boundary_path_polyline_points_inside_polyline (&polylines[0],
+      test_points, 441, inside);
+    for (i = 0; i < 441; i++)
+        if ((inside[i] == INSIDE) != (dxf_hatch_boundary_path_polyline_point_inside_polyline (&polylines[0], test_points[i]) == INSIDE))
+            number_of_items[0] = -1;
+    if ((number_of_items[0] != sum)
+      || (inside[220] != INSIDE)
+      || (inside[440] != OUTSIDE))
+        fprintf (stdout, "TESTS: batched point in polygon differs\n");
+    else
+        fprintf (stdout, "TESTS: batched point in polygon found %d of 441 points inside\n", sum);
+
+    /*
+     * The chord height sets the fewest segments keeping the arc within
+     * tolerance, clamped to the minimum and maximum per turn; a CIRCLE
+     * and a bulge are tessellated within it.
+     */
+    memset (&tolerance, 0, sizeof (DxfTessellation));
+    tolerance.chord_height = 0.01;
+    segments = dxf_tessellation_get_number_of_segments (&tolerance, 10.0, 2.0 * M_PI);
+    if ((10.0 * (1.0 - cos (M_PI / segments)) > 0.01)
+      || (10.0 * (1.0 - cos (M_PI / (segments - 1))) <= 0.01)
+      || (dxf_tessellation_get_number_of_segments (&tolerance, 0.001, 2.0 * M_PI) != DXF_TESSELLATION_MIN_SEGMENTS)
+      || (dxf_tessellation_get_number_of_segments (&tolerance, 1e9, 2.0 * M_PI) != DXF_TESSELLATION_MAX_SEGMENTS))
+        fprintf (stdout, "TESTS: chord height tolerance gives a wrong number of segments\n");
+    else
+        fprintf (stdout, "TESTS: chord height of 0.01 splits a circle of radius 10 into %d segments\n", segments);
+    circle = dxf_circle_init (dxf_circle_new ());
+    circle->x0 = 1.0;
+    circle->y0 = 2.0;
+    circle->radius = 10.0;
+    tessellation = dxf_tessellation_buffer_init (dxf_tessellation_buffer_new ());
+    sum = 0;
+    if ((dxf_tessellation_add_entity (&tolerance, CIRCLE, circle, 0, tessellation) == EXIT_SUCCESS)
+      && (tessellation->number_of_runs == 1)
+      && (tessellation->runs[0].closed)
+      && (tessellation->runs[0].number_of_points == segments + 1))
+    {
+        for (i = 0; i < segments; i++)
+        {
+            point = tessellation->points[i];
+            if ((fabs (hypot (point.x - 1.0, point.y - 2.0) - 10.0) > 1e-9)
+              || (hypot ((point.x + tessellation->points[i + 1].x) / 2.0 - 1.0,
+              (point.y + tessellation->points[i + 1].y) / 2.0 - 2.0) < 10.0 - 0.01 - 1e-9))
+                break;
+        }
+        sum = (i == segments);
+    }
+    dxf_ocs_init (&ocs, 0.0, 0.0, 1.0);
+    i = dxf_tessellation_bulge (&tolerance, &ocs, 0.0, 0.0, 2.0, 0.0, 0.0, 1.0, arc_points, 64);
+    if ((!sum)
+      || (i != dxf_tessellation_get_number_of_segments (&tolerance, 1.0, M_PI) + 1)
+      || (i > 64)
+      || (arc_points[0].x != 0.0)
+      || (fabs (arc_points[i - 1].x - 2.0) > 1e-9)
+      || (fabs (arc_points[i / 2].y + 1.0) > 0.01))
+        fprintf (stdout, "TESTS: CIRCLE or bulge tessellation is out of tolerance\n");
+    else
+        fprintf (stdout, "TESTS: CIRCLE and bulge tessellated within the chord height\n");
+
+    /*
+     * A MINSERT repeats its block over its rows and columns, a rotated
+     * and scaled INSERT of a block with a nested INSERT goes through
+     * both transformations, base points included.
+     */
+    memset (blocks, 0, sizeof (blocks));
+    memset (&block_line, 0, sizeof (DxfLine));
+    memset (inserts, 0, sizeof (inserts));
+    blocks[0].block_name = (char *) "SQ";
+    blocks[0].x0 = 1.0;
+    blocks[1].block_name = (char *) "NEST";
+    block_line.x1 = 1.0;
+    block_line.extr_z0 = 1.0;
+    for (i = 0; i < 3; i++)
+        inserts[i].extr_z0 = 1.0;
+    inserts[0].block_name = (char *) "SQ";
+    inserts[0].y0 = 1.0;
+    inserts[1].block_name = (char *) "SQ";
+    inserts[1].columns = 2;
+    inserts[1].rows = 3;
+    inserts[1].column_spacing = 5.0;
+    inserts[1].row_spacing = 7.0;
+    inserts[2].block_name = (char *) "NEST";
+    inserts[2].x0 = 10.0;
+    inserts[2].rel_x_scale = 2.0;
+    inserts[2].rel_y_scale = 2.0;
+    inserts[2].rot_angle = 90.0;
+    block_entities[0].type = LINE;
+    block_entities[0].entity = &block_line;
+    block_entities[1].type = INSERT;
+    block_entities[1].entity = &inserts[0];
+    expand_cache = dxf_expand_cache_init (dxf_expand_cache_new ());
+    dxf_tessellation_buffer_clear (tessellation);
+    if ((expand_cache == NULL)
+      || (dxf_expand_cache_set_block (expand_cache, &blocks[0], &block_entities[0], 1) != EXIT_SUCCESS)
+      || (dxf_expand_cache_set_block (expand_cache, &blocks[1], &block_entities[1], 1) != EXIT_SUCCESS)
+      || (dxf_expand_insert (expand_cache, &inserts[1], 0, tessellation) != EXIT_SUCCESS)
+      || (dxf_expand_insert (expand_cache, &inserts[2], 1, tessellation) != EXIT_SUCCESS)
+      || (tessellation->number_of_runs != 7)
+      || (tessellation->number_of_points != 14)
+      || (tessellation->runs[5].entity != 0)
+      || (fabs (tessellation->points[10].x - 4.0) > 1e-9)
+      || (fabs (tessellation->points[10].y - 14.0) > 1e-9)
+      || (tessellation->runs[6].entity != 1)
+      || (fabs (tessellation->points[12].x - 8.0) > 1e-9)
+      || (fabs (tessellation->points[12].y + 2.0) > 1e-9)
+      || (fabs (tessellation->points[13].x - 8.0) > 1e-9)
+      || (fabs (tessellation->points[13].y) > 1e-9))
+        fprintf (stdout, "TESTS: INSERT or MINSERT expansion is misplaced\n");
+    else
+        fprintf (stdout, "TESTS: MINSERT expanded into 6 copies, nested INSERT transformed twice\n");
+    if (expand_cache != NULL)
+        dxf_expand_cache_free (expand_cache);
+    dxf_tessellation_buffer_free (tessellation);
+    dxf_circle_free (circle);
     
     return 1;
 }